@@ -0,0 +1,95 @@
+// GxEPD2 3-color (Black/White/Red) conversion, shared by the /render `bwr`
+// branch and tools/golden.js so the firmware's golden frames come from the
+// exact code the device is served by.
+//
+// Input: RGBA pixels (sharp .ensureAlpha().raw()), alpha ignored.
+// Output: [BlackPlane][RedPlane], 1 bit per pixel, 8 pixels per byte, MSB first.
+// 0 = Active (Black or Red), 1 = Inactive (White or No Red)
+function rgbaToBwr(data, w, h, dither) {
+  const stride = Math.ceil(w / 8);
+  const planeSize = stride * h;
+
+  // Initialize buffers with 0xFF (All 1s -> White / No Red)
+  const bwBuffer = Buffer.alloc(planeSize, 0xFF);
+  const redBuffer = Buffer.alloc(planeSize, 0xFF);
+
+  // For dithering, we need float buffers to accumulate error
+  const pixels = new Float32Array(w * h * 3); // RGB only
+  for (let i = 0; i < w * h; i++) {
+    pixels[i * 3] = data[i * 4];
+    pixels[i * 3 + 1] = data[i * 4 + 1];
+    pixels[i * 3 + 2] = data[i * 4 + 2];
+  }
+
+  // Floyd-Steinberg dithering distribution
+  const distributeError = (x, y, errR, errG, errB) => {
+    const offsets = [
+      [1, 0, 7/16],
+      [-1, 1, 3/16],
+      [0, 1, 5/16],
+      [1, 1, 1/16]
+    ];
+    for (const [dx, dy, factor] of offsets) {
+      const nx = x + dx;
+      const ny = y + dy;
+      if (nx >= 0 && nx < w && ny < h) {
+        const nidx = (ny * w + nx) * 3;
+        pixels[nidx] += errR * factor;
+        pixels[nidx + 1] += errG * factor;
+        pixels[nidx + 2] += errB * factor;
+      }
+    }
+  };
+
+  for (let y = 0; y < h; y++) {
+    for (let x = 0; x < w; x++) {
+      const pidx = (y * w + x) * 3;
+      const r = Math.max(0, Math.min(255, pixels[pidx]));
+      const g = Math.max(0, Math.min(255, pixels[pidx + 1]));
+      const b = Math.max(0, Math.min(255, pixels[pidx + 2]));
+
+      // Calculate squared euclidean distance to palette colors
+      const distBlack = r*r + g*g + b*b;
+      const distWhite = (r-255)**2 + (g-255)**2 + (b-255)**2;
+      const distRed   = (r-255)**2 + g*g + b*b;
+
+      let chosenR, chosenG, chosenB;
+      let isBlack = false;
+      let isRed = false;
+
+      // Determine closest color
+      if (distRed < distBlack && distRed < distWhite) {
+        isRed = true;
+        chosenR = 255; chosenG = 0; chosenB = 0;
+      } else if (distBlack <= distWhite) {
+        isBlack = true;
+        chosenR = 0; chosenG = 0; chosenB = 0;
+      } else {
+        chosenR = 255; chosenG = 255; chosenB = 255;
+      }
+
+      // Apply Floyd-Steinberg dithering if enabled
+      if (dither) {
+        const errR = r - chosenR;
+        const errG = g - chosenG;
+        const errB = b - chosenB;
+        distributeError(x, y, errR, errG, errB);
+      }
+
+      const byteIdx = y * stride + Math.floor(x / 8);
+      const bitMask = 0x80 >> (x % 8);
+
+      if (isBlack) {
+        // Black: BW=0, Red=1
+        bwBuffer[byteIdx] &= ~bitMask;
+      } else if (isRed) {
+        // Red: BW=1, Red=0
+        redBuffer[byteIdx] &= ~bitMask;
+      }
+    }
+  }
+
+  return Buffer.concat([bwBuffer, redBuffer]);
+}
+
+module.exports = { rgbaToBwr };
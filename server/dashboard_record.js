@@ -0,0 +1,62 @@
+// Binary form of the /dashboard payload (GET /dashboard?format=bin).
+//
+// The firmware streams it into its DashboardData struct without a JSON
+// document on the heap; the layout is documented in src/dashboard_data.h.
+// Little-endian, strings are a byte length followed by UTF-8.
+
+const RECORD_RUSSIAN = 0x01;
+const MAX_STRING_BYTES = 255;
+
+// UTF-8 bytes of text, at most max, not ending inside a character
+function utf8Bytes(text, max) {
+  const bytes = Buffer.from(String(text || ''), 'utf8');
+  if (bytes.length <= max) return bytes;
+  let end = max;
+  while (end > 0 && (bytes[end] & 0xC0) === 0x80) end--;
+  return bytes.subarray(0, end);
+}
+
+// Exactly length ASCII bytes, padded with zeros
+function fixedChars(text, length) {
+  const out = Buffer.alloc(length);
+  out.write(String(text || '').slice(0, length), 'latin1');
+  return out;
+}
+
+function int8(value) {
+  return Math.max(-128, Math.min(127, Math.round(Number(value) || 0)));
+}
+
+function encodeDashboardRecord(dashboard) {
+  const parts = [];
+  const byte = value => parts.push(Buffer.from([value & 0xFF]));
+  const string = text => {
+    const bytes = utf8Bytes(text, MAX_STRING_BYTES);
+    byte(bytes.length);
+    parts.push(bytes);
+  };
+  const forecast = dashboard.fc || [];
+  const events = dashboard.ev || [];
+
+  parts.push(Buffer.from('WX', 'ascii'));
+  byte(dashboard.v);
+  byte(dashboard.lang === 'ru' ? RECORD_RUSSIAN : 0);
+  byte(int8(dashboard.temp));
+  parts.push(fixedChars(dashboard.icon, 3));
+  byte(forecast.length);
+  byte(events.length);
+  string(dashboard.city);
+  string(dashboard.desc);
+  for (const day of forecast) {
+    byte(day.day);
+    byte(int8(day.temp));
+    parts.push(fixedChars(day.icon, 3));
+  }
+  for (const event of events) {
+    parts.push(fixedChars(event.time, 5));
+    string(event.title);
+  }
+  return Buffer.concat(parts);
+}
+
+module.exports = { encodeDashboardRecord };
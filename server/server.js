@@ -4,6 +4,10 @@ const Jimp = require('jimp');
 const sharp = require('sharp');
 const fs = require('fs');
 const path = require('path');
+const zlib = require('zlib');
+const crypto = require('crypto');
+const { rgbaToBwr } = require('./bwr');
+const { encodeDashboardRecord } = require('./dashboard_record');
 
 const app = express();
 app.use(express.json()); // Support JSON-encoded bodies
@@ -52,7 +56,11 @@ const DEFAULT_CONFIG = {
   sharpen: 0,
   dither: false,
   viewport: { width: 800, height: 480, layoutWidth: 800 },
-  crop: { x: 0, y: 0, width: 800, height: 480 }
+  crop: { x: 0, y: 0, width: 800, height: 480 },
+  playlist: [],       // Frames for /playlist, see below
+  playlistRefresh: 0, // Seconds between bundle fetches suggested to the device (0 = firmware default)
+  panelTemperature: null, // °C where the display hangs, sent as X-Panel-Temperature (null = device's own sensor)
+  dashboard: {}       // Data for /dashboard, see below
 };
 
 // User agents
@@ -236,6 +244,16 @@ async function addTimestampWatermark(imagePath, timezoneOffset = 3, cropBounds =
     }
 }
 
+// Every response tells the device the temperature at the panel, which
+// picks its waveform and how long a refresh may take
+app.use((req, res, next) => {
+  const { panelTemperature } = loadConfig();
+  if (typeof panelTemperature === 'number' && Number.isFinite(panelTemperature)) {
+    res.set('X-Panel-Temperature', panelTemperature.toFixed(1));
+  }
+  next();
+});
+
 // Config endpoints
 app.get('/config', (req, res) => {
   res.json(loadConfig());
@@ -260,6 +278,18 @@ app.get('/config.html', (req, res) => {
 // Health check
 app.get('/health', (req, res) => res.status(200).send('OK'));
 
+// Device telemetry (download size/time, RSSI, heap), one JSON object per line
+const TELEMETRY_PATH = path.join(DATA_DIR, 'telemetry.log');
+
+app.post('/telemetry', (req, res) => {
+  const entry = { time: new Date().toISOString(), ip: req.ip, ...req.body };
+  console.log('Telemetry:', JSON.stringify(entry));
+  fs.appendFile(TELEMETRY_PATH, JSON.stringify(entry) + '\n', (err) => {
+    if (err) console.error('Error writing telemetry:', err);
+  });
+  res.status(204).end();
+});
+
 // Preview endpoint
 app.get('/preview', async (req, res) => {
   const url = req.query.url;
@@ -450,10 +480,9 @@ app.get('/preview', async (req, res) => {
   }
 });
 
-app.post('/render', async (req, res) => {
-  const html = req.body;
-  let url = req.query.url;
-  const mode = req.query.mode;
+// Renders one frame (HTML body, URL, mode or saved config) and returns the
+// path of the output file. The caller is responsible for deleting it.
+async function renderToFile(html, url, mode, query) {
   
   // Load config
   const config = loadConfig();
@@ -473,16 +502,16 @@ app.post('/render', async (req, res) => {
   }
 
   // Defaults or overrides
-  const width = parseInt(req.query.width) || (useConfig ? config.viewport?.width : 800) || 800;
-  const height = parseInt(req.query.height) || (useConfig ? config.viewport?.height : 480) || 480;
-  const layoutWidth = parseInt(req.query.layoutWidth) || (useConfig ? config.viewport?.layoutWidth : width) || width;
-  const dismissCookies = (req.query.dismissCookies === 'true') || (useConfig ? !!config.dismissCookies : false);
-  const timestampWatermark = (req.query.timestampWatermark === 'true') || (useConfig ? !!config.timestampWatermark : false);
+  const width = parseInt(query.width) || (useConfig ? config.viewport?.width : 800) || 800;
+  const height = parseInt(query.height) || (useConfig ? config.viewport?.height : 480) || 480;
+  const layoutWidth = parseInt(query.layoutWidth) || (useConfig ? config.viewport?.layoutWidth : width) || width;
+  const dismissCookies = (query.dismissCookies === 'true') || (useConfig ? !!config.dismissCookies : false);
+  const timestampWatermark = (query.timestampWatermark === 'true') || (useConfig ? !!config.timestampWatermark : false);
   const removeClasses = useConfig ? (config.removeClasses || []) : [];
   const mobileMode = useConfig ? !!config.mobileMode : false;
 
   // Determine format from query or config
-  const formatRaw = req.query.format || (useConfig ? config.format : null) || 'bmp';
+  const formatRaw = query.format || (useConfig ? config.format : null) || 'bmp';
   const format = formatRaw.toLowerCase();
 
   const baseName = `render_${Date.now()}`;
@@ -530,7 +559,7 @@ app.post('/render', async (req, res) => {
         console.log(`Successfully loaded index.html`);
       } catch (readError) {
         await browser.close();
-        return res.status(500).send(`Ошибка чтения index.html: ${readError.message}`);
+        throw httpError(500, `Ошибка чтения index.html: ${readError.message}`);
       }
       await page.setContent(contentHtml, { waitUntil: 'networkidle0', timeout: 60000 });
     } else if (effectiveMode === 'demo') {
@@ -583,7 +612,7 @@ app.post('/render', async (req, res) => {
       await page.setContent(html, { waitUntil: 'networkidle0', timeout: 60000 });
     } else {
       await browser.close();
-      return res.status(400).send('Ошибка: передайте HTML в теле запроса, параметр ?url= или заголовок mode=weather (или настройте config.json)');
+      throw httpError(400, 'Ошибка: передайте HTML в теле запроса, параметр ?url= или заголовок mode=weather (или настройте config.json)');
     }
 
     if (effectiveMode === 'weather') {
@@ -621,12 +650,12 @@ app.post('/render', async (req, res) => {
     const resizedPath = path.join(__dirname, `${baseName}_resized.png`);
     
     // Get resize algorithm from config or query
-    const resizeAlgorithm = req.query.resizeAlgorithm || (useConfig ? config.resizeAlgorithm : 'lanczos3') || 'lanczos3';
+    const resizeAlgorithm = query.resizeAlgorithm || (useConfig ? config.resizeAlgorithm : 'lanczos3') || 'lanczos3';
     const validKernels = ['nearest', 'cubic', 'mitchell', 'lanczos2', 'lanczos3'];
     const kernel = validKernels.includes(resizeAlgorithm) ? resizeAlgorithm : 'lanczos3';
     
     // Get sharpen amount (0 = off, 1-3 recommended for e-ink)
-    const sharpen = parseFloat(req.query.sharpen) || (useConfig ? config.sharpen : 0) || 0;
+    const sharpen = parseFloat(query.sharpen) || (useConfig ? config.sharpen : 0) || 0;
     
     console.log(`Resizing cropped image to ${OUTPUT_WIDTH}x${OUTPUT_HEIGHT} using ${kernel} algorithm, sharpen: ${sharpen}`);
     
@@ -647,7 +676,7 @@ app.post('/render', async (req, res) => {
     }
     
     if (format === 'bmp') {
-      const dither = (req.query.dither === 'true') || (useConfig ? !!config.dither : false);
+      const dither = (query.dither === 'true') || (useConfig ? !!config.dither : false);
       
       if (dither) {
         // Apply Floyd-Steinberg dithering to black/white
@@ -704,7 +733,7 @@ app.post('/render', async (req, res) => {
       // Packing: 1 bit per pixel, 8 pixels per byte, MSB first.
       // Logic: 0 = Active (Black or Red), 1 = Inactive (White or No Red)
       
-      const dither = (req.query.dither === 'true') || (useConfig ? !!config.dither : false);
+      const dither = (query.dither === 'true') || (useConfig ? !!config.dither : false);
       console.log(`BWR conversion with dithering: ${dither}`);
       
       const { data, info } = await sharp(resizedPath)
@@ -712,98 +741,13 @@ app.post('/render', async (req, res) => {
         .raw()
         .toBuffer({ resolveWithObject: true });
 
-      const w = info.width;
-      const h = info.height;
-      const stride = Math.ceil(w / 8);
-      const planeSize = stride * h;
-      
-      // Initialize buffers with 0xFF (All 1s -> White / No Red)
-      const bwBuffer = Buffer.alloc(planeSize, 0xFF);
-      const redBuffer = Buffer.alloc(planeSize, 0xFF);
-      
-      // For dithering, we need float buffers to accumulate error
-      const pixels = new Float32Array(w * h * 3); // RGB only
-      for (let i = 0; i < w * h; i++) {
-        pixels[i * 3] = data[i * 4];
-        pixels[i * 3 + 1] = data[i * 4 + 1];
-        pixels[i * 3 + 2] = data[i * 4 + 2];
-      }
-      
-      // Floyd-Steinberg dithering distribution
-      const distributeError = (x, y, errR, errG, errB) => {
-        const offsets = [
-          [1, 0, 7/16],
-          [-1, 1, 3/16],
-          [0, 1, 5/16],
-          [1, 1, 1/16]
-        ];
-        for (const [dx, dy, factor] of offsets) {
-          const nx = x + dx;
-          const ny = y + dy;
-          if (nx >= 0 && nx < w && ny < h) {
-            const nidx = (ny * w + nx) * 3;
-            pixels[nidx] += errR * factor;
-            pixels[nidx + 1] += errG * factor;
-            pixels[nidx + 2] += errB * factor;
-          }
-        }
-      };
-
-      for (let y = 0; y < h; y++) {
-        for (let x = 0; x < w; x++) {
-          const pidx = (y * w + x) * 3;
-          const r = Math.max(0, Math.min(255, pixels[pidx]));
-          const g = Math.max(0, Math.min(255, pixels[pidx + 1]));
-          const b = Math.max(0, Math.min(255, pixels[pidx + 2]));
-          
-          // Calculate squared euclidean distance to palette colors
-          const distBlack = r*r + g*g + b*b;
-          const distWhite = (r-255)**2 + (g-255)**2 + (b-255)**2;
-          const distRed   = (r-255)**2 + g*g + b*b;
-
-          let chosenR, chosenG, chosenB;
-          let isBlack = false;
-          let isRed = false;
-
-          // Determine closest color
-          if (distRed < distBlack && distRed < distWhite) {
-            isRed = true;
-            chosenR = 255; chosenG = 0; chosenB = 0;
-          } else if (distBlack <= distWhite) {
-            isBlack = true;
-            chosenR = 0; chosenG = 0; chosenB = 0;
-          } else {
-            chosenR = 255; chosenG = 255; chosenB = 255;
-          }
-          
-          // Apply Floyd-Steinberg dithering if enabled
-          if (dither) {
-            const errR = r - chosenR;
-            const errG = g - chosenG;
-            const errB = b - chosenB;
-            distributeError(x, y, errR, errG, errB);
-          }
-
-          const byteIdx = y * stride + Math.floor(x / 8);
-          const bitMask = 0x80 >> (x % 8);
-
-          if (isBlack) {
-            // Black: BW=0, Red=1
-            bwBuffer[byteIdx] &= ~bitMask;
-          } else if (isRed) {
-            // Red: BW=1, Red=0
-            redBuffer[byteIdx] &= ~bitMask;
-          }
-        }
-      }
-      
-      fs.writeFileSync(outPath, Buffer.concat([bwBuffer, redBuffer]));
+      fs.writeFileSync(outPath, rgbaToBwr(data, info.width, info.height, dither));
       fs.unlinkSync(resizedPath);
 
     } else if (format === 'png') {
       // Process PNG with sharp
-      const colors = parseInt(req.query.colors) || (useConfig ? config.colors : null);
-      const dither = (req.query.dither === 'true') || (useConfig ? !!config.dither : false);
+      const colors = parseInt(query.colors) || (useConfig ? config.colors : null);
+      const dither = (query.dither === 'true') || (useConfig ? !!config.dither : false);
       
       const options = { 
         compressionLevel: 6,
@@ -827,15 +771,249 @@ app.post('/render', async (req, res) => {
       fs.renameSync(resizedPath, outPath);
     }
 
-    res.sendFile(outPath, () => {
-      fs.unlink(outPath, () => {});
-    });
+    return outPath;
   } catch (err) {
     console.error('Ошибка рендера:', err.message);
-    res.status(500).send(`Ошибка рендера: ${err.message}`);
+    throw err;
   }
+}
+
+function httpError(status, message) {
+  const err = new Error(message);
+  err.status = status;
+  return err;
+}
+
+function sendRenderError(res, err) {
+  if (err.status) return res.status(err.status).send(err.message);
+  res.status(500).send(`Ошибка рендера: ${err.message}`);
+}
+
+// Gzip when the client asks for it: BWR planes and 24-bit BMPs shrink by an
+// order of magnitude and the device inflates while writing to flash.
+// PNG is already deflated, so it is always sent as is.
+function acceptsGzip(req) {
+  return /\bgzip\b/.test(req.headers['accept-encoding'] || '');
+}
+
+function sendGzipped(res, data) {
+  res.set('Content-Encoding', 'gzip');
+  res.vary('Accept-Encoding');
+  res.send(zlib.gzipSync(data, { level: 9 }));
+}
+
+// Frame cache: every frame sent by /render and /playlist is also kept under
+// its content hash, so a device whose download stalled can fetch only the
+// missing bytes from GET /frame/:id with a Range header.
+const FRAME_CACHE_DIR = path.join(DATA_DIR, 'frames');
+const FRAME_CACHE_MAX = 32;
+
+function cacheFrame(res, data) {
+  const id = crypto.createHash('sha1').update(data).digest('hex').slice(0, 16);
+  const framePath = path.join(FRAME_CACHE_DIR, id);
+  try {
+    fs.mkdirSync(FRAME_CACHE_DIR, { recursive: true });
+    if (fs.existsSync(framePath)) {
+      const now = new Date();
+      fs.utimesSync(framePath, now, now);
+    } else {
+      fs.writeFileSync(framePath, data);
+      pruneFrameCache();
+    }
+  } catch (err) {
+    // Resume is an optimisation, the frame is still sent
+    console.error('Frame cache write failed:', err.message);
+    return;
+  }
+  // Uncompressed length: a gzip body's size says nothing about the file size
+  res.set('X-Frame-Id', id);
+  res.set('X-Frame-Length', String(data.length));
+}
+
+function pruneFrameCache() {
+  const files = fs.readdirSync(FRAME_CACHE_DIR)
+    .map(name => ({ name, mtime: fs.statSync(path.join(FRAME_CACHE_DIR, name)).mtimeMs }))
+    .sort((a, b) => b.mtime - a.mtime);
+  for (const file of files.slice(FRAME_CACHE_MAX)) {
+    fs.unlink(path.join(FRAME_CACHE_DIR, file.name), () => {});
+  }
+}
+
+app.post('/render', async (req, res) => {
+  try {
+    const outPath = await renderToFile(req.body, req.query.url, req.query.mode, req.query);
+    const data = fs.readFileSync(outPath);
+    fs.unlink(outPath, () => {});
+    cacheFrame(res, data);
+    res.type(path.extname(outPath));
+    if (acceptsGzip(req) && path.extname(outPath) !== '.png') {
+      return sendGzipped(res, data);
+    }
+    res.send(data);
+  } catch (err) {
+    sendRenderError(res, err);
+  }
+});
+
+// Cached frame by id, always uncompressed; sendFile answers Range requests
+// with 206 Partial Content. 404 once the frame has been pruned.
+app.get('/frame/:id', (req, res) => {
+  const id = req.params.id;
+  if (!/^[0-9a-f]{16}$/.test(id)) return res.status(400).send('Invalid frame id');
+  const framePath = path.join(FRAME_CACHE_DIR, id);
+  if (!fs.existsSync(framePath)) return res.status(404).send('Frame not cached');
+  res.set('X-Frame-Id', id);
+  res.sendFile(framePath, { headers: { 'Content-Type': 'application/octet-stream' } });
+});
+
+// Playlist bundle: every entry of config.playlist rendered into one response,
+// so the device can rotate through the frames offline between fetches.
+// Layout (little-endian):
+//   "EPL1", uint16 frameCount, uint16 reserved, uint32 refreshInterval (s),
+//   frameCount x { uint32 length, uint32 duration (s) }, frame images back to back.
+// Entries take the same parameters as /render plus `duration`, e.g.
+//   { "mode": "weather", "duration": 1800 }, { "url": "https://...", "format": "bwr", "dither": true }
+// Without a playlist the saved config is sent as a single frame.
+const PLAYLIST_MAX_FRAMES = 8; // Must match FRAME_STORE_MAX_FRAMES in the firmware
+const PLAYLIST_DEFAULT_DURATION = 3600;
+
+app.post('/playlist', async (req, res) => {
+  const config = loadConfig();
+  const entries = (Array.isArray(config.playlist) && config.playlist.length > 0)
+    ? config.playlist.slice(0, PLAYLIST_MAX_FRAMES)
+    : [{}];
+  const refreshInterval = parseInt(req.query.refresh) || parseInt(config.playlistRefresh) || 0;
+
+  const frames = [];
+  for (const entry of entries) {
+    // Entry values become query strings, exactly as if passed to /render
+    const query = {};
+    for (const [key, value] of Object.entries(entry)) {
+      if (key !== 'duration') query[key] = String(value);
+    }
+    if (!query.format) query.format = 'bwr';
+    try {
+      const outPath = await renderToFile(null, query.url, query.mode, query);
+      const data = fs.readFileSync(outPath);
+      fs.unlink(outPath, () => {});
+      frames.push({ data, duration: parseInt(entry.duration) || PLAYLIST_DEFAULT_DURATION });
+    } catch (err) {
+      // Skip the broken frame, the rest of the playlist is still useful
+      console.error(`Playlist frame ${frames.length + 1} skipped:`, err.message);
+    }
+  }
+
+  if (frames.length === 0) {
+    return res.status(500).send('Ошибка рендера: no playlist frame could be rendered');
+  }
+
+  const header = Buffer.alloc(12 + frames.length * 8);
+  header.write('EPL1', 0, 'ascii');
+  header.writeUInt16LE(frames.length, 4);
+  header.writeUInt16LE(0, 6);
+  header.writeUInt32LE(refreshInterval, 8);
+  frames.forEach((frame, i) => {
+    header.writeUInt32LE(frame.data.length, 12 + i * 8);
+    header.writeUInt32LE(frame.duration, 16 + i * 8);
+  });
+
+  console.log(`Playlist bundle: ${frames.length} frames, refresh ${refreshInterval || 'default'}`);
+  const bundle = Buffer.concat([header, ...frames.map(frame => frame.data)]);
+  res.type('application/octet-stream');
+  cacheFrame(res, bundle);
+  if (acceptsGzip(req)) return sendGzipped(res, bundle);
+  res.send(bundle);
 });
 
+// Dashboard data for the firmware's own renderer (src/dashboard.h): current
+// weather, one forecast per following day and the configured events as a
+// few hundred bytes of JSON instead of a 96 KB frame, no browser involved.
+//   "dashboard": { "city": "Minsk", "lang": "ru", "events": [{ "time": "14:00", "title": "Встреча" }] }
+// The OpenWeatherMap key comes from OWM_API_KEY or dashboard.apiKey.
+// Payload: { v, lang, city, temp, desc, icon, fc: [{ day, temp, icon }], ev: [{ time, title }] }
+// ?format=bin sends the same as a binary record (dashboard_record.js).
+const DASHBOARD_VERSION = 1; // Must match DASHBOARD_PAYLOAD_VERSION in the firmware
+const DASHBOARD_FORECAST_DAYS = 5;
+const DASHBOARD_MAX_EVENTS = 4;
+const DASHBOARD_CACHE_MS = 10 * 60 * 1000; // Weather API calls at most every 10 minutes
+let dashboardCache = null; // { key, time, json, record }
+
+async function fetchWeatherJson(url) {
+  const response = await fetch(url);
+  if (!response.ok) throw httpError(502, `Weather API: HTTP ${response.status}`);
+  return response.json();
+}
+
+async function buildDashboard(settings) {
+  const apiKey = process.env.OWM_API_KEY || settings.apiKey;
+  if (!apiKey) throw httpError(500, 'Dashboard: set OWM_API_KEY or dashboard.apiKey in config.json');
+  const city = settings.city || 'Minsk';
+  const lang = settings.lang || 'ru';
+  const query = `q=${encodeURIComponent(city)}&appid=${apiKey}&units=metric&lang=${lang}`;
+  const [weather, forecast] = await Promise.all([
+    fetchWeatherJson(`http://api.openweathermap.org/data/2.5/weather?${query}`),
+    fetchWeatherJson(`http://api.openweathermap.org/data/2.5/forecast?${query}`)
+  ]);
+
+  // Per following day the 3-hour entry closest to local noon
+  const offset = (forecast.city && forecast.city.timezone) || 0;
+  const today = new Date(Date.now() + offset * 1000).getUTCDate();
+  const days = new Map();
+  for (const entry of forecast.list || []) {
+    const local = new Date((entry.dt + offset) * 1000);
+    const day = local.getUTCDate();
+    if (day === today) continue;
+    const distance = Math.abs(local.getUTCHours() - 12);
+    const best = days.get(day);
+    if (!best || distance < best.distance) days.set(day, { distance, entry });
+  }
+
+  return {
+    v: DASHBOARD_VERSION,
+    lang,
+    city: settings.title || weather.name || city,
+    temp: Math.round(weather.main.temp),
+    desc: weather.weather[0].description,
+    icon: weather.weather[0].icon,
+    fc: [...days.entries()].slice(0, DASHBOARD_FORECAST_DAYS).map(([day, { entry }]) => ({
+      day,
+      temp: Math.round(entry.main.temp),
+      icon: entry.weather[0].icon
+    })),
+    ev: (settings.events || []).slice(0, DASHBOARD_MAX_EVENTS).map(event => ({
+      time: String(event.time || '').slice(0, 5),
+      title: String(event.title || '')
+    }))
+  };
+}
+
+async function sendDashboard(req, res) {
+  try {
+    const settings = loadConfig().dashboard || {};
+    const key = JSON.stringify(settings);
+    if (!dashboardCache || dashboardCache.key !== key || Date.now() - dashboardCache.time > DASHBOARD_CACHE_MS) {
+      const dashboard = await buildDashboard(settings);
+      const json = Buffer.from(JSON.stringify(dashboard));
+      const record = encodeDashboardRecord(dashboard);
+      dashboardCache = { key, time: Date.now(), json, record };
+      console.log(`Dashboard payload: ${json.length} bytes JSON, ${record.length} bytes binary`);
+    }
+    if (req.query.format === 'bin') {
+      res.type('application/octet-stream');
+      res.send(dashboardCache.record);
+    } else {
+      res.type('application/json');
+      res.send(dashboardCache.json);
+    }
+  } catch (err) {
+    sendRenderError(res, err);
+  }
+}
+
+// The firmware's downloader always POSTs; GET is for browsers and curl
+app.get('/dashboard', sendDashboard);
+app.post('/dashboard', sendDashboard);
+
 const PORT = 3123;
 app.listen(PORT, () => {
   console.log(`HTML2Image API запущен: http://<ваш-IP>:${PORT}/render`);
@@ -0,0 +1,150 @@
+// Golden frames for the firmware decoder benchmark (sim/bench).
+//
+// Produces one 800x480 picture in every input format the device decodes,
+// plus the BWR planes the server's `bwr` branch makes of it:
+//   bmp24_bottomup.bmp, bmp24_topdown.bmp, bmp32_bottomup.bmp,
+//   png24.png (truecolor), png8.png (8-bit indexed), frame.bwr
+//                                                   -> decoder inputs
+//   golden.bwr                                      -> expected planes
+//
+// The picture only uses pure black, white and red, so every decoder must
+// reproduce golden.bwr bit for bit whatever its colour thresholds are.
+//
+// Usage: node tools/golden.js <outDir> [source image]
+// Without a source a synthetic dashboard is drawn; a source (e.g. a /render
+// PNG) is resized and reduced to the three colours first.
+const fs = require('fs');
+const path = require('path');
+const sharp = require('sharp');
+const { rgbaToBwr } = require('../bwr');
+
+const WIDTH = 800;
+const HEIGHT = 480;
+
+const WHITE = [255, 255, 255];
+const BLACK = [0, 0, 0];
+const RED = [255, 0, 0];
+
+function syntheticRgb() {
+  const rgb = Buffer.alloc(WIDTH * HEIGHT * 3, 255);
+  const set = (x, y, c) => {
+    if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT) return;
+    const i = (y * WIDTH + x) * 3;
+    rgb[i] = c[0]; rgb[i + 1] = c[1]; rgb[i + 2] = c[2];
+  };
+  const rect = (x0, y0, w, h, c) => {
+    for (let y = y0; y < y0 + h; y++) for (let x = x0; x < x0 + w; x++) set(x, y, c);
+  };
+  let seed = 12345;
+  const rand = () => (seed = (seed * 1103515245 + 12345) & 0x7fffffff) / 0x7fffffff;
+
+  // Header bar with a red accent
+  rect(0, 0, WIDTH, 48, BLACK);
+  rect(12, 12, 140, 24, RED);
+  // Text-like lines: glyph-sized noise blocks with word gaps
+  for (let line = 0; line < 12; line++) {
+    const top = 64 + line * 24;
+    const color = line % 5 === 0 ? RED : BLACK;
+    for (let x = 16; x < 520; x += 9) {
+      if (rand() < 0.15) continue;
+      for (let y = top; y < top + 14; y++)
+        for (let dx = 0; dx < 7; dx++)
+          if (rand() < 0.45) set(x + dx, y, color);
+    }
+  }
+  // Bar chart with odd widths, so edges fall inside bytes
+  for (let i = 0; i < 12; i++) {
+    const h = 20 + Math.floor(rand() * 140);
+    rect(545 + i * 21, 220 - h, 13, h, i % 3 === 0 ? RED : BLACK);
+  }
+  rect(540, 221, 255, 1, BLACK);
+  // Diagonals and a checkerboard: worst case for run-based shortcuts
+  for (let t = 0; t < 240; t++) { set(540 + t, 240 + t, BLACK); set(795 - t, 240 + t, RED); }
+  for (let y = 380; y < 470; y++) for (let x = 16; x < 520; x++) if ((x + y) & 1) set(x, y, BLACK);
+  // Frame on the outermost pixels
+  rect(0, HEIGHT - 1, WIDTH, 1, RED);
+  rect(0, 0, 1, HEIGHT, BLACK);
+  rect(WIDTH - 1, 0, 1, HEIGHT, BLACK);
+  return rgb;
+}
+
+// Reduce any image to the three panel colours with the server's own mapping
+async function sourceRgb(file) {
+  const { data } = await sharp(file)
+    .resize(WIDTH, HEIGHT, { fit: 'fill' })
+    .ensureAlpha()
+    .raw()
+    .toBuffer({ resolveWithObject: true });
+  const planes = rgbaToBwr(data, WIDTH, HEIGHT, false);
+  const plane = planes.length / 2;
+  const rgb = Buffer.alloc(WIDTH * HEIGHT * 3);
+  for (let y = 0; y < HEIGHT; y++) {
+    for (let x = 0; x < WIDTH; x++) {
+      const byte = y * (WIDTH / 8) + (x >> 3);
+      const bit = 0x80 >> (x & 7);
+      const c = !(planes[byte] & bit) ? BLACK : !(planes[plane + byte] & bit) ? RED : WHITE;
+      rgb.set(c, (y * WIDTH + x) * 3);
+    }
+  }
+  return rgb;
+}
+
+function bmp(rgb, bytesPerPixel, topDown) {
+  const rowSize = (WIDTH * bytesPerPixel + 3) & ~3;
+  const out = Buffer.alloc(54 + rowSize * HEIGHT);
+  out.write('BM', 0, 'ascii');
+  out.writeUInt32LE(out.length, 2);
+  out.writeUInt32LE(54, 10);
+  out.writeUInt32LE(40, 14);
+  out.writeInt32LE(WIDTH, 18);
+  out.writeInt32LE(topDown ? -HEIGHT : HEIGHT, 22);
+  out.writeUInt16LE(1, 26);
+  out.writeUInt16LE(bytesPerPixel * 8, 28);
+  out.writeUInt32LE(rowSize * HEIGHT, 34);
+  for (let y = 0; y < HEIGHT; y++) {
+    const row = 54 + (topDown ? y : HEIGHT - 1 - y) * rowSize;
+    for (let x = 0; x < WIDTH; x++) {
+      const i = (y * WIDTH + x) * 3;
+      const o = row + x * bytesPerPixel;
+      out[o] = rgb[i + 2];
+      out[o + 1] = rgb[i + 1];
+      out[o + 2] = rgb[i];
+      if (bytesPerPixel === 4) out[o + 3] = 255;
+    }
+  }
+  return out;
+}
+
+async function main() {
+  const [outDir, source] = process.argv.slice(2);
+  if (!outDir) {
+    console.error('Usage: node tools/golden.js <outDir> [source image]');
+    process.exit(1);
+  }
+  fs.mkdirSync(outDir, { recursive: true });
+  const rgb = source ? await sourceRgb(source) : syntheticRgb();
+
+  const rgba = Buffer.alloc(WIDTH * HEIGHT * 4, 255);
+  for (let i = 0; i < WIDTH * HEIGHT; i++) rgb.copy(rgba, i * 4, i * 3, i * 3 + 3);
+  const golden = rgbaToBwr(rgba, WIDTH, HEIGHT, false);
+  const raw = { raw: { width: WIDTH, height: HEIGHT, channels: 3 } };
+
+  const files = {
+    'bmp24_bottomup.bmp': bmp(rgb, 3, false),
+    'bmp24_topdown.bmp': bmp(rgb, 3, true),
+    'bmp32_bottomup.bmp': bmp(rgb, 4, false),
+    'png24.png': await sharp(rgb, raw).png({ palette: false }).toBuffer(),
+    'png8.png': await sharp(rgb, raw).png({ palette: true, colors: 4, bitdepth: 8, dither: 0 }).toBuffer(),
+    'frame.bwr': golden,
+    'golden.bwr': golden,
+  };
+  for (const [name, data] of Object.entries(files)) {
+    fs.writeFileSync(path.join(outDir, name), data);
+    console.log(`${name}: ${data.length} bytes`);
+  }
+}
+
+main().catch(err => {
+  console.error(err);
+  process.exit(1);
+});
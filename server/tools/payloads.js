@@ -0,0 +1,131 @@
+// Weather payloads for the firmware's payload parser benchmark
+// (sim/bench/payload_bench.cpp):
+//   owm_weather.json, owm_forecast.json  -> OpenWeatherMap responses as the
+//                                           old sketch downloaded them
+//   dashboard.json, dashboard.bin        -> the same dashboard as /dashboard
+//                                           sends it, JSON and ?format=bin
+//
+// The OpenWeatherMap responses are synthetic but have the fields, nesting
+// and size (40 three-hour entries, ~16 KB) of the real /weather and
+// /forecast answers. --weather and --forecast copy captured responses
+// instead, which is what the owm_* timings should be quoted from.
+//
+// Usage: node tools/payloads.js <outDir> [--weather FILE] [--forecast FILE]
+const fs = require('fs');
+const path = require('path');
+const { encodeDashboardRecord } = require('../dashboard_record');
+
+const START = Date.UTC(2026, 9, 19, 9, 0, 0) / 1000; // Fixed, so the files never change
+const TIMEZONE = 3 * 3600;
+const ICONS = ['01d', '02d', '03d', '04d', '09d', '10d', '11d', '13d', '50d', '04n', '10n', '13n'];
+const DESCRIPTIONS = ['ясно', 'небольшая облачность', 'облачно с прояснениями', 'пасмурно', 'небольшой дождь',
+  'снег', 'гроза', 'туман', 'пасмурно, местами небольшой снег с дождём'];
+
+let seed = 4242;
+const rand = () => (seed = (seed * 1103515245 + 12345) & 0x7fffffff) / 0x7fffffff;
+const pick = list => list[Math.floor(rand() * list.length)];
+const round2 = value => Math.round(value * 100) / 100;
+
+function weatherEntry(temp) {
+  const icon = pick(ICONS);
+  return {
+    main: {
+      temp: round2(temp), feels_like: round2(temp - 3 - rand() * 2), temp_min: round2(temp - 1), temp_max: round2(temp + 1),
+      pressure: 1000 + Math.floor(rand() * 30), sea_level: 1012, grnd_level: 990, humidity: 60 + Math.floor(rand() * 40),
+      temp_kf: 0
+    },
+    weather: [{ id: 600 + Math.floor(rand() * 200), main: 'Clouds', description: pick(DESCRIPTIONS), icon }],
+    clouds: { all: Math.floor(rand() * 100) },
+    wind: { speed: round2(rand() * 8), deg: Math.floor(rand() * 360), gust: round2(rand() * 12) },
+    visibility: 10000
+  };
+}
+
+function owmWeather() {
+  return {
+    coord: { lon: 27.5667, lat: 53.9 },
+    ...weatherEntry(-3.4),
+    base: 'stations',
+    dt: START,
+    sys: { type: 2, id: 2094823, country: 'BY', sunrise: START - 2 * 3600, sunset: START + 8 * 3600 },
+    timezone: TIMEZONE,
+    id: 625144,
+    name: 'Минск',
+    cod: 200
+  };
+}
+
+function owmForecast() {
+  const list = [];
+  for (let i = 0; i < 40; i++) {
+    const dt = START + i * 3 * 3600;
+    list.push({
+      dt,
+      ...weatherEntry(-6 + 8 * Math.sin(i / 4) + rand() * 2),
+      pop: round2(rand()),
+      sys: { pod: (dt / 3600 + 3) % 24 < 18 ? 'd' : 'n' },
+      dt_txt: new Date(dt * 1000).toISOString().replace('T', ' ').slice(0, 19)
+    });
+  }
+  return {
+    cod: '200', message: 0, cnt: list.length, list,
+    city: { id: 625144, name: 'Минск', coord: { lat: 53.9, lon: 27.5667 }, country: 'BY', population: 1742124,
+      timezone: TIMEZONE, sunrise: START - 2 * 3600, sunset: START + 8 * 3600 }
+  };
+}
+
+function dashboard() {
+  return {
+    v: 1,
+    lang: 'ru',
+    city: 'Минск',
+    temp: -3,
+    desc: 'пасмурно, местами небольшой снег с дождём',
+    icon: '13d',
+    fc: [20, 21, 22, 23, 24].map((day, i) => ({ day, temp: [-1, 2, 5, -7, 0][i], icon: ['13d', '09d', '01d', '02d', '50d'][i] })),
+    ev: [
+      { time: '14:00', title: 'Встреча с командой по планированию следующего квартала' },
+      { time: '19:00', title: 'Кино' },
+      { time: '22:00', title: 'Друзья' }
+    ]
+  };
+}
+
+// A captured response, checked to be JSON so a saved error page is caught here
+function captured(file) {
+  const data = fs.readFileSync(file);
+  JSON.parse(data.toString('utf8'));
+  return data;
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  let outDir;
+  let weatherFile;
+  let forecastFile;
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '--weather' && i + 1 < args.length)
+      weatherFile = args[++i];
+    else if (args[i] === '--forecast' && i + 1 < args.length)
+      forecastFile = args[++i];
+    else if (!outDir)
+      outDir = args[i];
+  }
+  if (!outDir) {
+    console.error('Usage: node tools/payloads.js <outDir> [--weather FILE] [--forecast FILE]');
+    process.exit(1);
+  }
+  fs.mkdirSync(outDir, { recursive: true });
+  const files = {
+    'owm_weather.json': weatherFile ? captured(weatherFile) : Buffer.from(JSON.stringify(owmWeather())),
+    'owm_forecast.json': forecastFile ? captured(forecastFile) : Buffer.from(JSON.stringify(owmForecast())),
+    'dashboard.json': Buffer.from(JSON.stringify(dashboard())),
+    'dashboard.bin': encodeDashboardRecord(dashboard()),
+  };
+  for (const [name, data] of Object.entries(files)) {
+    fs.writeFileSync(path.join(outDir, name), data);
+    console.log(`${name}: ${data.length} bytes`);
+  }
+}
+
+main();
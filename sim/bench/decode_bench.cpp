@@ -0,0 +1,206 @@
+// Decoder benchmark: runs every image format the firmware decodes through
+// the real displayImage() row path and checks the result against golden
+// planes made by the server's `bwr` conversion.
+//
+//   cd server && node tools/golden.js ../sim/bench/frames
+//   pio run -e native_bench
+//   .pio/build/native_bench/program [--frames DIR] [--iterations N]
+//       [--baseline FILE] [--save-baseline FILE] [--threshold PCT]
+//
+// Per decoder it reports the best of N runs (default 20) as µs per row and
+// rows/s, plus the peak heap while decoding. The process exits with 1 when a
+// decoder fails, its output differs from golden.bwr or its rows/s fell more
+// than --threshold percent (default 10) below the --baseline file written by
+// --save-baseline.
+// Host timings are only comparable on the same machine; the ratios between
+// decoders and the before/after of a change are what carry over to the S3.
+#include <Arduino.h>
+#include <GxEPD2_3C.h>
+#include <SPIFFS.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "sim.h"
+
+// From GxEPD2_Example.cpp
+extern GxEPD2_3C<GxEPD2_750c_Z08, GxEPD2_750c_Z08::HEIGHT / 4> display;
+bool displayImage(const char* filename, int16_t x, int16_t y);
+
+namespace {
+
+struct Input {
+    const char* name;
+    const char* file;
+};
+
+const Input kInputs[] = {
+    { "bmp24_bottomup", "/bmp24_bottomup.bmp" },
+    { "bmp24_topdown", "/bmp24_topdown.bmp" },
+    { "bmp32_bottomup", "/bmp32_bottomup.bmp" },
+    { "png24", "/png24.png" },
+    { "png8", "/png8.png" },
+    { "bwr", "/frame.bwr" },
+};
+
+struct Result {
+    std::string name;
+    double usPerRow = 0;
+    double rowsPerSec = 0;
+    size_t peakHeap = 0;
+    uint32_t mismatches = 0;
+    uint32_t rows = 0;
+    bool decoded = true;
+};
+
+std::map<std::string, double> loadBaseline(const char* path)
+{
+    std::map<std::string, double> baseline;
+    FILE* f = fopen(path, "r");
+    if (!f)
+        return baseline;
+    char name[64];
+    double rowsPerSec;
+    while (fscanf(f, "%63s %lf", name, &rowsPerSec) == 2)
+        baseline[name] = rowsPerSec;
+    fclose(f);
+    return baseline;
+}
+
+bool loadGolden(std::vector<uint8_t>& golden)
+{
+    File file = SPIFFS.open("/golden.bwr", FILE_READ);
+    if (!file)
+        return false;
+    golden.resize(file.size());
+    bool ok = file.read(golden.data(), golden.size()) == golden.size();
+    file.close();
+    return ok && golden.size() == 2 * sim::panelPlaneSize();
+}
+
+// Pixels whose colour differs from the golden planes
+uint32_t countMismatches(const std::vector<uint8_t>& golden)
+{
+    size_t plane = sim::panelPlaneSize();
+    const uint8_t* black = sim::panelBlackPlane();
+    const uint8_t* red = sim::panelRedPlane();
+    uint32_t count = 0;
+    for (size_t i = 0; i < plane; i++)
+        count += __builtin_popcount((black[i] ^ golden[i]) | (red[i] ^ golden[plane + i]));
+    return count;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* framesDir = "sim/bench/frames";
+    const char* baselinePath = nullptr;
+    const char* savePath = nullptr;
+    int iterations = 20;
+    double threshold = 10.0;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            fprintf(stderr, "missing value for %s\n", arg.c_str());
+            return 2;
+        }
+        if (arg == "--frames")
+            framesDir = argv[++i];
+        else if (arg == "--iterations")
+            iterations = std::max(1, atoi(argv[++i]));
+        else if (arg == "--baseline")
+            baselinePath = argv[++i];
+        else if (arg == "--save-baseline")
+            savePath = argv[++i];
+        else if (arg == "--threshold")
+            threshold = atof(argv[++i]);
+        else {
+            fprintf(stderr, "unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    setenv("SIM_SPIFFS_DIR", framesDir, 1);
+    std::vector<uint8_t> golden;
+    if (!SPIFFS.begin(false) || !loadGolden(golden)) {
+        fprintf(stderr, "no golden.bwr in %s (make it with server/tools/golden.js)\n", framesDir);
+        return 2;
+    }
+    sim::setSerialMuted(true);
+    display.init(115200, true, 50, false);
+    sim::setSerialMuted(false);
+
+    std::vector<Result> results;
+    for (const Input& input : kInputs) {
+        if (!SPIFFS.exists(input.file)) {
+            printf("%-16s skipped, %s missing\n", input.name, input.file);
+            continue;
+        }
+        Result result;
+        result.name = input.name;
+        double bestUs = 0;
+        for (int run = 0; run < iterations; run++) {
+            sim::panelReset();
+            sim::resetHeapBaseline();
+            sim::setSerialMuted(true);
+            uint32_t start = micros();
+            result.decoded = displayImage(input.file, 0, 0) && result.decoded;
+            uint32_t elapsed = micros() - start;
+            sim::setSerialMuted(false);
+            if (run == 0 || elapsed < bestUs)
+                bestUs = elapsed;
+            result.peakHeap = std::max(result.peakHeap, sim::heapPeakBytes());
+        }
+        // Latch controller RAM to the glass to compare what a refresh would show
+        result.rows = sim::panelStats().writeImageCalls;
+        sim::setSerialMuted(true);
+        display.epd2.refresh(false);
+        sim::setSerialMuted(false);
+        result.mismatches = countMismatches(golden);
+        if (result.rows > 0) {
+            result.usPerRow = bestUs / result.rows;
+            result.rowsPerSec = result.rows * 1e6 / bestUs;
+        }
+        results.push_back(result);
+    }
+
+    std::map<std::string, double> baseline;
+    if (baselinePath)
+        baseline = loadBaseline(baselinePath);
+
+    bool failed = false;
+    printf("%-16s %6s %10s %10s %10s %10s  %s\n", "decoder", "rows", "us/row", "rows/s", "peak heap", "mismatch", "vs baseline");
+    for (const Result& r : results) {
+        char delta[48] = "";
+        bool regressed = false;
+        auto it = baseline.find(r.name);
+        if (it != baseline.end() && it->second > 0) {
+            double change = (r.rowsPerSec / it->second - 1.0) * 100.0;
+            regressed = change < -threshold;
+            snprintf(delta, sizeof(delta), "%+.1f%%%s", change, regressed ? "  REGRESSION" : "");
+        }
+        printf("%-16s %6u %10.2f %10.0f %10zu %10u  %s\n", r.name.c_str(), r.rows, r.usPerRow, r.rowsPerSec, r.peakHeap,
+            r.mismatches, delta);
+        if (r.mismatches > 0 || r.rows == 0 || !r.decoded)
+            failed = true;
+        failed = failed || regressed;
+    }
+
+    if (savePath) {
+        FILE* f = fopen(savePath, "w");
+        if (!f) {
+            fprintf(stderr, "cannot write %s\n", savePath);
+            return 2;
+        }
+        for (const Result& r : results)
+            fprintf(f, "%s %.0f\n", r.name.c_str(), r.rowsPerSec);
+        fclose(f);
+        printf("baseline saved to %s\n", savePath);
+    }
+
+    if (failed)
+        printf("FAILED: golden mismatch or throughput regression\n");
+    return failed ? 1 : 0;
+}
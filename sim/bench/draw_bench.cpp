@@ -0,0 +1,242 @@
+// Drawing benchmark: one weather frame, the shape of draw_weather() in
+// draw_functions.h, drawn band by band as on the device:
+//   float_pixels   wind rose and visibility arcs with float sin/cos and
+//                  drawLine()/fillTriangle(), on a canvas whose lines and
+//                  rectangles go pixel by pixel (the code before geometry.h)
+//   fixed_pixels   the same frame through geometry.h, same canvas
+//   fixed_spans    geometry.h on a BwrCanvas, whose spans set whole bytes
+//
+//   pio run -e native_draw_bench
+//   .pio/build/native_draw_bench/program [--iterations N]
+//
+// draw_functions.h is the old sketch's and does not build on its own, so
+// the frame is put together here from the same pieces: heading, the large
+// icon, wind rose, pressure and visibility, and a strip of forecast boxes
+// with small icons, on the 800x480 panel in four bands. It reports the best
+// of N frames and fails when the two geometry.h cases differ by a pixel.
+#include <Arduino.h>
+
+#include <string>
+#include <vector>
+
+#include "bwr_canvas.h"
+#include "geometry.h"
+#include "weather_draw_functions.h"
+#include "wx_icon.h"
+
+// weather_draw_functions.h refers to the sketch's display
+GxEPD2_3C<GxEPD2_750c_Z08, GxEPD2_750c_Z08::HEIGHT / 4> display(GxEPD2_750c_Z08(-1, -1, -1, -1));
+
+namespace {
+
+const uint16_t kWidth = GxEPD2_750c_Z08::WIDTH;
+const uint16_t kHeight = GxEPD2_750c_Z08::HEIGHT;
+const uint16_t kBands = 4;
+const int kWindRadius = 9; // Cradius of draw_wind()
+
+// BwrCanvas with its byte-wise lines and rectangles turned off
+class PixelCanvas : public BwrCanvas {
+public:
+    using BwrCanvas::BwrCanvas;
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+    {
+        Adafruit_GFX::drawFastHLine(x, y, w, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+    {
+        Adafruit_GFX::drawFastVLine(x, y, h, color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override
+    {
+        Adafruit_GFX::fillRect(x, y, w, h, color);
+    }
+};
+
+// Collects the bands nextPage() writes into whole planes
+struct FrameCapture {
+    std::vector<uint8_t> black = std::vector<uint8_t>(kWidth / 8 * kHeight);
+    std::vector<uint8_t> red = std::vector<uint8_t>(kWidth / 8 * kHeight);
+
+    void writeImage(const uint8_t* blackBand, const uint8_t* redBand, int16_t, int16_t y, int16_t w, int16_t h)
+    {
+        memcpy(&black[y * kWidth / 8], blackBand, (size_t)w / 8 * h);
+        memcpy(&red[y * kWidth / 8], redBand, (size_t)w / 8 * h);
+    }
+};
+
+// draw_wind() and arrow() before geometry.h
+void windRoseFloat(Adafruit_GFX& gfx, int x, int y, float angle)
+{
+    float dx = (kWindRadius - 3 - 10) * cos((angle - 90) * PI / 180) + x;
+    float dy = (kWindRadius - 3 - 10) * sin((angle - 90) * PI / 180) + y;
+    float a = angle * PI / 180 - 135;
+    float x1 = 0, y1 = 12, x2 = 5 / 2, y2 = 5 / 2, x3 = -5 / 2, y3 = 5 / 2;
+    gfx.fillTriangle(x1 * cos(a) - y1 * sin(a) + dx, y1 * cos(a) + x1 * sin(a) + dy, x3 * cos(a) - y3 * sin(a) + dx,
+        y3 * cos(a) + x3 * sin(a) + dy, x2 * cos(a) - y2 * sin(a) + dx, y2 * cos(a) + x2 * sin(a) + dy, FG_COLOR);
+    gfx.drawCircle(x, y, kWindRadius + 2, FG_COLOR);
+    gfx.drawCircle(x, y, kWindRadius + 3, FG_COLOR);
+    for (int m = 0; m < 360; m = m + 45) {
+        dx = kWindRadius * cos(m * PI / 180);
+        dy = kWindRadius * sin(m * PI / 180);
+        gfx.drawLine(x + dx, y + dy, x + dx * 0.8, y + dy * 0.8, FG_COLOR);
+    }
+}
+
+// draw_wind() and arrow() through geometry.h
+void windRoseFixed(Adafruit_GFX& gfx, int x, int y, float angle)
+{
+    int degrees = lroundf(angle);
+    GeomPoint centre = geomPolar(geomPixel(x, y), (kWindRadius - 3 - 10) * GEOM_UNIT, degrees);
+    GeomPoint base = geomPolar(centre, 5 / 2 * GEOM_UNIT, degrees);
+    geomArrow(gfx, base, degrees, (12 - 5 / 2) * GEOM_UNIT, 5 / 2 * 2 * GEOM_UNIT, FG_COLOR);
+    gfx.drawCircle(x, y, kWindRadius + 2, FG_COLOR);
+    gfx.drawCircle(x, y, kWindRadius + 3, FG_COLOR);
+    geomSpokes(gfx, geomPixel(x, y), kWindRadius * GEOM_UNIT * 4 / 5, kWindRadius * GEOM_UNIT, 0, 45, 8, GEOM_UNIT, FG_COLOR);
+}
+
+// Visibility() before and after
+void visibilityFloat(Adafruit_GFX& gfx, int x, int y)
+{
+    int r = 10;
+    for (float i = 0.52; i < 2.61; i = i + 0.05) {
+        gfx.drawPixel(x + r * cos(i), y - r / 2 + r * sin(i), FG_COLOR);
+        gfx.drawPixel(x + r * cos(i), 1 + y - r / 2 + r * sin(i), FG_COLOR);
+    }
+    for (float i = 3.61; i < 5.78; i = i + 0.05) {
+        gfx.drawPixel(x + r * cos(i), y + r / 2 + r * sin(i), FG_COLOR);
+        gfx.drawPixel(x + r * cos(i), 1 + y + r / 2 + r * sin(i), FG_COLOR);
+    }
+    gfx.fillCircle(x, y, r / 4, FG_COLOR);
+}
+
+void visibilityFixed(Adafruit_GFX& gfx, int x, int y)
+{
+    int r = 10;
+    for (int a = 30; a < 150; a = a + 3)
+        gfx.drawFastVLine(x + (r * geomCos(a) >> GEOM_ONE_SHIFT), y - r / 2 + (r * geomSin(a) >> GEOM_ONE_SHIFT), 2, FG_COLOR);
+    for (int a = 207; a < 331; a = a + 3)
+        gfx.drawFastVLine(x + (r * geomCos(a) >> GEOM_ONE_SHIFT), y + r / 2 + (r * geomSin(a) >> GEOM_ONE_SHIFT), 2, FG_COLOR);
+    gfx.fillCircle(x, y, r / 4, FG_COLOR);
+}
+
+const char* const kForecastIcons[] = { "09d", "10d", "10n", "10n", "10d", "50d", "11d", "13d" };
+
+void drawFrame(Adafruit_GFX& gfx, bool fixed)
+{
+    // Heading
+    gfx.setTextColor(FG_COLOR);
+    gfx.setTextSize(2);
+    gfx.setCursor(10, 10);
+    gfx.print("Minsk  Mon 19 Oct 09:00");
+    gfx.drawFastHLine(0, 36, kWidth, FG_COLOR);
+
+    // Main section: icon, temperature, wind, pressure, visibility
+    draw_wx_icon(gfx, 130, 150, wxIconParse("02d"), LargeIcon);
+    gfx.setTextSize(4);
+    gfx.setCursor(280, 110);
+    gfx.print("12C");
+    for (int i = 0; i < 3; i++) {
+        int x = 460 + i * 110, y = 130;
+        float angle = 35 + i * 120;
+        if (fixed)
+            windRoseFixed(gfx, x, y, angle);
+        else
+            windRoseFloat(gfx, x, y, angle);
+    }
+    gfx.setTextSize(1);
+    gfx.setCursor(280, 180);
+    gfx.print("1016 hPa  78%");
+    gfx.drawLine(380, 185, 400, 175, FG_COLOR);
+    if (fixed)
+        visibilityFixed(gfx, 440, 190);
+    else
+        visibilityFloat(gfx, 440, 190);
+
+    // Forecast strip
+    int boxW = kWidth / 8;
+    for (int i = 0; i < 8; i++) {
+        int x = i * boxW, y = 260;
+        gfx.drawRect(x, y, boxW, 200, FG_COLOR);
+        gfx.fillRect(x + 1, y + 1, boxW - 2, 18, GxEPD_RED);
+        gfx.setCursor(x + 8, y + 6);
+        gfx.print(String(i * 3) + ":00");
+        draw_wx_icon(gfx, x + boxW / 2, y + 80, wxIconParse(kForecastIcons[i]), SmallIcon);
+        gfx.setCursor(x + 8, y + 150);
+        gfx.print(String(10 - i) + "/" + String(4 - i));
+        gfx.drawFastHLine(x + 8, y + 170, boxW - 16, FG_COLOR);
+    }
+}
+
+struct Result {
+    const char* name;
+    double bestUs = 0;
+};
+
+Result run(const char* name, BwrCanvas& canvas, bool fixed, int iterations, FrameCapture& frame)
+{
+    Result result;
+    result.name = name;
+    canvas.begin(kHeight / kBands);
+    for (int i = 0; i < iterations; i++) {
+        uint32_t start = micros();
+        canvas.firstPage();
+        do {
+            drawFrame(canvas, fixed);
+        } while (canvas.nextPage(frame));
+        uint32_t elapsed = micros() - start;
+        if (i == 0 || elapsed < result.bestUs)
+            result.bestUs = elapsed;
+    }
+    canvas.end();
+    return result;
+}
+
+size_t differingPixels(const FrameCapture& a, const FrameCapture& b)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < a.black.size(); i++)
+        count += __builtin_popcount((a.black[i] ^ b.black[i]) | (a.red[i] ^ b.red[i]));
+    return count;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    int iterations = 50;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            fprintf(stderr, "missing value for %s\n", arg.c_str());
+            return 2;
+        }
+        if (arg == "--iterations")
+            iterations = std::max(1, atoi(argv[++i]));
+        else {
+            fprintf(stderr, "unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    PixelCanvas pixels(kWidth, kHeight);
+    BwrCanvas spans(kWidth, kHeight);
+    FrameCapture floatFrame, fixedFrame, spansFrame;
+    std::vector<Result> results;
+    results.push_back(run("float_pixels", pixels, false, iterations, floatFrame));
+    results.push_back(run("fixed_pixels", pixels, true, iterations, fixedFrame));
+    results.push_back(run("fixed_spans", spans, true, iterations, spansFrame));
+
+    printf("%-14s %10s %8s\n", "case", "us/frame", "speedup");
+    for (const Result& r : results)
+        printf("%-14s %10.1f %7.2fx\n", r.name, r.bestUs, results[0].bestUs / r.bestUs);
+    printf("float and fixed geometry differ in %zu pixels\n", differingPixels(floatFrame, fixedFrame));
+    size_t spanErrors = differingPixels(fixedFrame, spansFrame);
+    if (spanErrors) {
+        printf("FAILED: byte spans differ from the pixel path in %zu pixels\n", spanErrors);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,352 @@
+// Weather payload benchmark: parse time and heap high-water mark of
+//   owm_json        the old sketch's path: each OpenWeatherMap response
+//                   read into a String (http.getString()) and
+//                   deserializeJson'ed whole, fields copied out
+//   owm_stream      the same responses parsed from the stream with
+//                   ArduinoJson filters, one forecast reading at a time,
+//                   stopping once five days are complete (owm_feed.h)
+//   dashboard_json  the /dashboard JSON through dashboardParseJson()
+//   dashboard_bin   the /dashboard?format=bin record streamed from the file
+//                   by dashboardReadRecord()
+//
+//   cd server && node tools/payloads.js ../sim/bench/payloads && cd ..
+//   pio run -e native_payload_bench
+//   .pio/build/native_payload_bench/program [--payloads DIR] [--iterations N]
+//                                           [--now EPOCH] [--tz POSIX_TZ]
+//
+// The OpenWeatherMap payloads are parsed as if the device clock read
+// --now in --tz, by default the time and zone of the synthetic ones. For
+// responses captured with payloads.js --weather/--forecast, pass the
+// capture time (and zone), or the forecast days are picked from the wrong
+// day.
+//
+// Every parse starts from the SPIFFS file, as on the device. Heap is
+// counted by wrapping malloc and friends, so it includes the String and
+// the JsonDocument pool at their largest. The run fails when the two
+// OpenWeatherMap parsers or the JSON and binary dashboard payloads do not
+// give the same DashboardData, or when the binary parser allocates at all.
+// The ArduinoJson figures only mean something against the real library,
+// which env:native links: the filters that keep owm_stream's documents
+// small are ArduinoJson's. No results of this benchmark are recorded.
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <SPIFFS.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "dashboard_data.h"
+#include "owm_feed.h"
+#include "sim.h"
+
+// Heap accounting: glibc lets the executable replace malloc, the originals
+// stay reachable under their __libc_ names
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+
+size_t heapLive = 0;
+size_t heapHigh = 0;
+size_t heapAllocations = 0;
+
+void heapAdd(void* ptr)
+{
+    if (!ptr)
+        return;
+    heapLive += malloc_usable_size(ptr);
+    heapHigh = std::max(heapHigh, heapLive);
+    heapAllocations++;
+}
+
+void heapRemove(void* ptr)
+{
+    if (ptr)
+        heapLive -= malloc_usable_size(ptr);
+}
+
+} // namespace
+
+extern "C" {
+void* malloc(size_t size)
+{
+    void* ptr = __libc_malloc(size);
+    heapAdd(ptr);
+    return ptr;
+}
+
+void* calloc(size_t count, size_t size)
+{
+    void* ptr = __libc_calloc(count, size);
+    heapAdd(ptr);
+    return ptr;
+}
+
+void* realloc(void* old, size_t size)
+{
+    heapRemove(old);
+    void* ptr = __libc_realloc(old, size);
+    heapAdd(ptr ? ptr : old);
+    return ptr;
+}
+
+void free(void* ptr)
+{
+    heapRemove(ptr);
+    __libc_free(ptr);
+}
+}
+
+namespace {
+
+// Device clock for the OpenWeatherMap payloads; by default the time
+// server/tools/payloads.js starts the synthetic ones at, in Minsk
+time_t payloadTime = 1792400400; // 2026-10-19 09:00 UTC
+const char* payloadZone = "<+03>-3";
+
+// Bytes of the payload files the last parse read
+size_t bytesRead = 0;
+
+struct Result {
+    const char* name;
+    size_t bytes = 0;
+    size_t read = 0;
+    double bestUs = 0;
+    size_t peakHeap = 0;
+    size_t allocations = 0;
+    bool ok = false;
+};
+
+size_t fileSize(const char* path)
+{
+    File file = SPIFFS.open(path, FILE_READ);
+    size_t size = file ? file.size() : 0;
+    file.close();
+    return size;
+}
+
+// What http.getString() leaves on the heap: the whole body in one String
+String readBody(File& file)
+{
+    String body;
+    body.reserve(file.size());
+    char chunk[129];
+    size_t n;
+    while ((n = file.read((uint8_t*)chunk, sizeof(chunk) - 1)) > 0) {
+        chunk[n] = 0;
+        body += chunk;
+    }
+    return body;
+}
+
+// The old sketch: parseWeather(http.getString()), parseForecast(...)
+bool parseOwm(DashboardData& data)
+{
+    memset(&data, 0, sizeof(data));
+    File file = SPIFFS.open("/owm_weather.json", FILE_READ);
+    if (!file)
+        return false;
+    String json = readBody(file);
+    bytesRead = file.size();
+    file.close();
+    {
+        JsonDocument doc;
+        if (deserializeJson(doc, json))
+            return false;
+        data.temp = lround(doc["main"]["temp"].as<double>());
+        dashboardCopy(data.description, sizeof(data.description), doc["weather"][0]["description"] | "");
+        data.icon = wxIconParse(doc["weather"][0]["icon"] | "");
+        dashboardCopy(data.city, sizeof(data.city), doc["name"] | "");
+    }
+
+    file = SPIFFS.open("/owm_forecast.json", FILE_READ);
+    if (!file)
+        return false;
+    json = readBody(file);
+    bytesRead += file.size();
+    file.close();
+    JsonDocument doc;
+    if (deserializeJson(doc, json))
+        return false;
+    // Days picked as in owm_feed.h, so that the results compare
+    struct tm local;
+    localtime_r(&payloadTime, &local);
+    int today = local.tm_yday, day = today, bestDistance = 0;
+    for (JsonObject entry : doc["list"].as<JsonArray>()) {
+        time_t timestamp = entry["dt"].as<long>();
+        localtime_r(&timestamp, &local);
+        if (local.tm_yday == today)
+            continue;
+        if (local.tm_yday != day) {
+            if (data.forecastCount == DASHBOARD_FORECAST_DAYS)
+                break;
+            day = local.tm_yday;
+            bestDistance = 24;
+            data.forecastCount++;
+        }
+        int distance = abs(local.tm_hour - 12);
+        if (distance < bestDistance) {
+            DashboardForecast& forecast = data.forecast[data.forecastCount - 1];
+            bestDistance = distance;
+            forecast.day = local.tm_mday;
+            forecast.temp = lroundf(entry["main"]["temp"].as<float>());
+            forecast.icon = wxIconParse(entry["weather"][0]["icon"] | "");
+        }
+    }
+    return data.forecastCount > 0;
+}
+
+bool parseOwmStream(DashboardData& data)
+{
+    memset(&data, 0, sizeof(data));
+    File file = SPIFFS.open("/owm_weather.json", FILE_READ);
+    if (!file)
+        return false;
+    bool ok = owmParseWeather(file, data);
+    bytesRead = file.position();
+    file.close();
+    file = SPIFFS.open("/owm_forecast.json", FILE_READ);
+    if (!ok || !file)
+        return false;
+    ok = owmParseForecast(file, data, payloadTime);
+    bytesRead += file.position();
+    file.close();
+    return ok;
+}
+
+bool parseDashboardJson(DashboardData& data)
+{
+    File file = SPIFFS.open("/dashboard.json", FILE_READ);
+    if (!file)
+        return false;
+    char json[DASHBOARD_MAX_PAYLOAD];
+    size_t length = file.read((uint8_t*)json, sizeof(json));
+    bytesRead = length;
+    file.close();
+    return dashboardParseJson(json, length, data);
+}
+
+bool parseDashboardRecord(DashboardData& data)
+{
+    File file = SPIFFS.open("/dashboard.bin", FILE_READ);
+    if (!file)
+        return false;
+    bool ok = dashboardReadRecord(file, data);
+    bytesRead = file.position();
+    file.close();
+    return ok;
+}
+
+// Opening a simulated SPIFFS file allocates on the host but not on the
+// device; its cost is measured once and taken off every case
+struct Overhead {
+    size_t heap = 0;
+    size_t allocations = 0;
+};
+
+Overhead fileOverhead()
+{
+    size_t liveBefore = heapLive, countBefore = heapAllocations;
+    heapHigh = heapLive;
+    File file = SPIFFS.open("/dashboard.bin", FILE_READ);
+    file.read();
+    file.close();
+    Overhead overhead;
+    overhead.heap = heapHigh - liveBefore;
+    overhead.allocations = heapAllocations - countBefore;
+    return overhead;
+}
+
+Result run(const char* name, bool (*parse)(DashboardData&), int iterations, size_t bytes, const Overhead& overhead,
+    int files, DashboardData& data)
+{
+    Result result;
+    result.name = name;
+    result.bytes = bytes;
+    for (int i = 0; i < iterations; i++) {
+        size_t liveBefore = heapLive, countBefore = heapAllocations;
+        heapHigh = heapLive;
+        uint32_t start = micros();
+        result.ok = parse(data);
+        uint32_t elapsed = micros() - start;
+        result.read = bytesRead;
+        if (i == 0 || elapsed < result.bestUs)
+            result.bestUs = elapsed;
+        size_t peak = heapHigh - liveBefore;
+        size_t allocations = heapAllocations - countBefore;
+        result.peakHeap = std::max(result.peakHeap, peak > files * overhead.heap ? peak - files * overhead.heap : 0);
+        result.allocations = allocations > files * overhead.allocations ? allocations - files * overhead.allocations : 0;
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* payloadsDir = "sim/bench/payloads";
+    int iterations = 200;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            fprintf(stderr, "missing value for %s\n", arg.c_str());
+            return 2;
+        }
+        if (arg == "--payloads")
+            payloadsDir = argv[++i];
+        else if (arg == "--iterations")
+            iterations = std::max(1, atoi(argv[++i]));
+        else if (arg == "--now")
+            payloadTime = (time_t)atoll(argv[++i]);
+        else if (arg == "--tz")
+            payloadZone = argv[++i];
+        else {
+            fprintf(stderr, "unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    setenv("SIM_SPIFFS_DIR", payloadsDir, 1);
+    setenv("TZ", payloadZone, 1);
+    tzset();
+    if (!SPIFFS.begin(false) || !SPIFFS.exists("/dashboard.bin") || !SPIFFS.exists("/owm_forecast.json")) {
+        fprintf(stderr, "no payloads in %s (make them with server/tools/payloads.js)\n", payloadsDir);
+        return 2;
+    }
+    Overhead overhead = fileOverhead();
+
+    DashboardData owm, owmStream, json, record;
+    size_t owmBytes = fileSize("/owm_weather.json") + fileSize("/owm_forecast.json");
+    std::vector<Result> results;
+    results.push_back(run("owm_json", parseOwm, iterations, owmBytes, overhead, 2, owm));
+    results.push_back(run("owm_stream", parseOwmStream, iterations, owmBytes, overhead, 2, owmStream));
+    results.push_back(run("dashboard_json", parseDashboardJson, iterations, fileSize("/dashboard.json"), overhead, 1, json));
+    results.push_back(run("dashboard_bin", parseDashboardRecord, iterations, fileSize("/dashboard.bin"), overhead, 1, record));
+
+    bool failed = false;
+    printf("%-16s %8s %8s %10s %10s %8s  %s\n", "parser", "bytes", "read", "us", "peak heap", "allocs", "result");
+    for (const Result& r : results) {
+        printf("%-16s %8zu %8zu %10.1f %10zu %8zu  %s\n", r.name, r.bytes, r.read, r.bestUs, r.peakHeap, r.allocations,
+            r.ok ? "ok" : "FAILED");
+        failed = failed || !r.ok;
+    }
+    if (memcmp(&owm, &owmStream, sizeof(owm)) != 0) {
+        printf("FAILED: streamed and whole-document OpenWeatherMap parses differ\n");
+        failed = true;
+    }
+    if (memcmp(&json, &record, sizeof(json)) != 0) {
+        printf("FAILED: JSON and binary dashboard payloads parse differently\n");
+        failed = true;
+    }
+    if (results.back().peakHeap > 0) {
+        printf("FAILED: dashboardReadRecord() allocated %zu bytes\n", results.back().peakHeap);
+        failed = true;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+// Host-side stand-in for Adafruit_NeoPixel (native simulator only).
+#pragma once
+
+#include "Arduino.h"
+
+#define NEO_GRB 0x52
+#define NEO_KHZ800 0x0000
+
+class Adafruit_NeoPixel {
+public:
+    Adafruit_NeoPixel(uint16_t n, int16_t pin, uint16_t type) : _n(n) { (void)pin, (void)type; }
+    void begin() { }
+    void show() { }
+    void clear() { }
+    void setBrightness(uint8_t b) { _brightness = b; }
+    void setPixelColor(uint16_t n, uint32_t c)
+    {
+        if (n < _n)
+            _color = c;
+    }
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) { return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b; }
+
+private:
+    uint16_t _n;
+    uint8_t _brightness = 255;
+    uint32_t _color = 0;
+};
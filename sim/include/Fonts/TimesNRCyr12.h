@@ -0,0 +1,4 @@
+// The device build finds <Fonts/...> in src/fonts through the case-insensitive
+// include lookup of the Windows/macOS toolchains; forward it explicitly here.
+#pragma once
+#include "../../../src/fonts/TimesNRCyr12.h"
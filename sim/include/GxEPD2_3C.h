@@ -0,0 +1,409 @@
+// Simulated GxEPD2 3-color panel (native simulator only).
+//
+// Mirrors the public API of GxEPD2_3C / GxEPD2_750c_Z08 that the firmware
+// uses. Instead of talking SPI, writeImage() lands in an in-memory copy of
+// the controller RAM and refresh() latches it to a simulated "glass" that can
+// be dumped as PNG or raw BWR planes via the sim:: API. Paged drawing keeps
+// the upstream semantics: the page buffer is HEIGHT / pages rows tall and
+// firstPage()/nextPage() re-run the drawing loop once per page.
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "SPI.h"
+#include "sim.h"
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_DARKGREY 0x7BEF
+#define GxEPD_LIGHTGREY 0xC618
+#define GxEPD_WHITE 0xFFFF
+#define GxEPD_RED 0xF800
+#define GxEPD_YELLOW 0xFFE0
+#define GxEPD_COLORED GxEPD_RED
+
+namespace GxEPD2 {
+enum Panel { GDEW075Z08 };
+}
+
+// Controller RAM / glass model shared by all simulated panels.
+namespace sim {
+struct PanelStats {
+    uint32_t writeImageCalls = 0;
+    uint64_t writeImageBytes = 0;
+    uint32_t fullRefreshes = 0;
+    uint32_t partialRefreshes = 0;
+    uint32_t powerOffs = 0;
+};
+void panelWrite(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y);
+void panelRefresh(int16_t x, int16_t y, int16_t w, int16_t h, bool partial);
+PanelStats& panelStats();
+} // namespace sim
+
+class GxEPD2_EPD {
+public:
+    GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy, int16_t busy_level, uint32_t busy_timeout, uint16_t w, uint16_t h,
+        GxEPD2::Panel p, bool c, bool pu, bool fpu)
+        : WIDTH(w)
+        , HEIGHT(h)
+        , panel(p)
+        , hasColor(c)
+        , hasPartialUpdate(pu)
+        , hasFastPartialUpdate(fpu)
+        , _cs(cs)
+        , _dc(dc)
+        , _rst(rst)
+        , _busy(busy)
+        , _busy_level(busy_level)
+        , _busy_timeout(busy_timeout)
+    {
+    }
+    virtual ~GxEPD2_EPD() { }
+
+    const uint16_t WIDTH;
+    const uint16_t HEIGHT;
+    const GxEPD2::Panel panel;
+    const bool hasColor;
+    const bool hasPartialUpdate;
+    const bool hasFastPartialUpdate;
+
+    virtual void init(uint32_t serial_diag_bitrate = 0) { init(serial_diag_bitrate, true, 10, false); }
+    virtual void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10, bool pulldown_rst_mode = false)
+    {
+        _diag_enabled = serial_diag_bitrate > 0;
+        _initial_write = initial;
+        _initial_refresh = initial;
+        (void)reset_duration;
+        (void)pulldown_rst_mode;
+    }
+    void setBusyCallback(void (*busyCallback)(const void*), const void* busy_callback_parameter = 0)
+    {
+        _busy_callback = busyCallback;
+        _busy_callback_parameter = busy_callback_parameter;
+    }
+    void selectSPI(SPIClass& spi, SPISettings spi_settings)
+    {
+        _pSPIx = &spi;
+        _spi_settings = spi_settings;
+    }
+
+protected:
+    void _waitWhileBusy(const char* comment, uint32_t modeledMs)
+    {
+        // BUSY reads asserted until the callback light-sleeps with a GPIO
+        // wakeup, which stands for the waveform running to its end. The
+        // callback is invoked once per busy phase.
+        sim::panelBusy(_busy, _busy_level, true);
+        if (_busy_callback)
+            _busy_callback(_busy_callback_parameter);
+        sim::panelBusy(_busy, _busy_level, false);
+        if (!sim::fastDelays())
+            delay(modeledMs);
+        if (_diag_enabled && comment)
+            Serial.printf("%s : %u (modeled)\n", comment, (unsigned)modeledMs);
+    }
+
+    int16_t _cs, _dc, _rst, _busy, _busy_level;
+    uint32_t _busy_timeout;
+    bool _diag_enabled = false;
+    bool _initial_write = true;
+    bool _initial_refresh = true;
+    bool _power_is_on = false;
+    SPIClass* _pSPIx = &SPI;
+    SPISettings _spi_settings = SPISettings(4000000, MSBFIRST, SPI_MODE0);
+    void (*_busy_callback)(const void*) = nullptr;
+    const void* _busy_callback_parameter = nullptr;
+};
+
+class GxEPD2_750c_Z08 : public GxEPD2_EPD {
+public:
+    static const uint16_t WIDTH = 800;
+    static const uint16_t WIDTH_VISIBLE = WIDTH;
+    static const uint16_t HEIGHT = 480;
+    static const GxEPD2::Panel panel = GxEPD2::GDEW075Z08;
+    static const bool hasColor = true;
+    static const bool hasPartialUpdate = true;
+    static const bool hasFastPartialUpdate = false;
+    static const uint16_t power_on_time = 200; // ms, e.g. 155135us
+    static const uint16_t power_off_time = 40; // ms, e.g. 34367us
+    static const uint16_t full_refresh_time = 16000; // ms, e.g. 15565035us
+    static const uint16_t partial_refresh_time = 16000; // ms, e.g. 15565035us
+
+    GxEPD2_750c_Z08(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+        : GxEPD2_EPD(cs, dc, rst, busy, LOW, 30000000, WIDTH, HEIGHT, panel, hasColor, hasPartialUpdate, hasFastPartialUpdate)
+    {
+    }
+
+    void clearScreen(uint8_t value = 0xFF) { clearScreen(value, 0xFF); }
+    void clearScreen(uint8_t black_value, uint8_t color_value)
+    {
+        writeScreenBuffer(black_value, color_value);
+        refresh(false);
+    }
+    void writeScreenBuffer(uint8_t value = 0xFF) { writeScreenBuffer(value, 0xFF); }
+    void writeScreenBuffer(uint8_t black_value, uint8_t color_value)
+    {
+        static uint8_t black[WIDTH / 8], color[WIDTH / 8];
+        memset(black, black_value, sizeof(black));
+        memset(color, color_value, sizeof(color));
+        for (int16_t row = 0; row < HEIGHT; row++)
+            sim::panelWrite(black, color, 0, row, WIDTH, 1, false, false);
+        _initial_write = false;
+    }
+    void writeImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+        bool mirror_y = false, bool pgm = false)
+    {
+        (void)pgm;
+        if (_initial_write)
+            writeScreenBuffer();
+        sim::panelWrite(black, color, x, y, w, h, invert, mirror_y);
+    }
+    void refresh(bool partial_update_mode = false)
+    {
+        if (partial_update_mode) {
+            refresh(0, 0, WIDTH, HEIGHT);
+            return;
+        }
+        _PowerOn();
+        sim::panelRefresh(0, 0, WIDTH, HEIGHT, false);
+        _waitWhileBusy("_Update_Full", full_refresh_time);
+        _initial_refresh = false;
+    }
+    void refresh(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        if (_initial_refresh) {
+            refresh(false);
+            return;
+        }
+        _PowerOn();
+        sim::panelRefresh(x, y, w, h, true);
+        _waitWhileBusy("_Update_Part", partial_refresh_time);
+    }
+    void powerOff()
+    {
+        if (_power_is_on) {
+            _waitWhileBusy("_PowerOff", power_off_time);
+            sim::panelStats().powerOffs++;
+        }
+        _power_is_on = false;
+    }
+    void hibernate() { powerOff(); }
+
+private:
+    void _PowerOn()
+    {
+        if (!_power_is_on)
+            _waitWhileBusy("_PowerOn", power_on_time);
+        _power_is_on = true;
+    }
+};
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_3C : public Adafruit_GFX {
+public:
+    GxEPD2_Type epd2;
+
+    explicit GxEPD2_3C(GxEPD2_Type epd2_instance)
+        : Adafruit_GFX(GxEPD2_Type::WIDTH_VISIBLE, GxEPD2_Type::HEIGHT)
+        , epd2(epd2_instance)
+    {
+        _page_height = page_height;
+        _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+        _mirror = false;
+        _using_partial_mode = false;
+        _current_page = 0;
+        setFullWindow();
+    }
+
+    uint16_t pages() { return _pages; }
+    uint16_t pageHeight() { return _page_height; }
+    bool mirror(bool m) { return _mirror = m; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+            return;
+        if (_mirror)
+            x = width() - x - 1;
+        switch (getRotation()) {
+        case 1:
+            _swap_(x, y);
+            x = WIDTH - x - 1;
+            break;
+        case 2:
+            x = WIDTH - x - 1;
+            y = HEIGHT - y - 1;
+            break;
+        case 3:
+            _swap_(x, y);
+            y = HEIGHT - y - 1;
+            break;
+        }
+        x -= _pw_x;
+        y -= _pw_y;
+        if ((x < 0) || (x >= int16_t(_pw_w)) || (y < 0) || (y >= int16_t(_pw_h)))
+            return;
+        y -= _page_y;
+        if ((y < 0) || (y >= int16_t(_page_height)))
+            return;
+        uint16_t i = x / 8 + y * (_pw_w / 8);
+        uint8_t bit = 1 << (7 - x % 8);
+        _black_buffer[i] |= bit;
+        _color_buffer[i] |= bit;
+        if (color == GxEPD_WHITE)
+            return;
+        else if (color == GxEPD_BLACK)
+            _black_buffer[i] &= ~bit;
+        else if (color == GxEPD_RED)
+            _color_buffer[i] &= ~bit;
+        else {
+            if ((color & 0xF800) > 0x8000)
+                _color_buffer[i] &= ~bit;
+            else if ((color & 0xF800) < 0x8000)
+                _black_buffer[i] &= ~bit;
+        }
+    }
+
+    void init(uint32_t serial_diag_bitrate = 0)
+    {
+        epd2.init(serial_diag_bitrate);
+        _using_partial_mode = false;
+        _current_page = 0;
+        setFullWindow();
+    }
+    void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10, bool pulldown_rst_mode = false)
+    {
+        epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+        _using_partial_mode = false;
+        _current_page = 0;
+        setFullWindow();
+    }
+    void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration, bool pulldown_rst_mode, SPIClass& spi, SPISettings spi_settings)
+    {
+        epd2.selectSPI(spi, spi_settings);
+        init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+    }
+
+    void fillScreen(uint16_t color) override
+    {
+        uint8_t black = 0xFF;
+        uint8_t red = 0xFF;
+        if (color == GxEPD_WHITE)
+            ;
+        else if (color == GxEPD_BLACK)
+            black = 0x00;
+        else if (color == GxEPD_RED)
+            red = 0x00;
+        else if ((color & 0xF800) > 0x8000)
+            red = 0x00;
+        else if ((color & 0xF800) < 0x8000)
+            black = 0x00;
+        memset(_black_buffer, black, sizeof(_black_buffer));
+        memset(_color_buffer, red, sizeof(_color_buffer));
+    }
+
+    void display(bool partial_update_mode = false)
+    {
+        epd2.writeImage(_black_buffer, _color_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+        epd2.refresh(partial_update_mode);
+    }
+
+    void setFullWindow()
+    {
+        _using_partial_mode = false;
+        _pw_x = 0;
+        _pw_y = 0;
+        _pw_w = GxEPD2_Type::WIDTH;
+        _pw_h = GxEPD2_Type::HEIGHT;
+    }
+
+    void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+        _rotate(x, y, w, h);
+        _pw_x = x < GxEPD2_Type::WIDTH ? x : GxEPD2_Type::WIDTH;
+        _pw_y = y < GxEPD2_Type::HEIGHT ? y : GxEPD2_Type::HEIGHT;
+        _pw_w = x + w < GxEPD2_Type::WIDTH ? w : GxEPD2_Type::WIDTH - _pw_x;
+        _pw_h = y + h < GxEPD2_Type::HEIGHT ? h : GxEPD2_Type::HEIGHT - _pw_y;
+        // make _pw_x, _pw_w multiple of 8
+        _pw_w += _pw_x % 8;
+        if (_pw_w % 8 > 0)
+            _pw_w += 8 - _pw_w % 8;
+        _pw_x -= _pw_x % 8;
+        _using_partial_mode = true;
+    }
+
+    void firstPage()
+    {
+        fillScreen(GxEPD_WHITE);
+        _current_page = 0;
+        _page_y = 0;
+    }
+
+    bool nextPage()
+    {
+        uint16_t page_ys = _current_page * _page_height;
+        uint16_t page_ye = page_ys + _page_height < _pw_h ? page_ys + _page_height : _pw_h;
+        if (page_ye > page_ys)
+            epd2.writeImage(_black_buffer, _color_buffer, _pw_x, _pw_y + page_ys, _pw_w, page_ye - page_ys);
+        _current_page++;
+        uint16_t pages = (_pw_h / _page_height) + ((_pw_h % _page_height) > 0);
+        if (_current_page >= pages) {
+            _current_page = 0;
+            _page_y = 0;
+            if (_using_partial_mode)
+                epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
+            else
+                epd2.refresh(false);
+            epd2.powerOff();
+            return false;
+        }
+        _page_y = _current_page * _page_height;
+        fillScreen(GxEPD_WHITE);
+        return true;
+    }
+
+    void writeImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false,
+        bool mirror_y = false, bool pgm = false)
+    {
+        epd2.writeImage(black, color, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void writeScreenBuffer(uint8_t value = 0xFF) { epd2.writeScreenBuffer(value); }
+    void refresh(bool partial_update_mode = false) { epd2.refresh(partial_update_mode); }
+    void refresh(int16_t x, int16_t y, int16_t w, int16_t h) { epd2.refresh(x, y, w, h); }
+    void clearScreen(uint8_t value = 0xFF) { epd2.clearScreen(value); }
+    void powerOff() { epd2.powerOff(); }
+    void hibernate() { epd2.hibernate(); }
+
+private:
+    template <typename T>
+    static void _swap_(T& a, T& b)
+    {
+        T t = a;
+        a = b;
+        b = t;
+    }
+    void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
+    {
+        switch (getRotation()) {
+        case 1:
+            _swap_(x, y);
+            _swap_(w, h);
+            x = GxEPD2_Type::WIDTH - x - w;
+            break;
+        case 2:
+            x = GxEPD2_Type::WIDTH - x - w;
+            y = GxEPD2_Type::HEIGHT - y - h;
+            break;
+        case 3:
+            _swap_(x, y);
+            _swap_(w, h);
+            y = GxEPD2_Type::HEIGHT - y - h;
+            break;
+        }
+    }
+
+    uint8_t _black_buffer[(GxEPD2_Type::WIDTH / 8) * page_height];
+    uint8_t _color_buffer[(GxEPD2_Type::WIDTH / 8) * page_height];
+    bool _using_partial_mode, _mirror;
+    uint16_t _pw_x, _pw_y, _pw_w, _pw_h;
+    uint16_t _pages, _page_height, _current_page;
+    int16_t _page_y = 0;
+};
@@ -0,0 +1,72 @@
+// Host-side stand-in for the ESP32 SPI driver (native simulator only).
+// Transfers are counted but go nowhere.
+#pragma once
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+#define SPI_MSBFIRST 1
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define FSPI 0
+#define HSPI 1
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : _clock(clock)
+        , _bitOrder(bitOrder)
+        , _dataMode(dataMode)
+    {
+    }
+    uint32_t _clock;
+    uint8_t _bitOrder;
+    uint8_t _dataMode;
+};
+
+class SPIClass {
+public:
+    explicit SPIClass(uint8_t spi_bus = HSPI) : _bus(spi_bus) { }
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1)
+    {
+        _sck = sck;
+        _miso = miso;
+        _mosi = mosi;
+        _ss = ss;
+    }
+    void end() { }
+    void beginTransaction(SPISettings settings) { _settings = settings; }
+    void endTransaction() { }
+    uint8_t transfer(uint8_t)
+    {
+        bytes++;
+        return 0xFF;
+    }
+    void transfer(void* data, uint32_t size)
+    {
+        (void)data;
+        bytes += size;
+    }
+    void writeBytes(const uint8_t* data, uint32_t size)
+    {
+        (void)data;
+        bytes += size;
+    }
+    uint8_t bus() const { return _bus; }
+    uint32_t clock() const { return _settings._clock; }
+    int8_t pinSCK() const { return _sck; }
+    int8_t pinMOSI() const { return _mosi; }
+    int8_t pinMISO() const { return _miso; }
+
+    uint64_t bytes = 0;
+
+private:
+    uint8_t _bus;
+    int8_t _sck = -1, _miso = -1, _mosi = -1, _ss = -1;
+    SPISettings _settings;
+};
+
+extern SPIClass SPI;
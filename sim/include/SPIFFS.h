@@ -0,0 +1,20 @@
+// Host-side stand-in for the ESP32 SPIFFS filesystem (native simulator only).
+// The partition is a host directory: $SIM_SPIFFS_DIR or ./sim_spiffs.
+#pragma once
+
+#include "FS.h"
+
+namespace fs {
+
+class SPIFFSFS : public FS {
+public:
+    bool begin(bool formatOnFail = false, const char* basePath = "/spiffs", uint8_t maxOpenFiles = 10, const char* partitionLabel = nullptr);
+    void end() { }
+    bool format();
+    size_t totalBytes();
+    size_t usedBytes();
+};
+
+} // namespace fs
+
+extern fs::SPIFFSFS SPIFFS;
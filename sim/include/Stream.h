@@ -0,0 +1,5 @@
+// Host-side stand-in for the Arduino core's Stream.h (native simulator only).
+// Stream lives in Print.h; ArduinoJson's stream reader includes this name.
+#pragma once
+
+#include "Print.h"
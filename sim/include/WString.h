@@ -0,0 +1,247 @@
+// Host-side stand-in for the Arduino String class (native simulator only).
+// Backed by std::string; implements the subset used by the firmware.
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+class String {
+public:
+    String() { }
+    String(const char* s) : _s(s ? s : "") { }
+    String(const std::string& s) : _s(s) { }
+    String(const String& other) = default;
+    String(String&& other) = default;
+    explicit String(char c) : _s(1, c) { }
+    explicit String(unsigned char v, unsigned char base = 10) { fromUnsigned(v, base); }
+    explicit String(int v, unsigned char base = 10) { fromSigned(v, base); }
+    explicit String(unsigned int v, unsigned char base = 10) { fromUnsigned(v, base); }
+    explicit String(long v, unsigned char base = 10) { fromSigned(v, base); }
+    explicit String(unsigned long v, unsigned char base = 10) { fromUnsigned(v, base); }
+    explicit String(long long v, unsigned char base = 10) { fromSigned(v, base); }
+    explicit String(unsigned long long v, unsigned char base = 10) { fromUnsigned(v, base); }
+    explicit String(float v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+    explicit String(double v, unsigned int decimals = 2) { fromDouble(v, decimals); }
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) = default;
+    String& operator=(const char* s)
+    {
+        _s = s ? s : "";
+        return *this;
+    }
+
+    unsigned int length() const { return (unsigned int)_s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    const char* c_str() const { return _s.c_str(); }
+    bool reserve(unsigned int size)
+    {
+        _s.reserve(size);
+        return true;
+    }
+
+    char charAt(unsigned int i) const { return i < _s.size() ? _s[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    char& operator[](unsigned int i) { return _s[i]; }
+    void setCharAt(unsigned int i, char c)
+    {
+        if (i < _s.size())
+            _s[i] = c;
+    }
+
+    String substring(unsigned int from) const { return from < _s.size() ? String(_s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to) {
+            unsigned int t = from;
+            from = to;
+            to = t;
+        }
+        if (from >= _s.size())
+            return String();
+        if (to > _s.size())
+            to = (unsigned int)_s.size();
+        return String(_s.substr(from, to - from));
+    }
+
+    int indexOf(char c, unsigned int from = 0) const { return toIndex(_s.find(c, from)); }
+    int indexOf(const String& str, unsigned int from = 0) const { return toIndex(_s.find(str._s, from)); }
+    int lastIndexOf(char c) const { return toIndex(_s.rfind(c)); }
+    int lastIndexOf(const String& str) const { return toIndex(_s.rfind(str._s)); }
+
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.size(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const
+    {
+        return _s.size() >= suffix._s.size() && _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+    }
+    bool equals(const String& other) const { return _s == other._s; }
+    bool equalsIgnoreCase(const String& other) const { return strcasecmp(_s.c_str(), other._s.c_str()) == 0; }
+
+    void trim()
+    {
+        size_t b = _s.find_first_not_of(" \t\r\n");
+        if (b == std::string::npos) {
+            _s.clear();
+            return;
+        }
+        size_t e = _s.find_last_not_of(" \t\r\n");
+        _s = _s.substr(b, e - b + 1);
+    }
+    void toLowerCase()
+    {
+        for (auto& c : _s)
+            c = (char)tolower((unsigned char)c);
+    }
+    void toUpperCase()
+    {
+        for (auto& c : _s)
+            c = (char)toupper((unsigned char)c);
+    }
+    void replace(const String& find, const String& repl)
+    {
+        if (find._s.empty())
+            return;
+        size_t pos = 0;
+        while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+            _s.replace(pos, find._s.size(), repl._s);
+            pos += repl._s.size();
+        }
+    }
+    void remove(unsigned int index) { remove(index, (unsigned int)_s.size()); }
+    void remove(unsigned int index, unsigned int count)
+    {
+        if (index < _s.size())
+            _s.erase(index, count);
+    }
+
+    long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+    float toFloat() const { return strtof(_s.c_str(), nullptr); }
+    double toDouble() const { return strtod(_s.c_str(), nullptr); }
+
+    void getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index = 0) const
+    {
+        toCharArray((char*)buf, bufsize, index);
+    }
+    void toCharArray(char* buf, unsigned int bufsize, unsigned int index = 0) const
+    {
+        if (!bufsize || !buf)
+            return;
+        size_t n = index < _s.size() ? _s.size() - index : 0;
+        if (n > bufsize - 1)
+            n = bufsize - 1;
+        if (n)
+            memcpy(buf, _s.data() + index, n);
+        buf[n] = 0;
+    }
+
+    bool concat(const String& s)
+    {
+        _s += s._s;
+        return true;
+    }
+    bool concat(const char* s)
+    {
+        if (s)
+            _s += s;
+        return true;
+    }
+    bool concat(char c)
+    {
+        _s += c;
+        return true;
+    }
+    String& operator+=(const String& s)
+    {
+        _s += s._s;
+        return *this;
+    }
+    String& operator+=(const char* s) { return concat(s), *this; }
+    String& operator+=(char c) { return concat(c), *this; }
+    String& operator+=(int v) { return *this += String(v); }
+    String& operator+=(unsigned int v) { return *this += String(v); }
+    String& operator+=(long v) { return *this += String(v); }
+    String& operator+=(unsigned long v) { return *this += String(v); }
+
+    bool operator==(const String& o) const { return _s == o._s; }
+    bool operator==(const char* o) const { return _s == (o ? o : ""); }
+    bool operator!=(const String& o) const { return _s != o._s; }
+    bool operator!=(const char* o) const { return !(*this == o); }
+    bool operator<(const String& o) const { return _s < o._s; }
+
+    const std::string& std() const { return _s; }
+
+private:
+    static int toIndex(size_t pos) { return pos == std::string::npos ? -1 : (int)pos; }
+    void fromSigned(long long v, unsigned char base)
+    {
+        if (v < 0) {
+            fromUnsigned((unsigned long long)(-v), base);
+            _s.insert(_s.begin(), '-');
+        } else {
+            fromUnsigned((unsigned long long)v, base);
+        }
+    }
+    void fromUnsigned(unsigned long long v, unsigned char base)
+    {
+        char buf[70];
+        char* p = buf + sizeof(buf) - 1;
+        *p = 0;
+        if (base < 2)
+            base = 10;
+        do {
+            unsigned d = (unsigned)(v % base);
+            *--p = (char)(d < 10 ? '0' + d : 'a' + d - 10);
+            v /= base;
+        } while (v);
+        _s = p;
+    }
+    void fromDouble(double v, unsigned int decimals)
+    {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "%.*f", (int)decimals, v);
+        _s = buf;
+    }
+
+    std::string _s;
+};
+
+inline String operator+(const String& a, const String& b)
+{
+    String r(a);
+    r += b;
+    return r;
+}
+inline String operator+(const String& a, const char* b)
+{
+    String r(a);
+    r += b;
+    return r;
+}
+inline String operator+(const char* a, const String& b)
+{
+    String r(a);
+    r += b;
+    return r;
+}
+inline String operator+(const String& a, char c)
+{
+    String r(a);
+    r += c;
+    return r;
+}
+inline String operator+(const String& a, int v) { return a + String(v); }
+inline String operator+(const String& a, unsigned int v) { return a + String(v); }
+inline String operator+(const String& a, long v) { return a + String(v); }
+inline String operator+(const String& a, unsigned long v) { return a + String(v); }
+inline String operator+(const String& a, float v) { return a + String(v); }
+inline String operator+(const String& a, double v) { return a + String(v); }
+
+// Named by ArduinoJson's String adapter; the operators above return String
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& s) : String(s) { }
+    StringSumHelper(const char* s) : String(s) { }
+};
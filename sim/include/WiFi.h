@@ -0,0 +1,93 @@
+// Host-side stand-in for the ESP32 WiFi stack (native simulator only).
+// The "radio" is always connected; WiFiClient is a plain POSIX TCP socket,
+// so the firmware can talk to a server on the loopback interface.
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4, WL_DISCONNECTED = 6 } wl_status_t;
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1 } wifi_mode_t;
+
+class IPAddress {
+public:
+    IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : _a { a, b, c, d } { }
+    String toString() const { return String((int)_a[0]) + "." + String((int)_a[1]) + "." + String((int)_a[2]) + "." + String((int)_a[3]); }
+    bool fromString(const char* address)
+    {
+        unsigned v[4];
+        char tail;
+        if (sscanf(address, "%u.%u.%u.%u%c", &v[0], &v[1], &v[2], &v[3], &tail) != 4)
+            return false;
+        for (int i = 0; i < 4; i++) {
+            if (v[i] > 255)
+                return false;
+            _a[i] = (uint8_t)v[i];
+        }
+        return true;
+    }
+    uint8_t operator[](int i) const { return _a[i]; }
+
+private:
+    uint8_t _a[4];
+};
+
+class WiFiClass {
+public:
+    wl_status_t begin(const char*, const char* = nullptr)
+    {
+        _status = WL_CONNECTED;
+        return _status;
+    }
+    wl_status_t status() const { return _status; }
+    bool disconnect(bool = false, bool = false)
+    {
+        _status = WL_DISCONNECTED;
+        return true;
+    }
+    bool mode(wifi_mode_t) { return true; }
+    bool setSleep(bool) { return true; }
+    bool isConnected() const { return _status == WL_CONNECTED; }
+    int8_t RSSI() const { return -55; }
+    IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+    int hostByName(const char* host, IPAddress& result);
+
+private:
+    wl_status_t _status = WL_DISCONNECTED;
+};
+extern WiFiClass WiFi;
+
+class WiFiClient : public Stream {
+public:
+    WiFiClient() { }
+    ~WiFiClient() override { stop(); }
+    WiFiClient(const WiFiClient&) = delete;
+    WiFiClient& operator=(const WiFiClient&) = delete;
+
+    int connect(const char* host, uint16_t port, int32_t timeoutMs = 3000);
+    int connect(IPAddress ip, uint16_t port, int32_t timeoutMs = 3000) { return connect(ip.toString().c_str(), port, timeoutMs); }
+    uint8_t connected();
+    void stop();
+    int fd() const { return _fd; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t* buf, size_t size);
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+
+    // ESP32 core 2.x semantics: seconds, applied to the socket and Stream timeout.
+    int setTimeout(uint32_t seconds)
+    {
+        Stream::setTimeout(seconds * 1000);
+        return 0;
+    }
+    int setNoDelay(bool) { return 0; }
+    operator bool() { return connected(); }
+    using Print::write;
+
+private:
+    int _fd = -1;
+    int _peeked = -1;
+};
@@ -0,0 +1,35 @@
+// Native simulator control API. Only available in the `native` environments;
+// firmware code must not include this outside of SIM_NATIVE blocks.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sim {
+
+// Thrown by esp_deep_sleep_start(); the simulator main loop catches it and
+// "wakes" the sketch again by calling setup(). RTC_DATA_ATTR state survives.
+struct DeepSleep {
+    uint64_t durationUs;
+};
+
+void resetBoot(bool timerWake);
+void resetHeapBaseline();
+void sampleHeap(); // Folds the current usage into heapPeakBytes()
+size_t heapPeakBytes();
+void setSerialMuted(bool muted); // Drops Serial output, e.g. while benchmarking
+bool serialMuted();
+bool fastDelays();
+float chipTemperature();
+bool psramPresent();
+
+// Simulated panel
+void panelReset();
+void panelBusy(int16_t pin, int16_t level, bool busy); // BUSY as digitalRead() sees it
+bool panelDumpPng(const char* path);
+bool panelDumpPlanes(const char* path);
+const uint8_t* panelBlackPlane();
+const uint8_t* panelRedPlane();
+size_t panelPlaneSize();
+
+} // namespace sim
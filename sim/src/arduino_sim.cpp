@@ -0,0 +1,324 @@
+// Host-side implementation of the Arduino core stand-ins (native simulator only).
+#include <Arduino.h>
+
+#include <chrono>
+#include <malloc.h>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+#include "sim.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+Clock::time_point bootTime = Clock::now();
+
+// Simulated time skips ahead by every deep sleep, like the ESP32 RTC
+// keeps counting while the CPU is off.
+time_t sleptSeconds = 0;
+uint64_t sleepDurationUs = 0;
+esp_sleep_wakeup_cause_t wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+
+// Panel BUSY pin during a modeled busy phase, and the light sleep GPIO wakeup
+int16_t busyPin = -1;
+int16_t busyLevel = LOW;
+bool busyAsserted = false;
+int16_t gpioWakePin = -1;
+bool gpioWakeEnabled = false;
+
+const uint32_t kVirtualHeap = 320 * 1024;
+size_t heapBaseline = 0;
+size_t heapPeak = 0;
+
+size_t hostHeapInUse()
+{
+    struct mallinfo2 mi = mallinfo2();
+    return mi.uordblks;
+}
+
+size_t heapUsed()
+{
+    size_t inUse = hostHeapInUse();
+    size_t used = inUse > heapBaseline ? inUse - heapBaseline : 0;
+    if (used > heapPeak)
+        heapPeak = used;
+    return used;
+}
+
+} // namespace
+
+unsigned long millis()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - bootTime).count();
+}
+
+unsigned long micros()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - bootTime).count();
+}
+
+void delay(uint32_t ms)
+{
+    busyAsserted = false; // Polling BUSY: the modeled refresh ends
+    if (sim::fastDelays())
+        return;
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    if (sim::fastDelays())
+        return;
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+uint32_t esp_random()
+{
+    static std::mt19937 rng(12345);
+    return rng();
+}
+
+float temperatureRead()
+{
+    return sim::chipTemperature();
+}
+
+int digitalRead(uint8_t pin)
+{
+    if (pin == busyPin)
+        return busyAsserted ? busyLevel : !busyLevel;
+    return LOW;
+}
+
+// ---- Stream ----
+
+int Stream::timedRead()
+{
+    unsigned long start = millis();
+    do {
+        int c = read();
+        if (c >= 0)
+            return c;
+    } while (millis() - start < _timeout);
+    return -1;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+    size_t count = 0;
+    while (count < length) {
+        int c = timedRead();
+        if (c < 0)
+            break;
+        *buffer++ = (char)c;
+        count++;
+    }
+    return count;
+}
+
+String Stream::readStringUntil(char terminator)
+{
+    String ret;
+    int c = timedRead();
+    while (c >= 0 && c != terminator) {
+        ret += (char)c;
+        c = timedRead();
+    }
+    return ret;
+}
+
+String Stream::readString()
+{
+    String ret;
+    int c = timedRead();
+    while (c >= 0) {
+        ret += (char)c;
+        c = timedRead();
+    }
+    return ret;
+}
+
+// ---- Heap ----
+
+uint32_t EspClass::getHeapSize() { return kVirtualHeap; }
+uint32_t EspClass::getFreeHeap() { return kVirtualHeap - (uint32_t)std::min<size_t>(heapUsed(), kVirtualHeap); }
+uint32_t EspClass::getMinFreeHeap()
+{
+    heapUsed();
+    return kVirtualHeap - (uint32_t)std::min<size_t>(heapPeak, kVirtualHeap);
+}
+uint32_t EspClass::getMaxAllocHeap() { return getFreeHeap(); }
+uint32_t EspClass::getPsramSize() { return sim::psramPresent() ? 8 * 1024 * 1024 : 0; }
+void EspClass::resetHeapWatermark()
+{
+    heapPeak = 0;
+    heapUsed();
+}
+
+// Without PSRAM, requests that can only be served from it fail
+void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    if (caps & MALLOC_CAP_SPIRAM && !sim::psramPresent())
+        return nullptr;
+    void* p = malloc(size);
+    heapUsed();
+    return p;
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    if (caps & MALLOC_CAP_SPIRAM && !sim::psramPresent())
+        return nullptr;
+    void* p = calloc(n, size);
+    heapUsed();
+    return p;
+}
+
+void heap_caps_free(void* ptr) { free(ptr); }
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? ESP.getFreePsram() : ESP.getFreeHeap();
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    return (caps & MALLOC_CAP_SPIRAM) ? ESP.getFreePsram() : ESP.getMinFreeHeap();
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) { return heap_caps_get_free_size(caps); }
+
+// ---- Sleep ----
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us)
+{
+    sleepDurationUs = time_in_us;
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t)
+{
+    gpioWakePin = gpio_num;
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio_num)
+{
+    if (gpioWakePin == gpio_num)
+        gpioWakePin = -1;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup()
+{
+    gpioWakeEnabled = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_disable_wakeup_source(esp_sleep_source_t source)
+{
+    if (source == ESP_SLEEP_WAKEUP_GPIO || source == ESP_SLEEP_WAKEUP_ALL)
+        gpioWakeEnabled = false;
+    return ESP_OK;
+}
+
+// Woken by the panel's BUSY pin at once: the modeled refresh ends
+esp_err_t esp_light_sleep_start()
+{
+    if (gpioWakeEnabled && busyAsserted && gpioWakePin == busyPin) {
+        busyAsserted = false;
+        return ESP_OK;
+    }
+    delayMicroseconds((uint32_t)std::min<uint64_t>(sleepDurationUs, UINT32_MAX));
+    return ESP_OK;
+}
+
+void esp_deep_sleep_start()
+{
+    fflush(stdout);
+    sleptSeconds += (time_t)(sleepDurationUs / 1000000ULL);
+    throw sim::DeepSleep { sleepDurationUs };
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return wakeupCause; }
+
+// ---- Time ----
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char*, const char*, const char*)
+{
+    // Same as the ESP32 core: the offsets become a POSIX TZ string.
+    char tz[32];
+    long offset = gmtOffset_sec + daylightOffset_sec;
+    snprintf(tz, sizeof(tz), "UTC%+ld:%02ld", -offset / 3600, labs(offset % 3600) / 60);
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+bool getLocalTime(struct tm* info, uint32_t)
+{
+    time_t now = time(nullptr) + sleptSeconds;
+    localtime_r(&now, info);
+    return true;
+}
+
+// ---- Simulator control ----
+
+namespace sim {
+
+void resetBoot(bool timerWake)
+{
+    bootTime = Clock::now();
+    wakeupCause = timerWake ? ESP_SLEEP_WAKEUP_TIMER : ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
+void resetHeapBaseline()
+{
+    heapBaseline = hostHeapInUse();
+    heapPeak = 0;
+}
+
+void sampleHeap() { heapUsed(); }
+
+size_t heapPeakBytes()
+{
+    heapUsed();
+    return heapPeak;
+}
+
+static bool muted = false;
+
+void setSerialMuted(bool mute) { muted = mute; }
+bool serialMuted() { return muted; }
+
+bool fastDelays()
+{
+    static int fast = -1;
+    if (fast < 0)
+        fast = getenv("SIM_REALTIME") ? 0 : 1;
+    return fast == 1;
+}
+
+float chipTemperature()
+{
+    const char* t = getenv("SIM_TEMPERATURE");
+    return t ? (float)atof(t) : 23.0f;
+}
+
+bool psramPresent()
+{
+    const char* psram = getenv("SIM_PSRAM");
+    return !psram || strcmp(psram, "0") != 0;
+}
+
+void panelBusy(int16_t pin, int16_t level, bool busy)
+{
+    busyPin = busy ? pin : -1;
+    busyLevel = level;
+    busyAsserted = busy;
+}
+
+} // namespace sim
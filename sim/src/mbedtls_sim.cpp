@@ -0,0 +1,99 @@
+// SHA-1 for the mbedtls stand-in (native simulator only), after FIPS 180-4.
+#include <mbedtls/sha1.h>
+
+#include <cstring>
+
+namespace {
+
+uint32_t rol(uint32_t x, int n)
+{
+    return (x << n) | (x >> (32 - n));
+}
+
+void sha1Block(mbedtls_sha1_context* ctx, const unsigned char* block)
+{
+    uint32_t w[80];
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16 | (uint32_t)block[4 * i + 2] << 8 | block[4 * i + 3];
+    for (int i = 16; i < 80; i++)
+        w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    uint32_t a = ctx->state[0], b = ctx->state[1], c = ctx->state[2], d = ctx->state[3], e = ctx->state[4];
+    for (int i = 0; i < 80; i++) {
+        uint32_t f, k;
+        if (i < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        } else if (i < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        } else if (i < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+        uint32_t t = rol(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = rol(b, 30);
+        b = a;
+        a = t;
+    }
+    ctx->state[0] += a;
+    ctx->state[1] += b;
+    ctx->state[2] += c;
+    ctx->state[3] += d;
+    ctx->state[4] += e;
+}
+
+} // namespace
+
+void mbedtls_sha1_init(mbedtls_sha1_context* ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void mbedtls_sha1_free(mbedtls_sha1_context* ctx)
+{
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+int mbedtls_sha1_starts(mbedtls_sha1_context* ctx)
+{
+    static const uint32_t init[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+    ctx->total[0] = ctx->total[1] = 0;
+    memcpy(ctx->state, init, sizeof(init));
+    return 0;
+}
+
+int mbedtls_sha1_update(mbedtls_sha1_context* ctx, const unsigned char* input, size_t ilen)
+{
+    while (ilen > 0) {
+        size_t fill = ctx->total[0] & 63;
+        size_t n = ilen < 64 - fill ? ilen : 64 - fill;
+        memcpy(ctx->buffer + fill, input, n);
+        ctx->total[0] += (uint32_t)n;
+        if (ctx->total[0] < n)
+            ctx->total[1]++;
+        input += n;
+        ilen -= n;
+        if (((fill + n) & 63) == 0)
+            sha1Block(ctx, ctx->buffer);
+    }
+    return 0;
+}
+
+int mbedtls_sha1_finish(mbedtls_sha1_context* ctx, unsigned char output[20])
+{
+    uint64_t bits = ((uint64_t)ctx->total[1] << 32 | ctx->total[0]) * 8;
+    unsigned char pad[72] = { 0x80 };
+    size_t fill = ctx->total[0] & 63;
+    size_t padLen = fill < 56 ? 56 - fill : 120 - fill;
+    for (int i = 0; i < 8; i++)
+        pad[padLen + i] = (unsigned char)(bits >> (56 - 8 * i));
+    mbedtls_sha1_update(ctx, pad, padLen + 8);
+    for (int i = 0; i < 20; i++)
+        output[i] = (unsigned char)(ctx->state[i / 4] >> (24 - 8 * (i % 4)));
+    return 0;
+}
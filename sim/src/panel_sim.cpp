@@ -0,0 +1,197 @@
+// Simulated GDEW075Z08 controller RAM and glass for the native simulator.
+#include <GxEPD2_3C.h>
+
+#include <vector>
+
+#include "sim.h"
+
+namespace {
+
+const int16_t kWidth = GxEPD2_750c_Z08::WIDTH;
+const int16_t kHeight = GxEPD2_750c_Z08::HEIGHT;
+const size_t kStride = kWidth / 8;
+const size_t kPlane = kStride * kHeight;
+
+// Controller RAM (what writeImage() has sent) and glass (what the last
+// refresh latched). 1 = white / no red, like the BWR file format.
+std::vector<uint8_t> ramBlack(kPlane, 0xFF), ramRed(kPlane, 0xFF);
+std::vector<uint8_t> glassBlack(kPlane, 0xFF), glassRed(kPlane, 0xFF);
+sim::PanelStats stats;
+
+uint32_t crcTable[256];
+
+void initCrc()
+{
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++)
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        crcTable[n] = c;
+    }
+}
+
+uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len)
+{
+    crc ^= 0xFFFFFFFFu;
+    while (len--)
+        crc = crcTable[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void put32(std::vector<uint8_t>& v, uint32_t x)
+{
+    v.push_back(x >> 24);
+    v.push_back(x >> 16);
+    v.push_back(x >> 8);
+    v.push_back(x);
+}
+
+void writeChunk(FILE* f, const char* type, const std::vector<uint8_t>& data)
+{
+    std::vector<uint8_t> chunk;
+    put32(chunk, (uint32_t)data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    uint32_t crc = crc32(0, chunk.data() + 4, chunk.size() - 4);
+    put32(chunk, crc);
+    fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+} // namespace
+
+SPIClass SPI(FSPI);
+
+namespace sim {
+
+void panelWrite(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y)
+{
+    // Same window rounding as the controller: x down to a byte boundary,
+    // width up to whole bytes.
+    int16_t wb = (w + 7) / 8;
+    x -= x % 8;
+    stats.writeImageCalls++;
+    // Decoders hold their buffers while they push rows, so this catches their peak
+    sampleHeap();
+    stats.writeImageBytes += (uint64_t)wb * h * 2;
+    for (int16_t row = 0; row < h; row++) {
+        int16_t dy = y + row;
+        if (dy < 0 || dy >= kHeight)
+            continue;
+        int16_t srcRow = mirror_y ? h - 1 - row : row;
+        for (int16_t col = 0; col < wb; col++) {
+            int16_t dxb = x / 8 + col;
+            if (dxb < 0 || dxb >= (int16_t)kStride)
+                continue;
+            uint8_t b = black ? black[srcRow * wb + col] : 0xFF;
+            uint8_t c = color ? color[srcRow * wb + col] : 0xFF;
+            if (invert) {
+                b = ~b;
+                c = ~c;
+            }
+            ramBlack[dy * kStride + dxb] = b;
+            ramRed[dy * kStride + dxb] = c;
+        }
+    }
+}
+
+void panelRefresh(int16_t x, int16_t y, int16_t w, int16_t h, bool partial)
+{
+    if (partial)
+        stats.partialRefreshes++;
+    else
+        stats.fullRefreshes++;
+    int16_t x0 = std::max<int16_t>(0, x - x % 8) / 8, x1 = std::min<int16_t>(kWidth, x + w + 7) / 8;
+    int16_t y0 = std::max<int16_t>(0, y), y1 = std::min<int16_t>(kHeight, y + h);
+    for (int16_t row = y0; row < y1; row++) {
+        for (int16_t col = x0; col < x1; col++) {
+            glassBlack[row * kStride + col] = ramBlack[row * kStride + col];
+            glassRed[row * kStride + col] = ramRed[row * kStride + col];
+        }
+    }
+}
+
+PanelStats& panelStats() { return stats; }
+
+void panelReset()
+{
+    std::fill(ramBlack.begin(), ramBlack.end(), 0xFF);
+    std::fill(ramRed.begin(), ramRed.end(), 0xFF);
+    std::fill(glassBlack.begin(), glassBlack.end(), 0xFF);
+    std::fill(glassRed.begin(), glassRed.end(), 0xFF);
+    stats = PanelStats();
+}
+
+const uint8_t* panelBlackPlane() { return glassBlack.data(); }
+const uint8_t* panelRedPlane() { return glassRed.data(); }
+size_t panelPlaneSize() { return kPlane; }
+
+bool panelDumpPlanes(const char* path)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f)
+        return false;
+    fwrite(glassBlack.data(), 1, kPlane, f);
+    fwrite(glassRed.data(), 1, kPlane, f);
+    fclose(f);
+    return true;
+}
+
+// Writes the glass as an 8-bit RGB PNG using stored (uncompressed) deflate
+// blocks, so the simulator needs no zlib.
+bool panelDumpPng(const char* path)
+{
+    static bool crcReady = false;
+    if (!crcReady) {
+        initCrc();
+        crcReady = true;
+    }
+    FILE* f = fopen(path, "wb");
+    if (!f)
+        return false;
+    static const uint8_t sig[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    fwrite(sig, 1, sizeof(sig), f);
+
+    std::vector<uint8_t> ihdr;
+    put32(ihdr, kWidth);
+    put32(ihdr, kHeight);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 }); // 8-bit, truecolor
+    writeChunk(f, "IHDR", ihdr);
+
+    std::vector<uint8_t> raw;
+    raw.reserve((size_t)(kWidth * 3 + 1) * kHeight);
+    for (int16_t y = 0; y < kHeight; y++) {
+        raw.push_back(0); // filter: none
+        for (int16_t x = 0; x < kWidth; x++) {
+            uint8_t bit = 0x80 >> (x % 8);
+            bool red = !(glassRed[y * kStride + x / 8] & bit);
+            bool black = !(glassBlack[y * kStride + x / 8] & bit);
+            uint8_t r = red ? 0xD0 : black ? 0x00 : 0xFF;
+            uint8_t g = red ? 0x20 : black ? 0x00 : 0xFF;
+            uint8_t b = red ? 0x20 : black ? 0x00 : 0xFF;
+            raw.insert(raw.end(), { r, g, b });
+        }
+    }
+
+    std::vector<uint8_t> z = { 0x78, 0x01 };
+    uint32_t a = 1, bsum = 0;
+    for (uint8_t v : raw) {
+        a = (a + v) % 65521;
+        bsum = (bsum + a) % 65521;
+    }
+    for (size_t off = 0; off < raw.size(); off += 65535) {
+        uint16_t len = (uint16_t)std::min<size_t>(65535, raw.size() - off);
+        z.push_back(off + len >= raw.size() ? 1 : 0);
+        z.push_back(len & 0xFF);
+        z.push_back(len >> 8);
+        z.push_back(~len & 0xFF);
+        z.push_back((~len >> 8) & 0xFF);
+        z.insert(z.end(), raw.begin() + off, raw.begin() + off + len);
+    }
+    put32(z, (bsum << 16) | a);
+    writeChunk(f, "IDAT", z);
+    writeChunk(f, "IEND", {});
+    fclose(f);
+    return true;
+}
+
+} // namespace sim
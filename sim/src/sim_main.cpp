@@ -0,0 +1,30 @@
+// Native simulator entry point: runs the sketch's setup() and "wakes" it again
+// after every deep sleep, up to SIM_WAKES cycles (default 1).
+#include <Arduino.h>
+
+#include <cstdlib>
+
+#include "GxEPD2_3C.h"
+#include "sim.h"
+
+int main()
+{
+    const char* env = getenv("SIM_WAKES");
+    int wakes = env ? atoi(env) : 1;
+    for (int i = 0; i < wakes; i++) {
+        sim::resetBoot(i > 0);
+        try {
+            setup();
+            for (;;)
+                loop();
+        } catch (const sim::DeepSleep& s) {
+            printf("[sim] deep sleep for %llu s\n", (unsigned long long)(s.durationUs / 1000000ULL));
+        }
+    }
+    const sim::PanelStats& stats = sim::panelStats();
+    printf("[sim] panel: %u full, %u partial refreshes\n", (unsigned)stats.fullRefreshes, (unsigned)stats.partialRefreshes);
+    const char* png = getenv("SIM_PANEL_PNG");
+    if (png && sim::panelDumpPng(png))
+        printf("[sim] panel written to %s\n", png);
+    return 0;
+}
@@ -0,0 +1,184 @@
+// Host-directory backed SPIFFS for the native simulator.
+#include <SPIFFS.h>
+
+#include <dirent.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+fs::SPIFFSFS SPIFFS;
+
+namespace fs {
+
+// Matches default_16MB.csv: spiffs partition of 0x360000 bytes.
+static const size_t kPartitionSize = 0x360000;
+
+struct FileImpl {
+    FILE* fp = nullptr;
+    std::string path;
+    std::string host;
+    bool dir = false;
+    std::vector<std::string> entries;
+    size_t next = 0;
+    FS* fs = nullptr;
+    ~FileImpl()
+    {
+        if (fp)
+            fclose(fp);
+    }
+};
+
+std::string FS::hostPath(const char* path) const
+{
+    std::string p = path ? path : "/";
+    if (p.empty() || p[0] != '/')
+        p = "/" + p;
+    return _root + p;
+}
+
+File FS::open(const char* path, const char* mode, bool)
+{
+    auto impl = std::make_shared<FileImpl>();
+    impl->path = path ? path : "/";
+    impl->host = hostPath(path);
+    impl->fs = this;
+    struct stat st;
+    if (strcmp(mode, "r") == 0 && stat(impl->host.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        impl->dir = true;
+        if (DIR* d = opendir(impl->host.c_str())) {
+            while (struct dirent* e = readdir(d)) {
+                if (e->d_name[0] != '.')
+                    impl->entries.push_back(e->d_name);
+            }
+            closedir(d);
+        }
+        return File(impl);
+    }
+    const char* hostMode = strcmp(mode, "w") == 0 ? "wb" : strcmp(mode, "a") == 0 ? "ab" : strcmp(mode, "r+") == 0 ? "r+b" : "rb";
+    impl->fp = fopen(impl->host.c_str(), hostMode);
+    if (!impl->fp)
+        return File();
+    return File(impl);
+}
+
+bool FS::exists(const char* path)
+{
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) { return unlink(hostPath(path).c_str()) == 0; }
+bool FS::rename(const char* from, const char* to) { return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0; }
+bool FS::mkdir(const char* path) { return ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+bool FS::rmdir(const char* path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+
+size_t File::write(uint8_t c) { return write(&c, 1); }
+size_t File::write(const uint8_t* buf, size_t size) { return (_p && _p->fp) ? fwrite(buf, 1, size, _p->fp) : 0; }
+
+int File::available()
+{
+    if (!_p || !_p->fp)
+        return 0;
+    long cur = ftell(_p->fp);
+    return (int)(size() - (size_t)cur);
+}
+
+int File::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek()
+{
+    if (!_p || !_p->fp)
+        return -1;
+    int c = fgetc(_p->fp);
+    if (c != EOF)
+        ungetc(c, _p->fp);
+    return c == EOF ? -1 : c;
+}
+
+void File::flush()
+{
+    if (_p && _p->fp)
+        fflush(_p->fp);
+}
+
+size_t File::read(uint8_t* buf, size_t size) { return (_p && _p->fp) ? fread(buf, 1, size, _p->fp) : 0; }
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+    if (!_p || !_p->fp)
+        return false;
+    int whence = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+    return fseek(_p->fp, (long)pos, whence) == 0;
+}
+
+size_t File::position() const { return (_p && _p->fp) ? (size_t)ftell(_p->fp) : 0; }
+
+size_t File::size() const
+{
+    if (!_p || !_p->fp)
+        return 0;
+    fflush(_p->fp);
+    struct stat st;
+    return fstat(fileno(_p->fp), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+void File::close() { _p.reset(); }
+File::operator bool() const { return _p && (_p->fp || _p->dir); }
+const char* File::name() const
+{
+    if (!_p)
+        return "";
+    size_t slash = _p->path.rfind('/');
+    return slash == std::string::npos ? _p->path.c_str() : _p->path.c_str() + slash + 1;
+}
+const char* File::path() const { return _p ? _p->path.c_str() : ""; }
+bool File::isDirectory() const { return _p && _p->dir; }
+
+File File::openNextFile(const char* mode)
+{
+    if (!_p || !_p->dir || _p->next >= _p->entries.size())
+        return File();
+    std::string child = _p->path;
+    if (child.empty() || child.back() != '/')
+        child += '/';
+    child += _p->entries[_p->next++];
+    return _p->fs->open(child.c_str(), mode);
+}
+
+bool SPIFFSFS::begin(bool, const char*, uint8_t, const char*)
+{
+    const char* dir = getenv("SIM_SPIFFS_DIR");
+    _root = dir ? dir : "sim_spiffs";
+    ::mkdir(_root.c_str(), 0755);
+    struct stat st;
+    return stat(_root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+bool SPIFFSFS::format()
+{
+    File root = open("/");
+    while (File f = root.openNextFile()) {
+        std::string p = f.path();
+        f.close();
+        remove(p.c_str());
+    }
+    return true;
+}
+
+size_t SPIFFSFS::totalBytes() { return kPartitionSize; }
+
+size_t SPIFFSFS::usedBytes()
+{
+    size_t used = 0;
+    File root = open("/");
+    while (File f = root.openNextFile())
+        used += f.size();
+    return used;
+}
+
+} // namespace fs
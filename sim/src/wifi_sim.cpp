@@ -0,0 +1,188 @@
+// POSIX socket backed WiFiClient for the native simulator.
+#include <WiFi.h>
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+
+WiFiClass WiFi;
+
+int WiFiClass::hostByName(const char* host, IPAddress& result)
+{
+    // Connections go to SIM_SERVER whatever the address, so public names
+    // (api.openweathermap.org) need no DNS then
+    if (getenv("SIM_SERVER")) {
+        result = IPAddress(127, 0, 0, 1);
+        return 1;
+    }
+    struct addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    struct addrinfo* res = nullptr;
+    if (getaddrinfo(host, nullptr, &hints, &res) != 0 || !res)
+        return 0;
+    uint32_t addr = ntohl(((struct sockaddr_in*)res->ai_addr)->sin_addr.s_addr);
+    freeaddrinfo(res);
+    result = IPAddress(addr >> 24, addr >> 16, addr >> 8, addr);
+    return 1;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port, int32_t timeoutMs)
+{
+    stop();
+    // SIM_SERVER=host:port sends every connection there, so the firmware's
+    // LAN URLs reach a server running on this machine unchanged
+    std::string redirectHost;
+    if (const char* redirect = getenv("SIM_SERVER")) {
+        redirectHost = redirect;
+        size_t colon = redirectHost.rfind(':');
+        if (colon != std::string::npos) {
+            port = (uint16_t)atoi(redirectHost.c_str() + colon + 1);
+            redirectHost.resize(colon);
+        }
+        host = redirectHost.c_str();
+    }
+    struct addrinfo hints = {};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo* res = nullptr;
+    char portStr[8];
+    snprintf(portStr, sizeof(portStr), "%u", port);
+    if (getaddrinfo(host, portStr, &hints, &res) != 0 || !res)
+        return 0;
+
+    int fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (fd < 0) {
+        freeaddrinfo(res);
+        return 0;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    int rc = ::connect(fd, res->ai_addr, res->ai_addrlen);
+    freeaddrinfo(res);
+    if (rc < 0 && errno == EINPROGRESS) {
+        struct pollfd p = { fd, POLLOUT, 0 };
+        int err = 0;
+        socklen_t len = sizeof(err);
+        if (poll(&p, 1, timeoutMs) != 1 || getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) != 0 || err != 0) {
+            close(fd);
+            return 0;
+        }
+    } else if (rc < 0) {
+        close(fd);
+        return 0;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) & ~O_NONBLOCK);
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    _fd = fd;
+    _peeked = -1;
+    return 1;
+}
+
+uint8_t WiFiClient::connected()
+{
+    if (_fd < 0)
+        return 0;
+    if (_peeked >= 0)
+        return 1;
+    char c;
+    ssize_t r = recv(_fd, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (r == 0 || (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        stop();
+        return 0;
+    }
+    return 1;
+}
+
+void WiFiClient::stop()
+{
+    if (_fd >= 0)
+        close(_fd);
+    _fd = -1;
+    _peeked = -1;
+}
+
+size_t WiFiClient::write(const uint8_t* buf, size_t size)
+{
+    if (_fd < 0)
+        return 0;
+    size_t sent = 0;
+    while (sent < size) {
+        ssize_t r = send(_fd, buf + sent, size - sent, MSG_NOSIGNAL);
+        if (r <= 0)
+            break;
+        sent += (size_t)r;
+    }
+    return sent;
+}
+
+int WiFiClient::available()
+{
+    if (_fd < 0)
+        return 0;
+    int n = 0;
+    ioctl(_fd, FIONREAD, &n);
+    return n + (_peeked >= 0 ? 1 : 0);
+}
+
+int WiFiClient::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+// Non-blocking like the ESP32 core: returns what is buffered, or -1.
+int WiFiClient::read(uint8_t* buf, size_t size)
+{
+    if (_fd < 0 || size == 0)
+        return -1;
+    size_t n = 0;
+    if (_peeked >= 0) {
+        buf[n++] = (uint8_t)_peeked;
+        _peeked = -1;
+    }
+    if (n < size) {
+        ssize_t r = recv(_fd, buf + n, size - n, MSG_DONTWAIT);
+        if (r > 0)
+            n += (size_t)r;
+    }
+    return n ? (int)n : -1;
+}
+
+int WiFiClient::peek()
+{
+    if (_peeked < 0) {
+        uint8_t c;
+        if (_fd >= 0 && recv(_fd, &c, 1, MSG_DONTWAIT) == 1)
+            _peeked = c;
+    }
+    return _peeked;
+}
+
+size_t WiFiClient::readBytes(char* buffer, size_t length)
+{
+    size_t count = 0;
+    unsigned long start = millis();
+    while (count < length && millis() - start < _timeout) {
+        int r = read((uint8_t*)buffer + count, length - count);
+        if (r > 0) {
+            count += (size_t)r;
+            start = millis();
+            continue;
+        }
+        if (!connected())
+            break;
+        struct pollfd p = { _fd, POLLIN, 0 };
+        poll(&p, 1, 10);
+    }
+    return count;
+}
@@ -1,15 +1,30 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_NeoPixel.h>
 #include <Arduino.h>
-#include <Fonts/TimesNRCyr12.h>
 #include <GxEPD2_3C.h>
 // #include <GxEPD2_3C_SS.h>
-#include <HTTPClient.h>
 #include <PNGdec.h>
 #include <SPIFFS.h>
 #include <WiFi.h>
 #include <time.h>
 
+#include "frame_store.h"
+#include "http_fetch.h"
+#include "inflate_stream.h"
+#include "retry_policy.h"
+#include "download_resume.h"
+#include "spi_trace.h"
+#include "epd_spi.h"
+#include "bwr_canvas.h"
+#include "dashboard.h"
+#include "overlay.h"
+#include "panel_refresh.h"
+#include "refresh_policy.h"
+#include "panel_temp.h"
+#include "owm_feed.h"
+#include "rle_font.h"
+#include "fonts/rle/TimesNRCyr12.h"
+
 // Render API configuration
 // const char* renderApiUrl = "http://192.168.2.139:3123/render?format=bmp&width=100&height=100";
 // const char* renderApiUrl = "http://192.168.2.139:3123/render?format=bmp&url=https://www.onliner.by";
@@ -29,11 +44,68 @@ const long gmtOffset_sec = 3 * 3600; // GMT+3
 const int daylightOffset_sec = 0;    // No daylight saving
 
 // Error handling and retry configuration
-const int MAX_RETRY_ATTEMPTS = 3;
-const int RETRY_DELAY_MS = 2000; // 2 seconds between retries
-const int HTTP_TIMEOUT_MS = 60000; // 60 second timeout
+// Retries back off exponentially (2 s, 4 s, 8 s... with jitter) within a
+// per-wake budget; see retry_policy.h for how each error class is handled
+const RetryPolicy DOWNLOAD_RETRY_POLICY = {
+    45000, // budgetMs: all attempts of one wake
+    2000, // baseDelayMs
+    16000, // maxDelayMs
+    4, // maxAttempts
+    1, // maxQuickRetries after DNS / connect failures
+    5000 // minAttemptMs
+};
+const uint32_t FAILED_WAKE_RETRY_SEC = 10 * 60; // Server down: next wake in 10 min, 20 min, 40 min...
+const int HTTP_TIMEOUT_MS = 60000; // 60 second timeout for the response headers (server renders first)
+const int HTTP_STALL_TIMEOUT_MS = 5000; // Max gap between body packets
+const bool HTTP_ACCEPT_GZIP = true; // Ask for gzip, inflated on the fly while writing to SPIFFS
 const char* CACHED_IMAGE_FILENAME = "/cached.bin"; // Fallback cached file (Universal name)
 
+// Dashboard mode: fetch a few hundred bytes of weather and events from
+// /dashboard and draw them on the device (dashboard.h) instead of showing a
+// frame rendered by the server. Takes precedence over the playlist.
+const bool DASHBOARD_ENABLED = false;
+// format=bin asks for the binary record, which is parsed without heap; drop
+// it to get JSON. The stored payload may be either.
+const char* dashboardApiUrl = "http://192.168.2.139:3123/dashboard?format=bin";
+const char* DASHBOARD_DOWNLOAD_FILENAME = "/dashboard.tmp";
+const char* DASHBOARD_FILENAME = "/dashboard.dat"; // Last good payload, shown when the server is down
+// Without the server: read the OpenWeatherMap feed directly (owm_feed.h).
+// The dashboard then has no events.
+const bool DASHBOARD_DIRECT_OWM = false;
+const char* owmApiKey = "";
+const char* owmQuery = "q=Minsk&units=metric&lang=ru";
+
+// Playlist configuration: one bundle from /playlist carries several frames,
+// which are rotated on the following wakes without bringing up WiFi
+const bool PLAYLIST_ENABLED = false;
+const char* playlistApiUrl = "http://192.168.2.139:3123/playlist";
+const char* PLAYLIST_BUNDLE_FILENAME = "/playlist.bin";
+const uint32_t PLAYLIST_REFRESH_INTERVAL_SEC = 6 * 3600; // Refetch the bundle every 6 hours
+
+// Overlay mode: the server frame is decoded into a PSRAM canvas and the
+// clock, battery and temperature are drawn over it (overlay.h). The device
+// then wakes every OVERLAY_WAKE_SEC to redraw them: playlist frames stay up
+// for their duration, and a rendered frame is refetched only after
+// OVERLAY_FRAME_REFRESH_SEC. Without PSRAM the frame is shown as is.
+const bool OVERLAY_ENABLED = false;
+const uint32_t OVERLAY_WAKE_SEC = 15 * 60;
+const uint32_t OVERLAY_FRAME_REFRESH_SEC = 3 * 3600;
+const int8_t BATTERY_ADC_PIN = -1; // ADC pin behind a 1:2 divider from the battery, -1 if not wired
+
+// Telemetry is posted over the same kept-alive connection after a download
+const bool TELEMETRY_ENABLED = true;
+const char* telemetryApiUrl = "http://192.168.2.139:3123/telemetry";
+
+// Playlist rotation state, kept in RTC memory across deep sleep
+RTC_DATA_ATTR uint8_t playlistIndex = 0;
+RTC_DATA_ATTR uint32_t playlistAgeSec = 0; // Seconds slept since the last bundle fetch
+RTC_DATA_ATTR bool playlistAgeValid = false; // Cleared on power-on, forces a fetch
+RTC_DATA_ATTR uint32_t playlistFrameShownSec = 0; // Overlay mode: how long the current frame has been up
+
+// Seconds slept since a frame was last fetched, for the overlay's badge
+RTC_DATA_ATTR uint32_t frameAgeSec = 0;
+RTC_DATA_ATTR bool frameAgeValid = false;
+
 #define LED_PIN 2 // LED power pin
 #define RGB_PIN 48 // Onboard RGB LED pin
 #define RGB_NUM_PIXELS 1 // Only one LED
@@ -50,6 +122,44 @@ uint8_t bmp_input_buffer[2400]; // One row of 800 pixels * 3 bytes
 #define EPD_RST 17
 #define EPD_BUSY 16
 
+// Panel SPI clock, used until a calibration result is saved in /spi.cfg
+const uint32_t EPD_SPI_CLOCK_HZ = 10000000; // UC8179 write spec
+const bool EPD_SPI_CALIBRATE = false; // Probe 4-20 MHz on this boot and save one step below the fastest passing clock
+SPIClass epdSpi(FSPI);
+const bool CANVAS_FULL_FRAME = true; // Draw screens once into a whole-frame canvas in PSRAM; paged when it does not fit
+const uint16_t CANVAS_MIN_BAND_ROWS = 8; // Rows per band when the heap is too fragmented for a page-sized one
+
+// Region updates (panel_refresh.h): full frames are compared with the one on
+// the glass, unchanged ones are not refreshed, black and white changes get a
+// partial refresh. Images are decoded into a PSRAM frame for this.
+const bool PANEL_PARTIAL_REFRESH = true;
+RTC_DATA_ATTR PanelRefreshState panelRefreshState = {};
+
+// When partial refreshes give way to a full one and how often the panel
+// gets a clean cycle (black, white, frame); see refresh_policy.h
+const RefreshPolicy REFRESH_POLICY = {
+    5, // maxPartials in a row
+    300, // ghostBudgetPerMille: 30% of the frame changed over those partials
+    250, // partialMaxPerMille: a change over 25% gets a full refresh
+    24 * 3600UL, // staticFullSec: at least one full refresh a day
+    7 * 24 * 3600UL, // cleanIntervalSec: weekly
+    5 // partialMinTempC
+};
+RTC_DATA_ATTR RefreshPolicyState refreshPolicyState = {};
+
+// Panel temperature (panel_temp.h): the server's X-Panel-Temperature, else
+// the chip sensor. It sets the waveform (server readings only), the BUSY
+// timeout and whether REFRESH_POLICY allows partial refreshes.
+const PanelTempConfig PANEL_TEMP_CONFIG = {
+    true, // chipSensor
+    -4.0f, // chipOffsetC: the die runs warmer than the room while WiFi is up
+    6 * 3600UL // serverMaxAgeSec
+};
+const bool PANEL_BUSY_LIGHT_SLEEP = true; // Light-sleep while the panel is busy instead of polling BUSY
+RTC_DATA_ATTR PanelTempState panelTempState = {};
+PanelTemp panelTemp = { NAN, PANEL_TEMP_NONE };
+PanelBusy panelBusy;
+
 Adafruit_NeoPixel rgbPixel(RGB_NUM_PIXELS, RGB_PIN, NEO_GRB + NEO_KHZ800);
 uint32_t ledColorState = rgbPixel.Color(0xE1, 0x7C, 0x3D); // #E17C3D
 
@@ -61,28 +171,61 @@ static const uint16_t max_row_width = 1448; // for up to 6" display 1448x1072
 uint8_t output_row_mono_buffer[max_row_width / 8]; // buffer for at least one row of b/w bits
 uint8_t output_row_color_buffer[max_row_width / 8]; // buffer for at least one row of color bits
 
+// HTTP connection shared by all requests of one wake
+HttpFetch httpFetch;
+uint32_t lastDownloadBytes = 0;
+uint32_t lastDownloadMs = 0;
+FetchError lastFetchError = FETCH_OK;
+bool fetchAttempted = false;
+
+// Consecutive wakes whose download failed with the server unreachable
+RTC_DATA_ATTR uint8_t failedFetchWakes = 0;
+
 // PNGdec Globals
 PNG png;
 File pngFile;
 int16_t png_x, png_y;
 
+// While set, decoded image rows go into this canvas instead of the panel
+BwrCanvas* imageCanvas = nullptr;
+
+// What showComposite() did with the frame
+typedef enum {
+    COMPOSITE_SHOWN,
+    COMPOSITE_NO_CANVAS, // No PSRAM for the frame, nothing written: show the image directly
+    COMPOSITE_NOT_DECODED // Nothing written, the glass keeps the previous frame
+} CompositeResult;
+
 // Function declarations
 bool renderAndDownloadImage(const String& htmlContent, const char* filename, bool enableCaching = 1);
-bool downloadImage(const String& url, const String& htmlContent, const char* filename);
+bool selectPlaylistFrame(bool fetch, FrameStoreManifest& manifest, bool stored, char* filename, size_t len, uint32_t& durationSec);
+bool fetchDashboard(DashboardData& data);
+bool fetchOwmDashboard(DashboardData& data);
+FetchError downloadImage(const String& url, const String& htmlContent, const char* filename, uint32_t headerTimeoutMs = HTTP_TIMEOUT_MS);
+FetchError resumeDownload(const DownloadResume& resume, uint32_t haveBytes, const char* filename, uint32_t headerTimeoutMs);
 bool downloadImageWithRetry(const String& url, const String& htmlContent, const char* filename);
+void uploadTelemetry();
 bool copyFile(const char* source, const char* destination);
 bool fileExists(const char* filename);
-void displayImage(const char* filename, int16_t x, int16_t y);
-void displayBMP(const char* filename, int16_t x, int16_t y);
-void displayPNG(const char* filename, int16_t x, int16_t y);
-void displayBWR(const char* filename, int16_t x, int16_t y);
-void displayErrorScreen(const char* title, const char* message);
+bool displayImage(const char* filename, int16_t x, int16_t y);
+bool displayBMP(const char* filename, int16_t x, int16_t y);
+bool displayPNG(const char* filename, int16_t x, int16_t y);
+bool displayBWR(const char* filename, int16_t x, int16_t y);
+void writeImageRow(const uint8_t* black, const uint8_t* red, int16_t x, int16_t y, int16_t width);
+CompositeResult showComposite(const char* filename, const OverlayData* overlay);
+void refreshCanvas(BwrCanvas& canvas, const DamageSet& damage);
+int8_t readBatteryPercent();
+bool beginCanvas(BwrCanvas& canvas);
+void showErrorScreen(const char* title, const char* message);
+void showDashboard(const DashboardData& data, const struct tm* now);
+void displayErrorScreen(BwrCanvas& gfx, const char* title, const char* message);
+const char* activeApiUrl();
 void connectWiFi();
 void printBMPInfo(const char* filename);
 void listDir(const char* dirname, uint8_t levels);
 uint16_t read16(File& f);
 uint32_t read32(File& f);
-uint64_t calculateSleepDuration(); // Calculate sleep duration based on current time
+uint64_t calculateSleepDuration(uint32_t defaultSleepSec = 3600); // Calculate sleep duration based on current time
 
 // PNGdec Callbacks
 void* pngOpen(const char* filename, int32_t* size)
@@ -160,18 +303,38 @@ void setup()
 
         Serial.printf("SPIFFS Free after cleanup: %d bytes\n", SPIFFS.totalBytes() - SPIFFS.usedBytes());
     }
+
+    // A stored playlist that is still fresh can be shown without the network
+    FrameStoreManifest playlist;
+    bool playlistStored = PLAYLIST_ENABLED && frameStoreLoad(playlist);
+    uint32_t playlistRefreshSec = (playlistStored && playlist.refreshIntervalSec) ? playlist.refreshIntervalSec : PLAYLIST_REFRESH_INTERVAL_SEC;
+    bool playlistDue = !playlistStored || !playlistAgeValid || playlistAgeSec >= playlistRefreshSec;
+
     ledColorState = rgbPixel.Color(0x3C, 0x98, 0xB9); // #3C98B9
     rgbPixel.setPixelColor(0, ledColorState); // RGB color
     rgbPixel.show();
-    connectWiFi();
-    
+    // In overlay mode a rendered frame is kept for a while, only the overlay is new
+    bool reuseFrame = OVERLAY_ENABLED && !DASHBOARD_ENABLED && !PLAYLIST_ENABLED && frameAgeValid
+        && frameAgeSec < OVERLAY_FRAME_REFRESH_SEC && fileExists(CACHED_IMAGE_FILENAME);
+    if (PLAYLIST_ENABLED && !DASHBOARD_ENABLED && !playlistDue) {
+        Serial.printf("Offline wake: playlist is %lu s old, refetch after %lu s\n",
+            (unsigned long)playlistAgeSec, (unsigned long)playlistRefreshSec);
+    } else if (reuseFrame) {
+        Serial.printf("Offline wake: frame is %lu s old, refetch after %lu s\n", (unsigned long)frameAgeSec,
+            (unsigned long)OVERLAY_FRAME_REFRESH_SEC);
+    } else {
+        connectWiFi();
+    }
+
     // Configure NTP and get current time
+    // (on offline wakes this only restores the timezone, the RTC clock kept running)
     configTime(gmtOffset_sec, daylightOffset_sec, ntpServer);
     Serial.println("Waiting for NTP time sync...");
     
     // Wait for time to be set
     struct tm timeinfo;
-    if (!getLocalTime(&timeinfo, 10000)) { // 10 second timeout
+    bool timeValid = getLocalTime(&timeinfo, 10000); // 10 second timeout
+    if (!timeValid) {
         Serial.println("Failed to obtain time, using default 1 hour sleep");
     } else {
         char timeStr[64];
@@ -179,8 +342,9 @@ void setup()
         Serial.printf("Current time: %s\n", timeStr);
     }
 
-    // Universal image filename
-    const char* imageFilename = "/image.bin";
+    // Universal image filename (replaced by the frame path in playlist mode)
+    char imageFilename[24] = "/image.bin";
+    uint32_t frameDurationSec = 0;
 
     // Read HTML content from file dynamically
     String htmlContent = "";
@@ -189,9 +353,41 @@ void setup()
     rgbPixel.setPixelColor(0, ledColorState); // RGB color
     rgbPixel.show();
 
-    // Test with caching enabled (default) and disabled
-    bool imageDownloaded = renderAndDownloadImage(htmlContent, imageFilename); // Default: caching enabled (1)
-    // bool imageDownloaded = renderAndDownloadImage(htmlContent, imageFilename, 0); // Example: caching disabled (0)
+    bool imageDownloaded;
+    bool dashboardReady = false;
+    DashboardData dashboard;
+    if (DASHBOARD_ENABLED) {
+        dashboardReady = fetchDashboard(dashboard);
+        imageDownloaded = dashboardReady;
+    } else if (PLAYLIST_ENABLED) {
+        imageDownloaded = selectPlaylistFrame(playlistDue, playlist, playlistStored, imageFilename, sizeof(imageFilename), frameDurationSec);
+    } else if (reuseFrame) {
+        snprintf(imageFilename, sizeof(imageFilename), "%s", CACHED_IMAGE_FILENAME);
+        imageDownloaded = true;
+    } else {
+        // Test with caching enabled (default) and disabled
+        imageDownloaded = renderAndDownloadImage(htmlContent, imageFilename); // Default: caching enabled (1)
+        // imageDownloaded = renderAndDownloadImage(htmlContent, imageFilename, 0); // Example: caching disabled (0)
+    }
+
+    // Count consecutive wakes that found the server unreachable; they shorten the sleep below
+    if (fetchAttempted) {
+        if (lastFetchError == FETCH_OK) {
+            failedFetchWakes = 0;
+            frameAgeSec = 0;
+            frameAgeValid = true;
+        } else if (fetchErrorMeansServerDown(lastFetchError) && failedFetchWakes < 255) {
+            failedFetchWakes++;
+        }
+    }
+
+    // Follow-up requests reuse the download connection, then it is closed.
+    // Skipped when nothing answered, it would only wait out the same timeouts.
+    bool serverUnreachable = lastFetchError == FETCH_ERR_DNS || lastFetchError == FETCH_ERR_CONNECT
+        || lastFetchError == FETCH_ERR_TIMEOUT;
+    if (TELEMETRY_ENABLED && WiFi.status() == WL_CONNECTED && !serverUnreachable)
+        uploadTelemetry();
+    httpFetch.stop();
 
     // Display the image on e-ink display (can be disabled for debugging)
     bool displayEnabled = true; // Set to false to disable display for debugging
@@ -204,47 +400,106 @@ void setup()
         // Initialize display with longer timeout and reset
         Serial.println("Resetting display...");
         uint32_t dt = millis();
-        display.init(115200, true, 50, false); // 50 second timeout, reset=true
-        Serial.printf("Display initialized in %lu ms\n", millis() - dt);
+        spiTraceBegin(EPD_DC, EPD_BUSY, LOW);
+        spiTracePhase("init");
+        epdSpiBegin(epdSpi, EPD_SCK, EPD_MOSI);
+        uint32_t spiClockHz = epdSpiClockLoad(EPD_SPI_CLOCK_HZ);
+        // Not initial while the glass holds a known frame, so it can be refreshed partially
+        bool panelInitial = !panelRefreshState.shownValid;
+        display.init(115200, panelInitial, 50, false, epdSpi, SPISettings(spiClockHz, MSBFIRST, SPI_MODE0)); // 50 ms reset pulse
+        if (EPD_SPI_CALIBRATE) {
+            uint32_t calibratedHz = epdSpiCalibrate(epdSpi, EPD_CS, EPD_DC, EPD_BUSY);
+            if (calibratedHz) {
+                spiClockHz = calibratedHz;
+                display.epd2.selectSPI(epdSpi, SPISettings(spiClockHz, MSBFIRST, SPI_MODE0));
+            }
+        }
+        Serial.printf("Display initialized in %lu ms, SPI at %lu Hz\n", millis() - dt, (unsigned long)spiClockHz);
+
+        // BUSY waits sized for the temperature; a server reading also picks the waveform
+        panelTemp = panelTempRead(PANEL_TEMP_CONFIG, panelTempState);
+        panelBusyBegin(panelBusy, EPD_BUSY, LOW, PANEL_BUSY_LIGHT_SLEEP, GxEPD2_750c_Z08::full_refresh_time, panelTemp.celsius);
+        display.epd2.setBusyCallback(panelBusyWait, &panelBusy);
+        if (panelTemp.source == PANEL_TEMP_SERVER)
+            epdSpiSetTemperature(epdSpi, spiClockHz, EPD_CS, EPD_DC, (int8_t)lroundf(panelTemp.celsius));
+        if (panelTemp.source != PANEL_TEMP_NONE)
+            Serial.printf("Panel temperature %.1f C (%s), refresh expected to take %lu ms\n", panelTemp.celsius,
+                panelTempSourceName(panelTemp.source), (unsigned long)panelBusy.predictedMs);
+        else
+            Serial.printf("No panel temperature, refresh allowed %lu ms\n", (unsigned long)panelBusy.timeoutMs);
 
         display.setRotation(0);
         display.setFullWindow();
         display.fillScreen(GxEPD_WHITE);
-        display.setFont(&TimesNRCyr12pt8b);
 
-        if (imageDownloaded && displayEnabled) {
+        if (dashboardReady) {
+            spiTracePhase("write+refresh");
+            showDashboard(dashboard, timeValid ? &timeinfo : nullptr);
+        } else if (imageDownloaded && displayEnabled) {
             ledColorState = rgbPixel.Color(0xE7, 0xE4, 0x3F); // #E7E43FFF
             rgbPixel.setPixelColor(0, ledColorState); // RGB color
             rgbPixel.show();
-            // Display the image (auto-detect format)
-            displayImage(imageFilename, 0, 0);
-
-            // Trigger refresh without overwriting controller memory
-            // (writeImage writes directly to controller, display.display() would overwrite with buffer)
-            uint32_t dtRefresh = millis();
-            display.epd2.refresh(false); // false = full update, keeps controller memory
-            Serial.printf("Full display refresh completed in %lu ms\n", millis() - dtRefresh);
+            OverlayData overlay = { timeValid ? &timeinfo : nullptr, temperatureRead(), readBatteryPercent(), frameAgeSec,
+                frameAgeValid, fetchAttempted && lastFetchError != FETCH_OK };
+            CompositeResult composite = COMPOSITE_NO_CANVAS;
+            if (OVERLAY_ENABLED || PANEL_PARTIAL_REFRESH)
+                composite = showComposite(imageFilename, OVERLAY_ENABLED ? &overlay : nullptr);
+            if (composite == COMPOSITE_SHOWN) {
+                // Written and refreshed through a full-frame canvas, with the overlay on top if enabled
+            } else if (composite == COMPOSITE_NOT_DECODED) {
+                // Decoding it again straight to the panel would fail the same way
+            } else {
+                // Display the image (auto-detect format)
+                spiTracePhase("write");
+                if (!panelInitial)
+                    display.epd2.writeScreenBuffer(); // init() left the controller RAM as it was
+                uint32_t dtWrite = millis();
+                bool written = displayImage(imageFilename, 0, 0);
+                dtWrite = millis() - dtWrite;
+                if (!written) {
+                    // No refresh: the glass keeps the previous frame
+                    Serial.println("Image could not be shown, keeping the previous frame");
+                } else {
+                    Serial.printf("Image written to the panel in %lu ms (%lu kB/s at %lu Hz)\n", (unsigned long)dtWrite,
+                        dtWrite ? (unsigned long)(2UL * GxEPD2_750c_Z08::WIDTH / 8 * GxEPD2_750c_Z08::HEIGHT / dtWrite) : 0UL,
+                        (unsigned long)spiClockHz);
+
+                    // Trigger refresh without overwriting controller memory
+                    // (writeImage writes directly to controller, display.display() would overwrite with buffer)
+                    uint32_t dtRefresh = millis();
+                    spiTracePhase("refresh");
+                    display.epd2.refresh(false); // false = full update, keeps controller memory
+                    Serial.printf("Full display refresh completed in %lu ms\n", millis() - dtRefresh);
+                    panelRefreshForget(panelRefreshState);
+                    refreshPolicyRecord(refreshPolicyState, PANEL_REFRESH_FULL, 0);
+                }
+            }
         } else if (!imageDownloaded) {
             ledColorState = rgbPixel.Color(0xC0, 0x41, 0x33); // #C04133FF
             rgbPixel.setPixelColor(0, ledColorState); // RGB color
             rgbPixel.show();
-            // Show error message using firstPage/nextPage for text
-            display.firstPage();
-            do {
-                displayErrorScreen("API Server Unavailable", "No cached content available");
-            } while (display.nextPage());
+            // Show error message
+            spiTracePhase("write+refresh");
+            showErrorScreen("API Server Unavailable", "No cached content available");
         } else if (!displayEnabled) {
             // Show debug message
-            display.firstPage();
-            do {
-                displayErrorScreen("Debug", "Display Disabled");
-            } while (display.nextPage());
+            showErrorScreen("Debug", "Display Disabled");
         }
 
         Serial.println("Display update completed");
     }
-    // Calculate and set deep sleep duration based on current time
-    uint64_t sleepDuration = calculateSleepDuration();
+    // Calculate and set deep sleep duration based on current time.
+    // While the server is down, wake early to try again (10 min, 20 min, ...)
+    uint32_t defaultSleepSec = frameDurationSec ? frameDurationSec : 3600;
+    if (OVERLAY_ENABLED && imageDownloaded && !dashboardReady && defaultSleepSec > OVERLAY_WAKE_SEC)
+        defaultSleepSec = OVERLAY_WAKE_SEC;
+    if (failedFetchWakes > 0) {
+        uint32_t retrySec = retryWakeDelaySec(failedFetchWakes, FAILED_WAKE_RETRY_SEC, defaultSleepSec);
+        Serial.printf("Server unreachable on %u wake(s), next attempt in %lu s\n", failedFetchWakes, (unsigned long)retrySec);
+        if (retrySec < defaultSleepSec)
+            defaultSleepSec = retrySec;
+    }
+    uint64_t sleepDuration = calculateSleepDuration(defaultSleepSec);
     uint64_t sleepHours = sleepDuration / (60 * 60 * 1000000ULL);
     uint64_t sleepMinutes = (sleepDuration % (60 * 60 * 1000000ULL)) / (60 * 1000000ULL);
     
@@ -257,8 +512,20 @@ void setup()
     ledColorState = rgbPixel.Color(0, 0, 0);
     rgbPixel.setPixelColor(0, ledColorState); // RGB color
     rgbPixel.show();
+    spiTracePhase("poweroff");
     display.powerOff();
-    
+    spiTraceEnd();
+    spiTraceDump(Serial);
+    if (panelBusy.waitedMs)
+        Serial.printf("Panel BUSY for %lu ms, %lu ms of it in light sleep%s\n", (unsigned long)panelBusy.waitedMs,
+            (unsigned long)panelBusy.sleptMs, panelBusy.timeouts ? ", timed out" : "");
+
+    playlistAgeSec += sleepDuration / 1000000ULL;
+    playlistFrameShownSec += sleepDuration / 1000000ULL;
+    frameAgeSec += sleepDuration / 1000000ULL;
+    refreshPolicyAdvance(refreshPolicyState, sleepDuration / 1000000ULL);
+    panelTempAdvance(panelTempState, sleepDuration / 1000000ULL);
+
     esp_sleep_enable_timer_wakeup(sleepDuration); // Use calculated sleep duration
     esp_deep_sleep_start();
 }
@@ -319,141 +586,417 @@ bool renderAndDownloadImage(const String& htmlContent, const char* filename, boo
     }
 }
 
-// Function to download image from render API
-bool downloadImage(const String& url, const String& htmlContent, const char* filename)
+// Fetches the dashboard payload; when that fails the last good one is
+// drawn again, with the current date
+bool fetchDashboard(DashboardData& data)
+{
+    if (DASHBOARD_DIRECT_OWM) {
+        if (fetchOwmDashboard(data))
+            return true;
+        Serial.println("OpenWeatherMap fetch failed, using the last payload");
+    } else {
+        Serial.println("Fetching dashboard data...");
+        if (downloadImageWithRetry(dashboardApiUrl, "", DASHBOARD_DOWNLOAD_FILENAME))
+            copyFile(DASHBOARD_DOWNLOAD_FILENAME, DASHBOARD_FILENAME);
+        else
+            Serial.println("Dashboard fetch failed, using the last payload");
+        SPIFFS.remove(DASHBOARD_DOWNLOAD_FILENAME);
+    }
+
+    File file = SPIFFS.open(DASHBOARD_FILENAME, FILE_READ);
+    if (!file) {
+        Serial.println("No dashboard payload available");
+        return false;
+    }
+    size_t length = file.size();
+    bool parsed;
+    if (file.peek() == DASHBOARD_RECORD_MAGIC0) {
+        parsed = dashboardReadRecord(file, data);
+    } else {
+        char json[DASHBOARD_MAX_PAYLOAD];
+        length = file.read((uint8_t*)json, sizeof(json));
+        parsed = dashboardParseJson(json, length, data);
+    }
+    file.close();
+    if (!parsed) {
+        SPIFFS.remove(DASHBOARD_FILENAME);
+        return false;
+    }
+    Serial.printf("Dashboard payload: %u bytes, %u forecast days, %u events\n", (unsigned)length, data.forecastCount, data.eventCount);
+    return true;
+}
+
+// Reads current weather and forecast straight from OpenWeatherMap, parsing
+// both responses while they arrive
+bool fetchOwmDashboard(DashboardData& data)
+{
+    Serial.println("Fetching OpenWeatherMap feed...");
+    memset(&data, 0, sizeof(data));
+    data.russian = strstr(owmQuery, "lang=ru") != nullptr;
+    String url = String("http://api.openweathermap.org/data/2.5/weather?") + owmQuery + "&appid=" + owmApiKey;
+    HttpBodyStream body(httpFetch);
+    uint32_t start = millis();
+    httpFetch.setStallTimeout(HTTP_STALL_TIMEOUT_MS);
+    int status = httpFetch.request("GET", url, nullptr, nullptr, 0);
+    bool ok = status == 200 && owmParseWeather(body, data);
+    httpFetch.finish();
+    if (ok) {
+        url = String("http://api.openweathermap.org/data/2.5/forecast?") + owmQuery + "&cnt=" + OWM_MAX_READINGS + "&appid=" + owmApiKey;
+        status = httpFetch.request("GET", url, nullptr, nullptr, 0);
+        ok = status == 200 && owmParseForecast(body, data, time(nullptr));
+        Serial.printf("OpenWeatherMap forecast: %lu bytes read\n", (unsigned long)httpFetch.bytesReceived());
+        httpFetch.finish(); // Closes the connection if readings were left unread
+    }
+    if (!ok) {
+        Serial.printf("OpenWeatherMap: HTTP %d\n", status);
+        return false;
+    }
+    Serial.printf("OpenWeatherMap: %u forecast days in %lu ms\n", data.forecastCount, millis() - start);
+    return true;
+}
+
+// Fetches a new playlist bundle when due and picks the frame for this wake.
+// When the fetch fails the stored frames keep rotating, and the next wake
+// tries again since playlistAgeSec is not reset.
+bool selectPlaylistFrame(bool fetch, FrameStoreManifest& manifest, bool stored, char* filename, size_t len, uint32_t& durationSec)
+{
+    bool fetched = false;
+    if (fetch) {
+        Serial.println("Fetching playlist bundle...");
+        if (downloadImageWithRetry(playlistApiUrl, "", PLAYLIST_BUNDLE_FILENAME)
+            && frameStoreImportBundle(PLAYLIST_BUNDLE_FILENAME, manifest)) {
+            playlistIndex = 0;
+            playlistAgeSec = 0;
+            playlistAgeValid = true;
+            playlistFrameShownSec = 0;
+            fetched = true;
+        } else {
+            Serial.println("Playlist fetch failed, rotating stored frames");
+            if (SPIFFS.exists(PLAYLIST_BUNDLE_FILENAME))
+                SPIFFS.remove(PLAYLIST_BUNDLE_FILENAME);
+            // The import may have cleared the store before failing
+            stored = stored && frameStoreLoad(manifest);
+        }
+    }
+
+    if (!fetched) {
+        if (!stored) {
+            Serial.println("No stored playlist available");
+            return false;
+        }
+        // Overlay wakes keep the frame until its time is up
+        if (playlistIndex >= manifest.count || !OVERLAY_ENABLED || playlistFrameShownSec >= manifest.durationSec[playlistIndex]) {
+            playlistIndex = (playlistIndex + 1) % manifest.count;
+            playlistFrameShownSec = 0;
+        }
+    }
+
+    frameStorePath(playlistIndex, filename, len);
+    durationSec = manifest.durationSec[playlistIndex] - min(playlistFrameShownSec, manifest.durationSec[playlistIndex]);
+    Serial.printf("Showing playlist frame %u/%u (%s) for %lu s\n", playlistIndex + 1, manifest.count, filename,
+        (unsigned long)durationSec);
+    return true;
+}
+
+// Download sink: appends the body to the open SPIFFS file
+bool fileSink(const uint8_t* data, size_t len, void* context)
+{
+    File* file = (File*)context;
+    return file->write(data, len) == len;
+}
+
+// Maps a failed HttpFetch request or HTTP status to a retry policy class
+FetchError classifyHttpResult(int httpCode)
+{
+    switch (httpCode) {
+    case HttpFetch::HTTP_FETCH_ERROR_DNS:
+        return FETCH_ERR_DNS;
+    case HttpFetch::HTTP_FETCH_ERROR_CONNECT:
+    case HttpFetch::HTTP_FETCH_ERROR_SEND:
+        return FETCH_ERR_CONNECT;
+    case HttpFetch::HTTP_FETCH_ERROR_TIMEOUT:
+        return FETCH_ERR_TIMEOUT;
+    case HttpFetch::HTTP_FETCH_ERROR_PROTOCOL:
+    case HttpFetch::HTTP_FETCH_ERROR_CLOSED:
+        return FETCH_ERR_SERVER; // Dropped mid-response, e.g. the server restarting
+    case HttpFetch::HTTP_FETCH_ERROR_URL:
+    case HttpFetch::HTTP_FETCH_ERROR_SINK:
+        return FETCH_ERR_LOCAL;
+    }
+    if (httpCode >= 500 || httpCode == 429)
+        return FETCH_ERR_SERVER;
+    return FETCH_ERR_CLIENT;
+}
+
+// Server frame cache URL for a frame id: <scheme://host:port of url>/frame/<id>
+String frameUrlFor(const String& url, const String& frameId)
+{
+    int hostStart = url.indexOf("://");
+    int pathStart = url.indexOf('/', hostStart < 0 ? 0 : hostStart + 3);
+    return (pathStart < 0 ? url : url.substring(0, pathStart)) + "/frame/" + frameId;
+}
+
+// Fetches the rest of a stalled download from the server's frame cache.
+// FETCH_ERR_CLIENT means the frame is gone or the assembled file is not it,
+// and the download has to start over.
+FetchError resumeDownload(const DownloadResume& resume, uint32_t haveBytes, const char* filename, uint32_t headerTimeoutMs)
 {
     uint32_t tStart = millis();
-    Serial.println("Downloading image...");
-    Serial.println("URL: " + String(url));
-    HTTPClient http;
-    http.begin(url);
-    http.setTimeout(HTTP_TIMEOUT_MS);
-
-    int httpCode;
-    // Use POST for render API with HTML content, GET for direct URLs
-    // Add headers to prevent cookies and ensure clean request
-    http.addHeader("Content-Type", "text/html; charset=utf-8");
-    http.addHeader("Cookie", ""); // Clear any existing cookies
-    http.addHeader("Cache-Control", "no-cache");
-    http.addHeader("User-Agent", "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/115 Safari/537.36");
-
-    // Additional headers to prevent tracking and cookies
-    http.addHeader("Accept", "*/*");
-    http.addHeader("Accept-Encoding", "identity");
-    http.addHeader("Connection", "close");
+    Serial.printf("Resuming %s at %lu of %lu bytes\n", filename, (unsigned long)haveBytes, (unsigned long)resume.totalSize);
+    Serial.printf("URL: %s\n", resume.frameUrl);
 
-    uint32_t tReq = millis();
-    httpCode = http.POST(htmlContent);
-    Serial.printf("HTTP Request completed in %lu ms\n", millis() - tReq);
-    Serial.println("Using POST method with cookie prevention");
+    httpFetch.setStallTimeout(headerTimeoutMs);
+    const char* headerKeys[] = { "Content-Range", "Retry-After" };
+    httpFetch.collectHeaders(headerKeys, 2);
 
+    char extraHeaders[64];
+    snprintf(extraHeaders, sizeof(extraHeaders), "Range: bytes=%lu-\r\nAccept-Encoding: identity\r\n", (unsigned long)haveBytes);
+    int httpCode = httpFetch.request("GET", resume.frameUrl, nullptr, nullptr, 0, extraHeaders);
     Serial.printf("HTTP response code: %d\n", httpCode);
 
-    if (httpCode == 200) {
-        // Get the image data
-        int contentLength = http.getSize();
-        Serial.println("Http content length: " + String(contentLength) + " bytes");
+    // A full 200 answer is fine too, the partial is then rewritten from the start
+    const char* mode = FILE_APPEND;
+    if (httpCode == 206) {
+        // Content-Range: bytes <first>-<last>/<total>
+        String contentRange = httpFetch.header("Content-Range");
+        int dash = contentRange.indexOf('-');
+        int slash = contentRange.indexOf('/');
+        if (!contentRange.startsWith("bytes ") || dash < 0 || slash < 0
+            || (uint32_t)contentRange.substring(6, dash).toInt() != haveBytes
+            || (uint32_t)contentRange.substring(slash + 1).toInt() != resume.totalSize) {
+            Serial.printf("Unexpected Content-Range: %s\n", contentRange.c_str());
+            httpFetch.finish();
+            return FETCH_ERR_CLIENT;
+        }
+    } else if (httpCode == 200 && httpFetch.contentLength() == (int32_t)resume.totalSize) {
+        mode = FILE_WRITE;
+    } else {
+        httpFetch.finish();
+        if (httpCode > 0)
+            Serial.printf("Resume failed, status: %d\n", httpCode);
+        else
+            Serial.printf("Resume failed, error: %s\n", HttpFetch::errorToString(httpCode));
+        // 404 / 416: the frame left the server cache
+        return classifyHttpResult(httpCode);
+    }
 
-        if (contentLength > 0) {
-            // Check for free space and cleanup if necessary
-            size_t spiffsTotalBytes = SPIFFS.totalBytes();
-            size_t spiffsUsedBytes = SPIFFS.usedBytes();
-            size_t spiffsFreeBytes = spiffsTotalBytes - spiffsUsedBytes;
+    File file = SPIFFS.open(DOWNLOAD_RESUME_FILE, mode);
+    if (!file) {
+        Serial.println("Failed to open partial file on SPIFFS");
+        httpFetch.stop();
+        return FETCH_ERR_LOCAL;
+    }
+    httpFetch.setStallTimeout(HTTP_STALL_TIMEOUT_MS);
+    bool complete = httpFetch.readBody(fileSink, &file);
+    size_t fileSize = file.size();
+    file.close();
+    httpFetch.finish();
+
+    lastDownloadBytes = httpFetch.bytesReceived();
+    lastDownloadMs = httpFetch.elapsedMs();
+    Serial.printf("Resumed %lu bytes in %lu ms, %.1f KB/s\n", (unsigned long)lastDownloadBytes, (unsigned long)lastDownloadMs,
+        httpFetch.kbps());
+
+    if (!complete || fileSize != resume.totalSize) {
+        // Whatever arrived stays in the partial for the next attempt
+        Serial.printf("Resume incomplete: %d of %lu bytes\n", fileSize, (unsigned long)resume.totalSize);
+        if (httpFetch.bodyError() == HttpFetch::HTTP_FETCH_ERROR_SINK || fileSize > resume.totalSize) {
+            downloadResumeClear();
+            return FETCH_ERR_LOCAL;
+        }
+        return FETCH_ERR_STALL;
+    }
+    if (!downloadResumeVerify(resume)) {
+        Serial.println("Resumed file does not match the frame, discarding it");
+        downloadResumeClear();
+        return FETCH_ERR_CLIENT;
+    }
+    if (!downloadResumeFinish(filename)) {
+        Serial.println("Failed to move resumed file into place");
+        return FETCH_ERR_LOCAL;
+    }
+    Serial.printf("Image download resumed successfully: %d bytes\n", fileSize);
+    Serial.printf("Total resumeDownload duration: %lu ms\n", millis() - tStart);
+    return FETCH_OK;
+}
 
-            Serial.printf("SPIFFS Free: %d bytes, Required: %d bytes\n", spiffsFreeBytes, contentLength);
+// Function to download image from render API
+FetchError downloadImage(const String& url, const String& htmlContent, const char* filename, uint32_t headerTimeoutMs)
+{
+    // An earlier attempt stalled: fetch only the missing bytes if the server still has the frame
+    DownloadResume resume;
+    uint32_t haveBytes;
+    if (downloadResumeLoad(filename, resume, haveBytes)) {
+        FetchError err = resumeDownload(resume, haveBytes, filename, headerTimeoutMs);
+        if (err != FETCH_ERR_CLIENT)
+            return err;
+        Serial.println("Cannot resume, downloading from scratch");
+    }
+    downloadResumeClear();
 
-            if (spiffsFreeBytes < contentLength) {
-                Serial.println("Insufficient space. Attempting cleanup...");
+    uint32_t tStart = millis();
+    Serial.println("Downloading image...");
+    Serial.println("URL: " + String(url));
 
-                // Delete the target file if it exists
-                if (SPIFFS.exists(filename)) {
-                    Serial.printf("Removing existing target file: %s\n", filename);
-                    SPIFFS.remove(filename);
-                    spiffsFreeBytes = spiffsTotalBytes - SPIFFS.usedBytes();
-                }
+    // The render itself can take a while, so wait longer for the headers
+    // than for the gaps between body packets
+    httpFetch.setStallTimeout(headerTimeoutMs);
 
-                // If still not enough, delete the cache
-                if (spiffsFreeBytes < contentLength) {
-                    if (SPIFFS.exists(CACHED_IMAGE_FILENAME)) {
-                        Serial.printf("Removing cached file to free space: %s\n", CACHED_IMAGE_FILENAME);
-                        SPIFFS.remove(CACHED_IMAGE_FILENAME);
-                        spiffsFreeBytes = spiffsTotalBytes - SPIFFS.usedBytes();
-                    }
-                }
+    const char* headerKeys[] = { "Content-Encoding", "Retry-After", "X-Frame-Id", "X-Frame-Length", "X-Panel-Temperature" };
+    httpFetch.collectHeaders(headerKeys, 5);
 
-                Serial.printf("SPIFFS Free after cleanup: %d bytes\n", spiffsFreeBytes);
-            }
+    uint32_t tReq = millis();
+    int httpCode = httpFetch.request("POST", url, "text/html; charset=utf-8", (const uint8_t*)htmlContent.c_str(),
+        htmlContent.length(),
+        HTTP_ACCEPT_GZIP ? "Cache-Control: no-cache\r\nAccept-Encoding: gzip, deflate\r\n" : "Cache-Control: no-cache\r\nAccept-Encoding: identity\r\n");
+    Serial.printf("HTTP Request completed in %lu ms\n", millis() - tReq);
+    Serial.printf("HTTP response code: %d\n", httpCode);
 
-            // Always remove the file before writing to ensure fresh start
+    if (httpCode == 200) {
+        if (panelTempFromServer(panelTempState, httpFetch.header("X-Panel-Temperature")))
+            Serial.printf("Panel temperature from the server: %.1f C\n", panelTempState.serverCelsius);
+        String contentEncoding = httpFetch.header("Content-Encoding");
+        bool gzipped = contentEncoding.equalsIgnoreCase("gzip");
+        bool deflated = contentEncoding.equalsIgnoreCase("deflate");
+
+        // -1 for chunked or read-until-close responses, the size is then only known at the end.
+        // A compressed body's length says nothing about the file size either.
+        int contentLength = (gzipped || deflated) ? -1 : httpFetch.contentLength();
+        if (gzipped || deflated)
+            Serial.printf("Http content encoding: %s, %d bytes on the wire\n", contentEncoding.c_str(), httpFetch.contentLength());
+        else if (contentLength >= 0)
+            Serial.println("Http content length: " + String(contentLength) + " bytes");
+        else
+            Serial.println(httpFetch.isChunked() ? "Http content length: unknown (chunked)" : "Http content length: unknown");
+
+        // Check for free space and cleanup if necessary
+        size_t spiffsTotalBytes = SPIFFS.totalBytes();
+        size_t spiffsUsedBytes = SPIFFS.usedBytes();
+        size_t spiffsFreeBytes = spiffsTotalBytes - spiffsUsedBytes;
+
+        Serial.printf("SPIFFS Free: %d bytes, Required: %d bytes\n", spiffsFreeBytes, contentLength);
+
+        if (contentLength < 0 || spiffsFreeBytes < (size_t)contentLength) {
+            if (contentLength >= 0)
+                Serial.println("Insufficient space. Attempting cleanup...");
+
+            // Delete the target file if it exists
             if (SPIFFS.exists(filename)) {
+                Serial.printf("Removing existing target file: %s\n", filename);
                 SPIFFS.remove(filename);
+                spiffsFreeBytes = spiffsTotalBytes - SPIFFS.usedBytes();
             }
 
-            // Create file on SPIFFS
-            Serial.printf("Attempting to create file: %s\n", filename);
-            File file = SPIFFS.open(filename, FILE_WRITE);
-            if (!file) {
-                Serial.println("Failed to create file on SPIFFS");
-                http.end();
-                return false;
-            }
-
-            // Get the stream and write to file
-            WiFiClient* stream = http.getStreamPtr();
-
-            // Use a larger buffer for faster writes (8KB)
-            const size_t buffSize = 8192;
-            uint8_t* buffer = (uint8_t*)malloc(buffSize);
-            if (!buffer) {
-                Serial.println("Failed to allocate download buffer, using fallback small buffer");
-                buffer = (uint8_t*)malloc(1024); // Fallback
-            }
-
-            int bytesRead = 0;
-            int totalBytes = 0;
-            uint32_t tDownload = millis();
-            uint32_t lastActivity = millis();
-
-            // Optimized download loop
-            while (http.connected() && (totalBytes < contentLength)) {
-                int available = stream->available();
-                if (available > 0) {
-                    // Read as much as possible up to buffer size
-                    int toRead = (available > buffSize) ? buffSize : available;
-                    bytesRead = stream->read(buffer, toRead);
-
-                    if (bytesRead > 0) {
-                        file.write(buffer, bytesRead);
-                        totalBytes += bytesRead;
-                        lastActivity = millis();
-                    }
-                } else {
-                    // Wait a bit but don't block hard
-                    delay(1);
-                    if (millis() - lastActivity > 5000) {
-                        Serial.println("Download timeout - no data for 5 seconds");
-                        break;
-                    }
+            // If still not enough, delete the cache
+            if (contentLength >= 0 && spiffsFreeBytes < (size_t)contentLength) {
+                if (SPIFFS.exists(CACHED_IMAGE_FILENAME)) {
+                    Serial.printf("Removing cached file to free space: %s\n", CACHED_IMAGE_FILENAME);
+                    SPIFFS.remove(CACHED_IMAGE_FILENAME);
+                    spiffsFreeBytes = spiffsTotalBytes - SPIFFS.usedBytes();
                 }
             }
 
-            free(buffer); // Clean up buffer
+            Serial.printf("SPIFFS Free after cleanup: %d bytes\n", spiffsFreeBytes);
+        }
 
-            Serial.printf("Stream download and write to SPIFFS in %lu ms\n", millis() - tDownload);
+        // Always remove the file before writing to ensure fresh start
+        if (SPIFFS.exists(filename)) {
+            SPIFFS.remove(filename);
+        }
 
-            file.close();
-            Serial.printf("Image downloaded successfully: %d bytes\n", totalBytes);
-            http.end();
-            Serial.printf("Total downloadImage duration: %lu ms\n", millis() - tStart);
-            return true;
+        // Create file on SPIFFS
+        Serial.printf("Attempting to create file: %s\n", filename);
+        File file = SPIFFS.open(filename, FILE_WRITE);
+        if (!file) {
+            Serial.println("Failed to create file on SPIFFS");
+            httpFetch.stop();
+            return FETCH_ERR_LOCAL;
         }
+
+        // Stream the body straight into the file; reads block until data
+        // arrives or HTTP_STALL_TIMEOUT_MS passes without any
+        httpFetch.setStallTimeout(HTTP_STALL_TIMEOUT_MS);
+        bool complete;
+        bool inflateFailed = false;
+        if (gzipped || deflated) {
+            // Inflate each received packet straight into the file
+            InflateStream inflater;
+            InflateStream::Result rc = inflater.begin(gzipped ? InflateStream::ENCODING_GZIP : InflateStream::ENCODING_DEFLATE, fileSink, &file);
+            complete = rc == InflateStream::OK && httpFetch.readBody(InflateStream::sinkAdapter, &inflater);
+            rc = inflater.end();
+            if (rc != InflateStream::OK) {
+                Serial.printf("Inflate failed: %s\n", InflateStream::resultToString(rc));
+                inflateFailed = rc != InflateStream::ERROR_TRUNCATED;
+                complete = false;
+            }
+            Serial.printf("Inflated %lu -> %lu bytes, %lu ms spent in inflate\n", (unsigned long)inflater.bytesIn(),
+                (unsigned long)inflater.bytesOut(), (unsigned long)(inflater.inflateMicros() / 1000));
+        } else {
+            complete = httpFetch.readBody(fileSink, &file);
+        }
+        size_t fileSize = file.size();
+        file.close();
+        httpFetch.finish();
+
+        lastDownloadBytes = httpFetch.bytesReceived();
+        lastDownloadMs = httpFetch.elapsedMs();
+        Serial.printf("Stream download and write to SPIFFS in %lu ms, %.1f KB/s\n", (unsigned long)lastDownloadMs, httpFetch.kbps());
+
+        if (!complete || fileSize == 0) {
+            Serial.printf("Total downloadImage duration (failed): %lu ms\n", millis() - tStart);
+            // A body that stops arriving is a link problem; a full flash or
+            // undecodable data will not get better by retrying
+            int bodyError = httpFetch.bodyError();
+            if (inflateFailed || bodyError == HttpFetch::HTTP_FETCH_ERROR_SINK) {
+                Serial.println("Download incomplete, discarding file");
+                SPIFFS.remove(filename);
+                return FETCH_ERR_LOCAL;
+            }
+            // Keep what arrived if the server cached the frame for a ranged retry
+            String frameId = httpFetch.header("X-Frame-Id");
+            uint32_t frameLength = httpFetch.header("X-Frame-Length").toInt();
+            if (frameId.length() == 0 || fileSize == 0 || fileSize >= frameLength
+                || !downloadResumeSave(filename, filename, frameUrlFor(url, frameId), frameLength)) {
+                Serial.println("Download incomplete, discarding file");
+                SPIFFS.remove(filename);
+            }
+            return FETCH_ERR_STALL;
+        }
+
+        Serial.printf("Image downloaded successfully: %d bytes\n", fileSize);
+        Serial.printf("Total downloadImage duration: %lu ms\n", millis() - tStart);
+        return FETCH_OK;
+    } else if (httpCode > 0) {
+        Serial.printf("HTTP request failed, status: %d\n", httpCode);
     } else {
-        Serial.printf("HTTP request failed, error: %s\n", http.errorToString(httpCode).c_str());
+        Serial.printf("HTTP request failed, error: %s\n", HttpFetch::errorToString(httpCode));
     }
 
-    http.end();
+    httpFetch.finish();
     Serial.printf("Total downloadImage duration (failed): %lu ms\n", millis() - tStart);
-    return false;
+    return classifyHttpResult(httpCode);
+}
+
+// Reports download statistics to the server over the connection that is
+// still open from the frame download
+void uploadTelemetry()
+{
+    char body[256];
+    int len = snprintf(body, sizeof(body),
+        "{\"rssi\":%d,\"downloadBytes\":%lu,\"downloadMs\":%lu,\"kbps\":%.1f,"
+        "\"freeHeap\":%lu,\"uptimeMs\":%lu,\"playlistIndex\":%u,\"fetchError\":\"%s\",\"failedWakes\":%u}",
+        WiFi.RSSI(), (unsigned long)lastDownloadBytes, (unsigned long)lastDownloadMs,
+        lastDownloadMs ? (lastDownloadBytes / 1024.0f) * 1000.0f / lastDownloadMs : 0.0f,
+        (unsigned long)ESP.getFreeHeap(), millis(), playlistIndex, fetchErrorToString(lastFetchError), failedFetchWakes);
+
+    uint32_t tStart = millis();
+    httpFetch.setStallTimeout(HTTP_STALL_TIMEOUT_MS);
+    int httpCode = httpFetch.request("POST", telemetryApiUrl, "application/json", (const uint8_t*)body, len);
+    httpFetch.finish();
+    if (httpCode >= 200 && httpCode < 300)
+        Serial.printf("Telemetry uploaded in %lu ms\n", millis() - tStart);
+    else
+        Serial.printf("Telemetry upload failed: %d\n", httpCode);
 }
 
 // Helper functions for reading BMP data
@@ -477,12 +1020,12 @@ uint32_t read32(File& f)
 
 // Calculate sleep duration based on current time
 // Returns microseconds to sleep
-uint64_t calculateSleepDuration()
+uint64_t calculateSleepDuration(uint32_t defaultSleepSec)
 {
     struct tm timeinfo;
     if (!getLocalTime(&timeinfo, 5000)) { // 5 second timeout
-        Serial.println("Failed to get current time for sleep calculation, using 1 hour");
-        return 1 * 60 * 60 * 1000000ULL; // 1 hour in microseconds
+        Serial.printf("Failed to get current time for sleep calculation, using %lu s\n", (unsigned long)defaultSleepSec);
+        return (uint64_t)defaultSleepSec * 1000000ULL;
     }
     
     int currentHour = timeinfo.tm_hour;
@@ -506,19 +1049,20 @@ uint64_t calculateSleepDuration()
                      secondsUntil8AM, secondsUntil8AM / 3600, (secondsUntil8AM % 3600) / 60);
         return (uint64_t)secondsUntil8AM * 1000000ULL; // Convert to microseconds
     } else {
-        // Sleep for 1 hour
-        Serial.println("Sleeping for 1 hour");
-        return 1 * 60 * 60 * 1000000ULL; // 1 hour in microseconds
+        // Sleep for the default period (1 hour, or the playlist frame duration)
+        Serial.printf("Sleeping for %lu s\n", (unsigned long)defaultSleepSec);
+        return (uint64_t)defaultSleepSec * 1000000ULL;
     }
 }
 
 // Universal image display function - detects format and calls appropriate handler
-void displayImage(const char* filename, int16_t x, int16_t y)
+// False if the image could not be shown in full
+bool displayImage(const char* filename, int16_t x, int16_t y)
 {
     File file = SPIFFS.open(filename, FILE_READ);
     if (!file) {
         Serial.println("Failed to open image file");
-        return;
+        return false;
     }
 
     // Read magic bytes to detect format
@@ -529,48 +1073,50 @@ void displayImage(const char* filename, int16_t x, int16_t y)
 
     if (bytesRead < 2) {
         Serial.println("File too small");
-        return;
+        return false;
     }
 
     // Check for BMP signature (BM = 0x42 0x4D)
     if (magic[0] == 0x42 && magic[1] == 0x4D) {
         Serial.println("Detected BMP format");
-        displayBMP(filename, x, y);
+        return displayBMP(filename, x, y);
     }
     // Check for PNG signature (89 50 4E 47 0D 0A 1A 0A)
     else if (magic[0] == 0x89 && magic[1] == 0x50 && magic[2] == 0x4E && magic[3] == 0x47) {
         Serial.println("Detected PNG format");
-        displayPNG(filename, x, y);
+        return displayPNG(filename, x, y);
     }
     // Check for BWR (Binary raw) - Heuristic based on size for 800x480 3-color
     // 800 * 480 / 8 * 2 = 96000 bytes
     else if (fileSize == 96000) {
         Serial.println("Detected BWR format (based on size)");
-        displayBWR(filename, x, y);
+        return displayBWR(filename, x, y);
     } else {
         Serial.printf("Unknown or unsupported image format: 0x%02X 0x%02X 0x%02X 0x%02X\n",
             magic[0], magic[1], magic[2], magic[3]);
         Serial.printf("File size: %d\n", fileSize);
+        return false;
     }
 }
 
 // ================================================================
 // Function: displayBMP
 // Renders a BMP from SPIFFS
+// False if it cannot be read or is not 24/32-bit
 // ================================================================
-void displayBMP(const char* filename, int16_t x, int16_t y)
+bool displayBMP(const char* filename, int16_t x, int16_t y)
 {
 
     File file = SPIFFS.open(filename, FILE_READ);
     if (!file) {
         Serial.printf("File not found: %s\n", filename);
-        return;
+        return false;
     }
 
     if (read16(file) != 0x4D42) {
         Serial.println("Invalid BMP signature");
         file.close();
-        return;
+        return false;
     }
 
     read32(file); // fileSize
@@ -590,14 +1136,19 @@ void displayBMP(const char* filename, int16_t x, int16_t y)
     if (depth != 24 && depth != 32) {
         Serial.printf("Unsupported depth: %d\n", depth);
         file.close();
-        return;
+        return false;
     }
 
-    Serial.printf("Loading BMP %s (%dx%d, 24-bit)\n", filename, width, height);
+    Serial.printf("Loading BMP %s (%dx%d, %d-bit)\n", filename, width, height, depth);
     uint32_t startTime = millis();
 
-    uint32_t rowSize = (width * 3 + 3) & ~3;
-    uint8_t sdbuffer[3 * 800];
+    // 32-bit rows are BGRA, the alpha byte is skipped
+    uint8_t bytesPerPixel = depth / 8;
+    uint32_t rowSize = (width * bytesPerPixel + 3) & ~3;
+    uint8_t sdbuffer[4 * 800];
+    if (width > 800)
+        width = 800;
+    bool complete = true;
 
     for (int16_t row = 0; row < height; row++) {
         if (y + row >= display.epd2.HEIGHT)
@@ -607,8 +1158,11 @@ void displayBMP(const char* filename, int16_t x, int16_t y)
         uint32_t pos = imageOffset + (fileRow * rowSize);
 
         file.seek(pos);
-        if (file.read(sdbuffer, width * 3) != width * 3)
+        if (file.read(sdbuffer, width * bytesPerPixel) != width * bytesPerPixel) {
+            Serial.printf("Read error: BMP row %d\n", row);
+            complete = false;
             break;
+        }
 
         memset(output_row_mono_buffer, 0xFF, sizeof(output_row_mono_buffer));
         memset(output_row_color_buffer, 0xFF, sizeof(output_row_color_buffer));
@@ -617,9 +1171,9 @@ void displayBMP(const char* filename, int16_t x, int16_t y)
             if (x + col >= display.epd2.WIDTH)
                 break;
 
-            uint8_t b = sdbuffer[col * 3];
-            uint8_t g = sdbuffer[col * 3 + 1];
-            uint8_t r = sdbuffer[col * 3 + 2];
+            uint8_t b = sdbuffer[col * bytesPerPixel];
+            uint8_t g = sdbuffer[col * bytesPerPixel + 1];
+            uint8_t r = sdbuffer[col * bytesPerPixel + 2];
 
             bool isRed = (r > 127) && (g < 100) && (b < 100);
             bool isWhite = (r > 200) && (g > 200) && (b > 200);
@@ -634,18 +1188,20 @@ void displayBMP(const char* filename, int16_t x, int16_t y)
             }
         }
 
-        display.writeImage(output_row_mono_buffer, output_row_color_buffer, x, y + row, width, 1);
+        writeImageRow(output_row_mono_buffer, output_row_color_buffer, x, y + row, width);
     }
 
     file.close();
     Serial.printf("BMP Loaded in %lu ms\n", millis() - startTime);
+    return complete;
 }
 
 // ================================================================
 // Function: displayPNG
 // Renders a PNG from SPIFFS using PNGdec
+// False if it does not open or decode
 // ================================================================
-void displayPNG(const char* filename, int16_t x, int16_t y)
+bool displayPNG(const char* filename, int16_t x, int16_t y)
 {
     Serial.printf("Loading PNG %s\n", filename);
     uint32_t startTime = millis();
@@ -665,8 +1221,10 @@ void displayPNG(const char* filename, int16_t x, int16_t y)
 
         png.close();
         Serial.printf("PNG Loaded in %lu ms\n", millis() - startTime);
+        return rc == PNG_SUCCESS;
     } else {
         Serial.printf("Failed to open PNG: %d\n", rc);
+        return false;
     }
 }
 
@@ -728,7 +1286,7 @@ int pngDraw(PNGDRAW* pDraw)
         }
     }
 
-    display.writeImage(output_row_mono_buffer, output_row_color_buffer, png_x, png_y + row, width, 1);
+    writeImageRow(output_row_mono_buffer, output_row_color_buffer, png_x, png_y + row, width);
     return 1;
 }
 
@@ -737,13 +1295,14 @@ int pngDraw(PNGDRAW* pDraw)
 // Renders a BWR (raw binary) from SPIFFS
 // Format: [BlackPlane][RedPlane], 1 bit per pixel
 // Optimized: Reads entire planes into RAM/PSRAM to avoid seeking
+// False if the file cannot be read in full
 // ================================================================
-void displayBWR(const char* filename, int16_t x, int16_t y)
+bool displayBWR(const char* filename, int16_t x, int16_t y)
 {
     File file = SPIFFS.open(filename, FILE_READ);
     if (!file) {
         Serial.printf("File not found: %s\n", filename);
-        return;
+        return false;
     }
 
     // We assume dimensions 800x480 based on GxEPD2_750c_Z08
@@ -756,6 +1315,20 @@ void displayBWR(const char* filename, int16_t x, int16_t y)
     Serial.printf("Loading BWR %s (%dx%d) to RAM\n", filename, width, height);
     uint32_t startTime = millis();
 
+    // Composing: the planes go straight into the frame canvas
+    if (imageCanvas && x == 0 && y == 0 && imageCanvas->bands() == 1) {
+        bool ok = file.read(imageCanvas->blackPlane(), planeSize) == (size_t)planeSize
+            && file.read(imageCanvas->redPlane(), planeSize) == (size_t)planeSize;
+        file.close();
+        if (!ok) {
+            Serial.println("Read error: BWR planes");
+            return false;
+        }
+        imageCanvas->markDrawn(0, 0, width, height);
+        Serial.printf("BWR read into the frame canvas in %lu ms\n", millis() - startTime);
+        return true;
+    }
+
     // Allocate memory for both planes
     // Use malloc (ESP32-S3 with PSRAM enabled will likely use PSRAM for large blocks)
     // or it fits in SRAM (96KB is fine)
@@ -769,7 +1342,7 @@ void displayBWR(const char* filename, int16_t x, int16_t y)
         if (redPlane)
             free(redPlane);
         file.close();
-        return;
+        return false;
     }
 
     // Read Black Plane
@@ -779,7 +1352,7 @@ void displayBWR(const char* filename, int16_t x, int16_t y)
         free(blackPlane);
         free(redPlane);
         file.close();
-        return;
+        return false;
     }
 
     // Read Red Plane
@@ -789,7 +1362,7 @@ void displayBWR(const char* filename, int16_t x, int16_t y)
         free(blackPlane);
         free(redPlane);
         file.close();
-        return;
+        return false;
     }
 
     file.close();
@@ -805,13 +1378,14 @@ void displayBWR(const char* filename, int16_t x, int16_t y)
         uint8_t* bRow = blackPlane + (row * stride);
         uint8_t* rRow = redPlane + (row * stride);
 
-        display.writeImage(bRow, rRow, x, y + row, width, 1);
+        writeImageRow(bRow, rRow, x, y + row, width);
     }
 
     free(blackPlane);
     free(redPlane);
 
     Serial.printf("BWR Loaded & Rendered in %lu ms\n", millis() - startTime);
+    return true;
 }
 
 // ... existing functions (printBMPInfo, copyFile, listDir, etc.) ...
@@ -843,12 +1417,30 @@ void printBMPInfo(const char* filename)
 
 bool downloadImageWithRetry(const String& url, const String& htmlContent, const char* filename)
 {
-    // Implementation as before
-    for (int attempt = 1; attempt <= MAX_RETRY_ATTEMPTS; attempt++) {
-        if (downloadImage(url, htmlContent, filename))
+    RetryState retry;
+    retry.begin(DOWNLOAD_RETRY_POLICY);
+    fetchAttempted = true;
+    lastFetchError = FETCH_OK;
+
+    while (retry.startAttempt()) {
+        // Never let one attempt overrun the wake's budget
+        uint32_t headerTimeoutMs = retry.remainingMs() < (uint32_t)HTTP_TIMEOUT_MS ? retry.remainingMs() : HTTP_TIMEOUT_MS;
+        lastFetchError = downloadImage(url, htmlContent, filename, headerTimeoutMs);
+        if (lastFetchError == FETCH_OK)
             return true;
-        delay(RETRY_DELAY_MS);
+
+        uint32_t retryAfterSec = httpFetch.header("Retry-After").toInt();
+        uint32_t delayMs;
+        if (!retry.shouldRetry(lastFetchError, retryAfterSec, delayMs)) {
+            Serial.printf("Giving up after %u attempt(s), %lu ms: %s\n", retry.attempts(), retry.elapsedMs(),
+                fetchErrorToString(lastFetchError));
+            return false;
+        }
+        Serial.printf("Attempt %u failed (%s), retrying in %lu ms\n", retry.attempts(), fetchErrorToString(lastFetchError),
+            (unsigned long)delayMs);
+        delay(delayMs);
     }
+    Serial.printf("Retry budget used up after %u attempt(s), %lu ms\n", retry.attempts(), retry.elapsedMs());
     return false;
 }
 
@@ -907,20 +1499,201 @@ bool fileExists(const char* filename)
     return false;
 }
 
-void displayErrorScreen(const char* title, const char* message)
+// Decoder output: one row to controller RAM, or to imageCanvas when set
+void writeImageRow(const uint8_t* black, const uint8_t* red, int16_t x, int16_t y, int16_t width)
+{
+    if (imageCanvas)
+        imageCanvas->drawRow(black, red, x, y, width);
+    else
+        display.writeImage(black, red, x, y, width, 1);
+}
+
+// Battery charge from BATTERY_ADC_PIN, 3.3 V = 0 % to 4.2 V = 100 % as in
+// draw_battery(); -1 without the pin
+int8_t readBatteryPercent()
 {
-    display.fillScreen(GxEPD_WHITE);
-    display.setFont(&TimesNRCyr12pt8b);
-    display.setTextColor(GxEPD_RED);
+    if (BATTERY_ADC_PIN < 0)
+        return -1;
+    uint32_t mv = analogReadMilliVolts(BATTERY_ADC_PIN) * 2;
+    if (mv < 1000)
+        return -1; // Nothing connected
+    return (int8_t)constrain(((int32_t)mv - 3300) * 100 / (4200 - 3300), 0, 100);
+}
+
+// Allocates a canvas for one screen: the whole frame in PSRAM when
+// CANVAS_FULL_FRAME and it fits, else a band of the display's page height,
+// else CANVAS_MIN_BAND_ROWS rows
+bool beginCanvas(BwrCanvas& canvas)
+{
+    if (CANVAS_FULL_FRAME && canvas.begin(GxEPD2_750c_Z08::HEIGHT, MALLOC_CAP_SPIRAM))
+        return true;
+    return canvas.begin(display.pageHeight()) || canvas.begin(CANVAS_MIN_BAND_ROWS);
+}
+
+// Refreshes the panel after the canvas has been written: only where the
+// frame changed when it is a full frame and PANEL_PARTIAL_REFRESH, else in
+// full, as far as REFRESH_POLICY allows. damage is what was drawn into the
+// canvas.
+void refreshCanvas(BwrCanvas& canvas, const DamageSet& damage)
+{
+    spiTracePhase("refresh");
+    uint32_t dt = millis();
+    if (!PANEL_PARTIAL_REFRESH || canvas.bands() != 1) {
+        display.epd2.refresh(false);
+        panelRefreshForget(panelRefreshState);
+        refreshPolicyRecord(refreshPolicyState, PANEL_REFRESH_FULL, 0);
+        Serial.printf("Full refresh in %lu ms\n", millis() - dt);
+        return;
+    }
+    PanelRefreshPlan plan;
+    panelRefreshPlan(canvas, &damage, panelRefreshState, plan);
+    refreshPolicyApply(REFRESH_POLICY, refreshPolicyState, panelTemp.celsius, plan);
+    uint32_t planMs = millis() - dt;
+    dt = millis();
+    panelRefreshApply(display.epd2, canvas, plan);
+    uint32_t refreshMs = millis() - dt;
+    panelRefreshSave(canvas, &damage, plan, panelRefreshState);
+    refreshPolicyRecord(refreshPolicyState, plan.mode, plan.changedPerMille);
+    Serial.printf("Drawn in %u area(s), %lu%% of the frame\n", damage.count,
+        (unsigned long)(damageArea(damage) * 100 / ((uint32_t)GxEPD2_750c_Z08::WIDTH * GxEPD2_750c_Z08::HEIGHT)));
+    if (plan.mode == PANEL_REFRESH_NONE)
+        Serial.printf("Frame unchanged (compared in %lu ms), no refresh\n", (unsigned long)planMs);
+    else if (plan.mode == PANEL_REFRESH_PARTIAL)
+        Serial.printf("Partial refresh of %u area(s), %lu pixels (%u.%u%%) changed, %u since the last full one "
+                      "(ghosting budget %u/%u), in %lu ms (compared in %lu ms)\n",
+            plan.count, (unsigned long)plan.changedPixels, plan.changedPerMille / 10, plan.changedPerMille % 10,
+            refreshPolicyState.partialCount, refreshPolicyState.ghostPerMille, REFRESH_POLICY.ghostBudgetPerMille,
+            (unsigned long)refreshMs, (unsigned long)planMs);
+    else if (plan.mode == PANEL_REFRESH_CLEAN)
+        Serial.printf("Clean cycle (%s) in %lu ms\n", plan.reason, (unsigned long)refreshMs);
+    else if (plan.compared)
+        Serial.printf("Full refresh (%s), %lu pixels (%u.%u%%) changed, in %lu ms (compared in %lu ms)\n", plan.reason,
+            (unsigned long)plan.changedPixels, plan.changedPerMille / 10, plan.changedPerMille % 10, (unsigned long)refreshMs,
+            (unsigned long)planMs);
+    else
+        Serial.printf("Full refresh (%s) in %lu ms\n", plan.reason, (unsigned long)refreshMs);
+}
+
+// Draws the error screen into a BwrCanvas, in one pass or band by band,
+// then refreshes
+void showErrorScreen(const char* title, const char* message)
+{
+    BwrCanvas canvas(GxEPD2_750c_Z08::WIDTH, GxEPD2_750c_Z08::HEIGHT);
+    if (!beginCanvas(canvas)) {
+        Serial.println("Error screen: no memory for a drawing band");
+        return;
+    }
+    uint16_t bands = canvas.bands();
+    DamageSet damage;
+    damageClear(damage);
+    canvas.trackDamage(&damage);
+    uint32_t dt = micros(), drawUs = 0;
+    canvas.firstPage();
+    do {
+        uint32_t band = micros();
+        displayErrorScreen(canvas, title, message);
+        drawUs += micros() - band;
+    } while (canvas.nextPage(display.epd2));
+    const GlyphCacheStats& stats = glyphCacheStats();
+    Serial.printf("Error screen drawn in %lu us, written in %lu us, %u band(s) (glyph cache %lu hits, %lu misses)\n",
+        (unsigned long)drawUs, (unsigned long)(micros() - dt - drawUs), bands, (unsigned long)stats.glyphHits,
+        (unsigned long)stats.glyphMisses);
+    refreshCanvas(canvas, damage);
+    canvas.end();
+}
+
+// Decodes the image into a full-frame canvas, draws the overlay over it
+// unless it is nullptr, and writes the frame in one go, then refreshes.
+// Nothing is written when there is no PSRAM for the frame or the image
+// does not decode; only the first is worth a direct attempt.
+CompositeResult showComposite(const char* filename, const OverlayData* overlay)
+{
+    BwrCanvas canvas(GxEPD2_750c_Z08::WIDTH, GxEPD2_750c_Z08::HEIGHT);
+    if (!canvas.begin(GxEPD2_750c_Z08::HEIGHT, MALLOC_CAP_SPIRAM)) {
+        Serial.println("Composite: no PSRAM for the frame, showing the image as is");
+        return COMPOSITE_NO_CANVAS;
+    }
+    spiTracePhase("decode");
+    DamageSet damage;
+    damageClear(damage);
+    canvas.trackDamage(&damage);
+    uint32_t dt = micros();
+    canvas.firstPage();
+    imageCanvas = &canvas;
+    bool decoded = displayImage(filename, 0, 0);
+    imageCanvas = nullptr;
+    if (!decoded) {
+        Serial.println("Composite: image did not decode, keeping the previous frame");
+        canvas.end();
+        return COMPOSITE_NOT_DECODED;
+    }
+    uint32_t decodeUs = micros() - dt;
+    dt = micros();
+    if (overlay)
+        overlayDraw(canvas, *overlay);
+    uint32_t overlayUs = micros() - dt;
+    spiTracePhase("write");
+    dt = micros();
+    canvas.nextPage(display.epd2);
+    Serial.printf("Composite: image decoded in %lu us, overlay drawn in %lu us, written in %lu us\n", (unsigned long)decodeUs,
+        (unsigned long)overlayUs, (unsigned long)(micros() - dt));
+    refreshCanvas(canvas, damage);
+    canvas.end();
+    return COMPOSITE_SHOWN;
+}
+
+// Draws the dashboard into a BwrCanvas, in one pass or band by band, then
+// refreshes
+void showDashboard(const DashboardData& data, const struct tm* now)
+{
+    BwrCanvas canvas(GxEPD2_750c_Z08::WIDTH, GxEPD2_750c_Z08::HEIGHT);
+    if (!beginCanvas(canvas)) {
+        Serial.println("Dashboard: no memory for a drawing band");
+        return;
+    }
+    uint16_t bands = canvas.bands();
+    DamageSet damage;
+    damageClear(damage);
+    canvas.trackDamage(&damage);
+    uint32_t dt = micros(), drawUs = 0;
+    canvas.firstPage();
+    do {
+        uint32_t band = micros();
+        dashboardDraw(canvas, data, now);
+        drawUs += micros() - band;
+    } while (canvas.nextPage(display.epd2));
+    const GlyphCacheStats& stats = glyphCacheStats();
+    const IconCacheStats& icons = iconCacheStats();
+    Serial.printf("Dashboard drawn in %lu us, written in %lu us, %u band(s) (glyph cache %lu hits, %lu misses; icon cache %lu "
+                  "hits, %lu misses, %lu bytes)\n",
+        (unsigned long)drawUs, (unsigned long)(micros() - dt - drawUs), bands, (unsigned long)stats.glyphHits,
+        (unsigned long)stats.glyphMisses, (unsigned long)icons.hits, (unsigned long)icons.misses, (unsigned long)icons.bytes);
+    refreshCanvas(canvas, damage);
+    canvas.end();
+}
+
+void displayErrorScreen(BwrCanvas& gfx, const char* title, const char* message)
+{
+    gfx.fillScreen(GxEPD_WHITE);
+    gfx.setFont(&TimesNRCyr12pt8bRle);
+    gfx.setTextColor(GxEPD_RED);
     int16_t x1, y1;
     uint16_t w, h;
-    display.getTextBounds(title, 0, 0, &x1, &y1, &w, &h);
-    display.setCursor((display.width() - w) / 2, display.height() / 3);
-    display.print(title);
-    display.getTextBounds(message, 0, 0, &x1, &y1, &w, &h);
-    display.setCursor((display.width() - w) / 2, display.height() / 3 + 40);
-    display.print(message);
-    display.setTextColor(GxEPD_BLACK);
-    display.setCursor(50, display.height() / 3 + 100);
-    display.print(renderApiUrl);
+    glyphCacheTextBounds(gfx, title, 0, 0, &x1, &y1, &w, &h);
+    gfx.setCursor((gfx.width() - w) / 2, gfx.height() / 3);
+    gfx.print(title);
+    glyphCacheTextBounds(gfx, message, 0, 0, &x1, &y1, &w, &h);
+    gfx.setCursor((gfx.width() - w) / 2, gfx.height() / 3 + 40);
+    gfx.print(message);
+    gfx.setTextColor(GxEPD_BLACK);
+    gfx.setCursor(50, gfx.height() / 3 + 100);
+    gfx.print(activeApiUrl());
+}
+
+// The URL this configuration fetches from
+const char* activeApiUrl()
+{
+    if (DASHBOARD_ENABLED)
+        return DASHBOARD_DIRECT_OWM ? "http://api.openweathermap.org" : dashboardApiUrl;
+    return PLAYLIST_ENABLED ? playlistApiUrl : renderApiUrl;
 }
@@ -0,0 +1,418 @@
+#ifndef BWR_CANVAS_H_
+#define BWR_CANVAS_H_
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+#include <GxEPD2_3C.h>
+
+#include "damage.h"
+#include "glyph_cache.h"
+#include "rle_font.h"
+
+// GFX drawing surface in the panel's BWR layout (see displayBWR): a black
+// and a red plane, 1 bit per pixel, MSB first, 0 = ink.
+//
+// Like GxEPD2_3C's page buffer it holds one horizontal band of the screen,
+// but the planes are ours, so fast paths can write whole bytes instead of
+// going through drawPixel(): print() blits glyphs from glyph_cache.h at
+// rotation 0 and text size 1, and horizontal lines and fillRect() - which
+// fillCircle(), fillTriangle() and geometry.h's polygons end in - set
+// whole bytes of a row, vertical lines only visit the band's rows.
+// firstPage()/nextPage() loop over the bands
+// the same way; nextPage() only writes the band into controller RAM, the
+// caller refreshes afterwards. Given HEIGHT rows (2 x 48000 bytes on the
+// 7.5" panel, PSRAM territory) there is a single band: the frame is drawn
+// once and written to the controller in one transfer.
+//
+// Besides GFXfont it draws RleFont text (rle_font.h), decoded through the
+// glyph cache. Measure it with glyphCacheTextBounds(canvas, ...);
+// Adafruit_GFX::getTextBounds() does not know about RleFont.
+//
+// With trackDamage() every write path also adds what it touched in a color
+// other than white to a DamageSet (damage.h), whichever helper draws: text,
+// lines, fills, image rows.
+
+class BwrCanvas : public Adafruit_GFX {
+public:
+    BwrCanvas(int16_t width, int16_t height);
+    ~BwrCanvas() override;
+
+    bool begin(uint16_t bandRows, uint32_t caps = MALLOC_CAP_8BIT);
+    void end();
+
+    void firstPage();
+    template <typename EPD>
+    bool nextPage(EPD& epd);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawRow(const uint8_t* black, const uint8_t* red, int16_t x, int16_t y, int16_t w);
+    size_t write(uint8_t c) override;
+    using Adafruit_GFX::write;
+
+    // Boxes drawn from now on go into damage; nullptr stops tracking
+    void trackDamage(DamageSet* damage) { _damage = damage; }
+
+    // Either font kind; these hide Adafruit_GFX::setFont()
+    void setFont(const GFXfont* font = nullptr);
+    void setFont(const RleFont* font);
+    const GFXfont* gfxFontInUse() const { return gfxFont; }
+    const RleFont* rleFont() const { return _rleFont; }
+
+    // Plane access for byte-wise writers; rows are bandY()..bandY()+rows()-1
+    uint8_t* blackPlane() const { return _black; }
+    uint8_t* redPlane() const { return _red; }
+    uint16_t stride() const { return WIDTH / 8; }
+    int16_t bandY() const { return _bandY; }
+    uint16_t rows() const { return _bandY + _bandRows <= HEIGHT ? _bandRows : HEIGHT - _bandY; }
+    uint16_t bands() const { return _bandRows ? (HEIGHT + _bandRows - 1) / _bandRows : 0; }
+    void markDrawn(int16_t x, int16_t y, int16_t w, int16_t h);
+
+    // 0 = white, 1 = black, 2 = red, with GxEPD2_3C's mapping of other colors
+    static uint8_t ink(uint16_t color);
+
+private:
+    void selectFont(const GFXfont* font, const RleFont* rleFont);
+    void drawGlyphPixels(const GlyphCacheEntry* glyph, uint16_t color);
+    void fillSpan(int16_t left, int16_t right, int16_t row, uint8_t c);
+    void addDamage(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t c);
+
+    const RleFont* _rleFont = nullptr;
+    DamageSet* _damage = nullptr;
+    uint8_t* _black = nullptr;
+    uint8_t* _red = nullptr;
+    uint16_t _bandRows = 0;
+    int16_t _bandY = 0;
+};
+
+// Function declarations
+void glyphCacheTextBounds(BwrCanvas& canvas, const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+    uint16_t* h);
+void glyphCacheTextBounds(BwrCanvas& canvas, const String& text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+    uint16_t* h);
+
+// Implementation
+
+BwrCanvas::BwrCanvas(int16_t width, int16_t height)
+    : Adafruit_GFX(width, height)
+{
+}
+
+BwrCanvas::~BwrCanvas()
+{
+    end();
+}
+
+// Allocates both planes for bandRows rows (HEIGHT for a full frame)
+bool BwrCanvas::begin(uint16_t bandRows, uint32_t caps)
+{
+    end();
+    size_t planeSize = (size_t)stride() * bandRows;
+    _black = (uint8_t*)heap_caps_malloc(planeSize, caps);
+    _red = (uint8_t*)heap_caps_malloc(planeSize, caps);
+    if (!_black || !_red) {
+        end();
+        return false;
+    }
+    _bandRows = bandRows;
+    _bandY = 0;
+    return true;
+}
+
+void BwrCanvas::end()
+{
+    free(_black);
+    free(_red);
+    _black = nullptr;
+    _red = nullptr;
+    _bandRows = 0;
+}
+
+void BwrCanvas::firstPage()
+{
+    _bandY = 0;
+    fillScreen(GxEPD_WHITE);
+}
+
+// Writes the band to controller RAM; false after the last band
+template <typename EPD>
+bool BwrCanvas::nextPage(EPD& epd)
+{
+    epd.writeImage(_black, _red, 0, _bandY, WIDTH, rows());
+    _bandY += _bandRows;
+    if (_bandY >= HEIGHT) {
+        _bandY = 0;
+        return false;
+    }
+    fillScreen(GxEPD_WHITE);
+    return true;
+}
+
+uint8_t BwrCanvas::ink(uint16_t color)
+{
+    if (color == GxEPD_WHITE)
+        return 0;
+    if (color == GxEPD_BLACK)
+        return 1;
+    if (color == GxEPD_RED)
+        return 2;
+    if ((color & 0xF800) > 0x8000)
+        return 2;
+    if ((color & 0xF800) < 0x8000)
+        return 1;
+    return 0;
+}
+
+void BwrCanvas::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+    if (!_black || x < 0 || x >= width() || y < 0 || y >= height())
+        return;
+    int16_t t;
+    switch (rotation) {
+    case 1:
+        t = x;
+        x = WIDTH - 1 - y;
+        y = t;
+        break;
+    case 2:
+        x = WIDTH - 1 - x;
+        y = HEIGHT - 1 - y;
+        break;
+    case 3:
+        t = x;
+        x = y;
+        y = HEIGHT - 1 - t;
+        break;
+    }
+    y -= _bandY;
+    if (y < 0 || y >= (int16_t)_bandRows)
+        return;
+    size_t i = (size_t)y * stride() + x / 8;
+    uint8_t bit = 0x80 >> (x & 7);
+    uint8_t c = ink(color);
+    addDamage(x, y + _bandY, 1, 1, c);
+    if (c == 1)
+        _black[i] &= ~bit;
+    else
+        _black[i] |= bit;
+    if (c == 2)
+        _red[i] &= ~bit;
+    else
+        _red[i] |= bit;
+}
+
+void BwrCanvas::fillScreen(uint16_t color)
+{
+    if (!_black)
+        return;
+    uint8_t c = ink(color);
+    addDamage(0, _bandY, WIDTH, rows(), c);
+    size_t planeSize = (size_t)stride() * _bandRows;
+    memset(_black, c == 1 ? 0x00 : 0xFF, planeSize);
+    memset(_red, c == 2 ? 0x00 : 0xFF, planeSize);
+}
+
+// For byte-wise writers: the box they wrote, in panel coordinates, goes
+// into the damage set
+void BwrCanvas::markDrawn(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int16_t left = max(x, (int16_t)0), top = max(y, (int16_t)0);
+    addDamage(left, top, min((int16_t)(x + w), (int16_t)WIDTH) - left, min((int16_t)(y + h), (int16_t)HEIGHT) - top, 1);
+}
+
+// Adds a box in panel coordinates unless it was drawn white
+void BwrCanvas::addDamage(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t c)
+{
+    if (_damage && c != 0)
+        damageAdd(*_damage, x, y, w, h);
+}
+
+// Pixels left..right (clipped to the canvas) of band row row in ink c
+void BwrCanvas::fillSpan(int16_t left, int16_t right, int16_t row, uint8_t c)
+{
+    left = max(left, (int16_t)0);
+    right = min(right, (int16_t)(WIDTH - 1));
+    if (left > right)
+        return;
+    addDamage(left, row + _bandY, right - left + 1, 1, c);
+    uint8_t* black = _black + (size_t)row * stride();
+    uint8_t* red = _red + (size_t)row * stride();
+    int16_t first = left / 8, last = right / 8;
+    uint8_t firstBits = 0xFF >> (left & 7), lastBits = 0xFF << (7 - (right & 7));
+    if (first == last) {
+        glyphCacheInk(black, red, first, firstBits & lastBits, c);
+        return;
+    }
+    glyphCacheInk(black, red, first, firstBits, c);
+    if (last - first > 1) {
+        memset(black + first + 1, c == 1 ? 0x00 : 0xFF, last - first - 1);
+        memset(red + first + 1, c == 2 ? 0x00 : 0xFF, last - first - 1);
+    }
+    glyphCacheInk(black, red, last, lastBits, c);
+}
+
+// At other rotations, and for the zero and negative sizes Adafruit_GFX
+// draws as lines, these fall back to the pixel path
+void BwrCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+    if (rotation != 0 || w <= 0) {
+        Adafruit_GFX::drawFastHLine(x, y, w, color);
+        return;
+    }
+    if (!_black || y < _bandY || y >= _bandY + (int16_t)rows())
+        return;
+    fillSpan(x, x + w - 1, y - _bandY, ink(color));
+}
+
+void BwrCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+    if (rotation != 0 || h <= 0) {
+        Adafruit_GFX::drawFastVLine(x, y, h, color);
+        return;
+    }
+    if (!_black || x < 0 || x >= WIDTH)
+        return;
+    int16_t top = max(y, _bandY), bottom = min((int16_t)(y + h), (int16_t)(_bandY + rows()));
+    uint8_t bit = 0x80 >> (x & 7);
+    uint8_t c = ink(color);
+    addDamage(x, top, 1, bottom - top, c);
+    for (int16_t row = top - _bandY; row < bottom - _bandY; row++)
+        glyphCacheInk(_black, _red, (size_t)row * stride() + x / 8, bit, c);
+}
+
+void BwrCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+    if (rotation != 0 || w <= 0 || h <= 0) {
+        Adafruit_GFX::fillRect(x, y, w, h, color);
+        return;
+    }
+    if (!_black)
+        return;
+    int16_t top = max(y, _bandY), bottom = min((int16_t)(y + h), (int16_t)(_bandY + rows()));
+    uint8_t c = ink(color);
+    for (int16_t row = top - _bandY; row < bottom - _bandY; row++)
+        fillSpan(x, x + w - 1, row, c);
+}
+
+// One row already in the planes' format, as GxEPD2's writeImage() takes
+// it: x is rounded down to a byte, panel coordinates whatever the rotation
+void BwrCanvas::drawRow(const uint8_t* black, const uint8_t* red, int16_t x, int16_t y, int16_t w)
+{
+    if (!_black || w <= 0 || y < _bandY || y >= _bandY + (int16_t)rows())
+        return;
+    int16_t first = (x & ~7) / 8, skip = 0;
+    if (first < 0) {
+        skip = -first;
+        first = 0;
+    }
+    int16_t bytes = min((int16_t)((w + 7) / 8 - skip), (int16_t)(stride() - first));
+    if (bytes <= 0)
+        return;
+    addDamage(first * 8, y, bytes * 8, 1, 1); // Whatever the row holds
+    size_t i = (size_t)(y - _bandY) * stride() + first;
+    memcpy(_black + i, black + skip, bytes);
+    memcpy(_red + i, red + skip, bytes);
+}
+
+void BwrCanvas::setFont(const GFXfont* font)
+{
+    selectFont(font, nullptr);
+}
+
+void BwrCanvas::setFont(const RleFont* font)
+{
+    selectFont(nullptr, font);
+}
+
+// Adafruit_GFX::setFont() moves the cursor by 6 rows when switching between
+// the classic font (top-left origin) and a custom one (baseline origin)
+void BwrCanvas::selectFont(const GFXfont* font, const RleFont* rleFont)
+{
+    bool wasCustom = gfxFont || _rleFont;
+    bool isCustom = font || rleFont;
+    if (isCustom && !wasCustom)
+        cursor_y += 6;
+    else if (!isCustom && wasCustom)
+        cursor_y -= 6;
+    gfxFont = (GFXfont*)font;
+    _rleFont = rleFont;
+}
+
+// Adafruit_GFX::write() with the glyph blitted from glyph_cache.h
+size_t BwrCanvas::write(uint8_t c)
+{
+    if (!gfxFont && !_rleFont)
+        return Adafruit_GFX::write(c);
+    bool fast = _black && rotation == 0 && textsize_x == 1 && textsize_y == 1;
+    if (gfxFont && !fast)
+        return Adafruit_GFX::write(c);
+    uint8_t yAdvance = _rleFont ? pgm_read_byte(&_rleFont->yAdvance) : pgm_read_byte(&gfxFont->yAdvance);
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += (int16_t)textsize_y * yAdvance;
+        return 1;
+    }
+    if (c == '\r')
+        return 1;
+    const GlyphCacheEntry* glyph = _rleFont ? glyphCacheGet(_rleFont, c) : glyphCacheGet(gfxFont, c);
+    if (!glyph)
+        return 1;
+    if (glyph->width > 0 && glyph->height > 0) {
+        if (wrap && cursor_x + textsize_x * (glyph->xOffset + glyph->width) > _width) {
+            cursor_x = 0;
+            cursor_y += (int16_t)textsize_y * yAdvance;
+        }
+        if (fast) {
+            int16_t gx = cursor_x + glyph->xOffset, gy = cursor_y + glyph->yOffset;
+            int16_t left = max(gx, (int16_t)0), top = max(gy, _bandY);
+            addDamage(left, top, min((int16_t)(gx + glyph->width), (int16_t)WIDTH) - left,
+                min((int16_t)(gy + glyph->height), (int16_t)(_bandY + rows())) - top, ink(textcolor));
+            glyphCacheBlit(glyph, gx, gy, ink(textcolor), _black, _red, stride(), WIDTH, _bandY, rows());
+        } else {
+            drawGlyphPixels(glyph, textcolor);
+        }
+    }
+    cursor_x += (int16_t)textsize_x * glyph->xAdvance;
+    return 1;
+}
+
+// RleFont glyph when rotated or scaled: pixel by pixel like Adafruit_GFX::drawChar()
+void BwrCanvas::drawGlyphPixels(const GlyphCacheEntry* glyph, uint16_t color)
+{
+    startWrite();
+    for (uint8_t yy = 0; yy < glyph->height; yy++) {
+        const uint8_t* row = glyph->rows + yy * glyph->bytesPerRow;
+        for (uint8_t xx = 0; xx < glyph->width; xx++) {
+            if (!(row[xx / 8] & (0x80 >> (xx & 7))))
+                continue;
+            int16_t px = cursor_x + (glyph->xOffset + xx) * textsize_x;
+            int16_t py = cursor_y + (glyph->yOffset + yy) * textsize_y;
+            if (textsize_x == 1 && textsize_y == 1)
+                writePixel(px, py, color);
+            else
+                writeFillRect(px, py, textsize_x, textsize_y, color);
+        }
+    }
+    endWrite();
+}
+
+// Text bounds for the canvas' current font, GFXfont or RleFont
+void glyphCacheTextBounds(BwrCanvas& canvas, const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+    uint16_t* h)
+{
+    if (canvas.rleFont())
+        glyphCacheTextBounds(canvas.rleFont(), text, x, y, x1, y1, w, h);
+    else
+        glyphCacheTextBounds(canvas, canvas.gfxFontInUse(), text, x, y, x1, y1, w, h);
+}
+
+void glyphCacheTextBounds(BwrCanvas& canvas, const String& text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+    uint16_t* h)
+{
+    glyphCacheTextBounds(canvas, text.c_str(), x, y, x1, y1, w, h);
+}
+
+#endif // BWR_CANVAS_H_
@@ -0,0 +1,154 @@
+#ifndef DAMAGE_H_
+#define DAMAGE_H_
+
+#include <Arduino.h>
+
+// Damage tracking: the areas of a frame that were drawn on.
+//
+// A BwrCanvas given a DamageSet (BwrCanvas::trackDamage()) adds the box of
+// everything it draws in a color other than white, in panel coordinates,
+// clipped to the band being drawn. Outside the set the frame is blank
+// white, so two frames can only differ inside the union of their sets,
+// and a frame only has to be written and compared there.
+//
+// The set holds at most DAMAGE_MAX_RECTS rectangles. A new box that
+// overlaps or comes within DAMAGE_MERGE_GAP pixels of one is merged into
+// it; when the set is full, it goes into the rectangle whose union with
+// it adds the least area. The set is small enough to live in RTC memory.
+
+#define DAMAGE_MAX_RECTS 8
+#define DAMAGE_MERGE_GAP 8 // Boxes this close (px) become one rectangle
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+} DamageRect;
+
+typedef struct {
+    uint8_t count;
+    DamageRect rects[DAMAGE_MAX_RECTS];
+} DamageSet;
+
+// Function declarations
+void damageClear(DamageSet& set);
+void damageAdd(DamageSet& set, int16_t x, int16_t y, int16_t w, int16_t h);
+void damageAddSet(DamageSet& set, const DamageSet& other);
+bool damageRowSpan(const DamageSet& set, int16_t row, int16_t* left, int16_t* right);
+uint32_t damageArea(const DamageSet& set);
+
+// Implementation
+
+namespace {
+
+DamageRect damageUnion(const DamageRect& a, const DamageRect& b)
+{
+    int16_t left = min(a.x, b.x), top = min(a.y, b.y);
+    DamageRect u = { left, top, (int16_t)(max(a.x + a.w, b.x + b.w) - left), (int16_t)(max(a.y + a.h, b.y + b.h) - top) };
+    return u;
+}
+
+bool damageNear(const DamageRect& a, const DamageRect& b)
+{
+    return a.x <= b.x + b.w + DAMAGE_MERGE_GAP && b.x <= a.x + a.w + DAMAGE_MERGE_GAP && a.y <= b.y + b.h + DAMAGE_MERGE_GAP
+        && b.y <= a.y + a.h + DAMAGE_MERGE_GAP;
+}
+
+uint32_t damageRectArea(const DamageRect& r)
+{
+    return (uint32_t)r.w * r.h;
+}
+
+void damageRemove(DamageSet& set, uint8_t i)
+{
+    set.rects[i] = set.rects[--set.count];
+}
+
+} // namespace
+
+void damageClear(DamageSet& set)
+{
+    set.count = 0;
+}
+
+// Adds a box; zero and negative sizes are ignored
+void damageAdd(DamageSet& set, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if (w <= 0 || h <= 0)
+        return;
+    DamageRect box = { x, y, w, h };
+    for (uint8_t i = 0; i < set.count; i++) {
+        const DamageRect& r = set.rects[i];
+        if (x >= r.x && y >= r.y && x + w <= r.x + r.w && y + h <= r.y + r.h)
+            return; // Already covered, the common case for pixels and glyphs
+    }
+    // Swallow every rectangle the growing box comes near
+    for (uint8_t i = 0; i < set.count;) {
+        if (damageNear(box, set.rects[i])) {
+            box = damageUnion(box, set.rects[i]);
+            damageRemove(set, i);
+            i = 0;
+        } else {
+            i++;
+        }
+    }
+    while (set.count == DAMAGE_MAX_RECTS) {
+        uint8_t best = 0;
+        uint32_t bestGrowth = UINT32_MAX;
+        for (uint8_t i = 0; i < set.count; i++) {
+            uint32_t growth = damageRectArea(damageUnion(box, set.rects[i])) - damageRectArea(set.rects[i]);
+            if (growth < bestGrowth) {
+                best = i;
+                bestGrowth = growth;
+            }
+        }
+        box = damageUnion(box, set.rects[best]);
+        damageRemove(set, best);
+        // The bigger box may now reach others
+        for (uint8_t i = 0; i < set.count;) {
+            if (damageNear(box, set.rects[i])) {
+                box = damageUnion(box, set.rects[i]);
+                damageRemove(set, i);
+                i = 0;
+            } else {
+                i++;
+            }
+        }
+    }
+    set.rects[set.count++] = box;
+}
+
+void damageAddSet(DamageSet& set, const DamageSet& other)
+{
+    for (uint8_t i = 0; i < other.count; i++)
+        damageAdd(set, other.rects[i].x, other.rects[i].y, other.rects[i].w, other.rects[i].h);
+}
+
+// Leftmost and rightmost damaged pixel of a row; false when it has none
+bool damageRowSpan(const DamageSet& set, int16_t row, int16_t* left, int16_t* right)
+{
+    bool found = false;
+    for (uint8_t i = 0; i < set.count; i++) {
+        const DamageRect& r = set.rects[i];
+        if (row < r.y || row >= r.y + r.h)
+            continue;
+        if (!found || r.x < *left)
+            *left = r.x;
+        if (!found || r.x + r.w - 1 > *right)
+            *right = r.x + r.w - 1;
+        found = true;
+    }
+    return found;
+}
+
+// Pixels covered; the rectangles never overlap
+uint32_t damageArea(const DamageSet& set)
+{
+    uint32_t area = 0;
+    for (uint8_t i = 0; i < set.count; i++)
+        area += damageRectArea(set.rects[i]);
+    return area;
+}
+
+#endif // DAMAGE_H_
@@ -0,0 +1,188 @@
+#ifndef DASHBOARD_H_
+#define DASHBOARD_H_
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "bwr_canvas.h"
+#include "dashboard_data.h"
+#include "glyph_cache.h"
+#include "icon_cache.h"
+#include "rle_font.h"
+#include "text_layout.h"
+#include "weather_draw_functions.h"
+#include "fonts/rle/CourierCyr9.h"
+#include "fonts/rle/TimesNRCyr12.h"
+#include "fonts/rle/TimesNRCyr18.h"
+
+// On-device dashboard.
+//
+// Instead of a 96 KB frame rendered by the server's headless browser, the
+// device fetches a few hundred bytes of data from the server's /dashboard
+// endpoint (dashboard_data.h) and draws the weather / calendar / events
+// layout of the old standalone sketch (GxEPD2_Example.cpp.bak) itself.
+// Strings are UTF-8 and are drawn through text_layout.h. The calendar and
+// the date come from the device clock.
+//
+// dashboardDraw() only reads the data, so it can be called once per band
+// of a BwrCanvas.
+
+// Function declarations
+void dashboardDraw(BwrCanvas& gfx, const DashboardData& data, const struct tm* now);
+
+// Implementation
+
+namespace {
+
+const char* const DASHBOARD_MONTHS_EN[12] = { "January", "February", "March", "April", "May", "June", "July", "August",
+    "September", "October", "November", "December" };
+const char* const DASHBOARD_MONTHS_RU[12] = { "Январь", "Февраль", "Март", "Апрель", "Май", "Июнь", "Июль", "Август",
+    "Сентябрь", "Октябрь", "Ноябрь", "Декабрь" };
+const char* const DASHBOARD_WEEKDAYS_EN[7] = { "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday" };
+const char* const DASHBOARD_WEEKDAYS_RU[7] = { "Воскресенье", "Понедельник", "Вторник", "Среда", "Четверг", "Пятница", "Суббота" };
+const char* const DASHBOARD_DAY_LETTERS_EN[7] = { "M", "T", "W", "T", "F", "S", "S" };
+const char* const DASHBOARD_DAY_LETTERS_RU[7] = { "П", "В", "С", "Ч", "П", "С", "В" };
+
+// One line of UTF-8 text with its baseline at y, x as per align
+void dashboardLabel(BwrCanvas& gfx, const RleFont* font, const char* text, int16_t x, int16_t y, TextLayoutAlign align = TEXT_LAYOUT_LEFT)
+{
+    char encoded[TEXT_LAYOUT_MAX_CHARS + 1];
+    textLayoutDecodeUtf8(text, encoded, sizeof(encoded));
+    int16_t x1, y1;
+    uint16_t w, h;
+    glyphCacheTextBounds(font, encoded, 0, 0, &x1, &y1, &w, &h);
+    if (align == TEXT_LAYOUT_RIGHT)
+        x -= w + x1;
+    else if (align == TEXT_LAYOUT_CENTER)
+        x -= w / 2 + x1;
+    gfx.setFont(font);
+    gfx.setTextWrap(false);
+    gfx.setCursor(x, y);
+    gfx.print(encoded);
+}
+
+// Temperature with a drawn degree sign (the fonts have none)
+void dashboardTemperature(BwrCanvas& gfx, const RleFont* font, int16_t temp, int16_t centerX, int16_t y, uint8_t radius, uint16_t color)
+{
+    char text[8];
+    snprintf(text, sizeof(text), "%d", temp);
+    int16_t x1, y1;
+    uint16_t w, h;
+    glyphCacheTextBounds(font, text, 0, 0, &x1, &y1, &w, &h);
+    int16_t x = centerX - (w + 2 * radius + 3) / 2 - x1;
+    gfx.setTextColor(color);
+    dashboardLabel(gfx, font, text, x, y);
+    gfx.drawCircle(x + x1 + w + radius + 3, y + y1 + radius, radius, color);
+}
+
+void dashboardWeather(BwrCanvas& gfx, const DashboardData& data)
+{
+    gfx.setTextColor(GxEPD_BLACK);
+    dashboardLabel(gfx, &TimesNRCyr12pt8bRle, data.city, 200, 40, TEXT_LAYOUT_CENTER);
+    dashboardTemperature(gfx, &TimesNRCyr18pt8bRle, data.temp, 200, 120, 5, GxEPD_RED);
+    gfx.setTextColor(GxEPD_BLACK);
+    iconCacheDraw(gfx, 200, 170, data.icon, LargeIcon);
+    gfx.setFont(&TimesNRCyr12pt8bRle);
+    textLayoutDraw(gfx, textLayout(&TimesNRCyr12pt8bRle, data.description, 360, 2), 200, 220, TEXT_LAYOUT_CENTER);
+}
+
+void dashboardDate(BwrCanvas& gfx, const DashboardData& data, const struct tm& now)
+{
+    char date[16];
+    strftime(date, sizeof(date), "%d.%m.%Y", &now);
+    gfx.setTextColor(GxEPD_BLACK);
+    dashboardLabel(gfx, &TimesNRCyr12pt8bRle, date, 200, 300, TEXT_LAYOUT_CENTER);
+    const char* weekday = (data.russian ? DASHBOARD_WEEKDAYS_RU : DASHBOARD_WEEKDAYS_EN)[now.tm_wday % 7];
+    dashboardLabel(gfx, &TimesNRCyr12pt8bRle, weekday, 200, 330, TEXT_LAYOUT_CENTER);
+}
+
+void dashboardForecast(BwrCanvas& gfx, const DashboardData& data)
+{
+    gfx.fillRect(20, 380, 360, 2, GxEPD_BLACK);
+    gfx.setTextColor(GxEPD_RED);
+    dashboardLabel(gfx, &TimesNRCyr12pt8bRle, data.russian ? "Прогноз" : "Forecast", 200, 405, TEXT_LAYOUT_CENTER);
+    gfx.setTextColor(GxEPD_BLACK);
+    gfx.fillRect(20, 415, 360, 2, GxEPD_BLACK);
+
+    for (uint8_t i = 0; i < data.forecastCount; i++) {
+        const DashboardForecast& day = data.forecast[i];
+        int16_t center = 20 + 36 + i * 72;
+        char text[4];
+        snprintf(text, sizeof(text), "%u", day.day);
+        dashboardLabel(gfx, &CourierCyr9pt8bRle, text, center, 436, TEXT_LAYOUT_CENTER);
+        iconCacheDraw(gfx, center, 451, day.icon, SmallIcon);
+        dashboardTemperature(gfx, &CourierCyr9pt8bRle, day.temp, center, 474, 2, GxEPD_BLACK);
+    }
+}
+
+void dashboardCalendar(BwrCanvas& gfx, const DashboardData& data, const struct tm& now)
+{
+    gfx.setTextColor(GxEPD_RED);
+    const char* month = (data.russian ? DASHBOARD_MONTHS_RU : DASHBOARD_MONTHS_EN)[now.tm_mon % 12];
+    dashboardLabel(gfx, &TimesNRCyr12pt8bRle, month, 600, 40, TEXT_LAYOUT_CENTER);
+    gfx.setTextColor(GxEPD_BLACK);
+    gfx.fillRect(420, 60, 360, 2, GxEPD_BLACK);
+
+    const char* const* letters = data.russian ? DASHBOARD_DAY_LETTERS_RU : DASHBOARD_DAY_LETTERS_EN;
+    for (uint8_t i = 0; i < 7; i++) {
+        if (i >= 5)
+            gfx.setTextColor(GxEPD_RED);
+        dashboardLabel(gfx, &CourierCyr9pt8bRle, letters[i], 430 + i * 50, 85, TEXT_LAYOUT_CENTER);
+    }
+    gfx.setTextColor(GxEPD_BLACK);
+
+    int year = now.tm_year + 1900;
+    static const uint8_t DAYS_IN_MONTH[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    uint8_t days = DAYS_IN_MONTH[now.tm_mon % 12];
+    if (now.tm_mon == 1 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0))
+        days = 29;
+    // Monday-first column of the 1st, from today's weekday
+    uint8_t firstColumn = ((now.tm_wday + 6) % 7 + 35 - (now.tm_mday - 1) % 35) % 7;
+
+    for (uint8_t day = 1; day <= days; day++) {
+        uint8_t cell = firstColumn + day - 1;
+        int16_t x = 430 + (cell % 7) * 50;
+        int16_t y = 115 + (cell / 7) * 25;
+        char text[4];
+        snprintf(text, sizeof(text), "%u", day);
+        dashboardLabel(gfx, &CourierCyr9pt8bRle, text, x, y, TEXT_LAYOUT_CENTER);
+        if (day == now.tm_mday)
+            gfx.drawRect(x - 15, y - 16, 30, 21, GxEPD_RED);
+    }
+}
+
+void dashboardEvents(BwrCanvas& gfx, const DashboardData& data)
+{
+    gfx.fillRect(420, 265, 360, 2, GxEPD_BLACK);
+    gfx.setTextColor(GxEPD_RED);
+    dashboardLabel(gfx, &TimesNRCyr12pt8bRle, data.russian ? "События" : "Events", 600, 290, TEXT_LAYOUT_CENTER);
+    gfx.setTextColor(GxEPD_BLACK);
+    gfx.fillRect(420, 300, 360, 2, GxEPD_BLACK);
+
+    for (uint8_t i = 0; i < data.eventCount; i++) {
+        const DashboardEvent& event = data.events[i];
+        int16_t y = 330 + i * 38;
+        dashboardLabel(gfx, &CourierCyr9pt8bRle, event.time, 420, y);
+        gfx.setFont(&CourierCyr9pt8bRle);
+        textLayoutDraw(gfx, textLayout(&CourierCyr9pt8bRle, event.title, 290, 1), 490, y);
+    }
+}
+
+} // namespace
+
+// Draws the whole dashboard into the canvas' current band; without a valid
+// clock (now == nullptr) the date and the calendar are left out
+void dashboardDraw(BwrCanvas& gfx, const DashboardData& data, const struct tm* now)
+{
+    gfx.fillScreen(GxEPD_WHITE);
+    dashboardWeather(gfx, data);
+    dashboardForecast(gfx, data);
+    dashboardEvents(gfx, data);
+    if (now) {
+        dashboardDate(gfx, data, *now);
+        dashboardCalendar(gfx, data, *now);
+    }
+    gfx.fillRect(398, 0, 4, 480, GxEPD_BLACK);
+}
+
+#endif // DASHBOARD_H_
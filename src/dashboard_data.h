@@ -0,0 +1,209 @@
+#ifndef DASHBOARD_DATA_H_
+#define DASHBOARD_DATA_H_
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "wx_icon.h"
+
+// Data shown by the on-device dashboard (dashboard.h) and the two forms the
+// server's /dashboard endpoint sends it in.
+//
+// JSON, parsed through an ArduinoJson document:
+//   {"v":1,"lang":"ru","city":"Минск","temp":-3,"desc":"пасмурно","icon":"04d",
+//    "fc":[{"day":21,"temp":-1,"icon":"13d"},...],"ev":[{"time":"14:00","title":"Встреча"},...]}
+//
+// /dashboard?format=bin, a binary record that dashboardReadRecord() streams
+// straight into DashboardData without touching the heap (little-endian,
+// str = u8 byte length + UTF-8):
+//   0  'W' 'X'     magic
+//   2  u8          version, DASHBOARD_PAYLOAD_VERSION
+//   3  u8          flags, bit 0: Russian
+//   4  i8          temperature, °C
+//   5  char[3]     icon code
+//   8  u8          forecast days N
+//   9  u8          events M
+//  10  str city, str description
+//      N x { u8 day of month, i8 temperature, char[3] icon code }
+//      M x { char[5] time, str title }
+// Both parsers cut strings longer than their field at a character boundary
+// and drop forecast days and events beyond the arrays.
+
+#define DASHBOARD_PAYLOAD_VERSION 1 // Must match DASHBOARD_VERSION in server.js
+#define DASHBOARD_MAX_PAYLOAD 2048
+#define DASHBOARD_FORECAST_DAYS 5
+#define DASHBOARD_MAX_EVENTS 4
+#define DASHBOARD_RECORD_MAGIC0 'W'
+#define DASHBOARD_RECORD_MAGIC1 'X'
+#define DASHBOARD_RECORD_RUSSIAN 0x01
+
+typedef struct {
+    uint8_t day; // Day of month
+    int8_t temp; // °C
+    uint8_t icon; // wxIconParse() of the OpenWeatherMap code, e.g. "04d"
+} DashboardForecast;
+
+typedef struct {
+    char time[6]; // "14:00"
+    char title[96];
+} DashboardEvent;
+
+typedef struct {
+    bool russian;
+    char city[32];
+    int16_t temp;
+    char description[128];
+    uint8_t icon; // wxIconParse()
+    uint8_t forecastCount;
+    DashboardForecast forecast[DASHBOARD_FORECAST_DAYS];
+    uint8_t eventCount;
+    DashboardEvent events[DASHBOARD_MAX_EVENTS];
+} DashboardData;
+
+// Function declarations
+bool dashboardParseJson(const char* json, size_t length, DashboardData& data);
+bool dashboardReadRecord(Stream& in, DashboardData& data);
+
+// Implementation
+
+namespace {
+
+// Copies text, cutting it at a character boundary if it does not fit
+void dashboardCopy(char* out, size_t size, const char* text)
+{
+    if (!text)
+        text = "";
+    size_t length = strlen(text);
+    if (length >= size) {
+        length = size - 1;
+        while (length > 0 && ((uint8_t)text[length] & 0xC0) == 0x80)
+            length--;
+    }
+    memcpy(out, text, length);
+    out[length] = 0;
+}
+
+bool dashboardReadByte(Stream& in, uint8_t& value)
+{
+    int c = in.read();
+    value = (uint8_t)c;
+    return c >= 0;
+}
+
+// Fixed-size field such as an icon code, zero-terminated in out
+bool dashboardReadChars(Stream& in, char* out, size_t length)
+{
+    out[length] = 0;
+    return in.readBytes(out, length) == length;
+}
+
+// Length-prefixed string; what does not fit into out is skipped
+bool dashboardReadString(Stream& in, char* out, size_t size)
+{
+    uint8_t length;
+    if (!dashboardReadByte(in, length))
+        return false;
+    size_t keep = length < size ? length : size - 1;
+    if (in.readBytes(out, keep) != keep)
+        return false;
+    if (keep < length) {
+        uint8_t next;
+        if (!dashboardReadByte(in, next))
+            return false;
+        for (size_t i = keep + 1; i < length; i++) {
+            if (in.read() < 0)
+                return false;
+        }
+        // Drop a character split by the cut
+        while (keep > 0 && (next & 0xC0) == 0x80) {
+            next = (uint8_t)out[--keep];
+            out[keep] = 0;
+        }
+    }
+    out[keep] = 0;
+    return true;
+}
+
+} // namespace
+
+// Parses the /dashboard payload; false if it is not valid JSON of this version
+bool dashboardParseJson(const char* json, size_t length, DashboardData& data)
+{
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, json, length);
+    if (error) {
+        Serial.printf("Dashboard payload: %s\n", error.c_str());
+        return false;
+    }
+    if ((doc["v"] | 0) != DASHBOARD_PAYLOAD_VERSION) {
+        Serial.printf("Dashboard payload: version %d, expected %d\n", doc["v"] | 0, DASHBOARD_PAYLOAD_VERSION);
+        return false;
+    }
+
+    memset(&data, 0, sizeof(data));
+    data.russian = strcmp(doc["lang"] | "en", "ru") == 0;
+    dashboardCopy(data.city, sizeof(data.city), doc["city"] | "");
+    data.temp = doc["temp"] | 0;
+    dashboardCopy(data.description, sizeof(data.description), doc["desc"] | "");
+    data.icon = wxIconParse(doc["icon"] | "");
+    for (JsonObject day : doc["fc"].as<JsonArray>()) {
+        if (data.forecastCount == DASHBOARD_FORECAST_DAYS)
+            break;
+        DashboardForecast& forecast = data.forecast[data.forecastCount++];
+        forecast.day = day["day"] | 0;
+        forecast.temp = day["temp"] | 0;
+        forecast.icon = wxIconParse(day["icon"] | "");
+    }
+    for (JsonObject item : doc["ev"].as<JsonArray>()) {
+        if (data.eventCount == DASHBOARD_MAX_EVENTS)
+            break;
+        DashboardEvent& event = data.events[data.eventCount++];
+        dashboardCopy(event.time, sizeof(event.time), item["time"] | "");
+        dashboardCopy(event.title, sizeof(event.title), item["title"] | "");
+    }
+    return true;
+}
+
+// Reads a /dashboard?format=bin record from in; false if it is truncated
+// or not of this version. Uses no heap.
+bool dashboardReadRecord(Stream& in, DashboardData& data)
+{
+    uint8_t header[5];
+    if (in.readBytes((char*)header, sizeof(header)) != sizeof(header) || header[0] != DASHBOARD_RECORD_MAGIC0
+        || header[1] != DASHBOARD_RECORD_MAGIC1) {
+        Serial.println("Dashboard record: bad header");
+        return false;
+    }
+    if (header[2] != DASHBOARD_PAYLOAD_VERSION) {
+        Serial.printf("Dashboard record: version %u, expected %d\n", header[2], DASHBOARD_PAYLOAD_VERSION);
+        return false;
+    }
+
+    memset(&data, 0, sizeof(data));
+    data.russian = header[3] & DASHBOARD_RECORD_RUSSIAN;
+    data.temp = (int8_t)header[4];
+    uint8_t forecastCount, eventCount;
+    char icon[4] = "";
+    bool ok = dashboardReadChars(in, icon, 3) && dashboardReadByte(in, forecastCount) && dashboardReadByte(in, eventCount)
+        && dashboardReadString(in, data.city, sizeof(data.city))
+        && dashboardReadString(in, data.description, sizeof(data.description));
+    data.icon = wxIconParse(icon);
+    for (uint8_t i = 0; ok && i < forecastCount; i++) {
+        DashboardForecast spare;
+        DashboardForecast& forecast = data.forecastCount < DASHBOARD_FORECAST_DAYS ? data.forecast[data.forecastCount++] : spare;
+        uint8_t temp = 0;
+        ok = dashboardReadByte(in, forecast.day) && dashboardReadByte(in, temp) && dashboardReadChars(in, icon, 3);
+        forecast.temp = (int8_t)temp;
+        forecast.icon = wxIconParse(icon);
+    }
+    for (uint8_t i = 0; ok && i < eventCount; i++) {
+        DashboardEvent spare;
+        DashboardEvent& event = data.eventCount < DASHBOARD_MAX_EVENTS ? data.events[data.eventCount++] : spare;
+        ok = dashboardReadChars(in, event.time, 5) && dashboardReadString(in, event.title, sizeof(event.title));
+    }
+    if (!ok)
+        Serial.println("Dashboard record: truncated");
+    return ok;
+}
+
+#endif // DASHBOARD_DATA_H_
@@ -0,0 +1,195 @@
+#ifndef DOWNLOAD_RESUME_H_
+#define DOWNLOAD_RESUME_H_
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <mbedtls/sha1.h>
+#include <time.h>
+
+// Resume state for a download whose body stalled.
+//
+// The render API tags every frame with X-Frame-Id (a content hash) and
+// X-Frame-Length (uncompressed size) and keeps it cached under
+// /frame/<id>. When a transfer breaks off, the bytes already on flash are
+// moved to /partial.bin and described in /partial.idx; the next attempt
+// asks for "Range: bytes=<have>-" of that frame instead of starting over.
+//
+// Because the URL names the content hash, the appended bytes always belong
+// to the same frame. A gzip transfer resumes fine too: what reached the
+// file is an inflated prefix of the frame, and /frame/<id> is uncompressed.
+//
+// The assembled file is still checked before it replaces the target: its
+// length against X-Frame-Length and its SHA-1 against the id, which is the
+// first 16 hex digits of the hash. A file that fails either is deleted.
+
+#define DOWNLOAD_RESUME_MAGIC 0x31534552 // "RES1"
+#define DOWNLOAD_RESUME_FILE "/partial.bin"
+#define DOWNLOAD_RESUME_META "/partial.idx"
+#define DOWNLOAD_RESUME_MAX_AGE_SEC (30 * 60) // Older partials are likely outdated content
+#define DOWNLOAD_RESUME_ID_BYTES 8 // Hash bytes in the frame id
+#define DOWNLOAD_RESUME_HASH_CHUNK 1024
+
+typedef struct {
+    uint32_t magic;
+    uint32_t totalSize; // X-Frame-Length
+    uint32_t savedAt; // time() when the partial was kept
+    char target[24]; // File the download was meant for
+    char frameUrl[128]; // <server>/frame/<id>
+} DownloadResume;
+
+// Function declarations
+bool downloadResumeSave(const char* partialFile, const char* target, const String& frameUrl, uint32_t totalSize);
+bool downloadResumeLoad(const char* target, DownloadResume& resume, uint32_t& haveBytes);
+bool downloadResumeVerify(const DownloadResume& resume);
+bool downloadResumeFinish(const char* target);
+void downloadResumeClear();
+
+// Implementation
+
+namespace {
+
+int downloadResumeHexDigit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// The hash prefix named by the last path segment of frameUrl
+bool downloadResumeFrameId(const DownloadResume& resume, uint8_t id[DOWNLOAD_RESUME_ID_BYTES])
+{
+    const char* slash = strrchr(resume.frameUrl, '/');
+    if (!slash || strlen(slash + 1) != 2 * DOWNLOAD_RESUME_ID_BYTES)
+        return false;
+    for (uint8_t i = 0; i < DOWNLOAD_RESUME_ID_BYTES; i++) {
+        int high = downloadResumeHexDigit(slash[1 + 2 * i]);
+        int low = downloadResumeHexDigit(slash[2 + 2 * i]);
+        if (high < 0 || low < 0)
+            return false;
+        id[i] = (uint8_t)(high << 4 | low);
+    }
+    return true;
+}
+
+} // namespace
+
+// Keeps partialFile for a later resume. On failure the partial is dropped.
+bool downloadResumeSave(const char* partialFile, const char* target, const String& frameUrl, uint32_t totalSize)
+{
+    DownloadResume resume;
+    memset(&resume, 0, sizeof(resume));
+    resume.magic = DOWNLOAD_RESUME_MAGIC;
+    resume.totalSize = totalSize;
+    resume.savedAt = (uint32_t)time(nullptr);
+    if (strlen(target) >= sizeof(resume.target) || frameUrl.length() >= sizeof(resume.frameUrl)) {
+        SPIFFS.remove(partialFile);
+        return false;
+    }
+    strcpy(resume.target, target);
+    strcpy(resume.frameUrl, frameUrl.c_str());
+
+    if (strcmp(partialFile, DOWNLOAD_RESUME_FILE) != 0) {
+        SPIFFS.remove(DOWNLOAD_RESUME_FILE);
+        if (!SPIFFS.rename(partialFile, DOWNLOAD_RESUME_FILE)) {
+            SPIFFS.remove(partialFile);
+            return false;
+        }
+    }
+
+    File file = SPIFFS.open(DOWNLOAD_RESUME_META, FILE_WRITE);
+    bool written = file && file.write((const uint8_t*)&resume, sizeof(resume)) == sizeof(resume);
+    if (file)
+        file.close();
+    if (!written) {
+        downloadResumeClear();
+        return false;
+    }
+    Serial.printf("Resume: kept partial download for %s, %lu bytes total\n", target, (unsigned long)totalSize);
+    return true;
+}
+
+// Finds a usable partial for target; haveBytes is how much of it is on flash
+bool downloadResumeLoad(const char* target, DownloadResume& resume, uint32_t& haveBytes)
+{
+    File file = SPIFFS.open(DOWNLOAD_RESUME_META, FILE_READ);
+    if (!file)
+        return false;
+    size_t bytesRead = file.read((uint8_t*)&resume, sizeof(resume));
+    file.close();
+    if (bytesRead != sizeof(resume) || resume.magic != DOWNLOAD_RESUME_MAGIC || strcmp(resume.target, target) != 0)
+        return false;
+
+    uint32_t now = (uint32_t)time(nullptr);
+    if (now < resume.savedAt || now - resume.savedAt > DOWNLOAD_RESUME_MAX_AGE_SEC) {
+        Serial.println("Resume: partial download is too old, discarding");
+        downloadResumeClear();
+        return false;
+    }
+
+    File partial = SPIFFS.open(DOWNLOAD_RESUME_FILE, FILE_READ);
+    haveBytes = partial ? partial.size() : 0;
+    if (partial)
+        partial.close();
+    if (haveBytes == 0 || haveBytes >= resume.totalSize) {
+        downloadResumeClear();
+        return false;
+    }
+    return true;
+}
+
+// Whether the partial on flash is the whole frame resume describes; the
+// caller deletes one that is not
+bool downloadResumeVerify(const DownloadResume& resume)
+{
+    uint8_t id[DOWNLOAD_RESUME_ID_BYTES];
+    if (!downloadResumeFrameId(resume, id))
+        return false;
+    File file = SPIFFS.open(DOWNLOAD_RESUME_FILE, FILE_READ);
+    if (!file)
+        return false;
+    if (file.size() != resume.totalSize) {
+        file.close();
+        return false;
+    }
+
+    uint8_t buffer[DOWNLOAD_RESUME_HASH_CHUNK];
+    uint8_t hash[20];
+    mbedtls_sha1_context sha;
+    mbedtls_sha1_init(&sha);
+    mbedtls_sha1_starts(&sha);
+    uint32_t hashed = 0;
+    while (hashed < resume.totalSize) {
+        size_t bytesRead = file.read(buffer, sizeof(buffer));
+        if (bytesRead == 0)
+            break;
+        mbedtls_sha1_update(&sha, buffer, bytesRead);
+        hashed += bytesRead;
+    }
+    file.close();
+    mbedtls_sha1_finish(&sha, hash);
+    mbedtls_sha1_free(&sha);
+    return hashed == resume.totalSize && memcmp(hash, id, sizeof(id)) == 0;
+}
+
+// Moves a completed partial into place, once downloadResumeVerify() passed
+bool downloadResumeFinish(const char* target)
+{
+    SPIFFS.remove(target);
+    bool ok = SPIFFS.rename(DOWNLOAD_RESUME_FILE, target);
+    SPIFFS.remove(DOWNLOAD_RESUME_META);
+    return ok;
+}
+
+void downloadResumeClear()
+{
+    if (SPIFFS.exists(DOWNLOAD_RESUME_META))
+        SPIFFS.remove(DOWNLOAD_RESUME_META);
+    if (SPIFFS.exists(DOWNLOAD_RESUME_FILE))
+        SPIFFS.remove(DOWNLOAD_RESUME_FILE);
+}
+
+#endif // DOWNLOAD_RESUME_H_
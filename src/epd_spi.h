@@ -0,0 +1,202 @@
+#ifndef EPD_SPI_H_
+#define EPD_SPI_H_
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <SPIFFS.h>
+
+// SPI bus for the e-paper panel.
+//
+// The panel gets its own SPIClass on the FSPI host. GPIO 11/12 are FSPI's
+// IO_MUX pins on the S3 (FSPID/FSPICLK), so the clock is not limited by the
+// GPIO matrix. GxEPD2 drives CS and DC itself; its own SPI.begin() in
+// init() is a no-op once the bus has been started with our pins.
+//
+// The UC8179 only specifies 10 MHz for writes, but most panels and short
+// wires take more. epdSpiCalibrate() finds the fastest clock this unit
+// accepts. The panel's MISO is not wired, so nothing can be read back.
+// Instead every probe writes a data burst at the test clock and then the
+// POWER ON command; the controller only pulls BUSY for the expected
+// booster time when the command byte arrived intact after the burst. That
+// proves the command path only: the burst's pixel data cannot be read back,
+// so a clock that corrupts data bytes may still pass. The calibration
+// therefore keeps one step below the fastest passing clock, in /spi.cfg for
+// later boots.
+//
+// epdSpiSetTemperature() makes the controller use a given temperature
+// instead of its own sensor's when it loads the waveform for a refresh.
+
+#define EPD_SPI_CLOCK_MIN 4000000
+#define EPD_SPI_CLOCK_MAX 20000000
+#define EPD_SPI_CONFIG_MAGIC 0x31495053 // "SPI1"
+#define EPD_SPI_CONFIG_FILE "/spi.cfg"
+#define EPD_SPI_PROBE_ROUNDS 5
+#define EPD_SPI_PROBE_BURST 4000 // Bytes written before each POWER ON (about 33 rows)
+
+// Clocks tried by the calibration, slowest first (80 MHz APB divisors)
+const uint32_t EPD_SPI_CALIBRATION_CLOCKS[] = { 4000000, 5000000, 8000000, 10000000, 16000000, 20000000 };
+
+typedef struct {
+    uint32_t magic;
+    uint32_t clockHz;
+} EpdSpiConfig;
+
+// Function declarations
+void epdSpiBegin(SPIClass& spi, int8_t sck, int8_t mosi);
+uint32_t epdSpiClockLoad(uint32_t defaultHz);
+bool epdSpiClockSave(uint32_t clockHz);
+bool epdSpiProbe(SPIClass& spi, uint32_t clockHz, int8_t cs, int8_t dc, int8_t busy);
+uint32_t epdSpiCalibrate(SPIClass& spi, int8_t cs, int8_t dc, int8_t busy);
+void epdSpiSetTemperature(SPIClass& spi, uint32_t clockHz, int8_t cs, int8_t dc, int8_t celsius);
+
+// Implementation
+
+void epdSpiBegin(SPIClass& spi, int8_t sck, int8_t mosi)
+{
+    spi.begin(sck, -1, mosi, -1); // Write-only, CS is a GPIO owned by GxEPD2
+}
+
+// Saved calibration result, or defaultHz
+uint32_t epdSpiClockLoad(uint32_t defaultHz)
+{
+    EpdSpiConfig config;
+    File file = SPIFFS.open(EPD_SPI_CONFIG_FILE, FILE_READ);
+    if (!file)
+        return defaultHz;
+    size_t bytesRead = file.read((uint8_t*)&config, sizeof(config));
+    file.close();
+    if (bytesRead != sizeof(config) || config.magic != EPD_SPI_CONFIG_MAGIC || config.clockHz < EPD_SPI_CLOCK_MIN
+        || config.clockHz > EPD_SPI_CLOCK_MAX)
+        return defaultHz;
+    return config.clockHz;
+}
+
+bool epdSpiClockSave(uint32_t clockHz)
+{
+    EpdSpiConfig config = { EPD_SPI_CONFIG_MAGIC, clockHz };
+    File file = SPIFFS.open(EPD_SPI_CONFIG_FILE, FILE_WRITE);
+    if (!file)
+        return false;
+    bool ok = file.write((const uint8_t*)&config, sizeof(config)) == sizeof(config);
+    file.close();
+    return ok;
+}
+
+namespace {
+
+void epdSpiCommand(SPIClass& spi, int8_t cs, int8_t dc, uint8_t command)
+{
+    digitalWrite(dc, LOW);
+    digitalWrite(cs, LOW);
+    spi.transfer(command);
+    digitalWrite(cs, HIGH);
+    digitalWrite(dc, HIGH);
+}
+
+void epdSpiData(SPIClass& spi, int8_t cs, uint8_t data)
+{
+    digitalWrite(cs, LOW);
+    spi.transfer(data);
+    digitalWrite(cs, HIGH);
+}
+
+// Time BUSY (active LOW) stays asserted, or 0 if it never asserted
+uint32_t epdSpiBusyMs(int8_t busy, uint32_t timeoutMs)
+{
+    uint32_t start = millis();
+    while (digitalRead(busy) != LOW) {
+        if (millis() - start > 5)
+            return 0;
+    }
+    while (digitalRead(busy) == LOW) {
+        if (millis() - start > timeoutMs)
+            return 0;
+        delay(1);
+    }
+    return millis() - start;
+}
+
+} // namespace
+
+// One clock is reliable when every round's POWER ON and POWER OFF, sent
+// right after a burst at that clock, produce a plausible BUSY pulse
+bool epdSpiProbe(SPIClass& spi, uint32_t clockHz, int8_t cs, int8_t dc, int8_t busy)
+{
+    static const uint8_t powerSetting[] = { 0x07, 0x07, 0x3f, 0x3f }; // As GxEPD2_750c_Z08::_InitDisplay
+    uint8_t burst[64];
+    uint32_t burstUs = 0;
+    for (uint8_t round = 0; round < EPD_SPI_PROBE_ROUNDS; round++) {
+        spi.beginTransaction(SPISettings(clockHz, MSBFIRST, SPI_MODE0));
+        // Alternating and walking bit patterns into the black plane RAM
+        epdSpiCommand(spi, cs, dc, 0x10);
+        digitalWrite(cs, LOW);
+        uint32_t start = micros();
+        for (uint16_t sent = 0; sent < EPD_SPI_PROBE_BURST; sent += sizeof(burst)) {
+            for (uint8_t i = 0; i < sizeof(burst); i++)
+                burst[i] = (i & 1) ? 0x55 : (uint8_t)(0x80 >> ((i / 2 + round) & 7));
+            spi.writeBytes(burst, sizeof(burst));
+        }
+        burstUs += micros() - start;
+        digitalWrite(cs, HIGH);
+        epdSpiCommand(spi, cs, dc, 0x01);
+        digitalWrite(cs, LOW);
+        spi.writeBytes(powerSetting, sizeof(powerSetting));
+        digitalWrite(cs, HIGH);
+        epdSpiCommand(spi, cs, dc, 0x04);
+        spi.endTransaction();
+        uint32_t powerOnMs = epdSpiBusyMs(busy, 1000);
+
+        spi.beginTransaction(SPISettings(clockHz, MSBFIRST, SPI_MODE0));
+        epdSpiCommand(spi, cs, dc, 0x02);
+        spi.endTransaction();
+        uint32_t powerOffMs = epdSpiBusyMs(busy, 500);
+
+        // Datasheet timings: power on about 155 ms, power off about 34 ms
+        if (powerOnMs < 50 || powerOffMs < 10) {
+            Serial.printf("SPI probe %lu Hz: round %u failed (power on %lu ms, power off %lu ms)\n", (unsigned long)clockHz, round,
+                (unsigned long)powerOnMs, (unsigned long)powerOffMs);
+            return false;
+        }
+    }
+    uint32_t bytes = EPD_SPI_PROBE_ROUNDS * EPD_SPI_PROBE_BURST;
+    Serial.printf("SPI probe %lu Hz: ok, %lu bytes in %lu us (%lu kB/s)\n", (unsigned long)clockHz, (unsigned long)bytes,
+        (unsigned long)burstUs, burstUs ? (unsigned long)(bytes * 1000ULL / burstUs) : 0UL);
+    return true;
+}
+
+// Raises the clock until a probe fails and saves the step below the last
+// one that passed (the slowest clock if only that passed), as a margin for
+// the data bytes the probe cannot check.
+// Run after display.init() so the pins are set up and the panel was reset.
+uint32_t epdSpiCalibrate(SPIClass& spi, int8_t cs, int8_t dc, int8_t busy)
+{
+    const uint8_t steps = sizeof(EPD_SPI_CALIBRATION_CLOCKS) / sizeof(EPD_SPI_CALIBRATION_CLOCKS[0]);
+    uint8_t passed = 0;
+    while (passed < steps && epdSpiProbe(spi, EPD_SPI_CALIBRATION_CLOCKS[passed], cs, dc, busy))
+        passed++;
+    if (passed == 0) {
+        Serial.println("SPI calibration: panel did not respond at any clock, keeping the saved setting");
+        return 0;
+    }
+    uint32_t best = EPD_SPI_CALIBRATION_CLOCKS[passed > 1 ? passed - 2 : 0];
+    Serial.printf("SPI calibration: fastest passing clock %lu Hz, using %lu Hz\n",
+        (unsigned long)EPD_SPI_CALIBRATION_CLOCKS[passed - 1], (unsigned long)best);
+    if (!epdSpiClockSave(best))
+        Serial.println("SPI calibration: failed to save " EPD_SPI_CONFIG_FILE);
+    return best;
+}
+
+// Fixes the waveform temperature until the next reset: CCSET (0xE0) with
+// TSFIX, then the value in TSSET (0xE5), whole °C in two's complement.
+// Run after display.init(), which resets the controller.
+void epdSpiSetTemperature(SPIClass& spi, uint32_t clockHz, int8_t cs, int8_t dc, int8_t celsius)
+{
+    spi.beginTransaction(SPISettings(clockHz, MSBFIRST, SPI_MODE0));
+    epdSpiCommand(spi, cs, dc, 0xE0);
+    epdSpiData(spi, cs, 0x02);
+    epdSpiCommand(spi, cs, dc, 0xE5);
+    epdSpiData(spi, cs, (uint8_t)celsius);
+    spi.endTransaction();
+}
+
+#endif // EPD_SPI_H_
@@ -0,0 +1,328 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr10.h, do not edit.
+// 162 glyphs (0 sharing another's bitmap), 1795 bytes of bitmap data (GFXfont: 2068)
+#ifndef COURIERCYR10PT8BRLE_H_
+#define COURIERCYR10PT8BRLE_H_
+
+const uint8_t CourierCyr10pt8bRleData[] PROGMEM = {
+  0x11, 0xF5, 0x11, 0x36, 0xDE, 0xF7, 0xB9, 0x80, 0x24, 0x24, 0x24, 0x24,
+  0xFF, 0x24, 0x24, 0x24, 0xFF, 0x24, 0x24, 0x24, 0x44, 0x44, 0x10, 0x10,
+  0x7F, 0xC2, 0x82, 0x80, 0x40, 0x38, 0x06, 0x01, 0x81, 0x82, 0xFC, 0x10,
+  0x10, 0x10, 0x78, 0xCC, 0x84, 0x84, 0xCC, 0x7B, 0x0C, 0x30, 0xDE, 0x21,
+  0x21, 0x31, 0x1E, 0x1C, 0x08, 0x82, 0x00, 0x80, 0x10, 0x06, 0x06, 0x9A,
+  0x34, 0x86, 0x31, 0x87, 0x9C, 0x0A, 0x34, 0x44, 0x88, 0x88, 0x88, 0x44,
+  0x23, 0xC4, 0x22, 0x11, 0x11, 0x11, 0x22, 0x4C, 0x10, 0x10, 0xD3, 0x3C,
+  0x28, 0x2C, 0x46, 0x31, 0xF5, 0x31, 0x71, 0x4F, 0x90, 0x69, 0x68, 0xFF,
+  0x09, 0x61, 0x52, 0xF3, 0x2B, 0x2B, 0x2B, 0x2F, 0x32, 0xC0, 0x3C, 0x42,
+  0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x66, 0x3C, 0x23,
+  0x34, 0x42, 0xFF, 0xFF, 0xA4, 0x13, 0x39, 0x8A, 0x08, 0x10, 0x20, 0x41,
+  0x04, 0x10, 0x41, 0x0C, 0x1F, 0xE0, 0x14, 0x26, 0x11, 0x42, 0xF4, 0x23,
+  0x34, 0x36, 0x2E, 0x14, 0x81, 0x42, 0x52, 0xD2, 0x52, 0xD2, 0xF0, 0x41,
+  0x71, 0x2A, 0x31, 0x20, 0x17, 0x36, 0xF7, 0x44, 0x62, 0x24, 0x2F, 0xC1,
+  0x6A, 0x10, 0x0F, 0x30, 0x60, 0x40, 0xC0, 0x80, 0x9C, 0xE2, 0x81, 0x81,
+  0x81, 0x42, 0x3C, 0x08, 0x15, 0x11, 0x81, 0xC2, 0xF6, 0x2D, 0x2F, 0x40,
+  0x3C, 0x42, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x42,
+  0x3C, 0x3C, 0x46, 0x83, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x01, 0x02, 0x06,
+  0x0C, 0xF0, 0x09, 0x69, 0x77, 0x70, 0x00, 0x66, 0x4C, 0x91, 0x63, 0x52,
+  0x62, 0x62, 0xA2, 0xA2, 0xA2, 0xA2, 0x09, 0xFC, 0x90, 0x01, 0xA3, 0xA2,
+  0xA2, 0xA2, 0x62, 0x62, 0x62, 0x62, 0x80, 0x79, 0x0E, 0x08, 0x10, 0x47,
+  0x00, 0x00, 0x30, 0xE0, 0xC0, 0x1E, 0x31, 0x90, 0x50, 0x28, 0x14, 0x7A,
+  0x45, 0x42, 0xA3, 0x4E, 0xD0, 0x0C, 0x43, 0xD0, 0x25, 0x73, 0xB4, 0xF4,
+  0x2E, 0x27, 0x46, 0x83, 0x2F, 0x32, 0x11, 0x12, 0x42, 0x11, 0xFF, 0x08,
+  0x62, 0x08, 0x82, 0x21, 0x0F, 0x82, 0x18, 0x81, 0x20, 0x48, 0x3F, 0xF8,
+  0x34, 0x21, 0x27, 0x22, 0x42, 0x12, 0xF2, 0x1F, 0xF0, 0x29, 0x25, 0x22,
+  0x80, 0x09, 0x22, 0x15, 0x11, 0x91, 0xB2, 0xFF, 0xF8, 0x28, 0x12, 0x21,
+  0x71, 0x0C, 0x16, 0xF5, 0x16, 0x16, 0x37, 0x3A, 0x1C, 0x1A, 0x21, 0x61,
+  0x0C, 0x16, 0xF5, 0x16, 0x16, 0x37, 0x3A, 0x1F, 0x82, 0x12, 0x50, 0x1E,
+  0x98, 0x64, 0x0A, 0x02, 0x80, 0x20, 0x08, 0x7E, 0x02, 0x40, 0x98, 0x21,
+  0xF0, 0x05, 0x27, 0x12, 0x22, 0x12, 0xFF, 0x96, 0x66, 0xFF, 0x92, 0x12,
+  0x22, 0x12, 0x0C, 0x13, 0xFF, 0xFF, 0x44, 0x13, 0x37, 0x34, 0x12, 0xFF,
+  0xA1, 0xFF, 0x01, 0x41, 0x36, 0x11, 0x20, 0xFB, 0xC4, 0x20, 0x88, 0x12,
+  0x02, 0x80, 0x68, 0x08, 0x81, 0x10, 0x21, 0x04, 0x23, 0xE3, 0x80, 0x05,
+  0x52, 0x12, 0xFF, 0xF9, 0x1F, 0xF0, 0x21, 0x61, 0x04, 0x46, 0x82, 0x72,
+  0x62, 0xFA, 0x28, 0x2C, 0x1A, 0x1F, 0x32, 0x12, 0x22, 0x12, 0x04, 0x36,
+  0x52, 0x11, 0x32, 0xF6, 0x2F, 0x62, 0xA2, 0xF6, 0x22, 0x21, 0x26, 0x34,
+  0x48, 0x31, 0x41, 0x22, 0x62, 0xFF, 0xA2, 0x62, 0x21, 0x41, 0x38, 0x10,
+  0x08, 0x22, 0x16, 0x92, 0xFD, 0x23, 0x64, 0x5F, 0x72, 0x13, 0x40, 0x34,
+  0x48, 0x31, 0x41, 0x22, 0x62, 0xFF, 0xA2, 0x62, 0x21, 0x41, 0x38, 0x53,
+  0x72, 0x68, 0x09, 0x32, 0x15, 0x11, 0xA1, 0xF8, 0x25, 0x66, 0x3C, 0x1C,
+  0x2B, 0x22, 0x21, 0x25, 0x20, 0x35, 0x11, 0x27, 0x22, 0x51, 0xC2, 0x61,
+  0x25, 0x68, 0x62, 0xB3, 0x5B, 0x10, 0x0A, 0x14, 0x13, 0xFF, 0x11, 0x81,
+  0xFF, 0xC3, 0x12, 0x20, 0x04, 0x25, 0x12, 0x22, 0x11, 0xFF, 0xFF, 0xB2,
+  0x42, 0x36, 0x20, 0x04, 0x45, 0x12, 0x41, 0x12, 0x12, 0xFE, 0x24, 0x2F,
+  0x02, 0x62, 0xF8, 0x4F, 0x10, 0x04, 0x45, 0x12, 0x42, 0x11, 0xF2, 0x2F,
+  0x62, 0x32, 0x72, 0x52, 0xC2, 0xE2, 0xF0, 0xF1, 0xE4, 0x10, 0x44, 0x09,
+  0x00, 0xA0, 0x08, 0x02, 0x80, 0x88, 0x20, 0x88, 0x0B, 0xC7, 0x80, 0xE3,
+  0xD0, 0x22, 0x10, 0x88, 0x12, 0x05, 0x00, 0x80, 0x20, 0x08, 0x02, 0x03,
+  0xF0, 0xFE, 0x82, 0x84, 0x84, 0x08, 0x10, 0x20, 0x21, 0x41, 0x81, 0xFF,
+  0x04, 0x13, 0xFF, 0xF4, 0x30, 0x01, 0xD2, 0xD2, 0xD2, 0xF5, 0x2D, 0x2D,
+  0x27, 0x07, 0xFF, 0xF4, 0x31, 0x18, 0x3C, 0x24, 0x42, 0x81, 0x0C, 0xE1,
+  0x86, 0x3E, 0x10, 0xC0, 0x10, 0xFC, 0xC1, 0x20, 0x48, 0x13, 0x1C, 0x79,
+  0xC0, 0xE0, 0x04, 0x00, 0x80, 0x10, 0x02, 0x78, 0x51, 0x8C, 0x19, 0x01,
+  0x20, 0x24, 0x04, 0xC1, 0x94, 0x6E, 0x78, 0x1E, 0xB0, 0xD0, 0x30, 0x08,
+  0x04, 0x03, 0x02, 0xC3, 0x1E, 0x00, 0x07, 0x80, 0x10, 0x02, 0x00, 0x43,
+  0xC8, 0xC5, 0x30, 0x64, 0x04, 0x80, 0x90, 0x13, 0x06, 0x31, 0x43, 0xCE,
+  0x1E, 0x18, 0x6C, 0x0A, 0x01, 0xFF, 0xE0, 0x0C, 0x01, 0x83, 0x1F, 0x00,
+  0x35, 0x26, 0xF1, 0x21, 0x71, 0x5F, 0xFF, 0x32, 0x15, 0x3C, 0xEC, 0x73,
+  0x06, 0x40, 0x48, 0x09, 0x01, 0x30, 0x63, 0x14, 0x3C, 0x80, 0x12, 0x06,
+  0x3F, 0x00, 0x03, 0x92, 0xFF, 0x94, 0x74, 0x11, 0x52, 0x31, 0x61, 0xFF,
+  0xFB, 0x21, 0x22, 0x21, 0x20, 0x32, 0xE2, 0xC4, 0x43, 0xFF, 0xF7, 0x41,
+  0x30, 0x42, 0xA2, 0x6B, 0xFF, 0xF8, 0x62, 0x03, 0x72, 0xFF, 0x44, 0x82,
+  0x53, 0x62, 0x73, 0x71, 0x12, 0x92, 0x92, 0x12, 0x51, 0x11, 0x05, 0x34,
+  0xFF, 0xFF, 0xF9, 0x41, 0x30, 0x02, 0x13, 0x22, 0x21, 0x19, 0x31, 0x41,
+  0xFF, 0xFF, 0x41, 0x11, 0x41, 0x31, 0x03, 0x24, 0x32, 0x17, 0x52, 0xFF,
+  0xFF, 0x72, 0x12, 0x22, 0x12, 0x1E, 0x18, 0x6C, 0x0E, 0x01, 0x80, 0x60,
+  0x1C, 0x0D, 0x86, 0x1E, 0x00, 0xE7, 0x87, 0x18, 0x81, 0x90, 0x12, 0x02,
+  0x40, 0x4C, 0x19, 0x46, 0x27, 0x84, 0x00, 0x80, 0x7E, 0x00, 0x3C, 0xEC,
+  0x73, 0x02, 0x40, 0x48, 0x09, 0x01, 0x30, 0x63, 0x14, 0x3C, 0x80, 0x10,
+  0x02, 0x03, 0xF0, 0x13, 0x33, 0x12, 0x24, 0x53, 0x21, 0x41, 0xFF, 0xF0,
+  0x31, 0x42, 0x7A, 0xC6, 0x82, 0xC0, 0x7E, 0x01, 0x81, 0xC3, 0xBE, 0x11,
+  0xE1, 0x15, 0x11, 0x15, 0xFF, 0xD1, 0x41, 0x11, 0x15, 0x03, 0x43, 0x22,
+  0x52, 0xFF, 0xFF, 0x61, 0x41, 0x51, 0x15, 0x12, 0xF1, 0xE8, 0x10, 0x82,
+  0x10, 0x81, 0x10, 0x22, 0x02, 0x80, 0x50, 0x04, 0x00, 0xF0, 0xF4, 0x02,
+  0x44, 0x24, 0x62, 0x4A, 0x42, 0x94, 0x29, 0x43, 0x14, 0x10, 0x80, 0xF1,
+  0xE4, 0x10, 0x44, 0x05, 0x00, 0x40, 0x14, 0x04, 0x41, 0x04, 0xF1, 0xE0,
+  0xE0, 0xE8, 0x08, 0x82, 0x10, 0x81, 0x10, 0x24, 0x02, 0x80, 0x60, 0x04,
+  0x01, 0x00, 0x40, 0x7E, 0x00, 0xFF, 0x83, 0x86, 0x0C, 0x18, 0x30, 0x61,
+  0xC1, 0xFF, 0x1C, 0xC2, 0x08, 0x20, 0x82, 0x30, 0x60, 0x82, 0x08, 0x20,
+  0xC1, 0xC0, 0xFF, 0xFE, 0xE0, 0xC1, 0x04, 0x10, 0x41, 0x03, 0x18, 0x41,
+  0x04, 0x10, 0xCE, 0x00, 0x70, 0xCC, 0xA1, 0xC0, 0x0B, 0x19, 0xFF, 0xFF,
+  0xFF, 0xF7, 0x91, 0xE7, 0x07, 0x18, 0x81, 0x10, 0x12, 0x02, 0x40, 0x48,
+  0x09, 0x82, 0x29, 0x84, 0xC0, 0x80, 0x7E, 0x00, 0x1E, 0x90, 0xD0, 0x30,
+  0x08, 0x04, 0x01, 0x00, 0x81, 0x3F, 0x00, 0x0A, 0x13, 0x14, 0xF6, 0x18,
+  0x1F, 0xF2, 0x21, 0x32, 0xE0, 0xE8, 0x09, 0x02, 0x10, 0x41, 0x10, 0x24,
+  0x02, 0x80, 0x60, 0x04, 0x01, 0x00, 0x20, 0x7E, 0x00, 0x08, 0x06, 0x00,
+  0x80, 0x20, 0x1E, 0x1A, 0x64, 0x8A, 0x21, 0x88, 0x62, 0x18, 0x85, 0x22,
+  0x3B, 0x03, 0x00, 0x80, 0xFC, 0xF3, 0xD0, 0x22, 0x10, 0x48, 0x0C, 0x03,
+  0x01, 0x20, 0x84, 0xE1, 0xC0, 0x04, 0x25, 0x12, 0x22, 0x11, 0xFF, 0xFF,
+  0x01, 0x16, 0x1A, 0xB0, 0x04, 0x25, 0x12, 0x21, 0x12, 0xF6, 0x29, 0x56,
+  0x4F, 0x32, 0x12, 0xED, 0xD2, 0x24, 0x89, 0x22, 0x48, 0x92, 0x24, 0x89,
+  0x22, 0xFF, 0xC0, 0xED, 0xD2, 0x24, 0x89, 0x22, 0x48, 0x92, 0x24, 0x89,
+  0x22, 0xFF, 0xC0, 0x10, 0x04, 0x06, 0x63, 0x11, 0xF1, 0x1F, 0x04, 0x76,
+  0x91, 0xE2, 0x16, 0x03, 0x44, 0x11, 0x41, 0x11, 0xF7, 0x46, 0x5F, 0x81,
+  0x16, 0x11, 0x05, 0x52, 0x12, 0xFD, 0x55, 0x78, 0x1B, 0x21, 0x70, 0x9E,
+  0x38, 0x68, 0x08, 0x01, 0x0F, 0xC0, 0x10, 0x0A, 0x02, 0x7F, 0x00, 0xE7,
+  0x12, 0x25, 0x05, 0x41, 0x70, 0x54, 0x15, 0x05, 0x21, 0xE7, 0x80, 0x07,
+  0xE7, 0x10, 0x82, 0x10, 0x41, 0xF8, 0x09, 0x02, 0x20, 0x84, 0xE1, 0xE0,
+  0x25, 0x73, 0xB4, 0xF4, 0x2E, 0x2F, 0x28, 0x64, 0x52, 0x91, 0x12, 0x41,
+  0x12, 0x09, 0x12, 0x15, 0xF5, 0x1E, 0x64, 0x7F, 0xF0, 0x21, 0x70, 0x08,
+  0x22, 0x16, 0xFD, 0x24, 0x41, 0x14, 0x7F, 0xF0, 0x21, 0x70, 0x0C, 0x16,
+  0xF5, 0x1F, 0xFF, 0xF0, 0x21, 0x25, 0x19, 0x11, 0x14, 0x12, 0xFF, 0xFF,
+  0xF5, 0x21, 0x41, 0x21, 0x8B, 0x0C, 0x16, 0xF2, 0x12, 0x1D, 0x37, 0x3A,
+  0x1C, 0x1A, 0x21, 0x61, 0xDE, 0xD2, 0x22, 0x90, 0xA8, 0x1A, 0x0B, 0x42,
+  0x91, 0x22, 0x48, 0x92, 0x2D, 0xEC, 0x01, 0x32, 0x38, 0x32, 0x21, 0xC1,
+  0xD2, 0x52, 0x11, 0x55, 0xF3, 0x18, 0x90, 0xF1, 0xD0, 0xA4, 0x29, 0x12,
+  0x44, 0x92, 0x24, 0x89, 0x42, 0x50, 0x98, 0x2E, 0x3C, 0x21, 0x04, 0xC0,
+  0xC3, 0xC7, 0x42, 0x90, 0xA4, 0x49, 0x12, 0x48, 0x92, 0x25, 0x09, 0x42,
+  0x60, 0xB8, 0xF0, 0xF3, 0xC8, 0x21, 0x08, 0x22, 0x04, 0x80, 0xB8, 0x08,
+  0x82, 0x10, 0x41, 0x08, 0x23, 0xC3, 0x80, 0x19, 0x12, 0x13, 0x12, 0xFF,
+  0xF7, 0x2F, 0xB3, 0x31, 0x12, 0xE0, 0x73, 0x0C, 0x30, 0xC2, 0x94, 0x29,
+  0x42, 0xA4, 0x26, 0x42, 0x44, 0x20, 0x42, 0x04, 0xF9, 0xF0, 0x04, 0x25,
+  0x12, 0x22, 0x11, 0xFF, 0x26, 0x46, 0xFF, 0x21, 0x12, 0x22, 0x11, 0x42,
+  0x66, 0x33, 0x23, 0x12, 0x62, 0xFF, 0xFD, 0x49, 0x81, 0x0B, 0x15, 0x12,
+  0xFF, 0xFF, 0xF5, 0x11, 0x22, 0x11, 0x20, 0x08, 0x11, 0x17, 0xFF, 0x42,
+  0x26, 0x35, 0xF5, 0x11, 0x34, 0x42, 0x66, 0x11, 0x13, 0x26, 0xF1, 0x29,
+  0x1F, 0xF0, 0x2F, 0x11, 0x27, 0x11, 0x0A, 0x13, 0x14, 0xF6, 0x18, 0x1F,
+  0xFF, 0x72, 0x13, 0x20, 0x04, 0x46, 0x11, 0x41, 0x12, 0xE2, 0x42, 0xF2,
+  0x22, 0x2F, 0x44, 0x91, 0xB2, 0x73, 0x70, 0x1E, 0x02, 0x03, 0xF1, 0x22,
+  0x88, 0x62, 0x18, 0x86, 0x21, 0x48, 0x9A, 0x61, 0xE0, 0x78, 0xF3, 0xC8,
+  0x42, 0x20, 0x48, 0x0C, 0x03, 0x01, 0x20, 0x48, 0x21, 0x10, 0x2F, 0x3C,
+  0x04, 0x25, 0x12, 0x21, 0x12, 0xFF, 0xFF, 0xF5, 0x11, 0x51, 0xBB, 0x04,
+  0x25, 0x12, 0x21, 0x12, 0xF6, 0x2A, 0x45, 0x5F, 0xF9, 0x11, 0x20, 0xED,
+  0xD2, 0x24, 0x89, 0x22, 0x48, 0x92, 0x24, 0x89, 0x22, 0x48, 0x92, 0x2F,
+  0xFC, 0x03, 0x12, 0x14, 0x11, 0x21, 0x11, 0x11, 0xFF, 0xFF, 0xF5, 0x11,
+  0x21, 0x31, 0xAB, 0x06, 0x63, 0x11, 0xF1, 0x1F, 0xB5, 0x66, 0xFF, 0x52,
+  0x16, 0x03, 0x43, 0x12, 0x41, 0x11, 0xFF, 0x15, 0x56, 0xFF, 0x47, 0x11,
+  0x05, 0x52, 0x12, 0xFF, 0x86, 0x47, 0xFF, 0x02, 0x17, 0x33, 0x48, 0x32,
+  0x33, 0xB1, 0x72, 0xE5, 0x55, 0x92, 0xA1, 0x62, 0x18, 0x20, 0x02, 0x39,
+  0x64, 0x85, 0x41, 0x50, 0x54, 0x17, 0x05, 0x41, 0x50, 0x54, 0x14, 0x8B,
+  0x9E, 0x38, 0x26, 0x12, 0x12, 0xF5, 0x2A, 0x66, 0x11, 0x36, 0x2F, 0x42,
+  0x73, 0x32, 0x12, 0x34, 0x47, 0x32, 0xF3, 0x63, 0x7F, 0x41, 0x37, 0x12,
+  0x71, 0x56, 0x26, 0x11, 0x31, 0x72, 0x21, 0x76, 0x33, 0x14, 0xC1, 0x62,
+  0xA2, 0x62, 0xB8, 0x10, 0x06, 0x31, 0x16, 0x71, 0xD6, 0x36, 0x82, 0x73,
+  0x15, 0x20, 0x0B, 0x15, 0xFC, 0x1F, 0xC2, 0x13, 0x30, 0x19, 0x12, 0x13,
+  0x12, 0xFF, 0x22, 0xFB, 0x21, 0x41, 0x21, 0x8B, 0x34, 0x57, 0x22, 0x41,
+  0x22, 0x62, 0x18, 0x2B, 0xF2, 0x11, 0x90, 0xDE, 0xD2, 0x22, 0x90, 0x68,
+  0x3D, 0x0B, 0x44, 0x89, 0x22, 0xDE, 0xC0, 0xBC, 0xC2, 0x82, 0x02, 0x1C,
+  0x03, 0x01, 0x01, 0xFE, 0xF0, 0xD0, 0x64, 0x29, 0x12, 0x44, 0x92, 0x25,
+  0x09, 0x82, 0xE3, 0xC0, 0x21, 0x07, 0x80, 0x03, 0xC3, 0x41, 0x90, 0xA4,
+  0x49, 0x12, 0x48, 0x94, 0x26, 0x0B, 0x8F, 0xF7, 0x90, 0x84, 0x41, 0x20,
+  0x58, 0x09, 0x04, 0x21, 0x04, 0xF3, 0xC0, 0x19, 0x12, 0x13, 0x12, 0xFF,
+  0xC2, 0xF1, 0x24, 0x11, 0x20, 0xE0, 0x73, 0x0C, 0x30, 0xC2, 0x94, 0x29,
+  0x42, 0x64, 0x26, 0x42, 0x04, 0xF9, 0xF0, 0xF3, 0xD0, 0x24, 0x09, 0x02,
+  0x7F, 0x90, 0x24, 0x09, 0x02, 0xF3, 0xC0, 0x34, 0x56, 0x32, 0x42, 0x12,
+  0x62, 0xFD, 0x49, 0x81, 0x0B, 0x16, 0x11, 0xFF, 0xFF, 0x01, 0x12, 0x22,
+  0x11, 0x32, 0x12, 0x52, 0x12, 0x2C, 0x16, 0xF2, 0x12, 0x1D, 0x37, 0x3A,
+  0x1C, 0x1A, 0x21, 0x61, 0x12, 0x04, 0xC0, 0x00, 0x78, 0x21, 0x90, 0x28,
+  0x07, 0xFF, 0x80, 0x10, 0x04, 0x04, 0xFE };
+
+const RleGlyph CourierCyr10pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,  12,    0,    1, 0 },  // 0x20 ' '
+  {     0,   3,  11,  12,    4,  -10, 2 },  // 0x21 '!'
+  {     4,   5,   5,  12,    3,  -10, 0 },  // 0x22 '"'
+  {     8,   8,  14,  12,    2,  -12, 0 },  // 0x23 '#'
+  {    22,   8,  16,  12,    2,  -12, 0 },  // 0x24 '$'
+  {    38,   8,  13,  12,    2,  -12, 0 },  // 0x25 '%'
+  {    51,  10,  11,  12,    1,  -10, 0 },  // 0x26 '&'
+  {    65,   2,   5,  12,    5,  -10, 1 },  // 0x27 '''
+  {    66,   4,  14,  12,    5,  -11, 0 },  // 0x28 '('
+  {    73,   4,  14,  12,    3,  -11, 0 },  // 0x29 ')'
+  {    80,   8,   7,  12,    2,  -11, 0 },  // 0x2A '*'
+  {    87,   8,   8,  12,    2,   -9, 2 },  // 0x2B '+'
+  {    93,   3,   5,  12,    4,   -1, 0 },  // 0x2C ','
+  {    95,   8,   1,  12,    2,   -5, 0 },  // 0x2D '-'
+  {    96,   3,   3,  12,    4,   -2, 1 },  // 0x2E '.'
+  {    97,   7,  15,  12,    3,  -12, 2 },  // 0x2F '/'
+  {   106,   8,  13,  12,    2,  -12, 0 },  // 0x30 '0'
+  {   119,   8,  12,  12,    2,  -11, 2 },  // 0x31 '1'
+  {   126,   7,  13,  12,    2,  -12, 0 },  // 0x32 '2'
+  {   138,   7,  13,  12,    2,  -12, 2 },  // 0x33 '3'
+  {   149,   8,  12,  12,    2,  -11, 2 },  // 0x34 '4'
+  {   160,   9,  12,  12,    1,  -11, 2 },  // 0x35 '5'
+  {   170,   8,  13,  12,    2,  -12, 0 },  // 0x36 '6'
+  {   183,   8,  12,  12,    2,  -11, 2 },  // 0x37 '7'
+  {   192,   8,  13,  12,    2,  -12, 0 },  // 0x38 '8'
+  {   205,   8,  13,  12,    2,  -12, 0 },  // 0x39 '9'
+  {   218,   3,   8,  12,    4,   -7, 1 },  // 0x3A ':'
+  {   220,   4,  10,  12,    3,   -7, 0 },  // 0x3B ';'
+  {   225,  10,   9,  12,    1,   -8, 1 },  // 0x3C '<'
+  {   234,   9,   5,  12,    1,   -8, 1 },  // 0x3D '='
+  {   237,  10,   9,  12,    1,   -8, 1 },  // 0x3E '>'
+  {   247,   7,  11,  12,    3,  -10, 0 },  // 0x3F '?'
+  {   257,   9,  13,  12,    2,  -12, 0 },  // 0x40 '@'
+  {   272,  12,  11,  12,    0,  -10, 2 },  // 0x41 'A'
+  {   286,  10,  11,  12,    1,  -10, 0 },  // 0x42 'B'
+  {   300,  10,  11,  12,    1,  -10, 2 },  // 0x43 'C'
+  {   313,  11,  11,  12,    0,  -10, 2 },  // 0x44 'D'
+  {   325,  10,  11,  12,    1,  -10, 2 },  // 0x45 'E'
+  {   336,  10,  11,  12,    1,  -10, 2 },  // 0x46 'F'
+  {   347,  10,  11,  12,    1,  -10, 0 },  // 0x47 'G'
+  {   361,  12,  11,  12,    0,  -10, 2 },  // 0x48 'H'
+  {   374,   8,  11,  12,    2,  -10, 2 },  // 0x49 'I'
+  {   380,  10,  11,  12,    1,  -10, 2 },  // 0x4A 'J'
+  {   391,  11,  11,  12,    1,  -10, 0 },  // 0x4B 'K'
+  {   407,  10,  11,  12,    1,  -10, 2 },  // 0x4C 'L'
+  {   416,  12,  11,  12,    0,  -10, 2 },  // 0x4D 'M'
+  {   430,  11,  11,  12,    0,  -10, 2 },  // 0x4E 'N'
+  {   443,  10,  11,  12,    1,  -10, 2 },  // 0x4F 'O'
+  {   456,  10,  11,  12,    1,  -10, 2 },  // 0x50 'P'
+  {   467,  10,  14,  12,    1,  -10, 2 },  // 0x51 'Q'
+  {   482,  12,  11,  12,    0,  -10, 2 },  // 0x52 'R'
+  {   497,  10,  11,  12,    1,  -10, 2 },  // 0x53 'S'
+  {   510,  10,  11,  12,    1,  -10, 2 },  // 0x54 'T'
+  {   520,  10,  11,  12,    1,  -10, 2 },  // 0x55 'U'
+  {   531,  12,  11,  12,    0,  -10, 2 },  // 0x56 'V'
+  {   545,  12,  11,  12,    0,  -10, 2 },  // 0x57 'W'
+  {   559,  11,  11,  12,    0,  -10, 0 },  // 0x58 'X'
+  {   575,  10,  11,  12,    1,  -10, 0 },  // 0x59 'Y'
+  {   589,   8,  11,  12,    2,  -10, 0 },  // 0x5A 'Z'
+  {   600,   4,  15,  12,    5,  -12, 2 },  // 0x5B '['
+  {   605,   7,  15,  12,    3,  -12, 2 },  // 0x5C
+  {   613,   4,  15,  12,    3,  -12, 2 },  // 0x5D ']'
+  {   617,   8,   5,  12,    2,  -11, 0 },  // 0x5E '^'
+  {   622,  12,   1,  12,    0,    3, 1 },  // 0x5F '_'
+  {   623,   5,   3,  12,    4,  -12, 0 },  // 0x60 '`'
+  {   625,  10,   9,  12,    1,   -8, 0 },  // 0x61 'a'
+  {   637,  11,  13,  12,    0,  -12, 0 },  // 0x62 'b'
+  {   655,   9,   9,  12,    1,   -8, 0 },  // 0x63 'c'
+  {   666,  11,  13,  12,    1,  -12, 0 },  // 0x64 'd'
+  {   684,  10,   9,  12,    1,   -8, 0 },  // 0x65 'e'
+  {   696,   8,  13,  12,    2,  -12, 2 },  // 0x66 'f'
+  {   705,  11,  12,  12,    1,   -8, 0 },  // 0x67 'g'
+  {   722,  12,  13,  12,    0,  -12, 2 },  // 0x68 'h'
+  {   737,   8,  13,  12,    2,  -12, 2 },  // 0x69 'i'
+  {   745,   6,  16,  12,    2,  -12, 2 },  // 0x6A 'j'
+  {   751,  10,  13,  12,    1,  -12, 2 },  // 0x6B 'k'
+  {   766,   8,  13,  12,    2,  -12, 2 },  // 0x6C 'l'
+  {   773,  12,   9,  12,    0,   -8, 2 },  // 0x6D 'm'
+  {   786,  12,   9,  12,    0,   -8, 2 },  // 0x6E 'n'
+  {   797,  10,   9,  12,    1,   -8, 0 },  // 0x6F 'o'
+  {   809,  11,  12,  12,    0,   -8, 0 },  // 0x70 'p'
+  {   826,  11,  12,  12,    1,   -8, 0 },  // 0x71 'q'
+  {   843,  10,   9,  12,    1,   -8, 2 },  // 0x72 'r'
+  {   854,   8,   9,  12,    2,   -8, 0 },  // 0x73 's'
+  {   863,   8,  11,  12,    2,  -10, 2 },  // 0x74 't'
+  {   873,  12,   9,  12,    0,   -8, 2 },  // 0x75 'u'
+  {   884,  11,   9,  12,    0,   -8, 0 },  // 0x76 'v'
+  {   897,  12,   9,  12,    0,   -8, 0 },  // 0x77 'w'
+  {   911,  11,   9,  12,    0,   -8, 0 },  // 0x78 'x'
+  {   924,  11,  12,  12,    0,   -8, 0 },  // 0x79 'y'
+  {   941,   8,   9,  12,    2,   -8, 0 },  // 0x7A 'z'
+  {   950,   6,  15,  12,    3,  -12, 0 },  // 0x7B '{'
+  {   962,   1,  15,  12,    6,  -12, 0 },  // 0x7C '|'
+  {   964,   6,  15,  12,    3,  -12, 0 },  // 0x7D '}'
+  {   976,   9,   3,  12,    2,   -5, 0 },  // 0x7E '~'
+  {   980,  11,  13,  15,    2,  -12, 2 },  // 0x7F
+  {   987,  11,  12,  12,    0,   -8, 0 },  // 0x80
+  {  1004,   9,   9,  12,    1,   -8, 0 },  // 0x81
+  {  1015,  10,   9,  12,    1,   -8, 2 },  // 0x82
+  {  1024,  11,  12,  12,    0,   -8, 0 },  // 0x83
+  {  1041,  10,  16,  12,    1,  -12, 0 },  // 0x84
+  {  1061,  10,   9,  12,    1,   -8, 0 },  // 0x85
+  {  1073,  10,  11,  12,    1,   -8, 2 },  // 0x86
+  {  1084,  10,   9,  12,    1,   -8, 2 },  // 0x87
+  {  1095,  10,   9,  12,    1,   -8, 0 },  // 0x88
+  {  1107,  10,  11,  12,    1,   -8, 0 },  // 0x89
+  {  1121,  11,   9,  12,    0,   -8, 2 },  // 0x8A
+  {  1131,  10,   9,  12,    1,   -8, 2 },  // 0x8B
+  {  1142,  10,   9,  12,    1,   -8, 2 },  // 0x8C
+  {  1151,  10,   9,  12,    1,   -8, 0 },  // 0x8D
+  {  1163,  10,   9,  12,    1,   -8, 0 },  // 0x8E
+  {  1175,  11,   9,  12,    0,   -8, 0 },  // 0x8F
+  {  1188,  12,  11,  12,    0,  -10, 2 },  // 0x90
+  {  1201,  10,  11,  12,    1,  -10, 2 },  // 0x91
+  {  1211,  10,  11,  12,    1,  -10, 2 },  // 0x92
+  {  1222,  10,  11,  12,    1,  -10, 2 },  // 0x93
+  {  1230,  10,  13,  12,    1,  -10, 2 },  // 0x94
+  {  1241,  10,  11,  12,    1,  -10, 2 },  // 0x95
+  {  1252,  10,  11,  12,    1,  -10, 0 },  // 0x96
+  {  1266,   9,  12,  12,    1,  -11, 2 },  // 0x97
+  {  1279,  10,  11,  12,    1,  -10, 0 },  // 0x98
+  {  1293,  10,  14,  12,    1,  -13, 0 },  // 0x99
+  {  1311,  11,  11,  12,    1,  -10, 0 },  // 0x9A
+  {  1327,  10,  11,  12,    1,  -10, 2 },  // 0x9B
+  {  1337,  12,  11,  12,    0,  -10, 0 },  // 0x9C
+  {  1354,  10,  11,  12,    1,  -10, 2 },  // 0x9D
+  {  1367,  10,  12,  12,    1,  -11, 2 },  // 0x9E
+  {  1377,  10,  11,  12,    1,  -10, 2 },  // 0x9F
+  {  1387,   9,  11,  12,    2,  -10, 2 },  // 0xA0
+  {  1397,  10,  12,  12,    1,  -11, 2 },  // 0xA1
+  {  1410,  10,  11,  12,    1,  -10, 2 },  // 0xA2
+  {  1420,  12,  11,  12,    0,  -10, 2 },  // 0xA3
+  {  1435,  10,  12,  12,    1,  -11, 0 },  // 0xA4
+  {  1450,  10,  11,  12,    1,  -10, 0 },  // 0xA5
+  {  1464,  10,  13,  12,    1,  -10, 2 },  // 0xA6
+  {  1475,  10,  11,  12,    1,  -10, 2 },  // 0xA7
+  {  1487,  10,  11,  12,    1,  -10, 0 },  // 0xA8
+  {  1501,  10,  13,  12,    1,  -10, 2 },  // 0xA9
+  {  1515,  11,  11,  12,    0,  -10, 2 },  // 0xAA
+  {  1525,  10,  11,  12,    1,  -10, 2 },  // 0xAB
+  {  1536,  10,  11,  12,    1,  -10, 2 },  // 0xAC
+  {  1545,  10,  12,  12,    1,  -11, 2 },  // 0xAD
+  {  1558,  10,  12,  12,    1,  -11, 0 },  // 0xAE
+  {  1573,  11,  11,  12,    1,  -10, 2 },  // 0xAF
+  {  1587,  10,   9,  12,    1,   -8, 2 },  // 0xB0
+  {  1596,  10,  13,  12,    1,  -12, 2 },  // 0xB1
+  {  1612,   9,   9,  12,    2,   -8, 2 },  // 0xB2
+  {  1622,   9,   9,  12,    2,   -8, 2 },  // 0xB3
+  {  1629,  10,  11,  12,    1,   -8, 2 },  // 0xB4
+  {  1640,  10,   9,  12,    1,   -8, 2 },  // 0xB5
+  {  1651,  10,   9,  12,    1,   -8, 0 },  // 0xB6
+  {  1663,   8,   9,  12,    2,   -8, 0 },  // 0xB7
+  {  1672,  10,   9,  12,    1,   -8, 0 },  // 0xB8
+  {  1684,  10,  12,  12,    1,  -11, 0 },  // 0xB9
+  {  1699,  10,   9,  12,    1,   -8, 0 },  // 0xBA
+  {  1711,  10,   9,  12,    1,   -8, 2 },  // 0xBB
+  {  1721,  12,   9,  12,    0,   -8, 0 },  // 0xBC
+  {  1735,  10,   9,  12,    1,   -8, 0 },  // 0xBD
+  {  1747,  10,   9,  12,    1,   -8, 2 },  // 0xBE
+  {  1756,  10,   9,  12,    1,   -8, 2 },  // 0xBF
+  {  1765,  10,  13,  12,    1,  -12, 2 },  // 0xC0
+  {  1780,  10,  12,  12,    1,  -11, 0 }   // 0xC1
+};
+
+const RleFont CourierCyr10pt8bRle PROGMEM = {
+  CourierCyr10pt8bRleData,
+  CourierCyr10pt8bRleGlyphs,
+  0x20, 0xC1, 16 };
+
+#endif // COURIERCYR10PT8BRLE_H_
@@ -0,0 +1,361 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr12.h, do not edit.
+// 162 glyphs (0 sharing another's bitmap), 2192 bytes of bitmap data (GFXfont: 2828)
+#ifndef COURIERCYR12PT8BRLE_H_
+#define COURIERCYR12PT8BRLE_H_
+
+const uint8_t CourierCyr12pt8bRleData[] PROGMEM = {
+  0x11, 0xF8, 0x14, 0x36, 0xDE, 0xF7, 0xBD, 0xCC, 0x31, 0x31, 0xFF, 0xC3,
+  0x13, 0x15, 0x12, 0x13, 0x22, 0xF1, 0x21, 0x31, 0x51, 0x31, 0x3F, 0xFF,
+  0x50, 0x41, 0xF9, 0x21, 0x41, 0x61, 0x3E, 0x1A, 0x37, 0x56, 0x57, 0x4F,
+  0x31, 0x52, 0x17, 0x11, 0x12, 0x12, 0xF5, 0x38, 0x31, 0x88, 0x22, 0x08,
+  0xC6, 0x0E, 0x30, 0x30, 0x30, 0x30, 0x31, 0xC1, 0x8C, 0x41, 0x10, 0x46,
+  0x30, 0x70, 0x3C, 0x18, 0x84, 0x01, 0x00, 0x60, 0x08, 0x03, 0x01, 0x27,
+  0x89, 0x21, 0xC8, 0x23, 0x18, 0x79, 0xC0, 0x0C, 0x21, 0x12, 0x92, 0xF7,
+  0x28, 0x23, 0x01, 0x32, 0x72, 0xB2, 0xF7, 0x29, 0x25, 0x22, 0x08, 0x08,
+  0x08, 0xC9, 0x7E, 0x1C, 0x34, 0x66, 0x42, 0x51, 0xFF, 0xE5, 0x19, 0x14,
+  0xFF, 0xA0, 0x36, 0x64, 0xC0, 0x09, 0x09, 0x71, 0x62, 0xF6, 0x2D, 0x2D,
+  0x2F, 0x62, 0xD2, 0xD2, 0xE0, 0x3E, 0x31, 0x90, 0x58, 0x38, 0x0C, 0x06,
+  0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x34, 0x13, 0x18, 0xF8, 0x42, 0x62,
+  0x62, 0x12, 0x53, 0xFF, 0xFF, 0xFF, 0xF2, 0x51, 0x40, 0x3E, 0x31, 0xA0,
+  0x70, 0x10, 0x08, 0x04, 0x04, 0x02, 0x02, 0x06, 0x06, 0x06, 0x04, 0x0C,
+  0x07, 0xFE, 0x24, 0x37, 0x22, 0x42, 0xFF, 0x33, 0x42, 0x11, 0x55, 0x73,
+  0xFA, 0x11, 0x24, 0x11, 0x71, 0x11, 0x62, 0x72, 0xF2, 0x27, 0x2F, 0x22,
+  0x72, 0xF2, 0x29, 0x61, 0x91, 0x2F, 0x84, 0x12, 0x18, 0x37, 0xFF, 0x45,
+  0x45, 0x11, 0x22, 0x41, 0x11, 0x81, 0xFE, 0x11, 0x25, 0x11, 0xA1, 0x0F,
+  0x8C, 0x08, 0x08, 0x04, 0x04, 0x02, 0x79, 0x46, 0xC1, 0xC0, 0x60, 0x30,
+  0x14, 0x1B, 0x18, 0x78, 0x09, 0x17, 0xA1, 0x62, 0xF9, 0x2F, 0x02, 0xF9,
+  0x2F, 0x60, 0x3E, 0x31, 0xA0, 0x30, 0x18, 0x0E, 0x0D, 0x8C, 0x7C, 0x63,
+  0x40, 0x60, 0x30, 0x18, 0x0B, 0x18, 0xF8, 0x3C, 0x31, 0xB0, 0x50, 0x18,
+  0x0C, 0x07, 0x06, 0xC5, 0x3C, 0x80, 0x40, 0x40, 0x20, 0x20, 0x23, 0xE0,
+  0x09, 0x99, 0x77, 0x70, 0x00, 0x66, 0x4C, 0xC8, 0xA1, 0x73, 0x62, 0x72,
+  0x72, 0x83, 0xB2, 0xB2, 0xB2, 0xB2, 0x0A, 0xFF, 0x0A, 0x01, 0xB3, 0xB2,
+  0xB2, 0xB2, 0x93, 0x62, 0x72, 0x72, 0x72, 0x90, 0x16, 0x28, 0x83, 0xF9,
+  0x23, 0x55, 0x35, 0x1F, 0x13, 0xF7, 0x34, 0x56, 0x32, 0x42, 0xB2, 0xF8,
+  0x36, 0x45, 0x2C, 0x15, 0x51, 0x32, 0x31, 0x2B, 0x24, 0x23, 0x71, 0x35,
+  0x93, 0xD4, 0xF8, 0x22, 0x2F, 0xF5, 0x24, 0x27, 0x66, 0xAF, 0x22, 0x82,
+  0x11, 0x13, 0x43, 0x11, 0x09, 0x32, 0x18, 0xA1, 0xF8, 0x24, 0x75, 0x8A,
+  0x11, 0x1A, 0x1F, 0xF5, 0x41, 0x81, 0x0F, 0x93, 0x05, 0x60, 0x34, 0x01,
+  0x80, 0x28, 0x00, 0x80, 0x08, 0x00, 0x80, 0x04, 0x00, 0x60, 0x13, 0x07,
+  0x0F, 0xC0, 0x09, 0x32, 0x17, 0xB2, 0xF8, 0x2F, 0xFF, 0xD2, 0xF5, 0x31,
+  0x21, 0x51, 0x12, 0x0E, 0x18, 0xFF, 0x31, 0x21, 0xF0, 0x57, 0x5F, 0x91,
+  0x21, 0xF9, 0x21, 0x81, 0x0B, 0x12, 0x17, 0xC2, 0xF5, 0x12, 0x1F, 0x05,
+  0x75, 0xF9, 0x1F, 0xC2, 0x14, 0x50, 0x44, 0x21, 0x38, 0x33, 0x42, 0xE2,
+  0x81, 0xFF, 0x25, 0x73, 0x13, 0xF8, 0x35, 0x14, 0x91, 0x05, 0x37, 0x12,
+  0x32, 0x12, 0xFF, 0xFA, 0x76, 0x7F, 0xFF, 0xA2, 0x12, 0x32, 0x12, 0x0F,
+  0x01, 0x4F, 0xFF, 0xFF, 0xFA, 0x51, 0x40, 0x39, 0x35, 0x13, 0xFF, 0xFF,
+  0x01, 0xFF, 0xF3, 0x24, 0x23, 0x21, 0x54, 0x05, 0x27, 0x12, 0x22, 0x12,
+  0x82, 0x92, 0x92, 0x92, 0x91, 0x11, 0x85, 0x71, 0x32, 0xF8, 0x2E, 0x21,
+  0x24, 0x30, 0x06, 0x63, 0x12, 0xFF, 0xFF, 0xF2, 0x1F, 0xFF, 0x33, 0x17,
+  0x10, 0x04, 0x66, 0xA2, 0x32, 0x42, 0xF6, 0x22, 0x2F, 0xF7, 0x4F, 0xB1,
+  0xC1, 0xF6, 0x21, 0x24, 0x21, 0x20, 0x04, 0x48, 0x63, 0x12, 0x32, 0xD2,
+  0xFC, 0x2E, 0x1C, 0x1E, 0x2F, 0xC2, 0xD2, 0x32, 0x13, 0x80, 0x44, 0x68,
+  0x33, 0x43, 0xD2, 0x82, 0xFF, 0xF3, 0x28, 0x29, 0x13, 0x34, 0x11, 0x13,
+  0x82, 0x09, 0x22, 0x15, 0x11, 0x93, 0xFF, 0xC2, 0x37, 0x46, 0xFF, 0x52,
+  0x13, 0x50, 0x44, 0x68, 0x33, 0x43, 0xD2, 0x82, 0xFF, 0xF3, 0x28, 0x29,
+  0x13, 0x34, 0x11, 0x13, 0x11, 0x65, 0x11, 0x37, 0x11, 0x27, 0x11, 0x80,
+  0x09, 0x42, 0x17, 0xC2, 0xFF, 0x72, 0x57, 0x64, 0x11, 0xB2, 0xC2, 0xFA,
+  0x22, 0x21, 0x26, 0x20, 0x1F, 0xA6, 0x1D, 0x01, 0xA0, 0x14, 0x00, 0x40,
+  0x07, 0xC0, 0x06, 0x00, 0x30, 0x05, 0x00, 0xB0, 0x69, 0xF8, 0x0C, 0x15,
+  0x14, 0xFF, 0x71, 0xA1, 0xFF, 0xFF, 0xF0, 0x31, 0x23, 0x05, 0x47, 0x12,
+  0x42, 0x12, 0xFF, 0xFF, 0xFF, 0xFA, 0x16, 0x15, 0x11, 0x14, 0x11, 0x15,
+  0x11, 0x41, 0x13, 0x05, 0x47, 0x12, 0x42, 0x12, 0xF9, 0x24, 0x2F, 0xC2,
+  0x42, 0xFA, 0x28, 0x2F, 0xC4, 0xF4, 0x04, 0x65, 0x12, 0x62, 0x11, 0xF5,
+  0x1E, 0x13, 0x22, 0x22, 0x2E, 0x2F, 0x82, 0xF1, 0x2F, 0x62, 0x52, 0x41,
+  0x61, 0x40, 0xF8, 0xF9, 0x01, 0x04, 0x10, 0x11, 0x00, 0x50, 0x02, 0x80,
+  0x08, 0x00, 0xA0, 0x08, 0x80, 0x82, 0x08, 0x08, 0x40, 0x4F, 0x8F, 0x80,
+  0x04, 0x54, 0x12, 0x51, 0x11, 0x12, 0x62, 0x32, 0xB2, 0x32, 0x92, 0x72,
+  0xB3, 0xFF, 0xFA, 0x31, 0x23, 0x09, 0x27, 0x92, 0x72, 0x21, 0xE2, 0x72,
+  0x72, 0x71, 0x61, 0x31, 0x72, 0x72, 0x98, 0x10, 0x03, 0x12, 0xFF, 0xF1,
+  0x20, 0x01, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x82, 0xF0, 0x2F, 0x02, 0xF0,
+  0x28, 0x07, 0xFF, 0xFF, 0x13, 0x10, 0x08, 0x03, 0x01, 0xE0, 0xCC, 0x61,
+  0xB0, 0x30, 0x0E, 0xE1, 0x04, 0x10, 0x35, 0x59, 0x32, 0x51, 0x57, 0x41,
+  0x16, 0x33, 0xFE, 0x13, 0x24, 0x34, 0x72, 0x20, 0x04, 0x93, 0xFF, 0xFA,
+  0x48, 0x75, 0x24, 0x16, 0x16, 0x2F, 0xFD, 0x16, 0x24, 0x24, 0x13, 0x22,
+  0x71, 0x1F, 0x58, 0x34, 0x06, 0x01, 0x80, 0x20, 0x08, 0x01, 0x01, 0x60,
+  0xC7, 0xC0, 0x65, 0x84, 0xFF, 0xF0, 0x57, 0x75, 0x25, 0x23, 0x27, 0x1F,
+  0xFC, 0x27, 0x14, 0x25, 0x25, 0x72, 0x20, 0x35, 0x48, 0x41, 0x52, 0x12,
+  0xA8, 0x39, 0xC2, 0xB1, 0x53, 0x1A, 0x36, 0x21, 0x15, 0x31, 0xF8, 0x21,
+  0x51, 0x21, 0x5F, 0xFF, 0xF4, 0x21, 0x51, 0x34, 0x23, 0x17, 0x22, 0x21,
+  0x42, 0x32, 0x61, 0xFF, 0x92, 0x61, 0x51, 0x42, 0x47, 0x74, 0xF3, 0x16,
+  0x23, 0x83, 0x03, 0xA2, 0xFF, 0xFA, 0x57, 0x51, 0x15, 0x24, 0x16, 0x1F,
+  0xFF, 0xFE, 0x21, 0x23, 0x21, 0x20, 0x42, 0xFD, 0x2F, 0x05, 0x54, 0xFF,
+  0xFF, 0xF0, 0x51, 0x40, 0x62, 0xF7, 0x28, 0xF0, 0xFF, 0xFF, 0xFC, 0x91,
+  0x04, 0x83, 0xFF, 0xF7, 0x57, 0x11, 0x37, 0x28, 0x38, 0x1B, 0x21, 0x1A,
+  0x11, 0x1A, 0x1C, 0x23, 0x25, 0x11, 0x20, 0x15, 0x54, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x55, 0x14, 0x03, 0x13, 0x23, 0x22, 0x1A, 0x41, 0x41, 0xFF, 0xFF,
+  0xFE, 0x21, 0x23, 0x23, 0x10, 0x03, 0x25, 0x32, 0x16, 0x11, 0x52, 0x41,
+  0xFF, 0xFF, 0xF6, 0x21, 0x23, 0x21, 0x20, 0x35, 0x57, 0x32, 0x52, 0x12,
+  0x72, 0xFF, 0x32, 0x72, 0x12, 0x52, 0x37, 0x20, 0x03, 0x25, 0x32, 0x27,
+  0x52, 0x52, 0x41, 0x72, 0xFF, 0xC1, 0x72, 0x32, 0x52, 0x57, 0x75, 0xFE,
+  0x21, 0x46, 0x35, 0x23, 0x27, 0x22, 0x12, 0x52, 0x32, 0x71, 0xFF, 0xC2,
+  0x71, 0x42, 0x52, 0x57, 0x75, 0xFF, 0x74, 0x12, 0x04, 0x33, 0x13, 0x35,
+  0x43, 0x31, 0x42, 0xFF, 0xFF, 0x03, 0x14, 0x30, 0x3E, 0xB0, 0x68, 0x0B,
+  0x00, 0x3F, 0x80, 0x38, 0x06, 0x01, 0xC0, 0xAF, 0xC0, 0x21, 0xFF, 0x02,
+  0x16, 0x22, 0x16, 0xFF, 0xFF, 0xB1, 0x43, 0x29, 0x03, 0x43, 0x22, 0x52,
+  0xFF, 0xFF, 0xF3, 0x13, 0x25, 0x11, 0x51, 0x20, 0x05, 0x47, 0x12, 0x42,
+  0x12, 0x22, 0x62, 0xF4, 0x24, 0x2F, 0x62, 0x22, 0xF8, 0x4F, 0x40, 0x04,
+  0x65, 0x12, 0x62, 0x11, 0x61, 0xE1, 0x32, 0x22, 0x22, 0xE2, 0xF8, 0x22,
+  0x44, 0x2E, 0x14, 0x14, 0xF8, 0xF9, 0x83, 0x06, 0x30, 0x0A, 0x00, 0x20,
+  0x02, 0x80, 0x22, 0x02, 0x08, 0x20, 0x27, 0x83, 0xC0, 0x04, 0x66, 0x11,
+  0x61, 0x12, 0xF1, 0x26, 0x26, 0x14, 0x17, 0x16, 0x17, 0x22, 0x2B, 0x1B,
+  0x21, 0x1C, 0x1F, 0xA2, 0xF6, 0x51, 0x26, 0x0A, 0x63, 0x52, 0x62, 0x62,
+  0x62, 0x62, 0x62, 0x53, 0x6A, 0x19, 0x88, 0x42, 0x10, 0x8C, 0x83, 0x08,
+  0x42, 0x10, 0x84, 0x30, 0xC0, 0x0F, 0x20, 0x03, 0x32, 0x11, 0x41, 0xFF,
+  0x11, 0x43, 0x33, 0x41, 0xFF, 0x31, 0x34, 0x20, 0x70, 0x39, 0x8A, 0x0E,
+  0x00, 0x0C, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xA1, 0x72, 0x43, 0x26,
+  0x22, 0x23, 0x23, 0x42, 0x62, 0x31, 0xFF, 0x81, 0xF5, 0x14, 0x27, 0x14,
+  0x31, 0x46, 0x69, 0x1F, 0x32, 0x14, 0x60, 0x42, 0x31, 0x37, 0x33, 0x23,
+  0x22, 0xF3, 0x1F, 0xF5, 0x19, 0x18, 0x21, 0xA0, 0x1F, 0x21, 0x4F, 0xA1,
+  0xA1, 0xFF, 0xF6, 0x31, 0x32, 0x04, 0x56, 0x11, 0x51, 0x12, 0xF0, 0x25,
+  0x2F, 0x32, 0x32, 0xF5, 0x21, 0x2A, 0x2A, 0x1C, 0x2F, 0x82, 0x74, 0x12,
+  0x60, 0x34, 0x83, 0xFF, 0x51, 0x93, 0x13, 0x34, 0x24, 0x31, 0x82, 0x91,
+  0x21, 0xF7, 0x2F, 0x52, 0x12, 0x61, 0x44, 0x14, 0x43, 0x12, 0xFF, 0x03,
+  0x13, 0x20, 0xF0, 0xF1, 0x82, 0x06, 0x20, 0x1A, 0x00, 0x60, 0x03, 0x80,
+  0x26, 0x02, 0x18, 0x20, 0x67, 0x87, 0xC0, 0x05, 0x37, 0x12, 0x32, 0x12,
+  0xFF, 0xFF, 0xFF, 0x12, 0x17, 0x1E, 0xFC, 0x04, 0x46, 0x11, 0x41, 0x12,
+  0xFC, 0x1A, 0x77, 0x5F, 0xF4, 0x21, 0x20, 0x04, 0x13, 0x16, 0x11, 0x11,
+  0x11, 0x11, 0x12, 0xFF, 0xFF, 0xFF, 0x12, 0x13, 0x13, 0x12, 0x04, 0x13,
+  0x15, 0x12, 0x11, 0x11, 0x11, 0x12, 0xFF, 0xFF, 0xFF, 0x11, 0x14, 0x13,
+  0x1E, 0xFC, 0x17, 0x54, 0x13, 0xF3, 0x1F, 0x17, 0x69, 0xB1, 0xFE, 0x21,
+  0x80, 0x04, 0x55, 0x12, 0x51, 0x12, 0xFD, 0x58, 0x6C, 0x2F, 0x91, 0x51,
+  0x18, 0x12, 0x06, 0x62, 0x13, 0xFF, 0x37, 0x59, 0xA1, 0xFA, 0x21, 0x90,
+  0x43, 0x5A, 0x21, 0x12, 0x34, 0x12, 0xA1, 0x92, 0x47, 0x57, 0xF8, 0x38,
+  0x21, 0xA2, 0x00, 0x87, 0x9B, 0x11, 0x04, 0x90, 0x24, 0x81, 0x3C, 0x05,
+  0x20, 0x29, 0x02, 0x48, 0x12, 0x21, 0xBC, 0xF8, 0x3A, 0x46, 0x12, 0x22,
+  0xB2, 0xD3, 0x93, 0x13, 0x85, 0x72, 0xA2, 0x84, 0x42, 0x12, 0x35, 0x93,
+  0x12, 0xA2, 0xFA, 0x22, 0x2F, 0xC2, 0x62, 0xD6, 0x6A, 0xFC, 0x21, 0x21,
+  0x24, 0x31, 0x10, 0x0B, 0x12, 0x17, 0xFF, 0x61, 0x45, 0x78, 0x94, 0xFF,
+  0xF1, 0x11, 0x21, 0x90, 0x0A, 0x22, 0x18, 0xFF, 0xF0, 0x34, 0x52, 0x14,
+  0x71, 0x1A, 0x1F, 0xF5, 0x11, 0x21, 0x90, 0x0E, 0x18, 0xFF, 0x61, 0xFF,
+  0xFF, 0xF9, 0x21, 0x45, 0x1B, 0x12, 0x15, 0x12, 0xFF, 0xFF, 0xFF, 0x82,
+  0xF5, 0x21, 0x61, 0x21, 0xAF, 0xA0, 0x0E, 0x18, 0xFF, 0x31, 0x21, 0xF0,
+  0x57, 0x5C, 0x1E, 0x1F, 0x92, 0x18, 0x10, 0xEF, 0x72, 0x24, 0x22, 0x41,
+  0x28, 0x0A, 0x80, 0xB8, 0x16, 0x42, 0x24, 0x22, 0x42, 0x22, 0x22, 0x24,
+  0x22, 0xCF, 0x30, 0x9E, 0x38, 0x4C, 0x0A, 0x02, 0x80, 0x80, 0x60, 0x70,
+  0x2E, 0x00, 0x80, 0x10, 0x04, 0x01, 0x80, 0x9F, 0xC0, 0x05, 0x45, 0x12,
+  0x32, 0x11, 0xF4, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0x92, 0xF4, 0x21, 0x14,
+  0x21, 0x10, 0x31, 0x51, 0xA1, 0x65, 0x11, 0x65, 0x35, 0x45, 0x12, 0x32,
+  0x11, 0xF4, 0x2F, 0x62, 0xF6, 0x2F, 0x62, 0x92, 0xF4, 0x21, 0x14, 0x21,
+  0x10, 0x05, 0x34, 0x12, 0x12, 0x31, 0x12, 0x92, 0xA2, 0xA2, 0xA2, 0xA3,
+  0x92, 0x12, 0x81, 0x32, 0xFA, 0x2F, 0x12, 0x12, 0x44, 0x2A, 0x22, 0x14,
+  0x12, 0xFF, 0xFF, 0xF0, 0x2F, 0xFD, 0x43, 0x21, 0x20, 0x04, 0x66, 0x12,
+  0x72, 0x92, 0xF6, 0x2F, 0x12, 0x92, 0xE2, 0xB1, 0xD2, 0xC1, 0xF6, 0x21,
+  0x24, 0x21, 0x20, 0x05, 0x36, 0x12, 0x32, 0x11, 0xFF, 0xF6, 0x75, 0x7F,
+  0xFF, 0x52, 0x12, 0x32, 0x11, 0x44, 0x68, 0x31, 0x11, 0x43, 0x31, 0x82,
+  0x91, 0x21, 0xFF, 0xFD, 0x2F, 0x52, 0x12, 0x61, 0x49, 0x10, 0x0E, 0x16,
+  0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x12, 0x31, 0x12, 0x0A, 0x12, 0x16,
+  0x11, 0x91, 0xFF, 0xC3, 0x37, 0x45, 0xFF, 0x62, 0x14, 0x40, 0x45, 0x11,
+  0x47, 0x11, 0x22, 0x51, 0x32, 0x71, 0xD2, 0x91, 0xFF, 0xF3, 0x2F, 0x82,
+  0x72, 0x2A, 0x0C, 0x15, 0x14, 0xFF, 0x71, 0xA1, 0xFF, 0xFF, 0xF0, 0x31,
+  0x32, 0x05, 0x47, 0x12, 0x42, 0x12, 0x22, 0xF5, 0x25, 0x2F, 0x32, 0x72,
+  0xF1, 0x29, 0x2E, 0x2B, 0x1D, 0x28, 0x48, 0x0F, 0x80, 0x20, 0x1F, 0x82,
+  0x26, 0x42, 0x38, 0x21, 0x82, 0x18, 0x21, 0x82, 0x14, 0x21, 0x62, 0x21,
+  0xFC, 0x02, 0x00, 0xF8, 0xF8, 0xF1, 0x02, 0x04, 0x20, 0x11, 0x00, 0x50,
+  0x03, 0x00, 0x18, 0x01, 0x20, 0x08, 0x80, 0x84, 0x08, 0x10, 0x80, 0x4F,
+  0x8F, 0x80, 0x05, 0x36, 0x12, 0x31, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x02,
+  0x16, 0x1D, 0xFA, 0x05, 0x36, 0x12, 0x31, 0x12, 0xFF, 0x91, 0xA1, 0x15,
+  0x66, 0xFF, 0xFD, 0x21, 0x20, 0x04, 0x13, 0x15, 0x12, 0x11, 0x11, 0x11,
+  0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x14, 0x13, 0x12, 0x04, 0x13, 0x16,
+  0x11, 0x11, 0x11, 0x11, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x13, 0x13,
+  0x1E, 0xFC, 0x08, 0x64, 0x12, 0xFF, 0x11, 0xF3, 0x49, 0x6B, 0x3F, 0xFF,
+  0x51, 0x42, 0x15, 0x11, 0x04, 0x55, 0x12, 0x51, 0x12, 0xFF, 0xB3, 0xA5,
+  0xB3, 0xC2, 0xFF, 0x72, 0x41, 0x16, 0x11, 0x12, 0x06, 0x62, 0x13, 0xFF,
+  0xF0, 0x57, 0x89, 0x4F, 0xFF, 0x11, 0x12, 0x19, 0x01, 0x25, 0x59, 0x21,
+  0x11, 0x51, 0x11, 0x12, 0x71, 0xC3, 0xFC, 0x75, 0x7F, 0x82, 0xC2, 0x72,
+  0x1A, 0x20, 0x73, 0x34, 0x25, 0x21, 0x12, 0x12, 0x32, 0x51, 0xD1, 0xFF,
+  0x12, 0x22, 0xB2, 0x72, 0xFF, 0x02, 0xF2, 0x21, 0x11, 0x21, 0x62, 0x3A,
+  0x21, 0x16, 0x12, 0x31, 0xFF, 0x73, 0xB7, 0x94, 0x71, 0xD1, 0xA2, 0xA1,
+  0xA2, 0x11, 0x42, 0x12, 0x52, 0x77, 0x53, 0x23, 0xF3, 0x19, 0x74, 0x31,
+  0x43, 0x1C, 0x1A, 0x25, 0x24, 0x81, 0x20, 0x64, 0x38, 0x25, 0x52, 0xF7,
+  0x64, 0x8A, 0x22, 0x1F, 0x32, 0xF5, 0x1B, 0x36, 0x22, 0x82, 0x09, 0x22,
+  0x17, 0xFB, 0x74, 0x51, 0x19, 0x3F, 0x54, 0x16, 0x20, 0x0E, 0x16, 0xFF,
+  0x31, 0xFF, 0xE3, 0x14, 0x30, 0x2A, 0x22, 0x14, 0x12, 0xFC, 0x2F, 0xFF,
+  0x02, 0x82, 0x16, 0x12, 0x1A, 0xFA, 0x43, 0x67, 0x33, 0x33, 0x12, 0xF3,
+  0x21, 0x92, 0xAC, 0x19, 0x19, 0x11, 0xA0, 0xEF, 0x72, 0x24, 0x12, 0x40,
+  0xA8, 0x1B, 0x82, 0x64, 0x22, 0x42, 0x22, 0x42, 0x2C, 0xF3, 0x0C, 0x1C,
+  0xE4, 0x0A, 0x02, 0x00, 0x83, 0xC0, 0x18, 0x01, 0x00, 0x60, 0x37, 0xF8,
+  0x05, 0x46, 0x12, 0x32, 0x12, 0x72, 0xF8, 0x2A, 0x2A, 0x2F, 0x82, 0x82,
+  0x11, 0x42, 0x12, 0x31, 0x51, 0xB1, 0x77, 0x74, 0xF3, 0x54, 0x61, 0x23,
+  0x21, 0x27, 0x2F, 0x82, 0xA2, 0xA2, 0xF8, 0x28, 0x21, 0x14, 0x21, 0x20,
+  0xF9, 0xE2, 0x10, 0x22, 0x02, 0x40, 0x2C, 0x03, 0x20, 0x21, 0x02, 0x08,
+  0x20, 0x4F, 0x8F, 0x2A, 0x22, 0x14, 0x12, 0xFF, 0x92, 0xFF, 0xD4, 0x32,
+  0x12, 0x04, 0x66, 0x12, 0x72, 0x92, 0x72, 0xF1, 0x29, 0x2E, 0x2B, 0x1E,
+  0x16, 0x21, 0x24, 0x21, 0x20, 0x05, 0x37, 0x12, 0x32, 0x12, 0xFE, 0x76,
+  0x7F, 0xFC, 0x21, 0x23, 0x21, 0x20, 0x52, 0x87, 0x43, 0x22, 0x11, 0x22,
+  0x61, 0xC4, 0xA2, 0xFF, 0x22, 0x12, 0x61, 0x49, 0x10, 0x0F, 0x01, 0x71,
+  0x2F, 0xFF, 0xFF, 0xF1, 0x21, 0x23, 0x21, 0x20, 0x42, 0x22, 0x71, 0x31,
+  0x61, 0x31, 0x3E, 0x18, 0xFF, 0x31, 0x21, 0xF0, 0x57, 0x5C, 0x1E, 0x1F,
+  0x92, 0x18, 0x10, 0x31, 0x31, 0xF2, 0x13, 0x17, 0x36, 0x73, 0x33, 0x31,
+  0x2F, 0x32, 0x19, 0x2A, 0xC1, 0x91, 0x91, 0x1A };
+
+const RleGlyph CourierCyr12pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,  14,    0,    1, 0 },  // 0x20 ' '
+  {     0,   3,  13,  14,    6,  -12, 2 },  // 0x21 '!'
+  {     4,   5,   6,  14,    5,  -12, 0 },  // 0x22 '"'
+  {     8,  10,  16,  14,    2,  -14, 2 },  // 0x23 '#'
+  {    25,   9,  19,  14,    3,  -15, 2 },  // 0x24 '$'
+  {    43,  10,  15,  14,    2,  -14, 0 },  // 0x25 '%'
+  {    62,  10,  13,  14,    2,  -12, 0 },  // 0x26 '&'
+  {    79,   2,   6,  14,    6,  -12, 1 },  // 0x27 '''
+  {    80,   3,  18,  14,    7,  -14, 2 },  // 0x28 '('
+  {    86,   4,  18,  14,    4,  -14, 2 },  // 0x29 ')'
+  {    94,   8,   9,  14,    3,  -14, 0 },  // 0x2A '*'
+  {   103,  10,  11,  14,    2,  -12, 2 },  // 0x2B '+'
+  {   110,   4,   5,  14,    5,   -1, 0 },  // 0x2C ','
+  {   113,   9,   1,  14,    3,   -6, 1 },  // 0x2D '-'
+  {   114,   3,   3,  14,    6,   -2, 1 },  // 0x2E '.'
+  {   115,   8,  17,  14,    3,  -14, 2 },  // 0x2F '/'
+  {   125,   9,  15,  14,    3,  -14, 0 },  // 0x30 '0'
+  {   142,  10,  15,  14,    2,  -14, 2 },  // 0x31 '1'
+  {   153,   9,  15,  14,    2,  -14, 0 },  // 0x32 '2'
+  {   170,   9,  15,  14,    2,  -14, 2 },  // 0x33 '3'
+  {   186,  10,  15,  14,    2,  -14, 2 },  // 0x34 '4'
+  {   200,  10,  14,  14,    2,  -13, 2 },  // 0x35 '5'
+  {   215,   9,  15,  14,    3,  -14, 0 },  // 0x36 '6'
+  {   232,   9,  14,  14,    2,  -13, 2 },  // 0x37 '7'
+  {   242,   9,  15,  14,    3,  -14, 0 },  // 0x38 '8'
+  {   259,   9,  15,  14,    3,  -14, 0 },  // 0x39 '9'
+  {   276,   3,   9,  14,    6,   -8, 1 },  // 0x3A ':'
+  {   278,   4,  12,  14,    5,   -8, 0 },  // 0x3B ';'
+  {   284,  11,  10,  14,    1,   -9, 1 },  // 0x3C '<'
+  {   294,  10,   5,  14,    2,   -9, 1 },  // 0x3D '='
+  {   297,  11,  10,  14,    2,   -9, 1 },  // 0x3E '>'
+  {   308,   9,  13,  14,    3,  -12, 2 },  // 0x3F '?'
+  {   318,  10,  15,  14,    2,  -14, 2 },  // 0x40 '@'
+  {   335,  14,  13,  14,    0,  -12, 2 },  // 0x41 'A'
+  {   352,  12,  13,  14,    1,  -12, 2 },  // 0x42 'B'
+  {   366,  12,  13,  14,    1,  -12, 0 },  // 0x43 'C'
+  {   386,  12,  13,  14,    1,  -12, 2 },  // 0x44 'D'
+  {   399,  12,  13,  14,    1,  -12, 2 },  // 0x45 'E'
+  {   412,  12,  13,  14,    1,  -12, 2 },  // 0x46 'F'
+  {   426,  12,  13,  14,    1,  -12, 2 },  // 0x47 'G'
+  {   441,  13,  13,  14,    1,  -12, 2 },  // 0x48 'H'
+  {   455,  10,  13,  14,    2,  -12, 2 },  // 0x49 'I'
+  {   463,  12,  13,  14,    1,  -12, 2 },  // 0x4A 'J'
+  {   475,  12,  13,  14,    1,  -12, 2 },  // 0x4B 'K'
+  {   494,  12,  13,  14,    1,  -12, 2 },  // 0x4C 'L'
+  {   505,  14,  13,  14,    0,  -12, 2 },  // 0x4D 'M'
+  {   522,  14,  13,  14,    0,  -12, 2 },  // 0x4E 'N'
+  {   538,  12,  13,  14,    1,  -12, 2 },  // 0x4F 'O'
+  {   553,  11,  13,  14,    2,  -12, 2 },  // 0x50 'P'
+  {   566,  12,  16,  14,    1,  -12, 2 },  // 0x51 'Q'
+  {   588,  13,  13,  14,    1,  -12, 2 },  // 0x52 'R'
+  {   604,  11,  13,  14,    2,  -12, 0 },  // 0x53 'S'
+  {   622,  12,  13,  14,    1,  -12, 2 },  // 0x54 'T'
+  {   633,  14,  13,  14,    0,  -12, 2 },  // 0x55 'U'
+  {   651,  14,  13,  14,    0,  -12, 2 },  // 0x56 'V'
+  {   666,  14,  13,  14,    0,  -12, 2 },  // 0x57 'W'
+  {   686,  13,  13,  14,    0,  -12, 0 },  // 0x58 'X'
+  {   708,  12,  13,  14,    1,  -12, 2 },  // 0x59 'Y'
+  {   725,  10,  13,  14,    2,  -12, 2 },  // 0x5A 'Z'
+  {   740,   3,  18,  14,    7,  -14, 2 },  // 0x5B '['
+  {   745,   8,  17,  14,    3,  -14, 2 },  // 0x5C
+  {   757,   4,  18,  14,    4,  -14, 2 },  // 0x5D ']'
+  {   762,  10,   6,  14,    2,  -14, 0 },  // 0x5E '^'
+  {   770,  14,   1,  14,    0,    3, 1 },  // 0x5F '_'
+  {   771,   5,   4,  14,    5,  -15, 0 },  // 0x60 '`'
+  {   774,  12,  10,  14,    1,   -9, 2 },  // 0x61 'a'
+  {   788,  13,  15,  14,    0,  -14, 2 },  // 0x62 'b'
+  {   805,  10,  10,  14,    2,   -9, 0 },  // 0x63 'c'
+  {   818,  13,  15,  14,    1,  -14, 2 },  // 0x64 'd'
+  {   835,  11,  10,  14,    2,   -9, 2 },  // 0x65 'e'
+  {   846,   9,  15,  14,    3,  -14, 2 },  // 0x66 'f'
+  {   859,  12,  14,  14,    1,   -9, 2 },  // 0x67 'g'
+  {   878,  13,  15,  14,    1,  -14, 2 },  // 0x68 'h'
+  {   894,  10,  15,  14,    2,  -14, 2 },  // 0x69 'i'
+  {   904,   8,  19,  14,    2,  -14, 2 },  // 0x6A 'j'
+  {   912,  12,  15,  14,    1,  -14, 2 },  // 0x6B 'k'
+  {   931,  10,  15,  14,    2,  -14, 2 },  // 0x6C 'l'
+  {   939,  14,  10,  14,    0,   -9, 2 },  // 0x6D 'm'
+  {   953,  13,  10,  14,    1,   -9, 2 },  // 0x6E 'n'
+  {   967,  11,  10,  14,    2,   -9, 2 },  // 0x6F 'o'
+  {   980,  13,  14,  14,    0,   -9, 2 },  // 0x70 'p'
+  {   998,  13,  14,  14,    1,   -9, 2 },  // 0x71 'q'
+  {  1016,  11,  10,  14,    2,   -9, 2 },  // 0x72 'r'
+  {  1028,  10,  10,  14,    2,   -9, 0 },  // 0x73 's'
+  {  1041,  11,  13,  14,    1,  -12, 2 },  // 0x74 't'
+  {  1052,  12,  10,  14,    1,   -9, 2 },  // 0x75 'u'
+  {  1064,  14,  10,  14,    0,   -9, 2 },  // 0x76 'v'
+  {  1079,  14,  10,  14,    0,   -9, 2 },  // 0x77 'w'
+  {  1096,  13,  10,  14,    0,   -9, 0 },  // 0x78 'x'
+  {  1113,  14,  14,  14,   -1,   -9, 2 },  // 0x79 'y'
+  {  1135,   9,  10,  14,    3,   -9, 1 },  // 0x7A 'z'
+  {  1145,   5,  18,  14,    5,  -14, 0 },  // 0x7B '{'
+  {  1157,   1,  17,  14,    7,  -14, 1 },  // 0x7C '|'
+  {  1159,   6,  18,  14,    4,  -14, 2 },  // 0x7D '}'
+  {  1172,  11,   3,  14,    2,   -6, 0 },  // 0x7E '~'
+  {  1177,  12,  15,  18,    3,  -14, 2 },  // 0x7F
+  {  1185,  13,  15,  14,    0,  -10, 2 },  // 0x80
+  {  1207,  11,  11,  14,    2,  -10, 2 },  // 0x81
+  {  1220,  12,  10,  14,    1,   -9, 2 },  // 0x82
+  {  1229,  13,  14,  14,    0,   -9, 2 },  // 0x83
+  {  1249,  12,  19,  14,    1,  -14, 2 },  // 0x84
+  {  1274,  13,  10,  14,    1,   -9, 0 },  // 0x85
+  {  1291,  13,  13,  14,    1,   -9, 2 },  // 0x86
+  {  1303,  12,  10,  14,    1,   -9, 2 },  // 0x87
+  {  1315,  13,  10,  14,    1,   -9, 2 },  // 0x88
+  {  1330,  13,  13,  14,    1,   -9, 2 },  // 0x89
+  {  1346,  13,  10,  14,    0,   -9, 2 },  // 0x8A
+  {  1357,  13,  10,  14,    1,   -9, 2 },  // 0x8B
+  {  1370,  12,  10,  14,    1,   -9, 2 },  // 0x8C
+  {  1380,  12,  11,  14,    1,  -10, 2 },  // 0x8D
+  {  1394,  13,  11,  14,    1,  -10, 0 },  // 0x8E
+  {  1412,  13,  10,  14,    0,   -9, 2 },  // 0x8F
+  {  1426,  14,  13,  14,    0,  -12, 2 },  // 0x90
+  {  1443,  12,  13,  14,    1,  -12, 2 },  // 0x91
+  {  1456,  12,  13,  14,    1,  -12, 2 },  // 0x92
+  {  1471,  12,  13,  14,    1,  -12, 2 },  // 0x93
+  {  1480,  12,  16,  14,    1,  -12, 2 },  // 0x94
+  {  1494,  12,  13,  14,    1,  -12, 2 },  // 0x95
+  {  1507,  12,  13,  14,    1,  -12, 0 },  // 0x96
+  {  1527,  10,  14,  14,    2,  -13, 0 },  // 0x97
+  {  1545,  12,  13,  14,    1,  -12, 2 },  // 0x98
+  {  1562,  12,  17,  14,    1,  -16, 2 },  // 0x99
+  {  1585,  13,  13,  14,    1,  -12, 2 },  // 0x9A
+  {  1605,  12,  13,  14,    1,  -12, 2 },  // 0x9B
+  {  1617,  14,  13,  14,    0,  -12, 2 },  // 0x9C
+  {  1635,  12,  13,  14,    1,  -12, 2 },  // 0x9D
+  {  1649,  12,  14,  14,    1,  -13, 2 },  // 0x9E
+  {  1666,  12,  13,  14,    1,  -12, 2 },  // 0x9F
+  {  1677,  11,  13,  14,    2,  -12, 2 },  // 0xA0
+  {  1690,  12,  14,  14,    1,  -13, 2 },  // 0xA1
+  {  1706,  12,  13,  14,    1,  -12, 2 },  // 0xA2
+  {  1717,  14,  13,  14,    0,  -12, 2 },  // 0xA3
+  {  1735,  12,  14,  14,    1,  -13, 0 },  // 0xA4
+  {  1756,  13,  13,  14,    1,  -12, 0 },  // 0xA5
+  {  1778,  12,  16,  14,    1,  -12, 2 },  // 0xA6
+  {  1791,  12,  13,  14,    1,  -12, 2 },  // 0xA7
+  {  1805,  13,  13,  14,    1,  -12, 2 },  // 0xA8
+  {  1821,  13,  16,  14,    1,  -12, 2 },  // 0xA9
+  {  1838,  13,  13,  14,    0,  -12, 2 },  // 0xAA
+  {  1852,  13,  13,  14,    1,  -12, 2 },  // 0xAB
+  {  1868,  12,  13,  14,    1,  -12, 2 },  // 0xAC
+  {  1880,  12,  14,  14,    1,  -13, 2 },  // 0xAD
+  {  1898,  13,  14,  14,    1,  -13, 2 },  // 0xAE
+  {  1919,  13,  13,  14,    1,  -12, 2 },  // 0xAF
+  {  1936,  12,  11,  14,    1,  -10, 2 },  // 0xB0
+  {  1951,  11,  15,  14,    2,  -14, 2 },  // 0xB1
+  {  1966,  11,  10,  14,    2,   -9, 2 },  // 0xB2
+  {  1977,  11,  10,  14,    2,   -9, 2 },  // 0xB3
+  {  1985,  12,  13,  14,    1,   -9, 2 },  // 0xB4
+  {  1998,  11,  11,  14,    2,  -10, 2 },  // 0xB5
+  {  2011,  12,  10,  14,    1,   -9, 0 },  // 0xB6
+  {  2026,  10,  11,  14,    2,  -10, 0 },  // 0xB7
+  {  2040,  13,  10,  14,    1,   -9, 2 },  // 0xB8
+  {  2055,  13,  15,  14,    1,  -14, 2 },  // 0xB9
+  {  2076,  12,  10,  14,    1,   -9, 0 },  // 0xBA
+  {  2091,  12,  10,  14,    1,   -9, 2 },  // 0xBB
+  {  2101,  14,  10,  14,    0,   -9, 2 },  // 0xBC
+  {  2117,  13,  10,  14,    1,   -9, 2 },  // 0xBD
+  {  2130,  12,  11,  14,    1,  -10, 2 },  // 0xBE
+  {  2145,  13,  10,  14,    1,   -9, 2 },  // 0xBF
+  {  2156,  12,  16,  14,    1,  -15, 2 },  // 0xC0
+  {  2175,  11,  14,  14,    2,  -13, 2 }   // 0xC1
+};
+
+const RleFont CourierCyr12pt8bRle PROGMEM = {
+  CourierCyr12pt8bRleData,
+  CourierCyr12pt8bRleGlyphs,
+  0x20, 0xC1, 20 };
+
+#endif // COURIERCYR12PT8BRLE_H_
@@ -0,0 +1,396 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr14.h, do not edit.
+// 162 glyphs (1 sharing another's bitmap), 2605 bytes of bitmap data (GFXfont: 3627)
+#ifndef COURIERCYR14PT8BRLE_H_
+#define COURIERCYR14PT8BRLE_H_
+
+const uint8_t CourierCyr14pt8bRleData[] PROGMEM = {
+  0x11, 0xFE, 0x14, 0x36, 0x02, 0x22, 0xFF, 0x00, 0x31, 0x41, 0x92, 0xFF,
+  0x53, 0x13, 0x16, 0x13, 0x13, 0xFF, 0xE3, 0x13, 0x16, 0x13, 0x13, 0xF9,
+  0x2F, 0xE0, 0x51, 0xFC, 0x21, 0x11, 0x21, 0x71, 0x44, 0x1A, 0x1C, 0x18,
+  0x11, 0x27, 0x67, 0x58, 0x3A, 0x1F, 0x21, 0x22, 0x41, 0x11, 0x18, 0x11,
+  0x22, 0x11, 0xF8, 0x38, 0x11, 0x08, 0x22, 0x08, 0x82, 0x11, 0x03, 0x8C,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x70, 0x22, 0x10, 0x44, 0x11, 0x04, 0x22, 0x07,
+  0x00, 0x1E, 0x03, 0x10, 0x20, 0x02, 0x00, 0x20, 0x01, 0x00, 0x10, 0x01,
+  0x80, 0x6C, 0x74, 0x44, 0x86, 0x88, 0x38, 0x81, 0x04, 0x28, 0x3C, 0xF0,
+  0x0C, 0x22, 0x31, 0x52, 0x92, 0xFF, 0x02, 0xF0, 0x24, 0x10, 0x02, 0x31,
+  0x52, 0x92, 0xE2, 0xFD, 0x2C, 0x27, 0x22, 0x14, 0x04, 0x01, 0x08, 0x47,
+  0xD7, 0x1F, 0x03, 0x81, 0xA0, 0xC4, 0x21, 0x00, 0x61, 0xFF, 0xF8, 0x61,
+  0xB1, 0x5F, 0xFF, 0x30, 0x37, 0x66, 0x4C, 0x80, 0x0A, 0x6F, 0x60, 0x81,
+  0xF1, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF9, 0x2F, 0x02, 0xF0, 0x2F, 0x92,
+  0x70, 0x34, 0x56, 0x32, 0x42, 0xB2, 0x62, 0xFF, 0xFF, 0xF5, 0x26, 0x2B,
+  0x24, 0x23, 0x62, 0x51, 0x63, 0x52, 0x12, 0x53, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x75, 0x14, 0x34, 0x42, 0x42, 0x21, 0x61, 0x21, 0x71, 0x91, 0x91, 0x91,
+  0x81, 0x82, 0x72, 0x72, 0x72, 0x72, 0x72, 0x51, 0x12, 0x63, 0x7B, 0x34,
+  0x47, 0x23, 0x51, 0x11, 0x61, 0xFE, 0x27, 0x17, 0x21, 0x16, 0x58, 0x1A,
+  0x2F, 0xD1, 0x12, 0x51, 0x1A, 0x10, 0x72, 0x91, 0xC1, 0x92, 0xF6, 0x29,
+  0x1C, 0x19, 0x2F, 0x62, 0x92, 0xB7, 0x1B, 0x13, 0xFD, 0x41, 0x30, 0x19,
+  0x38, 0xFF, 0xF3, 0x55, 0x82, 0x25, 0x1B, 0x2F, 0xFC, 0x46, 0x12, 0xA1,
+  0x07, 0xC6, 0x03, 0x01, 0x80, 0x40, 0x10, 0x08, 0x02, 0x78, 0xA1, 0xB0,
+  0x28, 0x06, 0x01, 0x80, 0x70, 0x14, 0x08, 0x86, 0x1F, 0x00, 0x0B, 0x19,
+  0xA2, 0xB1, 0x72, 0xFF, 0x02, 0xFF, 0x02, 0xFF, 0x02, 0xF4, 0x16, 0x1E,
+  0x18, 0x6C, 0x0E, 0x01, 0x80, 0x60, 0x14, 0x09, 0x86, 0x1E, 0x18, 0x6C,
+  0x0E, 0x01, 0x80, 0x60, 0x14, 0x09, 0x86, 0x1E, 0x00, 0x34, 0x47, 0x41,
+  0x42, 0x12, 0xF1, 0x2F, 0xF0, 0x26, 0x13, 0x14, 0x22, 0x75, 0x41, 0x2F,
+  0x22, 0xF1, 0x32, 0x73, 0x6F, 0x60, 0x00, 0x06, 0xF6, 0x33, 0xCC, 0x00,
+  0x00, 0x0E, 0x63, 0x11, 0x8C, 0x00, 0xC1, 0x93, 0x83, 0x82, 0x92, 0x92,
+  0xA3, 0xD2, 0xD2, 0xD3, 0xC3, 0xD1, 0x0B, 0xFF, 0xFA, 0xB0, 0x01, 0xD3,
+  0xC3, 0xD2, 0xD2, 0xD2, 0xB3, 0x82, 0x92, 0x83, 0x83, 0x91, 0xC0, 0x16,
+  0x21, 0x14, 0x11, 0x21, 0x44, 0xFF, 0x32, 0x44, 0x44, 0xE1, 0xF1, 0x3F,
+  0x70, 0x45, 0x68, 0x41, 0x11, 0x52, 0x41, 0xA1, 0xD1, 0xF3, 0x38, 0x57,
+  0x11, 0x1B, 0x1F, 0xA1, 0x31, 0x71, 0x14, 0x14, 0x34, 0x13, 0x21, 0xB1,
+  0x11, 0x52, 0x49, 0x20, 0x36, 0xA4, 0xF0, 0x4F, 0xC2, 0x22, 0xFF, 0xB2,
+  0x42, 0xF8, 0x11, 0x61, 0x17, 0x86, 0x29, 0x1E, 0x1F, 0x42, 0x12, 0x62,
+  0x12, 0x0A, 0x32, 0x18, 0xC2, 0xFF, 0x71, 0xB1, 0x11, 0x46, 0x11, 0x59,
+  0xB1, 0x11, 0xB1, 0xFF, 0x75, 0x17, 0x11, 0x10, 0x45, 0x31, 0x31, 0x16,
+  0x43, 0x43, 0x22, 0x81, 0x11, 0xD1, 0xA1, 0xFF, 0xF7, 0x2F, 0xA2, 0x91,
+  0x23, 0x53, 0x39, 0x10, 0x0A, 0x32, 0x16, 0x11, 0xB3, 0xFA, 0x2F, 0xFF,
+  0xFF, 0x11, 0xD1, 0xA1, 0xB1, 0x11, 0x12, 0x18, 0x20, 0x0F, 0x01, 0x9F,
+  0xFF, 0x31, 0x31, 0xF1, 0x58, 0x5F, 0xB1, 0x31, 0xFF, 0x92, 0x19, 0x10,
+  0x0E, 0x18, 0xFF, 0xF0, 0x12, 0x1F, 0x05, 0x75, 0xF9, 0x1F, 0xF9, 0x21,
+  0x45, 0x46, 0x21, 0x41, 0x16, 0x53, 0x52, 0x32, 0x81, 0x21, 0xE1, 0xA1,
+  0xFF, 0x76, 0x84, 0x13, 0xFC, 0x2D, 0x36, 0x15, 0x11, 0x81, 0x05, 0x47,
+  0x12, 0x42, 0x12, 0xFF, 0xFF, 0xD8, 0x68, 0xFF, 0xFF, 0xD2, 0x12, 0x42,
+  0x12, 0x0F, 0x01, 0x4F, 0xFF, 0xFF, 0xFF, 0xF0, 0x51, 0x40, 0x4A, 0x46,
+  0x13, 0xFF, 0xFF, 0xF9, 0x1F, 0xFF, 0xB1, 0x71, 0x41, 0x11, 0x51, 0x11,
+  0x47, 0x11, 0x40, 0x05, 0x37, 0x12, 0x32, 0x12, 0x92, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA1, 0x11, 0x95, 0x81, 0x32, 0xFA, 0x2F, 0xA2, 0x22, 0x12, 0x62,
+  0x08, 0x63, 0x14, 0xFF, 0xFF, 0xFF, 0xFC, 0x1C, 0x2F, 0xFC, 0x31, 0x82,
+  0x04, 0x86, 0x21, 0x61, 0x22, 0x31, 0x81, 0xF8, 0x24, 0x2F, 0xA2, 0x22,
+  0xFC, 0x4F, 0xFF, 0x02, 0xFF, 0x92, 0x13, 0x43, 0x12, 0x04, 0x58, 0x73,
+  0x12, 0x32, 0xE2, 0xFE, 0x2F, 0xE2, 0xE2, 0xFE, 0x2F, 0xE2, 0xF0, 0x13,
+  0x21, 0x34, 0x14, 0x46, 0x71, 0x14, 0x11, 0x53, 0x43, 0x32, 0x82, 0xF0,
+  0x2A, 0x2F, 0xFF, 0xB2, 0xA2, 0xF0, 0x28, 0x23, 0x34, 0x35, 0x11, 0x41,
+  0x13, 0x09, 0x32, 0x18, 0xA1, 0xC2, 0xFF, 0x41, 0xA1, 0x11, 0x36, 0x11,
+  0x47, 0xFF, 0xF5, 0x21, 0x45, 0x46, 0x72, 0x42, 0x51, 0x81, 0x31, 0xA1,
+  0x21, 0xA1, 0x11, 0xC2, 0xC2, 0xC2, 0xC2, 0xC3, 0xA1, 0x21, 0xA1, 0x31,
+  0x81, 0x43, 0x42, 0x76, 0x91, 0xC5, 0x82, 0x32, 0x21, 0x41, 0x55, 0x0A,
+  0x42, 0x18, 0xD2, 0xFF, 0xA1, 0xC1, 0x11, 0x56, 0x11, 0x64, 0x21, 0xB1,
+  0x11, 0xC1, 0xE2, 0xFC, 0x22, 0x21, 0x27, 0x20, 0x45, 0x21, 0x29, 0x21,
+  0x11, 0x51, 0x41, 0x71, 0xF9, 0x11, 0x2B, 0x76, 0x8A, 0x4F, 0x91, 0x81,
+  0x31, 0x61, 0x11, 0x1A, 0x10, 0x1C, 0x35, 0x14, 0x21, 0xB2, 0x11, 0xFF,
+  0xA1, 0xC1, 0xFF, 0xFF, 0xFF, 0xB4, 0x13, 0x30, 0x06, 0x38, 0x13, 0x33,
+  0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x22, 0x72, 0x61, 0x51, 0x79, 0x30,
+  0x06, 0x57, 0x13, 0x52, 0x12, 0xF3, 0x28, 0x2F, 0x62, 0x62, 0xFF, 0x92,
+  0x42, 0xFE, 0x2A, 0x2F, 0xF1, 0x4F, 0x70, 0x05, 0x66, 0x13, 0x63, 0x11,
+  0xF2, 0x24, 0x15, 0x29, 0x1F, 0xE2, 0xF1, 0x2F, 0xC2, 0x22, 0xF2, 0x24,
+  0x2F, 0x12, 0x42, 0xFF, 0x60, 0x78, 0x78, 0x80, 0x41, 0x02, 0x02, 0x10,
+  0x0C, 0xC0, 0x12, 0x00, 0x30, 0x00, 0xC0, 0x04, 0x80, 0x12, 0x00, 0x84,
+  0x04, 0x08, 0x20, 0x10, 0x80, 0x4F, 0x87, 0xC0, 0x05, 0x56, 0x12, 0x51,
+  0x12, 0x22, 0xF5, 0x25, 0x2D, 0x23, 0x2B, 0x1A, 0x22, 0x1A, 0x3F, 0xFF,
+  0xFF, 0x34, 0x13, 0x30, 0x0A, 0x28, 0xA2, 0x81, 0xB1, 0x21, 0x52, 0x82,
+  0x81, 0xB1, 0x82, 0x82, 0x61, 0xC2, 0x82, 0xA9, 0x10, 0x05, 0x14, 0xFF,
+  0xFF, 0xFB, 0x40, 0x01, 0xF2, 0x2F, 0x22, 0xF2, 0x2F, 0x22, 0xFB, 0x2F,
+  0x22, 0xF2, 0x2F, 0xB2, 0x09, 0xFF, 0xFF, 0xFB, 0x41, 0x04, 0x01, 0xC0,
+  0x28, 0x08, 0x82, 0x08, 0x80, 0xA0, 0x08, 0xFF, 0xFF, 0xE0, 0xC1, 0x02,
+  0x04, 0x35, 0x58, 0x42, 0x52, 0xFD, 0x74, 0x11, 0x63, 0x3F, 0xE1, 0x32,
+  0x43, 0x47, 0x22, 0x03, 0xB2, 0xFF, 0xFF, 0x04, 0x88, 0x53, 0x43, 0xF3,
+  0x18, 0x2F, 0xFF, 0x01, 0x82, 0xF2, 0x34, 0x31, 0x22, 0x82, 0x45, 0x21,
+  0x2A, 0x13, 0x51, 0xC4, 0x91, 0xFF, 0x62, 0xF6, 0x11, 0x35, 0x32, 0x91,
+  0x66, 0x85, 0xFF, 0xF4, 0x48, 0x85, 0x34, 0x3F, 0x22, 0x81, 0xFF, 0xF0,
+  0x28, 0x1F, 0x33, 0x43, 0x58, 0x22, 0x45, 0x52, 0x42, 0x32, 0x71, 0x21,
+  0x92, 0xA2, 0xAE, 0xB1, 0xC1, 0x91, 0x22, 0x53, 0x45, 0x30, 0x47, 0x31,
+  0x16, 0x41, 0xFD, 0x31, 0x61, 0x31, 0x6F, 0xFF, 0xFF, 0xFA, 0x31, 0x61,
+  0x45, 0x23, 0x26, 0x11, 0x22, 0x13, 0x43, 0x31, 0xE1, 0x81, 0xFF, 0xF0,
+  0x28, 0x1F, 0x33, 0x43, 0x58, 0x84, 0xF6, 0x17, 0x33, 0x81, 0x13, 0x03,
+  0xB2, 0xFF, 0xFF, 0x04, 0x87, 0x63, 0x42, 0x51, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x21, 0x24, 0x21, 0x20, 0x42, 0xFD, 0x2E, 0x64, 0x5F, 0xFF, 0xFF, 0xF5,
+  0x51, 0x40, 0x72, 0xFA, 0x2A, 0x81, 0x7F, 0xFF, 0xFF, 0xFF, 0x21, 0x71,
+  0x17, 0x11, 0x10, 0x04, 0xA3, 0xFF, 0xFF, 0x15, 0x91, 0x22, 0x93, 0xA2,
+  0xA3, 0xA1, 0xD4, 0xD2, 0xD2, 0xD2, 0xD2, 0x32, 0x62, 0x12, 0x06, 0x45,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x51, 0x40, 0x03, 0x14, 0x23, 0x32, 0x14,
+  0x14, 0x11, 0x51, 0x31, 0x11, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x12,
+  0x42, 0x32, 0x03, 0x34, 0x42, 0x27, 0x63, 0x42, 0x51, 0xFF, 0xFF, 0xFF,
+  0xF3, 0x21, 0x24, 0x21, 0x20, 0x45, 0x69, 0x31, 0x11, 0x51, 0x11, 0x31,
+  0x71, 0x22, 0x92, 0xFF, 0x92, 0x92, 0xA1, 0x33, 0x51, 0x11, 0x39, 0x20,
+  0x03, 0x34, 0x42, 0x28, 0x53, 0x43, 0xF3, 0x18, 0x2F, 0xFF, 0x01, 0x82,
+  0xF2, 0x34, 0x35, 0x88, 0x4F, 0xF2, 0x21, 0x47, 0x44, 0x33, 0x28, 0x22,
+  0x13, 0x43, 0xF2, 0x28, 0x1F, 0xFF, 0x02, 0x81, 0xF3, 0x34, 0x35, 0x88,
+  0x4F, 0xFB, 0x41, 0x20, 0x04, 0x44, 0x13, 0x37, 0x53, 0x41, 0x42, 0xB1,
+  0xFF, 0xFF, 0xFB, 0x31, 0x54, 0x26, 0x11, 0x28, 0x22, 0x61, 0xF7, 0x11,
+  0x39, 0x11, 0x64, 0xA8, 0x1D, 0x26, 0x21, 0x91, 0x21, 0xFF, 0x02, 0x17,
+  0x12, 0x17, 0xFF, 0xFF, 0xFD, 0x12, 0x25, 0x14, 0x80, 0x03, 0x63, 0x22,
+  0x72, 0xFF, 0xFF, 0xFF, 0xF6, 0x15, 0x25, 0x17, 0x81, 0x20, 0x05, 0x57,
+  0x12, 0x52, 0x12, 0x22, 0x72, 0xF5, 0x25, 0x2F, 0xF7, 0x23, 0x2F, 0x92,
+  0x12, 0xFB, 0x36, 0x05, 0x66, 0x13, 0x63, 0x11, 0x71, 0x52, 0x22, 0x51,
+  0xFE, 0x4F, 0xF4, 0x24, 0x21, 0x22, 0x2F, 0xA2, 0xF5, 0x24, 0xF8, 0x3E,
+  0x20, 0x20, 0x20, 0x80, 0x22, 0x00, 0x28, 0x00, 0x20, 0x00, 0xA0, 0x02,
+  0x20, 0x08, 0x20, 0x30, 0x20, 0xC0, 0x67, 0xC1, 0xF0, 0x05, 0x57, 0x12,
+  0x52, 0x12, 0xF2, 0x27, 0x2C, 0x17, 0x26, 0x1C, 0x28, 0x2F, 0x22, 0xA2,
+  0xF0, 0x2C, 0x1E, 0x2C, 0x1F, 0x01, 0x85, 0x12, 0x70, 0x0B, 0x73, 0x62,
+  0x72, 0x72, 0x81, 0x81, 0x81, 0x81, 0x61, 0x11, 0x72, 0x8B, 0x42, 0x33,
+  0x22, 0xFF, 0x92, 0x32, 0x43, 0x41, 0xFF, 0x71, 0x44, 0x0F, 0x40, 0x02,
+  0x43, 0x52, 0xFF, 0xB2, 0x52, 0x33, 0x41, 0xFF, 0x32, 0x23, 0x30, 0x78,
+  0x1C, 0xE2, 0x83, 0xC0, 0x0E, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF3, 0xC1, 0x04, 0x34, 0x43, 0x28, 0x63, 0x41, 0x11, 0x51, 0x71, 0xF1,
+  0x1D, 0x1F, 0xE1, 0xF0, 0x14, 0x1E, 0x26, 0x26, 0x88, 0x6F, 0xF3, 0x31,
+  0x47, 0x45, 0x21, 0x29, 0x21, 0x11, 0x51, 0x41, 0x71, 0x12, 0x91, 0xFF,
+  0x71, 0xA1, 0xA1, 0x12, 0x71, 0x3A, 0x1C, 0x35, 0x14, 0xE4, 0xFB, 0x1C,
+  0x1F, 0xFF, 0xFD, 0x41, 0x33, 0x04, 0x65, 0x11, 0xA1, 0x41, 0x91, 0x42,
+  0x71, 0x61, 0x62, 0x62, 0x51, 0x81, 0x42, 0x82, 0x31, 0xA1, 0x21, 0xC1,
+  0x11, 0xC2, 0xD2, 0xD1, 0xD1, 0xE1, 0x98, 0x70, 0x44, 0xA3, 0xFF, 0xF9,
+  0x21, 0x27, 0x41, 0x35, 0x35, 0x23, 0x28, 0x2F, 0x01, 0xB2, 0xE1, 0xB1,
+  0xE1, 0x21, 0x81, 0x31, 0x11, 0x61, 0x11, 0x35, 0x12, 0x11, 0x63, 0x13,
+  0xFF, 0x44, 0x13, 0x30, 0xF8, 0x7C, 0x80, 0x41, 0x02, 0x02, 0x10, 0x04,
+  0x80, 0x0C, 0x00, 0x30, 0x01, 0x20, 0x08, 0x40, 0x40, 0x82, 0x01, 0x3E,
+  0x1F, 0x05, 0x47, 0x12, 0x42, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x18,
+  0x1F, 0x0F, 0xE0, 0x05, 0x47, 0x12, 0x42, 0x12, 0xFF, 0xE2, 0xE7, 0x68,
+  0xFF, 0xF8, 0x31, 0x20, 0x04, 0x14, 0x16, 0x11, 0x12, 0x11, 0x11, 0x12,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x14, 0x13, 0x12, 0x04, 0x14, 0x16, 0x11,
+  0x12, 0x11, 0x11, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x62, 0x14, 0x13, 0x1F,
+  0x0F, 0xE0, 0x07, 0x83, 0x12, 0xFF, 0x51, 0xF3, 0x59, 0x8B, 0x21, 0x1C,
+  0x1F, 0xC1, 0x32, 0x19, 0x05, 0x55, 0x13, 0x52, 0x11, 0xFF, 0xE4, 0xA7,
+  0xB4, 0xFF, 0xA1, 0x51, 0x1A, 0x11, 0x06, 0x72, 0x13, 0xFF, 0xF4, 0x67,
+  0x9A, 0x21, 0x1B, 0x1F, 0xA4, 0x19, 0x10, 0x01, 0x35, 0x63, 0x52, 0x41,
+  0x91, 0x31, 0xA1, 0x11, 0xB1, 0xD1, 0x69, 0xC1, 0xD1, 0xC2, 0x21, 0x82,
+  0x48, 0x40, 0x05, 0x33, 0x32, 0x12, 0x17, 0x61, 0x11, 0x31, 0x81, 0x52,
+  0xFF, 0x12, 0xC2, 0xFF, 0x51, 0x62, 0x63, 0x12, 0x17, 0x10, 0x68, 0x38,
+  0x12, 0x24, 0xFF, 0x92, 0xB2, 0x16, 0x71, 0x15, 0x71, 0xC1, 0x11, 0xA1,
+  0x11, 0x92, 0x11, 0x43, 0x12, 0x36, 0xA4, 0xF0, 0x4F, 0xF1, 0x2A, 0x2F,
+  0xE2, 0x42, 0xFA, 0x61, 0x16, 0x9F, 0x72, 0x82, 0xF3, 0x21, 0x35, 0x21,
+  0x20, 0x0D, 0x13, 0x18, 0xFF, 0xFB, 0x15, 0x59, 0x8B, 0x4D, 0x2F, 0xFA,
+  0x1C, 0x11, 0x41, 0x71, 0x11, 0x0B, 0x33, 0x18, 0xD2, 0xFF, 0xA2, 0xA3,
+  0x65, 0x21, 0x67, 0x11, 0xC1, 0x11, 0xC1, 0xFC, 0x1C, 0x11, 0x41, 0x71,
+  0x11, 0x0C, 0x12, 0x18, 0xFB, 0x2F, 0xA1, 0xFF, 0xFF, 0xFF, 0xE2, 0x14,
+  0x60, 0x2C, 0x22, 0x16, 0x12, 0xFF, 0xFF, 0xFF, 0xFA, 0x2F, 0xF9, 0x1B,
+  0x22, 0x71, 0x21, 0xCF, 0xE0, 0x0C, 0x12, 0x18, 0xFB, 0x2F, 0x61, 0x31,
+  0xF1, 0x58, 0x5F, 0xB1, 0x31, 0xFF, 0x92, 0x19, 0x10, 0xF7, 0x9C, 0x84,
+  0x41, 0x11, 0x04, 0x48, 0x09, 0x40, 0x25, 0x00, 0xDC, 0x06, 0xE8, 0x13,
+  0x20, 0x44, 0x42, 0x11, 0x08, 0x44, 0x21, 0x10, 0x84, 0x4E, 0x7C, 0xC0,
+  0x01, 0x33, 0x58, 0x21, 0x12, 0x33, 0xF9, 0x1F, 0xB4, 0x52, 0x31, 0x55,
+  0x11, 0x91, 0xFF, 0x42, 0x71, 0x11, 0x19, 0x05, 0x56, 0x12, 0x72, 0x92,
+  0xFA, 0x2F, 0xA2, 0xFA, 0x2B, 0x1E, 0x1B, 0x1E, 0x1B, 0x29, 0x27, 0x21,
+  0x20, 0x31, 0x61, 0x62, 0xE6, 0x76, 0x45, 0x56, 0x12, 0x72, 0x92, 0xFA,
+  0x2F, 0xA2, 0xFA, 0x2B, 0x1E, 0x1B, 0x1E, 0x1B, 0x29, 0x27, 0x21, 0x20,
+  0x06, 0x35, 0x13, 0x12, 0x31, 0x22, 0xA1, 0x11, 0xB1, 0x11, 0xB1, 0x11,
+  0xB1, 0x11, 0xB1, 0x11, 0xB1, 0x21, 0xC4, 0xA1, 0x32, 0xFE, 0x2F, 0xE2,
+  0x33, 0x12, 0x63, 0x2C, 0x22, 0x16, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x72, 0x94, 0x43, 0x12, 0x05, 0x76, 0x11, 0x72, 0x12, 0xF5, 0x24, 0x1F,
+  0x11, 0x92, 0xF3, 0x2F, 0xC4, 0xFE, 0x1F, 0x11, 0xFF, 0x92, 0x13, 0x43,
+  0x12, 0x63, 0x83, 0x32, 0x52, 0x62, 0x32, 0x82, 0x21, 0xA1, 0x21, 0xA4,
+  0xB2, 0xC2, 0xC2, 0xC3, 0xB1, 0x11, 0xA2, 0x11, 0xA1, 0x31, 0x82, 0x32,
+  0x62, 0x67, 0x30, 0x0F, 0x11, 0x81, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x32, 0x13, 0x32, 0x12, 0x0A, 0x33, 0x18, 0xB1, 0xD2, 0xFF, 0x72, 0xA1,
+  0x68, 0x56, 0xFF, 0xFA, 0x31, 0x45, 0x63, 0x87, 0x11, 0x24, 0x33, 0x41,
+  0x71, 0x22, 0xF8, 0x1B, 0x11, 0x1F, 0xA1, 0xB1, 0xFF, 0x92, 0xC2, 0x72,
+  0x38, 0x11, 0x1F, 0x51, 0x5F, 0xFF, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xB4,
+  0x13, 0x30, 0x06, 0x57, 0x13, 0x52, 0x12, 0x22, 0x82, 0xF6, 0x26, 0x2F,
+  0x82, 0x41, 0xF1, 0x19, 0x22, 0x1F, 0x11, 0xB2, 0xF1, 0x2F, 0xF0, 0x1A,
+  0x58, 0x07, 0xC0, 0x04, 0x00, 0x78, 0x06, 0x5C, 0x21, 0x19, 0x04, 0x2C,
+  0x10, 0x60, 0x41, 0x81, 0x07, 0x04, 0x14, 0x10, 0xD8, 0x42, 0x31, 0x30,
+  0x3F, 0x00, 0x10, 0x01, 0xF0, 0xF8, 0x7C, 0xC0, 0x41, 0x02, 0x02, 0x10,
+  0x04, 0xC0, 0x12, 0x00, 0x30, 0x00, 0xC0, 0x04, 0x80, 0x13, 0x00, 0x84,
+  0x04, 0x08, 0x20, 0x10, 0x80, 0x2F, 0x87, 0xC0, 0x06, 0x37, 0x13, 0x32,
+  0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x21, 0x81, 0xF0, 0xFE, 0x05,
+  0x47, 0x12, 0x42, 0x12, 0xFF, 0xE2, 0xFD, 0x76, 0x8F, 0xFF, 0xFF, 0x63,
+  0x12, 0x04, 0x14, 0x16, 0x11, 0x12, 0x11, 0x11, 0x12, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x21, 0x41, 0x31, 0x20, 0x04, 0x14, 0x16, 0x11, 0x12,
+  0x11, 0x11, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x21, 0x41, 0x31,
+  0xF0, 0xFE, 0x08, 0x73, 0x13, 0xFF, 0xF3, 0x1F, 0x34, 0xA7, 0xB4, 0xD2,
+  0xFF, 0xF9, 0x22, 0x21, 0x81, 0x05, 0x55, 0x13, 0x52, 0x11, 0xFF, 0xFD,
+  0x3B, 0x6B, 0x4D, 0x2F, 0xFA, 0x1C, 0x11, 0x14, 0x11, 0x51, 0x11, 0x21,
+  0x10, 0x07, 0x73, 0x13, 0xFF, 0xFF, 0x75, 0x98, 0xB4, 0xD2, 0xFF, 0xA1,
+  0xC1, 0x14, 0x17, 0x11, 0x10, 0x53, 0x61, 0x27, 0x45, 0x34, 0x41, 0x71,
+  0xE2, 0x12, 0xC1, 0xFF, 0x27, 0x11, 0x57, 0x11, 0xFF, 0x91, 0xE1, 0x12,
+  0x82, 0x2B, 0x30, 0x82, 0x45, 0x25, 0x22, 0x12, 0x12, 0x23, 0x61, 0xE1,
+  0x52, 0xFF, 0xF0, 0x2C, 0x2F, 0xFF, 0xB2, 0x52, 0xB1, 0x22, 0x12, 0x15,
+  0x11, 0x10, 0x4B, 0x31, 0x16, 0x13, 0x41, 0xC1, 0xFE, 0x1F, 0x11, 0xD8,
+  0x91, 0x14, 0x91, 0xF0, 0x1C, 0x2C, 0x1F, 0x01, 0xA4, 0x52, 0x13, 0x35,
+  0x69, 0x42, 0x51, 0xFF, 0x27, 0x49, 0x51, 0xFF, 0x21, 0x51, 0x51, 0x51,
+  0x17, 0x13, 0x00, 0xE1, 0xF8, 0x60, 0x04, 0x00, 0xC0, 0x08, 0x60, 0x99,
+  0xCA, 0x06, 0xC0, 0x38, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x40,
+  0x36, 0x06, 0x3F, 0x80, 0x08, 0x42, 0x18, 0x92, 0xD1, 0xB1, 0x83, 0x45,
+  0x21, 0x49, 0xFF, 0x41, 0x12, 0x17, 0x11, 0x0C, 0x14, 0x16, 0xFF, 0x92,
+  0xC1, 0xFF, 0xFF, 0x54, 0x14, 0x40, 0x2C, 0x22, 0x16, 0x12, 0xFF, 0xFF,
+  0xFF, 0xB2, 0xF8, 0x31, 0x71, 0x21, 0xCF, 0xE0, 0x45, 0x69, 0x31, 0x11,
+  0x51, 0x51, 0x72, 0x12, 0xFA, 0xB2, 0xA3, 0x1B, 0x1D, 0x28, 0x22, 0xB0,
+  0xF7, 0xBC, 0x84, 0x22, 0x11, 0x04, 0x48, 0x09, 0x40, 0x37, 0x01, 0x32,
+  0x04, 0x4C, 0x21, 0x10, 0x84, 0x42, 0x11, 0x39, 0xE3, 0x01, 0x26, 0x42,
+  0x52, 0x31, 0x72, 0x21, 0x81, 0xA1, 0x74, 0xA3, 0xC1, 0xB2, 0xA3, 0x91,
+  0x29, 0x20, 0x05, 0x65, 0x12, 0x51, 0x12, 0x92, 0xB1, 0xE1, 0xB2, 0xB2,
+  0xFA, 0x2B, 0x2B, 0x1A, 0x22, 0x14, 0x21, 0x20, 0x32, 0x51, 0x61, 0x16,
+  0x76, 0xF3, 0x56, 0x51, 0x25, 0x11, 0x29, 0x2B, 0x1E, 0x1B, 0x2B, 0x2F,
+  0xA2, 0xB2, 0xB1, 0xA2, 0x21, 0x42, 0x12, 0xFC, 0xF8, 0x41, 0x81, 0x0C,
+  0x04, 0x40, 0x12, 0x00, 0x58, 0x01, 0x90, 0x04, 0x60, 0x10, 0xC0, 0x41,
+  0x81, 0x03, 0x3F, 0x1F, 0x2C, 0x22, 0x16, 0x12, 0xFF, 0xFF, 0xFF, 0xFA,
+  0x29, 0x35, 0x31, 0x20, 0x04, 0x86, 0x12, 0x92, 0xB2, 0x72, 0x41, 0xF1,
+  0x19, 0x22, 0x1F, 0x11, 0xB4, 0xFE, 0x2F, 0x82, 0x13, 0x43, 0x12, 0x05,
+  0x47, 0x12, 0x42, 0x12, 0xFF, 0xFE, 0x86, 0x8F, 0xFF, 0x02, 0x12, 0x42,
+  0x12, 0x44, 0x78, 0x43, 0x43, 0x21, 0x92, 0x21, 0xFF, 0x61, 0xC1, 0xD2,
+  0x81, 0x41, 0x61, 0x11, 0x2A, 0x20, 0x0F, 0x11, 0x81, 0x2F, 0xFF, 0xFF,
+  0xFF, 0xF6, 0x21, 0x24, 0x21, 0x20, 0x42, 0x22, 0x81, 0xB1, 0x32, 0x3C,
+  0x12, 0x18, 0xFB, 0x2F, 0x61, 0x31, 0xF1, 0x58, 0x5F, 0xB1, 0x31, 0xFF,
+  0x92, 0x19, 0x10, 0x31, 0x41, 0x81, 0x41, 0x62, 0x32, 0xF5, 0x56, 0x93,
+  0x11, 0x15, 0x15, 0x17, 0x21, 0x2F, 0xAB, 0x2A, 0x31, 0xB1, 0xD2, 0x82,
+  0x2B };
+
+const RleGlyph CourierCyr14pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,  16,    0,    1, 0 },  // 0x20 ' '
+  {     0,   3,  15,  16,    7,  -14, 2 },  // 0x21 '!'
+  {     4,   6,   6,  16,    5,  -14, 2 },  // 0x22 '"'
+  {     8,  11,  18,  16,    3,  -16, 2 },  // 0x23 '#'
+  {    26,  10,  21,  16,    3,  -17, 2 },  // 0x24 '$'
+  {    51,  10,  17,  16,    3,  -16, 0 },  // 0x25 '%'
+  {    73,  12,  15,  16,    2,  -14, 0 },  // 0x26 '&'
+  {    96,   2,   6,  16,    7,  -14, 1 },  // 0x27 '''
+  {    97,   4,  20,  16,    8,  -16, 2 },  // 0x28 '('
+  {   106,   5,  20,  16,    4,  -16, 2 },  // 0x29 ')'
+  {   116,  10,   9,  16,    3,  -15, 0 },  // 0x2A '*'
+  {   128,  12,  11,  16,    2,  -13, 2 },  // 0x2B '+'
+  {   136,   4,   7,  16,    6,   -2, 0 },  // 0x2C ','
+  {   140,  10,   1,  16,    3,   -6, 1 },  // 0x2D '-'
+  {   141,   4,   3,  16,    6,   -2, 0 },  // 0x2E '.'
+  {   143,   9,  19,  16,    4,  -16, 2 },  // 0x2F '/'
+  {   157,  10,  17,  16,    3,  -16, 2 },  // 0x30 '0'
+  {   171,  10,  17,  16,    3,  -16, 2 },  // 0x31 '1'
+  {   182,  10,  17,  16,    2,  -16, 1 },  // 0x32 '2'
+  {   203,  10,  17,  16,    2,  -16, 2 },  // 0x33 '3'
+  {   222,  12,  17,  16,    2,  -16, 2 },  // 0x34 '4'
+  {   239,  11,  16,  16,    2,  -15, 2 },  // 0x35 '5'
+  {   252,  10,  17,  16,    3,  -16, 0 },  // 0x36 '6'
+  {   274,  11,  16,  16,    2,  -15, 2 },  // 0x37 '7'
+  {   287,  10,  17,  16,    3,  -16, 0 },  // 0x38 '8'
+  {   309,  10,  17,  16,    3,  -16, 2 },  // 0x39 '9'
+  {   328,   4,  10,  16,    6,   -9, 0 },  // 0x3A ':'
+  {   333,   5,  13,  16,    5,   -9, 0 },  // 0x3B ';'
+  {   342,  13,  12,  16,    1,  -11, 1 },  // 0x3C '<'
+  {   354,  11,   7,  16,    3,  -11, 1 },  // 0x3D '='
+  {   358,  13,  12,  16,    2,  -11, 1 },  // 0x3E '>'
+  {   371,   9,  15,  16,    4,  -14, 2 },  // 0x3F '?'
+  {   385,  13,  17,  16,    2,  -16, 2 },  // 0x40 '@'
+  {   412,  16,  15,  16,    0,  -14, 2 },  // 0x41 'A'
+  {   433,  13,  15,  16,    2,  -14, 2 },  // 0x42 'B'
+  {   452,  13,  15,  16,    1,  -14, 2 },  // 0x43 'C'
+  {   472,  13,  15,  16,    2,  -14, 2 },  // 0x44 'D'
+  {   489,  13,  15,  16,    2,  -14, 2 },  // 0x45 'E'
+  {   504,  12,  15,  16,    2,  -14, 2 },  // 0x46 'F'
+  {   517,  14,  15,  16,    1,  -14, 2 },  // 0x47 'G'
+  {   538,  14,  15,  16,    1,  -14, 2 },  // 0x48 'H'
+  {   553,  10,  15,  16,    3,  -14, 2 },  // 0x49 'I'
+  {   562,  14,  15,  16,    1,  -14, 2 },  // 0x4A 'J'
+  {   579,  13,  15,  16,    2,  -14, 2 },  // 0x4B 'K'
+  {   600,  14,  15,  16,    1,  -14, 2 },  // 0x4C 'L'
+  {   612,  16,  15,  16,    0,  -14, 2 },  // 0x4D 'M'
+  {   633,  15,  15,  16,    1,  -14, 2 },  // 0x4E 'N'
+  {   651,  14,  15,  16,    1,  -14, 2 },  // 0x4F 'O'
+  {   673,  12,  15,  16,    3,  -14, 2 },  // 0x50 'P'
+  {   689,  14,  19,  16,    1,  -14, 1 },  // 0x51 'Q'
+  {   719,  14,  15,  16,    1,  -14, 2 },  // 0x52 'R'
+  {   740,  12,  15,  16,    2,  -14, 2 },  // 0x53 'S'
+  {   761,  14,  15,  16,    1,  -14, 2 },  // 0x54 'T'
+  {   776,  15,  15,  16,    1,  -14, 2 },  // 0x55 'U'
+  {   792,  16,  15,  16,    0,  -14, 2 },  // 0x56 'V'
+  {   811,  16,  15,  16,    0,  -14, 2 },  // 0x57 'W'
+  {   833,  14,  15,  16,    1,  -14, 0 },  // 0x58 'X'
+  {   860,  14,  15,  16,    1,  -14, 2 },  // 0x59 'Y'
+  {   880,  11,  15,  16,    3,  -14, 2 },  // 0x5A 'Z'
+  {   897,   5,  20,  16,    7,  -16, 2 },  // 0x5B '['
+  {   903,   9,  19,  16,    4,  -16, 2 },  // 0x5C
+  {   916,   5,  20,  16,    4,  -16, 2 },  // 0x5D ']'
+  {   921,  11,   7,  16,    3,  -16, 0 },  // 0x5E '^'
+  {   931,  16,   1,  16,    0,    3, 0 },  // 0x5F '_'
+  {   933,   6,   5,  16,    5,  -17, 0 },  // 0x60 '`'
+  {   937,  12,  12,  16,    2,  -11, 2 },  // 0x61 'a'
+  {   951,  14,  17,  16,    1,  -16, 2 },  // 0x62 'b'
+  {   970,  12,  12,  16,    2,  -11, 2 },  // 0x63 'c'
+  {   984,  14,  17,  16,    1,  -16, 2 },  // 0x64 'd'
+  {  1002,  12,  12,  16,    2,  -11, 1 },  // 0x65 'e'
+  {  1018,  11,  17,  16,    3,  -16, 2 },  // 0x66 'f'
+  {  1032,  14,  16,  16,    1,  -11, 2 },  // 0x67 'g'
+  {  1055,  14,  17,  16,    1,  -16, 2 },  // 0x68 'h'
+  {  1072,  10,  17,  16,    3,  -16, 2 },  // 0x69 'i'
+  {  1082,   9,  21,  16,    2,  -16, 2 },  // 0x6A 'j'
+  {  1095,  14,  17,  16,    1,  -16, 2 },  // 0x6B 'k'
+  {  1114,  10,  17,  16,    3,  -16, 2 },  // 0x6C 'l'
+  {  1123,  16,  12,  16,    0,  -11, 2 },  // 0x6D 'm'
+  {  1142,  14,  12,  16,    1,  -11, 2 },  // 0x6E 'n'
+  {  1157,  13,  12,  16,    2,  -11, 2 },  // 0x6F 'o'
+  {  1176,  14,  16,  16,    1,  -11, 2 },  // 0x70 'p'
+  {  1196,  14,  16,  16,    1,  -11, 2 },  // 0x71 'q'
+  {  1216,  13,  12,  16,    2,  -11, 2 },  // 0x72 'r'
+  {  1229,  11,  12,  16,    3,  -11, 2 },  // 0x73 's'
+  {  1244,  11,  15,  16,    2,  -14, 2 },  // 0x74 't'
+  {  1257,  14,  12,  16,    1,  -11, 2 },  // 0x75 'u'
+  {  1270,  15,  12,  16,    0,  -11, 2 },  // 0x76 'v'
+  {  1287,  16,  12,  16,    0,  -11, 2 },  // 0x77 'w'
+  {  1306,  15,  12,  16,    0,  -11, 0 },  // 0x78 'x'
+  {  1329,  15,  16,  16,    0,  -11, 2 },  // 0x79 'y'
+  {  1353,  10,  12,  16,    3,  -11, 1 },  // 0x7A 'z'
+  {  1366,   6,  20,  16,    5,  -16, 2 },  // 0x7B '{'
+  {  1377,   1,  19,  16,    8,  -16, 1 },  // 0x7C '|'
+  {  1379,   6,  20,  16,    5,  -16, 2 },  // 0x7D '}'
+  {  1391,  12,   3,  16,    2,   -6, 0 },  // 0x7E '~'
+  {  1396,  14,  17,  20,    3,  -16, 2 },  // 0x7F
+  {  1406,  15,  16,  16,    0,  -11, 2 },  // 0x80
+  {  1429,  12,  12,  16,    2,  -11, 2 },  // 0x81
+  {  1446,  14,  12,  16,    1,  -11, 2 },  // 0x82
+  {  1457,  15,  16,  16,    0,  -11, 1 },  // 0x83
+  {  1484,  14,  21,  16,    1,  -16, 2 },  // 0x84
+  {  1516,  14,  12,  16,    1,  -11, 0 },  // 0x85
+  {  1537,  14,  15,  16,    1,  -11, 2 },  // 0x86
+  {  1551,  14,  12,  16,    1,  -11, 2 },  // 0x87
+  {  1564,  14,  12,  16,    1,  -11, 2 },  // 0x88
+  {  1580,  14,  15,  16,    1,  -11, 2 },  // 0x89
+  {  1598,  14,  12,  16,    1,  -11, 2 },  // 0x8A
+  {  1612,  14,  12,  16,    1,  -11, 2 },  // 0x8B
+  {  1626,  13,  12,  16,    2,  -11, 2 },  // 0x8C
+  {  1639,  14,  12,  16,    1,  -11, 1 },  // 0x8D
+  {  1658,  14,  12,  16,    1,  -11, 2 },  // 0x8E
+  {  1678,  14,  12,  16,    1,  -11, 2 },  // 0x8F
+  {  1697,  16,  15,  16,    0,  -14, 2 },  // 0x90
+  {  1717,  14,  15,  16,    1,  -14, 2 },  // 0x91
+  {  1733,  14,  15,  16,    1,  -14, 2 },  // 0x92
+  {  1753,  13,  15,  16,    2,  -14, 2 },  // 0x93
+  {  1765,  14,  18,  16,    1,  -14, 2 },  // 0x94
+  {  1781,  13,  15,  16,    2,  -14, 2 },  // 0x95
+  {  1797,  14,  15,  16,    1,  -14, 0 },  // 0x96
+  {  1824,  11,  16,  16,    2,  -15, 2 },  // 0x97
+  {  1843,  14,  15,  16,    1,  -14, 2 },  // 0x98
+  {  1861,  14,  19,  16,    1,  -18, 2 },  // 0x99
+  {  1884,  15,  15,  16,    1,  -14, 2 },  // 0x9A
+  {  1911,  14,  15,  16,    1,  -14, 2 },  // 0x9B
+  {  1924,  16,  15,  16,    0,  -14, 2 },  // 0x9C
+  {   538,  14,  15,  16,    1,  -14, 2 },  // 0x9D
+  {  1945,  14,  16,  16,    1,  -15, 1 },  // 0x9E
+  {  1971,  14,  15,  16,    1,  -14, 2 },  // 0x9F
+  {  1984,  13,  15,  16,    2,  -14, 2 },  // 0xA0
+  {  1998,  13,  16,  16,    1,  -15, 2 },  // 0xA1
+  {  2018,  14,  15,  16,    1,  -14, 2 },  // 0xA2
+  {  2030,  16,  15,  16,    0,  -14, 2 },  // 0xA3
+  {  2053,  14,  16,  16,    1,  -15, 0 },  // 0xA4
+  {  2081,  14,  15,  16,    1,  -14, 0 },  // 0xA5
+  {  2108,  14,  18,  16,    1,  -14, 2 },  // 0xA6
+  {  2123,  14,  15,  16,    1,  -14, 2 },  // 0xA7
+  {  2137,  14,  15,  16,    1,  -14, 2 },  // 0xA8
+  {  2155,  14,  18,  16,    1,  -14, 2 },  // 0xA9
+  {  2174,  14,  15,  16,    1,  -14, 2 },  // 0xAA
+  {  2189,  14,  15,  16,    1,  -14, 2 },  // 0xAB
+  {  2209,  14,  15,  16,    1,  -14, 2 },  // 0xAC
+  {  2225,  14,  16,  16,    1,  -15, 2 },  // 0xAD
+  {  2247,  14,  16,  16,    1,  -15, 2 },  // 0xAE
+  {  2270,  15,  15,  16,    1,  -14, 2 },  // 0xAF
+  {  2291,  13,  12,  16,    2,  -11, 2 },  // 0xB0
+  {  2306,  12,  17,  16,    2,  -16, 0 },  // 0xB1
+  {  2332,  12,  12,  16,    2,  -11, 2 },  // 0xB2
+  {  2347,  13,  12,  16,    2,  -11, 2 },  // 0xB3
+  {  2358,  14,  15,  16,    1,  -11, 2 },  // 0xB4
+  {  2372,  13,  12,  16,    2,  -11, 2 },  // 0xB5
+  {  2388,  14,  12,  16,    1,  -11, 0 },  // 0xB6
+  {  2409,  12,  12,  16,    2,  -11, 1 },  // 0xB7
+  {  2426,  14,  12,  16,    1,  -11, 2 },  // 0xB8
+  {  2444,  14,  16,  16,    1,  -15, 2 },  // 0xB9
+  {  2467,  14,  12,  16,    1,  -11, 0 },  // 0xBA
+  {  2488,  14,  12,  16,    1,  -11, 2 },  // 0xBB
+  {  2500,  16,  12,  16,    0,  -11, 2 },  // 0xBC
+  {  2519,  14,  12,  16,    1,  -11, 2 },  // 0xBD
+  {  2533,  13,  12,  16,    2,  -11, 2 },  // 0xBE
+  {  2550,  14,  12,  16,    1,  -11, 2 },  // 0xBF
+  {  2562,  13,  18,  16,    2,  -17, 2 },  // 0xC0
+  {  2583,  13,  16,  16,    2,  -15, 2 }   // 0xC1
+};
+
+const RleFont CourierCyr14pt8bRle PROGMEM = {
+  CourierCyr14pt8bRleData,
+  CourierCyr14pt8bRleGlyphs,
+  0x20, 0xC1, 22 };
+
+#endif // COURIERCYR14PT8BRLE_H_
@@ -0,0 +1,447 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr16.h, do not edit.
+// 162 glyphs (0 sharing another's bitmap), 3226 bytes of bitmap data (GFXfont: 4739)
+#ifndef COURIERCYR16PT8BRLE_H_
+#define COURIERCYR16PT8BRLE_H_
+
+const uint8_t CourierCyr16pt8bRleData[] PROGMEM = {
+  0x12, 0xFF, 0xC2, 0x93, 0x42, 0x21, 0x03, 0x13, 0x21, 0x11, 0xFF, 0x70,
+  0x41, 0x31, 0xFF, 0x02, 0xFF, 0xD3, 0x14, 0x16, 0x14, 0x13, 0xFF, 0xF3,
+  0x31, 0x41, 0x61, 0x41, 0x3F, 0x42, 0xFF, 0xF6, 0x51, 0xA1, 0xA1, 0xA1,
+  0x85, 0x12, 0x12, 0x52, 0x12, 0x71, 0x11, 0x81, 0x11, 0xA1, 0xB1, 0xB2,
+  0xB4, 0xA3, 0xA2, 0xA2, 0x92, 0x93, 0x71, 0x15, 0x13, 0x21, 0x33, 0x91,
+  0xA1, 0xA1, 0xA1, 0x50, 0x3E, 0x06, 0x30, 0xC1, 0x88, 0x08, 0x80, 0x88,
+  0x08, 0xC1, 0x86, 0x30, 0x3E, 0x30, 0x1C, 0x0E, 0x03, 0x80, 0xC3, 0xC0,
+  0x42, 0x08, 0x10, 0x81, 0x08, 0x10, 0x81, 0x04, 0x20, 0x3C, 0x44, 0xA1,
+  0x42, 0x71, 0xE1, 0xE1, 0xE2, 0xE1, 0xE2, 0xD3, 0xA3, 0x11, 0x53, 0x21,
+  0x41, 0x32, 0x31, 0x52, 0x21, 0x41, 0x61, 0x12, 0x41, 0x72, 0x51, 0x72,
+  0x61, 0x54, 0x65, 0x35, 0x0E, 0x32, 0x41, 0x22, 0x72, 0xC2, 0xFF, 0x82,
+  0xE2, 0x92, 0x51, 0x02, 0x31, 0x52, 0x92, 0xE2, 0xFF, 0x82, 0xC2, 0x72,
+  0x21, 0x40, 0x04, 0x00, 0x80, 0x10, 0x42, 0x1E, 0x4E, 0x7F, 0x03, 0x80,
+  0x50, 0x11, 0x06, 0x31, 0x83, 0x00, 0x61, 0xFF, 0xFF, 0xB6, 0x1C, 0x16,
+  0xFF, 0xFF, 0x50, 0x39, 0x9C, 0xC6, 0x33, 0x00, 0x0B, 0x6F, 0xF6, 0xA1,
+  0x91, 0xB1, 0x81, 0xB1, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x41, 0xB1, 0x81,
+  0xB1, 0x81, 0xB1, 0xF4, 0x2F, 0x42, 0x90, 0x35, 0x51, 0x13, 0x11, 0x31,
+  0x11, 0x31, 0x11, 0x31, 0x51, 0xD2, 0x72, 0xFF, 0xFF, 0xFF, 0x92, 0x72,
+  0xD1, 0x51, 0x31, 0x11, 0x31, 0x11, 0x31, 0x13, 0x11, 0x20, 0x52, 0x83,
+  0x82, 0x22, 0x74, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x16, 0x45,
+  0x56, 0x11, 0x31, 0x11, 0x43, 0x31, 0x72, 0xD1, 0xFF, 0xE2, 0xF6, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x26, 0x12, 0x29, 0x29, 0x11, 0x91, 0x25,
+  0x51, 0x16, 0x23, 0x41, 0x31, 0x72, 0xFF, 0xC2, 0x81, 0x73, 0x11, 0x65,
+  0xA2, 0xA2, 0xFF, 0xC1, 0xB3, 0x53, 0x17, 0x11, 0x20, 0x72, 0x92, 0xF6,
+  0x29, 0x1C, 0x19, 0x1C, 0x19, 0x29, 0x1C, 0x19, 0x1C, 0x1B, 0x71, 0xB1,
+  0x3F, 0xFA, 0x41, 0x30, 0x1A, 0x39, 0xFF, 0xF7, 0x65, 0x61, 0x14, 0x15,
+  0x32, 0x19, 0x1A, 0x1F, 0xFF, 0x22, 0xC2, 0x63, 0x1A, 0x20, 0x65, 0x47,
+  0x33, 0x72, 0x81, 0xB1, 0xF4, 0x2F, 0x94, 0x57, 0x33, 0x42, 0x21, 0x72,
+  0xFF, 0x32, 0xF3, 0x21, 0x34, 0x23, 0x72, 0x0C, 0x1A, 0xB1, 0xC2, 0xF5,
+  0x2F, 0x61, 0xC1, 0xF6, 0x1C, 0x1F, 0x61, 0xC1, 0x91, 0xC1, 0x91, 0x70,
+  0x0F, 0x81, 0x04, 0x20, 0x24, 0x01, 0x40, 0x14, 0x01, 0x40, 0x14, 0x03,
+  0x20, 0x21, 0x8C, 0x0F, 0x83, 0x0E, 0x40, 0x28, 0x01, 0x80, 0x18, 0x01,
+  0x80, 0x14, 0x02, 0x30, 0xC1, 0xF8, 0x35, 0x61, 0x16, 0x33, 0x41, 0x11,
+  0x11, 0x81, 0x31, 0x91, 0xA1, 0xFA, 0x28, 0x1A, 0x13, 0x34, 0x11, 0x13,
+  0x86, 0x4E, 0x2F, 0x62, 0xF6, 0x28, 0x33, 0x84, 0x6F, 0xF6, 0x00, 0x00,
+  0x6F, 0xF6, 0x33, 0xDE, 0x60, 0x00, 0x00, 0x33, 0x98, 0xCE, 0x63, 0x00,
+  0xD1, 0xA3, 0x93, 0x93, 0x93, 0x92, 0xA2, 0xE2, 0xE3, 0xD3, 0xD3, 0xD3,
+  0xE1, 0x0D, 0xFF, 0xFF, 0x5D, 0x01, 0xE3, 0xD3, 0xD3, 0xD3, 0xE2, 0xE2,
+  0xA2, 0x93, 0x93, 0x93, 0x93, 0xA1, 0xD0, 0x26, 0x32, 0x61, 0x21, 0x81,
+  0x11, 0x91, 0xA1, 0xA1, 0x92, 0x82, 0x73, 0x62, 0x91, 0xFF, 0xC3, 0x74,
+  0x83, 0x50, 0x45, 0x71, 0x13, 0x11, 0x53, 0x31, 0x11, 0x32, 0x61, 0xF1,
+  0x2F, 0xFE, 0x38, 0x57, 0x11, 0x1B, 0x1F, 0xA1, 0x31, 0x71, 0x14, 0x14,
+  0x34, 0x13, 0xE2, 0x61, 0x61, 0x41, 0x11, 0x49, 0x20, 0x37, 0xB5, 0xF2,
+  0x4F, 0xF1, 0x22, 0x2F, 0xFF, 0x22, 0x42, 0xFC, 0x26, 0x29, 0x88, 0xA1,
+  0x1F, 0x11, 0xF9, 0x2A, 0x2F, 0x52, 0x13, 0x63, 0x12, 0x0C, 0x43, 0x1A,
+  0xE1, 0x11, 0xE1, 0xFF, 0x11, 0xE1, 0x11, 0x5A, 0x6A, 0xE3, 0xF0, 0x2F,
+  0xFF, 0xF2, 0x2D, 0x12, 0x31, 0xB1, 0x55, 0x31, 0x32, 0x52, 0x11, 0x21,
+  0x92, 0x12, 0x92, 0x11, 0xB2, 0xC2, 0xD1, 0xD1, 0xD1, 0xD1, 0xD2, 0xD1,
+  0xD2, 0xD2, 0x82, 0x32, 0x53, 0x66, 0x30, 0x0C, 0x53, 0x1A, 0xF0, 0x3F,
+  0x12, 0xFF, 0x32, 0xFF, 0xFF, 0xFF, 0xA1, 0xF2, 0x1E, 0x1F, 0x01, 0x11,
+  0xD1, 0x11, 0x23, 0x1A, 0x30, 0x0F, 0x31, 0xAF, 0xFF, 0xA1, 0x41, 0xF4,
+  0x5A, 0x5F, 0xF0, 0x1F, 0x41, 0xFF, 0xFF, 0x03, 0x1A, 0x10, 0x0F, 0x31,
+  0xAF, 0xFF, 0xA1, 0x41, 0xF4, 0x5A, 0x5F, 0xF0, 0x1F, 0xFF, 0xFF, 0x53,
+  0x14, 0x70, 0x56, 0x31, 0x5A, 0x61, 0x11, 0x63, 0x41, 0x11, 0xF0, 0x1A,
+  0x13, 0x2F, 0xE1, 0xFF, 0xFF, 0x28, 0x95, 0x14, 0xF2, 0x1F, 0x01, 0x11,
+  0xF0, 0x11, 0x17, 0x26, 0xC2, 0x05, 0x57, 0x12, 0x52, 0x12, 0xFF, 0xFF,
+  0xF3, 0x96, 0x9F, 0xFF, 0xFF, 0xFF, 0x32, 0x12, 0x52, 0x12, 0x0F, 0x41,
+  0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x61, 0x60, 0x5C, 0x56, 0x15,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xF4, 0x1F, 0xFF, 0x41, 0x92, 0x72, 0x51,
+  0x88, 0x11, 0x60, 0x07, 0x36, 0x13, 0x13, 0x33, 0x12, 0xD2, 0xE2, 0xD3,
+  0xD1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xD1, 0x21, 0xC1, 0x15, 0xA2, 0x31,
+  0xF2, 0x2F, 0x21, 0xF0, 0x1F, 0x31, 0xF0, 0x14, 0x31, 0x37, 0x30, 0x08,
+  0x73, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x1F, 0xFF, 0xFF, 0x03, 0x1A,
+  0x10, 0x04, 0x96, 0x21, 0x71, 0x22, 0x31, 0x91, 0xF9, 0x25, 0x2F, 0xB2,
+  0x32, 0xFE, 0x11, 0x1D, 0x13, 0x1F, 0xF0, 0x3F, 0xF2, 0x1F, 0xFC, 0x21,
+  0x35, 0x31, 0x20, 0x05, 0x6A, 0x21, 0x54, 0x12, 0x41, 0xF3, 0x2F, 0x31,
+  0xF1, 0x1F, 0x32, 0xFF, 0x52, 0xF3, 0x1F, 0x11, 0xF3, 0x2F, 0x31, 0xF1,
+  0x1F, 0x32, 0xF3, 0x13, 0x31, 0x45, 0x14, 0x55, 0x89, 0x53, 0x53, 0x31,
+  0xB1, 0x31, 0x91, 0x21, 0xF0, 0x1B, 0x2F, 0xFF, 0xFD, 0x11, 0x2C, 0x12,
+  0x19, 0x13, 0x1B, 0x13, 0x35, 0x35, 0x93, 0x0B, 0x43, 0x19, 0xD3, 0xE2,
+  0xFF, 0xFD, 0x2C, 0x16, 0xA5, 0x8F, 0xFF, 0xFF, 0x33, 0x15, 0x60, 0x55,
+  0x89, 0x53, 0x53, 0x31, 0xB1, 0x31, 0x91, 0x22, 0xFB, 0x2F, 0xFF, 0xFD,
+  0x11, 0x2C, 0x12, 0x19, 0x13, 0x1B, 0x13, 0x35, 0x35, 0x11, 0x77, 0x12,
+  0x3B, 0x1C, 0x11, 0x39, 0xC0, 0x0C, 0x53, 0x17, 0x11, 0xF0, 0x11, 0x1F,
+  0x01, 0xFF, 0xF5, 0x2E, 0x19, 0x98, 0x51, 0x1F, 0x02, 0xF1, 0x2F, 0x21,
+  0xF0, 0x1F, 0xF4, 0x23, 0x31, 0x37, 0x30, 0x46, 0x21, 0x39, 0x32, 0x61,
+  0x32, 0xF6, 0x1D, 0x1E, 0x3B, 0x78, 0x8A, 0x21, 0x1B, 0x11, 0x1D, 0x1F,
+  0x72, 0x22, 0x62, 0x2A, 0x20, 0x1F, 0x03, 0x61, 0x6F, 0xFF, 0xFA, 0x1F,
+  0x03, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x41, 0x44, 0x06, 0x48, 0x13,
+  0x43, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x18, 0x15, 0x1A, 0x15,
+  0x26, 0x27, 0x84, 0x06, 0x68, 0x13, 0x63, 0x12, 0x22, 0xA2, 0xFF, 0xB2,
+  0x82, 0xFA, 0x26, 0x2F, 0xFF, 0x02, 0x42, 0xFF, 0xF2, 0x22, 0x2F, 0xF1,
+  0x4F, 0xA0, 0x06, 0x67, 0x23, 0x63, 0x21, 0x11, 0xE1, 0xFC, 0x2F, 0xFF,
+  0x64, 0xFC, 0x2A, 0x28, 0x22, 0x2F, 0xFF, 0x22, 0x42, 0xFF, 0xE3, 0x63,
+  0x30, 0x15, 0x45, 0x32, 0x82, 0x52, 0x62, 0x71, 0x61, 0x91, 0x41, 0xA2,
+  0x22, 0xB1, 0x21, 0xD2, 0xE2, 0xD4, 0xB2, 0x22, 0xA1, 0x41, 0x91, 0x61,
+  0x72, 0x62, 0x52, 0x81, 0x51, 0xA1, 0x26, 0x46, 0x06, 0x58, 0x22, 0x52,
+  0x22, 0x21, 0xB1, 0x52, 0x72, 0xF9, 0x25, 0x2A, 0x13, 0x1B, 0x15, 0x1B,
+  0x21, 0x2E, 0x1F, 0x01, 0x11, 0xFF, 0xFF, 0xFF, 0x64, 0x14, 0x40, 0x0C,
+  0x2A, 0xC2, 0xA2, 0xA1, 0xD1, 0x31, 0x62, 0xA2, 0xA1, 0xD1, 0xA2, 0xA2,
+  0x71, 0x21, 0xD1, 0xA2, 0xA2, 0xCB, 0x10, 0x05, 0x14, 0xFF, 0xFF, 0xFF,
+  0xB4, 0x01, 0xB1, 0x91, 0xC1, 0x91, 0xF7, 0x2F, 0x62, 0xF6, 0x2F, 0x71,
+  0x91, 0xC1, 0x91, 0xF7, 0x2F, 0x62, 0xF6, 0x20, 0x09, 0xFF, 0xFF, 0xFF,
+  0xB4, 0x10, 0x06, 0x00, 0x60, 0x0F, 0x01, 0x98, 0x30, 0xC6, 0x06, 0xC0,
+  0x38, 0x01, 0x0F, 0xF6, 0xE0, 0xE0, 0xE0, 0x40, 0x40, 0x40, 0x37, 0x62,
+  0x15, 0x11, 0x53, 0x53, 0xFF, 0x68, 0x5A, 0x41, 0x11, 0xD1, 0xFF, 0x72,
+  0x43, 0x42, 0x11, 0x51, 0x14, 0x12, 0x23, 0x04, 0xFF, 0x03, 0xFF, 0xFF,
+  0xFE, 0x69, 0x21, 0x69, 0x25, 0x26, 0x28, 0x25, 0x1A, 0x2F, 0xFF, 0xFC,
+  0x1A, 0x25, 0x18, 0x16, 0x11, 0x16, 0x31, 0x32, 0x93, 0x56, 0x21, 0x42,
+  0x63, 0x31, 0x92, 0x21, 0xB1, 0x11, 0xC1, 0x11, 0xE1, 0xE1, 0xE1, 0xF0,
+  0x1E, 0x29, 0x24, 0x25, 0x31, 0x14, 0x74, 0x85, 0xA1, 0xF0, 0x5F, 0xFF,
+  0xFC, 0x59, 0x96, 0x11, 0x15, 0x18, 0x17, 0x24, 0x29, 0x1F, 0xFF, 0xF8,
+  0x29, 0x16, 0x17, 0x16, 0x11, 0x15, 0x11, 0x16, 0x92, 0x30, 0x56, 0x72,
+  0x53, 0x41, 0x92, 0x21, 0xB1, 0x11, 0xC3, 0xDF, 0x2E, 0x1F, 0x01, 0xF0,
+  0x1B, 0x13, 0x26, 0x36, 0x64, 0x58, 0x49, 0x32, 0xFF, 0xFF, 0x03, 0x17,
+  0x23, 0x17, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x17, 0x20, 0x45, 0x34, 0x29,
+  0x23, 0x11, 0x11, 0x51, 0x11, 0x61, 0x71, 0x52, 0x91, 0xFF, 0xFF, 0x82,
+  0x91, 0x61, 0x71, 0x61, 0x11, 0x51, 0x11, 0x69, 0x95, 0xFF, 0x42, 0x42,
+  0x71, 0x6B, 0x40, 0x04, 0xFF, 0x03, 0xFF, 0xFF, 0xFE, 0x5A, 0x88, 0x11,
+  0x15, 0x27, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0x13, 0x33, 0x13, 0x52,
+  0xFF, 0x72, 0xFF, 0xF1, 0x67, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0x26, 0x16,
+  0x72, 0xFA, 0x2F, 0xCF, 0x2F, 0xFF, 0xFF, 0xFF, 0xF5, 0x35, 0x13, 0x51,
+  0x11, 0x04, 0xFD, 0x3F, 0xFF, 0xFF, 0xB6, 0xA1, 0x23, 0xA1, 0x11, 0xB4,
+  0xB1, 0x11, 0xC1, 0x11, 0xC4, 0xC1, 0x22, 0xF0, 0x2F, 0x02, 0xF0, 0x2F,
+  0x02, 0x33, 0x72, 0x13, 0x25, 0x71, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x56, 0x16, 0x03, 0x15, 0x25, 0x32, 0x15, 0x12, 0x13, 0x71,
+  0x41, 0x12, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x21, 0x25, 0x25,
+  0x20, 0x04, 0x35, 0x53, 0x28, 0x83, 0x52, 0x71, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x31, 0x33, 0x31, 0x30, 0x55, 0x89, 0x53, 0x53, 0x32, 0x92, 0x12,
+  0xB2, 0xFF, 0xFF, 0x02, 0xB2, 0x21, 0x92, 0x24, 0x53, 0x59, 0x30, 0x04,
+  0x36, 0x43, 0x22, 0x16, 0x71, 0x12, 0x52, 0x71, 0x82, 0x51, 0xA2, 0xFF,
+  0xFF, 0xC1, 0xA2, 0x42, 0x81, 0x72, 0x63, 0x78, 0xA6, 0xFF, 0xFA, 0x31,
+  0x58, 0x45, 0x34, 0x29, 0x23, 0x11, 0x11, 0x51, 0x11, 0x61, 0x71, 0x52,
+  0x91, 0xFF, 0xFF, 0x82, 0x91, 0x61, 0x72, 0x51, 0x11, 0x52, 0x78, 0xA5,
+  0xFF, 0xFF, 0x25, 0x13, 0x05, 0x59, 0x46, 0x74, 0x41, 0x51, 0x11, 0xC2,
+  0xFF, 0xFF, 0xFF, 0xF8, 0x41, 0x73, 0x36, 0x21, 0x2A, 0x23, 0x62, 0xFB,
+  0x11, 0x3B, 0xA5, 0x9C, 0x3D, 0x19, 0x13, 0x17, 0x11, 0x11, 0xB1, 0x21,
+  0xFF, 0xF4, 0x21, 0x82, 0x21, 0x8F, 0xFF, 0xFF, 0xFF, 0xD1, 0x22, 0x53,
+  0x46, 0x13, 0x04, 0x54, 0x33, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x17,
+  0x24, 0x38, 0x51, 0x12, 0x30, 0x06, 0x58, 0x22, 0x52, 0x22, 0x21, 0xB1,
+  0x61, 0x71, 0x71, 0x91, 0xE1, 0x92, 0x61, 0xFB, 0x23, 0x2F, 0xD2, 0x12,
+  0xFF, 0x03, 0x70, 0x06, 0x67, 0x23, 0x63, 0x21, 0x11, 0xE1, 0x92, 0xFF,
+  0x34, 0x92, 0xA2, 0xFB, 0x22, 0x2F, 0xE2, 0x42, 0x82, 0x82, 0xF6, 0x06,
+  0x56, 0x32, 0x72, 0x72, 0x52, 0x92, 0x32, 0xB2, 0x12, 0xD3, 0xE3, 0xD2,
+  0x12, 0xB2, 0x32, 0x92, 0x52, 0x72, 0x72, 0x52, 0x92, 0x26, 0x56, 0x05,
+  0x77, 0x12, 0x72, 0x12, 0x22, 0x91, 0xF2, 0x15, 0x27, 0x2E, 0x19, 0x26,
+  0x1E, 0x1B, 0x24, 0x1E, 0x1D, 0x22, 0x1E, 0x1F, 0x01, 0x11, 0xE2, 0xFF,
+  0x12, 0xE1, 0xB5, 0x22, 0x80, 0x0C, 0x83, 0x72, 0x11, 0x62, 0x82, 0x82,
+  0x91, 0x91, 0x91, 0x91, 0x71, 0x11, 0x82, 0x9C, 0x53, 0x44, 0x32, 0xFF,
+  0xFF, 0x92, 0x43, 0x53, 0x72, 0xFF, 0xFA, 0x27, 0x40, 0x0F, 0x70, 0x03,
+  0x54, 0x72, 0xFF, 0xFF, 0xB2, 0x73, 0x53, 0x42, 0xFF, 0xF8, 0x23, 0x44,
+  0x3C, 0x07, 0x1C, 0x68, 0x1F, 0x00, 0x0F, 0x11, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0xE1, 0x82, 0x63, 0x28, 0x32, 0x21,
+  0x12, 0x22, 0x11, 0x53, 0x61, 0x11, 0xE1, 0x51, 0xB1, 0xE1, 0xFF, 0x61,
+  0xA1, 0xF1, 0x13, 0x28, 0x17, 0x16, 0x11, 0x15, 0x81, 0x18, 0x7F, 0xFF,
+  0x62, 0x15, 0x80, 0x63, 0x41, 0x34, 0x25, 0x22, 0x73, 0x12, 0x92, 0x11,
+  0xB1, 0x11, 0xC2, 0xC2, 0xC2, 0xD1, 0xD1, 0xD2, 0xA1, 0x22, 0x72, 0x58,
+  0x20, 0x0F, 0x01, 0x61, 0x5F, 0x01, 0xFF, 0x11, 0xD1, 0xFF, 0xFF, 0xFF,
+  0x34, 0x14, 0x30, 0x05, 0x77, 0x12, 0x72, 0x12, 0x31, 0x92, 0x41, 0xF3,
+  0x17, 0x26, 0x17, 0x1A, 0x16, 0x18, 0x15, 0x1C, 0x14, 0x1A, 0x13, 0x2C,
+  0x2F, 0x22, 0xFF, 0x21, 0xE1, 0xF2, 0x1E, 0x2A, 0x51, 0x38, 0x71, 0xB3,
+  0xC3, 0xFF, 0xFE, 0x11, 0x19, 0x42, 0x35, 0x11, 0x22, 0x31, 0x13, 0x37,
+  0x11, 0x11, 0x1B, 0x13, 0x1C, 0x1D, 0x1F, 0xFE, 0x12, 0x1C, 0x21, 0x19,
+  0x13, 0x11, 0x17, 0x11, 0x13, 0x11, 0x31, 0x55, 0x41, 0x3F, 0xFF, 0x74,
+  0x14, 0x30, 0x06, 0x55, 0x42, 0x72, 0x71, 0x62, 0x91, 0x42, 0xB1, 0x22,
+  0xD3, 0xE2, 0xE2, 0x11, 0xC2, 0x31, 0xA2, 0x51, 0x82, 0x71, 0x62, 0x91,
+  0x36, 0x56, 0x06, 0x4A, 0x12, 0x43, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF5, 0x31, 0x91, 0xF3, 0xFF, 0xF8, 0x06, 0x49, 0x12, 0x42, 0x22, 0xFF,
+  0xF7, 0x1E, 0x11, 0x78, 0x32, 0x3B, 0x2F, 0xFF, 0xF4, 0x32, 0x20, 0x05,
+  0x14, 0x27, 0x21, 0x12, 0x11, 0x21, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF5, 0x22, 0x41, 0x41, 0x30, 0x05, 0x14, 0x27, 0x12, 0x12, 0x11, 0x21,
+  0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x21, 0x51, 0x41, 0xF4, 0xFF,
+  0xF7, 0x09, 0x84, 0x13, 0xFF, 0x91, 0xF6, 0x4F, 0x15, 0x78, 0x11, 0xE1,
+  0xFF, 0xF2, 0x13, 0x31, 0xA0, 0x06, 0x67, 0x13, 0x62, 0x12, 0xFF, 0xF9,
+  0x3F, 0x24, 0xA8, 0xF2, 0x1F, 0xFF, 0x31, 0x11, 0x52, 0x18, 0x12, 0x12,
+  0x07, 0x82, 0x23, 0xFF, 0xFC, 0x5F, 0x04, 0x6A, 0xE2, 0xFD, 0x1D, 0x11,
+  0x32, 0x81, 0x11, 0x53, 0x71, 0x13, 0x24, 0x42, 0x92, 0x21, 0xB2, 0x11,
+  0xC1, 0xE1, 0xE2, 0x5A, 0xD2, 0xD1, 0xD2, 0xD1, 0x22, 0x82, 0x4A, 0x40,
+  0x00, 0x30, 0x7C, 0x66, 0x08, 0x40, 0x84, 0x60, 0x62, 0x20, 0x11, 0x30,
+  0x08, 0x98, 0x06, 0x7C, 0x03, 0x26, 0x01, 0x91, 0x00, 0x88, 0x80, 0x44,
+  0x60, 0x62, 0x18, 0x67, 0xC7, 0xE0, 0x4C, 0x39, 0x22, 0x21, 0xF1, 0x1F,
+  0x01, 0xE1, 0x11, 0xE1, 0x17, 0x82, 0x24, 0x91, 0x11, 0xC1, 0x11, 0xE1,
+  0xD2, 0xB4, 0x62, 0x22, 0x46, 0xC4, 0x12, 0xE2, 0xF5, 0x1F, 0x11, 0xD2,
+  0xF6, 0x2A, 0x2F, 0x82, 0xFB, 0x11, 0x7A, 0xA6, 0x2F, 0xC2, 0x41, 0xF3,
+  0x1C, 0x11, 0x21, 0x36, 0x32, 0x10, 0x0E, 0x12, 0x1A, 0xFF, 0xFF, 0x01,
+  0xF4, 0x87, 0x71, 0x2C, 0x4F, 0x01, 0xD1, 0xFF, 0xE1, 0xD1, 0x13, 0x1B,
+  0x10, 0x0C, 0x32, 0x1A, 0xF0, 0x1D, 0x1F, 0xE1, 0xD1, 0x11, 0x48, 0x11,
+  0x55, 0x41, 0xA4, 0x11, 0xD1, 0x11, 0xD1, 0xFF, 0xE1, 0xC2, 0x13, 0x18,
+  0x12, 0x10, 0x0F, 0x31, 0x9F, 0xF0, 0x1F, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF0, 0x31, 0x47, 0x2E, 0x23, 0x16, 0x22, 0xFF, 0xFF, 0xFF, 0xA1,
+  0xFF, 0x21, 0xFF, 0xFF, 0x11, 0xF1, 0x1B, 0x31, 0x82, 0x21, 0xEF, 0xFF,
+  0x40, 0x0F, 0x31, 0x9F, 0xF0, 0x1F, 0xA1, 0x41, 0xF4, 0x5F, 0xA5, 0xFF,
+  0x01, 0xF4, 0x1F, 0xFF, 0x03, 0x1A, 0x10, 0x73, 0xEF, 0x30, 0x84, 0x10,
+  0x8C, 0x08, 0x88, 0x08, 0x90, 0x04, 0x90, 0x06, 0xA0, 0x06, 0xF0, 0x09,
+  0xD8, 0x19, 0x88, 0x10, 0x88, 0x10, 0x84, 0x10, 0x84, 0x30, 0x84, 0x20,
+  0x84, 0x20, 0x84, 0xE3, 0xE3, 0x11, 0x26, 0x43, 0x52, 0x32, 0x72, 0x21,
+  0x91, 0x21, 0x91, 0x21, 0x91, 0xC1, 0xB1, 0x75, 0xC2, 0xD2, 0xC1, 0xC1,
+  0xC1, 0xC2, 0xA5, 0x72, 0x39, 0x82, 0x50, 0x06, 0x67, 0x12, 0x52, 0x12,
+  0xFB, 0x2F, 0xE2, 0xFE, 0x2F, 0xE2, 0xFE, 0x2F, 0xE2, 0xD1, 0xF1, 0x1A,
+  0x37, 0x31, 0x20, 0x41, 0x71, 0x73, 0x33, 0x81, 0x13, 0x11, 0xA5, 0x56,
+  0x67, 0x12, 0x52, 0x12, 0xFB, 0x2F, 0xE2, 0xFE, 0x2F, 0xE2, 0xFE, 0x2F,
+  0xE2, 0xD1, 0xF1, 0x1A, 0x37, 0x31, 0x20, 0x07, 0x36, 0x13, 0x13, 0x32,
+  0x22, 0xC1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xD1, 0x11, 0xD1,
+  0x11, 0xD1, 0x21, 0xC1, 0x15, 0xA2, 0x31, 0xF2, 0x2F, 0xF3, 0x2F, 0xF3,
+  0x23, 0x31, 0x37, 0x30, 0x2E, 0x23, 0x17, 0x12, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x01, 0xF1, 0x1D, 0x1C, 0x31, 0x15, 0x31, 0x20, 0x05, 0x88,
+  0x21, 0x81, 0x12, 0x41, 0xFA, 0x29, 0x2F, 0x71, 0xD1, 0x41, 0xB1, 0xF6,
+  0x2D, 0x2F, 0x32, 0xF0, 0x1F, 0xF6, 0x1F, 0xFE, 0x31, 0x35, 0x31, 0x20,
+  0x06, 0x49, 0x12, 0x43, 0x12, 0xFF, 0xFF, 0xF9, 0x9F, 0x89, 0xFF, 0xFF,
+  0xFF, 0x93, 0x12, 0x43, 0x12, 0x65, 0x92, 0x43, 0x61, 0x82, 0x41, 0xA2,
+  0x22, 0xB1, 0x21, 0xC2, 0x11, 0xD3, 0xD3, 0xD3, 0xD3, 0xD1, 0x11, 0xD1,
+  0x11, 0xC2, 0x12, 0xB1, 0x31, 0xB1, 0x32, 0x91, 0x52, 0x71, 0x78, 0xC1,
+  0x70, 0x0F, 0x41, 0x91, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+  0x31, 0x24, 0x31, 0x20, 0x0B, 0x32, 0x1A, 0xC1, 0xE2, 0xFF, 0xA1, 0xE1,
+  0xB1, 0x5A, 0x48, 0xFF, 0xFF, 0xD2, 0x15, 0x60, 0x65, 0x31, 0x59, 0x61,
+  0x11, 0x53, 0x41, 0x11, 0x81, 0x51, 0xD2, 0xFC, 0x2F, 0x02, 0xFF, 0x11,
+  0xFF, 0xF4, 0x1E, 0x1F, 0x21, 0xA1, 0x31, 0x11, 0x81, 0x5C, 0x63, 0x14,
+  0x30, 0x1F, 0x02, 0x61, 0x6F, 0xFF, 0x41, 0xFF, 0x12, 0xD1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC4, 0x14, 0x30, 0x06, 0x67, 0x31, 0xB1, 0x61, 0xA2, 0x71,
+  0x91, 0x81, 0x82, 0x91, 0x71, 0xA1, 0x62, 0xB1, 0x51, 0xC1, 0x42, 0xD1,
+  0x31, 0xE1, 0x22, 0xF0, 0x11, 0x1F, 0x13, 0xF2, 0x1F, 0x22, 0xC1, 0x41,
+  0xD5, 0xF1, 0x1D, 0x07, 0xE0, 0x00, 0x80, 0x03, 0xE0, 0x1C, 0xB8, 0x30,
+  0x84, 0x60, 0x82, 0x40, 0x83, 0x40, 0x81, 0xC0, 0x81, 0xC0, 0x81, 0xC0,
+  0x81, 0x40, 0x83, 0x60, 0x82, 0x30, 0x84, 0x1C, 0x98, 0x03, 0xE0, 0x00,
+  0x80, 0x07, 0xE0, 0x15, 0x46, 0x41, 0x82, 0x71, 0x71, 0x82, 0x51, 0xA1,
+  0x42, 0xB1, 0x22, 0xD1, 0x11, 0xE2, 0xF0, 0x3D, 0x21, 0x1D, 0x13, 0x1B,
+  0x14, 0x29, 0x16, 0x27, 0x27, 0x16, 0x29, 0x15, 0x1B, 0x12, 0x64, 0x70,
+  0x06, 0x49, 0x12, 0x43, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xE3, 0x19, 0x1F, 0x2F, 0xFF, 0x40, 0x06, 0x49, 0x12, 0x43, 0x12, 0xFF,
+  0xFF, 0xF9, 0x1E, 0x11, 0x87, 0x9F, 0xFF, 0xFF, 0xFF, 0x34, 0x12, 0x05,
+  0x14, 0x27, 0x12, 0x12, 0x11, 0x21, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFD, 0x21, 0x51, 0x41, 0x30, 0x05, 0x14, 0x27, 0x21, 0x12,
+  0x11, 0x21, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x22,
+  0x41, 0x41, 0xF4, 0xFF, 0xF7, 0x09, 0x84, 0x13, 0xFF, 0xFA, 0x1F, 0xF7,
+  0x6A, 0x51, 0x3C, 0x3F, 0x12, 0xFF, 0xFF, 0x21, 0xE1, 0x11, 0x23, 0x17,
+  0x11, 0x10, 0x06, 0x67, 0x13, 0x62, 0x12, 0xFF, 0xFF, 0xFD, 0x4D, 0x7E,
+  0x21, 0x1F, 0x01, 0xF3, 0x1F, 0xFF, 0x51, 0xD3, 0x62, 0x15, 0x11, 0x22,
+  0x12, 0x07, 0x82, 0x14, 0xFF, 0xFF, 0xFB, 0x87, 0x71, 0x2C, 0x4F, 0x01,
+  0xD1, 0xFF, 0xE1, 0xD1, 0x13, 0x1B, 0x10, 0x01, 0x35, 0x89, 0x53, 0x53,
+  0xE2, 0x31, 0xB1, 0xD1, 0x21, 0xFD, 0x15, 0x8F, 0x78, 0xF1, 0x1F, 0xC1,
+  0xF0, 0x11, 0x1A, 0x14, 0x18, 0x11, 0x12, 0xC5, 0x41, 0x35, 0x94, 0x45,
+  0x31, 0x12, 0x11, 0x32, 0x12, 0x23, 0x21, 0x11, 0x81, 0x61, 0xA1, 0x62,
+  0xFF, 0xA1, 0xE2, 0xB1, 0xF5, 0x2F, 0xD1, 0x51, 0xFF, 0x51, 0x61, 0x81,
+  0x81, 0x91, 0x41, 0x32, 0x12, 0x21, 0x14, 0x11, 0x25, 0x32, 0x13, 0x30,
+  0x5C, 0x49, 0x13, 0x31, 0xF2, 0x1F, 0xFF, 0x42, 0xF2, 0x2E, 0x21, 0x6A,
+  0x12, 0x4C, 0x1E, 0x2E, 0x1F, 0x01, 0x11, 0xF0, 0x1E, 0x1D, 0x31, 0x15,
+  0x31, 0x30, 0x62, 0x99, 0x55, 0x22, 0x11, 0x41, 0x81, 0xFF, 0x69, 0x51,
+  0x18, 0x41, 0x11, 0xD1, 0xFE, 0x18, 0x14, 0x17, 0x35, 0x92, 0x30, 0xC1,
+  0x77, 0x45, 0x82, 0xB2, 0xC1, 0xC2, 0xC1, 0x37, 0x31, 0x22, 0x52, 0x21,
+  0x11, 0x82, 0x12, 0xA4, 0xB3, 0xB3, 0xB3, 0xB1, 0x11, 0xB1, 0x11, 0xA2,
+  0x12, 0x91, 0x32, 0x71, 0x58, 0x30, 0x0C, 0x23, 0x17, 0x11, 0xC1, 0xF0,
+  0x1D, 0x19, 0x45, 0x53, 0x15, 0x81, 0x1C, 0x1F, 0xFB, 0x11, 0x31, 0x81,
+  0x10, 0x1D, 0x23, 0x18, 0xF1, 0x1F, 0xD1, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0,
+  0x41, 0x64, 0x2E, 0x23, 0x16, 0x22, 0xFF, 0xFF, 0xFF, 0xA1, 0xF1, 0x1F,
+  0xE2, 0xB3, 0x18, 0x22, 0x1E, 0xFF, 0xF4, 0x63, 0x94, 0x14, 0x52, 0x72,
+  0x32, 0x92, 0x21, 0xB1, 0x21, 0xB1, 0x12, 0xB1, 0x1F, 0x2E, 0x1E, 0x1F,
+  0x01, 0xA1, 0x32, 0x83, 0x48, 0x30, 0x73, 0xEF, 0x30, 0x84, 0x10, 0x88,
+  0x08, 0x98, 0x04, 0xB0, 0x06, 0xB0, 0x09, 0xD8, 0x19, 0x88, 0x10, 0x8C,
+  0x10, 0x84, 0x30, 0x84, 0x20, 0x84, 0xE3, 0xE7, 0x11, 0x34, 0x65, 0x23,
+  0x42, 0x81, 0x32, 0x82, 0x21, 0x92, 0xC1, 0xA3, 0x96, 0xD2, 0xD2, 0xC2,
+  0xC1, 0x21, 0x92, 0x11, 0x1A, 0x20, 0x06, 0x68, 0x12, 0x52, 0x13, 0xA1,
+  0xF2, 0x1E, 0x2E, 0x1F, 0x21, 0xE2, 0xE2, 0xE1, 0xF2, 0x1E, 0x2B, 0x31,
+  0x15, 0x31, 0x30, 0x41, 0x71, 0x91, 0x51, 0x91, 0x15, 0x11, 0x97, 0xFF,
+  0x96, 0x68, 0x12, 0x52, 0x13, 0xA1, 0xF2, 0x1E, 0x2E, 0x1F, 0x21, 0xE2,
+  0xE2, 0xE1, 0xF2, 0x1E, 0x2B, 0x31, 0x15, 0x31, 0x30, 0xFC, 0xFC, 0x40,
+  0xC0, 0x83, 0x01, 0x0C, 0x02, 0x20, 0x04, 0xC0, 0x0A, 0xC0, 0x18, 0xC0,
+  0x20, 0xC0, 0x40, 0xC0, 0x80, 0xC1, 0x00, 0xCF, 0xC7, 0xE0, 0x2E, 0x23,
+  0x16, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xF1, 0x1A, 0x55, 0x22, 0x20,
+  0x05, 0x88, 0x21, 0x81, 0x12, 0x41, 0x71, 0xB1, 0x61, 0x91, 0x51, 0xC2,
+  0x41, 0xF0, 0x1E, 0x22, 0x1F, 0x02, 0xF0, 0x1F, 0x31, 0xFB, 0x31, 0x35,
+  0x31, 0x20, 0x06, 0x4A, 0x12, 0x43, 0x13, 0xFF, 0xFF, 0xC9, 0x89, 0xFF,
+  0xFF, 0xC3, 0x12, 0x43, 0x13, 0x63, 0x93, 0x23, 0x62, 0x72, 0x32, 0x91,
+  0x31, 0xB1, 0x12, 0xB1, 0x11, 0xC3, 0xC3, 0xC4, 0xB1, 0x21, 0xB1, 0x22,
+  0x91, 0x42, 0x71, 0x77, 0x40, 0x0F, 0x51, 0x91, 0x3F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x53, 0x12, 0x43, 0x13, 0x51, 0x41, 0xA1, 0x41, 0x82, 0x32,
+  0xF3, 0xF3, 0x19, 0xFF, 0x01, 0xFA, 0x14, 0x1F, 0x45, 0xFA, 0x5F, 0xF0,
+  0x1F, 0x41, 0xFF, 0xF0, 0x31, 0xA1, 0x42, 0x32, 0x82, 0x32, 0xFF, 0xA3,
+  0x94, 0x14, 0x52, 0x72, 0x32, 0x92, 0x21, 0xB1, 0x21, 0xB1, 0x12, 0xB1,
+  0x1F, 0x2E, 0x1E, 0x1F, 0x01, 0xA1, 0x32, 0x83, 0x48, 0x30 };
+
+const RleGlyph CourierCyr16pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,  19,    0,    1, 0 },  // 0x20 ' '
+  {     0,   4,  17,  19,    7,  -16, 2 },  // 0x21 '!'
+  {     6,   7,   7,  19,    6,  -16, 2 },  // 0x22 '"'
+  {    12,  12,  21,  19,    3,  -19, 2 },  // 0x23 '#'
+  {    32,  11,  25,  19,    4,  -20, 1 },  // 0x24 '$'
+  {    64,  12,  20,  19,    3,  -19, 0 },  // 0x25 '%'
+  {    94,  15,  17,  19,    2,  -16, 1 },  // 0x26 '&'
+  {   124,   2,   7,  19,    8,  -16, 1 },  // 0x27 '''
+  {   125,   5,  22,  19,    9,  -18, 2 },  // 0x28 '('
+  {   135,   5,  22,  19,    5,  -18, 2 },  // 0x29 ')'
+  {   146,  11,  11,  19,    4,  -18, 0 },  // 0x2A '*'
+  {   162,  13,  13,  19,    3,  -15, 2 },  // 0x2B '+'
+  {   171,   5,   7,  19,    7,   -2, 0 },  // 0x2C ','
+  {   176,  11,   1,  19,    4,   -8, 1 },  // 0x2D '-'
+  {   177,   4,   4,  19,    7,   -3, 0 },  // 0x2E '.'
+  {   179,  11,  22,  19,    4,  -19, 2 },  // 0x2F '/'
+  {   199,  11,  20,  19,    4,  -19, 2 },  // 0x30 '0'
+  {   226,  13,  19,  19,    3,  -18, 2 },  // 0x31 '1'
+  {   239,  12,  20,  19,    2,  -19, 2 },  // 0x32 '2'
+  {   263,  11,  20,  19,    3,  -19, 2 },  // 0x33 '3'
+  {   285,  12,  19,  19,    3,  -18, 2 },  // 0x34 '4'
+  {   304,  12,  18,  19,    3,  -17, 2 },  // 0x35 '5'
+  {   322,  11,  20,  19,    4,  -19, 2 },  // 0x36 '6'
+  {   343,  12,  18,  19,    3,  -17, 2 },  // 0x37 '7'
+  {   360,  12,  20,  19,    3,  -19, 0 },  // 0x38 '8'
+  {   390,  12,  20,  19,    3,  -19, 2 },  // 0x39 '9'
+  {   416,   4,  12,  19,    7,  -11, 0 },  // 0x3A ':'
+  {   422,   5,  15,  19,    6,  -11, 0 },  // 0x3B ';'
+  {   432,  14,  13,  19,    2,  -12, 1 },  // 0x3C '<'
+  {   445,  13,   7,  19,    3,  -12, 1 },  // 0x3D '='
+  {   449,  14,  13,  19,    3,  -12, 1 },  // 0x3E '>'
+  {   463,  11,  17,  19,    4,  -16, 1 },  // 0x3F '?'
+  {   482,  13,  20,  19,    3,  -19, 2 },  // 0x40 '@'
+  {   513,  18,  17,  19,    0,  -16, 2 },  // 0x41 'A'
+  {   537,  16,  17,  19,    1,  -16, 2 },  // 0x42 'B'
+  {   558,  14,  17,  19,    2,  -16, 1 },  // 0x43 'C'
+  {   583,  17,  17,  19,    1,  -16, 2 },  // 0x44 'D'
+  {   605,  15,  17,  19,    2,  -16, 2 },  // 0x45 'E'
+  {   622,  15,  17,  19,    2,  -16, 2 },  // 0x46 'F'
+  {   638,  17,  17,  19,    1,  -16, 2 },  // 0x47 'G'
+  {   665,  15,  17,  19,    2,  -16, 2 },  // 0x48 'H'
+  {   682,  13,  17,  19,    3,  -16, 2 },  // 0x49 'I'
+  {   693,  17,  17,  19,    1,  -16, 2 },  // 0x4A 'J'
+  {   711,  17,  17,  19,    1,  -16, 2 },  // 0x4B 'K'
+  {   743,  15,  17,  19,    2,  -16, 2 },  // 0x4C 'L'
+  {   757,  17,  17,  19,    1,  -16, 2 },  // 0x4D 'M'
+  {   783,  18,  17,  19,    0,  -16, 2 },  // 0x4E 'N'
+  {   811,  15,  17,  19,    2,  -16, 2 },  // 0x4F 'O'
+  {   835,  15,  17,  19,    2,  -16, 2 },  // 0x50 'P'
+  {   851,  15,  21,  19,    2,  -16, 2 },  // 0x51 'Q'
+  {   881,  17,  17,  19,    1,  -16, 2 },  // 0x52 'R'
+  {   907,  13,  17,  19,    3,  -16, 2 },  // 0x53 'S'
+  {   929,  17,  17,  19,    1,  -16, 2 },  // 0x54 'T'
+  {   945,  16,  17,  19,    1,  -16, 2 },  // 0x55 'U'
+  {   963,  18,  17,  19,    0,  -16, 2 },  // 0x56 'V'
+  {   986,  18,  17,  19,    0,  -16, 2 },  // 0x57 'W'
+  {  1009,  16,  17,  19,    2,  -16, 1 },  // 0x58 'X'
+  {  1040,  17,  17,  19,    1,  -16, 2 },  // 0x59 'Y'
+  {  1067,  13,  17,  19,    3,  -16, 2 },  // 0x5A 'Z'
+  {  1087,   5,  23,  19,    9,  -19, 2 },  // 0x5B '['
+  {  1093,  11,  22,  19,    4,  -19, 2 },  // 0x5C
+  {  1112,   5,  23,  19,    5,  -19, 2 },  // 0x5D ']'
+  {  1118,  12,   8,  19,    3,  -18, 0 },  // 0x5E '^'
+  {  1130,  18,   2,  19,    0,    3, 1 },  // 0x5F '_'
+  {  1132,   7,   6,  19,    6,  -20, 0 },  // 0x60 '`'
+  {  1138,  15,  13,  19,    2,  -12, 2 },  // 0x61 'a'
+  {  1159,  17,  20,  19,    1,  -19, 2 },  // 0x62 'b'
+  {  1185,  15,  13,  19,    2,  -12, 1 },  // 0x63 'c'
+  {  1207,  16,  20,  19,    2,  -19, 2 },  // 0x64 'd'
+  {  1234,  15,  13,  19,    2,  -12, 1 },  // 0x65 'e'
+  {  1253,  13,  20,  19,    4,  -19, 2 },  // 0x66 'f'
+  {  1269,  16,  18,  19,    2,  -12, 2 },  // 0x67 'g'
+  {  1299,  17,  20,  19,    1,  -19, 2 },  // 0x68 'h'
+  {  1319,  13,  20,  19,    3,  -19, 2 },  // 0x69 'i'
+  {  1332,   9,  25,  19,    3,  -19, 2 },  // 0x6A 'j'
+  {  1345,  16,  20,  19,    2,  -19, 2 },  // 0x6B 'k'
+  {  1372,  13,  20,  19,    3,  -19, 2 },  // 0x6C 'l'
+  {  1384,  19,  13,  19,    0,  -12, 2 },  // 0x6D 'm'
+  {  1405,  17,  13,  19,    1,  -12, 2 },  // 0x6E 'n'
+  {  1421,  15,  13,  19,    2,  -12, 2 },  // 0x6F 'o'
+  {  1439,  17,  18,  19,    0,  -12, 2 },  // 0x70 'p'
+  {  1465,  16,  18,  19,    2,  -12, 2 },  // 0x71 'q'
+  {  1492,  15,  13,  19,    2,  -12, 2 },  // 0x72 'r'
+  {  1506,  13,  13,  19,    3,  -12, 2 },  // 0x73 's'
+  {  1523,  13,  17,  19,    3,  -16, 2 },  // 0x74 't'
+  {  1538,  16,  13,  19,    1,  -12, 2 },  // 0x75 'u'
+  {  1553,  17,  13,  19,    1,  -12, 2 },  // 0x76 'v'
+  {  1575,  18,  13,  19,    0,  -12, 2 },  // 0x77 'w'
+  {  1595,  17,  13,  19,    1,  -12, 1 },  // 0x78 'x'
+  {  1619,  17,  18,  19,    0,  -12, 2 },  // 0x79 'y'
+  {  1649,  11,  13,  19,    4,  -12, 1 },  // 0x7A 'z'
+  {  1664,   8,  23,  19,    6,  -19, 2 },  // 0x7B '{'
+  {  1677,   1,  22,  19,    9,  -19, 1 },  // 0x7C '|'
+  {  1679,   8,  23,  19,    5,  -19, 2 },  // 0x7D '}'
+  {  1692,  14,   3,  19,    2,   -7, 0 },  // 0x7E '~'
+  {  1698,  16,  20,  23,    4,  -19, 2 },  // 0x7F
+  {  1711,  16,  19,  19,    1,  -13, 2 },  // 0x80
+  {  1743,  14,  14,  19,    2,  -13, 1 },  // 0x81
+  {  1765,  15,  13,  19,    2,  -12, 2 },  // 0x82
+  {  1779,  17,  18,  19,    0,  -12, 2 },  // 0x83
+  {  1810,  15,  25,  19,    2,  -19, 2 },  // 0x84
+  {  1850,  17,  13,  19,    1,  -12, 1 },  // 0x85
+  {  1874,  17,  17,  19,    1,  -12, 2 },  // 0x86
+  {  1890,  16,  13,  19,    1,  -12, 2 },  // 0x87
+  {  1907,  17,  13,  19,    1,  -12, 2 },  // 0x88
+  {  1925,  17,  17,  19,    1,  -12, 2 },  // 0x89
+  {  1945,  16,  13,  19,    1,  -12, 2 },  // 0x8A
+  {  1961,  17,  13,  19,    1,  -12, 2 },  // 0x8B
+  {  1980,  15,  13,  19,    2,  -12, 2 },  // 0x8C
+  {  1995,  15,  14,  19,    2,  -13, 1 },  // 0x8D
+  {  2016,  17,  14,  19,    1,  -13, 0 },  // 0x8E
+  {  2046,  16,  13,  19,    1,  -12, 2 },  // 0x8F
+  {  2068,  18,  17,  19,    0,  -16, 2 },  // 0x90
+  {  2094,  15,  17,  19,    2,  -16, 2 },  // 0x91
+  {  2113,  15,  17,  19,    2,  -16, 2 },  // 0x92
+  {  2138,  15,  17,  19,    2,  -16, 2 },  // 0x93
+  {  2152,  16,  21,  19,    1,  -16, 2 },  // 0x94
+  {  2173,  15,  17,  19,    2,  -16, 2 },  // 0x95
+  {  2191,  16,  17,  19,    1,  -16, 0 },  // 0x96
+  {  2225,  13,  19,  19,    2,  -17, 1 },  // 0x97
+  {  2251,  16,  17,  19,    1,  -16, 2 },  // 0x98
+  {  2271,  16,  21,  19,    1,  -20, 2 },  // 0x99
+  {  2299,  17,  17,  19,    1,  -16, 2 },  // 0x9A
+  {  2332,  16,  17,  19,    1,  -16, 2 },  // 0x9B
+  {  2350,  18,  17,  19,    0,  -16, 2 },  // 0x9C
+  {  2376,  16,  17,  19,    1,  -16, 2 },  // 0x9D
+  {  2393,  16,  19,  19,    1,  -17, 1 },  // 0x9E
+  {  2425,  16,  17,  19,    1,  -16, 2 },  // 0x9F
+  {  2440,  14,  17,  19,    3,  -16, 2 },  // 0xA0
+  {  2456,  16,  19,  19,    1,  -17, 2 },  // 0xA1
+  {  2485,  16,  17,  19,    1,  -16, 2 },  // 0xA2
+  {  2501,  19,  18,  19,    0,  -16, 1 },  // 0xA3
+  {  2535,  16,  18,  19,    1,  -17, 0 },  // 0xA4
+  {  2571,  17,  17,  19,    1,  -16, 1 },  // 0xA5
+  {  2604,  16,  21,  19,    1,  -16, 2 },  // 0xA6
+  {  2622,  16,  17,  19,    1,  -16, 2 },  // 0xA7
+  {  2639,  17,  17,  19,    1,  -16, 2 },  // 0xA8
+  {  2659,  17,  21,  19,    1,  -16, 2 },  // 0xA9
+  {  2681,  16,  17,  19,    1,  -16, 2 },  // 0xAA
+  {  2702,  17,  17,  19,    1,  -16, 2 },  // 0xAB
+  {  2725,  15,  17,  19,    2,  -16, 2 },  // 0xAC
+  {  2743,  15,  19,  19,    2,  -17, 2 },  // 0xAD
+  {  2770,  17,  19,  19,    1,  -17, 2 },  // 0xAE
+  {  2808,  17,  17,  19,    1,  -16, 2 },  // 0xAF
+  {  2834,  15,  14,  19,    2,  -13, 2 },  // 0xB0
+  {  2855,  14,  20,  19,    2,  -19, 1 },  // 0xB1
+  {  2886,  14,  13,  19,    2,  -12, 2 },  // 0xB2
+  {  2905,  15,  13,  19,    2,  -12, 2 },  // 0xB3
+  {  2918,  16,  17,  19,    1,  -12, 2 },  // 0xB4
+  {  2935,  15,  14,  19,    2,  -13, 1 },  // 0xB5
+  {  2958,  16,  13,  19,    1,  -12, 0 },  // 0xB6
+  {  2984,  14,  14,  19,    2,  -13, 1 },  // 0xB7
+  {  3006,  17,  13,  19,    1,  -12, 2 },  // 0xB8
+  {  3027,  17,  19,  19,    1,  -18, 2 },  // 0xB9
+  {  3057,  15,  13,  19,    2,  -12, 0 },  // 0xBA
+  {  3082,  16,  13,  19,    1,  -12, 2 },  // 0xBB
+  {  3096,  18,  13,  19,    0,  -12, 2 },  // 0xBC
+  {  3122,  17,  13,  19,    1,  -12, 2 },  // 0xBD
+  {  3137,  15,  14,  19,    2,  -13, 1 },  // 0xBE
+  {  3161,  17,  13,  19,    1,  -12, 2 },  // 0xBF
+  {  3174,  15,  21,  19,    2,  -20, 2 },  // 0xC0
+  {  3198,  15,  18,  19,    2,  -17, 1 }   // 0xC1
+};
+
+const RleFont CourierCyr16pt8bRle PROGMEM = {
+  CourierCyr16pt8bRleData,
+  CourierCyr16pt8bRleGlyphs,
+  0x20, 0xC1, 25 };
+
+#endif // COURIERCYR16PT8BRLE_H_
@@ -0,0 +1,503 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr18.h, do not edit.
+// 162 glyphs (0 sharing another's bitmap), 3890 bytes of bitmap data (GFXfont: 6050)
+#ifndef COURIERCYR18PT8BRLE_H_
+#define COURIERCYR18PT8BRLE_H_
+
+const uint8_t CourierCyr18pt8bRleData[] PROGMEM = {
+  0x12, 0xFF, 0xF5, 0x2A, 0x21, 0x12, 0x14, 0x12, 0x10, 0x03, 0x13, 0x21,
+  0x11, 0xFF, 0xE0, 0x42, 0x41, 0x81, 0xFF, 0x11, 0xFF, 0xF1, 0x41, 0x42,
+  0x71, 0x41, 0x4F, 0xFF, 0xFA, 0x41, 0x41, 0x72, 0x41, 0x4F, 0xF2, 0x1F,
+  0xFF, 0xE1, 0x50, 0x61, 0xC1, 0xC1, 0x41, 0x46, 0x22, 0x22, 0x53, 0x21,
+  0x91, 0x11, 0xA1, 0x11, 0xC1, 0xC1, 0xD1, 0xC4, 0xB5, 0xB5, 0xC2, 0xC2,
+  0xC1, 0xC2, 0xB2, 0xA1, 0x12, 0x82, 0x1A, 0x31, 0x51, 0xC1, 0xC1, 0xC1,
+  0xC1, 0x60, 0x3E, 0x01, 0x8C, 0x0C, 0x18, 0x20, 0x20, 0x80, 0x82, 0x02,
+  0x0C, 0x18, 0x18, 0xC2, 0x3E, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x0C, 0x3E, 0x01, 0x8C, 0x08, 0x08, 0x20, 0x20, 0x80, 0x82,
+  0x02, 0x04, 0x30, 0x0F, 0x80, 0x45, 0xA5, 0x11, 0x82, 0x41, 0x11, 0xE2,
+  0xFF, 0xA1, 0xE1, 0xF2, 0x1E, 0x1F, 0x01, 0x11, 0xC1, 0x11, 0x11, 0x44,
+  0x23, 0x11, 0x63, 0x11, 0x61, 0x91, 0x41, 0x32, 0xB2, 0xF1, 0x26, 0x18,
+  0x15, 0x11, 0x14, 0x11, 0x17, 0x61, 0x11, 0x60, 0xFF, 0xFF, 0x41, 0x32,
+  0x72, 0x71, 0x51, 0xC2, 0xFF, 0x82, 0xF0, 0x13, 0x1A, 0x29, 0x20, 0x01,
+  0x42, 0x92, 0xA1, 0x31, 0xF0, 0x2F, 0xF8, 0x2C, 0x15, 0x17, 0x27, 0x23,
+  0x02, 0x00, 0x10, 0x00, 0x81, 0x04, 0x2F, 0x27, 0xBF, 0xF8, 0x1C, 0x00,
+  0xA0, 0x0D, 0x80, 0xC6, 0x0C, 0x18, 0x20, 0x80, 0x71, 0xFF, 0xFF, 0xFF,
+  0x77, 0x1E, 0x17, 0xFF, 0xFF, 0xFF, 0x00, 0x39, 0xCC, 0xE6, 0x31, 0x98,
+  0xC0, 0x0D, 0x6F, 0xF6, 0xB1, 0xA1, 0xC1, 0x91, 0xC1, 0x91, 0xC1, 0xF6,
+  0x2F, 0x61, 0xC1, 0x91, 0xC1, 0x91, 0xC1, 0x91, 0xC1, 0xF6, 0x2F, 0x61,
+  0xC1, 0x91, 0xC1, 0xA0, 0x45, 0x77, 0x52, 0x52, 0x32, 0x72, 0xFC, 0x29,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xC2, 0x92, 0xFC, 0x27, 0x23, 0x34, 0x25, 0x11,
+  0x53, 0x61, 0xA2, 0x83, 0x11, 0x71, 0x13, 0x82, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x96, 0x16, 0x45, 0x62, 0x52, 0x32, 0x72, 0x12, 0x91,
+  0x12, 0xA1, 0xC1, 0xC1, 0xC1, 0xC1, 0xB1, 0xB2, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xA2, 0xA2, 0xA2, 0x71, 0x22, 0x81, 0x12, 0x93, 0xAE, 0x36, 0x53, 0x51,
+  0x32, 0x81, 0xD1, 0xC1, 0xC1, 0xC1, 0xB2, 0xB1, 0xA2, 0x85, 0xC2, 0xD1,
+  0xC2, 0xC1, 0xC1, 0xC1, 0xC1, 0xB1, 0x11, 0x92, 0x13, 0x62, 0x56, 0x40,
+  0x92, 0xB1, 0xC1, 0x11, 0xF9, 0x11, 0x1C, 0x1B, 0x1E, 0x1B, 0x1C, 0x11,
+  0x1C, 0x1B, 0x1E, 0x1B, 0x1C, 0x11, 0x1C, 0x1D, 0x91, 0xD1, 0x3F, 0xFF,
+  0x25, 0x13, 0x1B, 0x3A, 0xFF, 0xFF, 0xF7, 0x66, 0x11, 0x74, 0x25, 0x11,
+  0x12, 0x18, 0x1D, 0x2F, 0xFF, 0xF3, 0x2A, 0x12, 0x36, 0x11, 0x11, 0xB2,
+  0x76, 0x58, 0x43, 0x92, 0xA2, 0xA2, 0xFF, 0x62, 0xF0, 0x56, 0x21, 0x63,
+  0x11, 0x24, 0x11, 0x13, 0x17, 0x13, 0x19, 0x2F, 0xF9, 0x2F, 0x72, 0x12,
+  0x71, 0x43, 0x41, 0x11, 0x46, 0x11, 0x20, 0x0E, 0x1B, 0xF0, 0x1E, 0x1A,
+  0x1E, 0x1B, 0x1F, 0xD1, 0xB1, 0xE1, 0xFA, 0x1E, 0x1F, 0xA1, 0xE1, 0xFA,
+  0x1E, 0x1B, 0x18, 0x45, 0x69, 0x33, 0x53, 0xE2, 0x92, 0xFF, 0x92, 0x92,
+  0x21, 0x71, 0x31, 0x11, 0x51, 0x11, 0x31, 0x15, 0x11, 0x41, 0x15, 0x11,
+  0x33, 0x53, 0x11, 0xB1, 0x11, 0x91, 0xFF, 0x84, 0xC3, 0x53, 0x39, 0x20,
+  0x44, 0x78, 0x43, 0x43, 0xC2, 0x12, 0xF7, 0x2F, 0xF9, 0x29, 0x13, 0x17,
+  0x13, 0x11, 0x14, 0x21, 0x13, 0x61, 0x26, 0x5F, 0x02, 0xF8, 0x2F, 0x82,
+  0xA2, 0x93, 0x48, 0x50, 0x6F, 0xF6, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x18,
+  0xF3, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x8C, 0x31, 0xC6, 0x18, 0xC0,
+  0xE2, 0xC3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xF0, 0x3F, 0x03, 0xF0,
+  0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x20, 0x0E, 0xFF, 0xFF, 0xF9, 0xE0,
+  0x02, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3B,
+  0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3C, 0x2E, 0x26, 0x4A, 0x31, 0x63, 0xB3,
+  0xFF, 0xF0, 0x29, 0x19, 0x45, 0x58, 0x2F, 0x61, 0xFF, 0x43, 0xF5, 0x13,
+  0x17, 0x13, 0x15, 0x55, 0x89, 0x51, 0x11, 0x51, 0x71, 0x72, 0x32, 0xFC,
+  0x2F, 0xF7, 0x3A, 0x59, 0x3B, 0x2F, 0xF4, 0x18, 0x23, 0x1B, 0x31, 0x11,
+  0x44, 0x51, 0x3F, 0x12, 0xF8, 0x15, 0x35, 0x11, 0x15, 0xA2, 0x47, 0xD5,
+  0xF4, 0x4F, 0xF5, 0x14, 0x1F, 0x01, 0x21, 0xFF, 0x42, 0x42, 0xFF, 0x11,
+  0x81, 0xB1, 0x61, 0xFF, 0x01, 0x18, 0x11, 0x9A, 0xFD, 0x2A, 0x2F, 0xA2,
+  0xD1, 0xF3, 0x13, 0x21, 0x46, 0x41, 0x20, 0x0D, 0x43, 0x1A, 0xF1, 0x2F,
+  0x12, 0xFF, 0xFF, 0x62, 0xD2, 0x78, 0x12, 0x6B, 0xF0, 0x3F, 0x21, 0xF0,
+  0x1F, 0xFF, 0xF7, 0x2D, 0x31, 0x31, 0x91, 0x12, 0x66, 0x31, 0x47, 0x12,
+  0x53, 0x52, 0x11, 0x32, 0x91, 0x32, 0xFC, 0x11, 0x2F, 0xE1, 0xFF, 0xFF,
+  0xF5, 0x2F, 0xFF, 0x22, 0xB1, 0x32, 0xB1, 0x33, 0x62, 0x11, 0x4B, 0x10,
+  0x0D, 0x53, 0x1B, 0xF1, 0x11, 0x1F, 0x11, 0xF3, 0x2F, 0xF5, 0x2F, 0xFF,
+  0xFF, 0xFF, 0xF4, 0x1F, 0x31, 0xFF, 0x32, 0xF0, 0x1F, 0x04, 0x23, 0x18,
+  0x11, 0x40, 0x0F, 0x51, 0xBF, 0x21, 0xFF, 0xFF, 0x31, 0x41, 0xFF, 0x87,
+  0xA7, 0xFF, 0xF6, 0x1F, 0x61, 0xFF, 0xFF, 0x83, 0x1C, 0x10, 0x0F, 0x51,
+  0xBF, 0xFF, 0x61, 0xFE, 0x14, 0x1F, 0xF8, 0x7A, 0x7F, 0xFF, 0x61, 0xFF,
+  0xFF, 0xFF, 0x03, 0x15, 0x80, 0x66, 0x31, 0x67, 0x12, 0x73, 0x52, 0x11,
+  0x52, 0x91, 0x52, 0xB1, 0xF6, 0x2F, 0xF1, 0x1F, 0xFF, 0xFF, 0x9A, 0x85,
+  0x12, 0xFF, 0x72, 0xF2, 0x2F, 0x23, 0x72, 0x7C, 0x20, 0x07, 0x5A, 0x13,
+  0x53, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xB8, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF6, 0x31, 0x35, 0x31, 0x30, 0x0F, 0x41, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFB, 0x61, 0x60, 0x6D, 0x67, 0x15, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF6, 0x2F, 0x21, 0xFF, 0xFF, 0xFC, 0x27, 0x1F, 0x21, 0x12,
+  0x62, 0x8A, 0x70, 0x07, 0x46, 0x41, 0x92, 0x61, 0x82, 0x71, 0x72, 0x81,
+  0x62, 0x91, 0x52, 0xA1, 0x42, 0xB1, 0x32, 0xC1, 0x31, 0xD1, 0x23, 0xC1,
+  0x11, 0x22, 0xB2, 0x42, 0xA1, 0x62, 0x91, 0x71, 0x91, 0x81, 0x81, 0x81,
+  0x81, 0x91, 0x71, 0x91, 0x71, 0x92, 0x37, 0x74, 0x09, 0x84, 0x14, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xC1, 0x14, 0x1A,
+  0x20, 0x05, 0xB8, 0x21, 0x91, 0x23, 0x41, 0xB1, 0xA1, 0x71, 0xB1, 0x91,
+  0xFF, 0x22, 0x52, 0xFF, 0x51, 0x31, 0xF0, 0x15, 0x1F, 0x11, 0x11, 0xF2,
+  0x13, 0x1F, 0xF9, 0x1F, 0x41, 0x11, 0xF4, 0x1F, 0xFF, 0xFD, 0x31, 0x45,
+  0x41, 0x30, 0x05, 0x7B, 0x21, 0x64, 0x13, 0x41, 0xF5, 0x2F, 0xF9, 0x2F,
+  0x51, 0xF3, 0x1F, 0x61, 0xF3, 0x1F, 0x52, 0xF5, 0x1F, 0x31, 0xF6, 0x1F,
+  0x31, 0xF5, 0x2F, 0xF9, 0x2F, 0x51, 0x43, 0x14, 0x61, 0x50, 0x65, 0xA9,
+  0x73, 0x53, 0x52, 0x92, 0x32, 0xB2, 0xF3, 0x1F, 0x21, 0xD2, 0xFF, 0xFF,
+  0xFB, 0x1D, 0x11, 0x1F, 0x01, 0xF3, 0x2B, 0x23, 0x29, 0x25, 0x35, 0x37,
+  0x94, 0x0C, 0x43, 0x1A, 0xE1, 0x11, 0xE1, 0xF1, 0x2F, 0xFF, 0xF2, 0x2F,
+  0xD3, 0x5A, 0x68, 0xFF, 0xFF, 0xFF, 0xA3, 0x15, 0x70, 0x65, 0xA9, 0x73,
+  0x53, 0x52, 0x92, 0x32, 0xB2, 0xF3, 0x1F, 0x21, 0xD2, 0xFF, 0xFF, 0xFB,
+  0x1D, 0x11, 0x1F, 0x01, 0xF3, 0x2B, 0x24, 0x19, 0x24, 0x11, 0x25, 0x36,
+  0x21, 0x79, 0x12, 0x3B, 0x11, 0x1D, 0x12, 0x49, 0x11, 0xC0, 0x0C, 0x63,
+  0x1A, 0xF1, 0x1F, 0x32, 0xFF, 0xFF, 0xFD, 0x2E, 0x38, 0x71, 0x19, 0x52,
+  0x1F, 0x01, 0x11, 0xF1, 0x11, 0x1F, 0x11, 0xF3, 0x2F, 0xF5, 0x2F, 0x63,
+  0x13, 0x83, 0x57, 0x21, 0x32, 0x64, 0x21, 0x93, 0x21, 0xA2, 0x11, 0xB2,
+  0x11, 0xC1, 0x11, 0xE1, 0xF0, 0x2E, 0x4D, 0x7F, 0x02, 0xE2, 0xE2, 0xD2,
+  0xD3, 0xB1, 0x13, 0xA1, 0x15, 0x62, 0x21, 0x37, 0x40, 0x0F, 0x21, 0x71,
+  0x7F, 0xFF, 0xFF, 0xFD, 0x1F, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9,
+  0x41, 0x53, 0x07, 0x5A, 0x13, 0x53, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x29, 0x2F, 0xB3, 0x53, 0x99, 0x50, 0x07, 0x69,
+  0x23, 0x63, 0x22, 0x21, 0xE1, 0xFA, 0x2A, 0x2F, 0xFF, 0x22, 0x82, 0xFF,
+  0xF4, 0x26, 0x2F, 0xF2, 0x14, 0x1D, 0x16, 0x1F, 0xF4, 0x12, 0x1F, 0x01,
+  0x41, 0xFF, 0x54, 0xFD, 0x06, 0x88, 0x13, 0x83, 0x12, 0xFF, 0xF4, 0x2F,
+  0xFF, 0x71, 0x41, 0x21, 0x41, 0x51, 0x62, 0x61, 0xFE, 0x1F, 0x51, 0x22,
+  0xFF, 0xF8, 0x24, 0x29, 0x2A, 0x1F, 0x51, 0x82, 0x62, 0xFF, 0xF0, 0x16,
+  0x46, 0x41, 0xA1, 0x62, 0x82, 0x72, 0x62, 0x91, 0x61, 0xA2, 0x42, 0xB2,
+  0x22, 0xD1, 0x21, 0xF0, 0x2F, 0x12, 0xF0, 0x3F, 0x01, 0x21, 0xD2, 0x22,
+  0xB2, 0x42, 0xA1, 0x61, 0x91, 0x81, 0x72, 0x82, 0x61, 0xA1, 0x51, 0xC1,
+  0x27, 0x47, 0x07, 0x5A, 0x13, 0x53, 0x13, 0x41, 0x91, 0x71, 0xB1, 0x81,
+  0x71, 0x91, 0x91, 0xA1, 0x51, 0xB1, 0x71, 0xB2, 0x32, 0xE1, 0x11, 0xF0,
+  0x13, 0x1F, 0x11, 0xF2, 0x11, 0x1F, 0xFF, 0xFF, 0xFF, 0xF6, 0x51, 0x45,
+  0x0E, 0x2C, 0xE2, 0xC2, 0xC1, 0xF0, 0x13, 0x18, 0x2C, 0x2C, 0x1F, 0x01,
+  0xC2, 0xC1, 0xD1, 0x11, 0xD1, 0x81, 0x32, 0xC1, 0xD1, 0x11, 0xD1, 0xC2,
+  0xED, 0x10, 0x05, 0x14, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x01, 0xC1, 0xA1,
+  0xD1, 0xA1, 0xD1, 0xA1, 0xF9, 0x2F, 0x91, 0xA1, 0xD1, 0xA1, 0xD1, 0xA1,
+  0xF9, 0x2F, 0x82, 0xF9, 0x1A, 0x1D, 0x1A, 0x11, 0x09, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x41, 0x61, 0xD2, 0xB4, 0x92, 0x22, 0x72, 0x42, 0x61, 0x61, 0x51,
+  0x81, 0x32, 0x91, 0x12, 0xA2, 0x0F, 0xFC, 0xE0, 0xE0, 0xC0, 0xC0, 0xC0,
+  0x80, 0x80, 0x47, 0x73, 0x18, 0x63, 0x61, 0x61, 0xA2, 0xFF, 0xB9, 0x6B,
+  0x53, 0xD2, 0xFF, 0xE1, 0x42, 0x91, 0x71, 0x55, 0x57, 0x12, 0x33, 0x04,
+  0xF1, 0x2F, 0x11, 0xFF, 0xFF, 0xFF, 0xC6, 0xBA, 0x83, 0x63, 0x62, 0xA2,
+  0xF9, 0x1C, 0x2F, 0xFF, 0xFF, 0x51, 0xC2, 0xF8, 0x39, 0x26, 0x11, 0x16,
+  0x32, 0x33, 0xA3, 0x56, 0x31, 0x3B, 0x33, 0x62, 0x32, 0xFA, 0x11, 0x2C,
+  0x1F, 0xFF, 0xF0, 0x2F, 0xC1, 0x12, 0xA1, 0x33, 0x62, 0x11, 0x3B, 0x10,
+  0x87, 0xE3, 0xC3, 0xFF, 0xFF, 0xF9, 0x5B, 0x98, 0x35, 0x36, 0x29, 0x2F,
+  0x72, 0xB1, 0xFF, 0xFF, 0xF1, 0x2B, 0x1F, 0x82, 0x92, 0x63, 0x53, 0x89,
+  0x33, 0x56, 0x82, 0x62, 0x51, 0x92, 0x31, 0xB2, 0x21, 0xC1, 0x11, 0xD1,
+  0x11, 0xDF, 0x4F, 0x01, 0xF1, 0x1F, 0x01, 0xF1, 0x1B, 0x23, 0x26, 0x46,
+  0x74, 0x68, 0x59, 0x42, 0xFF, 0xFF, 0x44, 0x18, 0x14, 0x18, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF4, 0x41, 0x81, 0x55, 0x34, 0x36, 0x12, 0x23, 0x23,
+  0x42, 0x11, 0x52, 0x81, 0xF7, 0x2A, 0x1F, 0xFF, 0xFC, 0x2A, 0x1F, 0x72,
+  0x82, 0x63, 0x43, 0x86, 0x11, 0xB5, 0xFF, 0xF8, 0x24, 0x37, 0x25, 0x21,
+  0x85, 0x05, 0xF0, 0x3F, 0x01, 0xFF, 0xFF, 0xFF, 0xD5, 0xC8, 0x94, 0x61,
+  0x91, 0x71, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x13, 0x43,
+  0x13, 0x52, 0xFF, 0xF5, 0x2F, 0xF3, 0x67, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x61, 0x60, 0x92, 0xFF, 0xC2, 0xF8, 0xA1, 0x9F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xA2, 0xB1, 0x72, 0x28, 0x20, 0x04, 0xF0, 0x2F, 0x01, 0xFF,
+  0xFF, 0xFF, 0x97, 0xB1, 0x24, 0xB1, 0x11, 0xE1, 0x11, 0xD4, 0xD1, 0x11,
+  0xE1, 0xF1, 0x11, 0x11, 0x1D, 0x21, 0x11, 0x1F, 0x11, 0x11, 0xF1, 0x11,
+  0x1F, 0x11, 0x11, 0xF1, 0x11, 0x1F, 0x11, 0x11, 0x33, 0x82, 0x23, 0x07,
+  0x93, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x46, 0x16,
+  0x04, 0x15, 0x34, 0x43, 0x11, 0x13, 0x18, 0x72, 0x31, 0x21, 0x42, 0xD1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x93, 0x13, 0x42, 0x62, 0x04,
+  0x46, 0x53, 0x2A, 0x81, 0x12, 0x71, 0x72, 0x81, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xE3, 0x13, 0x53, 0x13, 0x57, 0x82, 0x63, 0x52, 0x92, 0x32,
+  0xB2, 0x21, 0xD1, 0x11, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF0, 0x11,
+  0x1D, 0x12, 0x1C, 0x23, 0x29, 0x25, 0x27, 0x28, 0x75, 0x04, 0x36, 0x53,
+  0x22, 0x17, 0x71, 0x12, 0x53, 0x71, 0x92, 0xF8, 0x1B, 0x2F, 0xFF, 0xFF,
+  0x11, 0xB2, 0xF7, 0x29, 0x26, 0x35, 0x38, 0x9B, 0x5F, 0xFF, 0xFF, 0x23,
+  0x15, 0x90, 0x56, 0x34, 0x37, 0x11, 0x33, 0x23, 0x54, 0x52, 0x91, 0xF8,
+  0x2B, 0x1F, 0xFF, 0xFF, 0x12, 0xB1, 0xF8, 0x29, 0x26, 0x35, 0x38, 0x9B,
+  0x5F, 0xFF, 0xFF, 0xE5, 0x13, 0x15, 0x55, 0x24, 0x42, 0x15, 0x81, 0x12,
+  0x41, 0x64, 0xE1, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x17, 0x40,
+  0x37, 0x21, 0x22, 0x73, 0x12, 0x92, 0x11, 0xB1, 0x11, 0xB1, 0x12, 0xD3,
+  0xD8, 0xE2, 0xE2, 0xC2, 0xC3, 0xA1, 0x14, 0x72, 0x11, 0x37, 0x30, 0x21,
+  0xFF, 0xFF, 0xC2, 0x1A, 0x22, 0x1A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51,
+  0x91, 0x31, 0x11, 0x53, 0x11, 0x37, 0x14, 0x04, 0x74, 0x33, 0x83, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x72, 0x71, 0x11, 0x51, 0x11, 0x89,
+  0x23, 0x07, 0x5A, 0x13, 0x53, 0x13, 0x41, 0x91, 0x71, 0xB1, 0xFB, 0x27,
+  0x1F, 0x41, 0xA1, 0x51, 0xB1, 0x71, 0xC1, 0x31, 0xD1, 0x51, 0xFF, 0x22,
+  0x12, 0xFF, 0x43, 0x80, 0x06, 0x88, 0x13, 0x83, 0x12, 0xFE, 0x2F, 0xF2,
+  0x1C, 0x15, 0x15, 0x45, 0x1F, 0xE1, 0x41, 0xF0, 0x12, 0x1B, 0x2A, 0x1A,
+  0x24, 0x22, 0x1F, 0xD1, 0xF5, 0x16, 0x25, 0x16, 0x56, 0x42, 0x92, 0x72,
+  0x72, 0x92, 0x52, 0xB2, 0x32, 0xD2, 0x12, 0xF0, 0x3F, 0x13, 0xF0, 0x21,
+  0x2D, 0x23, 0x2B, 0x25, 0x29, 0x27, 0x27, 0x29, 0x17, 0x1B, 0x13, 0x75,
+  0x70, 0x06, 0x76, 0x22, 0xB2, 0x51, 0xB1, 0x62, 0x92, 0x71, 0x91, 0x82,
+  0x72, 0x91, 0x71, 0xA2, 0x52, 0xB1, 0x51, 0xC2, 0x32, 0xD1, 0x31, 0xE2,
+  0x12, 0xE2, 0x11, 0xF1, 0x3F, 0x12, 0xF2, 0x2F, 0x21, 0xF2, 0x1F, 0x31,
+  0xF2, 0x1C, 0xA9, 0x0E, 0xA3, 0x92, 0x11, 0x82, 0xA2, 0xA2, 0xA2, 0xA2,
+  0xB1, 0xB1, 0xB1, 0xB1, 0x91, 0x11, 0xA2, 0xBE, 0x53, 0x41, 0x12, 0x33,
+  0xFF, 0xFF, 0xF1, 0x24, 0x35, 0x37, 0x2F, 0xFF, 0xFB, 0x36, 0x11, 0x20,
+  0x0F, 0xA0, 0x03, 0x52, 0x11, 0x61, 0x11, 0x61, 0xFF, 0xFF, 0xC2, 0x73,
+  0x53, 0x42, 0xFF, 0xFF, 0x83, 0x32, 0x11, 0x40, 0x3C, 0x03, 0xC3, 0x86,
+  0x80, 0x78, 0x0F, 0x31, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x11, 0x04, 0x37, 0x43, 0x28, 0x11, 0x71,
+  0x11, 0x63, 0x71, 0x92, 0x51, 0xC1, 0xFF, 0x41, 0xFF, 0xF8, 0x1F, 0x81,
+  0xC1, 0x51, 0x92, 0x51, 0x11, 0x62, 0x88, 0x12, 0x93, 0x13, 0xE1, 0xFF,
+  0xD3, 0x15, 0x90, 0x48, 0x21, 0x23, 0x64, 0x12, 0xA2, 0x11, 0xB4, 0xC2,
+  0xE1, 0xE1, 0xE1, 0xE1, 0xE2, 0xE1, 0xE2, 0xA2, 0x22, 0x82, 0x49, 0xA1,
+  0x70, 0x0F, 0x21, 0x71, 0x6F, 0x21, 0xFF, 0xF7, 0x1F, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x25, 0x14, 0x40, 0x06, 0x76, 0x21, 0xD1, 0x42, 0xB2, 0x51,
+  0xB1, 0x62, 0x92, 0x71, 0x82, 0x82, 0x71, 0xA1, 0x62, 0xA2, 0x51, 0xC1,
+  0x42, 0xC2, 0x31, 0xE1, 0x22, 0xF0, 0x3F, 0x12, 0xF2, 0x2F, 0x21, 0xF2,
+  0x2F, 0x21, 0xF2, 0x2B, 0xA9, 0x45, 0xD3, 0xD1, 0xFF, 0xFF, 0xF9, 0x41,
+  0x47, 0x11, 0x31, 0x31, 0x15, 0x11, 0x17, 0x11, 0x13, 0x11, 0x19, 0x11,
+  0x11, 0x11, 0x1B, 0x11, 0x1F, 0x31, 0xD1, 0xFF, 0x61, 0xD1, 0xF3, 0x11,
+  0x1B, 0x11, 0x11, 0x1D, 0x13, 0x37, 0x35, 0x11, 0x31, 0x31, 0x17, 0x41,
+  0x4F, 0xFF, 0xE4, 0x14, 0x40, 0x07, 0x56, 0x42, 0x92, 0x72, 0x72, 0x92,
+  0x52, 0xB2, 0x32, 0xD2, 0x12, 0xF0, 0x3F, 0x13, 0xF0, 0x21, 0x2D, 0x23,
+  0x2B, 0x25, 0x29, 0x27, 0x27, 0x29, 0x25, 0x2B, 0x22, 0x75, 0x70, 0x07,
+  0x5A, 0x13, 0x53, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x31, 0xB1, 0xF6, 0xFF, 0xFD, 0x07, 0x4A, 0x22, 0x43, 0x13, 0xFF, 0xFF,
+  0xF0, 0x1F, 0x43, 0x42, 0x82, 0x24, 0x11, 0xA7, 0xFF, 0xFF, 0xFC, 0x41,
+  0x30, 0x06, 0x15, 0x19, 0x12, 0x12, 0x12, 0x12, 0x13, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x31, 0x51, 0x51, 0x30, 0x06, 0x15, 0x19,
+  0x12, 0x12, 0x12, 0x12, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF3, 0x31, 0x51, 0x51, 0xF6, 0xFF, 0xFD, 0x0A, 0xA5, 0x13, 0xFF, 0xFF,
+  0x61, 0xFA, 0x4F, 0x45, 0xAB, 0xF2, 0x1F, 0x51, 0xFF, 0x71, 0xF0, 0x25,
+  0x31, 0x81, 0x21, 0x07, 0x77, 0x14, 0x72, 0x12, 0xFF, 0xFF, 0xF4, 0x3F,
+  0x45, 0xBA, 0xF2, 0x1F, 0xF9, 0x1F, 0x31, 0xE3, 0x72, 0x16, 0x22, 0x12,
+  0x12, 0x08, 0x93, 0x14, 0xFF, 0xFF, 0xF6, 0x6F, 0x25, 0x6A, 0x11, 0xF0,
+  0x11, 0x1F, 0x01, 0xFF, 0x31, 0xE2, 0x14, 0x19, 0x12, 0x10, 0x01, 0x2A,
+  0x44, 0x82, 0x32, 0xB2, 0x22, 0xC2, 0x11, 0xE1, 0xF1, 0x2F, 0x02, 0x6B,
+  0xF0, 0x2F, 0x02, 0xF0, 0x1F, 0x02, 0x11, 0xC2, 0x23, 0x83, 0x5A, 0xC1,
+  0x90, 0x06, 0x37, 0x33, 0x12, 0x21, 0x15, 0x11, 0x91, 0x11, 0x51, 0xF5,
+  0x19, 0x17, 0x18, 0x1B, 0x1F, 0x82, 0xF2, 0x2F, 0xF8, 0x1B, 0x18, 0x17,
+  0x1F, 0xD1, 0x11, 0x51, 0x11, 0x13, 0x12, 0x21, 0x15, 0x11, 0x26, 0x33,
+  0x13, 0x30, 0x5D, 0x41, 0x18, 0x22, 0x33, 0xFF, 0x21, 0xF2, 0x1F, 0x42,
+  0xF0, 0x21, 0x89, 0x22, 0x5C, 0x1F, 0x02, 0xF0, 0x1F, 0x11, 0x11, 0xE1,
+  0x11, 0xC3, 0x11, 0x63, 0x22, 0x47, 0xF6, 0x1D, 0x51, 0x1F, 0x31, 0x31,
+  0xF2, 0x11, 0x1F, 0xF7, 0x23, 0x2F, 0xF4, 0x17, 0x1D, 0x15, 0x1F, 0xF3,
+  0x27, 0x2B, 0x9A, 0x11, 0x91, 0x19, 0x19, 0x18, 0x1D, 0x17, 0x1B, 0x1F,
+  0xC2, 0xE1, 0x22, 0x14, 0x73, 0x22, 0x0F, 0x1F, 0x33, 0x1B, 0xFF, 0xFF,
+  0x81, 0xFF, 0x9A, 0x78, 0x21, 0xE2, 0x11, 0xF0, 0x11, 0x1F, 0x01, 0xFF,
+  0xF5, 0x1F, 0xF1, 0x21, 0x41, 0x91, 0x21, 0x0B, 0xF2, 0x33, 0x31, 0x91,
+  0x1F, 0x01, 0x11, 0xF0, 0x1F, 0xF3, 0x1F, 0x21, 0xE1, 0x7B, 0x67, 0x22,
+  0xD3, 0x11, 0xF0, 0x11, 0x1F, 0x01, 0xFF, 0xF5, 0x1F, 0xF1, 0x21, 0x41,
+  0x91, 0x21, 0x0F, 0x2F, 0x23, 0x1B, 0xFF, 0x41, 0xFF, 0x41, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x31, 0x58, 0x3F, 0x0F, 0x63, 0x17, 0x13,
+  0xFF, 0xB1, 0xFF, 0xFF, 0xFF, 0xF3, 0x1F, 0xFF, 0xF9, 0x1F, 0x31, 0xFF,
+  0x31, 0xE3, 0x29, 0x13, 0x2F, 0x0F, 0xFF, 0xA0, 0x0F, 0x2F, 0x23, 0x1B,
+  0xFF, 0x41, 0xFF, 0x41, 0xB1, 0xFB, 0x7A, 0x7F, 0xFF, 0x61, 0xF6, 0x1F,
+  0xFF, 0xF8, 0x31, 0xC1, 0x04, 0x25, 0x24, 0xF2, 0x21, 0x12, 0x21, 0x22,
+  0x11, 0x23, 0x19, 0x15, 0x1B, 0x15, 0x27, 0x28, 0x15, 0x19, 0x17, 0x1A,
+  0x13, 0x1A, 0x17, 0x19, 0x31, 0x38, 0x27, 0x2A, 0x11, 0x19, 0x1B, 0x1F,
+  0x01, 0x61, 0xFF, 0xFF, 0x21, 0x12, 0x33, 0x13, 0x41, 0x11, 0x28, 0x44,
+  0x62, 0x33, 0x82, 0x31, 0xA1, 0x31, 0xA1, 0x22, 0xA1, 0xD2, 0xD1, 0xD2,
+  0x85, 0xE3, 0xE2, 0xE2, 0xE1, 0xE1, 0xE1, 0xD2, 0x11, 0xB6, 0x82, 0x4A,
+  0x84, 0x50, 0x07, 0x75, 0xD1, 0x53, 0x13, 0x71, 0x13, 0xC1, 0xF4, 0x1F,
+  0x11, 0xF4, 0x1F, 0x11, 0xF4, 0x1F, 0x11, 0xF4, 0x1F, 0x12, 0xFF, 0x52,
+  0xFF, 0x52, 0xFF, 0x52, 0xFF, 0x13, 0x12, 0x63, 0x13, 0x51, 0x72, 0xA1,
+  0x71, 0x91, 0x16, 0xC3, 0x23, 0x57, 0x22, 0x35, 0xD1, 0x53, 0x13, 0x71,
+  0x13, 0xC1, 0xF4, 0x1F, 0x11, 0xF4, 0x1F, 0x11, 0xF4, 0x1F, 0x11, 0xF4,
+  0x1F, 0x12, 0xFF, 0x52, 0xFF, 0x52, 0xFF, 0x52, 0xFF, 0x13, 0x12, 0x63,
+  0x13, 0x07, 0x46, 0xF4, 0x31, 0x34, 0x22, 0x2D, 0x11, 0x1E, 0x11, 0x1E,
+  0x11, 0x1E, 0x3E, 0x2F, 0x02, 0xF0, 0x1F, 0x15, 0xC2, 0x21, 0x11, 0xB1,
+  0x41, 0x11, 0xF1, 0x1F, 0x32, 0xFF, 0x52, 0xFF, 0x61, 0x33, 0x13, 0x61,
+  0x13, 0x3F, 0x1F, 0x73, 0x17, 0x23, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x41, 0xFF, 0x81, 0xFF, 0x52, 0xD5, 0x63, 0x23, 0x06, 0x96, 0xF6,
+  0x31, 0x1B, 0x11, 0x36, 0x17, 0x1B, 0x19, 0x1C, 0x15, 0x1D, 0x17, 0x1F,
+  0xF5, 0x13, 0x1F, 0x01, 0x51, 0xF1, 0x11, 0x1F, 0x21, 0x31, 0xFF, 0x82,
+  0xF6, 0x1F, 0x41, 0xFF, 0xFF, 0xD3, 0x14, 0x54, 0x13, 0x07, 0x57, 0xF4,
+  0x31, 0x35, 0x31, 0x3F, 0xFF, 0xFF, 0xFF, 0xDB, 0x8B, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x63, 0x13, 0x53, 0x13, 0x57, 0x83, 0x53, 0x52, 0x92, 0x32,
+  0xB2, 0x21, 0xD1, 0x12, 0xD4, 0xD3, 0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02,
+  0xF0, 0x2F, 0x02, 0xE4, 0xD2, 0x11, 0xD1, 0x22, 0xB2, 0x32, 0x92, 0x52,
+  0x72, 0x79, 0xC1, 0x80, 0x0F, 0x4F, 0x43, 0x29, 0x23, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x43, 0x22, 0x52, 0x23, 0x0B,
+  0xF1, 0x32, 0x31, 0x91, 0x1E, 0x11, 0x1E, 0x1F, 0xFF, 0xF3, 0x1F, 0x11,
+  0xC2, 0x68, 0x12, 0x59, 0xFF, 0xFF, 0xFF, 0x93, 0x16, 0x60, 0x58, 0x22,
+  0x42, 0x62, 0x11, 0x32, 0xA2, 0x31, 0xB2, 0x22, 0xC1, 0x12, 0xD1, 0x12,
+  0xD3, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x11, 0xF1, 0x1F, 0x12, 0xF0, 0x2F,
+  0x12, 0xF0, 0x2F, 0x12, 0xB1, 0x42, 0x84, 0x59, 0xB2, 0x70, 0x0F, 0x2F,
+  0x37, 0x17, 0xFF, 0xFF, 0xFB, 0x1F, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF9, 0x41, 0x53, 0x07, 0x7E, 0x77, 0x31, 0xD1, 0x62, 0xB2, 0x71, 0xB1,
+  0x82, 0x92, 0x91, 0x91, 0xB1, 0x72, 0xB1, 0x71, 0xD1, 0x52, 0xD1, 0x51,
+  0xF0, 0x13, 0x2F, 0x01, 0x31, 0xF2, 0x11, 0x2F, 0x23, 0xF4, 0x2F, 0x41,
+  0xF4, 0x2D, 0x14, 0x2F, 0x05, 0xF3, 0x2D, 0x07, 0xF0, 0x00, 0x20, 0x00,
+  0x3E, 0x00, 0x7A, 0xF0, 0x30, 0x86, 0x18, 0x20, 0xCC, 0x08, 0x1B, 0x02,
+  0x06, 0x80, 0x80, 0xA0, 0x20, 0x38, 0x08, 0x0E, 0x02, 0x02, 0xC0, 0x81,
+  0x90, 0x20, 0x66, 0x08, 0x30, 0xE2, 0x38, 0x0F, 0xF8, 0x00, 0x70, 0x00,
+  0x08, 0x00, 0x1F, 0xC0, 0x16, 0x56, 0x26, 0x56, 0x42, 0x92, 0x72, 0x72,
+  0x91, 0x71, 0xB1, 0x51, 0xC2, 0x32, 0xD2, 0x12, 0xF0, 0x11, 0x1F, 0x21,
+  0xF2, 0x3F, 0x02, 0x12, 0xD2, 0x31, 0xD1, 0x51, 0xB2, 0x61, 0x92, 0x72,
+  0x72, 0x92, 0x61, 0xB1, 0x51, 0xD1, 0x27, 0x57, 0x07, 0x57, 0xF4, 0x32,
+  0x25, 0x22, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0x32, 0x92, 0xF5, 0xFF, 0xFE, 0x07, 0x57, 0xF4, 0x32, 0x25, 0x22,
+  0x3F, 0xFF, 0xFF, 0x41, 0xFF, 0x91, 0xF2, 0x11, 0x8A, 0x31, 0x5D, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x42, 0x30, 0x06, 0x15, 0x16, 0xF4, 0x31, 0x21,
+  0x21, 0x21, 0x21, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF4, 0x31, 0x51, 0x51, 0x30, 0x06, 0x15, 0x16, 0xF4, 0x31, 0x21,
+  0x21, 0x21, 0x21, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF4, 0x31, 0x51, 0x51, 0xF6, 0xFF, 0xFD, 0x0A, 0xFE, 0x51, 0x3F,
+  0xFF, 0xF6, 0x1F, 0xFF, 0xF3, 0x8B, 0x62, 0x2F, 0x03, 0x11, 0xF2, 0x1F,
+  0xF9, 0x1F, 0xF7, 0x1F, 0x11, 0xF1, 0x21, 0x14, 0x31, 0x71, 0x22, 0x06,
+  0x76, 0xF4, 0x21, 0x37, 0x31, 0x2F, 0xFF, 0xFF, 0xFF, 0xC6, 0xD5, 0x12,
+  0xF1, 0x21, 0x1F, 0x21, 0x11, 0xF2, 0x1F, 0xFF, 0xB1, 0xFF, 0x52, 0x11,
+  0x62, 0x16, 0x12, 0x13, 0x12, 0x08, 0xFB, 0x31, 0x4F, 0xFF, 0xFF, 0xFF,
+  0xAA, 0x78, 0x21, 0xE2, 0x11, 0xF0, 0x11, 0x1F, 0x01, 0xFF, 0xF5, 0x1F,
+  0xF1, 0x21, 0x41, 0x91, 0x21, 0x01, 0x38, 0x51, 0x12, 0x72, 0x43, 0x92,
+  0x32, 0xB2, 0x22, 0xC2, 0x11, 0xE1, 0x11, 0xE1, 0xF1, 0x2F, 0x02, 0x6B,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x01, 0xF0, 0x2F, 0x02, 0xE2, 0x21, 0xB2,
+  0x42, 0x82, 0x6A, 0xB3, 0x80, 0x06, 0x45, 0xD1, 0x13, 0x11, 0x33, 0x12,
+  0x21, 0x11, 0x31, 0x11, 0x91, 0x11, 0x51, 0x11, 0xFD, 0x17, 0x18, 0x1F,
+  0xF0, 0x1F, 0x82, 0xF2, 0x2F, 0xFF, 0xFF, 0x11, 0xB1, 0xFC, 0x17, 0x19,
+  0x19, 0x19, 0x25, 0x22, 0x31, 0x23, 0x73, 0x64, 0x22, 0x14, 0x6C, 0x42,
+  0xF0, 0x11, 0x91, 0x34, 0x1F, 0x01, 0xFF, 0xF8, 0x1F, 0x41, 0xF1, 0x11,
+  0x2F, 0x02, 0x17, 0xA1, 0x25, 0xC1, 0xF0, 0x1F, 0x11, 0x11, 0xF1, 0x1F,
+  0x01, 0xF1, 0x11, 0x1F, 0x11, 0xD3, 0x83, 0x13, 0x39, 0x71, 0x17, 0x11,
+  0x62, 0x71, 0x11, 0xF0, 0x1F, 0xFB, 0xA5, 0x21, 0x97, 0x1D, 0x11, 0x1F,
+  0xFD, 0x1F, 0x02, 0x41, 0x11, 0x63, 0x61, 0x16, 0x11, 0x33, 0x23, 0x14,
+  0x34, 0xC3, 0x79, 0x64, 0xC2, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x11, 0x45,
+  0x71, 0x23, 0x33, 0x42, 0x12, 0x72, 0x34, 0xA1, 0x23, 0xB2, 0x12, 0xD1,
+  0x12, 0xD1, 0x21, 0xD2, 0x11, 0xD2, 0x11, 0xD1, 0x22, 0xC1, 0x31, 0xB2,
+  0x32, 0x92, 0x52, 0x72, 0x79, 0xC1, 0x80, 0x0C, 0x43, 0x17, 0x12, 0xD2,
+  0xFF, 0x31, 0xD1, 0x11, 0xB2, 0x11, 0x66, 0xAB, 0xE1, 0xFF, 0x31, 0xF0,
+  0x1B, 0x32, 0x31, 0x72, 0x21, 0x0F, 0x51, 0x9F, 0xFF, 0x31, 0xFF, 0x21,
+  0xFF, 0xFF, 0xFF, 0xF7, 0x41, 0x65, 0x3F, 0x03, 0x31, 0x71, 0x3F, 0xFF,
+  0xFF, 0xFF, 0x81, 0xFF, 0x61, 0xF0, 0x1F, 0xF6, 0x1C, 0x41, 0x91, 0x32,
+  0xF0, 0xFF, 0xFA, 0x48, 0x63, 0x62, 0x42, 0xA1, 0x31, 0xB2, 0x12, 0xC1,
+  0x11, 0xD3, 0xDF, 0x4F, 0x01, 0xF0, 0x2F, 0x01, 0xF0, 0x2C, 0x12, 0x28,
+  0x44, 0x9A, 0x18, 0xF3, 0xE7, 0xB0, 0x41, 0x8C, 0x21, 0x82, 0x10, 0x80,
+  0x88, 0x80, 0x24, 0x80, 0x1A, 0xC0, 0x17, 0xD0, 0x11, 0xCC, 0x08, 0x42,
+  0x0C, 0x21, 0x84, 0x10, 0x42, 0x08, 0x23, 0x04, 0x1B, 0x9F, 0xCE, 0x02,
+  0x19, 0x43, 0x72, 0x32, 0x91, 0x31, 0xA2, 0x21, 0xA1, 0xD2, 0xA4, 0x96,
+  0xF0, 0x2E, 0x1E, 0x2D, 0x2D, 0x11, 0x38, 0x33, 0xAA, 0x17, 0x07, 0x78,
+  0x13, 0x61, 0x23, 0xC1, 0x11, 0xF2, 0x1F, 0x12, 0xF1, 0x1F, 0x21, 0x11,
+  0xF2, 0x1F, 0x12, 0xF1, 0x1F, 0x41, 0xF1, 0x2F, 0x11, 0xF2, 0x11, 0x1C,
+  0x32, 0x16, 0x31, 0x30, 0x42, 0x72, 0x81, 0x11, 0x51, 0x11, 0x91, 0x15,
+  0x11, 0xB7, 0xFF, 0xE7, 0x78, 0x13, 0x61, 0x23, 0xC1, 0x11, 0xF2, 0x1F,
+  0x12, 0xF1, 0x1F, 0x21, 0x11, 0xF2, 0x1F, 0x12, 0xF1, 0x1F, 0x41, 0xF1,
+  0x2F, 0x11, 0xF2, 0x11, 0x1C, 0x32, 0x16, 0x31, 0x30, 0x07, 0x27, 0x51,
+  0x72, 0x81, 0x62, 0x91, 0x52, 0xA1, 0x42, 0xB1, 0x32, 0xC1, 0x22, 0xD3,
+  0x12, 0xC2, 0x32, 0xB1, 0x52, 0xA1, 0x62, 0x91, 0x72, 0x81, 0x82, 0x71,
+  0x92, 0x37, 0x47, 0x3F, 0x03, 0x31, 0x71, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x21, 0xF3, 0x1F, 0x01, 0xD4, 0x11, 0x53, 0x13, 0x06, 0x99, 0x11,
+  0xB1, 0x13, 0x61, 0x71, 0xB1, 0x91, 0xC1, 0x51, 0xD1, 0x71, 0xE1, 0x31,
+  0xF0, 0x15, 0x1F, 0x11, 0x11, 0xF2, 0x13, 0x1F, 0x22, 0xF6, 0x1F, 0x41,
+  0xFF, 0x13, 0x14, 0x54, 0x13, 0x07, 0x5A, 0x13, 0x53, 0x13, 0xFF, 0xFF,
+  0xFF, 0x9B, 0x8B, 0xFF, 0xFF, 0xFF, 0x93, 0x13, 0x53, 0x13, 0x57, 0x82,
+  0x72, 0x52, 0x92, 0x32, 0xB2, 0x21, 0xD1, 0x12, 0xD4, 0xD4, 0xD4, 0xD4,
+  0xD2, 0x11, 0xD1, 0x22, 0xB2, 0x32, 0x92, 0x52, 0x72, 0x79, 0xC1, 0x80,
+  0x0F, 0x71, 0xB1, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x33,
+  0x13, 0x53, 0x13, 0x61, 0x41, 0xA1, 0x11, 0x42, 0x81, 0x71, 0x92, 0x32,
+  0x4F, 0x2F, 0x23, 0x1B, 0xFF, 0x41, 0xFF, 0x41, 0xB1, 0xFB, 0x7A, 0x7F,
+  0xFF, 0x61, 0xF6, 0x1F, 0xFF, 0xF8, 0x31, 0xC1, 0x42, 0x42, 0x82, 0x42,
+  0xFF, 0xFB, 0x86, 0x36, 0x24, 0x2A, 0x13, 0x1B, 0x21, 0x2C, 0x11, 0x1D,
+  0x3D, 0xF4, 0xF0, 0x1F, 0x02, 0xF0, 0x1F, 0x02, 0xC1, 0x22, 0x84, 0x49,
+  0xA1, 0x80 };
+
+const RleGlyph CourierCyr18pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,  21,    0,    1, 0 },  // 0x20 ' '
+  {     0,   4,  20,  21,    9,  -19, 2 },  // 0x21 '!'
+  {     9,   7,   8,  21,    7,  -19, 2 },  // 0x22 '"'
+  {    15,  14,  23,  21,    4,  -21, 2 },  // 0x23 '#'
+  {    39,  13,  27,  21,    4,  -22, 1 },  // 0x24 '$'
+  {    74,  14,  22,  21,    4,  -21, 0 },  // 0x25 '%'
+  {   113,  16,  20,  21,    3,  -19, 2 },  // 0x26 '&'
+  {   152,   2,   8,  21,   10,  -19, 0 },  // 0x27 '''
+  {   154,   5,  26,  21,   10,  -21, 2 },  // 0x28 '('
+  {   167,   5,  26,  21,    6,  -21, 2 },  // 0x29 ')'
+  {   180,  13,  12,  21,    4,  -20, 0 },  // 0x2A '*'
+  {   200,  15,  15,  21,    3,  -17, 2 },  // 0x2B '+'
+  {   211,   5,   9,  21,    8,   -3, 0 },  // 0x2C ','
+  {   217,  13,   1,  21,    4,   -9, 1 },  // 0x2D '-'
+  {   218,   4,   4,  21,    9,   -3, 0 },  // 0x2E '.'
+  {   220,  12,  25,  21,    5,  -21, 2 },  // 0x2F '/'
+  {   244,  13,  22,  21,    4,  -21, 2 },  // 0x30 '0'
+  {   265,  13,  22,  21,    4,  -21, 2 },  // 0x31 '1'
+  {   281,  13,  22,  21,    3,  -21, 1 },  // 0x32 '2'
+  {   309,  13,  22,  21,    3,  -21, 1 },  // 0x33 '3'
+  {   336,  14,  22,  21,    3,  -21, 2 },  // 0x34 '4'
+  {   362,  13,  21,  21,    4,  -20, 2 },  // 0x35 '5'
+  {   384,  13,  22,  21,    4,  -21, 2 },  // 0x36 '6'
+  {   415,  14,  21,  21,    3,  -20, 2 },  // 0x37 '7'
+  {   435,  13,  22,  21,    4,  -21, 2 },  // 0x38 '8'
+  {   468,  13,  22,  21,    4,  -21, 2 },  // 0x39 '9'
+  {   496,   4,  13,  21,    9,  -12, 0 },  // 0x3A ':'
+  {   503,   6,  17,  21,    7,  -12, 0 },  // 0x3B ';'
+  {   516,  16,  15,  21,    2,  -14, 1 },  // 0x3C '<'
+  {   535,  14,   8,  21,    4,  -14, 1 },  // 0x3D '='
+  {   540,  16,  15,  21,    4,  -14, 1 },  // 0x3E '>'
+  {   559,  12,  20,  21,    5,  -19, 2 },  // 0x3F '?'
+  {   579,  15,  22,  21,    3,  -21, 2 },  // 0x40 '@'
+  {   610,  20,  20,  21,    0,  -19, 2 },  // 0x41 'A'
+  {   643,  17,  20,  21,    2,  -19, 2 },  // 0x42 'B'
+  {   668,  16,  20,  21,    2,  -19, 2 },  // 0x43 'C'
+  {   696,  18,  20,  21,    2,  -19, 2 },  // 0x44 'D'
+  {   722,  17,  20,  21,    2,  -19, 2 },  // 0x45 'E'
+  {   742,  17,  20,  21,    2,  -19, 2 },  // 0x46 'F'
+  {   761,  18,  20,  21,    2,  -19, 2 },  // 0x47 'G'
+  {   789,  19,  20,  21,    1,  -19, 2 },  // 0x48 'H'
+  {   810,  13,  20,  21,    4,  -19, 2 },  // 0x49 'I'
+  {   822,  19,  20,  21,    1,  -19, 2 },  // 0x4A 'J'
+  {   843,  18,  20,  21,    2,  -19, 1 },  // 0x4B 'K'
+  {   884,  17,  20,  21,    2,  -19, 2 },  // 0x4C 'L'
+  {   901,  21,  20,  21,    0,  -19, 2 },  // 0x4D 'M'
+  {   938,  20,  20,  21,    1,  -19, 2 },  // 0x4E 'N'
+  {   970,  17,  20,  21,    2,  -19, 2 },  // 0x4F 'O'
+  {   997,  16,  20,  21,    3,  -19, 2 },  // 0x50 'P'
+  {  1017,  17,  24,  21,    2,  -19, 2 },  // 0x51 'Q'
+  {  1054,  18,  20,  21,    2,  -19, 2 },  // 0x52 'R'
+  {  1082,  15,  20,  21,    3,  -19, 1 },  // 0x53 'S'
+  {  1113,  17,  20,  21,    2,  -19, 2 },  // 0x54 'T'
+  {  1130,  19,  20,  21,    1,  -19, 2 },  // 0x55 'U'
+  {  1150,  20,  20,  21,    0,  -19, 2 },  // 0x56 'V'
+  {  1180,  20,  20,  21,    0,  -19, 2 },  // 0x57 'W'
+  {  1211,  18,  20,  21,    2,  -19, 1 },  // 0x58 'X'
+  {  1250,  19,  20,  21,    1,  -19, 2 },  // 0x59 'Y'
+  {  1284,  15,  20,  21,    3,  -19, 2 },  // 0x5A 'Z'
+  {  1310,   5,  26,  21,   10,  -21, 2 },  // 0x5B '['
+  {  1317,  12,  25,  21,    5,  -21, 2 },  // 0x5C
+  {  1340,   5,  26,  21,    6,  -21, 2 },  // 0x5D ']'
+  {  1346,  14,   9,  21,    4,  -21, 1 },  // 0x5E '^'
+  {  1361,  21,   2,  21,    0,    4, 1 },  // 0x5F '_'
+  {  1363,   7,   7,  21,    7,  -23, 0 },  // 0x60 '`'
+  {  1370,  17,  15,  21,    2,  -14, 2 },  // 0x61 'a'
+  {  1391,  19,  22,  21,    1,  -21, 2 },  // 0x62 'b'
+  {  1419,  15,  15,  21,    3,  -14, 2 },  // 0x63 'c'
+  {  1440,  18,  22,  21,    2,  -21, 2 },  // 0x64 'd'
+  {  1465,  16,  15,  21,    3,  -14, 1 },  // 0x65 'e'
+  {  1489,  14,  22,  21,    4,  -21, 2 },  // 0x66 'f'
+  {  1506,  17,  21,  21,    2,  -14, 2 },  // 0x67 'g'
+  {  1537,  19,  22,  21,    1,  -21, 2 },  // 0x68 'h'
+  {  1561,  13,  22,  21,    4,  -21, 2 },  // 0x69 'i'
+  {  1575,  11,  28,  21,    3,  -21, 2 },  // 0x6A 'j'
+  {  1591,  18,  22,  21,    2,  -21, 2 },  // 0x6B 'k'
+  {  1631,  13,  22,  21,    4,  -21, 2 },  // 0x6C 'l'
+  {  1644,  21,  15,  21,    0,  -14, 2 },  // 0x6D 'm'
+  {  1667,  19,  15,  21,    1,  -14, 2 },  // 0x6E 'n'
+  {  1686,  17,  15,  21,    2,  -14, 1 },  // 0x6F 'o'
+  {  1713,  18,  21,  21,    1,  -14, 2 },  // 0x70 'p'
+  {  1742,  18,  21,  21,    2,  -14, 2 },  // 0x71 'q'
+  {  1769,  17,  15,  21,    2,  -14, 2 },  // 0x72 'r'
+  {  1788,  14,  15,  21,    4,  -14, 1 },  // 0x73 's'
+  {  1811,  15,  20,  21,    3,  -19, 2 },  // 0x74 't'
+  {  1831,  18,  15,  21,    1,  -14, 2 },  // 0x75 'u'
+  {  1849,  19,  15,  21,    1,  -14, 2 },  // 0x76 'v'
+  {  1876,  20,  15,  21,    0,  -14, 2 },  // 0x77 'w'
+  {  1903,  19,  15,  21,    1,  -14, 1 },  // 0x78 'x'
+  {  1933,  19,  21,  21,    0,  -14, 1 },  // 0x79 'y'
+  {  1971,  13,  15,  21,    4,  -14, 1 },  // 0x7A 'z'
+  {  1988,   8,  26,  21,    7,  -21, 2 },  // 0x7B '{'
+  {  2004,   1,  25,  21,   10,  -21, 1 },  // 0x7C '|'
+  {  2006,   8,  26,  21,    6,  -21, 2 },  // 0x7D '}'
+  {  2024,  16,   3,  21,    3,   -8, 0 },  // 0x7E '~'
+  {  2030,  18,  22,  26,    4,  -21, 2 },  // 0x7F
+  {  2046,  18,  20,  21,    1,  -14, 2 },  // 0x80
+  {  2079,  15,  16,  21,    3,  -14, 1 },  // 0x81
+  {  2101,  17,  15,  21,    2,  -14, 2 },  // 0x82
+  {  2117,  19,  20,  21,    0,  -14, 1 },  // 0x83
+  {  2153,  17,  27,  21,    2,  -21, 2 },  // 0x84
+  {  2201,  19,  15,  21,    1,  -14, 1 },  // 0x85
+  {  2231,  19,  19,  21,    1,  -14, 2 },  // 0x86
+  {  2249,  18,  15,  21,    1,  -14, 2 },  // 0x87
+  {  2269,  19,  15,  21,    1,  -14, 2 },  // 0x88
+  {  2289,  19,  19,  21,    1,  -14, 2 },  // 0x89
+  {  2311,  19,  15,  21,    1,  -14, 2 },  // 0x8A
+  {  2331,  19,  15,  21,    1,  -14, 2 },  // 0x8B
+  {  2353,  17,  15,  21,    2,  -14, 2 },  // 0x8C
+  {  2374,  17,  16,  21,    2,  -14, 1 },  // 0x8D
+  {  2401,  19,  16,  21,    1,  -14, 2 },  // 0x8E
+  {  2438,  18,  15,  21,    1,  -14, 2 },  // 0x8F
+  {  2465,  21,  20,  21,    0,  -19, 2 },  // 0x90
+  {  2502,  17,  20,  21,    2,  -19, 2 },  // 0x91
+  {  2527,  17,  20,  21,    2,  -19, 2 },  // 0x92
+  {  2558,  17,  20,  21,    2,  -19, 2 },  // 0x93
+  {  2575,  18,  24,  21,    1,  -19, 2 },  // 0x94
+  {  2600,  17,  20,  21,    2,  -19, 2 },  // 0x95
+  {  2620,  17,  20,  21,    2,  -19, 2 },  // 0x96
+  {  2661,  15,  21,  21,    2,  -19, 1 },  // 0x97
+  {  2690,  19,  20,  21,    1,  -19, 2 },  // 0x98
+  {  2721,  19,  24,  21,    1,  -23, 2 },  // 0x99
+  {  2761,  18,  20,  21,    2,  -19, 2 },  // 0x9A
+  {  2797,  19,  20,  21,    1,  -19, 2 },  // 0x9B
+  {  2817,  21,  20,  21,    0,  -19, 2 },  // 0x9C
+  {  2853,  19,  20,  21,    1,  -19, 2 },  // 0x9D
+  {  2874,  17,  21,  21,    2,  -19, 1 },  // 0x9E
+  {  2908,  19,  20,  21,    1,  -19, 2 },  // 0x9F
+  {  2927,  16,  20,  21,    3,  -19, 2 },  // 0xA0
+  {  2950,  17,  21,  21,    2,  -19, 1 },  // 0xA1
+  {  2986,  17,  20,  21,    2,  -19, 2 },  // 0xA2
+  {  3003,  21,  21,  21,    0,  -19, 1 },  // 0xA3
+  {  3043,  18,  20,  21,    2,  -19, 0 },  // 0xA4
+  {  3088,  19,  20,  21,    1,  -19, 1 },  // 0xA5
+  {  3128,  19,  24,  21,    1,  -19, 2 },  // 0xA6
+  {  3150,  19,  20,  21,    1,  -19, 2 },  // 0xA7
+  {  3174,  19,  20,  21,    1,  -19, 2 },  // 0xA8
+  {  3198,  19,  24,  21,    1,  -19, 2 },  // 0xA9
+  {  3224,  19,  20,  21,    1,  -19, 2 },  // 0xAA
+  {  3251,  19,  20,  21,    1,  -19, 2 },  // 0xAB
+  {  3281,  17,  20,  21,    2,  -19, 2 },  // 0xAC
+  {  3305,  17,  21,  21,    2,  -19, 1 },  // 0xAD
+  {  3341,  19,  21,  21,    1,  -19, 2 },  // 0xAE
+  {  3382,  18,  20,  21,    2,  -19, 2 },  // 0xAF
+  {  3416,  17,  16,  21,    2,  -14, 2 },  // 0xB0
+  {  3445,  17,  23,  21,    2,  -21, 1 },  // 0xB1
+  {  3487,  16,  15,  21,    3,  -14, 2 },  // 0xB2
+  {  3509,  16,  15,  21,    3,  -14, 2 },  // 0xB3
+  {  3522,  18,  19,  21,    1,  -14, 2 },  // 0xB4
+  {  3543,  16,  16,  21,    3,  -14, 1 },  // 0xB5
+  {  3567,  17,  15,  21,    2,  -14, 0 },  // 0xB6
+  {  3599,  15,  16,  21,    3,  -14, 1 },  // 0xB7
+  {  3622,  19,  15,  21,    1,  -14, 2 },  // 0xB8
+  {  3652,  19,  21,  21,    1,  -20, 2 },  // 0xB9
+  {  3693,  18,  15,  21,    2,  -14, 1 },  // 0xBA
+  {  3723,  18,  15,  21,    1,  -14, 2 },  // 0xBB
+  {  3741,  21,  15,  21,    0,  -14, 2 },  // 0xBC
+  {  3773,  19,  15,  21,    1,  -14, 2 },  // 0xBD
+  {  3790,  17,  16,  21,    2,  -14, 1 },  // 0xBE
+  {  3816,  19,  15,  21,    1,  -14, 2 },  // 0xBF
+  {  3831,  17,  24,  21,    2,  -23, 2 },  // 0xC0
+  {  3860,  16,  21,  21,    3,  -19, 1 }   // 0xC1
+};
+
+const RleFont CourierCyr18pt8bRle PROGMEM = {
+  CourierCyr18pt8bRleData,
+  CourierCyr18pt8bRleGlyphs,
+  0x20, 0xC1, 29 };
+
+#endif // COURIERCYR18PT8BRLE_H_
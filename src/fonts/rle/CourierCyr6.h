@@ -0,0 +1,246 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr6.h, do not edit.
+// 162 glyphs (1 sharing another's bitmap), 809 bytes of bitmap data (GFXfont: 825)
+#ifndef COURIERCYR6PT8BRLE_H_
+#define COURIERCYR6PT8BRLE_H_
+
+const uint8_t CourierCyr6pt8bRleData[] PROGMEM = {
+  0xFA, 0xF0, 0x66, 0xAF, 0xAF, 0xAA, 0x23, 0xE5, 0x04, 0x1E, 0x3E, 0x21,
+  0x00, 0x64, 0xA4, 0xD7, 0x5D, 0x27, 0xE5, 0xA0, 0x8B, 0xCB, 0xA0, 0xC0,
+  0x6A, 0xA9, 0xA5, 0x5A, 0x27, 0xD8, 0xA0, 0x21, 0x3E, 0x42, 0x00, 0xE0,
+  0xF0, 0x80, 0x12, 0x22, 0x44, 0x88, 0x80, 0x76, 0xE3, 0x18, 0xC7, 0x6E,
+  0xE1, 0x08, 0x42, 0x13, 0xE0, 0x74, 0x42, 0x13, 0x22, 0x3F, 0x64, 0x84,
+  0x22, 0x0E, 0x2E, 0x13, 0x95, 0x29, 0x7C, 0xE0, 0xF4, 0x21, 0xE8, 0x86,
+  0x3E, 0x3A, 0x21, 0x6C, 0xC6, 0x2E, 0xFC, 0x84, 0x22, 0x10, 0x88, 0x74,
+  0x63, 0x17, 0x4E, 0x2E, 0x74, 0x63, 0x17, 0x84, 0x5C, 0x90, 0x41, 0x80,
+  0x09, 0xB0, 0xC1, 0x80, 0xF8, 0x3E, 0x83, 0x06, 0x6C, 0x00, 0x74, 0x42,
+  0x32, 0x01, 0xC0, 0x73, 0x28, 0xAE, 0xCB, 0xFC, 0x1E, 0x60, 0xC5, 0x12,
+  0x7A, 0x2C, 0xC0, 0xF9, 0x14, 0x5E, 0x45, 0x1F, 0x80, 0x77, 0x38, 0x60,
+  0x81, 0x13, 0x80, 0xF9, 0x34, 0x51, 0x45, 0x3F, 0x80, 0xFD, 0x14, 0x9E,
+  0x49, 0x1F, 0xC0, 0xFD, 0x14, 0x9E, 0x49, 0x0E, 0x00, 0x75, 0x9A, 0x14,
+  0x09, 0xE8, 0x8E, 0x00, 0xEE, 0x89, 0x13, 0xE4, 0x48, 0xBB, 0x80, 0xF9,
+  0x08, 0x42, 0x13, 0xE0, 0x25, 0x22, 0x12, 0xE1, 0xD4, 0x30, 0xEC, 0x91,
+  0x43, 0x84, 0x89, 0x39, 0x80, 0xE2, 0x10, 0x84, 0xA7, 0xE0, 0xC6, 0xD9,
+  0xD3, 0xA5, 0x48, 0xBB, 0x80, 0xCE, 0xC9, 0x92, 0xA5, 0x49, 0xB9, 0x00,
+  0x7B, 0x38, 0x61, 0x87, 0x37, 0x80, 0xF2, 0x52, 0x97, 0x23, 0x80, 0x79,
+  0x38, 0x61, 0x87, 0x37, 0x8C, 0x4C, 0xF8, 0x89, 0x13, 0xC4, 0x88, 0xB9,
+  0x80, 0x6C, 0xE0, 0xC1, 0xC7, 0xC0, 0xFD, 0x6A, 0x42, 0x11, 0xC0, 0xEE,
+  0x89, 0x12, 0x24, 0x48, 0x8E, 0x00, 0xC7, 0x09, 0x12, 0x42, 0x86, 0x0C,
+  0x00, 0xC7, 0x0A, 0xD5, 0xAA, 0xC8, 0x91, 0x00, 0xCD, 0x23, 0x08, 0x52,
+  0x2C, 0xC0, 0xC6, 0x88, 0xA1, 0x81, 0x02, 0x0E, 0x00, 0xF4, 0xA8, 0x44,
+  0xC7, 0xE0, 0xEA, 0xAA, 0xB0, 0x01, 0xB2, 0x72, 0xB2, 0xD5, 0x55, 0x70,
+  0x6A, 0x90, 0xFE, 0x90, 0x3C, 0xFA, 0x14, 0x67, 0x60, 0xC1, 0x04, 0x16,
+  0x65, 0x14, 0x7E, 0x18, 0x51, 0x46, 0x1C, 0x08, 0x13, 0xA8, 0xD0, 0xA1,
+  0x3F, 0x74, 0x7F, 0x17, 0x00, 0x7A, 0x11, 0xF4, 0x21, 0x1F, 0x77, 0x9A,
+  0x16, 0x27, 0xC0, 0x9E, 0x00, 0xC0, 0x81, 0x02, 0xE6, 0x48, 0x91, 0x77,
+  0x20, 0x00, 0xC2, 0x10, 0x9F, 0x10, 0x0F, 0x11, 0x11, 0x1E, 0xC1, 0x04,
+  0x16, 0x51, 0x85, 0xB7, 0xE1, 0x08, 0x42, 0x10, 0x9F, 0xEC, 0xA9, 0x52,
+  0xAF, 0xE0, 0xDC, 0xC9, 0x12, 0x2E, 0xE0, 0x13, 0x15, 0xA5, 0xD9, 0x94,
+  0x51, 0x79, 0x0E, 0x00, 0x77, 0x1A, 0x14, 0x27, 0xC0, 0x87, 0x80, 0xDB,
+  0x10, 0x8F, 0x00, 0xF4, 0x9F, 0x1F, 0x00, 0x41, 0x0F, 0x90, 0x41, 0x17,
+  0x80, 0xCC, 0x89, 0x12, 0x27, 0xE0, 0xCE, 0x25, 0x14, 0x20, 0xC7, 0x0A,
+  0xD3, 0x64, 0x40, 0xCD, 0x42, 0x16, 0xCC, 0xCE, 0x25, 0x14, 0x20, 0x8E,
+  0x00, 0xFC, 0x89, 0x9F, 0x80, 0x69, 0x28, 0x92, 0x4C, 0x09, 0xC9, 0x22,
+  0x92, 0x58, 0xCD, 0x80, 0x07, 0x15, 0xFF, 0x75, 0x10, 0xFC, 0x89, 0x0A,
+  0x26, 0x4B, 0x3C, 0x00, 0xFC, 0x61, 0x07, 0x80, 0xFA, 0x92, 0x08, 0x70,
+  0xC6, 0x91, 0x21, 0x81, 0x04, 0x3C, 0x00, 0x21, 0x82, 0x3E, 0xAA, 0x9A,
+  0xAA, 0x71, 0xC0, 0x6E, 0x50, 0x41, 0x4E, 0x60, 0xEE, 0x89, 0x12, 0x24,
+  0x57, 0x40, 0xEE, 0x88, 0xF0, 0x20, 0xE0, 0xD6, 0xA9, 0x52, 0xAF, 0xE0,
+  0xD6, 0xA9, 0x52, 0xA5, 0x55, 0x40, 0xF0, 0x40, 0xF1, 0x17, 0xC0, 0xE6,
+  0x89, 0xD2, 0x6F, 0xE0, 0xE2, 0x0F, 0xA1, 0xF8, 0xFC, 0x4E, 0x1F, 0x00,
+  0xDC, 0xC5, 0x8B, 0x1D, 0xC0, 0x7E, 0x88, 0xF1, 0x2C, 0xE0, 0x70, 0x60,
+  0xA2, 0x43, 0xC8, 0xB1, 0x80, 0xFA, 0x28, 0x1E, 0x8A, 0x1F, 0x80, 0xF2,
+  0x28, 0x9C, 0x8A, 0x1F, 0x80, 0xFC, 0x61, 0x08, 0x43, 0x80, 0x7E, 0x48,
+  0x91, 0x24, 0x48, 0x91, 0x5D, 0xFA, 0x29, 0x1C, 0x92, 0x1F, 0xC0, 0xBE,
+  0xA7, 0x1C, 0xAA, 0xAB, 0xC0, 0xF4, 0x44, 0x60, 0x87, 0xC0, 0xE6, 0x99,
+  0x52, 0xA6, 0x4C, 0xB3, 0x80, 0x29, 0xED, 0x32, 0xA5, 0x4C, 0x99, 0x67,
+  0xDE, 0x4A, 0x28, 0xD2, 0x4C, 0xC0, 0x7E, 0x48, 0x91, 0x22, 0x44, 0xB3,
+  0x80, 0xC6, 0x99, 0xB3, 0xA5, 0x48, 0xBB, 0x80, 0x72, 0x28, 0x61, 0x86,
+  0x2F, 0x80, 0xFE, 0x89, 0x12, 0x24, 0x48, 0xBB, 0x80, 0xF1, 0x24, 0x52,
+  0x71, 0x0E, 0x00, 0x18, 0x51, 0xF0, 0x50, 0xFA, 0x9A, 0x48, 0x20, 0x87,
+  0x00, 0xC6, 0x89, 0x21, 0x42, 0x82, 0x18, 0x00, 0x73, 0xEA, 0xA9, 0xAA,
+  0xA7, 0x00, 0x6E, 0x90, 0xA0, 0x82, 0x89, 0x3B, 0x80, 0xEE, 0x89, 0x12,
+  0x24, 0x48, 0x91, 0x5D, 0xEE, 0x89, 0x11, 0x21, 0xC0, 0x83, 0x80, 0xD6,
+  0xA9, 0x52, 0xA5, 0x4A, 0xBF, 0x80, 0x02, 0x11, 0x13, 0x51, 0xFF, 0x57,
+  0xF1, 0x40, 0x81, 0xE2, 0x24, 0x5F, 0x00, 0xE7, 0x0A, 0x13, 0xA8, 0xD1,
+  0xBD, 0x80, 0xC2, 0x08, 0x1E, 0x8A, 0x1F, 0x80, 0xF4, 0x42, 0x70, 0x87,
+  0xC0, 0xDC, 0xC9, 0x8B, 0x16, 0x2C, 0x77, 0x00, 0x7E, 0x28, 0x9E, 0x49,
+  0x29, 0xC0, 0xF0, 0x2F, 0xA2, 0xFC, 0x0F, 0xA1, 0xE8, 0xC6, 0x2E, 0xFC,
+  0x5F, 0x1F, 0x80, 0xF9, 0x24, 0x50, 0xF0, 0x7E, 0x48, 0x92, 0x24, 0x57,
+  0x40, 0xFA, 0x2F, 0xA0, 0x7C, 0xBD, 0xCB, 0x2A, 0xBC, 0xF8, 0x4C, 0x1F,
+  0x80, 0xE6, 0x99, 0x53, 0x2C, 0xE0, 0x38, 0x03, 0x9A, 0x65, 0x4C, 0xB3,
+  0x80, 0xDA, 0x86, 0x24, 0xDC, 0x7E, 0x48, 0x91, 0x2C, 0xE0, 0xC6, 0xD9,
+  0xD2, 0xAE, 0xE0, 0xEE, 0x89, 0xF2, 0x2E, 0xE0, 0xFC, 0x63, 0x1F, 0x80,
+  0xFE, 0x89, 0x12, 0x2E, 0xE0, 0x53, 0xE8, 0xA4, 0x72, 0x48, 0x7F, 0x50,
+  0x0F, 0xA2, 0xFA, 0x07, 0xC0 };
+
+const RleGlyph CourierCyr6pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   7,    0,    1, 0 },  // 0x20 ' '
+  {     0,   1,   7,   7,    3,   -6, 0 },  // 0x21 '!'
+  {     1,   2,   2,   7,    3,   -6, 0 },  // 0x22 '"'
+  {     2,   4,   8,   7,    2,   -7, 0 },  // 0x23 '#'
+  {     6,   5,  10,   7,    1,   -7, 0 },  // 0x24 '$'
+  {    13,   5,   8,   7,    1,   -7, 0 },  // 0x25 '%'
+  {    18,   5,   7,   7,    1,   -6, 0 },  // 0x26 '&'
+  {    23,   1,   2,   7,    3,   -6, 0 },  // 0x27 '''
+  {    24,   2,   8,   7,    3,   -6, 0 },  // 0x28 '('
+  {    26,   2,   8,   7,    2,   -6, 0 },  // 0x29 ')'
+  {    28,   5,   4,   7,    1,   -6, 0 },  // 0x2A '*'
+  {    31,   5,   5,   7,    1,   -5, 0 },  // 0x2B '+'
+  {    35,   1,   3,   7,    3,    0, 0 },  // 0x2C ','
+  {    36,   4,   1,   7,    2,   -3, 0 },  // 0x2D '-'
+  {    37,   1,   1,   7,    3,    0, 0 },  // 0x2E '.'
+  {    38,   4,   9,   7,    2,   -7, 0 },  // 0x2F '/'
+  {    43,   5,   8,   7,    1,   -7, 0 },  // 0x30 '0'
+  {    48,   5,   7,   7,    1,   -6, 0 },  // 0x31 '1'
+  {    53,   5,   8,   7,    1,   -7, 0 },  // 0x32 '2'
+  {    58,   5,   8,   7,    1,   -7, 0 },  // 0x33 '3'
+  {    63,   5,   7,   7,    1,   -6, 0 },  // 0x34 '4'
+  {    68,   5,   8,   7,    1,   -7, 0 },  // 0x35 '5'
+  {    73,   5,   8,   7,    1,   -7, 0 },  // 0x36 '6'
+  {    78,   5,   8,   7,    1,   -7, 0 },  // 0x37 '7'
+  {    83,   5,   8,   7,    1,   -7, 0 },  // 0x38 '8'
+  {    88,   5,   8,   7,    1,   -7, 0 },  // 0x39 '9'
+  {    93,   1,   4,   7,    3,   -3, 0 },  // 0x3A ':'
+  {    94,   2,   5,   7,    2,   -3, 0 },  // 0x3B ';'
+  {    96,   5,   5,   7,    1,   -4, 0 },  // 0x3C '<'
+  {   100,   5,   3,   7,    1,   -4, 0 },  // 0x3D '='
+  {   102,   5,   5,   7,    1,   -4, 0 },  // 0x3E '>'
+  {   106,   5,   7,   7,    1,   -6, 0 },  // 0x3F '?'
+  {   111,   6,   8,   7,    1,   -7, 0 },  // 0x40 '@'
+  {   117,   6,   7,   7,    0,   -6, 0 },  // 0x41 'A'
+  {   123,   6,   7,   7,    0,   -6, 0 },  // 0x42 'B'
+  {   129,   6,   7,   7,    0,   -6, 0 },  // 0x43 'C'
+  {   135,   6,   7,   7,    0,   -6, 0 },  // 0x44 'D'
+  {   141,   6,   7,   7,    0,   -6, 0 },  // 0x45 'E'
+  {   147,   6,   7,   7,    0,   -6, 0 },  // 0x46 'F'
+  {   153,   7,   7,   7,    0,   -6, 0 },  // 0x47 'G'
+  {   160,   7,   7,   7,    0,   -6, 0 },  // 0x48 'H'
+  {   167,   5,   7,   7,    1,   -6, 0 },  // 0x49 'I'
+  {   172,   7,   7,   7,    0,   -6, 2 },  // 0x4A 'J'
+  {   178,   7,   7,   7,    0,   -6, 0 },  // 0x4B 'K'
+  {   185,   5,   7,   7,    1,   -6, 0 },  // 0x4C 'L'
+  {   190,   7,   7,   7,    0,   -6, 0 },  // 0x4D 'M'
+  {   197,   7,   7,   7,    0,   -6, 0 },  // 0x4E 'N'
+  {   204,   6,   7,   7,    0,   -6, 0 },  // 0x4F 'O'
+  {   210,   5,   7,   7,    1,   -6, 0 },  // 0x50 'P'
+  {   215,   6,   9,   7,    0,   -6, 0 },  // 0x51 'Q'
+  {   222,   7,   7,   7,    0,   -6, 0 },  // 0x52 'R'
+  {   229,   5,   7,   7,    1,   -6, 0 },  // 0x53 'S'
+  {   234,   5,   7,   7,    1,   -6, 0 },  // 0x54 'T'
+  {   239,   7,   7,   7,    0,   -6, 0 },  // 0x55 'U'
+  {   246,   7,   7,   7,    0,   -6, 0 },  // 0x56 'V'
+  {   253,   7,   7,   7,    0,   -6, 0 },  // 0x57 'W'
+  {   260,   6,   7,   7,    0,   -6, 0 },  // 0x58 'X'
+  {   266,   7,   7,   7,    0,   -6, 0 },  // 0x59 'Y'
+  {   273,   5,   7,   7,    1,   -6, 0 },  // 0x5A 'Z'
+  {   278,   2,  10,   7,    3,   -7, 0 },  // 0x5B '['
+  {   281,   4,   9,   7,    2,   -7, 2 },  // 0x5C
+  {   285,   2,  10,   7,    2,   -7, 0 },  // 0x5D ']'
+  {   288,   4,   3,   7,    2,   -6, 0 },  // 0x5E '^'
+  {   290,   7,   1,   7,    0,    2, 0 },  // 0x5F '_'
+  {   291,   2,   2,   7,    3,   -7, 0 },  // 0x60 '`'
+  {   292,   7,   5,   7,    0,   -4, 0 },  // 0x61 'a'
+  {   297,   6,   8,   7,    0,   -7, 0 },  // 0x62 'b'
+  {   303,   5,   5,   7,    1,   -4, 2 },  // 0x63 'c'
+  {   306,   7,   8,   7,    0,   -7, 0 },  // 0x64 'd'
+  {   313,   5,   5,   7,    1,   -4, 0 },  // 0x65 'e'
+  {   317,   5,   8,   7,    1,   -7, 0 },  // 0x66 'f'
+  {   322,   7,   7,   7,    0,   -4, 0 },  // 0x67 'g'
+  {   329,   7,   8,   7,    0,   -7, 0 },  // 0x68 'h'
+  {   336,   5,   8,   7,    1,   -7, 0 },  // 0x69 'i'
+  {   341,   4,  10,   7,    1,   -7, 0 },  // 0x6A 'j'
+  {   346,   6,   8,   7,    1,   -7, 0 },  // 0x6B 'k'
+  {   352,   5,   8,   7,    1,   -7, 0 },  // 0x6C 'l'
+  {   357,   7,   5,   7,    0,   -4, 0 },  // 0x6D 'm'
+  {   362,   7,   5,   7,    0,   -4, 0 },  // 0x6E 'n'
+  {   367,   5,   5,   7,    1,   -4, 2 },  // 0x6F 'o'
+  {   370,   6,   7,   7,    0,   -4, 0 },  // 0x70 'p'
+  {   376,   7,   7,   7,    0,   -4, 0 },  // 0x71 'q'
+  {   383,   5,   5,   7,    1,   -4, 0 },  // 0x72 'r'
+  {   387,   5,   5,   7,    1,   -4, 0 },  // 0x73 's'
+  {   391,   6,   7,   7,    0,   -6, 0 },  // 0x74 't'
+  {   397,   7,   5,   7,    0,   -4, 0 },  // 0x75 'u'
+  {   402,   6,   5,   7,    0,   -4, 0 },  // 0x76 'v'
+  {   406,   7,   5,   7,    0,   -4, 0 },  // 0x77 'w'
+  {   411,   6,   5,   7,    0,   -4, 0 },  // 0x78 'x'
+  {   415,   6,   7,   7,    0,   -4, 0 },  // 0x79 'y'
+  {   421,   5,   5,   7,    1,   -4, 0 },  // 0x7A 'z'
+  {   425,   3,  10,   7,    2,   -7, 0 },  // 0x7B '{'
+  {   429,   1,   9,   7,    3,   -7, 1 },  // 0x7C '|'
+  {   430,   3,  10,   7,    2,   -7, 0 },  // 0x7D '}'
+  {   434,   5,   2,   7,    1,   -3, 0 },  // 0x7E '~'
+  {   436,   7,   8,   9,    1,   -7, 2 },  // 0x7F
+  {   441,   7,   7,   7,    0,   -4, 0 },  // 0x80
+  {   448,   5,   5,   7,    1,   -4, 0 },  // 0x81
+  {   452,   6,   5,   7,    1,   -4, 0 },  // 0x82
+  {   456,   7,   7,   7,    0,   -4, 0 },  // 0x83
+  {   463,   6,  10,   7,    1,   -7, 0 },  // 0x84
+  {   471,   7,   5,   7,    0,   -4, 0 },  // 0x85
+  {   476,   7,   6,   7,    0,   -4, 0 },  // 0x86
+  {   482,   7,   5,   7,    0,   -4, 0 },  // 0x87
+  {   487,   7,   5,   7,    0,   -4, 0 },  // 0x88
+  {   492,   7,   6,   7,    0,   -4, 0 },  // 0x89
+  {   498,   7,   5,   7,    0,   -4, 0 },  // 0x8A
+  {   503,   7,   5,   7,    0,   -4, 0 },  // 0x8B
+  {   508,   6,   5,   7,    1,   -4, 0 },  // 0x8C
+  {   512,   5,   5,   7,    1,   -4, 0 },  // 0x8D
+  {   516,   7,   5,   7,    0,   -4, 0 },  // 0x8E
+  {   521,   7,   5,   7,    0,   -4, 0 },  // 0x8F
+  {   526,   7,   7,   7,    0,   -6, 0 },  // 0x90
+  {   533,   6,   7,   7,    1,   -6, 0 },  // 0x91
+  {   539,   6,   7,   7,    1,   -6, 0 },  // 0x92
+  {   545,   5,   7,   7,    1,   -6, 0 },  // 0x93
+  {   550,   7,   8,   7,    0,   -6, 0 },  // 0x94
+  {   557,   6,   7,   7,    1,   -6, 0 },  // 0x95
+  {   563,   6,   7,   7,    1,   -6, 0 },  // 0x96
+  {   569,   5,   7,   7,    1,   -6, 0 },  // 0x97
+  {   574,   7,   7,   7,    0,   -6, 0 },  // 0x98
+  {   581,   7,   8,   7,    0,   -7, 0 },  // 0x99
+  {   588,   6,   7,   7,    1,   -6, 0 },  // 0x9A
+  {   594,   7,   7,   7,    0,   -6, 0 },  // 0x9B
+  {   601,   7,   7,   7,    0,   -6, 0 },  // 0x9C
+  {   160,   7,   7,   7,    0,   -6, 0 },  // 0x9D
+  {   608,   6,   7,   7,    1,   -6, 0 },  // 0x9E
+  {   614,   7,   7,   7,    0,   -6, 0 },  // 0x9F
+  {   621,   6,   7,   7,    1,   -6, 0 },  // 0xA0
+  {   627,   5,   7,   7,    1,   -6, 2 },  // 0xA1
+  {   631,   6,   7,   7,    1,   -6, 0 },  // 0xA2
+  {   637,   7,   7,   7,    0,   -6, 0 },  // 0xA3
+  {   644,   6,   7,   7,    1,   -6, 0 },  // 0xA4
+  {   650,   7,   7,   7,    0,   -6, 0 },  // 0xA5
+  {   657,   7,   8,   7,    0,   -6, 0 },  // 0xA6
+  {   664,   7,   7,   7,    0,   -6, 0 },  // 0xA7
+  {   671,   7,   7,   7,    0,   -6, 0 },  // 0xA8
+  {   678,   7,   8,   7,    0,   -6, 2 },  // 0xA9
+  {   684,   7,   7,   7,    0,   -6, 0 },  // 0xAA
+  {   691,   7,   7,   7,    0,   -6, 0 },  // 0xAB
+  {   698,   6,   7,   7,    1,   -6, 0 },  // 0xAC
+  {   704,   5,   7,   7,    1,   -6, 0 },  // 0xAD
+  {   709,   7,   7,   7,    0,   -6, 0 },  // 0xAE
+  {   716,   6,   7,   7,    1,   -6, 0 },  // 0xAF
+  {   722,   6,   5,   7,    1,   -4, 0 },  // 0xB0
+  {   726,   5,   8,   7,    1,   -7, 0 },  // 0xB1
+  {   731,   5,   5,   7,    1,   -4, 0 },  // 0xB2
+  {   735,   6,   5,   7,    1,   -4, 0 },  // 0xB3
+  {   739,   7,   6,   7,    0,   -4, 0 },  // 0xB4
+  {   745,   6,   5,   7,    1,   -4, 0 },  // 0xB5
+  {   749,   6,   5,   7,    1,   -4, 0 },  // 0xB6
+  {   753,   5,   5,   7,    1,   -4, 0 },  // 0xB7
+  {   757,   7,   5,   7,    0,   -4, 0 },  // 0xB8
+  {   762,   7,   7,   7,    0,   -6, 0 },  // 0xB9
+  {   769,   6,   5,   7,    1,   -4, 0 },  // 0xBA
+  {   773,   7,   5,   7,    0,   -4, 0 },  // 0xBB
+  {   778,   7,   5,   7,    0,   -4, 0 },  // 0xBC
+  {   783,   7,   5,   7,    0,   -4, 0 },  // 0xBD
+  {   788,   5,   5,   7,    1,   -4, 0 },  // 0xBE
+  {   792,   7,   5,   7,    0,   -4, 0 },  // 0xBF
+  {   797,   6,   8,   7,    1,   -7, 0 },  // 0xC0
+  {   803,   6,   7,   7,    1,   -6, 0 }   // 0xC1
+};
+
+const RleFont CourierCyr6pt8bRle PROGMEM = {
+  CourierCyr6pt8bRleData,
+  CourierCyr6pt8bRleGlyphs,
+  0x20, 0xC1, 10 };
+
+#endif // COURIERCYR6PT8BRLE_H_
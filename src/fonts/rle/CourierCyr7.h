@@ -0,0 +1,261 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr7.h, do not edit.
+// 162 glyphs (0 sharing another's bitmap), 990 bytes of bitmap data (GFXfont: 1020)
+#ifndef COURIERCYR7PT8BRLE_H_
+#define COURIERCYR7PT8BRLE_H_
+
+const uint8_t CourierCyr7pt8bRleData[] PROGMEM = {
+  0xEA, 0x83, 0x99, 0x90, 0x49, 0x24, 0xBF, 0x51, 0x4F, 0xD4, 0x50, 0x11,
+  0xF8, 0xA0, 0x40, 0xE0, 0x61, 0xF8, 0x41, 0x00, 0x62, 0x49, 0x1B, 0x33,
+  0x62, 0x49, 0x18, 0x71, 0x44, 0x08, 0xE6, 0x69, 0x1B, 0xFC, 0x6A, 0xAA,
+  0x94, 0x89, 0x12, 0x49, 0x4A, 0x00, 0x22, 0xB6, 0xD0, 0x10, 0x4F, 0xC4,
+  0x10, 0x40, 0x6A, 0x00, 0xFC, 0xC0, 0x41, 0x32, 0x72, 0xC2, 0x72, 0x80,
+  0x79, 0x28, 0x61, 0x86, 0x18, 0x52, 0x78, 0x31, 0x23, 0x33, 0xFF, 0x33,
+  0x12, 0x7A, 0x30, 0x41, 0x08, 0x46, 0x21, 0xFC, 0x72, 0x20, 0x84, 0x30,
+  0x30, 0x63, 0x78, 0x08, 0xE2, 0x92, 0x4A, 0x2F, 0xC2, 0x3C, 0xF4, 0x21,
+  0xE9, 0x84, 0x33, 0xF0, 0x3D, 0x84, 0x20, 0xBB, 0x18, 0x71, 0x78, 0xFC,
+  0x42, 0x21, 0x08, 0x44, 0x20, 0x7A, 0x18, 0x52, 0x33, 0x38, 0x61, 0x78,
+  0x7B, 0x38, 0x61, 0xCD, 0xD0, 0x86, 0xE0, 0xC0, 0xC0, 0x60, 0x34, 0xA0,
+  0x02, 0x39, 0x86, 0x03, 0x80, 0xC0, 0x06, 0x66, 0x80, 0xE0, 0x30, 0x33,
+  0x98, 0x00, 0x74, 0x42, 0x13, 0x20, 0x0C, 0x38, 0x8A, 0x14, 0xEA, 0x54,
+  0xAF, 0xA0, 0x3C, 0x38, 0x0A, 0x05, 0x04, 0x42, 0x21, 0xF1, 0x05, 0xC7,
+  0xF9, 0x14, 0x5E, 0x4D, 0x14, 0x7E, 0x3A, 0x8E, 0x0C, 0x08, 0x10, 0x10,
+  0x9E, 0xF9, 0x34, 0x51, 0x45, 0x14, 0xBE, 0xFD, 0x14, 0x9E, 0x49, 0x14,
+  0x7F, 0xFD, 0x14, 0x9E, 0x49, 0x04, 0x38, 0x3A, 0x46, 0x82, 0x80, 0x8F,
+  0x82, 0x42, 0x3C, 0xE7, 0x42, 0x42, 0x7E, 0x42, 0x42, 0x42, 0xE7, 0x09,
+  0x12, 0xFF, 0x03, 0x12, 0x3C, 0x20, 0x82, 0x8A, 0x28, 0x9C, 0xEC, 0x91,
+  0x43, 0x05, 0x09, 0x12, 0x73, 0xE1, 0x04, 0x10, 0x45, 0x14, 0x7F, 0xE7,
+  0x66, 0x6A, 0x5A, 0x5A, 0x52, 0x42, 0xE7, 0xE7, 0x62, 0x52, 0x52, 0x4A,
+  0x4A, 0x46, 0xE6, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x51, 0x1C, 0xF9, 0x14,
+  0x51, 0x79, 0x04, 0x38, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x51, 0x1C, 0x30,
+  0x9C, 0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x73, 0x76, 0x38, 0x50, 0x3A,
+  0x18, 0x7E, 0xFE, 0x59, 0x44, 0x10, 0x41, 0x1E, 0xE7, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0x66, 0x3C, 0xE3, 0xA0, 0x90, 0x84, 0x42, 0x40, 0xA0, 0x50,
+  0x30, 0xE3, 0xC0, 0xA2, 0x4B, 0x25, 0x53, 0x29, 0x98, 0x44, 0xE7, 0x44,
+  0x24, 0x18, 0x18, 0x24, 0x42, 0xE7, 0xE3, 0x42, 0x24, 0x14, 0x08, 0x08,
+  0x08, 0x3C, 0xFA, 0x29, 0x08, 0x21, 0x18, 0x7F, 0xEA, 0xAA, 0xAC, 0x01,
+  0x92, 0x92, 0xE2, 0x92, 0x05, 0xFA, 0x21, 0x20, 0xC4, 0xA1, 0x09, 0xE3,
+  0x38, 0x89, 0xF4, 0x28, 0xCE, 0xC0, 0xC0, 0x81, 0x02, 0xE6, 0x68, 0x50,
+  0xB3, 0xDC, 0x77, 0x38, 0x20, 0xC5, 0xE0, 0x1C, 0x08, 0x13, 0xAC, 0xD0,
+  0xA1, 0x66, 0x76, 0x7A, 0x1F, 0xE0, 0xC5, 0xE0, 0x7A, 0x11, 0xE4, 0x21,
+  0x08, 0xF0, 0x77, 0x9A, 0x14, 0x2C, 0xCE, 0x81, 0x3C, 0xE0, 0x20, 0x20,
+  0x2E, 0x32, 0x22, 0x22, 0x22, 0x77, 0x10, 0x00, 0x1C, 0x10, 0x41, 0x04,
+  0xFC, 0x41, 0x41, 0x59, 0xFB, 0x50, 0xC0, 0x81, 0x02, 0xE4, 0x8E, 0x14,
+  0x24, 0xCE, 0x04, 0x23, 0xFF, 0x93, 0x12, 0xF6, 0x4A, 0x4A, 0x4A, 0x4A,
+  0xEF, 0xDE, 0x62, 0x42, 0x42, 0x42, 0xE7, 0x7B, 0x38, 0x61, 0xCD, 0xE0,
+  0xDC, 0xCD, 0x0A, 0x16, 0x6B, 0x90, 0x78, 0x77, 0x9A, 0x14, 0x2C, 0xCE,
+  0x81, 0x0F, 0xEC, 0xC2, 0x08, 0x23, 0xE0, 0x7A, 0x28, 0x1F, 0x87, 0xE0,
+  0x41, 0x0F, 0x90, 0x41, 0x04, 0x4E, 0xC6, 0x42, 0x42, 0x42, 0x46, 0x3B,
+  0xE7, 0x42, 0x44, 0x24, 0x28, 0x18, 0xE3, 0xC0, 0x96, 0x4A, 0xA6, 0x61,
+  0x10, 0xE7, 0x24, 0x18, 0x18, 0x64, 0xE7, 0xE3, 0x42, 0x44, 0x28, 0x18,
+  0x10, 0x20, 0xF0, 0xFE, 0x21, 0x08, 0xC7, 0xF0, 0x69, 0x25, 0x12, 0x49,
+  0x80, 0x0A, 0xC2, 0x22, 0x21, 0x22, 0x22, 0xC0, 0xE3, 0x38, 0x08, 0x16,
+  0xFF, 0xF5, 0x61, 0xDC, 0x62, 0x41, 0x41, 0x42, 0x62, 0x5C, 0xF0, 0x1A,
+  0x61, 0xC6, 0xFD, 0x46, 0x91, 0x02, 0x0F, 0x00, 0xC7, 0x44, 0x44, 0x28,
+  0x28, 0x10, 0x10, 0xF0, 0x20, 0x40, 0x83, 0xCA, 0x54, 0x68, 0xD2, 0x68,
+  0x61, 0xE0, 0x67, 0x24, 0x18, 0x18, 0x24, 0xE7, 0xE7, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0xBD, 0x01, 0xCF, 0x0A, 0x13, 0xE0, 0x41, 0xC0, 0xFB, 0x52,
+  0x52, 0x52, 0x52, 0xFF, 0xFB, 0x52, 0x52, 0x52, 0x52, 0x52, 0xAD, 0x01,
+  0xF0, 0xA0, 0x20, 0x3F, 0x21, 0x7E, 0xE3, 0x42, 0x42, 0x7E, 0x46, 0xFB,
+  0xE0, 0x81, 0x03, 0xE4, 0x3F, 0x80, 0xF9, 0x08, 0x09, 0xE0, 0x5F, 0x00,
+  0xDD, 0x46, 0x8F, 0x1A, 0x3B, 0x80, 0x3F, 0x42, 0x42, 0x3E, 0x22, 0xC7,
+  0x38, 0x18, 0x28, 0x24, 0x24, 0x5A, 0x42, 0xE3, 0x06, 0x24, 0xE1, 0x25,
+  0x26, 0x86, 0x05, 0x35, 0xF1, 0x43, 0x68, 0x60, 0xFC, 0x85, 0x0A, 0x04,
+  0x08, 0x10, 0x70, 0x08, 0x13, 0x11, 0xFF, 0x52, 0x66, 0x14, 0x20, 0xFC,
+  0x85, 0x0A, 0x47, 0x88, 0x10, 0xFF, 0xB7, 0x49, 0xA1, 0x45, 0x94, 0xA9,
+  0x5B, 0xFA, 0x20, 0x82, 0x38, 0x10, 0x7E, 0xC7, 0x1A, 0x54, 0xAA, 0x54,
+  0xB1, 0x67, 0x48, 0x73, 0x1C, 0x69, 0x52, 0xA9, 0x52, 0xC5, 0x9C, 0xEF,
+  0x12, 0x45, 0x05, 0x11, 0x22, 0x73, 0xFE, 0x89, 0x12, 0x24, 0x48, 0x91,
+  0x67, 0xC3, 0x66, 0x66, 0x5A, 0x5A, 0x4A, 0x42, 0xE7, 0xCF, 0x0A, 0x14,
+  0x2F, 0xD0, 0xA1, 0x67, 0x14, 0x26, 0x62, 0xFB, 0x81, 0xFF, 0x0A, 0x14,
+  0x28, 0x50, 0xA1, 0x67, 0xF8, 0x89, 0x0A, 0x17, 0xC8, 0x10, 0x78, 0x1A,
+  0xC1, 0xF3, 0x60, 0xFF, 0x46, 0x89, 0x02, 0x04, 0x08, 0x3C, 0xE7, 0x42,
+  0x42, 0x24, 0x14, 0x18, 0x08, 0x70, 0x38, 0xF2, 0x95, 0x1A, 0x34, 0x9A,
+  0x1C, 0x67, 0x24, 0x24, 0x18, 0x18, 0x24, 0x42, 0xE7, 0xCF, 0x0A, 0x14,
+  0x28, 0x50, 0xA1, 0x42, 0x7A, 0x04, 0xCF, 0x0A, 0x12, 0x23, 0xC0, 0x81,
+  0x07, 0xFB, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0xFF, 0xFB, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0x52, 0x52, 0xAD, 0x01, 0xF0, 0xA0, 0xA0, 0x20, 0x3E,
+  0x21, 0x21, 0x7E, 0xE3, 0x42, 0x42, 0x42, 0x7A, 0x46, 0x46, 0xFB, 0x03,
+  0x52, 0xF4, 0x52, 0x68, 0x60, 0xF9, 0x0A, 0x10, 0x13, 0xE0, 0x81, 0x7C,
+  0xDD, 0x4A, 0x8E, 0x1C, 0x34, 0x68, 0xEE, 0x3E, 0x8A, 0x12, 0x23, 0xC4,
+  0x91, 0x47, 0x78, 0x11, 0xE4, 0x48, 0x9F, 0xC0, 0x0D, 0xC8, 0x2E, 0xC6,
+  0x18, 0x61, 0x78, 0xFD, 0x14, 0x5F, 0x47, 0xF0, 0xFC, 0x85, 0x02, 0x04,
+  0x1F, 0x00, 0x7E, 0x89, 0x12, 0x24, 0x50, 0xBE, 0xC1, 0x14, 0x26, 0x95,
+  0x24, 0x27, 0xB6, 0xD1, 0xA2, 0xCA, 0x56, 0xC0, 0xFA, 0x10, 0x85, 0x07,
+  0xF0, 0xE3, 0x46, 0x4A, 0x52, 0x62, 0xE7, 0x24, 0x1C, 0x00, 0xE3, 0x46,
+  0x4A, 0x52, 0x62, 0xE7, 0xFD, 0x22, 0x82, 0x88, 0x9D, 0xC0, 0x7E, 0x89,
+  0x12, 0x24, 0x59, 0xC0, 0xC3, 0x66, 0x66, 0x5A, 0x52, 0xE7, 0xE7, 0x42,
+  0x42, 0x7E, 0x42, 0xE7, 0x14, 0x26, 0xD2, 0x58, 0x10, 0xFF, 0x42, 0x42,
+  0x42, 0x42, 0xE7, 0x29, 0xF9, 0x0A, 0x14, 0x8F, 0x10, 0x21, 0xFE, 0x28,
+  0x01, 0xE4, 0x28, 0x5F, 0x20, 0x3F };
+
+const RleGlyph CourierCyr7pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   8,    0,    1, 0 },  // 0x20 ' '
+  {     0,   2,   8,   8,    3,   -7, 0 },  // 0x21 '!'
+  {     2,   4,   3,   8,    2,   -7, 0 },  // 0x22 '"'
+  {     4,   6,   9,   8,    1,   -8, 0 },  // 0x23 '#'
+  {    11,   6,  11,   8,    1,   -8, 0 },  // 0x24 '$'
+  {    20,   6,   9,   8,    1,   -8, 0 },  // 0x25 '%'
+  {    27,   6,   8,   8,    1,   -7, 0 },  // 0x26 '&'
+  {    33,   2,   3,   8,    3,   -7, 0 },  // 0x27 '''
+  {    34,   2,  11,   8,    4,   -8, 0 },  // 0x28 '('
+  {    37,   3,  11,   8,    2,   -8, 0 },  // 0x29 ')'
+  {    42,   4,   5,   8,    2,   -8, 0 },  // 0x2A '*'
+  {    45,   6,   6,   8,    1,   -6, 0 },  // 0x2B '+'
+  {    50,   3,   3,   8,    3,    0, 0 },  // 0x2C ','
+  {    52,   6,   1,   8,    1,   -3, 0 },  // 0x2D '-'
+  {    53,   2,   1,   8,    3,    0, 0 },  // 0x2E '.'
+  {    54,   5,  10,   8,    2,   -8, 2 },  // 0x2F '/'
+  {    60,   6,   9,   8,    1,   -8, 0 },  // 0x30 '0'
+  {    67,   6,   9,   8,    1,   -8, 2 },  // 0x31 '1'
+  {    73,   6,   9,   8,    1,   -8, 0 },  // 0x32 '2'
+  {    80,   6,   9,   8,    1,   -8, 0 },  // 0x33 '3'
+  {    87,   6,   9,   8,    1,   -8, 0 },  // 0x34 '4'
+  {    94,   5,   9,   8,    2,   -8, 0 },  // 0x35 '5'
+  {   100,   6,   9,   8,    1,   -8, 0 },  // 0x36 '6'
+  {   107,   5,   9,   8,    1,   -8, 0 },  // 0x37 '7'
+  {   113,   6,   9,   8,    1,   -8, 0 },  // 0x38 '8'
+  {   120,   6,   9,   8,    1,   -8, 0 },  // 0x39 '9'
+  {   127,   2,   5,   8,    3,   -4, 0 },  // 0x3A ':'
+  {   129,   3,   7,   8,    2,   -4, 0 },  // 0x3B ';'
+  {   132,   7,   6,   8,    0,   -5, 0 },  // 0x3C '<'
+  {   138,   6,   3,   8,    1,   -5, 1 },  // 0x3D '='
+  {   140,   7,   6,   8,    0,   -5, 0 },  // 0x3E '>'
+  {   146,   5,   8,   8,    2,   -7, 0 },  // 0x3F '?'
+  {   151,   7,   9,   8,    1,   -8, 0 },  // 0x40 '@'
+  {   159,   9,   8,   8,   -1,   -7, 0 },  // 0x41 'A'
+  {   168,   6,   8,   8,    1,   -7, 0 },  // 0x42 'B'
+  {   174,   7,   8,   8,    0,   -7, 0 },  // 0x43 'C'
+  {   181,   6,   8,   8,    1,   -7, 0 },  // 0x44 'D'
+  {   187,   6,   8,   8,    1,   -7, 0 },  // 0x45 'E'
+  {   193,   6,   8,   8,    1,   -7, 0 },  // 0x46 'F'
+  {   199,   8,   8,   8,    0,   -7, 0 },  // 0x47 'G'
+  {   207,   8,   8,   8,    0,   -7, 0 },  // 0x48 'H'
+  {   215,   6,   8,   8,    1,   -7, 2 },  // 0x49 'I'
+  {   220,   6,   8,   8,    1,   -7, 0 },  // 0x4A 'J'
+  {   226,   7,   8,   8,    1,   -7, 0 },  // 0x4B 'K'
+  {   233,   6,   8,   8,    1,   -7, 0 },  // 0x4C 'L'
+  {   239,   8,   8,   8,    0,   -7, 0 },  // 0x4D 'M'
+  {   247,   8,   8,   8,    0,   -7, 0 },  // 0x4E 'N'
+  {   255,   7,   8,   8,    0,   -7, 0 },  // 0x4F 'O'
+  {   262,   6,   8,   8,    1,   -7, 0 },  // 0x50 'P'
+  {   268,   7,  10,   8,    0,   -7, 0 },  // 0x51 'Q'
+  {   277,   7,   8,   8,    1,   -7, 0 },  // 0x52 'R'
+  {   284,   6,   8,   8,    1,   -7, 0 },  // 0x53 'S'
+  {   290,   6,   8,   8,    1,   -7, 0 },  // 0x54 'T'
+  {   296,   8,   8,   8,    0,   -7, 0 },  // 0x55 'U'
+  {   304,   9,   8,   8,   -1,   -7, 0 },  // 0x56 'V'
+  {   313,   9,   8,   8,   -1,   -7, 0 },  // 0x57 'W'
+  {   322,   8,   8,   8,    0,   -7, 0 },  // 0x58 'X'
+  {   330,   8,   8,   8,    0,   -7, 0 },  // 0x59 'Y'
+  {   338,   6,   8,   8,    1,   -7, 0 },  // 0x5A 'Z'
+  {   344,   2,  11,   8,    4,   -8, 0 },  // 0x5B '['
+  {   347,   5,  10,   8,    2,   -8, 2 },  // 0x5C
+  {   352,   3,  11,   8,    2,   -8, 2 },  // 0x5D ']'
+  {   355,   6,   4,   8,    1,   -8, 0 },  // 0x5E '^'
+  {   358,   9,   1,   8,   -1,    2, 1 },  // 0x5F '_'
+  {   359,   4,   2,   8,    2,   -8, 0 },  // 0x60 '`'
+  {   360,   7,   6,   8,    1,   -5, 0 },  // 0x61 'a'
+  {   366,   7,   9,   8,    0,   -8, 0 },  // 0x62 'b'
+  {   374,   6,   6,   8,    1,   -5, 0 },  // 0x63 'c'
+  {   379,   7,   9,   8,    1,   -8, 0 },  // 0x64 'd'
+  {   387,   6,   6,   8,    1,   -5, 0 },  // 0x65 'e'
+  {   392,   5,   9,   8,    2,   -8, 0 },  // 0x66 'f'
+  {   398,   7,   8,   8,    1,   -5, 0 },  // 0x67 'g'
+  {   405,   8,   9,   8,    0,   -8, 0 },  // 0x68 'h'
+  {   414,   6,   9,   8,    1,   -8, 0 },  // 0x69 'i'
+  {   421,   5,  11,   8,    1,   -8, 2 },  // 0x6A 'j'
+  {   426,   7,   9,   8,    1,   -8, 0 },  // 0x6B 'k'
+  {   434,   6,   9,   8,    1,   -8, 2 },  // 0x6C 'l'
+  {   439,   8,   6,   8,    0,   -5, 0 },  // 0x6D 'm'
+  {   445,   8,   6,   8,    0,   -5, 0 },  // 0x6E 'n'
+  {   451,   6,   6,   8,    1,   -5, 0 },  // 0x6F 'o'
+  {   456,   7,   8,   8,    0,   -5, 0 },  // 0x70 'p'
+  {   463,   7,   8,   8,    1,   -5, 0 },  // 0x71 'q'
+  {   470,   6,   6,   8,    1,   -5, 0 },  // 0x72 'r'
+  {   475,   6,   6,   8,    1,   -5, 0 },  // 0x73 's'
+  {   480,   6,   8,   8,    1,   -7, 0 },  // 0x74 't'
+  {   486,   8,   6,   8,    0,   -5, 0 },  // 0x75 'u'
+  {   492,   8,   6,   8,    0,   -5, 0 },  // 0x76 'v'
+  {   498,   9,   6,   8,   -1,   -5, 0 },  // 0x77 'w'
+  {   505,   8,   6,   8,    0,   -5, 0 },  // 0x78 'x'
+  {   511,   8,   8,   8,    0,   -5, 0 },  // 0x79 'y'
+  {   519,   6,   6,   8,    1,   -5, 0 },  // 0x7A 'z'
+  {   524,   3,  11,   8,    3,   -8, 0 },  // 0x7B '{'
+  {   529,   1,  10,   8,    4,   -8, 1 },  // 0x7C '|'
+  {   530,   4,  11,   8,    2,   -8, 0 },  // 0x7D '}'
+  {   536,   7,   2,   8,    0,   -3, 0 },  // 0x7E '~'
+  {   538,   8,   9,  11,    1,   -8, 2 },  // 0x7F
+  {   543,   8,   8,   8,    0,   -5, 0 },  // 0x80
+  {   551,   6,   6,   8,    1,   -5, 2 },  // 0x81
+  {   554,   7,   6,   8,    1,   -5, 0 },  // 0x82
+  {   560,   8,   8,   8,    0,   -5, 0 },  // 0x83
+  {   568,   7,  11,   8,    1,   -8, 0 },  // 0x84
+  {   578,   8,   6,   8,    0,   -5, 0 },  // 0x85
+  {   584,   8,   8,   8,    0,   -5, 0 },  // 0x86
+  {   592,   7,   6,   8,    1,   -5, 0 },  // 0x87
+  {   598,   8,   6,   8,    0,   -5, 0 },  // 0x88
+  {   604,   8,   8,   8,    0,   -5, 0 },  // 0x89
+  {   612,   8,   6,   8,    0,   -5, 0 },  // 0x8A
+  {   618,   8,   6,   8,    0,   -5, 0 },  // 0x8B
+  {   624,   7,   6,   8,    1,   -5, 0 },  // 0x8C
+  {   630,   7,   6,   8,    1,   -5, 0 },  // 0x8D
+  {   636,   7,   6,   8,    1,   -5, 0 },  // 0x8E
+  {   642,   8,   6,   8,    0,   -5, 0 },  // 0x8F
+  {   648,   8,   8,   8,    0,   -7, 0 },  // 0x90
+  {   656,   7,   8,   8,    1,   -7, 2 },  // 0x91
+  {   662,   7,   8,   8,    1,   -7, 2 },  // 0x92
+  {   668,   7,   8,   8,    1,   -7, 0 },  // 0x93
+  {   675,   7,  10,   8,    1,   -7, 2 },  // 0x94
+  {   683,   7,   8,   8,    1,   -7, 0 },  // 0x95
+  {   690,   7,   8,   8,    1,   -7, 0 },  // 0x96
+  {   697,   6,   8,   8,    1,   -7, 0 },  // 0x97
+  {   703,   7,   8,   8,    1,   -7, 0 },  // 0x98
+  {   710,   7,  10,   8,    1,   -9, 0 },  // 0x99
+  {   719,   7,   8,   8,    1,   -7, 0 },  // 0x9A
+  {   726,   7,   8,   8,    1,   -7, 0 },  // 0x9B
+  {   733,   8,   8,   8,    0,   -7, 0 },  // 0x9C
+  {   741,   7,   8,   8,    1,   -7, 0 },  // 0x9D
+  {   748,   7,   8,   8,    1,   -7, 2 },  // 0x9E
+  {   753,   7,   8,   8,    1,   -7, 0 },  // 0x9F
+  {   760,   7,   8,   8,    1,   -7, 0 },  // 0xA0
+  {   767,   6,   8,   8,    1,   -7, 2 },  // 0xA1
+  {   771,   7,   8,   8,    1,   -7, 0 },  // 0xA2
+  {   778,   8,   8,   8,    0,   -7, 0 },  // 0xA3
+  {   786,   7,   8,   8,    1,   -7, 0 },  // 0xA4
+  {   793,   8,   8,   8,    0,   -7, 0 },  // 0xA5
+  {   801,   7,  10,   8,    1,   -7, 0 },  // 0xA6
+  {   810,   7,   8,   8,    1,   -7, 0 },  // 0xA7
+  {   817,   8,   8,   8,    0,   -7, 0 },  // 0xA8
+  {   825,   8,  10,   8,    0,   -7, 0 },  // 0xA9
+  {   835,   8,   8,   8,    0,   -7, 0 },  // 0xAA
+  {   843,   8,   8,   8,    0,   -7, 0 },  // 0xAB
+  {   851,   7,   8,   8,    1,   -7, 2 },  // 0xAC
+  {   857,   7,   8,   8,    1,   -7, 0 },  // 0xAD
+  {   864,   7,   8,   8,    1,   -7, 0 },  // 0xAE
+  {   871,   7,   8,   8,    1,   -7, 0 },  // 0xAF
+  {   878,   7,   6,   8,    1,   -5, 0 },  // 0xB0
+  {   884,   6,   9,   8,    1,   -8, 0 },  // 0xB1
+  {   891,   6,   6,   8,    1,   -5, 0 },  // 0xB2
+  {   896,   7,   6,   8,    1,   -5, 0 },  // 0xB3
+  {   902,   7,   8,   8,    1,   -5, 0 },  // 0xB4
+  {   909,   7,   6,   8,    1,   -5, 2 },  // 0xB5
+  {   914,   7,   6,   8,    1,   -5, 0 },  // 0xB6
+  {   920,   6,   6,   8,    1,   -5, 0 },  // 0xB7
+  {   925,   8,   6,   8,    0,   -5, 0 },  // 0xB8
+  {   931,   8,   9,   8,    0,   -8, 0 },  // 0xB9
+  {   940,   7,   6,   8,    1,   -5, 0 },  // 0xBA
+  {   946,   7,   6,   8,    1,   -5, 0 },  // 0xBB
+  {   952,   8,   6,   8,    0,   -5, 0 },  // 0xBC
+  {   958,   8,   6,   8,    0,   -5, 0 },  // 0xBD
+  {   964,   7,   6,   8,    1,   -5, 2 },  // 0xBE
+  {   969,   8,   6,   8,    0,   -5, 0 },  // 0xBF
+  {   975,   7,   9,   8,    1,   -8, 0 },  // 0xC0
+  {   983,   7,   8,   8,    1,   -7, 0 }   // 0xC1
+};
+
+const RleFont CourierCyr7pt8bRle PROGMEM = {
+  CourierCyr7pt8bRleData,
+  CourierCyr7pt8bRleGlyphs,
+  0x20, 0xC1, 11 };
+
+#endif // COURIERCYR7PT8BRLE_H_
@@ -0,0 +1,283 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr8.h, do not edit.
+// 162 glyphs (2 sharing another's bitmap), 1254 bytes of bitmap data (GFXfont: 1324)
+#ifndef COURIERCYR8PT8BRLE_H_
+#define COURIERCYR8PT8BRLE_H_
+
+const uint8_t CourierCyr8pt8bRleData[] PROGMEM = {
+  0xEA, 0xA3, 0xC0, 0x99, 0x99, 0x28, 0x50, 0xA7, 0xF4, 0x89, 0x3F, 0xA4,
+  0x48, 0x91, 0x20, 0x20, 0x87, 0xE2, 0x82, 0x06, 0x06, 0x06, 0x1F, 0x88,
+  0x20, 0x71, 0x12, 0x23, 0xB1, 0x8C, 0x37, 0x11, 0x22, 0x38, 0x38, 0x4C,
+  0x40, 0x20, 0x63, 0x94, 0x8C, 0x8C, 0x77, 0xFF, 0x29, 0x49, 0x24, 0x89,
+  0x10, 0xA9, 0x55, 0x6A, 0x20, 0x8A, 0xDC, 0x51, 0x20, 0x31, 0xF5, 0x31,
+  0x71, 0x48, 0x69, 0x40, 0xFC, 0xFC, 0x51, 0x42, 0x92, 0x92, 0x92, 0x92,
+  0xA0, 0x79, 0x28, 0x61, 0x86, 0x18, 0x61, 0x49, 0xE0, 0x12, 0x32, 0x41,
+  0xFF, 0xB2, 0x13, 0x3C, 0x8E, 0x08, 0x10, 0x41, 0x04, 0x10, 0x43, 0xFC,
+  0x39, 0x88, 0x10, 0x41, 0x80, 0x80, 0x81, 0x86, 0xF8, 0x04, 0x38, 0x51,
+  0x22, 0x48, 0xA1, 0x7F, 0x04, 0x3C, 0xFA, 0x08, 0x20, 0xFA, 0x30, 0x41,
+  0x8D, 0xE0, 0x1D, 0x84, 0x20, 0xBB, 0x38, 0x61, 0x4C, 0xE0, 0x07, 0x15,
+  0x63, 0xF2, 0x2F, 0x32, 0x90, 0x7B, 0x38, 0x61, 0x48, 0xCC, 0xE1, 0x85,
+  0xE0, 0x7B, 0x28, 0x61, 0xCD, 0xD0, 0x42, 0x1B, 0x80, 0x06, 0x66, 0x77,
+  0x00, 0x66, 0x48, 0x01, 0x0E, 0x30, 0xC0, 0x70, 0x0C, 0x03, 0x07, 0xE7,
+  0x80, 0x70, 0x0C, 0x03, 0x0E, 0x30, 0xC0, 0x7A, 0x30, 0x41, 0x18, 0x80,
+  0x0C, 0x70, 0x3C, 0x42, 0x82, 0x82, 0x9E, 0xB2, 0xA2, 0x9F, 0x40, 0x3E,
+  0x3C, 0x03, 0x01, 0x20, 0x48, 0x22, 0x0F, 0xC4, 0x11, 0x02, 0xE1, 0xC0,
+  0xFC, 0x42, 0x42, 0x42, 0x7C, 0x43, 0x41, 0x41, 0xFE, 0x3D, 0x43, 0xC1,
+  0x80, 0x80, 0x80, 0xC0, 0x63, 0x3E, 0x06, 0x21, 0x15, 0x72, 0xFF, 0x83,
+  0x15, 0x10, 0xFF, 0x41, 0x41, 0x44, 0x7C, 0x44, 0x41, 0x41, 0xFF, 0xFF,
+  0x41, 0x41, 0x44, 0x7C, 0x44, 0x40, 0x40, 0xF0, 0x3D, 0x31, 0xB0, 0x50,
+  0x08, 0x04, 0x3F, 0x04, 0xC2, 0x3E, 0x00, 0xE7, 0x42, 0x42, 0x42, 0x7E,
+  0x42, 0x42, 0x42, 0xE7, 0x08, 0x13, 0xFF, 0x62, 0x13, 0x26, 0x23, 0x12,
+  0xF9, 0x1F, 0x86, 0x20, 0xE7, 0x21, 0x11, 0x0B, 0x07, 0x82, 0x21, 0x10,
+  0x84, 0xE3, 0x80, 0x04, 0x41, 0x12, 0xFF, 0x51, 0xF1, 0x11, 0x51, 0xE3,
+  0xB1, 0x99, 0x4A, 0xA5, 0x92, 0xC9, 0x04, 0x82, 0xE3, 0x80, 0xE7, 0xB0,
+  0x94, 0x4A, 0x24, 0x92, 0x49, 0x14, 0x86, 0xF3, 0x00, 0x3C, 0x42, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0xFC, 0x8D, 0x0A, 0x14, 0x6F, 0x90,
+  0x20, 0xF0, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x10,
+  0x3F, 0xFC, 0x42, 0x42, 0x42, 0x7C, 0x48, 0x44, 0x42, 0xE3, 0x3D, 0x63,
+  0x41, 0x40, 0x3C, 0x03, 0x81, 0x43, 0xBE, 0xFF, 0x91, 0x91, 0x91, 0x10,
+  0x10, 0x10, 0x10, 0x3C, 0xF7, 0xA0, 0x90, 0x48, 0x24, 0x12, 0x09, 0x04,
+  0xC6, 0x3E, 0x00, 0xE1, 0xD0, 0x24, 0x10, 0x84, 0x22, 0x04, 0x81, 0x20,
+  0x50, 0x0C, 0x00, 0xE1, 0xE0, 0x24, 0x89, 0x32, 0x54, 0x95, 0x25, 0x31,
+  0x8C, 0x21, 0x00, 0xE3, 0xA1, 0x09, 0x02, 0x80, 0x80, 0xA0, 0x88, 0x82,
+  0xE3, 0x80, 0xC7, 0x42, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x3C, 0xFD,
+  0x0A, 0x20, 0x81, 0x04, 0x10, 0xC1, 0xFE, 0x03, 0x12, 0xFD, 0x20, 0x01,
+  0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xD5, 0x55, 0x57, 0x10, 0x51, 0x14, 0x10,
+  0x0A, 0xC6, 0x10, 0x3C, 0x42, 0x7E, 0xC2, 0x82, 0x86, 0x7B, 0xE0, 0x10,
+  0x08, 0x05, 0xC3, 0x11, 0x04, 0x82, 0x41, 0x31, 0x37, 0x00, 0x3F, 0x42,
+  0x81, 0x80, 0x80, 0x43, 0x3C, 0x0E, 0x02, 0x02, 0x3A, 0x46, 0x82, 0x82,
+  0x82, 0x46, 0x3B, 0x3C, 0x42, 0x81, 0xFF, 0x80, 0x41, 0x3E, 0x3E, 0x81,
+  0x07, 0xE4, 0x08, 0x10, 0x20, 0x41, 0xF8, 0x3B, 0x46, 0x82, 0x82, 0x82,
+  0x46, 0x3A, 0x02, 0x86, 0x7C, 0x03, 0x62, 0xF5, 0x35, 0x54, 0x1F, 0xF3,
+  0x11, 0x12, 0x11, 0x10, 0x21, 0xB1, 0x33, 0x32, 0xFD, 0x21, 0x30, 0x51,
+  0xB1, 0x15, 0x14, 0xFF, 0xB1, 0x14, 0x11, 0xC0, 0x20, 0x10, 0x08, 0xE4,
+  0x42, 0xC1, 0xC0, 0x90, 0x46, 0x63, 0xC0, 0x03, 0x32, 0xFF, 0xF1, 0x21,
+  0x30, 0xF7, 0x92, 0x24, 0x89, 0x22, 0x48, 0x92, 0x2E, 0xCC, 0xDC, 0x62,
+  0x42, 0x42, 0x42, 0x42, 0xE7, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x42, 0x3C,
+  0xDE, 0x30, 0x90, 0x28, 0x14, 0x0B, 0x09, 0x78, 0x80, 0x40, 0x7C, 0x00,
+  0x3B, 0x46, 0x82, 0x82, 0x82, 0x46, 0x3A, 0x02, 0x02, 0x0F, 0xE7, 0x28,
+  0x30, 0x20, 0x20, 0x20, 0xFC, 0x15, 0x15, 0x71, 0x16, 0x27, 0x76, 0x40,
+  0x83, 0xF2, 0x04, 0x08, 0x10, 0x21, 0x3C, 0xC6, 0x42, 0x42, 0x42, 0x42,
+  0x46, 0x3B, 0xE3, 0xA0, 0x88, 0x84, 0x41, 0x40, 0xA0, 0x20, 0xE1, 0xE0,
+  0x24, 0x89, 0x32, 0x55, 0x14, 0xC2, 0x10, 0xE3, 0x91, 0x05, 0x01, 0x01,
+  0x43, 0x13, 0x8E, 0xE3, 0xA0, 0x90, 0x84, 0x41, 0x40, 0xC0, 0x20, 0x20,
+  0x10, 0x7C, 0x00, 0xFE, 0x21, 0x08, 0x46, 0x1F, 0xC0, 0x34, 0x44, 0x48,
+  0x44, 0x44, 0x43, 0x0B, 0x89, 0x24, 0x52, 0x49, 0x40, 0x61, 0x91, 0x8E,
+  0x08, 0x16, 0xFF, 0xFD, 0x61, 0xDE, 0x10, 0x90, 0x28, 0x14, 0x09, 0x09,
+  0x48, 0x98, 0x40, 0x7C, 0x00, 0x25, 0x15, 0x12, 0xB1, 0xD7, 0x10, 0xFF,
+  0x91, 0x91, 0x10, 0x10, 0x10, 0x7C, 0xE3, 0xA0, 0x90, 0x84, 0x82, 0x40,
+  0xC0, 0x20, 0x20, 0x20, 0x7C, 0x00, 0x30, 0x10, 0x10, 0x2C, 0xD2, 0x91,
+  0x91, 0x91, 0x92, 0x74, 0x18, 0x10, 0x3C, 0x73, 0x91, 0x05, 0x01, 0x01,
+  0x41, 0x13, 0x8E, 0xE7, 0x82, 0x82, 0x82, 0x82, 0x82, 0xFF, 0x01, 0x01,
+  0xE7, 0x42, 0x42, 0x46, 0x3A, 0x02, 0x0F, 0xDB, 0x92, 0x92, 0x92, 0x92,
+  0x92, 0xFF, 0xEF, 0xA4, 0x92, 0x49, 0x24, 0x92, 0x4B, 0xFE, 0x01, 0x00,
+  0x80, 0xF8, 0x48, 0x04, 0x03, 0xE1, 0x08, 0x84, 0xFC, 0xE1, 0xA0, 0x90,
+  0x4F, 0xA4, 0x32, 0x1B, 0xF6, 0xF0, 0x40, 0x40, 0x7E, 0x41, 0x41, 0xFE,
+  0xFC, 0x82, 0x02, 0x1F, 0x02, 0x02, 0xFC, 0xCE, 0x91, 0xA1, 0x61, 0xA1,
+  0xA1, 0xDE, 0x1F, 0xB0, 0x90, 0x47, 0xE1, 0x11, 0x0B, 0x1E, 0x38, 0x0A,
+  0x05, 0x02, 0x42, 0x21, 0xF1, 0x04, 0x82, 0xE3, 0x80, 0xFE, 0x42, 0x42,
+  0x40, 0x7E, 0x41, 0x41, 0x41, 0xFE, 0x09, 0x15, 0xF1, 0x1F, 0xF2, 0x11,
+  0x24, 0x7F, 0x24, 0x24, 0x24, 0x44, 0x44, 0x44, 0x44, 0xFF, 0x81, 0x81,
+  0xFF, 0x41, 0x41, 0x48, 0x78, 0x48, 0x41, 0x41, 0xFF, 0xDB, 0x52, 0x54,
+  0x38, 0x6C, 0x54, 0x52, 0x92, 0xBB, 0x06, 0x24, 0x91, 0x92, 0x54, 0xE7,
+  0xE3, 0x86, 0x8A, 0x8A, 0x92, 0x92, 0xA2, 0xA2, 0xC7, 0x44, 0x38, 0xE3,
+  0x86, 0x8A, 0x8A, 0x92, 0x92, 0xA2, 0xA2, 0xC7, 0xE7, 0x44, 0x48, 0x50,
+  0x70, 0x48, 0x44, 0x44, 0xE3, 0x7F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x42, 0xC7, 0xE1, 0xB1, 0x94, 0xCA, 0xA5, 0x52, 0x49, 0x24, 0x82, 0xF3,
+  0x80, 0xE7, 0x82, 0x82, 0x82, 0x7E, 0x82, 0x82, 0x82, 0xE7, 0x15, 0x27,
+  0x72, 0xFF, 0x89, 0x10, 0xFF, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42,
+  0xE7, 0xFE, 0x41, 0x41, 0x41, 0x42, 0x7C, 0x40, 0x40, 0xF8, 0x2C, 0x11,
+  0x11, 0xC2, 0x71, 0xF9, 0x80, 0xE3, 0xD0, 0x42, 0x10, 0x88, 0x12, 0x05,
+  0x00, 0xC0, 0x20, 0x78, 0x00, 0x38, 0x7C, 0x92, 0x91, 0x91, 0x91, 0x92,
+  0x7C, 0x38, 0x73, 0x91, 0x04, 0x81, 0x80, 0x80, 0xA0, 0x88, 0x42, 0xF3,
+  0x80, 0x03, 0x24, 0x11, 0x21, 0x11, 0xFF, 0xF3, 0x11, 0x41, 0x89, 0xE7,
+  0x42, 0x42, 0x42, 0x26, 0x1A, 0x02, 0x02, 0x0F, 0xED, 0xA4, 0x92, 0x49,
+  0x24, 0x92, 0x49, 0x24, 0x92, 0xFF, 0x80, 0xDB, 0x92, 0x92, 0x92, 0x92,
+  0x92, 0x92, 0x92, 0xFF, 0x01, 0x01, 0x05, 0x52, 0x11, 0xD1, 0xC4, 0x55,
+  0xF5, 0x11, 0x50, 0xE1, 0xA0, 0x90, 0x48, 0x27, 0x92, 0x29, 0x0C, 0x8A,
+  0xFD, 0x80, 0x04, 0x41, 0x12, 0xF7, 0x53, 0x6F, 0x11, 0x16, 0xFC, 0x82,
+  0x82, 0x01, 0x1F, 0x01, 0x02, 0x02, 0xFC, 0xDE, 0x92, 0xA1, 0xA1, 0x61,
+  0xA1, 0xA1, 0x92, 0xDE, 0x3F, 0x42, 0x42, 0x42, 0x3E, 0x12, 0x22, 0x42,
+  0xC7, 0x15, 0x34, 0xC4, 0x35, 0xB8, 0x1E, 0x60, 0x80, 0xB8, 0xC6, 0x82,
+  0x81, 0x82, 0x82, 0x7C, 0xFC, 0x85, 0x09, 0xE4, 0x28, 0x7F, 0x80, 0xFE,
+  0x21, 0x21, 0x20, 0x20, 0x20, 0xFC, 0x7F, 0x22, 0x22, 0x22, 0x42, 0x42,
+  0xFF, 0x81, 0x81, 0x3C, 0x42, 0x82, 0xFF, 0x80, 0x80, 0x7F, 0xDB, 0x54,
+  0x34, 0x5C, 0x52, 0x92, 0xBB, 0x06, 0x27, 0x42, 0x32, 0x54, 0x77, 0xE3,
+  0x86, 0x8A, 0x92, 0xA2, 0xA2, 0xC7, 0x44, 0x3C, 0x00, 0xE3, 0x86, 0x8A,
+  0x92, 0xA2, 0xA2, 0xC7, 0xEE, 0x48, 0x50, 0x70, 0x48, 0x44, 0xE7, 0x7F,
+  0x22, 0x22, 0x22, 0x22, 0x42, 0xC7, 0xE1, 0xB1, 0x94, 0xCA, 0xA4, 0x92,
+  0x4B, 0xCE, 0xE7, 0x82, 0x82, 0x7E, 0x82, 0x82, 0xE7, 0x24, 0x27, 0x21,
+  0xC2, 0xE9, 0x10, 0xFF, 0x82, 0x82, 0x82, 0x82, 0x82, 0xE7, 0x24, 0x10,
+  0xFF, 0x41, 0x41, 0x48, 0x78, 0x48, 0x41, 0x41, 0xFF, 0x24, 0x00, 0x3C,
+  0x42, 0x82, 0xFF, 0x80, 0x80, 0x7F };
+
+const RleGlyph CourierCyr8pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,  10,    0,    1, 0 },  // 0x20 ' '
+  {     0,   2,   9,  10,    4,   -8, 0 },  // 0x21 '!'
+  {     3,   4,   4,  10,    3,   -8, 0 },  // 0x22 '"'
+  {     5,   7,  11,  10,    1,   -9, 0 },  // 0x23 '#'
+  {    15,   6,  13,  10,    2,  -10, 0 },  // 0x24 '$'
+  {    25,   7,  10,  10,    1,   -9, 0 },  // 0x25 '%'
+  {    34,   8,   9,  10,    1,   -8, 0 },  // 0x26 '&'
+  {    43,   2,   4,  10,    4,   -8, 0 },  // 0x27 '''
+  {    44,   3,  12,  10,    4,   -9, 0 },  // 0x28 '('
+  {    49,   2,  12,  10,    3,   -9, 0 },  // 0x29 ')'
+  {    52,   6,   6,  10,    2,   -9, 0 },  // 0x2A '*'
+  {    57,   8,   6,  10,    1,   -7, 2 },  // 0x2B '+'
+  {    62,   3,   4,  10,    3,   -1, 0 },  // 0x2C ','
+  {    64,   6,   1,  10,    2,   -4, 0 },  // 0x2D '-'
+  {    65,   3,   2,  10,    3,   -1, 0 },  // 0x2E '.'
+  {    66,   6,  11,  10,    2,   -9, 2 },  // 0x2F '/'
+  {    73,   6,  10,  10,    2,   -9, 0 },  // 0x30 '0'
+  {    81,   6,  10,  10,    2,   -9, 2 },  // 0x31 '1'
+  {    87,   7,  10,  10,    1,   -9, 0 },  // 0x32 '2'
+  {    96,   7,  10,  10,    1,   -9, 0 },  // 0x33 '3'
+  {   105,   7,  10,  10,    1,   -9, 0 },  // 0x34 '4'
+  {   114,   6,  10,  10,    2,   -9, 0 },  // 0x35 '5'
+  {   122,   6,  10,  10,    2,   -9, 0 },  // 0x36 '6'
+  {   130,   7,  10,  10,    1,   -9, 2 },  // 0x37 '7'
+  {   137,   6,  10,  10,    2,   -9, 0 },  // 0x38 '8'
+  {   145,   6,  10,  10,    2,   -9, 0 },  // 0x39 '9'
+  {   153,   3,   6,  10,    3,   -5, 1 },  // 0x3A ':'
+  {   155,   4,   8,  10,    2,   -5, 0 },  // 0x3B ';'
+  {   159,   8,   7,  10,    0,   -6, 0 },  // 0x3C '<'
+  {   166,   7,   4,  10,    1,   -6, 1 },  // 0x3D '='
+  {   168,   8,   7,  10,    1,   -6, 0 },  // 0x3E '>'
+  {   175,   6,   9,  10,    2,   -8, 0 },  // 0x3F '?'
+  {   182,   8,  10,  10,    1,   -9, 0 },  // 0x40 '@'
+  {   192,  10,   9,  10,   -1,   -8, 0 },  // 0x41 'A'
+  {   204,   8,   9,  10,    1,   -8, 0 },  // 0x42 'B'
+  {   213,   8,   9,  10,    1,   -8, 0 },  // 0x43 'C'
+  {   222,   8,   9,  10,    1,   -8, 2 },  // 0x44 'D'
+  {   230,   8,   9,  10,    1,   -8, 0 },  // 0x45 'E'
+  {   239,   8,   9,  10,    1,   -8, 0 },  // 0x46 'F'
+  {   248,   9,   9,  10,    0,   -8, 0 },  // 0x47 'G'
+  {   259,   8,   9,  10,    1,   -8, 0 },  // 0x48 'H'
+  {   268,   6,   9,  10,    2,   -8, 2 },  // 0x49 'I'
+  {   273,   8,   9,  10,    1,   -8, 2 },  // 0x4A 'J'
+  {   280,   9,   9,  10,    1,   -8, 0 },  // 0x4B 'K'
+  {   291,   8,   9,  10,    1,   -8, 2 },  // 0x4C 'L'
+  {   299,   9,   9,  10,    0,   -8, 0 },  // 0x4D 'M'
+  {   310,   9,   9,  10,    0,   -8, 0 },  // 0x4E 'N'
+  {   321,   8,   9,  10,    1,   -8, 0 },  // 0x4F 'O'
+  {   330,   7,   9,  10,    2,   -8, 0 },  // 0x50 'P'
+  {   338,   8,  11,  10,    1,   -8, 0 },  // 0x51 'Q'
+  {   349,   8,   9,  10,    1,   -8, 0 },  // 0x52 'R'
+  {   358,   8,   9,  10,    1,   -8, 0 },  // 0x53 'S'
+  {   367,   8,   9,  10,    1,   -8, 0 },  // 0x54 'T'
+  {   376,   9,   9,  10,    0,   -8, 0 },  // 0x55 'U'
+  {   387,  10,   9,  10,    0,   -8, 0 },  // 0x56 'V'
+  {   399,  10,   9,  10,    0,   -8, 0 },  // 0x57 'W'
+  {   411,   9,   9,  10,    0,   -8, 0 },  // 0x58 'X'
+  {   422,   8,   9,  10,    1,   -8, 0 },  // 0x59 'Y'
+  {   431,   7,   9,  10,    1,   -8, 0 },  // 0x5A 'Z'
+  {   439,   3,  12,  10,    4,   -9, 2 },  // 0x5B '['
+  {   443,   6,  11,  10,    2,   -9, 2 },  // 0x5C
+  {   449,   2,  12,  10,    3,   -9, 0 },  // 0x5D ']'
+  {   452,   7,   4,  10,    1,   -9, 0 },  // 0x5E '^'
+  {   456,  10,   1,  10,    0,    2, 1 },  // 0x5F '_'
+  {   457,   4,   3,  10,    3,  -10, 0 },  // 0x60 '`'
+  {   459,   8,   7,  10,    1,   -6, 0 },  // 0x61 'a'
+  {   466,   9,  10,  10,    0,   -9, 0 },  // 0x62 'b'
+  {   478,   8,   7,  10,    1,   -6, 0 },  // 0x63 'c'
+  {   485,   8,  10,  10,    1,   -9, 0 },  // 0x64 'd'
+  {   495,   8,   7,  10,    1,   -6, 0 },  // 0x65 'e'
+  {   502,   7,  10,  10,    2,   -9, 0 },  // 0x66 'f'
+  {   511,   8,  10,  10,    1,   -6, 0 },  // 0x67 'g'
+  {   521,   9,  10,  10,    0,   -9, 2 },  // 0x68 'h'
+  {   532,   6,  10,  10,    2,   -9, 2 },  // 0x69 'i'
+  {   539,   6,  13,  10,    1,   -9, 2 },  // 0x6A 'j'
+  {   547,   9,  10,  10,    1,   -9, 0 },  // 0x6B 'k'
+  {   559,   6,  10,  10,    2,   -9, 2 },  // 0x6C 'l'
+  {   565,  10,   7,  10,    0,   -6, 0 },  // 0x6D 'm'
+  {   574,   8,   7,  10,    1,   -6, 0 },  // 0x6E 'n'
+  {   581,   8,   7,  10,    1,   -6, 0 },  // 0x6F 'o'
+  {   588,   9,  10,  10,    0,   -6, 0 },  // 0x70 'p'
+  {   600,   8,  10,  10,    1,   -6, 0 },  // 0x71 'q'
+  {   610,   8,   7,  10,    1,   -6, 0 },  // 0x72 'r'
+  {   617,   7,   7,  10,    1,   -6, 2 },  // 0x73 's'
+  {   623,   7,   9,  10,    1,   -8, 0 },  // 0x74 't'
+  {   631,   8,   7,  10,    1,   -6, 0 },  // 0x75 'u'
+  {   638,   9,   7,  10,    0,   -6, 0 },  // 0x76 'v'
+  {   646,  10,   7,  10,    0,   -6, 0 },  // 0x77 'w'
+  {   655,   9,   7,  10,    0,   -6, 0 },  // 0x78 'x'
+  {   663,   9,  10,  10,    0,   -6, 0 },  // 0x79 'y'
+  {   675,   6,   7,  10,    2,   -6, 0 },  // 0x7A 'z'
+  {   681,   4,  12,  10,    3,   -9, 0 },  // 0x7B '{'
+  {   687,   1,  11,  10,    4,   -9, 1 },  // 0x7C '|'
+  {   688,   3,  12,  10,    3,   -9, 0 },  // 0x7D '}'
+  {   693,   8,   3,  10,    1,   -4, 0 },  // 0x7E '~'
+  {   696,   8,  10,  12,    2,   -9, 2 },  // 0x7F
+  {   701,   9,  10,  10,    0,   -6, 0 },  // 0x80
+  {   713,   7,   7,  10,    1,   -6, 2 },  // 0x81
+  {   719,   8,   7,  10,    1,   -6, 0 },  // 0x82
+  {   726,   9,  10,  10,    0,   -6, 0 },  // 0x83
+  {   738,   8,  13,  10,    1,   -9, 0 },  // 0x84
+  {   751,   9,   7,  10,    0,   -6, 0 },  // 0x85
+  {   759,   8,   9,  10,    1,   -6, 0 },  // 0x86
+  {   768,   8,   7,  10,    1,   -6, 0 },  // 0x87
+  {   775,   8,   7,  10,    1,   -6, 0 },  // 0x88
+  {   782,   9,   9,  10,    0,   -6, 0 },  // 0x89
+  {   793,   9,   7,  10,    0,   -6, 0 },  // 0x8A
+  {   801,   9,   7,  10,    0,   -6, 0 },  // 0x8B
+  {   809,   8,   7,  10,    1,   -6, 0 },  // 0x8C
+  {   816,   8,   7,  10,    1,   -6, 0 },  // 0x8D
+  {   823,   8,   7,  10,    1,   -6, 0 },  // 0x8E
+  {   830,   9,   7,  10,    0,   -6, 0 },  // 0x8F
+  {   838,   9,   9,  10,    0,   -8, 0 },  // 0x90
+  {   849,   8,   9,  10,    1,   -8, 0 },  // 0x91
+  {   204,   8,   9,  10,    1,   -8, 0 },  // 0x92
+  {   858,   8,   9,  10,    1,   -8, 2 },  // 0x93
+  {   865,   8,  11,  10,    1,   -8, 0 },  // 0x94
+  {   876,   8,   9,  10,    1,   -8, 0 },  // 0x95
+  {   885,   8,   9,  10,    1,   -8, 0 },  // 0x96
+  {   894,   7,   9,  10,    1,   -8, 2 },  // 0x97
+  {   900,   8,   9,  10,    1,   -8, 0 },  // 0x98
+  {   909,   8,  11,  10,    1,  -10, 0 },  // 0x99
+  {   920,   8,   9,  10,    1,   -8, 0 },  // 0x9A
+  {   929,   8,   9,  10,    1,   -8, 0 },  // 0x9B
+  {   938,   9,   9,  10,    0,   -8, 0 },  // 0x9C
+  {   949,   8,   9,  10,    1,   -8, 0 },  // 0x9D
+  {   958,   8,   9,  10,    1,   -8, 2 },  // 0x9E
+  {   964,   8,   9,  10,    1,   -8, 0 },  // 0x9F
+  {   973,   8,   9,  10,    1,   -8, 0 },  // 0xA0
+  {   982,   8,   9,  10,    1,   -8, 2 },  // 0xA1
+  {   367,   8,   9,  10,    1,   -8, 0 },  // 0xA2
+  {   989,  10,   9,  10,    0,   -8, 0 },  // 0xA3
+  {  1001,   8,   9,  10,    1,   -8, 0 },  // 0xA4
+  {  1010,   9,   9,  10,    0,   -8, 0 },  // 0xA5
+  {  1021,   8,  11,  10,    1,   -8, 2 },  // 0xA6
+  {  1031,   8,   9,  10,    1,   -8, 0 },  // 0xA7
+  {  1040,   9,   9,  10,    0,   -8, 0 },  // 0xA8
+  {  1051,   8,  11,  10,    1,   -8, 0 },  // 0xA9
+  {  1062,   9,   9,  10,    0,   -8, 2 },  // 0xAA
+  {  1071,   9,   9,  10,    0,   -8, 0 },  // 0xAB
+  {  1082,   8,   9,  10,    1,   -8, 2 },  // 0xAC
+  {  1090,   8,   9,  10,    1,   -8, 0 },  // 0xAD
+  {  1099,   8,   9,  10,    1,   -8, 0 },  // 0xAE
+  {  1108,   8,   9,  10,    1,   -8, 0 },  // 0xAF
+  {  1117,   8,   7,  10,    1,   -6, 2 },  // 0xB0
+  {  1122,   8,  10,  10,    1,   -9, 0 },  // 0xB1
+  {  1132,   7,   7,  10,    1,   -6, 0 },  // 0xB2
+  {  1139,   8,   7,  10,    1,   -6, 0 },  // 0xB3
+  {  1146,   8,   9,  10,    1,   -6, 0 },  // 0xB4
+  {  1155,   8,   7,  10,    1,   -6, 0 },  // 0xB5
+  {  1162,   8,   7,  10,    1,   -6, 0 },  // 0xB6
+  {  1169,   7,   7,  10,    1,   -6, 2 },  // 0xB7
+  {  1175,   8,   7,  10,    1,   -6, 0 },  // 0xB8
+  {  1182,   8,  10,  10,    1,   -9, 0 },  // 0xB9
+  {  1192,   8,   7,  10,    1,   -6, 0 },  // 0xBA
+  {  1199,   8,   7,  10,    1,   -6, 0 },  // 0xBB
+  {  1206,   9,   7,  10,    0,   -6, 0 },  // 0xBC
+  {  1214,   8,   7,  10,    1,   -6, 0 },  // 0xBD
+  {  1221,   8,   7,  10,    1,   -6, 2 },  // 0xBE
+  {  1227,   8,   7,  10,    1,   -6, 0 },  // 0xBF
+  {  1234,   8,  11,  10,    1,  -10, 0 },  // 0xC0
+  {  1245,   8,   9,  10,    1,   -8, 0 }   // 0xC1
+};
+
+const RleFont CourierCyr8pt8bRle PROGMEM = {
+  CourierCyr8pt8bRleData,
+  CourierCyr8pt8bRleGlyphs,
+  0x20, 0xC1, 13 };
+
+#endif // COURIERCYR8PT8BRLE_H_
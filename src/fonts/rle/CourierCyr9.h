@@ -0,0 +1,305 @@
+// Generated by tools/font_rle.cpp from src/fonts/CourierCyr9.h, do not edit.
+// 162 glyphs (2 sharing another's bitmap), 1513 bytes of bitmap data (GFXfont: 1674)
+#ifndef COURIERCYR9PT8BRLE_H_
+#define COURIERCYR9PT8BRLE_H_
+
+const uint8_t CourierCyr9pt8bRleData[] PROGMEM = {
+  0x49, 0x24, 0x80, 0xFC, 0x99, 0x99, 0x90, 0x28, 0x50, 0xA7, 0xF4, 0x89,
+  0x12, 0x7F, 0x48, 0x91, 0x22, 0x40, 0x10, 0x21, 0xFE, 0x28, 0x50, 0x10,
+  0x1E, 0x03, 0x06, 0x1F, 0xC1, 0x02, 0x00, 0x13, 0x35, 0xF1, 0x71, 0x12,
+  0x62, 0x11, 0x7F, 0x15, 0x38, 0x22, 0x10, 0x08, 0x02, 0x02, 0x9A, 0x29,
+  0x08, 0xC4, 0x3D, 0xC0, 0x0A, 0x29, 0x49, 0x24, 0x91, 0x22, 0x89, 0x12,
+  0x49, 0x29, 0x28, 0x10, 0x23, 0x59, 0xC2, 0x8D, 0x80, 0x31, 0xF2, 0x31,
+  0x61, 0x3E, 0x69, 0x40, 0xFE, 0x09, 0x61, 0x52, 0xB2, 0xB2, 0xB2, 0xB2,
+  0xB2, 0x50, 0x23, 0x35, 0x12, 0x32, 0xFF, 0xC2, 0x32, 0x15, 0x10, 0x22,
+  0x33, 0x42, 0xFF, 0xF9, 0x31, 0x30, 0x3C, 0x8E, 0x08, 0x10, 0x20, 0x82,
+  0x08, 0x22, 0x87, 0xF8, 0x7A, 0x30, 0x41, 0x08, 0xE0, 0xC1, 0x06, 0x37,
+  0x80, 0x08, 0x70, 0xA2, 0x44, 0x91, 0x22, 0x7F, 0x08, 0x10, 0xF8, 0x16,
+  0x35, 0xF5, 0x34, 0x52, 0x23, 0x2F, 0x11, 0x59, 0x10, 0x1E, 0x41, 0x04,
+  0x0B, 0x98, 0xA0, 0xC1, 0x82, 0x88, 0xF0, 0x08, 0x15, 0x11, 0x81, 0xC2,
+  0xF6, 0x2F, 0x62, 0x30, 0x7D, 0x8E, 0x0C, 0x14, 0x47, 0x11, 0x41, 0x83,
+  0x8C, 0xE0, 0x78, 0x8A, 0x0C, 0x18, 0x28, 0xCE, 0x81, 0x04, 0x13, 0xC0,
+  0x09, 0x39, 0x77, 0x70, 0x06, 0x64, 0x80, 0x81, 0x53, 0x42, 0x52, 0x63,
+  0x92, 0x92, 0x92, 0x08, 0xF9, 0x80, 0x80, 0x38, 0x03, 0x00, 0x60, 0x38,
+  0x60, 0xC1, 0x80, 0x79, 0x0E, 0x08, 0x10, 0x43, 0x00, 0x00, 0x38, 0x70,
+  0x3E, 0x31, 0xB0, 0x50, 0x28, 0xF4, 0xCA, 0x45, 0x1F, 0x40, 0x31, 0x0F,
+  0x40, 0x3C, 0x01, 0x40, 0x28, 0x08, 0x81, 0x10, 0x42, 0x0F, 0xE1, 0x04,
+  0x40, 0x5E, 0x3C, 0x08, 0x22, 0x16, 0xF3, 0x15, 0x64, 0x68, 0x3F, 0x31,
+  0x12, 0x15, 0x11, 0x1C, 0xB1, 0xD0, 0x30, 0x18, 0x04, 0x02, 0x00, 0x80,
+  0x61, 0x8F, 0x00, 0xFE, 0x20, 0x90, 0x68, 0x14, 0x0A, 0x05, 0x02, 0x82,
+  0x43, 0x7F, 0x00, 0x0C, 0x16, 0xF2, 0x12, 0x13, 0x37, 0x3A, 0x1C, 0x1A,
+  0x21, 0x61, 0x0C, 0x16, 0xF2, 0x12, 0x13, 0x37, 0x3A, 0x1F, 0x82, 0x12,
+  0x50, 0x3D, 0x31, 0xB0, 0x50, 0x08, 0x04, 0x3E, 0x04, 0x82, 0x61, 0x1F,
+  0x00, 0xE3, 0xA0, 0x90, 0x48, 0x27, 0xF2, 0x09, 0x04, 0x82, 0x41, 0x71,
+  0xC0, 0x0A, 0x13, 0xFF, 0xF4, 0x31, 0x30, 0x27, 0x24, 0x12, 0xFC, 0x1F,
+  0xF1, 0x13, 0x51, 0x12, 0xF9, 0xC4, 0x10, 0x8C, 0x12, 0x02, 0x80, 0x6C,
+  0x08, 0x41, 0x08, 0x20, 0x9F, 0x1C, 0x05, 0x42, 0x12, 0xFF, 0xF3, 0x1F,
+  0x32, 0x15, 0x10, 0xE1, 0xD8, 0x65, 0x29, 0x4A, 0x54, 0x93, 0x24, 0x89,
+  0x02, 0x40, 0xBC, 0xF0, 0x04, 0x26, 0x42, 0x11, 0x32, 0xF4, 0x2F, 0x42,
+  0xF4, 0x22, 0x21, 0x25, 0x3E, 0x31, 0x90, 0x50, 0x18, 0x0C, 0x06, 0x02,
+  0x82, 0x63, 0x1F, 0x00, 0xFE, 0x10, 0xC8, 0x24, 0x12, 0x19, 0xF8, 0x80,
+  0x40, 0x20, 0x7C, 0x00, 0x3E, 0x31, 0x90, 0x50, 0x18, 0x0C, 0x06, 0x02,
+  0x82, 0x63, 0x1F, 0x04, 0x03, 0x82, 0x38, 0xFF, 0x04, 0x10, 0x82, 0x10,
+  0xC3, 0xF0, 0x44, 0x08, 0x41, 0x08, 0x20, 0x9F, 0x1C, 0x1E, 0xB0, 0xD0,
+  0x28, 0x02, 0x00, 0xF8, 0x03, 0x01, 0x41, 0xDF, 0x00, 0x09, 0x13, 0x13,
+  0xF4, 0x17, 0x1F, 0xF8, 0x21, 0x22, 0xF7, 0xA0, 0x90, 0x48, 0x24, 0x12,
+  0x09, 0x04, 0x82, 0x63, 0x1F, 0x00, 0xF1, 0xE8, 0x08, 0x82, 0x10, 0x42,
+  0x10, 0x22, 0x04, 0x80, 0x50, 0x0A, 0x01, 0x80, 0xE0, 0xE8, 0x09, 0x01,
+  0x26, 0x24, 0xC4, 0x95, 0x14, 0xA2, 0x8C, 0x31, 0x84, 0x10, 0xF3, 0xC8,
+  0x42, 0x20, 0x48, 0x0C, 0x03, 0x01, 0x20, 0x84, 0x40, 0xBC, 0xF0, 0xE3,
+  0xA0, 0x90, 0x84, 0x41, 0x40, 0x40, 0x20, 0x10, 0x08, 0x1F, 0x00, 0xFD,
+  0x0A, 0x20, 0x41, 0x04, 0x08, 0xA1, 0x83, 0xFC, 0x03, 0x12, 0xFF, 0x12,
+  0x01, 0xD2, 0xD2, 0x62, 0xD2, 0xD2, 0xD2, 0x05, 0xFF, 0x12, 0x10, 0x18,
+  0x3C, 0x66, 0x42, 0x81, 0x0B, 0xC2, 0x10, 0x3C, 0x21, 0x00, 0x8F, 0xCC,
+  0x24, 0x12, 0x18, 0xF7, 0x03, 0x72, 0xF7, 0x45, 0x64, 0x14, 0x2F, 0xF3,
+  0x14, 0x41, 0x61, 0x3D, 0x31, 0xA0, 0x50, 0x08, 0x04, 0x01, 0x86, 0x7C,
+  0x44, 0x63, 0xF0, 0x45, 0x63, 0x24, 0x1F, 0xF3, 0x24, 0x14, 0x61, 0x20,
+  0x3E, 0x30, 0xA0, 0x50, 0x1F, 0xFC, 0x01, 0x06, 0x7C, 0x35, 0x26, 0x82,
+  0x14, 0x12, 0x14, 0xFF, 0xB2, 0x14, 0x10, 0x3D, 0xD0, 0xC8, 0x12, 0x04,
+  0x81, 0x20, 0x44, 0x30, 0xF4, 0x01, 0x20, 0xC7, 0xE0, 0x03, 0x82, 0xFA,
+  0x36, 0x65, 0x2F, 0xFF, 0x52, 0x12, 0x12, 0x12, 0x22, 0xC2, 0x34, 0x33,
+  0xFF, 0x93, 0x13, 0x32, 0x8B, 0xFF, 0x91, 0x13, 0x11, 0xE0, 0x08, 0x02,
+  0x00, 0x9E, 0x22, 0x09, 0x03, 0x80, 0x90, 0x22, 0x08, 0x4E, 0x3C, 0x04,
+  0x33, 0xFF, 0xFF, 0x03, 0x13, 0xD9, 0x8C, 0xC9, 0x11, 0x22, 0x24, 0x44,
+  0x88, 0x91, 0x17, 0x33, 0xEF, 0x06, 0x10, 0x82, 0x10, 0x42, 0x08, 0x41,
+  0x08, 0x27, 0xDF, 0x3E, 0x21, 0xA0, 0x30, 0x18, 0x0C, 0x05, 0x0C, 0x7C,
+  0xEF, 0x0C, 0x22, 0x04, 0x81, 0x20, 0x48, 0x13, 0x08, 0xBC, 0x20, 0x08,
+  0x0F, 0xC0, 0x24, 0x13, 0x16, 0x14, 0x41, 0xFF, 0x32, 0x32, 0x46, 0x53,
+  0xF4, 0x31, 0x20, 0xE3, 0x96, 0x8C, 0x04, 0x02, 0x01, 0x00, 0x81, 0xFC,
+  0x7D, 0x0A, 0x16, 0x07, 0xC0, 0x60, 0xFE, 0x40, 0x40, 0xFE, 0x40, 0x40,
+  0x40, 0x40, 0x40, 0x61, 0x3E, 0xE3, 0x84, 0x10, 0x82, 0x10, 0x42, 0x08,
+  0x41, 0x0C, 0x60, 0xF7, 0xF3, 0xD0, 0x42, 0x10, 0x84, 0x12, 0x04, 0x80,
+  0xC0, 0x30, 0xE0, 0xE8, 0x09, 0x11, 0x26, 0x24, 0xA8, 0xA5, 0x0C, 0x61,
+  0x04, 0xF3, 0xC8, 0x41, 0x20, 0x30, 0x0C, 0x04, 0x82, 0x13, 0x87, 0xE1,
+  0xD0, 0x22, 0x10, 0x84, 0x12, 0x05, 0x00, 0xC0, 0x20, 0x08, 0x04, 0x0F,
+  0x80, 0xFF, 0x0A, 0x20, 0x82, 0x08, 0x60, 0xFF, 0x32, 0x23, 0xF5, 0x32,
+  0x11, 0x13, 0x1F, 0x53, 0x0C, 0xC1, 0x08, 0x42, 0x10, 0x66, 0x21, 0x08,
+  0x4C, 0x00, 0x13, 0x4A, 0x0A, 0x18, 0xFF, 0xFF, 0xF7, 0x81, 0xCF, 0x14,
+  0x22, 0x05, 0x01, 0x40, 0x48, 0x16, 0x09, 0x64, 0x46, 0x10, 0x0F, 0x80,
+  0x1F, 0x61, 0x81, 0x80, 0x80, 0x80, 0x41, 0x3E, 0xFF, 0xC4, 0x62, 0x31,
+  0x20, 0x80, 0x40, 0x20, 0x7C, 0xE1, 0xD0, 0x24, 0x10, 0x88, 0x22, 0x05,
+  0x00, 0xC0, 0x20, 0x08, 0x04, 0x0F, 0x80, 0x38, 0x04, 0x02, 0x07, 0xC4,
+  0x94, 0x4A, 0x23, 0x11, 0x88, 0xA4, 0x8A, 0x83, 0x80, 0x81, 0xF0, 0x71,
+  0xC8, 0x41, 0x20, 0x30, 0x0C, 0x04, 0x82, 0x13, 0xC7, 0x03, 0x25, 0x11,
+  0x22, 0x11, 0xFF, 0xF0, 0x11, 0x51, 0x9A, 0xE7, 0xA1, 0x10, 0x88, 0x43,
+  0xE0, 0x10, 0x08, 0x0F, 0xFF, 0xA4, 0x92, 0x49, 0x24, 0x92, 0x49, 0x25,
+  0xFF, 0x0A, 0x12, 0x12, 0x11, 0xFF, 0xF0, 0x11, 0x21, 0x21, 0x9A, 0x06,
+  0x52, 0x12, 0xE1, 0xD5, 0x56, 0xC1, 0x16, 0xE3, 0xC0, 0xA0, 0x50, 0x2F,
+  0xD4, 0x2A, 0x15, 0xFF, 0x04, 0x51, 0x12, 0xFA, 0x63, 0x79, 0x11, 0x70,
+  0xBC, 0x61, 0xA0, 0x40, 0x11, 0xF8, 0x08, 0x05, 0xFC, 0xEE, 0x28, 0x94,
+  0x2A, 0x16, 0x0A, 0x85, 0x43, 0xDE, 0x37, 0x26, 0x11, 0xF7, 0x66, 0x4C,
+  0x42, 0x21, 0x10, 0x3C, 0x01, 0x80, 0x28, 0x09, 0x01, 0x10, 0x42, 0x0F,
+  0xE1, 0x04, 0x40, 0x9E, 0x3C, 0x08, 0x11, 0x15, 0xF3, 0x13, 0x54, 0x68,
+  0x2F, 0x31, 0x17, 0x07, 0x21, 0x16, 0xF6, 0x63, 0x68, 0x2F, 0x31, 0x17,
+  0x0A, 0x16, 0xF3, 0x1F, 0xFF, 0x01, 0x13, 0x40, 0x18, 0x11, 0x13, 0x12,
+  0xFF, 0xF1, 0x2F, 0x01, 0x14, 0x12, 0x17, 0xA0, 0x0A, 0x16, 0xF0, 0x12,
+  0x11, 0x45, 0x49, 0x1B, 0x19, 0x11, 0x61, 0xDD, 0xA4, 0x8A, 0x85, 0x83,
+  0xE2, 0x51, 0x24, 0x92, 0x49, 0x4E, 0xC0, 0xFE, 0x42, 0x82, 0x02, 0x1C,
+  0x02, 0x01, 0x01, 0x81, 0x7E, 0xE3, 0xA1, 0x91, 0x49, 0x24, 0x92, 0x89,
+  0x44, 0xC2, 0x61, 0x61, 0xC0, 0x22, 0x0E, 0x38, 0xE8, 0x64, 0x52, 0x49,
+  0x24, 0xA2, 0x51, 0x30, 0x98, 0x58, 0x70, 0xF7, 0xA1, 0x11, 0x09, 0x05,
+  0x03, 0x61, 0x10, 0x84, 0x42, 0x78, 0xC0, 0x18, 0x11, 0x14, 0x11, 0xFF,
+  0xFF, 0x33, 0x22, 0x11, 0xE1, 0xEC, 0x31, 0x46, 0x29, 0x44, 0xA8, 0x99,
+  0x11, 0x22, 0x04, 0x40, 0x9E, 0x3C, 0x25, 0x37, 0x12, 0x52, 0xFF, 0xF0,
+  0x25, 0x21, 0x71, 0x0A, 0x15, 0x11, 0xFF, 0xFF, 0x31, 0x11, 0x22, 0x11,
+  0xFE, 0x41, 0x41, 0x41, 0x42, 0x7C, 0x40, 0x40, 0x40, 0xF0, 0x27, 0x16,
+  0x13, 0xE2, 0x81, 0xFC, 0x25, 0x12, 0x61, 0x10, 0xF1, 0xE8, 0x10, 0x82,
+  0x10, 0x81, 0x10, 0x14, 0x02, 0x80, 0x20, 0x04, 0x07, 0x00, 0x1C, 0x1F,
+  0x12, 0x51, 0x18, 0x8C, 0x46, 0x22, 0x92, 0x3E, 0x0E, 0x00, 0xE3, 0xA1,
+  0x09, 0x02, 0x80, 0x80, 0xC0, 0x90, 0x44, 0x41, 0x71, 0xC0, 0x03, 0x25,
+  0x11, 0x22, 0x11, 0xFF, 0xFF, 0x31, 0x15, 0x19, 0xA0, 0x03, 0x25, 0x11,
+  0x22, 0x11, 0xFD, 0x64, 0x5F, 0xA2, 0x11, 0x0A, 0x12, 0x12, 0x11, 0xFF,
+  0xFF, 0x31, 0x12, 0x12, 0x11, 0x0A, 0x12, 0x12, 0x11, 0xFF, 0xFF, 0x31,
+  0x12, 0x12, 0x19, 0xA0, 0x06, 0x52, 0x12, 0xE1, 0xD4, 0x65, 0x92, 0xF7,
+  0x11, 0x60, 0x04, 0x34, 0x12, 0x31, 0x11, 0xF6, 0x46, 0x68, 0x1F, 0x91,
+  0x16, 0x11, 0x04, 0x51, 0x12, 0xFA, 0x54, 0x68, 0x2F, 0x31, 0x17, 0x07,
+  0x37, 0xA1, 0x62, 0x35, 0x45, 0xF2, 0x38, 0x81, 0x03, 0x14, 0x11, 0x17,
+  0xF5, 0x2F, 0x12, 0xF6, 0x31, 0x52, 0x27, 0x16, 0x11, 0xF4, 0x28, 0x56,
+  0x34, 0x2E, 0x33, 0x11, 0x10, 0x24, 0x46, 0x31, 0x94, 0x36, 0x41, 0xF1,
+  0x90, 0x35, 0x27, 0x13, 0x93, 0x46, 0x41, 0x32, 0x21, 0xE2, 0x74, 0x87,
+  0x10, 0xFE, 0x10, 0x88, 0x44, 0x43, 0xD1, 0x08, 0x87, 0xFE, 0x18, 0x11,
+  0x15, 0xF3, 0x1F, 0xC2, 0x13, 0x30, 0x18, 0x11, 0x13, 0x12, 0xFF, 0x72,
+  0x61, 0x14, 0x12, 0x17, 0xA0, 0x34, 0x37, 0x13, 0xD2, 0x18, 0x17, 0x12,
+  0x88, 0xDD, 0xA4, 0x8A, 0x85, 0x85, 0xA2, 0x49, 0x25, 0x3B, 0xBC, 0x42,
+  0x43, 0x02, 0x0E, 0x01, 0x01, 0xFE, 0xE1, 0xA1, 0x91, 0x49, 0x24, 0x92,
+  0x89, 0x85, 0x87, 0x22, 0x0E, 0x00, 0x1C, 0x34, 0x32, 0x29, 0x24, 0x92,
+  0x51, 0x30, 0xB0, 0xE0, 0xF7, 0x22, 0x12, 0x0A, 0x06, 0x82, 0x21, 0x09,
+  0xEF, 0x7F, 0x91, 0x08, 0x84, 0x42, 0x21, 0x10, 0x89, 0x8F, 0xE0, 0xEC,
+  0x31, 0x46, 0x29, 0x44, 0xA8, 0x89, 0x10, 0x27, 0x8F, 0xE7, 0xA0, 0x90,
+  0x48, 0x27, 0xF2, 0x09, 0x05, 0xCF, 0x24, 0x47, 0x12, 0x41, 0x92, 0xF1,
+  0x48, 0x71, 0xFF, 0xA0, 0x90, 0x48, 0x24, 0x12, 0x09, 0x05, 0xCF, 0x12,
+  0x00, 0x3F, 0xE8, 0x14, 0x0A, 0x20, 0xF0, 0x88, 0x40, 0x20, 0x50, 0x3F,
+  0xF0, 0x36, 0x00, 0x07, 0x8C, 0x28, 0x14, 0x07, 0xFD, 0x00, 0x40, 0x1F,
+  0xC0 };
+
+const RleGlyph CourierCyr9pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,  11,    0,    1, 0 },  // 0x20 ' '
+  {     0,   3,  10,  11,    4,   -9, 0 },  // 0x21 '!'
+  {     4,   4,   5,  11,    3,   -9, 0 },  // 0x22 '"'
+  {     7,   7,  12,  11,    2,  -10, 0 },  // 0x23 '#'
+  {    18,   7,  14,  11,    2,  -11, 0 },  // 0x24 '$'
+  {    31,   7,  11,  11,    2,  -10, 2 },  // 0x25 '%'
+  {    40,   9,  10,  11,    1,   -9, 0 },  // 0x26 '&'
+  {    52,   2,   5,  11,    4,   -9, 1 },  // 0x27 '''
+  {    53,   3,  13,  11,    5,  -10, 0 },  // 0x28 '('
+  {    58,   3,  13,  11,    3,  -10, 0 },  // 0x29 ')'
+  {    63,   7,   6,  11,    2,  -10, 0 },  // 0x2A '*'
+  {    69,   7,   7,  11,    2,   -8, 2 },  // 0x2B '+'
+  {    74,   3,   4,  11,    4,   -1, 0 },  // 0x2C ','
+  {    76,   7,   1,  11,    2,   -4, 0 },  // 0x2D '-'
+  {    77,   3,   3,  11,    4,   -2, 1 },  // 0x2E '.'
+  {    78,   7,  12,  11,    2,  -10, 2 },  // 0x2F '/'
+  {    86,   7,  11,  11,    2,  -10, 2 },  // 0x30 '0'
+  {    95,   7,  11,  11,    2,  -10, 2 },  // 0x31 '1'
+  {   102,   7,  11,  11,    1,  -10, 0 },  // 0x32 '2'
+  {   112,   6,  11,  11,    2,  -10, 0 },  // 0x33 '3'
+  {   121,   7,  11,  11,    2,  -10, 0 },  // 0x34 '4'
+  {   131,   8,  11,  11,    1,  -10, 2 },  // 0x35 '5'
+  {   141,   7,  11,  11,    2,  -10, 0 },  // 0x36 '6'
+  {   151,   8,  11,  11,    1,  -10, 2 },  // 0x37 '7'
+  {   160,   7,  11,  11,    2,  -10, 0 },  // 0x38 '8'
+  {   170,   7,  11,  11,    2,  -10, 0 },  // 0x39 '9'
+  {   180,   3,   7,  11,    4,   -6, 1 },  // 0x3A ':'
+  {   182,   4,   9,  11,    3,   -6, 0 },  // 0x3B ';'
+  {   187,   9,   8,  11,    1,   -7, 1 },  // 0x3C '<'
+  {   195,   8,   5,  11,    1,   -7, 1 },  // 0x3D '='
+  {   198,   9,   8,  11,    1,   -7, 0 },  // 0x3E '>'
+  {   207,   7,  10,  11,    2,   -9, 0 },  // 0x3F '?'
+  {   216,   9,  11,  11,    1,  -10, 0 },  // 0x40 '@'
+  {   229,  11,  10,  11,    0,   -9, 0 },  // 0x41 'A'
+  {   243,  10,  10,  11,    0,   -9, 2 },  // 0x42 'B'
+  {   255,   9,  10,  11,    1,   -9, 0 },  // 0x43 'C'
+  {   267,   9,  10,  11,    1,   -9, 0 },  // 0x44 'D'
+  {   279,  10,  10,  11,    0,   -9, 2 },  // 0x45 'E'
+  {   290,  10,  10,  11,    0,   -9, 2 },  // 0x46 'F'
+  {   301,   9,  10,  11,    1,   -9, 0 },  // 0x47 'G'
+  {   313,   9,  10,  11,    1,   -9, 0 },  // 0x48 'H'
+  {   325,   7,  10,  11,    2,   -9, 2 },  // 0x49 'I'
+  {   331,   9,  10,  11,    1,   -9, 2 },  // 0x4A 'J'
+  {   340,  11,  10,  11,    0,   -9, 0 },  // 0x4B 'K'
+  {   354,   9,  10,  11,    1,   -9, 2 },  // 0x4C 'L'
+  {   363,  10,  10,  11,    0,   -9, 0 },  // 0x4D 'M'
+  {   376,  10,  10,  11,    0,   -9, 2 },  // 0x4E 'N'
+  {   388,   9,  10,  11,    1,   -9, 0 },  // 0x4F 'O'
+  {   400,   9,  10,  11,    1,   -9, 0 },  // 0x50 'P'
+  {   412,   9,  13,  11,    1,   -9, 0 },  // 0x51 'Q'
+  {   427,  11,  10,  11,    0,   -9, 0 },  // 0x52 'R'
+  {   441,   9,  10,  11,    1,   -9, 0 },  // 0x53 'S'
+  {   453,   9,  10,  11,    1,   -9, 2 },  // 0x54 'T'
+  {   462,   9,  10,  11,    1,   -9, 0 },  // 0x55 'U'
+  {   474,  11,  10,  11,    0,   -9, 0 },  // 0x56 'V'
+  {   488,  11,  10,  11,    0,   -9, 0 },  // 0x57 'W'
+  {   502,  10,  10,  11,    0,   -9, 0 },  // 0x58 'X'
+  {   515,   9,  10,  11,    1,   -9, 0 },  // 0x59 'Y'
+  {   527,   7,  10,  11,    2,   -9, 0 },  // 0x5A 'Z'
+  {   536,   3,  13,  11,    5,  -10, 2 },  // 0x5B '['
+  {   540,   7,  12,  11,    2,  -10, 2 },  // 0x5C
+  {   547,   3,  13,  11,    3,  -10, 2 },  // 0x5D ']'
+  {   551,   8,   5,  11,    1,  -10, 0 },  // 0x5E '^'
+  {   556,  11,   1,  11,    0,    2, 1 },  // 0x5F '_'
+  {   557,   4,   3,  11,    3,  -11, 0 },  // 0x60 '`'
+  {   559,   9,   8,  11,    1,   -7, 0 },  // 0x61 'a'
+  {   568,  10,  11,  11,    0,  -10, 2 },  // 0x62 'b'
+  {   579,   9,   8,  11,    1,   -7, 0 },  // 0x63 'c'
+  {   588,  10,  11,  11,    1,  -10, 2 },  // 0x64 'd'
+  {   600,   9,   8,  11,    1,   -7, 0 },  // 0x65 'e'
+  {   609,   8,  11,  11,    2,  -10, 2 },  // 0x66 'f'
+  {   619,  10,  11,  11,    1,   -7, 0 },  // 0x67 'g'
+  {   633,  11,  11,  11,    0,  -10, 2 },  // 0x68 'h'
+  {   644,   7,  11,  11,    2,  -10, 2 },  // 0x69 'i'
+  {   651,   5,  14,  11,    2,  -10, 2 },  // 0x6A 'j'
+  {   657,  10,  11,  11,    1,  -10, 0 },  // 0x6B 'k'
+  {   671,   7,  11,  11,    2,  -10, 2 },  // 0x6C 'l'
+  {   677,  11,   8,  11,    0,   -7, 0 },  // 0x6D 'm'
+  {   688,  11,   8,  11,    0,   -7, 0 },  // 0x6E 'n'
+  {   699,   9,   8,  11,    1,   -7, 0 },  // 0x6F 'o'
+  {   708,  10,  11,  11,    0,   -7, 0 },  // 0x70 'p'
+  {   722,  10,  11,  11,    1,   -7, 2 },  // 0x71 'q'
+  {   735,   9,   8,  11,    1,   -7, 0 },  // 0x72 'r'
+  {   744,   7,   8,  11,    2,   -7, 0 },  // 0x73 's'
+  {   751,   8,  10,  11,    1,   -9, 0 },  // 0x74 't'
+  {   761,  11,   8,  11,    0,   -7, 0 },  // 0x75 'u'
+  {   772,  10,   8,  11,    0,   -7, 0 },  // 0x76 'v'
+  {   782,  11,   8,  11,    0,   -7, 0 },  // 0x77 'w'
+  {   793,  10,   8,  11,    0,   -7, 0 },  // 0x78 'x'
+  {   803,  10,  11,  11,    0,   -7, 0 },  // 0x79 'y'
+  {   817,   7,   8,  11,    2,   -7, 0 },  // 0x7A 'z'
+  {   824,   5,  13,  11,    3,  -10, 2 },  // 0x7B '{'
+  {   832,   1,  12,  11,    5,  -10, 1 },  // 0x7C '|'
+  {   833,   5,  13,  11,    3,  -10, 0 },  // 0x7D '}'
+  {   842,   9,   2,  11,    1,   -4, 2 },  // 0x7E '~'
+  {   844,  10,  11,  14,    2,  -10, 2 },  // 0x7F
+  {   850,  10,  11,  11,    0,   -7, 0 },  // 0x80
+  {   864,   8,   8,  11,    1,   -7, 0 },  // 0x81
+  {   872,   9,   8,  11,    1,   -7, 0 },  // 0x82
+  {   881,  10,  11,  11,    0,   -7, 0 },  // 0x83
+  {   895,   9,  14,  11,    1,  -10, 0 },  // 0x84
+  {   911,  10,   8,  11,    0,   -7, 0 },  // 0x85
+  {   921,   9,  10,  11,    1,   -7, 2 },  // 0x86
+  {   931,   9,   8,  11,    1,   -7, 0 },  // 0x87
+  {   940,   9,   8,  11,    1,   -7, 0 },  // 0x88
+  {   949,   9,  10,  11,    1,   -7, 2 },  // 0x89
+  {   959,  10,   8,  11,    0,   -7, 2 },  // 0x8A
+  {   967,   9,   8,  11,    1,   -7, 0 },  // 0x8B
+  {   976,   9,   8,  11,    1,   -7, 2 },  // 0x8C
+  {   984,   9,   8,  11,    1,   -7, 0 },  // 0x8D
+  {   993,   9,   8,  11,    1,   -7, 0 },  // 0x8E
+  {  1002,  10,   8,  11,    0,   -7, 2 },  // 0x8F
+  {  1011,  11,  10,  11,    0,   -9, 0 },  // 0x90
+  {  1025,   9,  10,  11,    1,   -9, 2 },  // 0x91
+  {  1035,   9,  10,  11,    1,   -9, 2 },  // 0x92
+  {  1044,   9,  10,  11,    1,   -9, 2 },  // 0x93
+  {  1052,   9,  12,  11,    1,   -9, 2 },  // 0x94
+  {  1064,   9,  10,  11,    1,   -9, 2 },  // 0x95
+  {  1075,   9,  10,  11,    1,   -9, 0 },  // 0x96
+  {  1087,   8,  10,  11,    1,   -9, 0 },  // 0x97
+  {  1097,   9,  10,  11,    1,   -9, 0 },  // 0x98
+  {  1109,   9,  12,  11,    1,  -11, 0 },  // 0x99
+  {  1123,   9,  10,  11,    1,   -9, 0 },  // 0x9A
+  {  1135,   9,  10,  11,    1,   -9, 2 },  // 0x9B
+  {  1144,  11,  10,  11,    0,   -9, 0 },  // 0x9C
+  {   313,   9,  10,  11,    1,   -9, 0 },  // 0x9D
+  {  1158,   9,  10,  11,    1,   -9, 2 },  // 0x9E
+  {  1167,   9,  10,  11,    1,   -9, 2 },  // 0x9F
+  {  1176,   8,  10,  11,    2,   -9, 0 },  // 0xA0
+  {  1186,   9,  10,  11,    1,   -9, 2 },  // 0xA1
+  {   453,   9,  10,  11,    1,   -9, 2 },  // 0xA2
+  {  1196,  11,  10,  11,    0,   -9, 0 },  // 0xA3
+  {  1210,   9,  10,  11,    1,   -9, 0 },  // 0xA4
+  {  1222,   9,  10,  11,    1,   -9, 0 },  // 0xA5
+  {  1234,   9,  12,  11,    1,   -9, 2 },  // 0xA6
+  {  1245,   9,  10,  11,    1,   -9, 2 },  // 0xA7
+  {  1255,   9,  10,  11,    1,   -9, 2 },  // 0xA8
+  {  1265,   9,  12,  11,    1,   -9, 2 },  // 0xA9
+  {  1276,  10,  10,  11,    0,   -9, 2 },  // 0xAA
+  {  1286,  10,  10,  11,    0,   -9, 2 },  // 0xAB
+  {  1298,   9,  10,  11,    1,   -9, 2 },  // 0xAC
+  {  1307,   9,  10,  11,    1,   -9, 2 },  // 0xAD
+  {  1316,   9,  10,  11,    1,   -9, 2 },  // 0xAE
+  {  1326,   9,  10,  11,    1,   -9, 2 },  // 0xAF
+  {  1337,   9,   8,  11,    1,   -7, 2 },  // 0xB0
+  {  1345,   9,  11,  11,    1,  -10, 2 },  // 0xB1
+  {  1357,   9,   8,  11,    1,   -7, 0 },  // 0xB2
+  {  1366,   9,   8,  11,    1,   -7, 2 },  // 0xB3
+  {  1374,   9,  10,  11,    1,   -7, 2 },  // 0xB4
+  {  1385,   9,   8,  11,    1,   -7, 2 },  // 0xB5
+  {  1393,   9,   8,  11,    1,   -7, 0 },  // 0xB6
+  {  1402,   8,   8,  11,    1,   -7, 0 },  // 0xB7
+  {  1410,   9,   8,  11,    1,   -7, 0 },  // 0xB8
+  {  1419,   9,  11,  11,    1,  -10, 0 },  // 0xB9
+  {  1432,   9,   8,  11,    1,   -7, 0 },  // 0xBA
+  {  1441,   9,   8,  11,    1,   -7, 0 },  // 0xBB
+  {  1450,  11,   8,  11,    0,   -7, 0 },  // 0xBC
+  {  1461,   9,   8,  11,    1,   -7, 0 },  // 0xBD
+  {  1470,   9,   8,  11,    1,   -7, 2 },  // 0xBE
+  {  1478,   9,   8,  11,    1,   -7, 0 },  // 0xBF
+  {  1487,   9,  12,  11,    1,  -11, 0 },  // 0xC0
+  {  1501,   9,  10,  11,    1,   -9, 0 }   // 0xC1
+};
+
+const RleFont CourierCyr9pt8bRle PROGMEM = {
+  CourierCyr9pt8bRleData,
+  CourierCyr9pt8bRleGlyphs,
+  0x20, 0xC1, 15 };
+
+#endif // COURIERCYR9PT8BRLE_H_
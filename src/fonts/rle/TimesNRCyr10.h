@@ -0,0 +1,349 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr10.h, do not edit.
+// 162 glyphs (17 sharing another's bitmap), 2047 bytes of bitmap data (GFXfont: 2754)
+#ifndef TIMESNRCYR10PT8BRLE_H_
+#define TIMESNRCYR10PT8BRLE_H_
+
+const uint8_t TimesNRCyr10pt8bRleData[] PROGMEM = {
+  0xFF, 0xFF, 0xD0, 0xF0, 0xCF, 0x3C, 0xF3, 0x8E, 0x20, 0x41, 0x41, 0xF0,
+  0x23, 0x2C, 0x31, 0x41, 0x51, 0x41, 0x2D, 0x23, 0x2D, 0x21, 0x41, 0x51,
+  0x41, 0x3C, 0x23, 0x2E, 0x08, 0x08, 0x3E, 0x6B, 0xC9, 0xC9, 0xE8, 0x78,
+  0x3C, 0x0E, 0x0F, 0x0B, 0x8B, 0x8B, 0xCA, 0x7E, 0x08, 0x13, 0x81, 0x35,
+  0x62, 0xFE, 0x2D, 0x2F, 0x65, 0x32, 0x73, 0x32, 0x33, 0x72, 0x35, 0xF6,
+  0x2D, 0x2F, 0xE2, 0x65, 0x07, 0x00, 0x62, 0x01, 0x88, 0x06, 0x20, 0x19,
+  0x00, 0x39, 0xE0, 0xC3, 0x0D, 0x88, 0x43, 0x23, 0x0D, 0x0C, 0x1C, 0x30,
+  0x60, 0xE2, 0xE5, 0xF1, 0xE0, 0xFF, 0xE0, 0x08, 0x88, 0xC6, 0x63, 0x18,
+  0xC6, 0x31, 0x8C, 0x31, 0x84, 0x10, 0x40, 0x82, 0x08, 0x63, 0x0C, 0x63,
+  0x18, 0xC6, 0x31, 0x18, 0xC4, 0x44, 0x00, 0x10, 0x23, 0x5B, 0xE7, 0xDA,
+  0xC4, 0x08, 0x51, 0xFF, 0xF4, 0x51, 0xA1, 0x5F, 0xFE, 0xF5, 0x80, 0x0A,
+  0xF0, 0x51, 0xF4, 0x2F, 0x32, 0xF3, 0x2F, 0x32, 0xF3, 0x3C, 0x66, 0x46,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x62, 0x66, 0x1C, 0x26,
+  0xE6, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x3C, 0x23, 0x20, 0xC0, 0x60, 0x30,
+  0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x17, 0xFF, 0xF8, 0x38, 0xFA,
+  0x34, 0x60, 0xC3, 0x0F, 0x07, 0x06, 0x0C, 0x18, 0x3C, 0xCE, 0x00, 0x52,
+  0x61, 0xF1, 0x2F, 0x02, 0x62, 0xF0, 0x28, 0x42, 0x29, 0x52, 0x2F, 0x30,
+  0x1F, 0x3E, 0x20, 0x40, 0x78, 0xFE, 0x0E, 0x07, 0x03, 0x03, 0x03, 0x02,
+  0xC4, 0x78, 0x0E, 0x30, 0xC3, 0x06, 0x1B, 0xBB, 0x63, 0xC7, 0x8F, 0x1A,
+  0x36, 0xC7, 0x00, 0x16, 0x75, 0x12, 0xF9, 0x2F, 0x32, 0xFA, 0x23, 0x3C,
+  0x66, 0xC3, 0xC3, 0xC3, 0x66, 0x18, 0x2C, 0x46, 0xC3, 0xC3, 0xC3, 0x66,
+  0x3C, 0x38, 0xDB, 0x16, 0x3C, 0x78, 0xF1, 0xB3, 0x7E, 0x18, 0x30, 0xC3,
+  0x1C, 0x00, 0x04, 0xA4, 0xF0, 0x03, 0xD6, 0xA1, 0x82, 0x63, 0x62, 0x72,
+  0x81, 0xB2, 0xB2, 0xB3, 0xB2, 0xB1, 0x0B, 0xFF, 0x3B, 0x01, 0xB2, 0xB3,
+  0xB2, 0xB2, 0xB1, 0x82, 0x72, 0x63, 0x62, 0x81, 0xA0, 0x3C, 0x46, 0x83,
+  0xC3, 0xC3, 0x02, 0x04, 0x08, 0x08, 0x10, 0x10, 0x00, 0x18, 0x18, 0x03,
+  0xF0, 0x06, 0x06, 0x04, 0x01, 0x84, 0x00, 0x46, 0x00, 0x12, 0x0E, 0x8B,
+  0x0C, 0xC5, 0x0C, 0x42, 0x86, 0x21, 0x46, 0x31, 0x23, 0x18, 0x91, 0xB8,
+  0x88, 0x67, 0x8A, 0x00, 0x04, 0x80, 0x04, 0x60, 0x04, 0x08, 0x0C, 0x03,
+  0xF8, 0x00, 0x72, 0xFE, 0x21, 0x1F, 0xFD, 0x21, 0x11, 0x1F, 0xA2, 0x51,
+  0x94, 0xA7, 0xF1, 0x11, 0x15, 0x2D, 0x1B, 0x12, 0x12, 0x24, 0x23, 0x20,
+  0xFE, 0x0C, 0xC3, 0x18, 0xC6, 0x31, 0x8C, 0xC3, 0xE0, 0xC6, 0x30, 0xCC,
+  0x33, 0x0C, 0xC3, 0x31, 0xBF, 0xC0, 0x0F, 0x91, 0x87, 0x20, 0x36, 0x01,
+  0xC0, 0x1C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x60, 0x16, 0x02,
+  0x38, 0x40, 0xF8, 0x0A, 0x42, 0x25, 0x12, 0xB1, 0x21, 0xB1, 0xE1, 0x11,
+  0xFF, 0xFF, 0xF6, 0x11, 0x1A, 0x11, 0x1A, 0x11, 0x12, 0x22, 0x51, 0x13,
+  0x0B, 0x12, 0x25, 0xC1, 0xC1, 0xA1, 0xF3, 0x57, 0x5F, 0x91, 0xD1, 0xA1,
+  0xA1, 0x13, 0x25, 0x30, 0x0D, 0x25, 0xB1, 0xB1, 0x71, 0xF3, 0x38, 0x3F,
+  0x71, 0xFF, 0x62, 0x22, 0x50, 0x55, 0x21, 0x52, 0x53, 0x42, 0x72, 0x32,
+  0x91, 0x31, 0xD2, 0xD2, 0xD2, 0x78, 0x92, 0x22, 0x92, 0x32, 0x82, 0x42,
+  0x72, 0x52, 0x53, 0x76, 0x40, 0x06, 0x28, 0x22, 0x22, 0x22, 0xFF, 0xFF,
+  0x06, 0x86, 0xFF, 0xFF, 0xE2, 0x22, 0x22, 0x22, 0x08, 0x22, 0xFF, 0xFF,
+  0x62, 0x22, 0x36, 0x32, 0x22, 0xFF, 0xFF, 0xFF, 0x02, 0x41, 0x44, 0x30,
+  0x06, 0x35, 0x42, 0x62, 0x62, 0x52, 0x72, 0x42, 0x82, 0x31, 0xA2, 0x21,
+  0xB4, 0xC2, 0x12, 0xB2, 0x22, 0xA2, 0x33, 0x82, 0x43, 0x72, 0x53, 0x62,
+  0x64, 0x26, 0x37, 0x06, 0x62, 0x22, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x74,
+  0x26, 0x20, 0x04, 0xB5, 0x31, 0x91, 0x22, 0x11, 0xF5, 0x11, 0x17, 0x2F,
+  0xE1, 0x52, 0x91, 0xF6, 0x1F, 0x11, 0x52, 0xFF, 0x11, 0x11, 0x12, 0xFF,
+  0x31, 0x12, 0x82, 0x12, 0x82, 0x22, 0x04, 0x67, 0x21, 0x52, 0x12, 0x21,
+  0x21, 0xFD, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1D, 0x11, 0x1F, 0xD1, 0x11,
+  0xD1, 0x11, 0xD1, 0xF0, 0x14, 0x21, 0x29, 0x45, 0x62, 0x52, 0x41, 0x71,
+  0x32, 0x72, 0x12, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x12, 0x72, 0x31,
+  0x71, 0x51, 0x51, 0x75, 0x40, 0x09, 0x22, 0x24, 0x11, 0x91, 0x11, 0xFF,
+  0xB1, 0x11, 0x44, 0x11, 0x55, 0xFF, 0xF1, 0x22, 0x25, 0x45, 0x71, 0x52,
+  0x41, 0x71, 0x32, 0x72, 0x12, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x12,
+  0x72, 0x22, 0x71, 0x42, 0x51, 0x66, 0x93, 0xB3, 0xC3, 0xC3, 0xFF, 0x01,
+  0x8C, 0x0C, 0x30, 0x61, 0x83, 0x0C, 0x18, 0x60, 0xC6, 0x07, 0xC0, 0x36,
+  0x01, 0x98, 0x0C, 0x60, 0x61, 0x83, 0x0E, 0x7E, 0x3C, 0x3C, 0xB1, 0xF0,
+  0x78, 0x1E, 0x0B, 0x80, 0x70, 0x1C, 0x03, 0x40, 0xE0, 0x78, 0x3E, 0x34,
+  0xF0, 0x0C, 0x23, 0x23, 0x31, 0x81, 0x11, 0xA1, 0xFF, 0xFF, 0xFF, 0xF6,
+  0x22, 0x23, 0x06, 0x37, 0x22, 0x32, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0x11, 0x15, 0x25, 0x11, 0x63, 0x05, 0x36, 0x22, 0x31, 0x22, 0x11, 0x11,
+  0x61, 0xF8, 0x25, 0x11, 0x1F, 0xF7, 0x11, 0x11, 0x2F, 0xF4, 0x11, 0x2F,
+  0xF1, 0x05, 0x25, 0x45, 0x31, 0x21, 0x31, 0x41, 0x21, 0x11, 0x61, 0x91,
+  0xF8, 0x11, 0x16, 0x1F, 0x92, 0xFA, 0x11, 0x14, 0x11, 0x1F, 0x02, 0x52,
+  0x71, 0x11, 0x41, 0x11, 0xFF, 0x32, 0x52, 0x91, 0x61, 0xFC, 0x07, 0x35,
+  0x23, 0x62, 0x52, 0x61, 0x72, 0x41, 0x92, 0x21, 0xA4, 0xC2, 0xE2, 0xC1,
+  0x12, 0xA1, 0x22, 0x91, 0x42, 0x71, 0x62, 0x51, 0x73, 0x25, 0x46, 0x07,
+  0x35, 0x32, 0x71, 0x62, 0x51, 0x72, 0x51, 0x82, 0x31, 0xA1, 0x31, 0xA2,
+  0x11, 0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xB6, 0x40, 0x1B, 0x22, 0x62,
+  0x31, 0x62, 0x41, 0x52, 0xB2, 0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA2, 0x81,
+  0x22, 0x81, 0x12, 0x8E, 0x10, 0x05, 0x23, 0xFF, 0xFF, 0xF2, 0x30, 0x01,
+  0xE2, 0xF4, 0x2E, 0x2E, 0x25, 0x06, 0xFF, 0xFF, 0x22, 0x20, 0x10, 0x10,
+  0x28, 0x28, 0x44, 0x82, 0x82, 0x0A, 0xCC, 0x80, 0x7C, 0x63, 0x31, 0x81,
+  0xC3, 0x66, 0x33, 0x19, 0x9D, 0x77, 0x00, 0x60, 0x70, 0x18, 0x0C, 0x06,
+  0x03, 0x71, 0xCC, 0xC3, 0x61, 0xB0, 0xD8, 0x6C, 0x26, 0x31, 0xE0, 0x3E,
+  0x63, 0xC3, 0xC0, 0xC0, 0xC1, 0xC1, 0x62, 0x3C, 0x03, 0x03, 0x80, 0xC0,
+  0x60, 0x31, 0xD9, 0x9C, 0x86, 0xC3, 0x61, 0xB0, 0xD8, 0x66, 0x79, 0xD8,
+  0x3C, 0x66, 0xC3, 0xFF, 0xC0, 0xC0, 0xC1, 0x62, 0x3C, 0x1E, 0x23, 0x60,
+  0x60, 0x60, 0xF8, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xF8, 0x3C,
+  0x33, 0xD8, 0xCC, 0x63, 0x20, 0xF1, 0x80, 0xFE, 0x1F, 0xB0, 0x70, 0x3C,
+  0x27, 0xE0, 0x12, 0x61, 0x81, 0xFF, 0x03, 0x53, 0x11, 0x41, 0xFF, 0xF5,
+  0x12, 0x11, 0x12, 0x10, 0x66, 0x00, 0x06, 0xE6, 0x66, 0x66, 0x6F, 0x42,
+  0xA2, 0xF1, 0x22, 0x24, 0x2F, 0xFF, 0x52, 0x31, 0x23, 0x10, 0x22, 0x81,
+  0xA1, 0xFF, 0x74, 0x71, 0x12, 0x72, 0x73, 0xF4, 0x11, 0x19, 0x11, 0x19,
+  0x11, 0x12, 0x22, 0x32, 0x20, 0x12, 0x11, 0x31, 0xFF, 0xD1, 0x21, 0x6E,
+  0x73, 0xCE, 0x66, 0x31, 0x98, 0xC6, 0x63, 0x19, 0x8C, 0x66, 0x31, 0x98,
+  0xC6, 0xF7, 0xBC, 0x37, 0x1F, 0x30, 0xC6, 0x18, 0xC3, 0x18, 0x63, 0x0C,
+  0x61, 0x8C, 0xFB, 0xE0, 0x1E, 0x31, 0x90, 0xF8, 0x3C, 0x1E, 0x0F, 0x84,
+  0xC6, 0x3C, 0x00, 0x37, 0x3E, 0x63, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C,
+  0xE6, 0x37, 0x0C, 0x03, 0x00, 0xC0, 0xFC, 0x00, 0x3D, 0x31, 0xB0, 0xD8,
+  0x6C, 0x36, 0x1B, 0x0C, 0xC6, 0x3F, 0x01, 0x80, 0xC0, 0x60, 0xF8, 0x6F,
+  0xED, 0x83, 0x06, 0x0C, 0x18, 0x30, 0xF8, 0x7E, 0x38, 0x78, 0x78, 0x78,
+  0xF3, 0xB8, 0x00, 0x86, 0x3E, 0x61, 0x86, 0x18, 0x61, 0x86, 0x4E, 0xE7,
+  0x31, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xCF, 0x3B, 0x00, 0xF9, 0xDC,
+  0x23, 0x08, 0xC4, 0x19, 0x06, 0x81, 0xA0, 0x30, 0x0C, 0x00, 0xF7, 0x8C,
+  0xC6, 0x23, 0x18, 0x86, 0x74, 0x1A, 0xD0, 0x6B, 0x41, 0xA5, 0x03, 0x18,
+  0x0C, 0x60, 0xFB, 0x8C, 0x41, 0xA0, 0x30, 0x0C, 0x05, 0x81, 0x30, 0x86,
+  0xE3, 0xC0, 0xF1, 0xD8, 0x23, 0x10, 0xC4, 0x1A, 0x06, 0x80, 0xE0, 0x30,
+  0x04, 0x02, 0x00, 0x83, 0xC0, 0xE0, 0x00, 0x7F, 0x46, 0x4E, 0x0C, 0x18,
+  0x30, 0x71, 0x61, 0xFF, 0x41, 0x32, 0x22, 0xF7, 0x13, 0x11, 0x12, 0x15,
+  0x2F, 0xE2, 0x42, 0x0F, 0x40, 0x82, 0x08, 0x42, 0x10, 0x86, 0x18, 0x88,
+  0x42, 0x10, 0x84, 0x44, 0x00, 0x70, 0x39, 0xCE, 0x07, 0x00, 0x0A, 0x18,
+  0xFF, 0xFF, 0xFF, 0xC8, 0x10, 0x1C, 0x24, 0xFF, 0xFB, 0x15, 0x42, 0xA1,
+  0xFF, 0xE4, 0x14, 0x21, 0x13, 0x15, 0xE1, 0x91, 0xFA, 0x19, 0x19, 0x12,
+  0x11, 0x11, 0x11, 0x13, 0x12, 0x41, 0x45, 0x13, 0x2F, 0x41, 0x11, 0x50,
+  0x03, 0x33, 0x11, 0x51, 0x11, 0xFF, 0xFF, 0x11, 0x24, 0x11, 0x1A, 0xA0,
+  0x73, 0x88, 0x62, 0x18, 0x86, 0x33, 0x83, 0x60, 0x18, 0x06, 0x03, 0x80,
+  0x03, 0x33, 0x23, 0x11, 0x71, 0x21, 0x11, 0xFF, 0xFF, 0xFF, 0x11, 0x23,
+  0x24, 0x11, 0x10, 0x03, 0x33, 0x23, 0x11, 0x71, 0x21, 0x11, 0xFF, 0xFF,
+  0xFF, 0x11, 0x23, 0x24, 0x11, 0x1D, 0x11, 0xD1, 0x10, 0x7C, 0x01, 0x00,
+  0x20, 0x04, 0x00, 0xFC, 0x10, 0x82, 0x18, 0x46, 0x1F, 0x80, 0xE0, 0x73,
+  0x01, 0x18, 0x08, 0xC0, 0x47, 0xE2, 0x31, 0x91, 0x8C, 0x8C, 0x64, 0xFE,
+  0x70, 0xE0, 0x60, 0x60, 0x60, 0x7E, 0x63, 0x63, 0x63, 0xFE, 0x7C, 0x66,
+  0x43, 0x03, 0x1F, 0x03, 0x02, 0x86, 0x7C, 0xE3, 0x45, 0x21, 0x55, 0x11,
+  0x61, 0x51, 0x11, 0xF2, 0x2C, 0x2F, 0xD1, 0x11, 0x52, 0x51, 0x15, 0x10,
+  0x3F, 0x91, 0x98, 0xC6, 0x60, 0xF0, 0xD8, 0x4C, 0x66, 0x63, 0x80, 0x0A,
+  0x12, 0x25, 0xB1, 0xFF, 0x83, 0x86, 0x81, 0x21, 0x81, 0xF6, 0x1C, 0x11,
+  0x12, 0x41, 0x11, 0x0D, 0x26, 0xF7, 0x1F, 0xFF, 0xFF, 0xFA, 0x12, 0x16,
+  0x3B, 0x32, 0x14, 0x22, 0xFF, 0x22, 0xFF, 0xFF, 0xF6, 0x2F, 0xA2, 0xB1,
+  0x17, 0x21, 0x11, 0x29, 0x11, 0x21, 0x91, 0x21, 0xFA, 0x10, 0x71, 0xF8,
+  0xE7, 0x86, 0x1E, 0x08, 0x61, 0x00, 0x46, 0x20, 0x04, 0x62, 0x00, 0x46,
+  0x40, 0x03, 0x6C, 0x00, 0x3F, 0xC0, 0x06, 0x66, 0x00, 0xC6, 0x70, 0x0C,
+  0x63, 0x01, 0x86, 0x18, 0x18, 0x61, 0x87, 0x0F, 0x0E, 0xBE, 0x61, 0xA0,
+  0xD0, 0x60, 0x30, 0x38, 0xF8, 0x0C, 0x03, 0x01, 0xC0, 0xE0, 0x78, 0x33,
+  0xF0, 0x06, 0x38, 0x22, 0x32, 0x22, 0xA1, 0xFD, 0x2C, 0x2C, 0x2C, 0x2F,
+  0xC2, 0xC2, 0xD1, 0xFB, 0x12, 0x15, 0x12, 0x11, 0x41, 0x51, 0x91, 0x31,
+  0xD1, 0x11, 0x86, 0x58, 0x18, 0x22, 0x32, 0x22, 0xA1, 0xFD, 0x2C, 0x2C,
+  0x2C, 0x2F, 0xC2, 0xC2, 0xD1, 0xFB, 0x12, 0x15, 0x12, 0x11, 0x06, 0x43,
+  0x12, 0x22, 0x31, 0xC5, 0xF7, 0x2F, 0x93, 0xA1, 0x21, 0xA2, 0x21, 0xB1,
+  0xE1, 0x11, 0xE1, 0xB1, 0x21, 0x31, 0x21, 0x41, 0x21, 0x10, 0x3B, 0x32,
+  0x14, 0x22, 0xFF, 0xFF, 0xFF, 0xC2, 0xFF, 0x63, 0xB1, 0x22, 0x41, 0x21,
+  0x10, 0x0F, 0x22, 0x72, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x15, 0x12,
+  0x18, 0x11, 0x06, 0x45, 0x22, 0x81, 0x43, 0x61, 0x62, 0x61, 0x63, 0x41,
+  0x82, 0x41, 0x92, 0x31, 0x93, 0x11, 0xB2, 0x11, 0xB3, 0xD2, 0xD1, 0xA2,
+  0x21, 0xA4, 0x80, 0x56, 0xA2, 0x22, 0x84, 0x23, 0x56, 0x25, 0x21, 0xB1,
+  0x11, 0x31, 0xFD, 0x1F, 0xF1, 0x12, 0x1D, 0x1B, 0x11, 0x12, 0x62, 0x55,
+  0x42, 0x3A, 0x12, 0x16, 0x06, 0x38, 0x22, 0x31, 0x32, 0xA1, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x51, 0x27, 0x5B, 0x12, 0xC1, 0xF0, 0x1F, 0x10, 0x07,
+  0x18, 0x32, 0x12, 0x22, 0xFF, 0xFF, 0xC1, 0x52, 0x71, 0x15, 0x84, 0xFF,
+  0xFC, 0x12, 0x11, 0x05, 0x26, 0x27, 0x31, 0x22, 0x22, 0x22, 0x22, 0x11,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x85, 0x26, 0x21, 0x10,
+  0x05, 0x26, 0x27, 0x31, 0x22, 0x22, 0x22, 0x22, 0x11, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0x85, 0x26, 0x21, 0x2F, 0x22, 0x1F, 0x31,
+  0xF6, 0x1F, 0x70, 0x18, 0x73, 0x22, 0x52, 0xC1, 0xFF, 0xF3, 0x3B, 0x6B,
+  0x12, 0x1B, 0x1F, 0xFB, 0x11, 0x14, 0x12, 0x41, 0x11, 0x06, 0x68, 0x22,
+  0x62, 0x22, 0xFF, 0xFF, 0xF1, 0x3F, 0x06, 0xF0, 0x12, 0x1F, 0x01, 0xFF,
+  0x51, 0xF4, 0x18, 0x12, 0x41, 0x13, 0x12, 0x11, 0x06, 0x52, 0x22, 0xFF,
+  0xF8, 0x38, 0x68, 0x12, 0x18, 0x1F, 0x61, 0xC1, 0x11, 0x24, 0x11, 0x10,
+  0x01, 0x25, 0x54, 0x42, 0x32, 0x81, 0x21, 0x92, 0x11, 0xA1, 0xC2, 0x58,
+  0xB2, 0xB2, 0xB2, 0xA2, 0x11, 0x82, 0x32, 0x52, 0x65, 0x50, 0x06, 0x55,
+  0x42, 0x22, 0x39, 0xA1, 0x11, 0x51, 0x11, 0xFD, 0x19, 0x11, 0x19, 0x1F,
+  0xF4, 0x3F, 0x23, 0xFF, 0xA1, 0x11, 0x71, 0xF6, 0x18, 0x11, 0x15, 0x11,
+  0x12, 0x12, 0x14, 0x71, 0x12, 0x07, 0xF8, 0x63, 0x06, 0x18, 0x30, 0xC1,
+  0x86, 0x0C, 0x30, 0x31, 0x80, 0x7C, 0x03, 0x60, 0x33, 0x03, 0x18, 0x30,
+  0xC3, 0x86, 0x78, 0xFC, 0x1F, 0x9F, 0x90, 0x08, 0x08, 0x05, 0xF3, 0x0D,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x11, 0xF0, 0xFE, 0x63, 0x63, 0x66,
+  0x7E, 0x63, 0x63, 0x63, 0xFE, 0x16, 0x43, 0x81, 0xFF, 0xB1, 0x70, 0x36,
+  0x53, 0xFF, 0x52, 0xFC, 0x11, 0x43, 0xAA, 0x63, 0x9C, 0x4C, 0x81, 0x32,
+  0x02, 0xD0, 0x0F, 0xE0, 0x6D, 0x81, 0x33, 0x0C, 0xC4, 0x63, 0x98, 0x00,
+  0x7E, 0x82, 0x06, 0x0C, 0x0C, 0x02, 0x03, 0x83, 0x7E, 0xE3, 0x98, 0x46,
+  0x31, 0x94, 0x69, 0x1C, 0x46, 0x11, 0x84, 0xE3, 0x80, 0x21, 0x08, 0xC3,
+  0x60, 0x20, 0x00, 0x38, 0xE6, 0x11, 0x8C, 0x65, 0x1A, 0x47, 0x11, 0x84,
+  0x61, 0x38, 0xE0, 0xE3, 0xB2, 0x19, 0x0D, 0x07, 0xC3, 0x61, 0x98, 0xC4,
+  0xE3, 0x00, 0x27, 0x31, 0x13, 0xFF, 0xF8, 0x11, 0x27, 0x14, 0x13, 0xE0,
+  0xE6, 0x0C, 0x71, 0x45, 0x14, 0x5A, 0x45, 0xA4, 0x4C, 0x44, 0xC4, 0xC4,
+  0xE0, 0xE3, 0x98, 0x46, 0x11, 0x84, 0x7F, 0x18, 0x46, 0x11, 0x84, 0xE3,
+  0x80, 0x09, 0x11, 0x24, 0x11, 0xFF, 0xFF, 0x11, 0x51, 0x11, 0x10, 0x22,
+  0x32, 0xF2, 0x23, 0x23, 0xB1, 0x22, 0x6F, 0x91, 0xA1, 0xF3, 0x57, 0x5F,
+  0x91, 0xFA, 0x1A, 0x21, 0x12, 0x62, 0x64, 0xD8, 0x00, 0x00, 0x0F, 0xA1,
+  0xC3, 0xF9, 0x02, 0x06, 0x1E, 0x6F, 0x80 };
+
+const RleGlyph TimesNRCyr10pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   5,    0,    1, 0 },  // 0x20 ' '
+  {     0,   2,  14,   5,    2,  -13, 0 },  // 0x21 '!'
+  {     4,   6,   6,   8,    1,  -13, 0 },  // 0x22 '"'
+  {     9,  11,  14,  13,    1,  -13, 2 },  // 0x23 '#'
+  {    28,   8,  17,  10,    1,  -15, 0 },  // 0x24 '$'
+  {    45,  16,  14,  16,    0,  -13, 2 },  // 0x25 '%'
+  {    64,  14,  14,  15,    1,  -13, 0 },  // 0x26 '&'
+  {    89,   2,   6,   4,    1,  -13, 0 },  // 0x27 '''
+  {    91,   5,  18,   7,    1,  -13, 0 },  // 0x28 '('
+  {   103,   5,  18,   7,    1,  -13, 0 },  // 0x29 ')'
+  {   115,   7,   8,  10,    2,  -13, 0 },  // 0x2A '*'
+  {   122,  11,  11,  13,    1,  -11, 2 },  // 0x2B '+'
+  {   129,   2,   5,   5,    2,   -1, 0 },  // 0x2C ','
+  {   131,   5,   2,   7,    1,   -5, 1 },  // 0x2D '-'
+  {   132,   2,   2,   5,    2,   -1, 0 },  // 0x2E '.'
+  {   133,   7,  15,   6,    0,  -13, 2 },  // 0x2F '/'
+  {   141,   8,  14,  10,    1,  -13, 0 },  // 0x30 '0'
+  {   155,   4,  14,  10,    3,  -13, 0 },  // 0x31 '1'
+  {   162,   9,  14,  10,    0,  -13, 0 },  // 0x32 '2'
+  {   178,   7,  14,  10,    1,  -13, 0 },  // 0x33 '3'
+  {   191,   9,  14,  10,    0,  -13, 2 },  // 0x34 '4'
+  {   204,   8,  14,  10,    1,  -13, 0 },  // 0x35 '5'
+  {   218,   7,  14,  10,    1,  -13, 0 },  // 0x36 '6'
+  {   231,   7,  14,  10,    1,  -13, 2 },  // 0x37 '7'
+  {   239,   8,  14,  10,    1,  -13, 0 },  // 0x38 '8'
+  {   253,   7,  14,  10,    1,  -13, 0 },  // 0x39 '9'
+  {   266,   2,   9,   5,    2,   -8, 1 },  // 0x3A ':'
+  {   268,   2,  12,   5,    2,   -8, 0 },  // 0x3B ';'
+  {   271,  11,  11,  13,    1,  -12, 1 },  // 0x3C '<'
+  {   282,  11,   5,  13,    1,   -8, 1 },  // 0x3D '='
+  {   285,  11,  11,  13,    1,  -12, 1 },  // 0x3E '>'
+  {   297,   8,  14,   8,    0,  -13, 0 },  // 0x3F '?'
+  {   311,  17,  18,  18,    1,  -13, 0 },  // 0x40 '@'
+  {   350,  16,  14,  15,   -1,  -13, 2 },  // 0x41 'A'
+  {   372,  10,  14,  13,    1,  -13, 0 },  // 0x42 'B'
+  {   390,  12,  14,  14,    1,  -13, 0 },  // 0x43 'C'
+  {   411,  14,  14,  16,    1,  -13, 2 },  // 0x44 'D'
+  {   432,  12,  14,  13,    1,  -13, 2 },  // 0x45 'E'
+  {   448,  11,  14,  13,    1,  -13, 2 },  // 0x46 'F'
+  {   461,  15,  14,  16,    1,  -13, 1 },  // 0x47 'G'
+  {   485,  14,  14,  16,    1,  -13, 2 },  // 0x48 'H'
+  {   500,   6,  14,   8,    1,  -13, 2 },  // 0x49 'I'
+  {   506,   9,  14,   9,    0,  -13, 2 },  // 0x4A 'J'
+  {   516,  16,  14,  16,    1,  -13, 1 },  // 0x4B 'K'
+  {   543,  12,  14,  13,    1,  -13, 2 },  // 0x4C 'L'
+  {   554,  19,  14,  20,    1,  -13, 2 },  // 0x4D 'M'
+  {   582,  15,  14,  16,    0,  -13, 2 },  // 0x4E 'N'
+  {   607,  13,  14,  15,    1,  -13, 1 },  // 0x4F 'O'
+  {   629,  11,  14,  12,    1,  -13, 2 },  // 0x50 'P'
+  {   645,  13,  18,  15,    1,  -13, 1 },  // 0x51 'Q'
+  {   670,  13,  14,  15,    1,  -13, 0 },  // 0x52 'R'
+  {   693,   9,  14,  11,    1,  -13, 0 },  // 0x53 'S'
+  {   709,  12,  14,  12,    0,  -13, 2 },  // 0x54 'T'
+  {   722,  14,  14,  16,    1,  -13, 2 },  // 0x55 'U'
+  {   737,  13,  14,  13,    0,  -13, 2 },  // 0x56 'V'
+  {   757,  20,  14,  20,    0,  -13, 2 },  // 0x57 'W'
+  {   790,  15,  14,  15,    0,  -13, 1 },  // 0x58 'X'
+  {   815,  15,  14,  15,    0,  -13, 1 },  // 0x59 'Y'
+  {   837,  13,  14,  13,    0,  -13, 1 },  // 0x5A 'Z'
+  {   857,   5,  18,   5,    1,  -13, 2 },  // 0x5B '['
+  {   863,   5,  15,   6,    1,  -13, 2 },  // 0x5C
+  {   869,   4,  18,   5,    0,  -13, 2 },  // 0x5D ']'
+  {   874,   8,   7,  12,    2,  -13, 0 },  // 0x5E '^'
+  {   881,  10,   1,  10,    0,    3, 1 },  // 0x5F '_'
+  {   882,   3,   3,   7,    2,  -13, 0 },  // 0x60 '`'
+  {   884,   9,   9,  10,    1,   -8, 0 },  // 0x61 'a'
+  {   895,   9,  14,  11,    1,  -13, 0 },  // 0x62 'b'
+  {   911,   8,   9,   9,    1,   -8, 0 },  // 0x63 'c'
+  {   920,   9,  14,  11,    1,  -13, 0 },  // 0x64 'd'
+  {   936,   8,   9,   9,    1,   -8, 0 },  // 0x65 'e'
+  {   945,   8,  14,   7,    1,  -13, 0 },  // 0x66 'f'
+  {   959,   9,  13,  10,    0,   -8, 0 },  // 0x67 'g'
+  {   974,   9,  14,  11,    1,  -13, 2 },  // 0x68 'h'
+  {   988,   4,  14,   6,    1,  -13, 0 },  // 0x69 'i'
+  {   995,   6,  18,   6,   -2,  -13, 2 },  // 0x6A 'j'
+  {  1006,  11,  14,  11,    0,  -13, 2 },  // 0x6B 'k'
+  {  1025,   4,  14,   6,    1,  -13, 2 },  // 0x6C 'l'
+  {  1031,  14,   9,  16,    1,   -8, 0 },  // 0x6D 'm'
+  {  1047,  11,   9,  11,    0,   -8, 0 },  // 0x6E 'n'
+  {  1060,   9,   9,  11,    1,   -8, 0 },  // 0x6F 'o'
+  {  1071,  10,  13,  11,    0,   -8, 0 },  // 0x70 'p'
+  {  1088,   9,  13,  11,    1,   -8, 0 },  // 0x71 'q'
+  {  1103,   7,   9,   8,    1,   -8, 0 },  // 0x72 'r'
+  {  1111,   6,   9,   8,    1,   -8, 0 },  // 0x73 's'
+  {  1118,   6,  12,   7,    1,  -11, 0 },  // 0x74 't'
+  {  1127,   9,   9,  11,    1,   -8, 0 },  // 0x75 'u'
+  {  1138,  10,   9,  10,    0,   -8, 0 },  // 0x76 'v'
+  {  1150,  14,   9,  14,    0,   -8, 0 },  // 0x77 'w'
+  {  1166,  10,   9,  10,    0,   -8, 0 },  // 0x78 'x'
+  {  1178,  10,  13,  10,    0,   -8, 0 },  // 0x79 'y'
+  {  1195,   8,   9,   9,    0,   -8, 0 },  // 0x7A 'z'
+  {  1204,   5,  18,  10,    3,  -13, 2 },  // 0x7B '{'
+  {  1215,   1,  19,   4,    1,  -13, 1 },  // 0x7C '|'
+  {  1217,   5,  18,  10,    2,  -13, 0 },  // 0x7D '}'
+  {  1229,  11,   3,  13,    1,   -7, 0 },  // 0x7E '~'
+  {  1234,  10,  13,  15,    3,  -12, 2 },  // 0x7F
+  {  1071,  10,  13,  11,    0,   -8, 0 },  // 0x80
+  {   911,   8,   9,   9,    1,   -8, 0 },  // 0x81
+  {  1241,   9,   9,  10,    0,   -8, 2 },  // 0x82
+  {  1178,  10,  13,  10,    0,   -8, 0 },  // 0x83
+  {  1246,  12,  18,  13,    1,  -13, 2 },  // 0x84
+  {  1166,  10,   9,  10,    0,   -8, 0 },  // 0x85
+  {  1272,  10,  11,  11,    1,   -8, 2 },  // 0x86
+  {  1284,  10,   9,  11,    0,   -8, 0 },  // 0x87
+  {  1296,  15,   9,  16,    1,   -8, 2 },  // 0x88
+  {  1311,  15,  11,  16,    1,   -8, 2 },  // 0x89
+  {  1329,  11,   9,  11,    0,   -8, 0 },  // 0x8A
+  {  1342,  13,   9,  14,    1,   -8, 0 },  // 0x8B
+  {  1357,   8,   9,  10,    1,   -8, 0 },  // 0x8C
+  {  1366,   8,   9,   9,    0,   -8, 0 },  // 0x8D
+  {  1375,  14,  10,  16,    1,   -9, 2 },  // 0x8E
+  {  1392,   9,   9,  10,    0,   -8, 0 },  // 0x8F
+  {   350,  16,  14,  15,   -1,  -13, 2 },  // 0x90
+  {  1403,  11,  14,  13,    1,  -13, 2 },  // 0x91
+  {   372,  10,  14,  13,    1,  -13, 0 },  // 0x92
+  {  1419,  11,  14,  13,    1,  -13, 2 },  // 0x93
+  {  1428,  14,  18,  15,    0,  -13, 2 },  // 0x94
+  {   432,  12,  14,  13,    1,  -13, 2 },  // 0x95
+  {  1450,  20,  14,  20,    0,  -13, 0 },  // 0x96
+  {  1485,   9,  14,  11,    1,  -13, 0 },  // 0x97
+  {  1501,  15,  14,  16,    1,  -13, 2 },  // 0x98
+  {  1520,  15,  18,  16,    1,  -17, 2 },  // 0x99
+  {  1546,  14,  14,  15,    1,  -13, 2 },  // 0x9A
+  {  1570,  14,  14,  15,    0,  -13, 2 },  // 0x9B
+  {   554,  19,  14,  20,    1,  -13, 2 },  // 0x9C
+  {   485,  14,  14,  16,    1,  -13, 2 },  // 0x9D
+  {   607,  13,  14,  15,    1,  -13, 1 },  // 0x9E
+  {  1585,  15,  14,  16,    1,  -13, 2 },  // 0x9F
+  {   629,  11,  14,  12,    1,  -13, 2 },  // 0xA0
+  {   390,  12,  14,  14,    1,  -13, 0 },  // 0xA1
+  {   709,  12,  14,  12,    0,  -13, 2 },  // 0xA2
+  {  1598,  15,  14,  15,    0,  -13, 1 },  // 0xA3
+  {  1623,  16,  14,  17,    1,  -13, 2 },  // 0xA4
+  {   790,  15,  14,  15,    0,  -13, 1 },  // 0xA5
+  {  1648,  15,  18,  16,    1,  -13, 2 },  // 0xA6
+  {  1667,  14,  14,  15,    0,  -13, 2 },  // 0xA7
+  {  1683,  21,  14,  22,    1,  -13, 2 },  // 0xA8
+  {  1704,  21,  18,  22,    1,  -13, 2 },  // 0xA9
+  {  1731,  14,  14,  15,    0,  -13, 2 },  // 0xAA
+  {  1749,  18,  14,  20,    1,  -13, 2 },  // 0xAB
+  {  1772,  11,  14,  13,    1,  -13, 2 },  // 0xAC
+  {  1788,  13,  14,  14,    0,  -13, 1 },  // 0xAD
+  {  1810,  20,  14,  22,    1,  -13, 2 },  // 0xAE
+  {  1841,  13,  14,  15,    1,  -13, 0 },  // 0xAF
+  {   884,   9,   9,  10,    1,   -8, 0 },  // 0xB0
+  {  1864,   9,  14,  11,    1,  -13, 0 },  // 0xB1
+  {  1880,   8,   9,  10,    1,   -8, 0 },  // 0xB2
+  {  1889,   8,   9,   9,    1,   -8, 2 },  // 0xB3
+  {  1895,  10,  11,  11,    0,   -8, 2 },  // 0xB4
+  {   936,   8,   9,   9,    1,   -8, 0 },  // 0xB5
+  {  1903,  14,   9,  14,    0,   -8, 0 },  // 0xB6
+  {  1919,   8,  10,   8,    0,   -9, 0 },  // 0xB7
+  {  1929,  10,   9,  11,    1,   -8, 0 },  // 0xB8
+  {  1941,  10,  14,  11,    1,  -13, 0 },  // 0xB9
+  {  1959,   9,   9,  11,    1,   -8, 0 },  // 0xBA
+  {  1970,  10,   9,  11,    0,   -8, 2 },  // 0xBB
+  {  1979,  12,   9,  13,    1,   -8, 0 },  // 0xBC
+  {  1993,  10,   9,  11,    1,   -8, 0 },  // 0xBD
+  {  1060,   9,   9,  11,    1,   -8, 0 },  // 0xBE
+  {  2005,  10,   9,  11,    1,   -8, 2 },  // 0xBF
+  {  2015,  12,  17,  13,    1,  -16, 2 },  // 0xC0
+  {  2034,   7,  14,   9,    1,  -13, 0 }   // 0xC1
+};
+
+const RleFont TimesNRCyr10pt8bRle PROGMEM = {
+  TimesNRCyr10pt8bRleData,
+  TimesNRCyr10pt8bRleGlyphs,
+  0x20, 0xC1, 22 };
+
+#endif // TIMESNRCYR10PT8BRLE_H_
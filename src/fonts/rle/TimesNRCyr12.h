@@ -0,0 +1,403 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr12.h, do not edit.
+// 162 glyphs (17 sharing another's bitmap), 2697 bytes of bitmap data (GFXfont: 3946)
+#ifndef TIMESNRCYR12PT8BRLE_H_
+#define TIMESNRCYR12PT8BRLE_H_
+
+const uint8_t TimesNRCyr12pt8bRleData[] PROGMEM = {
+  0x0F, 0x71, 0x14, 0x60, 0xCF, 0x3C, 0xF3, 0xCE, 0x18, 0x80, 0x51, 0x61,
+  0xFF, 0x62, 0x52, 0xF2, 0x41, 0x61, 0x71, 0x61, 0x3F, 0x32, 0x52, 0xFF,
+  0x33, 0x16, 0x17, 0x16, 0x14, 0xF2, 0x25, 0x2F, 0xF4, 0x08, 0x08, 0x3E,
+  0x6B, 0xC9, 0xC9, 0xC9, 0xE8, 0x78, 0x38, 0x1C, 0x0E, 0x0F, 0x0B, 0x8B,
+  0x8B, 0xCB, 0xEE, 0x7C, 0x08, 0x08, 0x22, 0x91, 0x54, 0xD2, 0x22, 0x62,
+  0xFF, 0x32, 0xF0, 0x26, 0x22, 0x2D, 0x44, 0x29, 0x24, 0x2F, 0x72, 0x92,
+  0x44, 0x72, 0x42, 0x22, 0xF8, 0x2F, 0xF3, 0x26, 0x22, 0x23, 0x28, 0x41,
+  0x03, 0xC0, 0x01, 0x98, 0x00, 0xC2, 0x00, 0x30, 0x80, 0x0C, 0x20, 0x03,
+  0x10, 0x00, 0x69, 0xF8, 0x1C, 0x38, 0x1B, 0x0C, 0x08, 0xE2, 0x06, 0x18,
+  0x83, 0x07, 0x40, 0xC0, 0xF0, 0x30, 0x38, 0x0E, 0x07, 0x05, 0xC6, 0xE2,
+  0x3E, 0x0F, 0x00, 0xFF, 0xF8, 0x04, 0x21, 0x0C, 0x21, 0x84, 0x30, 0xC3,
+  0x0C, 0x30, 0xC3, 0x0C, 0x10, 0x60, 0x83, 0x04, 0x08, 0x10, 0x81, 0x02,
+  0x0C, 0x10, 0x60, 0x83, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC2, 0x18, 0x43,
+  0x08, 0x42, 0x00, 0x08, 0x04, 0x32, 0x7D, 0x73, 0xE0, 0xF3, 0xAF, 0x93,
+  0x08, 0x04, 0x00, 0x62, 0xFF, 0xFF, 0xF1, 0x62, 0x6E, 0x62, 0x6F, 0xFF,
+  0xFA, 0xDE, 0x92, 0xA0, 0x0C, 0x09, 0x51, 0xF4, 0x2F, 0x32, 0xF3, 0x2F,
+  0x32, 0xFA, 0x2C, 0x1E, 0x0C, 0xC6, 0x19, 0x86, 0xC0, 0xB0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0x98, 0x66, 0x18, 0xCC, 0x1E,
+  0x00, 0x31, 0x32, 0x31, 0x52, 0xFF, 0xFF, 0xF1, 0x22, 0x20, 0x1E, 0x0F,
+  0xC6, 0x79, 0x0E, 0x81, 0x80, 0x60, 0x18, 0x04, 0x03, 0x00, 0x80, 0x40,
+  0x20, 0x10, 0x04, 0x02, 0x05, 0xFE, 0xFF, 0x80, 0x1C, 0x1F, 0x11, 0xC8,
+  0x60, 0x30, 0x10, 0x18, 0x1C, 0x1F, 0x03, 0xC0, 0xE0, 0x30, 0x18, 0x0C,
+  0x05, 0x84, 0xFC, 0x00, 0x62, 0xF2, 0x18, 0x2F, 0x22, 0xF2, 0x27, 0x2F,
+  0x22, 0x95, 0x22, 0xA6, 0x22, 0xFF, 0x00, 0x46, 0x36, 0x41, 0x81, 0x82,
+  0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x82, 0x12, 0x41,
+  0x45, 0x40, 0x03, 0x86, 0x06, 0x06, 0x06, 0x03, 0x01, 0x79, 0xC6, 0xC3,
+  0xE0, 0xF0, 0x78, 0x3C, 0x1A, 0x0D, 0x84, 0x66, 0x1C, 0x00, 0x18, 0x91,
+  0x15, 0x11, 0x11, 0x71, 0xE2, 0xFF, 0x32, 0xFF, 0x32, 0xF9, 0x24, 0x3E,
+  0x31, 0xB0, 0x78, 0x3C, 0x1F, 0x09, 0xCC, 0x7C, 0x1C, 0x13, 0x10, 0xD8,
+  0x7C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00, 0x1C, 0x33, 0x10, 0xD8, 0x2C,
+  0x1E, 0x0F, 0x07, 0x83, 0xE1, 0xB1, 0xCF, 0x40, 0x60, 0x20, 0x30, 0x30,
+  0x70, 0xE0, 0x00, 0x09, 0xF0, 0x90, 0xFF, 0x80, 0x00, 0xDE, 0x92, 0xA0,
+  0xC1, 0xA2, 0x92, 0x83, 0x82, 0x92, 0xA1, 0xD2, 0xD2, 0xD3, 0xD2, 0xD2,
+  0xD1, 0x0F, 0x9F, 0xFF, 0x3F, 0x90, 0x01, 0xD2, 0xD2, 0xD3, 0xD2, 0xD2,
+  0xD1, 0xA2, 0x92, 0x83, 0x82, 0x92, 0xA1, 0xC0, 0x38, 0x9A, 0x1C, 0x3C,
+  0x78, 0xC3, 0x06, 0x08, 0x20, 0x40, 0x80, 0x00, 0x0C, 0x18, 0x30, 0x00,
+  0xFC, 0x00, 0x70, 0x30, 0x0C, 0x01, 0x81, 0x00, 0x0C, 0x30, 0x00, 0x42,
+  0x00, 0x02, 0x40, 0x7C, 0x24, 0x0C, 0xC2, 0x81, 0x88, 0x28, 0x30, 0x82,
+  0x83, 0x08, 0x28, 0x61, 0x84, 0x86, 0x18, 0x48, 0x67, 0x08, 0x86, 0x91,
+  0x04, 0x31, 0xE1, 0x40, 0x00, 0x22, 0x00, 0x06, 0x30, 0x00, 0xC1, 0x80,
+  0x18, 0x06, 0x07, 0x00, 0x1F, 0x80, 0x72, 0xFF, 0x41, 0xD2, 0xFF, 0x12,
+  0x11, 0x11, 0xFF, 0x41, 0x92, 0x31, 0xFE, 0x52, 0x17, 0x8F, 0x41, 0x52,
+  0x71, 0xF8, 0x1C, 0x12, 0x12, 0x25, 0x23, 0x20, 0x09, 0x42, 0x24, 0x12,
+  0xA1, 0xD1, 0x11, 0xFF, 0x61, 0x11, 0x91, 0x11, 0x64, 0x11, 0x74, 0x12,
+  0xA2, 0x11, 0xB1, 0x11, 0xFF, 0x61, 0xB1, 0x23, 0x25, 0x12, 0x10, 0x56,
+  0x21, 0x32, 0x54, 0x22, 0x82, 0x21, 0x92, 0x12, 0xA1, 0x11, 0xC2, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xD2, 0xC2, 0xA1, 0x22, 0x81, 0x43, 0x42, 0x75,
+  0x40, 0x0C, 0x52, 0x26, 0x22, 0xD2, 0x21, 0xE1, 0xF2, 0x11, 0x1F, 0xF2,
+  0x11, 0x1F, 0xFF, 0xFF, 0x71, 0x11, 0xFF, 0x01, 0x11, 0xD1, 0xE2, 0x12,
+  0x22, 0x26, 0x12, 0x40, 0x0D, 0x12, 0x27, 0xE1, 0xFD, 0x1F, 0xB1, 0xC1,
+  0x76, 0x86, 0xE1, 0xE1, 0xFE, 0x1C, 0x1C, 0x11, 0x32, 0x73, 0x0F, 0x12,
+  0x8E, 0x1F, 0xD1, 0xF9, 0x1F, 0x66, 0x86, 0xFD, 0x1F, 0xFF, 0xE2, 0x22,
+  0x80, 0x66, 0x31, 0x62, 0x55, 0x51, 0x93, 0x42, 0xA2, 0x32, 0xC1, 0x31,
+  0xF1, 0x2F, 0x12, 0xF1, 0x2A, 0x8C, 0x22, 0x2C, 0x22, 0x3B, 0x23, 0x2B,
+  0x24, 0x2A, 0x24, 0x39, 0x26, 0x36, 0x38, 0x75, 0x06, 0x58, 0x22, 0x52,
+  0x22, 0xFF, 0xFF, 0xFF, 0xF1, 0x98, 0x9F, 0xFF, 0xFF, 0xFF, 0x12, 0x22,
+  0x52, 0x22, 0x08, 0x22, 0xFF, 0xFF, 0xF9, 0x22, 0x20, 0x37, 0x32, 0x32,
+  0x51, 0xFF, 0xFF, 0xFF, 0xF9, 0x34, 0x1C, 0x12, 0x43, 0x08, 0x26, 0x54,
+  0x53, 0x82, 0x62, 0x92, 0x52, 0xA2, 0x51, 0xB2, 0x41, 0xC2, 0x31, 0xD2,
+  0x12, 0xE4, 0xF0, 0x21, 0x3D, 0x22, 0x3C, 0x23, 0x3B, 0x25, 0x2A, 0x26,
+  0x38, 0x27, 0x36, 0x46, 0x52, 0x83, 0x80, 0x07, 0x82, 0x32, 0xA1, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x1D, 0x22, 0x19, 0x12, 0x23, 0x73, 0x04,
+  0xD5, 0x31, 0xE2, 0x11, 0xE1, 0x91, 0xF3, 0x1B, 0x2F, 0xE1, 0x11, 0x72,
+  0xFF, 0x11, 0x11, 0x52, 0xFF, 0x51, 0x32, 0xD1, 0xF8, 0x11, 0x2F, 0x01,
+  0xF8, 0x1F, 0x31, 0x21, 0x92, 0x12, 0xA2, 0x22, 0x04, 0x98, 0x21, 0x82,
+  0x13, 0x21, 0xF6, 0x1F, 0x21, 0x11, 0xF2, 0x11, 0x1F, 0x21, 0x11, 0xF4,
+  0x1F, 0x11, 0x21, 0xF1, 0x1F, 0x41, 0x11, 0xF2, 0x11, 0x1F, 0x21, 0x11,
+  0xF2, 0x11, 0x1F, 0x21, 0x71, 0xF1, 0x22, 0x28, 0x14, 0x56, 0x83, 0x43,
+  0x52, 0x82, 0x41, 0xA1, 0x32, 0xA2, 0x12, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+  0xC4, 0xC1, 0x22, 0xA2, 0x31, 0xA2, 0x32, 0x82, 0x53, 0x43, 0x86, 0x50,
+  0x0B, 0x32, 0x25, 0x21, 0xB2, 0x11, 0xC1, 0x11, 0xFF, 0x91, 0x11, 0xA1,
+  0x11, 0x56, 0x11, 0x67, 0xFF, 0xFF, 0xF2, 0x19, 0x23, 0x27, 0x56, 0x83,
+  0x42, 0x62, 0x82, 0x41, 0xA1, 0x32, 0xA2, 0x21, 0xC1, 0x12, 0xC4, 0xC4,
+  0xC4, 0xC4, 0xC4, 0xC2, 0x12, 0xA2, 0x22, 0xA1, 0x42, 0x82, 0x53, 0x43,
+  0x77, 0xB4, 0xD4, 0xE3, 0xE4, 0xF0, 0x30, 0x0A, 0x72, 0x25, 0x12, 0xE1,
+  0xF2, 0x11, 0x1F, 0xFF, 0x31, 0xE2, 0x21, 0x84, 0x22, 0x93, 0x21, 0xF1,
+  0x1E, 0x12, 0x1E, 0x1F, 0x21, 0x11, 0xF0, 0x11, 0x1F, 0x22, 0x22, 0x22,
+  0x51, 0x32, 0x3E, 0x4C, 0x3B, 0x03, 0x60, 0x2C, 0x05, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x78, 0x07, 0x80, 0xF0, 0x1F, 0x86,
+  0x8F, 0x00, 0x0E, 0x24, 0x24, 0x31, 0xA1, 0xF0, 0x1C, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF8, 0x22, 0x24, 0x07, 0x69, 0x32, 0x62, 0x32, 0x21, 0xC1,
+  0x11, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x71, 0x11, 0xA1,
+  0x71, 0x11, 0x63, 0x9A, 0x50, 0x07, 0x57, 0x32, 0x51, 0x22, 0x21, 0x21,
+  0x81, 0x51, 0xFF, 0x61, 0x52, 0x71, 0xFF, 0x41, 0x11, 0x32, 0xFF, 0xE1,
+  0x11, 0x12, 0xFF, 0xF1, 0x11, 0x2F, 0xFA, 0x06, 0x36, 0x47, 0x31, 0x32,
+  0x31, 0x41, 0x22, 0x41, 0x61, 0x91, 0x41, 0x11, 0xFF, 0xF3, 0x15, 0x17,
+  0x26, 0x18, 0x11, 0x1F, 0xF9, 0x13, 0x26, 0x28, 0x1F, 0xF2, 0x11, 0x1D,
+  0x11, 0x11, 0x26, 0x2F, 0xFF, 0xE1, 0x12, 0x41, 0x12, 0xFF, 0xF9, 0x08,
+  0x46, 0x24, 0x73, 0x53, 0x72, 0x72, 0x71, 0x92, 0x51, 0xA3, 0x31, 0xC3,
+  0x11, 0xE3, 0xF1, 0x2F, 0x13, 0xE1, 0x13, 0xC1, 0x32, 0xB1, 0x52, 0x91,
+  0x63, 0x71, 0x83, 0x52, 0x84, 0x26, 0x57, 0x07, 0x48, 0x32, 0x42, 0x22,
+  0x21, 0xB1, 0x51, 0x11, 0x62, 0xE2, 0x81, 0x11, 0xF5, 0x2A, 0x11, 0x11,
+  0x2F, 0xE1, 0x12, 0xFF, 0xFF, 0xFF, 0x81, 0x21, 0xB2, 0x42, 0x50, 0x1D,
+  0x32, 0x82, 0x41, 0x83, 0x41, 0x82, 0xD2, 0xD2, 0xD3, 0xD2, 0xD2, 0xD2,
+  0xD3, 0xD2, 0xD2, 0xD3, 0xA1, 0x22, 0xB1, 0x12, 0xB1, 0x1F, 0x01, 0x05,
+  0x23, 0xFF, 0xFF, 0xFF, 0x73, 0x01, 0xF2, 0x2F, 0x82, 0xF2, 0x2F, 0x22,
+  0xF2, 0x26, 0x08, 0xFF, 0xFF, 0xFF, 0x73, 0x20, 0x04, 0x03, 0x01, 0x60,
+  0x58, 0x23, 0x10, 0xC4, 0x1A, 0x06, 0x0C, 0xE6, 0x31, 0x3E, 0x10, 0xCC,
+  0x33, 0x0C, 0x07, 0x0E, 0xC6, 0x33, 0x0C, 0xC3, 0x3B, 0xD7, 0x38, 0x22,
+  0x72, 0x92, 0xFF, 0xF3, 0x37, 0x13, 0x15, 0x47, 0x15, 0x18, 0x1F, 0xFD,
+  0x11, 0x14, 0x12, 0x11, 0x13, 0x21, 0x21, 0x12, 0x1E, 0x11, 0x90, 0x78,
+  0x3C, 0x06, 0x03, 0x01, 0xC1, 0x71, 0x3F, 0x87, 0x00, 0x72, 0x72, 0x92,
+  0xFF, 0xA3, 0x75, 0x52, 0x31, 0x41, 0xFF, 0xF9, 0x11, 0x1B, 0x12, 0x12,
+  0x21, 0x21, 0x32, 0x20, 0x1E, 0x31, 0x90, 0x7F, 0xFC, 0x06, 0x03, 0x01,
+  0xC1, 0x71, 0x3F, 0x87, 0x80, 0x44, 0x43, 0x21, 0x21, 0x31, 0x92, 0xF3,
+  0x22, 0x23, 0x22, 0x2F, 0xFF, 0xFF, 0x02, 0x22, 0x30, 0x1F, 0x03, 0x1F,
+  0x60, 0xC6, 0x0C, 0x60, 0xC3, 0x18, 0x1F, 0x02, 0x00, 0x60, 0x07, 0xFC,
+  0x1F, 0xE2, 0x02, 0x40, 0x2C, 0x04, 0xE0, 0x83, 0xF0, 0x22, 0x82, 0xA2,
+  0xFF, 0xF7, 0x37, 0x41, 0x16, 0x2F, 0xFF, 0xFF, 0xF0, 0x22, 0x12, 0x12,
+  0x20, 0x22, 0xA2, 0xF7, 0x22, 0x24, 0x2F, 0xFF, 0x12, 0x22, 0x42, 0xA2,
+  0xF7, 0x22, 0x24, 0x2F, 0xFF, 0xF8, 0x23, 0x12, 0x31, 0x22, 0x92, 0xB2,
+  0xFF, 0xFC, 0x58, 0x12, 0x28, 0x39, 0x2A, 0x2A, 0x11, 0x1A, 0x21, 0x1B,
+  0x11, 0x1D, 0x1A, 0x12, 0x12, 0x22, 0x21, 0x13, 0x20, 0x22, 0x22, 0x42,
+  0xFF, 0xFF, 0xF7, 0x22, 0x20, 0x22, 0x23, 0x24, 0x32, 0x23, 0x25, 0x11,
+  0x22, 0x22, 0x11, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x24, 0x24, 0x22,
+  0x22, 0x23, 0x32, 0x23, 0x21, 0x22, 0x22, 0x11, 0xFF, 0xFF, 0xFD, 0x22,
+  0x12, 0x12, 0x20, 0x1E, 0x08, 0xE4, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0x61, 0x9C, 0x41, 0xE0, 0x22, 0x14, 0x22, 0x24, 0x11, 0x12, 0x21,
+  0xE1, 0x11, 0xFF, 0xF7, 0x11, 0x14, 0x14, 0x15, 0x57, 0x3F, 0xF6, 0x22,
+  0x25, 0x34, 0x11, 0x44, 0x11, 0x41, 0x41, 0x41, 0x11, 0xFF, 0xF9, 0x13,
+  0x14, 0x12, 0x45, 0x13, 0x17, 0x3F, 0xFE, 0x22, 0x20, 0x22, 0x25, 0x31,
+  0x32, 0x25, 0x41, 0xFF, 0xFD, 0x22, 0x23, 0x7D, 0x1A, 0x16, 0x0F, 0x0F,
+  0x87, 0xC3, 0x87, 0x8A, 0xE0, 0x31, 0xB2, 0x41, 0x32, 0x12, 0x22, 0xFF,
+  0xFB, 0x12, 0x11, 0x30, 0x04, 0x24, 0x22, 0x42, 0xFF, 0xFF, 0xF8, 0x18,
+  0x42, 0x22, 0x13, 0x13, 0x20, 0xF8, 0xF7, 0x06, 0x30, 0x43, 0x08, 0x18,
+  0x81, 0x88, 0x0D, 0x00, 0xD0, 0x06, 0x00, 0x60, 0x06, 0x00, 0xFB, 0xE7,
+  0xB0, 0xC1, 0x98, 0x60, 0x86, 0x38, 0x83, 0x1C, 0x41, 0x96, 0x20, 0x69,
+  0xA0, 0x34, 0xD0, 0x0C, 0x30, 0x06, 0x18, 0x03, 0x0C, 0x00, 0x79, 0xE3,
+  0x08, 0x19, 0x00, 0xE0, 0x0E, 0x00, 0x60, 0x0B, 0x01, 0x30, 0x11, 0x86,
+  0x0C, 0xF1, 0xF0, 0x05, 0x35, 0x31, 0x32, 0x11, 0x11, 0x72, 0xF0, 0x11,
+  0x13, 0x25, 0x11, 0x1F, 0x71, 0x13, 0xF5, 0x11, 0x1F, 0x62, 0xF6, 0x26,
+  0x4C, 0x17, 0x7F, 0xA1, 0x90, 0xC0, 0xC0, 0xC0, 0xE0, 0x60, 0x61, 0x60,
+  0xB0, 0xFF, 0xE0, 0x0C, 0x63, 0x0C, 0x30, 0xC3, 0x0C, 0x31, 0x8C, 0x10,
+  0x20, 0xC3, 0x0C, 0x30, 0xC3, 0x04, 0x18, 0x30, 0x0F, 0xFE, 0xC1, 0x83,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x60, 0xC2, 0x10, 0xC3, 0x0C, 0x30, 0xC3,
+  0x08, 0x63, 0x00, 0x78, 0x1C, 0x63, 0x81, 0xE0, 0x0C, 0x1A, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFB, 0xA1, 0x1F, 0x02, 0x3C, 0x19, 0x1F, 0xFF, 0xF9, 0x22,
+  0x13, 0x62, 0xA2, 0xC2, 0xFF, 0xF7, 0x42, 0x43, 0x11, 0x32, 0x31, 0x11,
+  0x11, 0x18, 0x11, 0x1F, 0xFF, 0xFF, 0x91, 0x11, 0x81, 0x11, 0x11, 0x13,
+  0x23, 0x11, 0x34, 0x24, 0xFF, 0xF4, 0x12, 0x15, 0x04, 0x34, 0x11, 0x21,
+  0x31, 0x21, 0xFF, 0xFF, 0xFF, 0x71, 0x25, 0x2C, 0xC1, 0xD0, 0x14, 0x25,
+  0x11, 0x21, 0x21, 0x22, 0xFF, 0xA1, 0x21, 0x62, 0x13, 0x83, 0xFF, 0x61,
+  0x22, 0x04, 0x34, 0x24, 0x11, 0x21, 0x31, 0x21, 0x21, 0x21, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFA, 0x12, 0x52, 0x42, 0x20, 0x04, 0x34, 0x24, 0x11, 0x21,
+  0x31, 0x21, 0x21, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x12, 0x52, 0x42,
+  0xF3, 0xF3, 0x1F, 0x40, 0x07, 0x62, 0x22, 0x51, 0xFF, 0xA6, 0x64, 0xE1,
+  0xF8, 0x12, 0x12, 0x41, 0x11, 0x05, 0x64, 0x11, 0x22, 0x61, 0x21, 0xFF,
+  0xF7, 0x6A, 0x42, 0x1D, 0x1F, 0x01, 0xF2, 0x16, 0x12, 0x41, 0x11, 0x22,
+  0x11, 0xF8, 0x1C, 0x02, 0x00, 0x80, 0x20, 0x0F, 0xE2, 0x1C, 0x83, 0x20,
+  0xD8, 0x6F, 0xF0, 0xFC, 0x63, 0x20, 0xC0, 0x60, 0x18, 0xFC, 0x06, 0x02,
+  0x03, 0x43, 0x1F, 0x00, 0xF8, 0x7E, 0x30, 0x43, 0x98, 0x60, 0xCC, 0x60,
+  0x76, 0x30, 0x1B, 0xF8, 0x0D, 0x8C, 0x06, 0xC7, 0x03, 0x61, 0x83, 0x30,
+  0xE1, 0x3E, 0x1F, 0x00, 0x1F, 0xE6, 0x18, 0xC2, 0x18, 0x43, 0x88, 0x1F,
+  0x03, 0x20, 0xE4, 0x18, 0x86, 0x39, 0x8F, 0x80, 0x1B, 0x31, 0x36, 0xFD,
+  0x1F, 0xFF, 0x46, 0x84, 0x21, 0xB1, 0x21, 0xB1, 0xF1, 0x1A, 0x12, 0x1F,
+  0x81, 0x21, 0x12, 0x34, 0x21, 0x20, 0x1C, 0x21, 0x37, 0xE2, 0xD1, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x42, 0x32, 0x70, 0x4C, 0x52, 0x15, 0x31, 0xFF,
+  0xFF, 0xE2, 0xFF, 0xFF, 0xF7, 0x2F, 0xF1, 0x2E, 0x1F, 0x01, 0x28, 0x33,
+  0x3A, 0x52, 0xA1, 0xF2, 0x12, 0x1F, 0xF1, 0x10, 0x60, 0x00, 0x13, 0xE3,
+  0xF1, 0xFC, 0x83, 0x04, 0xC2, 0x0C, 0x30, 0x04, 0x30, 0x80, 0x10, 0xC2,
+  0x00, 0x63, 0x18, 0x00, 0x8C, 0x40, 0x01, 0xFE, 0x00, 0x0C, 0xCC, 0x00,
+  0x63, 0x38, 0x03, 0x8C, 0x70, 0x0C, 0x30, 0xC0, 0x70, 0xC3, 0x81, 0x83,
+  0x06, 0x0E, 0x0C, 0x1C, 0xF0, 0xFC, 0x3C, 0x9E, 0x1C, 0x73, 0x07, 0x40,
+  0x68, 0x0C, 0x03, 0x80, 0x70, 0x1C, 0x1E, 0x00, 0x70, 0x07, 0x00, 0x70,
+  0x0E, 0x01, 0xE0, 0x72, 0x0E, 0x3F, 0x00, 0x15, 0x65, 0x21, 0x31, 0x61,
+  0x31, 0xFF, 0x11, 0xF1, 0x2F, 0x02, 0xF0, 0x1F, 0x11, 0x11, 0xF1, 0x1F,
+  0x02, 0xF0, 0x2F, 0x02, 0xFF, 0x41, 0xFF, 0x11, 0x31, 0x52, 0x31, 0x10,
+  0x51, 0x62, 0xA1, 0x41, 0x11, 0x91, 0x11, 0x21, 0xD7, 0xD2, 0x95, 0x65,
+  0x21, 0x31, 0x61, 0x31, 0xFF, 0x11, 0xF1, 0x2F, 0x02, 0xF0, 0x1F, 0x11,
+  0x11, 0xF1, 0x1F, 0x02, 0xF0, 0x2F, 0x02, 0xFF, 0x41, 0xFF, 0x11, 0x31,
+  0x52, 0x31, 0x10, 0xD2, 0x35, 0x52, 0x21, 0x21, 0x31, 0x41, 0x11, 0xF0,
+  0x11, 0x3F, 0xC2, 0xE1, 0xF0, 0x11, 0x1C, 0x21, 0x1D, 0x21, 0x2E, 0x12,
+  0x1E, 0x1F, 0x41, 0xE1, 0x21, 0xE1, 0xF4, 0x14, 0x13, 0x24, 0x12, 0x21,
+  0x3C, 0x42, 0x15, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x2F, 0xB1, 0xF1,
+  0x4F, 0x52, 0x32, 0x1F, 0x12, 0x13, 0x82, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x71, 0x31, 0x31, 0x52, 0x31, 0x10, 0x15, 0x74, 0x23,
+  0x91, 0x53, 0x81, 0x62, 0x71, 0x73, 0x61, 0x83, 0x41, 0x93, 0x41, 0xA3,
+  0x22, 0xA3, 0x21, 0xC3, 0x11, 0xC4, 0xE3, 0xE2, 0xF1, 0x1A, 0x32, 0x1C,
+  0x49, 0x66, 0xF0, 0x3B, 0xC6, 0x24, 0x34, 0x23, 0x25, 0x34, 0x31, 0x35,
+  0x35, 0x65, 0x35, 0x65, 0x35, 0x65, 0x35, 0x65, 0x35, 0x31, 0x25, 0x35,
+  0x22, 0x34, 0x34, 0x25, 0x32, 0x32, 0x39, 0x7E, 0x3E, 0x76, 0x15, 0x56,
+  0x21, 0x31, 0x52, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+  0x12, 0x23, 0x83, 0x11, 0xE3, 0x1E, 0x2F, 0x31, 0xFF, 0x70, 0x16, 0x36,
+  0x22, 0x22, 0x32, 0x31, 0xFF, 0xFF, 0xFF, 0x11, 0xF2, 0x68, 0x24, 0x3A,
+  0x4F, 0xFF, 0xFF, 0xC1, 0x32, 0x15, 0x45, 0x45, 0x21, 0x31, 0x41, 0x31,
+  0x41, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x23, 0x63, 0x63, 0x20, 0x15, 0x45, 0x45, 0x21, 0x31, 0x41, 0x31,
+  0x41, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x23, 0x63, 0x63, 0xF9, 0xFA, 0x1F, 0xA1, 0xFF, 0xF5, 0x10, 0x19,
+  0x94, 0x31, 0x72, 0x61, 0x81, 0xFF, 0xFF, 0xF0, 0x6B, 0x51, 0x2E, 0x12,
+  0x1F, 0xFF, 0xFF, 0x61, 0x21, 0x42, 0x25, 0x12, 0x10, 0x15, 0x96, 0x21,
+  0x31, 0x92, 0x22, 0xFF, 0xFF, 0xFF, 0xFB, 0x5F, 0x24, 0x12, 0xF4, 0x12,
+  0x1F, 0x41, 0xF9, 0x1F, 0x31, 0x21, 0xFF, 0x91, 0x21, 0x92, 0x34, 0x21,
+  0x32, 0x22, 0x10, 0x06, 0x82, 0x31, 0xFF, 0xFF, 0xF8, 0x59, 0x41, 0x2B,
+  0x12, 0x1F, 0xA1, 0x21, 0xA1, 0x21, 0xF8, 0x12, 0x11, 0x23, 0x42, 0x12,
+  0x01, 0x36, 0x65, 0x52, 0x43, 0x82, 0x32, 0xA2, 0x21, 0xC2, 0x11, 0xC2,
+  0xF0, 0x2E, 0x26, 0xAE, 0x2E, 0x2D, 0x2E, 0x21, 0x1B, 0x23, 0x19, 0x25,
+  0x25, 0x38, 0x66, 0xE5, 0x75, 0x62, 0x13, 0x12, 0x51, 0x31, 0x51, 0x12,
+  0x32, 0x11, 0xD1, 0x91, 0x11, 0xB1, 0x21, 0xA1, 0xFF, 0x71, 0x91, 0xB1,
+  0xF0, 0x15, 0x3F, 0x73, 0xFF, 0xB1, 0x81, 0x21, 0x91, 0xFF, 0x71, 0xD1,
+  0xD1, 0x71, 0xE1, 0x21, 0x51, 0x21, 0x22, 0x32, 0x42, 0x15, 0x12, 0x30,
+  0x7A, 0x52, 0x15, 0x22, 0x41, 0x21, 0xF0, 0x1F, 0xFF, 0x51, 0xE1, 0x22,
+  0xD2, 0x24, 0xB1, 0x23, 0xB1, 0xF0, 0x12, 0x1F, 0x01, 0xD1, 0x11, 0xD1,
+  0x11, 0xC2, 0xD2, 0x31, 0x52, 0x22, 0x01, 0xE3, 0xF8, 0xF0, 0x10, 0x04,
+  0x00, 0x80, 0x27, 0xE5, 0x0E, 0xE0, 0xF8, 0x0F, 0x01, 0xE0, 0x3C, 0x06,
+  0xC0, 0xD8, 0x11, 0x86, 0x1F, 0x00, 0xFF, 0x18, 0x66, 0x19, 0x86, 0x63,
+  0x9F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x7F, 0xF0, 0x0A, 0x25, 0x91, 0xFF,
+  0xFC, 0x15, 0x13, 0x14, 0x39, 0x31, 0x13, 0x22, 0xFF, 0x92, 0xFF, 0xF0,
+  0x28, 0x21, 0x52, 0x22, 0x83, 0x18, 0x1C, 0x10, 0xE7, 0xCE, 0xE1, 0x8E,
+  0x11, 0x90, 0x11, 0x90, 0x09, 0xA0, 0x0F, 0xE0, 0x19, 0xB0, 0x39, 0x98,
+  0x31, 0x98, 0x63, 0x8C, 0xE7, 0xCF, 0x7F, 0x20, 0xD0, 0x60, 0x70, 0x60,
+  0x78, 0x06, 0x03, 0x01, 0xC1, 0xDF, 0xC0, 0xF1, 0xE6, 0x0C, 0x60, 0xC6,
+  0x1C, 0x62, 0xC6, 0x4C, 0x68, 0xC7, 0x0C, 0x70, 0xC6, 0x0C, 0xF9, 0xF0,
+  0x30, 0xC3, 0x18, 0x1F, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x60, 0xC6, 0x0C,
+  0x61, 0xC6, 0x2C, 0x64, 0xC6, 0x8C, 0x70, 0xC7, 0x0C, 0x60, 0xCF, 0x9F,
+  0xF9, 0xCC, 0x39, 0x88, 0x31, 0x06, 0x40, 0xFC, 0x19, 0x83, 0x18, 0x63,
+  0x8C, 0x33, 0xE3, 0x80, 0x29, 0x31, 0x14, 0x21, 0xFF, 0xFF, 0xFA, 0x2C,
+  0x14, 0x12, 0x20, 0x04, 0x65, 0xC1, 0x92, 0x51, 0x11, 0xF2, 0x27, 0x11,
+  0x1F, 0xB1, 0x13, 0xFB, 0x16, 0x11, 0x12, 0x13, 0x22, 0x10, 0x04, 0x34,
+  0x11, 0x21, 0x31, 0x21, 0xFF, 0xA5, 0x75, 0xFF, 0xA1, 0x22, 0x21, 0x22,
+  0x0B, 0x11, 0x25, 0x21, 0xFF, 0xFF, 0xFF, 0x71, 0x22, 0x21, 0x22, 0x32,
+  0x42, 0x51, 0x51, 0x21, 0x41, 0x51, 0x21, 0x52, 0x42, 0xF2, 0xD1, 0x23,
+  0x7F, 0xD1, 0xC1, 0xFB, 0x18, 0x59, 0x6F, 0xD1, 0xFE, 0x1F, 0xB1, 0x12,
+  0x37, 0x11, 0x21, 0x73, 0x13, 0x32, 0x22, 0xFF, 0x05, 0x31, 0x42, 0x12,
+  0x4D, 0x81, 0x82, 0x72, 0x64, 0x51, 0x17, 0x35, 0x20 };
+
+const RleGlyph TimesNRCyr12pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    1, 0 },  // 0x20 ' '
+  {     0,   2,  17,   7,    2,  -16, 1 },  // 0x21 '!'
+  {     4,   6,   7,  10,    2,  -16, 0 },  // 0x22 '"'
+  {    10,  15,  17,  16,    0,  -16, 2 },  // 0x23 '#'
+  {    33,   8,  21,  12,    2,  -18, 0 },  // 0x24 '$'
+  {    54,  18,  17,  20,    1,  -16, 2 },  // 0x25 '%'
+  {    84,  18,  17,  19,    1,  -16, 0 },  // 0x26 '&'
+  {   123,   2,   7,   4,    1,  -16, 0 },  // 0x27 '''
+  {   125,   6,  22,   8,    1,  -16, 0 },  // 0x28 '('
+  {   142,   6,  22,   8,    1,  -16, 0 },  // 0x29 ')'
+  {   159,   9,  10,  12,    2,  -16, 0 },  // 0x2A '*'
+  {   171,  14,  14,  16,    2,  -14, 2 },  // 0x2B '+'
+  {   181,   3,   7,   7,    2,   -2, 0 },  // 0x2C ','
+  {   184,   6,   2,   8,    1,   -6, 1 },  // 0x2D '-'
+  {   185,   3,   3,   7,    2,   -2, 1 },  // 0x2E '.'
+  {   186,   7,  18,   7,    1,  -16, 2 },  // 0x2F '/'
+  {   195,  10,  17,  12,    1,  -16, 0 },  // 0x30 '0'
+  {   217,   6,  17,  12,    3,  -16, 2 },  // 0x31 '1'
+  {   226,  10,  17,  12,    1,  -16, 0 },  // 0x32 '2'
+  {   248,   9,  17,  12,    1,  -16, 0 },  // 0x33 '3'
+  {   268,  10,  17,  12,    1,  -16, 2 },  // 0x34 '4'
+  {   283,  10,  17,  12,    1,  -16, 1 },  // 0x35 '5'
+  {   302,   9,  17,  12,    1,  -16, 0 },  // 0x36 '6'
+  {   322,   9,  17,  12,    1,  -16, 2 },  // 0x37 '7'
+  {   335,   9,  17,  12,    1,  -16, 0 },  // 0x38 '8'
+  {   355,   9,  17,  12,    1,  -16, 0 },  // 0x39 '9'
+  {   375,   3,  11,   7,    2,  -10, 1 },  // 0x3A ':'
+  {   378,   3,  15,   7,    2,  -10, 0 },  // 0x3B ';'
+  {   384,  13,  13,  16,    2,  -14, 1 },  // 0x3C '<'
+  {   397,  12,   8,  16,    2,  -12, 1 },  // 0x3D '='
+  {   402,  13,  13,  16,    1,  -14, 1 },  // 0x3E '>'
+  {   416,   7,  17,   9,    1,  -16, 0 },  // 0x3F '?'
+  {   431,  20,  22,  22,    1,  -16, 0 },  // 0x40 '@'
+  {   486,  17,  17,  19,    1,  -16, 2 },  // 0x41 'A'
+  {   512,  13,  17,  16,    1,  -16, 2 },  // 0x42 'B'
+  {   539,  14,  17,  17,    1,  -16, 1 },  // 0x43 'C'
+  {   565,  17,  17,  20,    1,  -16, 2 },  // 0x44 'D'
+  {   592,  14,  17,  16,    1,  -16, 2 },  // 0x45 'E'
+  {   610,  14,  17,  16,    1,  -16, 2 },  // 0x46 'F'
+  {   625,  18,  17,  20,    1,  -16, 1 },  // 0x47 'G'
+  {   656,  17,  17,  20,    1,  -16, 2 },  // 0x48 'H'
+  {   674,   6,  17,   9,    1,  -16, 2 },  // 0x49 'I'
+  {   681,  10,  17,  11,    0,  -16, 2 },  // 0x4A 'J'
+  {   693,  19,  17,  20,    0,  -16, 1 },  // 0x4B 'K'
+  {   727,  15,  17,  16,    0,  -16, 2 },  // 0x4C 'L'
+  {   743,  21,  17,  24,    2,  -16, 2 },  // 0x4D 'M'
+  {   776,  19,  17,  20,    0,  -16, 2 },  // 0x4E 'N'
+  {   813,  16,  17,  19,    1,  -16, 1 },  // 0x4F 'O'
+  {   840,  14,  17,  15,    1,  -16, 2 },  // 0x50 'P'
+  {   862,  16,  22,  19,    1,  -16, 1 },  // 0x51 'Q'
+  {   895,  17,  17,  19,    1,  -16, 2 },  // 0x52 'R'
+  {   926,  11,  17,  13,    1,  -16, 0 },  // 0x53 'S'
+  {   950,  14,  17,  16,    1,  -16, 2 },  // 0x54 'T'
+  {   965,  20,  17,  20,    0,  -16, 2 },  // 0x55 'U'
+  {   989,  17,  17,  17,    0,  -16, 2 },  // 0x56 'V'
+  {  1015,  24,  17,  24,    0,  -16, 2 },  // 0x57 'W'
+  {  1055,  18,  17,  19,    0,  -16, 1 },  // 0x58 'X'
+  {  1087,  17,  17,  19,    1,  -16, 2 },  // 0x59 'Y'
+  {  1115,  16,  17,  16,    0,  -16, 1 },  // 0x5A 'Z'
+  {  1139,   5,  22,   7,    2,  -16, 2 },  // 0x5B '['
+  {  1145,   6,  18,   7,    1,  -16, 2 },  // 0x5C
+  {  1154,   5,  22,   7,    0,  -16, 2 },  // 0x5D ']'
+  {  1160,  10,   8,  14,    2,  -16, 0 },  // 0x5E '^'
+  {  1170,  12,   1,  12,    0,    3, 1 },  // 0x5F '_'
+  {  1171,   4,   4,   8,    2,  -16, 0 },  // 0x60 '`'
+  {  1173,  10,  11,  12,    1,  -10, 0 },  // 0x61 'a'
+  {  1187,  11,  17,  13,    0,  -16, 2 },  // 0x62 'b'
+  {  1208,   9,  11,  11,    1,  -10, 0 },  // 0x63 'c'
+  {  1221,  11,  17,  13,    1,  -16, 2 },  // 0x64 'd'
+  {  1240,   9,  11,  11,    1,  -10, 0 },  // 0x65 'e'
+  {  1253,   9,  17,   8,    0,  -16, 2 },  // 0x66 'f'
+  {  1269,  12,  16,  12,    0,  -10, 0 },  // 0x67 'g'
+  {  1293,  12,  17,  13,    0,  -16, 2 },  // 0x68 'h'
+  {  1309,   6,  17,   7,    0,  -16, 2 },  // 0x69 'i'
+  {  1318,   6,  22,   7,   -2,  -16, 2 },  // 0x6A 'j'
+  {  1329,  13,  17,  13,    0,  -16, 2 },  // 0x6B 'k'
+  {  1353,   6,  17,   7,    0,  -16, 2 },  // 0x6C 'l'
+  {  1361,  18,  11,  19,    0,  -10, 2 },  // 0x6D 'm'
+  {  1380,  12,  11,  13,    0,  -10, 2 },  // 0x6E 'n'
+  {  1395,  10,  11,  13,    1,  -10, 0 },  // 0x6F 'o'
+  {  1409,  11,  16,  13,    0,  -10, 2 },  // 0x70 'p'
+  {  1429,  11,  16,  13,    1,  -10, 2 },  // 0x71 'q'
+  {  1449,   9,  11,   9,    0,  -10, 2 },  // 0x72 'r'
+  {  1459,   7,  11,   9,    1,  -10, 0 },  // 0x73 's'
+  {  1469,   7,  14,   8,    0,  -13, 2 },  // 0x74 't'
+  {  1480,  12,  11,  13,    0,  -10, 2 },  // 0x75 'u'
+  {  1493,  12,  11,  12,    0,  -10, 0 },  // 0x76 'v'
+  {  1510,  17,  11,  17,    0,  -10, 0 },  // 0x77 'w'
+  {  1534,  12,  11,  12,    0,  -10, 0 },  // 0x78 'x'
+  {  1551,  12,  16,  12,    0,  -10, 2 },  // 0x79 'y'
+  {  1574,   9,  11,  10,    0,  -10, 0 },  // 0x7A 'z'
+  {  1587,   6,  22,  12,    3,  -16, 0 },  // 0x7B '{'
+  {  1604,   2,  22,   5,    2,  -16, 1 },  // 0x7C '|'
+  {  1606,   6,  22,  12,    2,  -16, 0 },  // 0x7D '}'
+  {  1623,  12,   3,  16,    2,   -8, 0 },  // 0x7E '~'
+  {  1628,  12,  15,  18,    3,  -14, 2 },  // 0x7F
+  {  1409,  11,  16,  13,    0,  -10, 2 },  // 0x80
+  {  1208,   9,  11,  11,    1,  -10, 0 },  // 0x81
+  {  1636,  11,  11,  11,    0,  -10, 2 },  // 0x82
+  {  1551,  12,  16,  12,    0,  -10, 2 },  // 0x83
+  {  1645,  14,  22,  16,    1,  -16, 2 },  // 0x84
+  {  1534,  12,  11,  12,    0,  -10, 0 },  // 0x85
+  {  1676,  12,  14,  14,    1,  -10, 2 },  // 0x86
+  {  1690,  12,  11,  13,    0,  -10, 2 },  // 0x87
+  {  1705,  18,  11,  19,    1,  -10, 2 },  // 0x88
+  {  1723,  18,  14,  19,    1,  -10, 2 },  // 0x89
+  {  1744,  12,  11,  13,    1,  -10, 2 },  // 0x8A
+  {  1757,  16,  11,  17,    1,  -10, 2 },  // 0x8B
+  {  1777,  10,  11,  12,    1,  -10, 0 },  // 0x8C
+  {  1791,   9,  11,  11,    1,  -10, 0 },  // 0x8D
+  {  1804,  17,  11,  19,    1,  -10, 0 },  // 0x8E
+  {  1828,  11,  11,  12,    0,  -10, 0 },  // 0x8F
+  {   486,  17,  17,  19,    1,  -16, 2 },  // 0x90
+  {  1844,  14,  16,  16,    1,  -15, 2 },  // 0x91
+  {   512,  13,  17,  16,    1,  -16, 2 },  // 0x92
+  {  1866,  14,  16,  15,    1,  -15, 2 },  // 0x93
+  {  1879,  17,  21,  18,    0,  -15, 2 },  // 0x94
+  {   592,  14,  17,  16,    1,  -16, 2 },  // 0x95
+  {  1904,  22,  17,  24,    1,  -16, 0 },  // 0x96
+  {  1951,  11,  17,  13,    1,  -16, 0 },  // 0x97
+  {  1975,  18,  16,  20,    1,  -15, 2 },  // 0x98
+  {  2004,  18,  21,  20,    1,  -20, 2 },  // 0x99
+  {  2043,  17,  17,  18,    1,  -16, 2 },  // 0x9A
+  {  2076,  16,  16,  18,    1,  -15, 2 },  // 0x9B
+  {   743,  21,  17,  24,    2,  -16, 2 },  // 0x9C
+  {   656,  17,  17,  20,    1,  -16, 2 },  // 0x9D
+  {   813,  16,  17,  19,    1,  -16, 1 },  // 0x9E
+  {  2091,  18,  16,  20,    1,  -15, 2 },  // 0x9F
+  {   840,  14,  17,  15,    1,  -16, 2 },  // 0xA0
+  {   539,  14,  17,  17,    1,  -16, 1 },  // 0xA1
+  {   950,  14,  17,  16,    1,  -16, 2 },  // 0xA2
+  {  2109,  17,  16,  18,    0,  -15, 1 },  // 0xA3
+  {  2137,  19,  16,  21,    1,  -15, 1 },  // 0xA4
+  {  1055,  18,  17,  19,    0,  -16, 1 },  // 0xA5
+  {  2170,  18,  21,  20,    1,  -15, 2 },  // 0xA6
+  {  2194,  17,  16,  18,    0,  -15, 2 },  // 0xA7
+  {  2213,  25,  16,  27,    1,  -15, 2 },  // 0xA8
+  {  2237,  25,  21,  27,    1,  -15, 2 },  // 0xA9
+  {  2267,  17,  16,  18,    0,  -15, 2 },  // 0xAA
+  {  2289,  22,  16,  24,    1,  -15, 2 },  // 0xAB
+  {  2319,  14,  16,  16,    1,  -15, 2 },  // 0xAC
+  {  2340,  16,  17,  17,    0,  -16, 1 },  // 0xAD
+  {  2367,  25,  17,  27,    1,  -16, 2 },  // 0xAE
+  {  2412,  17,  17,  18,    0,  -16, 2 },  // 0xAF
+  {  1173,  10,  11,  12,    1,  -10, 0 },  // 0xB0
+  {  2442,  11,  17,  13,    1,  -16, 0 },  // 0xB1
+  {  2466,  10,  11,  12,    1,  -10, 0 },  // 0xB2
+  {  2480,   9,  11,  11,    1,  -10, 2 },  // 0xB3
+  {  2488,  12,  14,  13,    0,  -10, 2 },  // 0xB4
+  {  1240,   9,  11,  11,    1,  -10, 0 },  // 0xB5
+  {  2504,  16,  11,  17,    1,  -10, 0 },  // 0xB6
+  {  2526,   9,  11,  10,    0,  -10, 0 },  // 0xB7
+  {  2539,  12,  11,  14,    1,  -10, 0 },  // 0xB8
+  {  2556,  12,  16,  14,    1,  -15, 0 },  // 0xB9
+  {  2580,  11,  11,  13,    1,  -10, 0 },  // 0xBA
+  {  2596,  12,  11,  13,    0,  -10, 2 },  // 0xBB
+  {  2607,  14,  11,  16,    1,  -10, 2 },  // 0xBC
+  {  2626,  12,  11,  14,    1,  -10, 2 },  // 0xBD
+  {  1395,  10,  11,  13,    1,  -10, 0 },  // 0xBE
+  {  2640,  12,  11,  14,    1,  -10, 2 },  // 0xBF
+  {  2651,  14,  21,  16,    1,  -20, 2 },  // 0xC0
+  {  2678,   9,  17,  11,    1,  -16, 1 }   // 0xC1
+};
+
+const RleFont TimesNRCyr12pt8bRle PROGMEM = {
+  TimesNRCyr12pt8bRleData,
+  TimesNRCyr12pt8bRleGlyphs,
+  0x20, 0xC1, 27 };
+
+#endif // TIMESNRCYR12PT8BRLE_H_
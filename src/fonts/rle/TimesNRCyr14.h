@@ -0,0 +1,450 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr14.h, do not edit.
+// 162 glyphs (18 sharing another's bitmap), 3256 bytes of bitmap data (GFXfont: 5038)
+#ifndef TIMESNRCYR14PT8BRLE_H_
+#define TIMESNRCYR14PT8BRLE_H_
+
+const uint8_t TimesNRCyr14pt8bRleData[] PROGMEM = {
+  0x0F, 0xB1, 0x14, 0x60, 0xCF, 0x3C, 0xF3, 0xCF, 0x38, 0xA2, 0x52, 0x42,
+  0xFF, 0x61, 0x11, 0x31, 0x11, 0xF2, 0x42, 0x42, 0x3F, 0x04, 0x24, 0x23,
+  0xF3, 0x15, 0x1A, 0x15, 0x1F, 0x33, 0x24, 0x24, 0xF0, 0x32, 0x42, 0x4F,
+  0x21, 0x11, 0x31, 0x11, 0xFF, 0x40, 0x04, 0x00, 0x80, 0x7E, 0x32, 0x7C,
+  0x47, 0x88, 0x71, 0x0F, 0x20, 0x74, 0x0F, 0x80, 0xF8, 0x07, 0x80, 0x7C,
+  0x0B, 0x81, 0x38, 0x23, 0x84, 0x70, 0x8F, 0x13, 0x72, 0xE3, 0xF0, 0x08,
+  0x01, 0x00, 0x38, 0x01, 0x06, 0xC0, 0x10, 0xC6, 0x02, 0x0C, 0x60, 0x40,
+  0xC6, 0x04, 0x0C, 0x60, 0x80, 0xC6, 0x10, 0x06, 0xC1, 0x00, 0x38, 0x20,
+  0x00, 0x02, 0x00, 0x00, 0x41, 0xC0, 0x08, 0x36, 0x00, 0x86, 0x30, 0x10,
+  0x63, 0x02, 0x06, 0x30, 0x20, 0x63, 0x04, 0x06, 0x30, 0x80, 0x36, 0x08,
+  0x01, 0xC0, 0x74, 0xD2, 0x32, 0xB2, 0x52, 0xA2, 0x52, 0xA2, 0x52, 0xA2,
+  0x42, 0xC2, 0x22, 0xD5, 0x35, 0x73, 0x53, 0x62, 0x12, 0x52, 0x52, 0x33,
+  0x41, 0x52, 0x52, 0x41, 0x51, 0x63, 0x21, 0x52, 0x75, 0x52, 0x74, 0x63,
+  0x73, 0x55, 0x56, 0x31, 0x18, 0x36, 0x35, 0x64, 0x20, 0xFF, 0xFE, 0x61,
+  0x52, 0x42, 0x42, 0x41, 0x71, 0x41, 0xC1, 0x11, 0xFF, 0xFF, 0x01, 0x81,
+  0x51, 0x81, 0x51, 0x72, 0x62, 0x62, 0x01, 0x62, 0x62, 0x62, 0x71, 0x51,
+  0x81, 0xC1, 0x11, 0xFF, 0xFF, 0x01, 0x11, 0xC1, 0x41, 0x71, 0x42, 0x42,
+  0x42, 0x50, 0x08, 0x04, 0x32, 0x7D, 0x77, 0xF0, 0x41, 0xFD, 0xD7, 0xC9,
+  0x84, 0x02, 0x00, 0x62, 0xFF, 0xFF, 0xF1, 0x62, 0x6E, 0x62, 0x6F, 0xFF,
+  0xFA, 0xDF, 0x92, 0xA0, 0x0E, 0x09, 0x62, 0xF9, 0x11, 0x1F, 0x81, 0x11,
+  0xF8, 0x11, 0x1F, 0x81, 0x11, 0xF8, 0x11, 0x1F, 0x81, 0x11, 0xF0, 0x43,
+  0x67, 0x51, 0x31, 0x41, 0x71, 0x31, 0x51, 0x21, 0x91, 0xFF, 0xFF, 0xFD,
+  0x19, 0x12, 0x15, 0x13, 0x17, 0x14, 0x13, 0x15, 0x72, 0x31, 0x32, 0x31,
+  0x52, 0xFF, 0xFF, 0xFD, 0x22, 0x20, 0x34, 0x67, 0x32, 0x33, 0x31, 0x53,
+  0x11, 0x72, 0x92, 0x92, 0x92, 0x91, 0x92, 0x91, 0x91, 0x91, 0xA1, 0x91,
+  0x91, 0x91, 0x71, 0x19, 0x1A, 0x10, 0x34, 0x56, 0x41, 0x33, 0x21, 0x52,
+  0x82, 0x82, 0x81, 0x81, 0x82, 0x66, 0x73, 0x83, 0x82, 0x82, 0x82, 0x81,
+  0x82, 0x13, 0x32, 0x26, 0x40, 0x91, 0xA1, 0xA1, 0xF7, 0x29, 0x29, 0x29,
+  0x2F, 0x62, 0x92, 0x92, 0xB7, 0x22, 0xC8, 0x22, 0xFF, 0xF3, 0x37, 0x36,
+  0x41, 0x81, 0x91, 0x84, 0x66, 0x74, 0x74, 0x82, 0x83, 0x82, 0x82, 0x82,
+  0x82, 0x81, 0x81, 0x22, 0x41, 0x45, 0x40, 0x00, 0xE0, 0xE0, 0x30, 0x0C,
+  0x03, 0x00, 0x60, 0x18, 0x03, 0x78, 0xF1, 0xD8, 0x1B, 0x03, 0xE0, 0x3C,
+  0x07, 0x80, 0xF0, 0x1B, 0x02, 0x60, 0xC6, 0x30, 0x3C, 0x00, 0x1A, 0xD7,
+  0x13, 0x91, 0xF3, 0x2F, 0xF0, 0x2F, 0xF0, 0x2F, 0xFB, 0x2F, 0xF0, 0x25,
+  0x1E, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xC4, 0x1E, 0x07,
+  0x82, 0x71, 0x8E, 0xC1, 0xB0, 0x3C, 0x0F, 0x03, 0x60, 0xDC, 0x61, 0xE0,
+  0x1E, 0x06, 0x31, 0x83, 0x20, 0x6C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xE0,
+  0x6C, 0x0D, 0xC3, 0x8F, 0xA0, 0x0C, 0x01, 0x00, 0x60, 0x18, 0x06, 0x03,
+  0x83, 0xC0, 0x00, 0x09, 0xF6, 0x90, 0xFF, 0x80, 0x00, 0x03, 0x7E, 0x4A,
+  0x80, 0xD1, 0xA4, 0x85, 0x75, 0x65, 0x75, 0x84, 0xB5, 0xB5, 0xC5, 0xB5,
+  0xB4, 0xD1, 0x0F, 0xDF, 0xFF, 0xBF, 0xD0, 0x01, 0xD4, 0xB5, 0xB5, 0xC5,
+  0xB5, 0xB4, 0x85, 0x75, 0x65, 0x75, 0x84, 0xA1, 0xD0, 0x3C, 0x66, 0xC3,
+  0xC3, 0xC3, 0xC3, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x00,
+  0x00, 0x30, 0x30, 0x30, 0x97, 0xE8, 0x12, 0xA4, 0x64, 0x83, 0xB2, 0x62,
+  0xE2, 0x41, 0xF8, 0x17, 0x72, 0x22, 0x26, 0x5F, 0x21, 0x11, 0x31, 0x21,
+  0x51, 0x61, 0x11, 0xE1, 0xC1, 0xE1, 0x11, 0x71, 0xFF, 0x41, 0x11, 0x51,
+  0x62, 0xD1, 0x21, 0xFB, 0x29, 0x12, 0x35, 0x14, 0x26, 0x21, 0x15, 0x11,
+  0x12, 0x15, 0x13, 0x24, 0x42, 0x21, 0x23, 0x34, 0x4F, 0xB2, 0x32, 0xF0,
+  0x25, 0x3B, 0x37, 0x47, 0x21, 0x1A, 0xC5, 0x92, 0xFF, 0xA1, 0xF1, 0x2F,
+  0xF7, 0x23, 0x1F, 0x21, 0xFF, 0x52, 0x51, 0xF2, 0x1D, 0x2F, 0xC1, 0xB6,
+  0xC9, 0xF7, 0x17, 0x28, 0x1F, 0xD1, 0xD1, 0x32, 0x23, 0x43, 0x33, 0x0B,
+  0x42, 0x35, 0x11, 0x51, 0x71, 0x11, 0xD1, 0x11, 0xFF, 0xFC, 0x11, 0x1B,
+  0x11, 0x17, 0x51, 0x18, 0x51, 0x2C, 0x21, 0x1D, 0x11, 0x1F, 0xFF, 0xC1,
+  0x11, 0x21, 0x81, 0x11, 0x12, 0x36, 0x11, 0x20, 0x66, 0x31, 0x52, 0x55,
+  0x42, 0x83, 0x32, 0xA2, 0x22, 0xC1, 0x22, 0xC1, 0x12, 0xF0, 0x2F, 0x02,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0xF1, 0x2F, 0x02, 0xD1, 0x22, 0xB1,
+  0x42, 0x91, 0x63, 0x52, 0x96, 0x50, 0x0E, 0x62, 0x37, 0x22, 0x61, 0x92,
+  0x21, 0xF2, 0x12, 0x1F, 0x21, 0x21, 0xF2, 0x1F, 0xFA, 0x11, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xC1, 0x11, 0xFF, 0x61, 0x11, 0xF0, 0x21, 0x14, 0x19, 0x21,
+  0x23, 0x23, 0x71, 0x25, 0x0F, 0x01, 0x23, 0x85, 0x1A, 0x1F, 0xF2, 0x1F,
+  0xE1, 0xFF, 0x01, 0x96, 0xA6, 0xF1, 0x1F, 0xF2, 0x1F, 0x31, 0xE1, 0xF1,
+  0x12, 0x19, 0x22, 0x23, 0x74, 0x0F, 0x33, 0x85, 0x1A, 0x1F, 0x11, 0xF1,
+  0x1F, 0xFE, 0x1F, 0x97, 0x96, 0xF1, 0x1F, 0xF2, 0x1F, 0xFF, 0x81, 0x21,
+  0xA2, 0x42, 0x80, 0x77, 0x31, 0x82, 0x56, 0x62, 0x94, 0x52, 0xC2, 0x51,
+  0xD2, 0x42, 0xE1, 0x41, 0xF4, 0x2F, 0x42, 0xF4, 0x2B, 0xAD, 0x42, 0x2E,
+  0x23, 0x2E, 0x24, 0x2D, 0x24, 0x3C, 0x25, 0x3B, 0x26, 0x3A, 0x27, 0x46,
+  0x3B, 0x86, 0x08, 0x4A, 0x42, 0x42, 0x42, 0x21, 0x21, 0x81, 0x21, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x7A, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x21, 0x81,
+  0x21, 0x22, 0x42, 0x42, 0x42, 0x0A, 0x42, 0x21, 0x21, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x12, 0x12, 0x24, 0x20, 0x48, 0x42, 0x42, 0x61, 0x21, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x83, 0x51, 0x61, 0x22, 0x41, 0x33, 0x50, 0x08, 0x37,
+  0x54, 0x73, 0x82, 0x82, 0x92, 0x71, 0xB2, 0x61, 0xC2, 0x51, 0xD2, 0x41,
+  0xE2, 0x31, 0xF0, 0x21, 0x2F, 0x14, 0xF2, 0x21, 0x3F, 0x02, 0x23, 0xE2,
+  0x33, 0xD2, 0x53, 0xB2, 0x63, 0xA2, 0x73, 0x92, 0x84, 0x64, 0x75, 0x38,
+  0x49, 0x08, 0x82, 0x42, 0xA1, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF6, 0x1F, 0xF0, 0x22, 0x1A, 0x12, 0x23, 0x83, 0x05, 0xF0, 0x73, 0x1F,
+  0x22, 0x21, 0xF1, 0x12, 0x1F, 0xF1, 0x11, 0x1B, 0x2F, 0xF5, 0x11, 0x19,
+  0x2F, 0xF9, 0x17, 0x2D, 0x1F, 0xC1, 0x52, 0xF0, 0x1F, 0xC1, 0x32, 0xF2,
+  0x1F, 0xC1, 0x12, 0xF4, 0x1F, 0xC1, 0xE1, 0x11, 0x51, 0x21, 0x51, 0x21,
+  0x22, 0x32, 0xA2, 0x42, 0x04, 0xA9, 0x21, 0x92, 0x23, 0x22, 0x11, 0xA1,
+  0xA1, 0xF6, 0x1F, 0x31, 0x21, 0xF3, 0x1F, 0x61, 0x11, 0xF4, 0x11, 0x1F,
+  0x41, 0x11, 0xF4, 0x11, 0x1F, 0x61, 0xF3, 0x1F, 0x61, 0x11, 0xF4, 0x11,
+  0x1F, 0x41, 0x11, 0xF4, 0x18, 0x11, 0x1F, 0x12, 0x32, 0x81, 0x40, 0x67,
+  0xA3, 0x53, 0x72, 0x92, 0x52, 0xB2, 0x32, 0xD2, 0x22, 0xD2, 0x12, 0xF0,
+  0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x12, 0x2D, 0x22,
+  0x2D, 0x23, 0x2B, 0x25, 0x29, 0x27, 0x35, 0x3A, 0x76, 0x0A, 0x42, 0x37,
+  0x41, 0x71, 0x11, 0xC1, 0x11, 0xFF, 0xF8, 0x11, 0x15, 0x14, 0x11, 0x17,
+  0x41, 0x17, 0x6F, 0xFF, 0xFF, 0xE1, 0x21, 0x82, 0x42, 0x60, 0x67, 0xA3,
+  0x53, 0x72, 0x92, 0x52, 0xB2, 0x32, 0xD2, 0x22, 0xD2, 0x12, 0xF0, 0x4F,
+  0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x4F, 0x04, 0xF0, 0x21, 0x2D, 0x22, 0x2D,
+  0x14, 0x2B, 0x25, 0x29, 0x27, 0x35, 0x2A, 0x7E, 0x4F, 0x14, 0xF2, 0x4F,
+  0x24, 0xF3, 0x40, 0x0B, 0xA3, 0x62, 0x92, 0x72, 0x82, 0x82, 0x72, 0x82,
+  0x72, 0x82, 0x72, 0x82, 0x72, 0x72, 0x82, 0x53, 0x99, 0xA2, 0x33, 0xB2,
+  0x42, 0xB2, 0x43, 0xA2, 0x53, 0x92, 0x63, 0x82, 0x73, 0x72, 0x83, 0x54,
+  0x83, 0x28, 0x74, 0x35, 0x31, 0x23, 0x44, 0x12, 0x73, 0x12, 0x82, 0x12,
+  0x91, 0x13, 0x81, 0x24, 0xB3, 0xB4, 0xB3, 0xB4, 0xB3, 0xB4, 0xA3, 0xA4,
+  0x95, 0x72, 0x15, 0x42, 0x21, 0x36, 0x30, 0x0F, 0x12, 0x52, 0x53, 0x1C,
+  0x1F, 0x21, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x12, 0x1A,
+  0x24, 0x24, 0x08, 0x59, 0x42, 0x52, 0x32, 0x21, 0x21, 0x91, 0x11, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0xB2, 0x81, 0xF3, 0x11,
+  0x25, 0x39, 0x21, 0x75, 0x07, 0x78, 0x41, 0x71, 0x32, 0x21, 0x21, 0xB1,
+  0x51, 0x11, 0xA1, 0xFF, 0x72, 0x81, 0x11, 0xFF, 0xA1, 0x52, 0xA1, 0xFF,
+  0xA1, 0x11, 0x32, 0xFF, 0x72, 0xE1, 0x11, 0xFF, 0x81, 0x12, 0xFF, 0xF3,
+  0x07, 0x18, 0x57, 0x41, 0x13, 0x41, 0x51, 0x31, 0x21, 0x81, 0xC1, 0x41,
+  0x81, 0xA1, 0xFF, 0xA1, 0xF2, 0x11, 0x16, 0x11, 0x15, 0x2F, 0xFF, 0xF0,
+  0x11, 0x13, 0x23, 0x13, 0x2F, 0x31, 0xFF, 0xF0, 0x11, 0x25, 0x11, 0x2B,
+  0x18, 0x1F, 0xFF, 0x02, 0xF7, 0x18, 0x11, 0x2F, 0xFF, 0xD0, 0x09, 0x47,
+  0x25, 0x83, 0x53, 0x92, 0x73, 0x72, 0x92, 0x71, 0xB2, 0x51, 0xC3, 0x31,
+  0xE3, 0x11, 0xF1, 0x4F, 0x22, 0xF3, 0x3F, 0x11, 0x13, 0xE1, 0x32, 0xD1,
+  0x52, 0xB1, 0x63, 0x91, 0x82, 0x82, 0x92, 0x63, 0x94, 0x26, 0x68, 0x08,
+  0x69, 0x32, 0x61, 0x32, 0x32, 0x11, 0x92, 0xF1, 0x29, 0x11, 0x1F, 0xA2,
+  0xB1, 0x11, 0x32, 0xFF, 0x31, 0x11, 0x12, 0xFF, 0x51, 0x12, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF1, 0x12, 0x1E, 0x24, 0x26, 0x2E, 0x41, 0xA2, 0x41, 0xA2,
+  0x51, 0x92, 0x61, 0x83, 0xF0, 0x2F, 0x02, 0xF0, 0x3E, 0x3F, 0x02, 0xF0,
+  0x2F, 0x03, 0xF0, 0x2F, 0x02, 0xF0, 0x2C, 0x12, 0x3C, 0x12, 0x2C, 0x21,
+  0x2C, 0x21, 0xF2, 0x10, 0x05, 0x23, 0xFF, 0xFF, 0xFF, 0xF2, 0x30, 0x12,
+  0xFF, 0x01, 0x11, 0xF7, 0x11, 0x1F, 0xF0, 0x11, 0x1F, 0xF0, 0x11, 0x1F,
+  0x71, 0x11, 0x80, 0x08, 0xFF, 0xFF, 0xFF, 0xF2, 0x32, 0x04, 0x00, 0xE0,
+  0x0E, 0x01, 0xB0, 0x31, 0x83, 0x18, 0x60, 0xCC, 0x06, 0xC0, 0x60, 0x0E,
+  0xF3, 0x8C, 0x30, 0x80, 0x3F, 0x06, 0x38, 0xC1, 0x8C, 0x18, 0x01, 0x80,
+  0x38, 0x1D, 0x86, 0x18, 0xC1, 0x8C, 0x18, 0xE1, 0x9F, 0xFE, 0x79, 0xC0,
+  0x22, 0x92, 0xB2, 0xFF, 0xFB, 0x48, 0x14, 0x16, 0x52, 0x15, 0x14, 0x12,
+  0x1F, 0x81, 0xFF, 0xF6, 0x11, 0x1F, 0x21, 0x41, 0x11, 0x32, 0x16, 0x20,
+  0x0F, 0x0C, 0x66, 0x0D, 0x03, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0x78,
+  0x17, 0x08, 0xFC, 0x1E, 0x00, 0x92, 0x92, 0xB2, 0xFF, 0xF2, 0x47, 0x51,
+  0x15, 0x11, 0x13, 0x17, 0x15, 0x14, 0x1F, 0xFF, 0x81, 0xF8, 0x12, 0x14,
+  0x15, 0x12, 0x52, 0x22, 0x14, 0x13, 0x20, 0x1E, 0x08, 0xE4, 0x19, 0x07,
+  0xFF, 0xF0, 0x0C, 0x03, 0x00, 0xE0, 0x78, 0x17, 0x08, 0xFE, 0x1E, 0x00,
+  0x55, 0x44, 0x31, 0x41, 0x22, 0x41, 0x62, 0xF7, 0x22, 0x34, 0x22, 0x3F,
+  0xFF, 0xFF, 0xFF, 0x92, 0x22, 0x50, 0x0F, 0x03, 0x3F, 0x61, 0xC6, 0x0C,
+  0x60, 0xC6, 0x0C, 0x70, 0xC3, 0x18, 0x1F, 0x02, 0x00, 0x60, 0x07, 0xFC,
+  0x1F, 0xF2, 0x01, 0x40, 0x1C, 0x01, 0xE0, 0x67, 0xFC, 0x3F, 0x00, 0x31,
+  0xB2, 0xB1, 0xD2, 0xFF, 0xF2, 0x39, 0x23, 0x17, 0x11, 0x32, 0x16, 0x23,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xB2, 0x22, 0x22, 0x22, 0x22, 0xA2, 0xF7, 0x22,
+  0x24, 0x2F, 0xFF, 0xD2, 0x22, 0x52, 0xC2, 0xFB, 0x23, 0x25, 0x2F, 0xFF,
+  0xFF, 0xF9, 0x47, 0x31, 0x31, 0xB2, 0xB1, 0xD2, 0xFF, 0xF2, 0x68, 0x21,
+  0x38, 0x3A, 0x3A, 0x2B, 0x11, 0x1B, 0x12, 0x1B, 0x1E, 0x11, 0x1C, 0x11,
+  0x1E, 0x1B, 0x12, 0x12, 0x22, 0x22, 0x13, 0x20, 0x22, 0x33, 0x43, 0x42,
+  0x32, 0x31, 0x21, 0x31, 0x32, 0x21, 0x13, 0x34, 0x21, 0x62, 0x31, 0x12,
+  0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x22, 0x22, 0x22, 0x21, 0x22,
+  0x20, 0x22, 0x33, 0x42, 0x32, 0x31, 0x32, 0x21, 0x13, 0x21, 0x62, 0x31,
+  0xFF, 0xFF, 0xFF, 0xFB, 0x22, 0x22, 0x22, 0x20, 0x0F, 0x03, 0x1C, 0x60,
+  0x64, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x02, 0x60,
+  0x63, 0x8C, 0x0F, 0x00, 0x22, 0x24, 0x32, 0x31, 0x41, 0x22, 0x25, 0x21,
+  0x51, 0x41, 0x21, 0xA1, 0xFF, 0xFF, 0x61, 0xA1, 0x61, 0x41, 0x11, 0x57,
+  0x74, 0xFF, 0xFB, 0x22, 0x27, 0x44, 0x21, 0x48, 0x41, 0x11, 0x41, 0x61,
+  0xA1, 0xFF, 0xFF, 0x61, 0xA1, 0x21, 0x41, 0x51, 0x25, 0x61, 0x41, 0x84,
+  0xFF, 0xFF, 0x52, 0x22, 0x22, 0x23, 0x12, 0x31, 0x33, 0x24, 0x61, 0x32,
+  0xFF, 0xFF, 0xF5, 0x22, 0x24, 0x3E, 0x46, 0xC2, 0xC0, 0xE0, 0x78, 0x3C,
+  0x0E, 0x07, 0x83, 0x83, 0xE6, 0x9C, 0x31, 0xE1, 0x61, 0x61, 0x33, 0x12,
+  0x23, 0xFF, 0xFF, 0xF2, 0x42, 0x13, 0x20, 0x04, 0x44, 0x22, 0x62, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x01, 0x32, 0x61, 0x23, 0x11, 0x22, 0x31, 0x32, 0x32,
+  0x06, 0x35, 0x41, 0x31, 0x21, 0x11, 0x91, 0x31, 0xF4, 0x25, 0x11, 0x1F,
+  0xB1, 0x12, 0x71, 0xFB, 0x11, 0x2F, 0xF0, 0x05, 0x26, 0x25, 0x31, 0x21,
+  0x32, 0x21, 0x21, 0x11, 0x61, 0x81, 0xF9, 0x16, 0x13, 0x24, 0x15, 0x2F,
+  0xF3, 0x14, 0x11, 0x11, 0x26, 0x13, 0x2F, 0xF3, 0x11, 0x23, 0x11, 0x2F,
+  0xFC, 0x7C, 0xF1, 0xC3, 0x06, 0x30, 0x19, 0x00, 0xD0, 0x03, 0x00, 0x0C,
+  0x00, 0xE0, 0x09, 0x80, 0x46, 0x04, 0x30, 0xC0, 0xCF, 0x8F, 0x80, 0x05,
+  0x44, 0x31, 0x41, 0x11, 0x11, 0x71, 0xC1, 0x31, 0x11, 0xF0, 0x27, 0x19,
+  0x1F, 0x02, 0x71, 0x11, 0xF7, 0x11, 0x1F, 0x62, 0xFF, 0x32, 0x62, 0xC3,
+  0x70, 0x1A, 0x11, 0x62, 0x21, 0x53, 0x82, 0x82, 0x82, 0x83, 0x82, 0x82,
+  0x82, 0x61, 0x13, 0x61, 0x12, 0x6D, 0x51, 0x33, 0x41, 0x31, 0xFF, 0xC1,
+  0x32, 0x31, 0x51, 0x11, 0x41, 0x11, 0xFF, 0xA1, 0x71, 0x41, 0x11, 0x0F,
+  0xFF, 0x50, 0x81, 0x82, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0x02, 0x0C,
+  0x63, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x86, 0x30, 0x38, 0x05, 0xF8, 0x1C,
+  0x78, 0xE0, 0x7E, 0x80, 0x70, 0x0D, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x4B, 0x10, 0x1B, 0x32, 0x32, 0x23, 0x71, 0xC2, 0xFF, 0xFF, 0xFF,
+  0x82, 0x32, 0x20, 0x72, 0xC2, 0xE2, 0xFF, 0xFF, 0x03, 0x43, 0x51, 0x13,
+  0x23, 0x11, 0x31, 0x11, 0x21, 0x21, 0x21, 0x11, 0xF2, 0x11, 0x1A, 0x11,
+  0x1F, 0xFF, 0xFF, 0x21, 0x21, 0x11, 0xC1, 0xF2, 0x11, 0x42, 0x41, 0x13,
+  0x52, 0x5F, 0xFF, 0xFB, 0x22, 0x25, 0x06, 0x27, 0x32, 0x21, 0x32, 0x11,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x22, 0x53, 0x11, 0xC1, 0x1C, 0x1F, 0x00,
+  0x05, 0x27, 0x31, 0x21, 0x32, 0x31, 0x41, 0xFF, 0xF1, 0x14, 0x15, 0x12,
+  0x56, 0x6F, 0xF9, 0x1A, 0x23, 0x20, 0x06, 0x16, 0x17, 0x32, 0x11, 0x32,
+  0x12, 0x31, 0x11, 0x61, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xF3,
+  0x13, 0x52, 0x52, 0x20, 0x06, 0x16, 0x17, 0x32, 0x11, 0x32, 0x12, 0x31,
+  0x11, 0x61, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0xF3, 0x13, 0x52,
+  0x52, 0xF5, 0xF5, 0x1F, 0x60, 0x08, 0x72, 0x22, 0x61, 0xB1, 0xFF, 0xE5,
+  0x84, 0x12, 0xA1, 0xFA, 0x1E, 0x12, 0x22, 0x41, 0x11, 0x06, 0x58, 0x32,
+  0x52, 0x32, 0x11, 0xFF, 0xFF, 0xE5, 0xD4, 0x12, 0xF0, 0x1F, 0xF5, 0x1F,
+  0x41, 0x72, 0x24, 0x11, 0x21, 0x32, 0x06, 0x51, 0x32, 0x61, 0xFF, 0xF1,
+  0x56, 0x41, 0x28, 0x1F, 0x61, 0xC3, 0x24, 0x11, 0x10, 0x3E, 0x38, 0xCC,
+  0x1A, 0x03, 0x00, 0xC0, 0x31, 0xFC, 0x03, 0x00, 0xC0, 0x28, 0x19, 0x0C,
+  0x3E, 0x00, 0xFC, 0x1E, 0x0E, 0x0C, 0x70, 0xC3, 0x07, 0x18, 0x60, 0x73,
+  0x18, 0x0E, 0x63, 0x01, 0xCF, 0xE0, 0x19, 0x8C, 0x03, 0x31, 0xC0, 0x66,
+  0x38, 0x1C, 0xC3, 0x83, 0x18, 0x30, 0xCF, 0xC3, 0xF0, 0x03, 0xF1, 0xCE,
+  0x38, 0xE3, 0x0E, 0x38, 0xE3, 0x8E, 0x0F, 0xE0, 0x6E, 0x0E, 0xE1, 0xCE,
+  0x18, 0xE3, 0x8E, 0x71, 0xF0, 0x0E, 0x12, 0xF0, 0x13, 0x7F, 0xF0, 0x1F,
+  0xFF, 0xF7, 0x69, 0x42, 0x2B, 0x13, 0x1B, 0x1F, 0xFF, 0xE1, 0x51, 0x71,
+  0x33, 0x44, 0x22, 0x10, 0x0F, 0x2F, 0x01, 0x38, 0xFF, 0x01, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x33, 0x27, 0x4F, 0x04, 0x2B, 0x28, 0x6F,
+  0xFF, 0x51, 0xFF, 0xFF, 0xFF, 0xF6, 0x1F, 0x41, 0xFF, 0xF9, 0x2F, 0x11,
+  0xF4, 0x1E, 0x31, 0xA3, 0x24, 0xB7, 0x1B, 0x24, 0x1E, 0x12, 0x1F, 0xF6,
+  0x12, 0x59, 0x51, 0x25, 0x54, 0x68, 0x12, 0x53, 0x52, 0x13, 0x51, 0x53,
+  0x51, 0xA1, 0x53, 0x42, 0xB1, 0x43, 0x41, 0xC1, 0x43, 0x41, 0xC2, 0x33,
+  0x32, 0xD1, 0x33, 0x22, 0xF0, 0x9E, 0x32, 0x32, 0x2D, 0x32, 0x32, 0x3B,
+  0x33, 0x33, 0x3A, 0x24, 0x33, 0x39, 0x34, 0x34, 0x37, 0x35, 0x35, 0x27,
+  0x35, 0x35, 0x35, 0x36, 0x36, 0x32, 0x53, 0x84, 0x50, 0x45, 0x43, 0x33,
+  0x31, 0x63, 0x21, 0x72, 0x11, 0x83, 0x93, 0x83, 0x93, 0x74, 0x56, 0xA4,
+  0x93, 0xA3, 0x93, 0x93, 0x94, 0x74, 0x11, 0x54, 0x37, 0x30, 0x08, 0x4A,
+  0x42, 0x42, 0x42, 0x21, 0xB1, 0xF4, 0x1F, 0xF8, 0x2F, 0x22, 0xF2, 0x1F,
+  0x31, 0x11, 0xF3, 0x1F, 0x22, 0xF2, 0x2F, 0x21, 0xF3, 0x11, 0x1F, 0x31,
+  0xF3, 0x1F, 0xF5, 0x1F, 0x22, 0x42, 0x52, 0x32, 0x52, 0x62, 0xC1, 0xF2,
+  0x16, 0x1D, 0x11, 0x42, 0x1C, 0x76, 0x84, 0xA4, 0x24, 0x24, 0x22, 0x1B,
+  0x1F, 0x41, 0xFF, 0x82, 0xF2, 0x2F, 0x21, 0xF3, 0x11, 0x1F, 0x31, 0xF2,
+  0x2F, 0x22, 0xF2, 0x1F, 0x31, 0x11, 0xF3, 0x1F, 0x31, 0xFF, 0x51, 0xF2,
+  0x24, 0x25, 0x23, 0x20, 0x08, 0x72, 0x44, 0x75, 0x43, 0x62, 0x13, 0x43,
+  0x52, 0x93, 0x51, 0xA3, 0x51, 0xA3, 0x41, 0xB3, 0x32, 0xB3, 0x22, 0xC7,
+  0xC3, 0x23, 0xB3, 0x33, 0xA3, 0x34, 0x93, 0x43, 0x93, 0x53, 0x83, 0x63,
+  0x73, 0x64, 0x54, 0x73, 0x38, 0x65, 0x3F, 0x03, 0x2B, 0x27, 0x6F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x52, 0x22, 0xE2, 0x81, 0x91,
+  0x52, 0x42, 0x0F, 0x7F, 0x12, 0x21, 0x39, 0xF7, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xB1, 0x21, 0x22, 0x42, 0x51, 0x42,
+  0x08, 0x66, 0x24, 0xA2, 0x53, 0xA1, 0x63, 0x92, 0x73, 0x81, 0x84, 0x71,
+  0x93, 0x61, 0xA4, 0x51, 0xB3, 0x41, 0xC4, 0x31, 0xD3, 0x22, 0xE3, 0x11,
+  0xF0, 0x5F, 0x13, 0xF2, 0x3F, 0x31, 0xF3, 0x2D, 0x31, 0x2E, 0x5B, 0x78,
+  0xF0, 0x4F, 0x23, 0xEB, 0x83, 0x33, 0x43, 0x42, 0x53, 0x53, 0x23, 0x53,
+  0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x66, 0x63, 0x63, 0x13,
+  0x53, 0x63, 0x13, 0x53, 0x53, 0x33, 0x43, 0x43, 0x6D, 0xD3, 0xF3, 0x3F,
+  0x18, 0x60, 0x08, 0x4A, 0x42, 0x42, 0x42, 0x21, 0xB1, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x1B, 0x15, 0x24, 0x84, 0xF3,
+  0xF5, 0x2F, 0x51, 0xFF, 0xB0, 0x09, 0x2B, 0x42, 0x22, 0x42, 0x61, 0x61,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x12, 0x31, 0x49, 0x14, 0x11, 0x3A, 0x6F,
+  0xFF, 0xFF, 0xF7, 0x1F, 0x12, 0x42, 0x08, 0x28, 0x39, 0x42, 0x22, 0x42,
+  0x31, 0x42, 0x51, 0x61, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x61, 0xF0, 0x24, 0x64, 0x73,
+  0x20, 0x08, 0x28, 0x39, 0x42, 0x22, 0x42, 0x31, 0x42, 0x51, 0x61, 0x91,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xC1, 0x61, 0xF0, 0x24, 0x64, 0x73, 0xFC, 0xFD, 0x1F, 0xD1, 0xFF,
+  0xFC, 0x0B, 0xF1, 0x28, 0x5F, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x6C, 0x42,
+  0x2E, 0x13, 0x1E, 0x1F, 0xFF, 0xFB, 0x18, 0x17, 0x13, 0x13, 0x24, 0x42,
+  0x21, 0x08, 0x8B, 0x42, 0x82, 0x43, 0x21, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x6F, 0x44, 0x22, 0xF6, 0x13, 0x1F, 0x61, 0xFF, 0xFF, 0xFF,
+  0x91, 0xF0, 0x17, 0x13, 0x1B, 0x14, 0x42, 0x22, 0x33, 0x30, 0x08, 0x72,
+  0x42, 0xF9, 0x12, 0x1F, 0xFF, 0xFF, 0xE7, 0x85, 0x22, 0xB1, 0x31, 0xB1,
+  0xFF, 0xFE, 0x15, 0x17, 0x13, 0x33, 0x52, 0x21, 0x11, 0x36, 0x74, 0x53,
+  0x43, 0x92, 0x32, 0xB2, 0x21, 0xD1, 0x21, 0xD2, 0xF0, 0x2F, 0x12, 0xF0,
+  0x25, 0xCF, 0x02, 0xF0, 0x2F, 0x01, 0xF0, 0x2F, 0x02, 0x11, 0xC2, 0x31,
+  0xA2, 0x52, 0x63, 0x86, 0x70, 0x08, 0x85, 0x72, 0x42, 0x62, 0x17, 0x61,
+  0xA1, 0x12, 0x41, 0x21, 0xF0, 0x11, 0x17, 0x12, 0x1D, 0x1B, 0x1E, 0x12,
+  0x1C, 0x1F, 0xFF, 0xB1, 0xFF, 0x44, 0xF9, 0x4F, 0xFF, 0xFD, 0x1F, 0xF8,
+  0x12, 0x1F, 0xF7, 0x12, 0x1C, 0x12, 0x1A, 0x14, 0x19, 0x12, 0x15, 0x21,
+  0x13, 0x24, 0x25, 0x21, 0x52, 0x14, 0x8B, 0x63, 0x53, 0x72, 0x72, 0x82,
+  0x72, 0x72, 0x82, 0x72, 0x82, 0x73, 0x72, 0x82, 0x72, 0x94, 0x42, 0xA9,
+  0xC3, 0x22, 0xB3, 0x32, 0xA3, 0x42, 0x93, 0x52, 0x83, 0x62, 0x73, 0x72,
+  0x63, 0x82, 0x53, 0x93, 0x24, 0x78, 0x01, 0xF0, 0x7F, 0x87, 0xE0, 0x60,
+  0x02, 0x00, 0x20, 0x01, 0x1C, 0x0B, 0x38, 0xB0, 0x65, 0x03, 0xB8, 0x0D,
+  0xC0, 0x7E, 0x03, 0xF0, 0x1D, 0x80, 0xCC, 0x06, 0x70, 0x21, 0xC3, 0x07,
+  0xE0, 0xFC, 0x0E, 0x78, 0xC3, 0x98, 0x73, 0x0E, 0x63, 0x8F, 0xE1, 0x87,
+  0x30, 0x66, 0x0C, 0xC1, 0x98, 0x7F, 0xF8, 0x0A, 0x12, 0x24, 0xB1, 0xB2,
+  0xA1, 0xFF, 0xFF, 0xF2, 0x22, 0x25, 0x2C, 0x22, 0x14, 0x32, 0xFF, 0xFF,
+  0xFF, 0xB2, 0xFA, 0x2A, 0x21, 0x63, 0x22, 0xA3, 0x1A, 0x1F, 0x00, 0x43,
+  0xF1, 0x38, 0x70, 0xED, 0x0C, 0x78, 0x43, 0x10, 0x08, 0xC8, 0x03, 0x32,
+  0x00, 0x7F, 0x80, 0x33, 0x70, 0x1C, 0xCC, 0x0E, 0x33, 0x83, 0x0C, 0x61,
+  0xC7, 0x0C, 0xE3, 0xF3, 0xC0, 0x5E, 0x18, 0x64, 0x1D, 0x03, 0x01, 0xC0,
+  0xE0, 0xF0, 0x07, 0x00, 0xC0, 0x30, 0x0D, 0x07, 0x3F, 0x80, 0x06, 0x27,
+  0x32, 0x21, 0x32, 0x11, 0xFF, 0x41, 0xC2, 0xB2, 0xB2, 0xFA, 0x2C, 0x1A,
+  0x1C, 0x13, 0x22, 0x13, 0x20, 0x23, 0x42, 0x51, 0xF1, 0x11, 0x21, 0x16,
+  0x7A, 0x17, 0x62, 0x73, 0x22, 0x13, 0x21, 0x1F, 0xF4, 0x1C, 0x2B, 0x2B,
+  0x2F, 0xA2, 0xC1, 0xA1, 0xC1, 0x32, 0x21, 0x32, 0xFC, 0x23, 0x87, 0x8C,
+  0x28, 0x62, 0x03, 0x10, 0x19, 0x00, 0xF8, 0x06, 0x60, 0x33, 0x81, 0x8C,
+  0x0C, 0x30, 0x61, 0xCF, 0xC7, 0x80, 0x2C, 0x22, 0x14, 0x32, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x62, 0x12, 0xB1, 0x42, 0x32, 0x04, 0x85, 0xE1, 0x11, 0x21,
+  0x61, 0x21, 0xF7, 0x14, 0x27, 0x1F, 0x62, 0x91, 0x11, 0xFF, 0x23, 0xB1,
+  0xB1, 0x61, 0x71, 0x21, 0x21, 0x32, 0x22, 0x06, 0x27, 0x32, 0x21, 0x32,
+  0x11, 0xFF, 0xFD, 0x59, 0x5F, 0xFF, 0x31, 0xC1, 0x32, 0x21, 0x32, 0x0F,
+  0x03, 0x53, 0x21, 0x1F, 0xFF, 0xFF, 0xFF, 0xF5, 0x1C, 0x13, 0x22, 0x13,
+  0x20, 0xF4, 0x34, 0x3F, 0xF8, 0x34, 0x33, 0xF0, 0x12, 0xF1, 0x13, 0x8F,
+  0xFF, 0x31, 0xD1, 0xFF, 0x01, 0xA5, 0xB6, 0xFF, 0x21, 0xFF, 0xF5, 0x1E,
+  0x13, 0x1A, 0x11, 0x34, 0x73, 0x71, 0x42, 0x23, 0x32, 0x23, 0xFF, 0x53,
+  0x52, 0x23, 0x21, 0x52, 0x12, 0x5F, 0x08, 0x28, 0x28, 0x28, 0x36, 0x11,
+  0x34, 0x21, 0x83, 0x62 };
+
+const RleGlyph TimesNRCyr14pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   7,    0,    1, 0 },  // 0x20 ' '
+  {     0,   2,  19,   7,    3,  -18, 1 },  // 0x21 '!'
+  {     4,   6,   8,  11,    2,  -18, 0 },  // 0x22 '"'
+  {    10,  15,  19,  18,    1,  -18, 2 },  // 0x23 '#'
+  {    42,  11,  23,  14,    1,  -20, 0 },  // 0x24 '$'
+  {    74,  20,  19,  22,    1,  -18, 0 },  // 0x25 '%'
+  {   122,  19,  19,  21,    1,  -18, 1 },  // 0x26 '&'
+  {   165,   2,   8,   5,    1,  -18, 0 },  // 0x27 '''
+  {   167,   7,  25,   9,    1,  -18, 2 },  // 0x28 '('
+  {   186,   7,  25,   9,    1,  -18, 2 },  // 0x29 ')'
+  {   206,   9,  11,  14,    2,  -18, 0 },  // 0x2A '*'
+  {   219,  14,  14,  18,    2,  -15, 2 },  // 0x2B '+'
+  {   229,   3,   7,   7,    2,   -2, 0 },  // 0x2C ','
+  {   232,   7,   2,   9,    1,   -6, 1 },  // 0x2D '-'
+  {   233,   3,   3,   7,    2,   -2, 1 },  // 0x2E '.'
+  {   234,   9,  20,   8,    0,  -18, 2 },  // 0x2F '/'
+  {   251,  11,  19,  14,    1,  -18, 2 },  // 0x30 '0'
+  {   273,   6,  19,  14,    4,  -18, 2 },  // 0x31 '1'
+  {   282,  11,  19,  14,    2,  -18, 1 },  // 0x32 '2'
+  {   306,  10,  19,  14,    2,  -18, 1 },  // 0x33 '3'
+  {   329,  12,  19,  14,    1,  -18, 2 },  // 0x34 '4'
+  {   346,  10,  19,  14,    2,  -18, 1 },  // 0x35 '5'
+  {   367,  11,  19,  14,    1,  -18, 0 },  // 0x36 '6'
+  {   394,  11,  19,  14,    1,  -18, 2 },  // 0x37 '7'
+  {   408,  10,  19,  14,    2,  -18, 0 },  // 0x38 '8'
+  {   432,  11,  19,  14,    1,  -18, 0 },  // 0x39 '9'
+  {   459,   3,  13,   7,    2,  -12, 1 },  // 0x3A ':'
+  {   462,   3,  17,   7,    2,  -12, 0 },  // 0x3B ';'
+  {   469,  14,  13,  18,    2,  -14, 1 },  // 0x3C '<'
+  {   482,  14,   8,  18,    2,  -12, 1 },  // 0x3D '='
+  {   487,  14,  13,  18,    2,  -14, 1 },  // 0x3E '>'
+  {   501,   8,  19,  10,    1,  -18, 0 },  // 0x3F '?'
+  {   520,  23,  25,  25,    1,  -18, 2 },  // 0x40 '@'
+  {   583,  20,  19,  21,    0,  -18, 2 },  // 0x41 'A'
+  {   611,  15,  19,  18,    1,  -18, 2 },  // 0x42 'B'
+  {   644,  17,  19,  19,    1,  -18, 1 },  // 0x43 'C'
+  {   678,  20,  19,  22,    1,  -18, 2 },  // 0x44 'D'
+  {   712,  16,  19,  18,    1,  -18, 2 },  // 0x45 'E'
+  {   737,  16,  19,  18,    1,  -18, 2 },  // 0x46 'F'
+  {   759,  21,  19,  22,    1,  -18, 1 },  // 0x47 'G'
+  {   794,  20,  19,  22,    1,  -18, 2 },  // 0x48 'H'
+  {   821,   8,  19,  10,    1,  -18, 2 },  // 0x49 'I'
+  {   833,  12,  19,  12,    0,  -18, 2 },  // 0x4A 'J'
+  {   850,  21,  19,  22,    1,  -18, 1 },  // 0x4B 'K'
+  {   889,  16,  19,  18,    1,  -18, 2 },  // 0x4C 'L'
+  {   908,  25,  19,  27,    1,  -18, 2 },  // 0x4D 'M'
+  {   952,  21,  19,  22,    0,  -18, 2 },  // 0x4E 'N'
+  {   995,  19,  19,  21,    1,  -18, 1 },  // 0x4F 'O'
+  {  1029,  14,  19,  16,    1,  -18, 2 },  // 0x50 'P'
+  {  1054,  19,  24,  21,    1,  -18, 1 },  // 0x51 'Q'
+  {  1095,  19,  19,  21,    1,  -18, 1 },  // 0x52 'R'
+  {  1131,  13,  19,  15,    1,  -18, 1 },  // 0x53 'S'
+  {  1159,  16,  19,  18,    1,  -18, 2 },  // 0x54 'T'
+  {  1178,  20,  19,  22,    1,  -18, 2 },  // 0x55 'U'
+  {  1204,  20,  19,  18,   -1,  -18, 2 },  // 0x56 'V'
+  {  1236,  26,  19,  27,    1,  -18, 2 },  // 0x57 'W'
+  {  1282,  20,  19,  21,    0,  -18, 1 },  // 0x58 'X'
+  {  1319,  20,  19,  21,    1,  -18, 2 },  // 0x59 'Y'
+  {  1351,  18,  19,  18,    0,  -18, 1 },  // 0x5A 'Z'
+  {  1384,   5,  24,   7,    2,  -18, 2 },  // 0x5B '['
+  {  1391,   8,  20,   8,    0,  -18, 2 },  // 0x5C
+  {  1407,   5,  24,   7,    0,  -18, 2 },  // 0x5D ']'
+  {  1413,  12,   9,  16,    2,  -18, 0 },  // 0x5E '^'
+  {  1427,  14,   1,  14,    0,    3, 1 },  // 0x5F '_'
+  {  1428,   5,   5,   9,    2,  -18, 0 },  // 0x60 '`'
+  {  1432,  12,  13,  14,    1,  -12, 0 },  // 0x61 'a'
+  {  1452,  13,  19,  15,    0,  -18, 2 },  // 0x62 'b'
+  {  1476,  10,  13,  12,    1,  -12, 0 },  // 0x63 'c'
+  {  1493,  13,  19,  15,    1,  -18, 2 },  // 0x64 'd'
+  {  1519,  10,  13,  12,    1,  -12, 0 },  // 0x65 'e'
+  {  1536,  11,  19,   9,    0,  -18, 2 },  // 0x66 'f'
+  {  1554,  12,  19,  14,    1,  -12, 0 },  // 0x67 'g'
+  {  1583,  14,  19,  15,    0,  -18, 2 },  // 0x68 'h'
+  {  1604,   6,  19,   7,    0,  -18, 2 },  // 0x69 'i'
+  {  1613,   7,  25,   7,   -3,  -18, 2 },  // 0x6A 'j'
+  {  1624,  14,  19,  15,    0,  -18, 2 },  // 0x6B 'k'
+  {   273,   6,  19,   7,    0,  -18, 2 },  // 0x6C 'l'
+  {  1652,  21,  13,  22,    0,  -12, 2 },  // 0x6D 'm'
+  {  1681,  14,  13,  15,    0,  -12, 2 },  // 0x6E 'n'
+  {  1700,  12,  13,  15,    1,  -12, 0 },  // 0x6F 'o'
+  {  1720,  13,  19,  15,    0,  -12, 2 },  // 0x70 'p'
+  {  1745,  13,  19,  15,    1,  -12, 2 },  // 0x71 'q'
+  {  1768,  10,  13,  10,    0,  -12, 2 },  // 0x72 'r'
+  {  1781,   8,  13,  10,    1,  -12, 0 },  // 0x73 's'
+  {  1794,   8,  17,   9,    0,  -16, 2 },  // 0x74 't'
+  {  1807,  14,  13,  15,    0,  -12, 2 },  // 0x75 'u'
+  {  1824,  13,  13,  14,    0,  -12, 2 },  // 0x76 'v'
+  {  1843,  19,  13,  19,    0,  -12, 2 },  // 0x77 'w'
+  {  1873,  13,  13,  14,    0,  -12, 0 },  // 0x78 'x'
+  {  1895,  12,  19,  14,    1,  -12, 2 },  // 0x79 'y'
+  {  1921,  11,  13,  12,    0,  -12, 1 },  // 0x7A 'z'
+  {  1938,   6,  24,  13,    3,  -18, 2 },  // 0x7B '{'
+  {  1955,   2,  25,   5,    2,  -18, 1 },  // 0x7C '|'
+  {  1958,   6,  24,  13,    2,  -18, 0 },  // 0x7D '}'
+  {  1976,  14,   5,  18,    2,  -11, 0 },  // 0x7E '~'
+  {  1985,  13,  17,  20,    3,  -16, 2 },  // 0x7F
+  {  1720,  13,  19,  15,    0,  -12, 2 },  // 0x80
+  {  1476,  10,  13,  12,    1,  -12, 0 },  // 0x81
+  {  1995,  12,  13,  13,    0,  -12, 2 },  // 0x82
+  {  1895,  12,  19,  14,    1,  -12, 2 },  // 0x83
+  {  2007,  16,  25,  18,    1,  -18, 2 },  // 0x84
+  {  1873,  13,  13,  14,    0,  -12, 0 },  // 0x85
+  {  2046,  14,  16,  15,    1,  -12, 2 },  // 0x86
+  {  2064,  13,  13,  14,    1,  -12, 2 },  // 0x87
+  {  2082,  20,  13,  22,    1,  -12, 2 },  // 0x88
+  {  2104,  20,  16,  22,    1,  -12, 2 },  // 0x89
+  {  2129,  13,  13,  15,    1,  -12, 2 },  // 0x8A
+  {  2145,  18,  13,  19,    1,  -12, 2 },  // 0x8B
+  {  2166,  11,  13,  13,    1,  -12, 2 },  // 0x8C
+  {  2181,  10,  13,  12,    1,  -12, 0 },  // 0x8D
+  {  2198,  19,  13,  21,    1,  -12, 0 },  // 0x8E
+  {  2229,  12,  13,  13,    0,  -12, 0 },  // 0x8F
+  {   583,  20,  19,  21,    0,  -18, 2 },  // 0x90
+  {  2249,  15,  19,  17,    1,  -18, 2 },  // 0x91
+  {   611,  15,  19,  18,    1,  -18, 2 },  // 0x92
+  {  2272,  15,  19,  17,    1,  -18, 2 },  // 0x93
+  {  2287,  19,  24,  20,    0,  -18, 2 },  // 0x94
+  {   712,  16,  19,  18,    1,  -18, 2 },  // 0x95
+  {  2316,  25,  19,  27,    1,  -18, 1 },  // 0x96
+  {  2373,  12,  19,  14,    1,  -18, 1 },  // 0x97
+  {  2398,  20,  19,  22,    1,  -18, 2 },  // 0x98
+  {  2432,  20,  24,  22,    1,  -23, 2 },  // 0x99
+  {  2476,  19,  19,  20,    1,  -18, 1 },  // 0x9A
+  {  2514,  18,  19,  20,    1,  -18, 2 },  // 0x9B
+  {   908,  25,  19,  27,    1,  -18, 2 },  // 0x9C
+  {   794,  20,  19,  22,    1,  -18, 2 },  // 0x9D
+  {   995,  19,  19,  21,    1,  -18, 1 },  // 0x9E
+  {  2534,  20,  19,  22,    1,  -18, 2 },  // 0x9F
+  {  1029,  14,  19,  16,    1,  -18, 2 },  // 0xA0
+  {   644,  17,  19,  19,    1,  -18, 1 },  // 0xA1
+  {  1159,  16,  19,  18,    1,  -18, 2 },  // 0xA2
+  {  2556,  20,  19,  20,    0,  -18, 1 },  // 0xA3
+  {  2591,  21,  19,  23,    1,  -18, 1 },  // 0xA4
+  {  1282,  20,  19,  21,    0,  -18, 1 },  // 0xA5
+  {  2630,  20,  24,  22,    1,  -18, 2 },  // 0xA6
+  {  2657,  19,  19,  20,    0,  -18, 2 },  // 0xA7
+  {  2682,  28,  19,  30,    1,  -18, 2 },  // 0xA8
+  {  2713,  28,  24,  30,    1,  -18, 2 },  // 0xA9
+  {  2749,  18,  19,  20,    1,  -18, 2 },  // 0xAA
+  {  2773,  25,  19,  26,    1,  -18, 2 },  // 0xAB
+  {  2806,  15,  19,  17,    1,  -18, 2 },  // 0xAC
+  {  2828,  17,  19,  19,    1,  -18, 1 },  // 0xAD
+  {  2861,  28,  19,  30,    1,  -18, 2 },  // 0xAE
+  {  2910,  19,  19,  20,    0,  -18, 1 },  // 0xAF
+  {  1432,  12,  13,  14,    1,  -12, 0 },  // 0xB0
+  {  2946,  13,  19,  15,    1,  -18, 0 },  // 0xB1
+  {  2977,  11,  13,  14,    1,  -12, 0 },  // 0xB2
+  {  2995,  11,  13,  12,    1,  -12, 2 },  // 0xB3
+  {  3006,  14,  16,  14,    0,  -12, 2 },  // 0xB4
+  {  1519,  10,  13,  12,    1,  -12, 0 },  // 0xB5
+  {  3023,  18,  13,  19,    1,  -12, 0 },  // 0xB6
+  {  3053,  10,  13,  11,    0,  -12, 0 },  // 0xB7
+  {  3070,  14,  13,  15,    1,  -12, 2 },  // 0xB8
+  {  3089,  14,  18,  15,    1,  -17, 2 },  // 0xB9
+  {  3116,  13,  13,  14,    1,  -12, 0 },  // 0xBA
+  {  3138,  14,  13,  14,    0,  -12, 2 },  // 0xBB
+  {  3151,  16,  13,  18,    1,  -12, 2 },  // 0xBC
+  {  3175,  14,  13,  15,    1,  -12, 2 },  // 0xBD
+  {  1700,  12,  13,  15,    1,  -12, 0 },  // 0xBE
+  {  3191,  14,  13,  15,    1,  -12, 2 },  // 0xBF
+  {  3205,  16,  24,  18,    1,  -23, 2 },  // 0xC0
+  {  3233,  10,  19,  12,    1,  -18, 1 }   // 0xC1
+};
+
+const RleFont TimesNRCyr14pt8bRle PROGMEM = {
+  TimesNRCyr14pt8bRleData,
+  TimesNRCyr14pt8bRleGlyphs,
+  0x20, 0xC1, 30 };
+
+#endif // TIMESNRCYR14PT8BRLE_H_
@@ -0,0 +1,502 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr16.h, do not edit.
+// 162 glyphs (17 sharing another's bitmap), 3884 bytes of bitmap data (GFXfont: 6538)
+#ifndef TIMESNRCYR16PT8BRLE_H_
+#define TIMESNRCYR16PT8BRLE_H_
+
+const uint8_t TimesNRCyr16pt8bRleData[] PROGMEM = {
+  0x5F, 0xFF, 0xFF, 0xED, 0x24, 0x90, 0x03, 0xFE, 0x03, 0x33, 0xFF, 0x61,
+  0x11, 0x31, 0xA1, 0xF3, 0x82, 0x62, 0xFC, 0x11, 0x15, 0x11, 0x1F, 0xFF,
+  0xD7, 0x26, 0x22, 0xF4, 0x62, 0x62, 0x3F, 0x91, 0x71, 0xC1, 0x71, 0xF7,
+  0x52, 0x62, 0x4F, 0x44, 0x26, 0x25, 0xFF, 0xFF, 0x01, 0x11, 0x51, 0x11,
+  0xF9, 0x02, 0x00, 0x20, 0x02, 0x01, 0xF8, 0x32, 0xE6, 0x26, 0xE2, 0x2E,
+  0x22, 0xE2, 0x2F, 0x20, 0x7A, 0x03, 0xE0, 0x1F, 0x00, 0x78, 0x03, 0xC0,
+  0x2E, 0x02, 0xF0, 0x27, 0x82, 0x78, 0x27, 0xC2, 0x7E, 0x26, 0xF2, 0xC3,
+  0xF8, 0x02, 0x00, 0x20, 0x24, 0xC1, 0x61, 0x12, 0x11, 0xF4, 0x12, 0x1B,
+  0x25, 0x16, 0x18, 0x2F, 0xFF, 0x02, 0xF6, 0x2F, 0x62, 0x91, 0x61, 0xF3,
+  0x12, 0x16, 0x2B, 0x11, 0x21, 0x14, 0x25, 0x44, 0x4B, 0x11, 0x21, 0x1B,
+  0x26, 0x12, 0x1B, 0x25, 0x16, 0x1F, 0xF2, 0x2F, 0x62, 0xF6, 0x2F, 0xF2,
+  0x16, 0x15, 0x2B, 0x12, 0x16, 0x2B, 0x11, 0x21, 0x11, 0x85, 0xF0, 0x33,
+  0x2E, 0x25, 0x2C, 0x35, 0x2C, 0x35, 0x2C, 0x35, 0x1D, 0x34, 0x1F, 0x03,
+  0x21, 0x36, 0x75, 0x54, 0x84, 0x63, 0x72, 0x23, 0x52, 0x71, 0x43, 0x52,
+  0x62, 0x53, 0x32, 0x62, 0x64, 0x21, 0x63, 0x73, 0x12, 0x63, 0x75, 0x73,
+  0x84, 0x74, 0x84, 0x51, 0x14, 0x52, 0x14, 0x41, 0x19, 0x47, 0x45, 0x75,
+  0x20, 0xFF, 0xFF, 0xD2, 0x40, 0x71, 0x62, 0x52, 0x52, 0x51, 0x61, 0x11,
+  0xC1, 0xF2, 0x14, 0x1F, 0xFF, 0xFB, 0x1A, 0x1D, 0x1F, 0x11, 0x11, 0x61,
+  0x82, 0x72, 0x72, 0x01, 0x72, 0x72, 0x72, 0x81, 0x61, 0x11, 0xF1, 0x1D,
+  0x1A, 0x1F, 0xFF, 0xFB, 0x14, 0x1F, 0x21, 0xC1, 0x11, 0x61, 0x52, 0x52,
+  0x52, 0x60, 0x0E, 0x01, 0xC0, 0x38, 0x72, 0x3F, 0x5E, 0x7F, 0x81, 0x01,
+  0xFC, 0xF5, 0xFC, 0x8C, 0x38, 0x07, 0x00, 0xE0, 0x72, 0xFF, 0xFF, 0xFF,
+  0xD7, 0x27, 0xF1, 0x72, 0x7F, 0xFF, 0xFF, 0xF6, 0xDF, 0x92, 0x94, 0xFF,
+  0xFF, 0x09, 0x72, 0xFC, 0x11, 0x1F, 0xB1, 0x11, 0xFB, 0x11, 0x1F, 0xB1,
+  0x11, 0xFB, 0x11, 0x1F, 0xB1, 0xB1, 0xF1, 0x1B, 0x17, 0x45, 0x71, 0x13,
+  0x11, 0x51, 0x11, 0x31, 0x11, 0xF1, 0x19, 0x14, 0x15, 0x13, 0x1B, 0x1F,
+  0xFF, 0xFF, 0xFE, 0x1B, 0x13, 0x15, 0x14, 0x19, 0x1F, 0x11, 0x11, 0x31,
+  0x11, 0x55, 0x11, 0x30, 0x32, 0x32, 0x41, 0x62, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x23, 0x20, 0x35, 0x67, 0x42, 0x34, 0x31, 0x54, 0x11, 0x73, 0x93, 0x93,
+  0x93, 0x92, 0xA2, 0x93, 0x92, 0x92, 0xA1, 0xA2, 0x92, 0x92, 0xA1, 0x71,
+  0x21, 0x72, 0x1A, 0x1B, 0x10, 0x35, 0x68, 0x32, 0x44, 0x11, 0x73, 0x11,
+  0x82, 0xA2, 0xA1, 0xA1, 0xA1, 0x94, 0x67, 0x85, 0x94, 0x84, 0x93, 0x93,
+  0x93, 0x92, 0x12, 0x62, 0x24, 0x32, 0x46, 0x50, 0x92, 0xB1, 0xFB, 0x1C,
+  0x2F, 0xA2, 0xB2, 0xFA, 0x2B, 0x2F, 0xA2, 0xB2, 0xD7, 0x33, 0xE8, 0x33,
+  0xFF, 0xFB, 0x48, 0x47, 0x41, 0xB1, 0xA1, 0xB3, 0x87, 0x76, 0x85, 0x85,
+  0x84, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x12, 0x63, 0x13, 0x43, 0x28,
+  0x55, 0x60, 0x94, 0x73, 0x83, 0x93, 0x93, 0x93, 0xA3, 0x93, 0xA3, 0x15,
+  0x35, 0x33, 0x23, 0x63, 0x13, 0x67, 0x76, 0x76, 0x76, 0x73, 0x13, 0x63,
+  0x13, 0x62, 0x32, 0x52, 0x52, 0x33, 0x65, 0x40, 0x2B, 0x11, 0xD8, 0x23,
+  0xF5, 0x13, 0x1A, 0x1F, 0x71, 0xE1, 0xFF, 0x51, 0x11, 0xFF, 0x51, 0x11,
+  0xFF, 0x51, 0x11, 0xFF, 0x51, 0x11, 0x60, 0x1F, 0x87, 0x0C, 0x60, 0x6E,
+  0x07, 0xE0, 0x7E, 0x07, 0x70, 0x67, 0x8C, 0x1D, 0x80, 0xE0, 0x0F, 0x03,
+  0x3C, 0x71, 0xE6, 0x0E, 0xE0, 0xFE, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0x63,
+  0x8C, 0x1F, 0x80, 0x45, 0x63, 0x32, 0x43, 0x52, 0x32, 0x63, 0x13, 0x72,
+  0x13, 0x76, 0x76, 0x76, 0x77, 0x63, 0x13, 0x63, 0x23, 0x44, 0x36, 0x12,
+  0xA3, 0xA2, 0xA3, 0x93, 0x93, 0x93, 0x83, 0x74, 0x90, 0x09, 0xFC, 0x90,
+  0xFF, 0x80, 0x00, 0x00, 0x0D, 0xF9, 0x29, 0x40, 0xF0, 0x1C, 0x49, 0x68,
+  0x58, 0x58, 0x69, 0x4C, 0x1F, 0x04, 0xD6, 0xD5, 0xE5, 0xD6, 0xD4, 0xF0,
+  0x10, 0x0F, 0xF4, 0xFF, 0xFF, 0xFA, 0xFF, 0x40, 0x01, 0xF0, 0x4D, 0x6D,
+  0x5E, 0x5D, 0x6D, 0x4F, 0x01, 0xC4, 0x96, 0x85, 0x85, 0x86, 0x94, 0xC1,
+  0xF0, 0x34, 0x42, 0x24, 0x12, 0x43, 0x12, 0x56, 0x43, 0x12, 0x43, 0x73,
+  0x72, 0x73, 0x72, 0x72, 0x81, 0x82, 0x81, 0x91, 0x91, 0xFD, 0x37, 0x37,
+  0x34, 0xA8, 0xF1, 0xCC, 0x48, 0x49, 0x3C, 0x11, 0x17, 0x2F, 0x01, 0x72,
+  0xF2, 0x24, 0x1A, 0x31, 0x39, 0x17, 0x66, 0x22, 0x27, 0x11, 0x13, 0x12,
+  0x1F, 0x01, 0x11, 0xE1, 0x71, 0x11, 0x51, 0xA1, 0x51, 0xA1, 0xF1, 0x1F,
+  0xF1, 0x17, 0x27, 0x11, 0x1F, 0xF1, 0x12, 0x14, 0x1F, 0x11, 0x91, 0xA1,
+  0x32, 0x72, 0x32, 0x74, 0x63, 0x31, 0x61, 0x41, 0x21, 0x24, 0x32, 0x74,
+  0x44, 0x82, 0xF5, 0x23, 0x2F, 0x32, 0x52, 0xF1, 0x27, 0x3C, 0x39, 0x48,
+  0x4C, 0xC7, 0xB1, 0xF6, 0x11, 0x1F, 0xFC, 0x22, 0x1F, 0xFF, 0xF3, 0x21,
+  0x12, 0x1F, 0xF8, 0x23, 0x12, 0x1F, 0xF6, 0x2F, 0xD1, 0x21, 0xB1, 0x17,
+  0xF0, 0x92, 0x1F, 0xF2, 0x2F, 0xF2, 0x12, 0x17, 0x2F, 0xF7, 0x15, 0x1F,
+  0x21, 0x22, 0x23, 0x63, 0x52, 0x0D, 0x52, 0x45, 0x22, 0x51, 0x82, 0x21,
+  0xFF, 0x31, 0x21, 0xFF, 0xFF, 0x81, 0x21, 0xC2, 0x21, 0x85, 0x22, 0x95,
+  0x23, 0xD2, 0x31, 0xE1, 0x31, 0xE1, 0xFF, 0xF8, 0x1F, 0x51, 0x21, 0x92,
+  0x21, 0x12, 0x46, 0x22, 0x20, 0x76, 0x31, 0x73, 0x54, 0x53, 0x92, 0x52,
+  0xB2, 0x32, 0xC2, 0x23, 0xD1, 0x23, 0xD1, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+  0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF2, 0x2F, 0x23, 0xE1, 0x22, 0xD1, 0x42,
+  0xC1, 0x52, 0xA1, 0x73, 0x62, 0xA7, 0x50, 0x0F, 0x08, 0x24, 0x72, 0x37,
+  0x1A, 0x32, 0x1F, 0x51, 0x21, 0xF5, 0x12, 0x1F, 0x51, 0x21, 0xFF, 0xD1,
+  0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x21, 0xFF, 0xB1, 0x21, 0xF3,
+  0x12, 0x1F, 0x31, 0x21, 0x51, 0xA3, 0x12, 0x42, 0x47, 0x22, 0x60, 0x0F,
+  0x22, 0x24, 0x87, 0x1B, 0x1F, 0x41, 0xFF, 0x81, 0xFF, 0x51, 0xFF, 0x61,
+  0xB7, 0xC7, 0xF4, 0x1F, 0xF8, 0x1F, 0xFB, 0x1F, 0x22, 0xF1, 0x14, 0x1C,
+  0x13, 0x24, 0x92, 0x11, 0x0F, 0x64, 0xA5, 0x1D, 0x1F, 0x41, 0xFF, 0x81,
+  0xFF, 0x41, 0xFF, 0x61, 0xA8, 0xB8, 0xF4, 0x1F, 0xF8, 0x1F, 0xFF, 0xFF,
+  0x61, 0x31, 0xC2, 0x52, 0xA0, 0x87, 0x41, 0xA3, 0x65, 0x83, 0xA3, 0x73,
+  0xC3, 0x53, 0xE2, 0x52, 0xF0, 0x24, 0x3F, 0x11, 0x42, 0xF6, 0x3F, 0x63,
+  0xF6, 0x3C, 0xCE, 0x52, 0x3F, 0x03, 0x33, 0xF0, 0x34, 0x3E, 0x34, 0x3E,
+  0x35, 0x3D, 0x36, 0x3C, 0x37, 0x3B, 0x39, 0x46, 0x4C, 0x97, 0x09, 0x5B,
+  0x52, 0x52, 0x52, 0x21, 0x31, 0x91, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF4, 0xBC, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x31, 0x91, 0x31,
+  0x22, 0x52, 0x52, 0x52, 0x0B, 0x52, 0x21, 0x31, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x13, 0x12, 0x25, 0x20, 0x49, 0x42, 0x52, 0x61, 0x31, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x33, 0xD1, 0x41, 0x41, 0x34, 0x50, 0x09,
+  0x48, 0x55, 0x84, 0x83, 0x92, 0xA3, 0x82, 0xB3, 0x72, 0xC3, 0x62, 0xD3,
+  0x51, 0xF0, 0x34, 0x1F, 0x13, 0x31, 0xF2, 0x31, 0x2F, 0x36, 0xF3, 0x31,
+  0x3F, 0x23, 0x24, 0xF0, 0x33, 0x4E, 0x35, 0x3D, 0x36, 0x4B, 0x37, 0x4A,
+  0x38, 0x49, 0x39, 0x47, 0x58, 0x63, 0x94, 0xB0, 0x09, 0xA2, 0x52, 0xC1,
+  0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0xF2,
+  0x2F, 0x61, 0xC2, 0x22, 0x49, 0x21, 0x10, 0x06, 0xF0, 0x8F, 0x82, 0x21,
+  0x31, 0xD1, 0x31, 0xFF, 0x31, 0x21, 0xB2, 0xFF, 0xB1, 0xF8, 0x1C, 0x2F,
+  0xFA, 0x12, 0x17, 0x2F, 0xFC, 0x12, 0x15, 0x2F, 0xFE, 0x12, 0x13, 0x2F,
+  0xFF, 0x41, 0x12, 0xF5, 0x1F, 0xF0, 0x1F, 0x81, 0x31, 0xE1, 0x11, 0xF0,
+  0x13, 0x12, 0x23, 0x24, 0x11, 0x14, 0x25, 0x20, 0x05, 0xC9, 0x31, 0xB2,
+  0x23, 0x21, 0x31, 0xC1, 0x71, 0x31, 0xF9, 0x1F, 0x51, 0x31, 0xF5, 0x13,
+  0x1F, 0x51, 0x31, 0xF5, 0x13, 0x1F, 0x51, 0x31, 0xF5, 0x13, 0x1F, 0x51,
+  0x31, 0xF5, 0x1F, 0x91, 0x21, 0xF6, 0x12, 0x1F, 0x61, 0x21, 0xF9, 0x1F,
+  0x51, 0xF9, 0x19, 0x11, 0x1C, 0x16, 0x23, 0x2B, 0x14, 0x77, 0xC3, 0x53,
+  0x92, 0x92, 0x72, 0xB2, 0x52, 0xD2, 0x33, 0xD3, 0x23, 0xD3, 0x13, 0xF0,
+  0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06, 0xF0, 0x31, 0x3D, 0x32,
+  0x3D, 0x33, 0x2D, 0x25, 0x2B, 0x27, 0x29, 0x29, 0x35, 0x3C, 0x77, 0x0D,
+  0x42, 0x45, 0x22, 0x41, 0x82, 0x21, 0xFF, 0x11, 0x21, 0xFF, 0xFF, 0x41,
+  0x21, 0x61, 0x42, 0x21, 0x75, 0x22, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0x51,
+  0x31, 0xA2, 0x52, 0x80, 0x77, 0xC3, 0x53, 0x92, 0x92, 0x72, 0xB2, 0x52,
+  0xD2, 0x33, 0xD3, 0x23, 0xD3, 0x13, 0xF0, 0x6F, 0x06, 0xF0, 0x6F, 0x06,
+  0xF0, 0x6F, 0x06, 0xF0, 0x31, 0x3D, 0x32, 0x3D, 0x33, 0x2D, 0x24, 0x3B,
+  0x26, 0x39, 0x28, 0x45, 0x3B, 0x8F, 0x05, 0xF2, 0x5F, 0x34, 0xF3, 0x4F,
+  0x44, 0xF5, 0x40, 0x0D, 0xB4, 0x54, 0xA3, 0x73, 0x93, 0x74, 0x83, 0x83,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x74, 0x83, 0x73, 0x93, 0x45, 0xAA, 0xC3,
+  0x33, 0xD3, 0x43, 0xC3, 0x43, 0xC3, 0x53, 0xB3, 0x63, 0xA3, 0x73, 0x93,
+  0x83, 0x83, 0x84, 0x65, 0x85, 0x29, 0x76, 0x35, 0x31, 0x23, 0x44, 0x22,
+  0x63, 0x13, 0x72, 0x13, 0x72, 0x13, 0x81, 0x14, 0x71, 0x25, 0xA4, 0xA5,
+  0xA4, 0xA5, 0x94, 0xA5, 0x94, 0x95, 0x85, 0x86, 0x63, 0x14, 0x43, 0x21,
+  0x35, 0x40, 0x0F, 0x43, 0x53, 0x55, 0x1D, 0x13, 0x1F, 0x01, 0xF5, 0x1F,
+  0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x31, 0xC2,
+  0x52, 0x50, 0x09, 0x89, 0x52, 0x82, 0x32, 0x21, 0x31, 0xC1, 0x11, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x32, 0x61,
+  0x21, 0xF6, 0x12, 0x1A, 0x29, 0x12, 0x17, 0x3B, 0x21, 0x96, 0x0A, 0x5A,
+  0x52, 0x52, 0x32, 0x31, 0x31, 0x91, 0x11, 0x61, 0x21, 0x92, 0xFF, 0x31,
+  0x72, 0x91, 0xFF, 0xE1, 0x21, 0x52, 0xFF, 0xFB, 0x12, 0x13, 0x2F, 0xFF,
+  0xD1, 0x21, 0x12, 0xFF, 0xFF, 0x01, 0x22, 0xFF, 0xFF, 0x21, 0x11, 0x90,
+  0x08, 0x19, 0x58, 0x51, 0x13, 0x42, 0x52, 0x31, 0x21, 0x31, 0x51, 0xE1,
+  0x41, 0x21, 0xF4, 0x1F, 0xFF, 0x21, 0x72, 0x71, 0x21, 0xFF, 0xFF, 0x41,
+  0x21, 0x52, 0x91, 0x21, 0x32, 0xFF, 0xFE, 0x12, 0x13, 0x2E, 0x11, 0x2F,
+  0x71, 0xFF, 0x81, 0x21, 0x12, 0xFF, 0xC1, 0x22, 0x51, 0x22, 0xFF, 0xFF,
+  0xD1, 0x11, 0x71, 0x11, 0xFF, 0x70, 0x0A, 0x58, 0x45, 0x93, 0x84, 0x92,
+  0xA3, 0x82, 0xC3, 0x62, 0xE3, 0x51, 0xF0, 0x43, 0x1F, 0x23, 0x21, 0xF4,
+  0x5F, 0x44, 0xF6, 0x4F, 0x54, 0xF4, 0x12, 0x3F, 0x21, 0x34, 0xF0, 0x15,
+  0x3E, 0x17, 0x3D, 0x18, 0x3B, 0x19, 0x48, 0x2B, 0x46, 0x3B, 0x62, 0x77,
+  0xA0, 0x09, 0x77, 0x34, 0xB3, 0x63, 0xB1, 0x93, 0x91, 0xB3, 0x81, 0xB3,
+  0x71, 0xD3, 0x51, 0xE3, 0x51, 0xF0, 0x33, 0x1F, 0x22, 0x31, 0xF2, 0x31,
+  0x1F, 0x43, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5,
+  0x3F, 0x45, 0xF1, 0x97, 0x3E, 0x51, 0xA3, 0x42, 0x93, 0x51, 0x93, 0x61,
+  0x93, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x13, 0xF0, 0x3F, 0x03, 0xF1, 0x3F,
+  0x03, 0xF0, 0x3F, 0x03, 0xF1, 0x3B, 0x13, 0x3C, 0x12, 0x3D, 0x11, 0x4C,
+  0x12, 0x3C, 0x21, 0xF3, 0x10, 0x07, 0x34, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFD, 0x40, 0x12, 0xFF, 0x41, 0x11, 0xFA, 0x11, 0x1F, 0xF4, 0x11, 0x1F,
+  0xA1, 0x11, 0xFF, 0x41, 0x11, 0xFA, 0x11, 0x19, 0x09, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x33, 0x30, 0x02, 0x00, 0x1C, 0x00, 0x70, 0x03, 0x60, 0x0D,
+  0xC0, 0x63, 0x03, 0x06, 0x0C, 0x18, 0x60, 0x33, 0x80, 0xEC, 0x01, 0x80,
+  0xFF, 0xFF, 0xF3, 0x8C, 0x30, 0x80, 0x46, 0x72, 0x13, 0x21, 0x51, 0x21,
+  0x31, 0x21, 0xFF, 0x43, 0x41, 0xB4, 0x95, 0x82, 0x11, 0xD1, 0xB1, 0xFF,
+  0x21, 0x32, 0x52, 0x35, 0x33, 0x11, 0x41, 0x21, 0x31, 0x10, 0x32, 0xB2,
+  0xC1, 0xE2, 0xFF, 0xFF, 0x55, 0x91, 0x51, 0x75, 0x31, 0x61, 0x41, 0xF3,
+  0x1B, 0x1F, 0xFF, 0xFF, 0x21, 0xB1, 0xF1, 0x16, 0x14, 0x11, 0x14, 0x31,
+  0x63, 0x45, 0x62, 0x33, 0x32, 0x53, 0x12, 0x63, 0x12, 0x66, 0x93, 0x93,
+  0x93, 0x93, 0x94, 0x71, 0x13, 0x61, 0x24, 0x42, 0x38, 0x64, 0x40, 0xA3,
+  0xA2, 0xD2, 0xFF, 0xFF, 0xA4, 0x95, 0x11, 0x71, 0x11, 0x31, 0x71, 0x71,
+  0x81, 0xB1, 0xFF, 0xFF, 0xF2, 0x1B, 0x1F, 0x31, 0x41, 0x32, 0x11, 0x35,
+  0x41, 0x22, 0x41, 0x23, 0x10, 0x45, 0x52, 0x33, 0x32, 0x53, 0x21, 0x75,
+  0x7F, 0x2A, 0x2A, 0x2A, 0x39, 0x38, 0x11, 0x36, 0x12, 0x44, 0x23, 0x86,
+  0x44, 0x55, 0x61, 0x12, 0x22, 0x31, 0x11, 0x21, 0x51, 0x61, 0xC2, 0xF9,
+  0x23, 0x34, 0x23, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x33, 0x40, 0x45,
+  0x82, 0x27, 0x22, 0x43, 0x43, 0x53, 0x33, 0x53, 0x33, 0x53, 0x33, 0x53,
+  0x43, 0x42, 0x63, 0x22, 0x85, 0x72, 0xC1, 0xC2, 0xCB, 0x5A, 0x31, 0x92,
+  0x11, 0xB3, 0xB3, 0xA1, 0x14, 0x63, 0x2A, 0x66, 0x50, 0x32, 0xC2, 0xD1,
+  0xF0, 0x2F, 0xFF, 0xFA, 0x4B, 0x14, 0x18, 0x53, 0x17, 0x23, 0x1F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x32, 0x22, 0x32, 0x23, 0xF3, 0x3F, 0x42,
+  0x32, 0x41, 0x62, 0xFF, 0xFF, 0xD1, 0x12, 0x41, 0x63, 0xF9, 0x3F, 0xA2,
+  0x43, 0x51, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x49, 0x13, 0x11, 0x13,
+  0x32, 0x42, 0xD2, 0xE1, 0xF1, 0x2F, 0xFF, 0xFF, 0x06, 0xB1, 0x23, 0xD1,
+  0xD3, 0xD1, 0x11, 0xD3, 0xD1, 0x11, 0xE2, 0x11, 0xF2, 0x1E, 0x1F, 0x21,
+  0x11, 0xF0, 0x11, 0x1F, 0x21, 0x51, 0x31, 0x71, 0x22, 0x52, 0x62, 0x32,
+  0x32, 0x41, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0x12, 0x41, 0x23, 0x34,
+  0x54, 0x42, 0x51, 0x41, 0x22, 0x41, 0x32, 0x44, 0x41, 0x13, 0x31, 0x72,
+  0x31, 0x21, 0x11, 0x31, 0xA1, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x11, 0xF8, 0x14, 0x22, 0x23, 0x22, 0x23, 0x20, 0x32, 0x34, 0x52,
+  0x41, 0x41, 0x31, 0x54, 0x31, 0x22, 0x32, 0x31, 0xA1, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF4, 0x13, 0x14, 0x13, 0x11, 0x15, 0x12, 0x15, 0x10, 0x55, 0x72,
+  0x33, 0x52, 0x53, 0x32, 0x73, 0x22, 0x77, 0x86, 0x86, 0x86, 0x86, 0x87,
+  0x72, 0x23, 0x63, 0x33, 0x52, 0x53, 0x32, 0x75, 0x50, 0x42, 0x34, 0x43,
+  0x32, 0x41, 0x21, 0x51, 0x13, 0x31, 0x13, 0x32, 0x31, 0xF4, 0x1C, 0x1F,
+  0xFF, 0xFF, 0x71, 0xC1, 0xF2, 0x17, 0x14, 0x11, 0x18, 0x51, 0x1A, 0x5F,
+  0xFF, 0xFF, 0x93, 0x33, 0x70, 0x55, 0x21, 0x56, 0x12, 0x51, 0x11, 0x41,
+  0x61, 0xF1, 0x1B, 0x1F, 0xFF, 0xFF, 0x21, 0xB1, 0xF3, 0x14, 0x16, 0x13,
+  0x57, 0x14, 0x29, 0x4F, 0xFF, 0xFF, 0xF0, 0x33, 0x20, 0x32, 0x33, 0x22,
+  0x32, 0x32, 0x41, 0x12, 0x32, 0x41, 0x23, 0x51, 0xFF, 0xFF, 0xFF, 0xF9,
+  0x23, 0x34, 0x3F, 0x98, 0xEC, 0x1B, 0x02, 0xE0, 0x3C, 0x07, 0xC0, 0xFC,
+  0x0F, 0x80, 0xF8, 0x1E, 0x07, 0xC1, 0xF8, 0xE9, 0xE0, 0x41, 0xF1, 0x16,
+  0x26, 0x14, 0x31, 0x23, 0x3F, 0xFF, 0xFF, 0xF6, 0x12, 0x16, 0x32, 0x14,
+  0x11, 0x05, 0x45, 0x22, 0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x13,
+  0x23, 0x22, 0x13, 0x54, 0x13, 0x14, 0x14, 0x21, 0x06, 0x55, 0x41, 0x51,
+  0x21, 0x11, 0x21, 0x81, 0x51, 0xC1, 0x82, 0x71, 0xC1, 0xF2, 0x13, 0x27,
+  0x1F, 0x21, 0x11, 0xF0, 0x19, 0x12, 0x1F, 0x01, 0xB1, 0xF8, 0x06, 0x27,
+  0x26, 0x32, 0x22, 0x32, 0x21, 0x31, 0x11, 0x81, 0x91, 0xB1, 0x81, 0x61,
+  0xF4, 0x1A, 0x13, 0x2C, 0x2E, 0x11, 0x15, 0x1F, 0x91, 0x12, 0xA1, 0x12,
+  0xF1, 0x17, 0x1F, 0xF8, 0x26, 0x2A, 0x17, 0x1F, 0xF0, 0xFC, 0xF9, 0xE1,
+  0x83, 0x84, 0x06, 0x20, 0x1C, 0x80, 0x34, 0x00, 0x60, 0x01, 0xC0, 0x07,
+  0x00, 0x26, 0x01, 0x1C, 0x04, 0x30, 0x20, 0xE1, 0x81, 0xCF, 0x0F, 0xC0,
+  0x06, 0x45, 0x32, 0x41, 0x21, 0x11, 0xA1, 0x31, 0x11, 0xFD, 0x14, 0x25,
+  0x1F, 0x42, 0x71, 0x11, 0xFB, 0x11, 0x3F, 0x91, 0xF0, 0x1F, 0xA2, 0xFF,
+  0x92, 0x73, 0xE3, 0x81, 0x31, 0x90, 0x1C, 0x12, 0x72, 0x21, 0x72, 0x31,
+  0x63, 0xA2, 0xA2, 0xA2, 0xA3, 0xA2, 0xA2, 0xA2, 0xA3, 0x71, 0x13, 0x81,
+  0x12, 0x8F, 0x00, 0x72, 0x52, 0x62, 0x62, 0x72, 0x72, 0x72, 0x73, 0x72,
+  0x72, 0x72, 0x62, 0x62, 0x53, 0x81, 0x91, 0x91, 0x82, 0x72, 0x63, 0x63,
+  0x62, 0x72, 0x72, 0x81, 0x82, 0x82, 0x92, 0x0F, 0xFF, 0xD0, 0x02, 0x74,
+  0x71, 0x11, 0x71, 0xA1, 0xF9, 0x1A, 0x1F, 0x91, 0x11, 0x71, 0x11, 0x71,
+  0x12, 0x72, 0x52, 0x62, 0x61, 0xFD, 0x16, 0x1F, 0xD1, 0x61, 0x71, 0x11,
+  0x44, 0x50, 0x24, 0xA1, 0x18, 0x73, 0x45, 0x43, 0x78, 0x11, 0xA4, 0x20,
+  0x0F, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0xD1,
+  0x1D, 0x24, 0x34, 0x12, 0xC1, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x32,
+  0x30, 0x83, 0xE2, 0xF2, 0x2F, 0xFF, 0xFF, 0xF1, 0x26, 0x36, 0x21, 0x33,
+  0x22, 0x17, 0x11, 0x23, 0x11, 0x21, 0x13, 0x11, 0x1D, 0x1F, 0x11, 0x31,
+  0xFF, 0xFA, 0x1F, 0xF7, 0x1F, 0x41, 0xFF, 0x31, 0x41, 0x11, 0xD1, 0x31,
+  0x14, 0x34, 0x11, 0x55, 0x35, 0xFF, 0xFF, 0xFB, 0x1F, 0x21, 0x42, 0x60,
+  0x06, 0x36, 0x12, 0x31, 0x32, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+  0x23, 0x63, 0xF0, 0xF1, 0x1F, 0x11, 0xF2, 0x06, 0x26, 0x12, 0x22, 0x22,
+  0x31, 0xD1, 0xFF, 0xFB, 0x19, 0x67, 0x7F, 0xFF, 0xF3, 0x1A, 0x23, 0x20,
+  0x06, 0x35, 0x38, 0x31, 0x31, 0x31, 0x32, 0x22, 0x41, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x1D, 0x14, 0x23, 0x53, 0x53, 0x20, 0x06,
+  0x35, 0x38, 0x31, 0x31, 0x31, 0x32, 0x22, 0x41, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF4, 0x1D, 0x14, 0x23, 0x53, 0x53, 0xF8, 0xF8, 0x1F,
+  0xFF, 0x11, 0x09, 0x74, 0x22, 0xF6, 0x1F, 0xFF, 0x66, 0x94, 0x22, 0xB1,
+  0xFF, 0x71, 0xF6, 0x12, 0x12, 0x23, 0x41, 0x21, 0x07, 0x76, 0x12, 0x32,
+  0x72, 0x22, 0xFF, 0xFF, 0xFF, 0x06, 0xF0, 0x42, 0x1F, 0x31, 0x21, 0xFF,
+  0xFF, 0xF5, 0x12, 0x12, 0x15, 0x23, 0x41, 0x21, 0x23, 0x30, 0x07, 0x62,
+  0x32, 0xFF, 0xFF, 0x36, 0x74, 0x21, 0xA1, 0x21, 0xFF, 0xF3, 0x12, 0x33,
+  0x41, 0x21, 0x35, 0x53, 0x32, 0x42, 0x52, 0x31, 0x63, 0x21, 0x72, 0xA3,
+  0x93, 0x48, 0x93, 0x93, 0x92, 0x93, 0x11, 0x72, 0x32, 0x42, 0x65, 0x40,
+  0xE3, 0x56, 0x55, 0x12, 0x32, 0x31, 0x41, 0x12, 0x21, 0x21, 0xB1, 0x71,
+  0x21, 0xC1, 0x61, 0x21, 0x81, 0xFF, 0xA3, 0xF4, 0x3F, 0xFE, 0x1F, 0x91,
+  0x91, 0xF3, 0x1C, 0x12, 0x17, 0x11, 0x23, 0x23, 0x21, 0x72, 0x0F, 0xFC,
+  0x70, 0xC3, 0x83, 0x0E, 0x0C, 0x38, 0x30, 0x70, 0xC0, 0xFB, 0x00, 0xFC,
+  0x07, 0x30, 0x38, 0xC0, 0xC3, 0x07, 0x0C, 0x38, 0x73, 0xC3, 0xF0, 0x1F,
+  0x03, 0x24, 0x7F, 0x31, 0xFF, 0x61, 0xFF, 0xFF, 0xF6, 0x4E, 0x22, 0x4C,
+  0x33, 0x1E, 0x13, 0x1E, 0x13, 0x1F, 0xFF, 0xF7, 0x13, 0x1F, 0xE2, 0x31,
+  0x13, 0x44, 0x32, 0x20, 0x1F, 0x21, 0x24, 0x8F, 0x31, 0xF3, 0x1F, 0xF6,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x34, 0x38, 0x5F,
+  0x25, 0x22, 0x73, 0x3F, 0xFF, 0xFF, 0xF6, 0x1F, 0xFF, 0xFF, 0xFF, 0x21,
+  0xFF, 0xE1, 0xFF, 0xB1, 0xF7, 0x1F, 0x41, 0xF7, 0x1F, 0x41, 0xB1, 0x63,
+  0x2A, 0x43, 0x5D, 0x72, 0xD1, 0xF7, 0x14, 0x1F, 0x21, 0x21, 0xFF, 0xC0,
+  0xFE, 0x64, 0x94, 0x66, 0x13, 0x33, 0x33, 0x19, 0x3F, 0x23, 0x24, 0xF8,
+  0x28, 0x1D, 0x1D, 0x1F, 0x01, 0xFF, 0xD1, 0xB1, 0xF0, 0x1D, 0x1F, 0x14,
+  0x35, 0xFD, 0x1F, 0x01, 0x32, 0x32, 0x31, 0xF2, 0x17, 0x1F, 0x11, 0x21,
+  0xC1, 0xB1, 0xD1, 0xF2, 0x1B, 0x12, 0x19, 0x1F, 0x41, 0xB1, 0xD1, 0xA1,
+  0x21, 0xF3, 0x15, 0x19, 0x19, 0x13, 0x12, 0x23, 0x14, 0x24, 0x38, 0x20,
+  0x11, 0x34, 0x65, 0x14, 0x42, 0x63, 0x31, 0x83, 0x21, 0x83, 0x21, 0x83,
+  0xB3, 0xB3, 0xA4, 0x94, 0x67, 0x86, 0xC4, 0xB3, 0xB4, 0xA4, 0xA4, 0xA5,
+  0x94, 0x11, 0x74, 0x31, 0x54, 0x58, 0x30, 0x18, 0x59, 0x12, 0x42, 0x53,
+  0x42, 0xF5, 0x1F, 0xFB, 0x1F, 0x62, 0xF5, 0x1F, 0x61, 0x11, 0xF4, 0x11,
+  0x1F, 0x61, 0xF5, 0x2F, 0x51, 0xF6, 0x11, 0x1F, 0x41, 0x11, 0xF6, 0x1F,
+  0x52, 0xFF, 0xE1, 0xFF, 0xFD, 0x12, 0x34, 0x34, 0x34, 0x20, 0xFE, 0x36,
+  0x3F, 0xF4, 0x12, 0x14, 0x12, 0x1C, 0x12, 0x42, 0x1E, 0x8F, 0xF1, 0x85,
+  0x91, 0x24, 0x25, 0x34, 0x2F, 0x51, 0xFF, 0xB1, 0xF6, 0x2F, 0x51, 0xF6,
+  0x11, 0x1F, 0x41, 0x11, 0xF6, 0x1F, 0x52, 0xF5, 0x1F, 0x61, 0x11, 0xF4,
+  0x11, 0x1F, 0x61, 0xF5, 0x2F, 0xFE, 0x1F, 0xFF, 0xD1, 0x23, 0x43, 0x43,
+  0x42, 0xF8, 0x86, 0x64, 0x47, 0x74, 0x47, 0x13, 0x25, 0x46, 0x2A, 0x46,
+  0x1B, 0x45, 0x2B, 0x45, 0x1C, 0x44, 0x2C, 0x43, 0x2D, 0x8E, 0x9D, 0x42,
+  0x4C, 0x43, 0x4B, 0x44, 0x4A, 0x45, 0x3A, 0x45, 0x49, 0x46, 0x48, 0x47,
+  0x47, 0x48, 0x37, 0x48, 0x43, 0xA6, 0x60, 0x4F, 0x24, 0x22, 0x73, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x01,
+  0xF0, 0x33, 0x1F, 0x22, 0x91, 0xB1, 0x62, 0x43, 0x1F, 0x71, 0x24, 0xA3,
+  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x21, 0x31, 0x23, 0x43, 0x42, 0x52, 0x18, 0x85, 0x44, 0xB2,
+  0x64, 0xB2, 0x74, 0xA1, 0x84, 0x92, 0x94, 0x81, 0xA4, 0x72, 0xB4, 0x61,
+  0xD3, 0x52, 0xD4, 0x41, 0xF0, 0x43, 0x1F, 0x04, 0x21, 0xF2, 0x41, 0x1F,
+  0x26, 0xF3, 0x4F, 0x44, 0xF5, 0x2F, 0x62, 0xF0, 0x24, 0x1F, 0x08, 0xF1,
+  0x5D, 0x89, 0xF4, 0x3F, 0x73, 0xF1, 0xF0, 0x83, 0x53, 0x53, 0x53, 0x63,
+  0x63, 0x33, 0x73, 0x73, 0x23, 0x73, 0x73, 0x14, 0x73, 0x78, 0x73, 0x78,
+  0x73, 0x78, 0x73, 0x74, 0x13, 0x73, 0x73, 0x23, 0x73, 0x73, 0x33, 0x63,
+  0x63, 0x44, 0x53, 0x53, 0x74, 0x33, 0x34, 0xAC, 0xF3, 0x3F, 0x64, 0xF4,
+  0x98, 0x18, 0x59, 0x12, 0x42, 0x53, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x13, 0x12, 0x34,
+  0x95, 0xF6, 0xF8, 0x1F, 0x81, 0xF8, 0x1F, 0xFF, 0x11, 0x09, 0x3B, 0x43,
+  0x32, 0x43, 0x21, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0x62, 0x91,
+  0x36, 0x11, 0xA1, 0x63, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0x91, 0xF3, 0x24,
+  0x30, 0x17, 0x57, 0x48, 0x22, 0x32, 0x51, 0x42, 0x42, 0x42, 0xF0, 0x1B,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x31, 0x71, 0x31, 0x71, 0x62,
+  0x57, 0x57, 0x43, 0x17, 0x57, 0x48, 0x22, 0x32, 0x51, 0x42, 0x42, 0x42,
+  0xF0, 0x1B, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x31, 0x71, 0x31,
+  0x71, 0x62, 0x57, 0x57, 0x4F, 0xF1, 0xFF, 0x32, 0xFF, 0x31, 0xFF, 0xFF,
+  0x61, 0xFF, 0x40, 0x0D, 0xA5, 0x33, 0x91, 0xFF, 0xA1, 0xFF, 0xFF, 0xFF,
+  0xF9, 0x5F, 0x13, 0x23, 0xF1, 0x32, 0x2F, 0x21, 0x31, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x11, 0x31, 0x61, 0x72, 0x31, 0x52, 0x44, 0x32, 0x20, 0x18, 0xA9,
+  0x12, 0x42, 0xA3, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x4F,
+  0x92, 0x24, 0xF7, 0x33, 0x1F, 0x91, 0x31, 0xF9, 0x13, 0x1F, 0xFF, 0xFF,
+  0xFF, 0x21, 0x31, 0xFF, 0xF4, 0x23, 0x14, 0x16, 0x34, 0x43, 0x23, 0x24,
+  0x30, 0x18, 0xA2, 0x42, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xF5, 0x5D, 0x32,
+  0x4C, 0x33, 0x1E, 0x13, 0x1E, 0x1F, 0x61, 0xFF, 0xF4, 0x13, 0x1C, 0x1F,
+  0x11, 0x41, 0x13, 0x35, 0x32, 0x20, 0x11, 0x37, 0x86, 0x53, 0x64, 0x93,
+  0x42, 0xC3, 0x32, 0xD3, 0x21, 0xF0, 0x22, 0x1F, 0x03, 0xF2, 0x3F, 0x23,
+  0xF3, 0x36, 0xEF, 0x23, 0xF2, 0x2F, 0x23, 0xF2, 0x3F, 0x22, 0xF2, 0x32,
+  0x1D, 0x34, 0x2A, 0x37, 0x26, 0x3B, 0x78, 0xF4, 0x59, 0x88, 0x25, 0x36,
+  0x24, 0x26, 0x21, 0x72, 0x1F, 0x31, 0x21, 0x71, 0x21, 0xF1, 0x12, 0x19,
+  0x12, 0x1F, 0xF2, 0x1D, 0x1E, 0x1F, 0x41, 0xF0, 0x1B, 0x1F, 0xFF, 0xE4,
+  0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF, 0x61, 0xF4, 0x1F, 0x01, 0xFD, 0x1E,
+  0x12, 0x1E, 0x12, 0x1F, 0xFB, 0x12, 0x1F, 0x12, 0x12, 0x52, 0x21, 0x33,
+  0x42, 0x72, 0x15, 0x22, 0x40, 0x9D, 0x74, 0x54, 0x84, 0x63, 0x93, 0x73,
+  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x93, 0x73, 0x94, 0x63, 0xA5, 0x43,
+  0xD9, 0xD3, 0x33, 0xD3, 0x33, 0xC3, 0x43, 0xB3, 0x53, 0xA3, 0x63, 0x93,
+  0x73, 0x84, 0x73, 0x74, 0x83, 0x55, 0x85, 0x26, 0x79, 0xC1, 0x59, 0x49,
+  0x43, 0xA2, 0xC1, 0xD1, 0xC1, 0x43, 0x61, 0x23, 0x14, 0x31, 0x12, 0x53,
+  0x23, 0x73, 0x13, 0x73, 0x12, 0x83, 0x12, 0x95, 0x95, 0x96, 0x82, 0x13,
+  0x82, 0x13, 0x82, 0x23, 0x62, 0x43, 0x42, 0x67, 0x40, 0x0B, 0x22, 0x34,
+  0x21, 0xA1, 0xFA, 0x1B, 0x19, 0x32, 0x26, 0x41, 0x2A, 0x12, 0x1F, 0xFF,
+  0x31, 0x23, 0x34, 0x21, 0x10, 0x0E, 0x36, 0xF9, 0x1F, 0xFF, 0xFF, 0xFF,
+  0x32, 0x32, 0x50, 0x3C, 0x42, 0x15, 0x31, 0xE1, 0xFF, 0xFF, 0xFB, 0x2F,
+  0xFF, 0x02, 0xD1, 0xA1, 0x22, 0x27, 0x32, 0x3A, 0x51, 0xA1, 0x31, 0xC1,
+  0xF2, 0x00, 0x00, 0x27, 0x8F, 0xC7, 0xBE, 0x18, 0x3C, 0x10, 0xC2, 0x00,
+  0x86, 0x10, 0x02, 0x31, 0x00, 0x19, 0x98, 0x00, 0x7F, 0xC0, 0x0E, 0x67,
+  0x00, 0x73, 0x18, 0x07, 0x18, 0xE0, 0x38, 0xC3, 0x83, 0x86, 0x1C, 0x38,
+  0x38, 0x73, 0xC7, 0xE3, 0xE0, 0x34, 0x43, 0x33, 0x22, 0x53, 0x11, 0x72,
+  0x11, 0x72, 0x83, 0x73, 0x64, 0xA3, 0x93, 0x83, 0x83, 0x85, 0x53, 0x37,
+  0x20, 0x06, 0x36, 0x12, 0x31, 0x32, 0x31, 0xE1, 0xC1, 0xE2, 0xD2, 0xD1,
+  0xF1, 0x1D, 0x2D, 0x2E, 0x1F, 0xF9, 0x12, 0x23, 0x22, 0x23, 0x20, 0x32,
+  0x62, 0x81, 0x41, 0xF2, 0x16, 0x21, 0x41, 0x19, 0x6F, 0xF7, 0x63, 0x61,
+  0x23, 0x13, 0x23, 0x1E, 0x1C, 0x1E, 0x2D, 0x2D, 0x1F, 0x11, 0xD2, 0xD2,
+  0xE1, 0xFF, 0x91, 0x22, 0x32, 0x22, 0x32, 0xF0, 0x64, 0x41, 0x23, 0x13,
+  0x1F, 0x04, 0x92, 0xFC, 0x2B, 0x21, 0x1B, 0x1F, 0x01, 0x21, 0xC1, 0x21,
+  0xFC, 0x12, 0x1C, 0x12, 0x12, 0x23, 0x26, 0x20, 0x3C, 0x41, 0x25, 0x22,
+  0x51, 0xFF, 0xFF, 0xFF, 0xFF, 0x72, 0xFB, 0x46, 0x12, 0x16, 0x13, 0x24,
+  0x20, 0x05, 0x94, 0x12, 0xB1, 0x31, 0x61, 0xF1, 0x18, 0x2B, 0x1F, 0x11,
+  0x61, 0xE1, 0x41, 0xFF, 0x01, 0x42, 0xF0, 0x1F, 0x11, 0x22, 0xFF, 0x41,
+  0x11, 0x92, 0x12, 0x72, 0x32, 0x06, 0x36, 0x12, 0x31, 0x32, 0x31, 0xE1,
+  0xFF, 0xFA, 0x6A, 0x6F, 0xFF, 0xFF, 0x71, 0x22, 0x32, 0x22, 0x32, 0x0F,
+  0x01, 0x23, 0x63, 0x1E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x12, 0x23,
+  0x22, 0x23, 0x20, 0x43, 0x52, 0x81, 0x71, 0x21, 0xFB, 0x17, 0x1B, 0x35,
+  0x3F, 0x9F, 0x13, 0x24, 0x8F, 0x41, 0xFF, 0x81, 0xFF, 0xF9, 0x1F, 0xF0,
+  0x7C, 0x6F, 0x41, 0xFF, 0x81, 0xFF, 0xFF, 0x01, 0xF2, 0x2F, 0x11, 0xF2,
+  0x13, 0x34, 0x82, 0x11, 0x23, 0x32, 0x43, 0x24, 0x42, 0x32, 0xFF, 0xD3,
+  0x72, 0x14, 0x41, 0x53, 0x22, 0x53, 0x21, 0x7F, 0x2A, 0x2A, 0x2A, 0x39,
+  0x38, 0x11, 0x36, 0x12, 0x44, 0x23, 0x85, 0x63 };
+
+const RleGlyph TimesNRCyr16pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   8,    0,    1, 0 },  // 0x20 ' '
+  {     0,   3,  21,   8,    2,  -20, 0 },  // 0x21 '!'
+  {     8,   9,   9,  13,    2,  -20, 2 },  // 0x22 '"'
+  {    16,  19,  21,  21,    0,  -20, 2 },  // 0x23 '#'
+  {    49,  12,  26,  16,    2,  -23, 0 },  // 0x24 '$'
+  {    88,  24,  21,  26,    1,  -20, 2 },  // 0x25 '%'
+  {   141,  22,  21,  24,    1,  -20, 1 },  // 0x26 '&'
+  {   193,   3,   9,   6,    1,  -20, 0 },  // 0x27 '''
+  {   197,   8,  29,  10,    1,  -21, 2 },  // 0x28 '('
+  {   219,   8,  29,  10,    1,  -21, 2 },  // 0x29 ')'
+  {   242,  11,  13,  16,    2,  -21, 0 },  // 0x2A '*'
+  {   260,  16,  16,  21,    2,  -18, 2 },  // 0x2B '+'
+  {   272,   3,   8,   8,    3,   -2, 0 },  // 0x2C ','
+  {   275,   8,   2,  10,    1,   -7, 0 },  // 0x2D '-'
+  {   277,   3,   3,   8,    3,   -2, 1 },  // 0x2E '.'
+  {   278,  10,  23,   9,    0,  -21, 2 },  // 0x2F '/'
+  {   297,  13,  21,  16,    1,  -20, 2 },  // 0x30 '0'
+  {   328,   7,  21,  16,    5,  -20, 2 },  // 0x31 '1'
+  {   338,  12,  21,  16,    2,  -20, 1 },  // 0x32 '2'
+  {   365,  12,  21,  16,    2,  -20, 1 },  // 0x33 '3'
+  {   392,  14,  21,  16,    1,  -20, 2 },  // 0x34 '4'
+  {   410,  12,  21,  16,    2,  -20, 1 },  // 0x35 '5'
+  {   434,  13,  21,  16,    1,  -20, 1 },  // 0x36 '6'
+  {   464,  13,  21,  16,    1,  -20, 2 },  // 0x37 '7'
+  {   487,  12,  21,  16,    2,  -20, 0 },  // 0x38 '8'
+  {   519,  13,  21,  16,    1,  -20, 1 },  // 0x39 '9'
+  {   549,   3,  15,   8,    3,  -14, 1 },  // 0x3A ':'
+  {   552,   3,  20,   8,    3,  -14, 0 },  // 0x3B ';'
+  {   560,  16,  15,  21,    2,  -17, 1 },  // 0x3C '<'
+  {   577,  17,   9,  21,    2,  -14, 1 },  // 0x3D '='
+  {   584,  16,  15,  21,    3,  -17, 1 },  // 0x3E '>'
+  {   601,  10,  21,  12,    1,  -20, 1 },  // 0x3F '?'
+  {   625,  26,  27,  28,    1,  -20, 2 },  // 0x40 '@'
+  {   698,  23,  21,  24,    0,  -20, 2 },  // 0x41 'A'
+  {   737,  18,  21,  21,    1,  -20, 2 },  // 0x42 'B'
+  {   773,  19,  21,  22,    1,  -20, 1 },  // 0x43 'C'
+  {   811,  23,  21,  26,    1,  -20, 2 },  // 0x44 'D'
+  {   851,  19,  21,  21,    1,  -20, 2 },  // 0x45 'E'
+  {   880,  19,  21,  21,    1,  -20, 2 },  // 0x46 'F'
+  {   905,  24,  21,  26,    1,  -20, 1 },  // 0x47 'G'
+  {   946,  23,  21,  26,    1,  -20, 2 },  // 0x48 'H'
+  {   976,   9,  21,  12,    1,  -20, 2 },  // 0x49 'I'
+  {   989,  13,  21,  14,    0,  -20, 2 },  // 0x4A 'J'
+  {  1007,  24,  21,  26,    1,  -20, 1 },  // 0x4B 'K'
+  {  1052,  19,  21,  21,    1,  -20, 2 },  // 0x4C 'L'
+  {  1075,  27,  21,  31,    2,  -20, 2 },  // 0x4D 'M'
+  {  1124,  24,  21,  26,    0,  -20, 2 },  // 0x4E 'N'
+  {  1173,  21,  21,  24,    1,  -20, 1 },  // 0x4F 'O'
+  {  1211,  17,  21,  19,    1,  -20, 2 },  // 0x50 'P'
+  {  1240,  21,  27,  24,    1,  -20, 1 },  // 0x51 'Q'
+  {  1287,  22,  21,  24,    1,  -20, 1 },  // 0x52 'R'
+  {  1327,  13,  21,  17,    2,  -20, 1 },  // 0x53 'S'
+  {  1358,  19,  21,  21,    1,  -20, 2 },  // 0x54 'T'
+  {  1382,  24,  21,  26,    1,  -20, 2 },  // 0x55 'U'
+  {  1414,  22,  21,  22,    0,  -20, 2 },  // 0x56 'V'
+  {  1452,  29,  21,  31,    2,  -20, 2 },  // 0x57 'W'
+  {  1506,  24,  21,  24,    0,  -20, 1 },  // 0x58 'X'
+  {  1549,  23,  21,  24,    0,  -20, 1 },  // 0x59 'Y'
+  {  1588,  19,  21,  21,    1,  -20, 1 },  // 0x5A 'Z'
+  {  1625,   7,  28,   8,    2,  -21, 2 },  // 0x5B '['
+  {  1634,   9,  23,   9,    0,  -21, 2 },  // 0x5C
+  {  1652,   6,  28,   8,    0,  -21, 2 },  // 0x5D ']'
+  {  1660,  14,  11,  18,    3,  -20, 0 },  // 0x5E '^'
+  {  1680,  16,   1,  16,    0,    4, 0 },  // 0x5F '_'
+  {  1682,   5,   5,  10,    3,  -21, 0 },  // 0x60 '`'
+  {  1686,  15,  15,  16,    1,  -14, 2 },  // 0x61 'a'
+  {  1714,  15,  22,  17,    0,  -21, 2 },  // 0x62 'b'
+  {  1741,  12,  15,  14,    1,  -14, 1 },  // 0x63 'c'
+  {  1763,  15,  22,  17,    1,  -21, 2 },  // 0x64 'd'
+  {  1793,  12,  15,  14,    1,  -14, 1 },  // 0x65 'e'
+  {  1813,  12,  22,  10,    0,  -21, 2 },  // 0x66 'f'
+  {  1835,  14,  22,  16,    1,  -14, 1 },  // 0x67 'g'
+  {  1869,  16,  22,  17,    0,  -21, 2 },  // 0x68 'h'
+  {  1892,   7,  21,   8,    0,  -20, 2 },  // 0x69 'i'
+  {  1904,   9,  28,   8,   -4,  -20, 2 },  // 0x6A 'j'
+  {  1921,  17,  22,  17,   -1,  -21, 2 },  // 0x6B 'k'
+  {  1955,   7,  22,   8,    0,  -21, 2 },  // 0x6C 'l'
+  {  1966,  25,  15,  26,    0,  -14, 2 },  // 0x6D 'm'
+  {  2001,  16,  15,  17,    0,  -14, 2 },  // 0x6E 'n'
+  {  2026,  14,  15,  17,    1,  -14, 1 },  // 0x6F 'o'
+  {  2049,  16,  22,  17,   -1,  -14, 2 },  // 0x70 'p'
+  {  2081,  15,  22,  17,    1,  -14, 2 },  // 0x71 'q'
+  {  2109,  12,  15,  12,    0,  -14, 2 },  // 0x72 'r'
+  {  2126,  10,  15,  12,    1,  -14, 0 },  // 0x73 's'
+  {  2145,   9,  19,  10,    0,  -18, 2 },  // 0x74 't'
+  {  2161,  16,  15,  17,    0,  -14, 2 },  // 0x75 'u'
+  {  2180,  15,  15,  16,    0,  -14, 2 },  // 0x76 'v'
+  {  2206,  22,  15,  22,    0,  -14, 2 },  // 0x77 'w'
+  {  2241,  14,  15,  16,    1,  -14, 0 },  // 0x78 'x'
+  {  2268,  14,  22,  16,    1,  -14, 2 },  // 0x79 'y'
+  {  2298,  13,  15,  14,    0,  -14, 1 },  // 0x7A 'z'
+  {  2319,   9,  28,  15,    4,  -21, 1 },  // 0x7B '{'
+  {  2347,   2,  29,   6,    2,  -21, 1 },  // 0x7C '|'
+  {  2350,   9,  28,  15,    3,  -21, 2 },  // 0x7D '}'
+  {  2378,  17,   5,  21,    2,  -12, 1 },  // 0x7E '~'
+  {  2388,  15,  19,  23,    4,  -18, 2 },  // 0x7F
+  {  2049,  16,  22,  17,   -1,  -14, 2 },  // 0x80
+  {  1741,  12,  15,  14,    1,  -14, 1 },  // 0x81
+  {  2400,  14,  14,  15,    0,  -13, 2 },  // 0x82
+  {  2268,  14,  22,  16,    1,  -14, 2 },  // 0x83
+  {  2413,  19,  29,  21,    1,  -21, 2 },  // 0x84
+  {  2241,  14,  15,  16,    1,  -14, 0 },  // 0x85
+  {  2460,  16,  18,  18,    1,  -13, 2 },  // 0x86
+  {  2479,  15,  14,  16,    1,  -13, 2 },  // 0x87
+  {  2496,  23,  14,  25,    1,  -13, 2 },  // 0x88
+  {  2519,  23,  18,  25,    1,  -13, 2 },  // 0x89
+  {  2546,  15,  14,  17,    1,  -13, 2 },  // 0x8A
+  {  2564,  21,  14,  22,    1,  -13, 2 },  // 0x8B
+  {  2590,  13,  14,  15,    1,  -13, 2 },  // 0x8C
+  {  2606,  12,  15,  14,    1,  -14, 1 },  // 0x8D
+  {  2628,  22,  15,  24,    1,  -14, 2 },  // 0x8E
+  {  2662,  14,  14,  15,    0,  -13, 0 },  // 0x8F
+  {   698,  23,  21,  24,    0,  -20, 2 },  // 0x90
+  {  2687,  18,  21,  20,    1,  -20, 2 },  // 0x91
+  {   737,  18,  21,  21,    1,  -20, 2 },  // 0x92
+  {  2716,  18,  21,  19,    1,  -20, 2 },  // 0x93
+  {  2735,  22,  27,  23,    0,  -20, 2 },  // 0x94
+  {   851,  19,  21,  21,    1,  -20, 2 },  // 0x95
+  {  2772,  29,  22,  31,    1,  -21, 2 },  // 0x96
+  {  2832,  14,  22,  17,    1,  -21, 1 },  // 0x97
+  {  2863,  23,  21,  26,    1,  -20, 2 },  // 0x98
+  {  2902,  23,  28,  26,    1,  -27, 2 },  // 0x99
+  {  2953,  22,  22,  23,    1,  -21, 1 },  // 0x9A
+  {  2995,  21,  21,  23,    1,  -20, 2 },  // 0x9B
+  {  1075,  27,  21,  31,    2,  -20, 2 },  // 0x9C
+  {   946,  23,  21,  26,    1,  -20, 2 },  // 0x9D
+  {  1173,  21,  21,  24,    1,  -20, 1 },  // 0x9E
+  {  3020,  23,  21,  25,    1,  -20, 2 },  // 0x9F
+  {  1211,  17,  21,  19,    1,  -20, 2 },  // 0xA0
+  {   773,  19,  21,  22,    1,  -20, 1 },  // 0xA1
+  {  1358,  19,  21,  21,    1,  -20, 2 },  // 0xA2
+  {  3044,  23,  21,  23,    0,  -20, 1 },  // 0xA3
+  {  3085,  25,  21,  27,    1,  -20, 1 },  // 0xA4
+  {  1506,  24,  21,  24,    0,  -20, 1 },  // 0xA5
+  {  3133,  23,  27,  26,    1,  -20, 2 },  // 0xA6
+  {  3165,  21,  21,  23,    1,  -20, 2 },  // 0xA7
+  {  3193,  33,  21,  35,    1,  -20, 2 },  // 0xA8
+  {  3231,  33,  27,  35,    1,  -20, 2 },  // 0xA9
+  {  3279,  21,  21,  23,    1,  -20, 2 },  // 0xAA
+  {  3310,  28,  21,  30,    1,  -20, 2 },  // 0xAB
+  {  3349,  18,  21,  20,    1,  -20, 2 },  // 0xAC
+  {  3378,  20,  21,  22,    1,  -20, 1 },  // 0xAD
+  {  3415,  32,  22,  34,    1,  -21, 2 },  // 0xAE
+  {  3473,  22,  21,  23,    0,  -20, 1 },  // 0xAF
+  {  1686,  15,  15,  16,    1,  -14, 2 },  // 0xB0
+  {  3513,  14,  22,  17,    2,  -21, 1 },  // 0xB1
+  {  3549,  13,  14,  16,    1,  -13, 2 },  // 0xB2
+  {  3569,  12,  14,  14,    1,  -13, 2 },  // 0xB3
+  {  3579,  16,  18,  16,    0,  -13, 2 },  // 0xB4
+  {  1793,  12,  15,  14,    1,  -14, 1 },  // 0xB5
+  {  3601,  21,  15,  22,    1,  -14, 0 },  // 0xB6
+  {  3641,  11,  15,  13,    1,  -14, 1 },  // 0xB7
+  {  3661,  16,  14,  18,    1,  -13, 2 },  // 0xB8
+  {  3683,  16,  21,  18,    1,  -20, 2 },  // 0xB9
+  {  3715,  15,  15,  16,    1,  -14, 2 },  // 0xBA
+  {  3740,  16,  14,  16,    0,  -13, 2 },  // 0xBB
+  {  3757,  19,  14,  21,    1,  -13, 2 },  // 0xBC
+  {  3785,  16,  14,  18,    1,  -13, 2 },  // 0xBD
+  {  2026,  14,  15,  17,    1,  -14, 1 },  // 0xBE
+  {  3803,  16,  14,  18,    1,  -13, 2 },  // 0xBF
+  {  3819,  19,  27,  21,    1,  -26, 2 },  // 0xC0
+  {  3856,  12,  21,  14,    1,  -20, 1 }   // 0xC1
+};
+
+const RleFont TimesNRCyr16pt8bRle PROGMEM = {
+  TimesNRCyr16pt8bRleData,
+  TimesNRCyr16pt8bRleGlyphs,
+  0x20, 0xC1, 35 };
+
+#endif // TIMESNRCYR16PT8BRLE_H_
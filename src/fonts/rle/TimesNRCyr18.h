@@ -0,0 +1,562 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr18.h, do not edit.
+// 162 glyphs (17 sharing another's bitmap), 4608 bytes of bitmap data (GFXfont: 8220)
+#ifndef TIMESNRCYR18PT8BRLE_H_
+#define TIMESNRCYR18PT8BRLE_H_
+
+const uint8_t TimesNRCyr18pt8bRleData[] PROGMEM = {
+  0x5F, 0xFF, 0xFF, 0xFD, 0xA4, 0x92, 0x40, 0x05, 0xFA, 0x03, 0x33, 0xFF,
+  0xF0, 0x11, 0x13, 0x11, 0x1F, 0xC0, 0x92, 0x72, 0x91, 0x81, 0xD1, 0x81,
+  0xFF, 0xF5, 0x11, 0x16, 0x11, 0x1F, 0x87, 0x27, 0x23, 0xF6, 0x62, 0x72,
+  0x4F, 0xFF, 0x21, 0x11, 0x61, 0x11, 0xFF, 0xF1, 0x52, 0x72, 0x5F, 0x64,
+  0x27, 0x26, 0xF9, 0x11, 0x16, 0x11, 0x1F, 0xFF, 0x51, 0x11, 0x61, 0x11,
+  0xFD, 0x02, 0x00, 0x08, 0x00, 0x20, 0x03, 0xF0, 0x3A, 0x79, 0xC8, 0xEE,
+  0x21, 0xB8, 0x82, 0xE2, 0x0B, 0xC8, 0x2F, 0x20, 0x1E, 0x80, 0x3E, 0x00,
+  0x7C, 0x00, 0xFC, 0x00, 0xF8, 0x03, 0xF0, 0x0B, 0xE0, 0x27, 0xC0, 0x8F,
+  0x02, 0x1E, 0x08, 0x78, 0x21, 0xF0, 0x86, 0xE2, 0x3B, 0xC9, 0xC3, 0xFC,
+  0x00, 0x80, 0x02, 0x00, 0x33, 0xF0, 0x16, 0x7C, 0x2F, 0x92, 0x61, 0x11,
+  0x31, 0x11, 0xFF, 0x62, 0xF9, 0x2F, 0x92, 0xFF, 0xF6, 0x2A, 0x11, 0x13,
+  0x11, 0x15, 0x2F, 0xF9, 0x75, 0x2F, 0x03, 0x62, 0x73, 0xF7, 0x7C, 0x2F,
+  0x92, 0x61, 0x11, 0x31, 0x11, 0xFF, 0x62, 0xF9, 0x2F, 0xFF, 0x62, 0xF9,
+  0x2A, 0x11, 0x13, 0x11, 0x15, 0x2F, 0xF9, 0x71, 0x95, 0xF4, 0x23, 0x2F,
+  0x22, 0x52, 0xF0, 0x35, 0x2F, 0x03, 0x52, 0xF0, 0x35, 0x2F, 0x03, 0x42,
+  0xF1, 0x43, 0x2F, 0x23, 0x22, 0xF3, 0x63, 0x89, 0x36, 0x59, 0x66, 0x38,
+  0x32, 0x36, 0x28, 0x24, 0x45, 0x27, 0x26, 0x43, 0x27, 0x27, 0x43, 0x17,
+  0x38, 0x42, 0x17, 0x39, 0x58, 0x39, 0x58, 0x49, 0x48, 0x49, 0x56, 0x11,
+  0x55, 0x22, 0x53, 0x22, 0xA4, 0x84, 0x69, 0x43, 0xFF, 0xFF, 0xD2, 0x48,
+  0x81, 0x72, 0x53, 0x51, 0x11, 0x71, 0x61, 0x71, 0x11, 0xE1, 0xF4, 0x15,
+  0x1F, 0xFF, 0xFF, 0xE1, 0xB1, 0xF0, 0x1F, 0x31, 0x11, 0x71, 0x92, 0x82,
+  0x82, 0x82, 0x01, 0x82, 0x82, 0x82, 0x82, 0x91, 0x71, 0x11, 0xF3, 0x1F,
+  0x01, 0xB1, 0xFF, 0xFF, 0xFE, 0x15, 0x1F, 0x41, 0xE1, 0x11, 0x71, 0x61,
+  0x71, 0x11, 0x53, 0x52, 0x70, 0x07, 0x00, 0x38, 0x01, 0xC1, 0xCE, 0x7F,
+  0x27, 0xBD, 0x78, 0x3E, 0x00, 0xE0, 0x7A, 0xF7, 0x93, 0xF9, 0xCE, 0x0E,
+  0x00, 0x70, 0x03, 0x80, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x28, 0xF3,
+  0x82, 0x8F, 0xFF, 0xFF, 0xFF, 0xF6, 0x6F, 0xF5, 0x11, 0x22, 0xC0, 0x0F,
+  0x90, 0x6F, 0xF6, 0x82, 0xFF, 0x01, 0x11, 0xFE, 0x11, 0x1F, 0xE1, 0xC1,
+  0xF3, 0x1C, 0x1F, 0xE1, 0x11, 0xFE, 0x11, 0x1F, 0xE1, 0x11, 0xFE, 0x1A,
+  0x55, 0x92, 0x32, 0x72, 0x52, 0x52, 0x72, 0x33, 0x72, 0x33, 0x73, 0x22,
+  0x92, 0x13, 0x92, 0x13, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+  0x93, 0x12, 0x92, 0x23, 0x73, 0x32, 0x73, 0x32, 0x72, 0x52, 0x52, 0x72,
+  0x32, 0x95, 0x50, 0x41, 0x42, 0x32, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0x51,
+  0x31, 0x11, 0x51, 0x45, 0x88, 0x5A, 0x42, 0x35, 0x31, 0x74, 0x21, 0x74,
+  0x11, 0x93, 0xB3, 0xB3, 0xB2, 0xC2, 0xB2, 0xC2, 0xB2, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xD1, 0xC1, 0x81, 0x22, 0x82, 0x2B, 0x2C, 0x1D, 0x10, 0x55, 0x79,
+  0x59, 0x42, 0x45, 0x22, 0x64, 0x21, 0x83, 0xB2, 0xC2, 0xB2, 0xB1, 0xB4,
+  0x88, 0x96, 0xA4, 0xB4, 0xA4, 0xB3, 0xB3, 0xB3, 0xB2, 0x13, 0x73, 0x15,
+  0x52, 0x39, 0x75, 0x60, 0xC1, 0xE1, 0xE1, 0xE1, 0xE2, 0xD2, 0xFE, 0x2D,
+  0x2D, 0x2D, 0x2F, 0xE2, 0xD2, 0xD2, 0xF0, 0x93, 0x3F, 0xF2, 0xA3, 0x3F,
+  0xFF, 0xFF, 0x50, 0x68, 0x58, 0x68, 0x51, 0xC1, 0xD1, 0xC4, 0xA7, 0x69,
+  0x97, 0x95, 0xA5, 0xA4, 0xB4, 0xB3, 0xB3, 0xB3, 0xB3, 0xB2, 0xB3, 0x13,
+  0x63, 0x24, 0x43, 0x39, 0x75, 0x70, 0xB4, 0x83, 0xA3, 0xB3, 0xB3, 0xB3,
+  0xB4, 0xB3, 0xB3, 0xC3, 0x25, 0x4D, 0x25, 0x45, 0x13, 0x74, 0x13, 0x87,
+  0x87, 0x96, 0x96, 0x93, 0x12, 0x93, 0x13, 0x82, 0x32, 0x82, 0x33, 0x62,
+  0x53, 0x42, 0x85, 0x50, 0x2D, 0x2D, 0x1D, 0x22, 0x92, 0x12, 0x93, 0x11,
+  0xA2, 0xD2, 0xC3, 0xC2, 0xD2, 0xD2, 0xC2, 0xD2, 0xD2, 0xC2, 0xD2, 0xD2,
+  0xC2, 0xD2, 0xD2, 0xC2, 0xD2, 0xD2, 0xC2, 0x80, 0x46, 0x63, 0x43, 0x33,
+  0x63, 0x13, 0x86, 0x86, 0x86, 0x83, 0x13, 0x63, 0x24, 0x52, 0x44, 0x32,
+  0x75, 0xA4, 0x91, 0x14, 0x62, 0x35, 0x33, 0x45, 0x22, 0x64, 0x13, 0x77,
+  0x86, 0x86, 0x83, 0x13, 0x72, 0x23, 0x63, 0x33, 0x43, 0x66, 0x40, 0x55,
+  0x82, 0x43, 0x52, 0x63, 0x32, 0x82, 0x32, 0x83, 0x13, 0x92, 0x13, 0x96,
+  0x96, 0x97, 0x87, 0x83, 0x14, 0x73, 0x15, 0x45, 0x2C, 0x55, 0x23, 0xC3,
+  0xB3, 0xB4, 0xB3, 0xB3, 0xB3, 0xA4, 0x94, 0x84, 0xB0, 0x12, 0x18, 0x12,
+  0xFF, 0x82, 0x18, 0x12, 0x10, 0x6F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0xFF, 0x51, 0x12, 0x2C, 0xF3, 0x1F, 0x04, 0xC6, 0xA6, 0xB5, 0xB6, 0xA6,
+  0xC4, 0xF0, 0x2F, 0x24, 0xF1, 0x6F, 0x16, 0xF1, 0x5F, 0x16, 0xF1, 0x6F,
+  0x14, 0xF3, 0x10, 0x0F, 0xF8, 0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0x80, 0x01,
+  0xF3, 0x4F, 0x16, 0xF1, 0x6F, 0x15, 0xF1, 0x6F, 0x16, 0xF1, 0x4F, 0x22,
+  0xF0, 0x4C, 0x6A, 0x6B, 0x5B, 0x6A, 0x6C, 0x4F, 0x01, 0xF3, 0x35, 0x42,
+  0x33, 0x31, 0x53, 0x12, 0x66, 0x56, 0x53, 0x12, 0x53, 0x83, 0x82, 0x83,
+  0x82, 0x82, 0x92, 0x91, 0x92, 0x91, 0xA1, 0xA1, 0xFF, 0x21, 0x93, 0x83,
+  0x91, 0x50, 0xC7, 0xF4, 0xDE, 0x21, 0x27, 0x21, 0x1C, 0x11, 0x2B, 0x3A,
+  0x11, 0x1F, 0x02, 0x81, 0x11, 0xF3, 0x16, 0x11, 0x1F, 0x31, 0x61, 0xB4,
+  0x12, 0xC1, 0x72, 0x12, 0x82, 0x31, 0x91, 0x12, 0x31, 0x11, 0xB1, 0x61,
+  0x61, 0xF8, 0x14, 0x1B, 0x11, 0x16, 0x1F, 0xC1, 0x21, 0x71, 0xFF, 0xF9,
+  0x18, 0x29, 0x12, 0x1F, 0xF3, 0x12, 0x15, 0x1F, 0x32, 0x91, 0xF3, 0x17,
+  0x24, 0x19, 0x12, 0x27, 0x18, 0x14, 0x13, 0x37, 0x34, 0x1B, 0x22, 0x12,
+  0x45, 0x21, 0x11, 0x14, 0x35, 0x5F, 0xF4, 0x23, 0x11, 0x1F, 0x51, 0x61,
+  0x11, 0xF3, 0x11, 0x16, 0x11, 0x1F, 0x11, 0x11, 0x81, 0x11, 0xD4, 0xA5,
+  0x84, 0xE2, 0x1A, 0x80, 0xC1, 0xFA, 0x1F, 0x71, 0xFC, 0x1F, 0x52, 0xFF,
+  0xF2, 0x21, 0x12, 0x1F, 0xFC, 0x26, 0x1F, 0x61, 0xF3, 0x28, 0x1F, 0x61,
+  0xFF, 0xB2, 0x71, 0x21, 0xD9, 0xEB, 0x31, 0xF6, 0x1C, 0x2F, 0xF6, 0x12,
+  0x17, 0x2F, 0xFB, 0x15, 0x1F, 0x81, 0xF5, 0x12, 0x13, 0x38, 0x35, 0x20,
+  0x0D, 0x62, 0x45, 0x22, 0x61, 0x82, 0x22, 0xF0, 0x1F, 0x41, 0x21, 0xFF,
+  0xFF, 0xC1, 0xF2, 0x13, 0x1D, 0x13, 0x18, 0x62, 0x29, 0x62, 0x3E, 0x23,
+  0x1F, 0x01, 0xF4, 0x12, 0x1F, 0xFF, 0xFF, 0xF1, 0x12, 0x1E, 0x16, 0x19,
+  0x23, 0x11, 0x24, 0x62, 0x32, 0x86, 0x41, 0x83, 0x52, 0x21, 0x63, 0x93,
+  0x53, 0xB2, 0x43, 0xD2, 0x32, 0xE2, 0x23, 0xF0, 0x12, 0x3F, 0x01, 0x13,
+  0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x33, 0xF3, 0x3F, 0x42,
+  0xF4, 0x3F, 0x42, 0xF1, 0x12, 0x3E, 0x14, 0x3C, 0x16, 0x3A, 0x28, 0x36,
+  0x2C, 0x76, 0x0F, 0x28, 0x25, 0x73, 0x28, 0x13, 0x17, 0x23, 0x2F, 0x52,
+  0x31, 0xF6, 0x1F, 0xA1, 0x21, 0xF7, 0x12, 0x1F, 0xFF, 0xFC, 0x12, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xF6, 0x1F, 0xFF, 0x31, 0x21, 0xF5, 0x12,
+  0x1F, 0x51, 0x21, 0xF5, 0x12, 0x16, 0x1B, 0x31, 0x25, 0x24, 0x82, 0x27,
+  0x0F, 0x32, 0x24, 0x97, 0x1C, 0x1F, 0x51, 0xFF, 0xA1, 0xFF, 0xFC, 0x1F,
+  0xF8, 0x1B, 0x8C, 0x8F, 0x51, 0xFF, 0xA1, 0xFF, 0xFF, 0x31, 0xF3, 0x1F,
+  0x51, 0xF2, 0x14, 0x1C, 0x23, 0x24, 0x93, 0x11, 0x0F, 0x74, 0xB5, 0x1E,
+  0x1F, 0x51, 0xFF, 0xA1, 0xFF, 0xFA, 0x1F, 0xF8, 0x1B, 0x8C, 0x8F, 0x51,
+  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xF1, 0x13, 0x1D, 0x25, 0x2B, 0xA8,
+  0x41, 0xB3, 0x73, 0x12, 0x93, 0xB4, 0x82, 0xE3, 0x72, 0xF1, 0x35, 0x3F,
+  0x22, 0x52, 0xF3, 0x24, 0x3F, 0x41, 0x42, 0xF9, 0x3F, 0x93, 0xF9, 0x3F,
+  0x0C, 0xF2, 0x52, 0x3F, 0x33, 0x33, 0xF3, 0x33, 0x4F, 0x23, 0x43, 0xF2,
+  0x34, 0x3F, 0x23, 0x53, 0xF1, 0x36, 0x3F, 0x03, 0x73, 0xE3, 0x84, 0xC3,
+  0xA4, 0x74, 0xF0, 0x98, 0x09, 0x7B, 0x52, 0x72, 0x52, 0x21, 0x31, 0xB1,
+  0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xDC, 0xDF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x31, 0xB1, 0x31, 0x22, 0x52, 0x72,
+  0x52, 0x0B, 0x52, 0x21, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x13,
+  0x12, 0x25, 0x20, 0x4A, 0x43, 0x52, 0x71, 0x31, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x71, 0x61, 0xE1, 0x21, 0x11, 0x42, 0x34,
+  0x50, 0x0B, 0x49, 0x75, 0x95, 0xA3, 0xA3, 0xC3, 0xA2, 0xD3, 0x91, 0xF0,
+  0x38, 0x1F, 0x13, 0x71, 0xF2, 0x35, 0x2F, 0x33, 0x41, 0xF5, 0x33, 0x1F,
+  0x63, 0x12, 0xF7, 0x7F, 0x63, 0x14, 0xF5, 0x32, 0x4F, 0x43, 0x34, 0xF3,
+  0x34, 0x5F, 0x13, 0x64, 0xF0, 0x37, 0x4E, 0x38, 0x4D, 0x39, 0x4C, 0x3A,
+  0x5A, 0x3B, 0x58, 0x59, 0x83, 0xB4, 0xD0, 0x0A, 0xB3, 0x52, 0xE1, 0x31,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+  0x1F, 0xFA, 0x2F, 0x31, 0x51, 0xD1, 0x11, 0x13, 0x4A, 0x40, 0x07, 0xF4,
+  0x7F, 0x81, 0x32, 0x21, 0x41, 0xF5, 0x1F, 0xB1, 0xE1, 0xFC, 0x1F, 0x22,
+  0xFF, 0xD1, 0x21, 0xC2, 0xFF, 0xF3, 0x1A, 0x2F, 0x01, 0xFF, 0x41, 0x82,
+  0xF2, 0x1A, 0x1F, 0x81, 0x71, 0xF4, 0x18, 0x1F, 0xF1, 0x1F, 0x91, 0x31,
+  0xF8, 0x17, 0x1F, 0xB1, 0x11, 0xFA, 0x15, 0x1F, 0xD2, 0xFB, 0x1F, 0x51,
+  0x21, 0x91, 0x81, 0x31, 0x22, 0x42, 0xE2, 0x52, 0x06, 0xEB, 0x31, 0xD2,
+  0x33, 0x31, 0x31, 0xE1, 0x11, 0x71, 0x31, 0xFD, 0x1F, 0x91, 0xFF, 0x11,
+  0xF9, 0x13, 0x1F, 0x91, 0x31, 0xF9, 0x13, 0x1F, 0x91, 0x31, 0xF9, 0x13,
+  0x1F, 0x91, 0x31, 0xF9, 0x13, 0x1F, 0x91, 0x31, 0xF9, 0x13, 0x1F, 0x91,
+  0x31, 0xF9, 0x13, 0x1F, 0x91, 0x31, 0xF9, 0x1F, 0xFF, 0xB1, 0xB1, 0x11,
+  0xE1, 0x73, 0x32, 0xD1, 0x50, 0x87, 0xE2, 0x63, 0xA3, 0x92, 0x83, 0xB3,
+  0x62, 0xD2, 0x52, 0xF0, 0x23, 0x3F, 0x03, 0x23, 0xF0, 0x31, 0x3F, 0x26,
+  0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x22, 0x3F,
+  0x03, 0x23, 0xF0, 0x33, 0x2F, 0x02, 0x52, 0xD3, 0x53, 0xB3, 0x73, 0x93,
+  0xA3, 0x53, 0xE7, 0x80, 0x0D, 0x52, 0x45, 0x22, 0x51, 0x82, 0x21, 0xF0,
+  0x12, 0x1F, 0x01, 0x21, 0xFF, 0xFF, 0xFB, 0x12, 0x1D, 0x1A, 0x15, 0x12,
+  0x27, 0x62, 0x1A, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x13, 0x1B, 0x25,
+  0x38, 0x87, 0xE2, 0x63, 0xB2, 0x92, 0x83, 0xB3, 0x62, 0xD2, 0x52, 0xF0,
+  0x23, 0x3F, 0x03, 0x23, 0xF0, 0x32, 0x2F, 0x26, 0xF2, 0x6F, 0x26, 0xF2,
+  0x6F, 0x26, 0xF2, 0x6F, 0x26, 0xF2, 0x31, 0x3F, 0x03, 0x23, 0xF0, 0x33,
+  0x2F, 0x02, 0x43, 0xD3, 0x53, 0xB3, 0x73, 0x93, 0x94, 0x54, 0xC9, 0xF1,
+  0x6F, 0x35, 0xF4, 0x5F, 0x54, 0xF5, 0x5F, 0x54, 0xF7, 0x40, 0x0F, 0x0B,
+  0x55, 0x5A, 0x38, 0x49, 0x39, 0x39, 0x3A, 0x38, 0x3A, 0x38, 0x3A, 0x38,
+  0x3A, 0x38, 0x3A, 0x38, 0x39, 0x39, 0x38, 0x3A, 0x35, 0x4C, 0x9F, 0x03,
+  0x34, 0xE3, 0x44, 0xD3, 0x53, 0xD3, 0x63, 0xC3, 0x73, 0xB3, 0x74, 0xA3,
+  0x84, 0x93, 0x94, 0x83, 0xA4, 0x65, 0xA5, 0x29, 0x96, 0x45, 0x41, 0x33,
+  0x45, 0x23, 0x64, 0x13, 0x83, 0x13, 0x92, 0x13, 0x92, 0x14, 0x91, 0x24,
+  0x81, 0x25, 0xC5, 0xB6, 0xB5, 0xB6, 0xB4, 0xC4, 0xC5, 0xA5, 0xB5, 0xA5,
+  0xA6, 0x92, 0x14, 0x73, 0x15, 0x53, 0x21, 0x46, 0x40, 0x0F, 0x63, 0x63,
+  0x65, 0x1F, 0x01, 0x31, 0xF2, 0x1F, 0x71, 0xF4, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x13, 0x1E, 0x25, 0x26,
+  0x0A, 0x8C, 0x52, 0x83, 0x33, 0x31, 0x31, 0xD1, 0x11, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+  0x1F, 0x12, 0xB1, 0xF9, 0x12, 0x1B, 0x2B, 0x12, 0x27, 0x3D, 0x31, 0x97,
+  0x0A, 0x7A, 0x62, 0x72, 0x42, 0x21, 0x41, 0xB1, 0x21, 0x51, 0xF0, 0x11,
+  0x17, 0x12, 0x1C, 0x1F, 0xF7, 0x19, 0x2A, 0x1F, 0xFF, 0x51, 0x21, 0x72,
+  0xFF, 0xF2, 0x2E, 0x12, 0x1F, 0xFF, 0x51, 0x32, 0xF1, 0x1F, 0xFF, 0x81,
+  0x12, 0xF3, 0x1F, 0xFF, 0x51, 0x22, 0xFF, 0xF3, 0x1F, 0x71, 0xD0, 0x08,
+  0x39, 0x79, 0x51, 0x32, 0x52, 0x72, 0x32, 0x21, 0x31, 0x61, 0x31, 0xB1,
+  0x11, 0x81, 0xA1, 0xB1, 0x71, 0xA1, 0xF0, 0x1F, 0xFE, 0x1A, 0x19, 0x28,
+  0x1F, 0xFF, 0xFB, 0x15, 0x23, 0x17, 0x2A, 0x1A, 0x1F, 0xFD, 0x2F, 0x42,
+  0x21, 0x21, 0xF4, 0x12, 0x1F, 0xFF, 0x42, 0xFA, 0x12, 0x1F, 0x41, 0x21,
+  0x12, 0xFF, 0xE2, 0xFC, 0x12, 0x1F, 0x72, 0xFE, 0x1B, 0x12, 0x2F, 0xFF,
+  0x91, 0xB1, 0xF4, 0x1B, 0x1C, 0x0C, 0x59, 0x37, 0xA4, 0x85, 0xB2, 0xA4,
+  0xA2, 0xC4, 0x82, 0xE3, 0x71, 0xF1, 0x46, 0x1F, 0x24, 0x41, 0xF4, 0x42,
+  0x1F, 0x63, 0x12, 0xF6, 0x5F, 0x84, 0xF9, 0x4F, 0x71, 0x13, 0xF6, 0x12,
+  0x4F, 0x41, 0x44, 0xF2, 0x16, 0x3F, 0x12, 0x64, 0xF0, 0x18, 0x4D, 0x1A,
+  0x4B, 0x1C, 0x49, 0x2C, 0x56, 0x4C, 0x63, 0x88, 0xB0, 0x0A, 0x8A, 0x52,
+  0x82, 0x23, 0x31, 0xF2, 0x17, 0x1E, 0x29, 0x12, 0x19, 0x2E, 0x1F, 0x61,
+  0xA2, 0xF1, 0x1F, 0x61, 0x82, 0xF0, 0x12, 0x13, 0x2F, 0xFC, 0x12, 0x11,
+  0x2F, 0xFE, 0x12, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x13,
+  0x1F, 0x23, 0x53, 0x70, 0x3F, 0x15, 0x2A, 0x45, 0x1A, 0x45, 0x1B, 0x36,
+  0x1A, 0x46, 0x19, 0x4F, 0x23, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x23, 0xF2,
+  0x4F, 0x23, 0xF2, 0x3F, 0x24, 0xF2, 0x3F, 0x23, 0xF2, 0x4F, 0x14, 0xD1,
+  0x33, 0xE1, 0x24, 0xD2, 0x14, 0xE1, 0x23, 0xE2, 0x1F, 0x51, 0x07, 0xA4,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x70, 0x12, 0xFF, 0x01, 0x71,
+  0xFF, 0x01, 0x11, 0xFF, 0x01, 0x71, 0xFF, 0x01, 0x11, 0xFF, 0x01, 0x71,
+  0xFF, 0x01, 0x11, 0xFD, 0x11, 0x1A, 0x07, 0x74, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xC4, 0xA0, 0x71, 0xF0, 0x1E, 0x3C, 0x21, 0x2B, 0x21, 0x2A,
+  0x23, 0x28, 0x25, 0x27, 0x25, 0x26, 0x27, 0x24, 0x29, 0x23, 0x29, 0x22,
+  0x2B, 0x21, 0x0F, 0xF6, 0xF1, 0xE3, 0x86, 0x0C, 0x10, 0x46, 0x72, 0x13,
+  0x21, 0x81, 0x31, 0x21, 0x41, 0xFF, 0xE3, 0x41, 0xB4, 0x92, 0x12, 0x91,
+  0x12, 0xA1, 0x11, 0xB1, 0xFF, 0xF2, 0x13, 0x25, 0x23, 0x53, 0x31, 0x14,
+  0x12, 0x13, 0x11, 0x42, 0xD3, 0xE1, 0xF2, 0x3F, 0xFF, 0xFF, 0xF6, 0x5B,
+  0x25, 0x19, 0x11, 0x43, 0x18, 0x24, 0x13, 0x1E, 0x1F, 0x61, 0xE1, 0xFF,
+  0xFF, 0xFF, 0x21, 0xE1, 0xF4, 0x1E, 0x11, 0x15, 0x12, 0x24, 0x11, 0x17,
+  0x22, 0x64, 0x54, 0x65, 0x12, 0x31, 0x11, 0x31, 0x21, 0x11, 0xD1, 0x81,
+  0x83, 0xFF, 0xFF, 0xB2, 0x21, 0xF3, 0x21, 0x12, 0x14, 0x26, 0x45, 0x24,
+  0x22, 0xC2, 0xD2, 0xE1, 0xF1, 0x2F, 0xFF, 0xFF, 0x45, 0xA2, 0x13, 0x11,
+  0x81, 0x21, 0x31, 0xB1, 0x51, 0x71, 0xF3, 0x1D, 0x1F, 0xFF, 0xFF, 0xC1,
+  0xD1, 0xF5, 0x1D, 0x13, 0x13, 0x23, 0x32, 0x13, 0x31, 0x15, 0x13, 0x14,
+  0x23, 0x31, 0x45, 0x61, 0x33, 0x41, 0x53, 0x21, 0x73, 0x11, 0x7F, 0x2A,
+  0x2A, 0x2A, 0x2A, 0x39, 0x38, 0x11, 0x37, 0x11, 0x36, 0x13, 0x34, 0x23,
+  0x86, 0x44, 0x75, 0x75, 0x21, 0x51, 0x11, 0x31, 0x21, 0xF2, 0x17, 0x3F,
+  0xFD, 0x23, 0x36, 0x23, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x13,
+  0x17, 0x25, 0x25, 0x46, 0x82, 0x37, 0x22, 0x53, 0x43, 0x54, 0x33, 0x63,
+  0x33, 0x63, 0x33, 0x63, 0x34, 0x53, 0x43, 0x52, 0x63, 0x32, 0x85, 0x91,
+  0xD1, 0xD2, 0xDC, 0x3D, 0x4C, 0x21, 0xA2, 0x11, 0xC3, 0xC3, 0xB1, 0x14,
+  0x72, 0x3B, 0x67, 0x50, 0x32, 0xD2, 0xE1, 0xF1, 0x2F, 0xFF, 0xFF, 0xF2,
+  0x4B, 0x24, 0x19, 0x5B, 0x24, 0x12, 0x17, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF2, 0x13, 0x15, 0x15, 0x15, 0x13, 0x14, 0x20, 0x23, 0xF3, 0x3F,
+  0xB2, 0x32, 0x41, 0x62, 0xFF, 0xFF, 0xF8, 0x13, 0x11, 0x15, 0x10, 0x63,
+  0xF9, 0x3F, 0xF4, 0x24, 0x35, 0x18, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+  0x49, 0x11, 0x11, 0x11, 0x13, 0x11, 0x12, 0x42, 0xF0, 0x2F, 0x11, 0xF3,
+  0x2F, 0xFF, 0xFF, 0xFC, 0x8B, 0x23, 0x3E, 0x2F, 0x02, 0xF1, 0x2F, 0x12,
+  0xF1, 0x2F, 0x02, 0x11, 0xF0, 0x1F, 0x41, 0x21, 0xF1, 0x12, 0x1F, 0x11,
+  0x21, 0xF4, 0x1F, 0x01, 0xF4, 0x12, 0x16, 0x13, 0x18, 0x22, 0x25, 0x28,
+  0x20, 0x32, 0x32, 0x41, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x13, 0x11,
+  0x15, 0x10, 0x23, 0x44, 0x55, 0x42, 0x52, 0x41, 0x31, 0x51, 0x32, 0x45,
+  0x55, 0xB2, 0x41, 0x23, 0x41, 0x21, 0x71, 0x91, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x31, 0x51, 0x91, 0x51, 0x51, 0x31,
+  0x42, 0x31, 0x42, 0x42, 0x35, 0x63, 0x41, 0x51, 0x41, 0x65, 0x73, 0x32,
+  0x41, 0x21, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x13, 0x15,
+  0x13, 0x12, 0x25, 0x13, 0x15, 0x20, 0x55, 0x82, 0x43, 0x52, 0x63, 0x42,
+  0x73, 0x22, 0x83, 0x22, 0x87, 0x96, 0x96, 0x96, 0x96, 0x97, 0x82, 0x23,
+  0x82, 0x23, 0x72, 0x43, 0x62, 0x53, 0x41, 0x95, 0x50, 0x42, 0x34, 0x53,
+  0x32, 0x42, 0x21, 0x73, 0x63, 0x32, 0x31, 0x31, 0x71, 0x51, 0xF5, 0x1D,
+  0x1F, 0xFF, 0xFF, 0xC1, 0xFF, 0x01, 0x11, 0x71, 0x51, 0xB1, 0x31, 0x21,
+  0x81, 0x13, 0x12, 0xA5, 0xFF, 0xFF, 0xF0, 0x13, 0x1A, 0x25, 0x28, 0x55,
+  0x31, 0x62, 0x13, 0x13, 0x61, 0x21, 0x31, 0xB1, 0x51, 0x71, 0xF3, 0x1D,
+  0x1F, 0xFF, 0xFF, 0xFE, 0x1D, 0x13, 0x1F, 0x21, 0x41, 0x71, 0x45, 0x82,
+  0x42, 0xB4, 0xFF, 0xFF, 0xFC, 0x13, 0x1A, 0x25, 0x20, 0x42, 0x33, 0x23,
+  0x41, 0x32, 0x63, 0x33, 0x32, 0x21, 0x11, 0x61, 0x41, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xD1, 0x31, 0x62, 0x52, 0x40, 0x37, 0x22, 0x43, 0x12, 0x62, 0x12,
+  0x71, 0x13, 0x61, 0x14, 0x75, 0x76, 0x76, 0x66, 0x76, 0x74, 0x75, 0x65,
+  0x62, 0x14, 0x33, 0x18, 0x30, 0x41, 0xF3, 0x18, 0x18, 0x18, 0x14, 0x41,
+  0x23, 0x4F, 0xFF, 0xFF, 0xFF, 0xF6, 0x13, 0x12, 0x13, 0x43, 0x13, 0x21,
+  0x05, 0x55, 0x32, 0x81, 0xF3, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x21, 0xB1, 0x42, 0x33, 0x21, 0x35, 0x61, 0x31, 0x42, 0x43, 0x10, 0x08,
+  0x57, 0x51, 0x51, 0x31, 0x61, 0x91, 0x31, 0xC1, 0x51, 0x21, 0xF9, 0x27,
+  0x12, 0x1F, 0xF6, 0x13, 0x29, 0x1F, 0x82, 0xB1, 0x21, 0xFF, 0x31, 0x22,
+  0xFF, 0x21, 0xF4, 0x17, 0x06, 0x27, 0x46, 0x41, 0x22, 0x41, 0x42, 0x21,
+  0xF7, 0x12, 0x18, 0x1F, 0xF9, 0x12, 0x18, 0x15, 0x2F, 0xF6, 0x2F, 0x01,
+  0x21, 0x51, 0x21, 0x32, 0xFF, 0x41, 0x12, 0x51, 0x12, 0x81, 0x81, 0xFF,
+  0x91, 0x22, 0x41, 0x22, 0xFF, 0xFE, 0x11, 0x16, 0x11, 0x16, 0x07, 0x25,
+  0x35, 0x43, 0x54, 0x42, 0x73, 0x41, 0x93, 0x21, 0xA3, 0x11, 0xC4, 0xC4,
+  0xD3, 0xD4, 0xB1, 0x13, 0xA1, 0x33, 0x91, 0x43, 0x71, 0x53, 0x61, 0x73,
+  0x42, 0x74, 0x25, 0x47, 0x07, 0x46, 0x42, 0x42, 0x21, 0x11, 0xC1, 0xF4,
+  0x12, 0x16, 0x2F, 0x91, 0xC1, 0x72, 0xF8, 0x12, 0x1F, 0x32, 0x91, 0x21,
+  0xF1, 0x2B, 0x1F, 0xF2, 0x11, 0x1F, 0xFF, 0x02, 0xFE, 0x28, 0x3F, 0x14,
+  0x91, 0x32, 0xA0, 0x1C, 0x12, 0x63, 0x21, 0x73, 0x21, 0x63, 0x94, 0x93,
+  0x93, 0xA3, 0x93, 0x93, 0xA3, 0x93, 0x94, 0x61, 0x23, 0x71, 0x13, 0x81,
+  0x13, 0x7F, 0x00, 0x82, 0x62, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x74,
+  0x73, 0x73, 0x73, 0x72, 0x73, 0x62, 0x63, 0x91, 0xA1, 0xA2, 0x82, 0x83,
+  0x73, 0x64, 0x64, 0x64, 0x63, 0x73, 0x73, 0x82, 0x92, 0x92, 0xA2, 0x0F,
+  0xFF, 0xF6, 0x02, 0x93, 0x92, 0x92, 0x83, 0x73, 0x73, 0x64, 0x64, 0x63,
+  0x73, 0x73, 0x82, 0x83, 0x83, 0x93, 0x71, 0x81, 0x72, 0x82, 0x73, 0x73,
+  0x74, 0x64, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72, 0x72, 0x62, 0x80, 0x25,
+  0xB1, 0x19, 0x83, 0x46, 0x51, 0x11, 0x89, 0x11, 0xB5, 0x20, 0x0F, 0x21,
+  0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA,
+  0xF0, 0x10, 0x0F, 0x01, 0x53, 0x4F, 0x01, 0xF1, 0x1D, 0x1F, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF3, 0x33, 0x24, 0xA2, 0xF2, 0x2F, 0x32, 0xF4, 0x1F, 0xFF,
+  0xFF, 0xFC, 0x19, 0x18, 0x21, 0x34, 0x21, 0x25, 0x12, 0x43, 0x51, 0x16,
+  0x17, 0x16, 0x12, 0x1F, 0x01, 0xF8, 0x22, 0x1F, 0xFF, 0xFF, 0xFF, 0xF2,
+  0x12, 0x1F, 0xF7, 0x11, 0x1F, 0x01, 0x71, 0x31, 0x31, 0x61, 0x31, 0x23,
+  0x45, 0x11, 0x56, 0x45, 0xFF, 0xFF, 0xFF, 0xFA, 0x23, 0x27, 0x07, 0x46,
+  0x12, 0x41, 0x41, 0x41, 0x61, 0x61, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFA, 0x16, 0x12, 0x12, 0x24, 0x64, 0xF2, 0xF3, 0x1F, 0x31, 0xF4,
+  0x07, 0x36, 0x12, 0x32, 0x31, 0x32, 0xFF, 0xFF, 0xFF, 0xF3, 0x68, 0x32,
+  0x4B, 0x2F, 0xFF, 0xFF, 0x01, 0xB2, 0x42, 0x07, 0x36, 0x39, 0x32, 0x32,
+  0x31, 0x32, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x82, 0x37, 0x36, 0x32, 0x07, 0x36, 0x39, 0x32, 0x32, 0x31,
+  0x32, 0x32, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x82, 0x37, 0x36, 0x3F, 0xBF, 0xB1, 0xFF, 0xF8, 0x0B, 0x83, 0x33,
+  0x71, 0xFF, 0x21, 0xFF, 0xFD, 0x7A, 0x52, 0x1E, 0x12, 0x1F, 0xFF, 0xF4,
+  0x1F, 0x01, 0x31, 0x23, 0x34, 0x22, 0x10, 0x08, 0x89, 0x42, 0x81, 0x42,
+  0x21, 0x21, 0xB1, 0xFF, 0xFF, 0xFF, 0xC7, 0xF1, 0x52, 0x2F, 0x41, 0xFB,
+  0x1F, 0x41, 0xF7, 0x1F, 0xA1, 0xA1, 0x62, 0x21, 0x31, 0x52, 0x34, 0x22,
+  0x22, 0x42, 0x08, 0x72, 0x42, 0x91, 0xFF, 0xFF, 0xF3, 0x69, 0x42, 0x2B,
+  0x13, 0x1B, 0x1F, 0xE1, 0xF2, 0x12, 0x16, 0x22, 0x11, 0x24, 0x33, 0x12,
+  0x35, 0x63, 0x33, 0x42, 0x53, 0x31, 0x72, 0x31, 0x73, 0x21, 0x73, 0xA3,
+  0xA4, 0x58, 0xA2, 0xA3, 0xA3, 0xA3, 0xA2, 0x21, 0x73, 0x32, 0x43, 0x65,
+  0x50, 0xF1, 0x27, 0x85, 0x86, 0x46, 0x25, 0x45, 0x26, 0x27, 0x44, 0x26,
+  0x28, 0x34, 0x25, 0x38, 0x43, 0x25, 0x39, 0x33, 0x24, 0x3A, 0x33, 0x9A,
+  0x33, 0x24, 0x49, 0x33, 0x24, 0x49, 0x33, 0x25, 0x39, 0x33, 0x25, 0x39,
+  0x24, 0x25, 0x47, 0x34, 0x26, 0x37, 0x24, 0x46, 0x35, 0x23, 0x85, 0x84,
+  0x5B, 0x32, 0x24, 0x32, 0x61, 0xB1, 0xFF, 0x11, 0xF4, 0x1C, 0x22, 0x3B,
+  0x14, 0x1E, 0x2A, 0x12, 0x1B, 0x1F, 0x31, 0xB1, 0x21, 0xB1, 0xD2, 0x31,
+  0x32, 0x32, 0x0F, 0x32, 0x35, 0x69, 0x1A, 0x3F, 0x52, 0xFF, 0x91, 0xFF,
+  0xFF, 0xFF, 0xF4, 0x8C, 0x53, 0x2F, 0x01, 0x41, 0xF0, 0x1F, 0x51, 0x31,
+  0xFF, 0xFF, 0xF0, 0x1F, 0x81, 0xE1, 0x81, 0x73, 0x41, 0x13, 0x53, 0x43,
+  0x20, 0x0F, 0x85, 0x69, 0x1A, 0x4F, 0x51, 0xFF, 0xA1, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x13, 0x53, 0x90,
+  0x5F, 0x55, 0x32, 0x84, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x1F, 0xFF,
+  0xFF, 0xF7, 0x1F, 0xFF, 0xFF, 0x01, 0xF7, 0x1F, 0xFF, 0x51, 0xF7, 0x1F,
+  0xA1, 0xF7, 0x1F, 0x81, 0x11, 0xA2, 0x73, 0x2B, 0x63, 0x6E, 0x92, 0xE2,
+  0x61, 0xF3, 0x14, 0x1F, 0xFF, 0x01, 0x21, 0xFF, 0xF3, 0x15, 0x5B, 0x55,
+  0x17, 0x75, 0x7C, 0x12, 0x64, 0x72, 0x15, 0x71, 0x73, 0x71, 0xE1, 0x73,
+  0x62, 0xE2, 0x63, 0x62, 0xF0, 0x16, 0x36, 0x1F, 0x11, 0x63, 0x52, 0xF1,
+  0x25, 0x35, 0x2F, 0x21, 0x53, 0x42, 0xF3, 0x24, 0x33, 0x3F, 0x4D, 0xF4,
+  0x42, 0x32, 0x4F, 0x24, 0x33, 0x34, 0xF1, 0x34, 0x34, 0x3F, 0x04, 0x43,
+  0x44, 0xD4, 0x53, 0x53, 0xD4, 0x53, 0x54, 0xB4, 0x63, 0x64, 0xA3, 0x73,
+  0x64, 0x94, 0x73, 0x74, 0x74, 0x74, 0x84, 0x55, 0x75, 0x75, 0x26, 0x5B,
+  0x56, 0x11, 0x61, 0x8B, 0x54, 0x54, 0x32, 0x83, 0x32, 0x84, 0x21, 0x94,
+  0x21, 0xA3, 0x21, 0x94, 0xC4, 0xC4, 0xB4, 0xA5, 0x86, 0xD5, 0xD5, 0xC4,
+  0xC5, 0xC4, 0xC4, 0xC4, 0xB6, 0xA4, 0x22, 0x75, 0x32, 0x55, 0x59, 0xB1,
+  0x80, 0x0B, 0x5E, 0x53, 0x53, 0x53, 0x31, 0xF4, 0x1A, 0x1F, 0xFF, 0xF4,
+  0x1F, 0xA1, 0xFA, 0x11, 0x1F, 0x81, 0x11, 0xFA, 0x1F, 0x92, 0xF9, 0x1F,
+  0xA1, 0x11, 0xF8, 0x11, 0x1F, 0x81, 0x11, 0xFA, 0x1F, 0x91, 0xFA, 0x11,
+  0x1F, 0x81, 0x11, 0xFA, 0x1F, 0xA1, 0xFB, 0x1F, 0x71, 0xF4, 0x13, 0x35,
+  0x35, 0x35, 0x30, 0x72, 0x92, 0xF1, 0x17, 0x1F, 0x41, 0xF8, 0x18, 0x12,
+  0x1F, 0x02, 0x15, 0x21, 0xF3, 0x8F, 0xF6, 0xB5, 0xE5, 0x35, 0x35, 0x33,
+  0x1F, 0x41, 0xA1, 0xFF, 0xFF, 0x41, 0xFA, 0x1F, 0xA1, 0x11, 0xF8, 0x11,
+  0x1F, 0xA1, 0xF9, 0x2F, 0x91, 0xFA, 0x11, 0x1F, 0x81, 0x11, 0xF8, 0x11,
+  0x1F, 0xA1, 0xF9, 0x1F, 0xA1, 0x11, 0xF8, 0x11, 0x1F, 0xA1, 0xFA, 0x1F,
+  0xB1, 0xF7, 0x1F, 0x41, 0x33, 0x53, 0x53, 0x53, 0x0B, 0x75, 0x55, 0x88,
+  0x54, 0x82, 0x15, 0x54, 0x72, 0x51, 0x64, 0x72, 0xC4, 0x71, 0xD4, 0x62,
+  0xD4, 0x61, 0xE4, 0x52, 0xE4, 0x42, 0xF0, 0x43, 0x2F, 0x19, 0xF1, 0x41,
+  0x5F, 0x04, 0x34, 0xE4, 0x44, 0xD4, 0x54, 0xC4, 0x54, 0xC4, 0x64, 0xB4,
+  0x74, 0xA4, 0x75, 0x94, 0x84, 0x94, 0x94, 0x75, 0xA4, 0x3B, 0x77, 0x4F,
+  0x54, 0x32, 0x84, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xF9, 0x1F, 0x31, 0x51, 0xF1, 0x11, 0x21,
+  0x1F, 0x71, 0x11, 0x91, 0xC1, 0x73, 0x53, 0x0F, 0xE4, 0xC4, 0x33, 0x1F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0xF6, 0x1F, 0x73, 0x53, 0x53, 0x43, 0x0A,
+  0x87, 0x26, 0xC3, 0x55, 0xD1, 0x74, 0xC2, 0x75, 0xB1, 0x94, 0xA2, 0xA4,
+  0x91, 0xB4, 0x82, 0xC4, 0x72, 0xC5, 0x61, 0xE4, 0x52, 0xE5, 0x41, 0xF1,
+  0x43, 0x2F, 0x15, 0x21, 0xF3, 0x41, 0x2F, 0x45, 0xF5, 0x5F, 0x64, 0xF6,
+  0x3F, 0x82, 0xF7, 0x2F, 0x14, 0x32, 0xF1, 0x8F, 0x27, 0xFF, 0x80, 0x9B,
+  0xF5, 0x5F, 0x84, 0xF6, 0xAE, 0xC1, 0x58, 0x45, 0x45, 0x45, 0x46, 0x47,
+  0x34, 0x37, 0x47, 0x42, 0x47, 0x48, 0x32, 0x38, 0x48, 0x88, 0x48, 0x88,
+  0x48, 0x88, 0x48, 0x88, 0x48, 0x41, 0x38, 0x48, 0x41, 0x47, 0x48, 0x33,
+  0x37, 0x47, 0x44, 0x36, 0x46, 0x46, 0x35, 0x45, 0x49, 0xF2, 0xF2, 0x4F,
+  0x94, 0xF9, 0x5F, 0x5B, 0x80, 0x0B, 0x5D, 0x53, 0x53, 0x43, 0x31, 0xFE,
+  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFD, 0x13, 0x1F, 0xB1, 0x82, 0x41, 0x23, 0x68, 0x7F,
+  0x8F, 0xB2, 0xFB, 0x1F, 0xB1, 0xFF, 0xFF, 0xF3, 0x10, 0x0A, 0x3D, 0x53,
+  0x33, 0x53, 0x21, 0xD1, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x31, 0x31, 0x63, 0xF0, 0x62, 0x1B, 0x26, 0x4E, 0x6F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF2, 0x1F, 0x41, 0xF5, 0x35, 0x30, 0x0A, 0x4A, 0x3D, 0x52, 0x42,
+  0x53, 0x33, 0x43, 0x71, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2, 0x62, 0x41, 0x62, 0x73, 0x66, 0x76,
+  0x63, 0x0A, 0x4A, 0x3D, 0x52, 0x42, 0x53, 0x33, 0x43, 0x71, 0x81, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA2,
+  0x62, 0x41, 0x62, 0x73, 0x66, 0x76, 0x6F, 0xF5, 0xFF, 0x72, 0xFF, 0x71,
+  0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xF0, 0x0F, 0x0E, 0x34, 0x3B, 0x3F, 0x51,
+  0x91, 0xFF, 0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x48, 0xF1, 0x53, 0x2F,
+  0x42, 0x32, 0xF4, 0x1F, 0x91, 0x31, 0xFF, 0xFF, 0xFF, 0x11, 0xFC, 0x17,
+  0x1A, 0x13, 0x1C, 0x13, 0x33, 0x16, 0x35, 0x34, 0x23, 0x0B, 0xAE, 0x53,
+  0xA3, 0x53, 0x31, 0xF5, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xF1, 0x7F, 0xA4, 0x33, 0xFB, 0x24, 0x1F, 0xC1, 0xFF, 0x21, 0x31,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x31, 0xFF, 0x51, 0xFB, 0x1F, 0x51, 0x73, 0x41,
+  0x51, 0x73, 0x53, 0x43, 0x33, 0x53, 0x0B, 0x93, 0x53, 0xC1, 0x31, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x8C, 0x53, 0x3E, 0x24, 0x1F, 0x01, 0xF5,
+  0x13, 0x1F, 0xFF, 0xFF, 0x01, 0xF8, 0x13, 0x1A, 0x1C, 0x13, 0x33, 0x21,
+  0x35, 0x34, 0x23, 0x12, 0x46, 0xCB, 0x91, 0x12, 0x61, 0x12, 0x81, 0x92,
+  0x11, 0x61, 0xE1, 0x41, 0xD1, 0x21, 0xFF, 0x91, 0x21, 0x11, 0xFF, 0xFF,
+  0x8B, 0xAB, 0xFF, 0xFF, 0xFF, 0xE1, 0x21, 0xF7, 0x1E, 0x12, 0x12, 0x2C,
+  0x12, 0x14, 0x2A, 0x12, 0x16, 0x36, 0x22, 0x18, 0x81, 0x35, 0xF9, 0x1B,
+  0xB9, 0x41, 0x47, 0x35, 0x37, 0x22, 0x52, 0x28, 0x1D, 0x12, 0x25, 0x22,
+  0x1B, 0x18, 0x12, 0x19, 0x12, 0x1F, 0x31, 0xE1, 0x21, 0xF1, 0x13, 0x1F,
+  0x01, 0xFF, 0xF5, 0x13, 0x1D, 0x13, 0x1F, 0xFF, 0xFF, 0xFF, 0xA6, 0xFF,
+  0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x31, 0xD1, 0x31, 0xFF,
+  0xF5, 0x13, 0x1B, 0x13, 0x1F, 0x11, 0xF2, 0x19, 0x18, 0x12, 0x19, 0x12,
+  0x16, 0x1D, 0x12, 0x25, 0x22, 0x14, 0x35, 0x37, 0x22, 0x52, 0x25, 0xB9,
+  0x41, 0x47, 0xAE, 0x84, 0x64, 0x93, 0x83, 0x93, 0x93, 0x84, 0x93, 0x83,
+  0xA3, 0x83, 0xA3, 0x83, 0xA3, 0x93, 0x93, 0x93, 0x93, 0xA3, 0x83, 0xC4,
+  0x53, 0xF0, 0x9E, 0x43, 0x3E, 0x34, 0x3D, 0x35, 0x3C, 0x45, 0x3B, 0x46,
+  0x3A, 0x47, 0x39, 0x48, 0x38, 0x49, 0x37, 0x4A, 0x35, 0x5A, 0x52, 0x69,
+  0x90, 0xE1, 0x6A, 0x5A, 0x59, 0x63, 0xD1, 0xE2, 0xE1, 0xF0, 0x15, 0x27,
+  0x13, 0x84, 0x12, 0x25, 0x33, 0x11, 0x27, 0x32, 0x38, 0x41, 0x39, 0x31,
+  0x39, 0x79, 0x7A, 0x6A, 0x6A, 0x6A, 0x22, 0x38, 0x32, 0x38, 0x24, 0x36,
+  0x35, 0x35, 0x27, 0x75, 0x1B, 0x41, 0x35, 0x21, 0x41, 0x71, 0x21, 0xFF,
+  0xFB, 0x12, 0x16, 0x51, 0x27, 0x42, 0x3A, 0x23, 0x1B, 0x1F, 0xFE, 0x15,
+  0x17, 0x13, 0x33, 0x52, 0x21, 0x0F, 0x13, 0x74, 0x19, 0x1F, 0xD1, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x1A, 0x1B, 0x24, 0x26, 0x4D, 0x51, 0x25, 0x32, 0x61,
+  0xFF, 0xFF, 0xFE, 0x2F, 0xFF, 0xF9, 0x1F, 0x31, 0xF0, 0x1F, 0x31, 0xD3,
+  0x18, 0x33, 0x3C, 0x51, 0xC1, 0x31, 0xE1, 0xF4, 0xF0, 0xFE, 0x1F, 0xF0,
+  0x70, 0x7D, 0x30, 0xE1, 0x90, 0x21, 0xC2, 0x00, 0x43, 0x84, 0x00, 0x47,
+  0x10, 0x00, 0xCE, 0x60, 0x00, 0xFF, 0x80, 0x07, 0xBB, 0xC0, 0x0E, 0x73,
+  0x80, 0x38, 0xE3, 0x80, 0xF1, 0xC7, 0x81, 0xC3, 0x87, 0x07, 0x87, 0x07,
+  0x0E, 0x0E, 0x0E, 0x78, 0x7F, 0x0F, 0x43, 0x64, 0x33, 0x32, 0x63, 0x22,
+  0x73, 0x11, 0x83, 0x11, 0x83, 0x93, 0x84, 0x84, 0xB4, 0xB3, 0xA3, 0xA3,
+  0xA3, 0x11, 0x83, 0x21, 0x63, 0x48, 0x30, 0x07, 0x46, 0x12, 0x32, 0x41,
+  0x41, 0xF1, 0x1F, 0xF1, 0x1F, 0x11, 0xF1, 0x11, 0x1E, 0x11, 0x1F, 0x11,
+  0xF0, 0x2F, 0x02, 0xF0, 0x2F, 0xF4, 0x1F, 0xC1, 0x22, 0x33, 0x22, 0x42,
+  0x41, 0x81, 0x71, 0x11, 0x61, 0x11, 0x61, 0x21, 0x41, 0x21, 0xFA, 0x21,
+  0x41, 0x2A, 0x6F, 0xFC, 0x74, 0x61, 0x23, 0x24, 0x14, 0x1F, 0x11, 0xFF,
+  0x11, 0xF1, 0x1F, 0x11, 0x11, 0xE1, 0x11, 0xF1, 0x1F, 0x02, 0xF0, 0x2F,
+  0x02, 0xFF, 0x41, 0xFC, 0x12, 0x23, 0x32, 0x24, 0x20, 0x07, 0x45, 0x34,
+  0x55, 0x42, 0x52, 0x12, 0x52, 0x51, 0x92, 0x42, 0x92, 0x41, 0xA2, 0x32,
+  0xA7, 0xA2, 0x24, 0x92, 0x33, 0x92, 0x43, 0x82, 0x44, 0x72, 0x53, 0x72,
+  0x63, 0x54, 0x54, 0x28, 0x45, 0x3E, 0x42, 0x16, 0x32, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xF5, 0x1F, 0x11, 0x13, 0xF3, 0x13, 0x33, 0x30, 0x06,
+  0xA7, 0xD1, 0x32, 0x61, 0xFD, 0x1F, 0x61, 0x91, 0x21, 0x51, 0xF6, 0x1B,
+  0x12, 0x1F, 0x92, 0xD1, 0x21, 0xF7, 0x2F, 0xF6, 0x12, 0x1F, 0x61, 0xF2,
+  0x1C, 0x22, 0x24, 0x13, 0x23, 0x20, 0x07, 0x46, 0x12, 0x32, 0x41, 0x41,
+  0xF1, 0x1F, 0xFF, 0xFF, 0x47, 0xB7, 0xFF, 0xFF, 0xFF, 0xF6, 0x12, 0x23,
+  0x32, 0x24, 0x20, 0x0F, 0x21, 0x23, 0x74, 0x1F, 0x11, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x51, 0x22, 0x33, 0x22, 0x42, 0x44, 0x54, 0xFF,
+  0xF8, 0x18, 0x1D, 0x36, 0x3F, 0xCF, 0x43, 0x35, 0x89, 0x1C, 0x2F, 0xFE,
+  0x2F, 0x61, 0xFF, 0xFF, 0x21, 0xFF, 0xC1, 0xE7, 0xF0, 0x8F, 0xFF, 0xF6,
+  0x1F, 0xFF, 0xF9, 0x1F, 0xFC, 0x1F, 0x51, 0x11, 0x41, 0x41, 0x63, 0x43,
+  0x66, 0x70, 0x33, 0x33, 0x34, 0x24, 0x43, 0x33, 0x51, 0x51, 0xFF, 0xF2,
+  0x28, 0x84, 0x25, 0x33, 0x16, 0x41, 0x27, 0x31, 0x27, 0xF3, 0xB3, 0xA3,
+  0xA3, 0xA3, 0x91, 0x13, 0x81, 0x14, 0x62, 0x16, 0x32, 0x39, 0x66, 0x30 };
+
+const RleGlyph TimesNRCyr18pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   9,    0,    1, 0 },  // 0x20 ' '
+  {     0,   3,  24,   9,    3,  -23, 0 },  // 0x21 '!'
+  {     9,   9,  10,  14,    2,  -23, 2 },  // 0x22 '"'
+  {    18,  21,  24,  23,    1,  -23, 2 },  // 0x23 '#'
+  {    61,  14,  29,  18,    2,  -26, 0 },  // 0x24 '$'
+  {   112,  27,  24,  29,    1,  -23, 2 },  // 0x25 '%'
+  {   164,  25,  24,  27,    1,  -23, 1 },  // 0x26 '&'
+  {   224,   3,  10,   6,    2,  -23, 0 },  // 0x27 '''
+  {   228,   9,  32,  12,    2,  -24, 2 },  // 0x28 '('
+  {   254,   9,  32,  12,    1,  -24, 2 },  // 0x29 ')'
+  {   281,  13,  14,  18,    2,  -24, 0 },  // 0x2A '*'
+  {   304,  18,  18,  23,    2,  -20, 2 },  // 0x2B '+'
+  {   318,   4,   9,   9,    3,   -3, 0 },  // 0x2C ','
+  {   323,   8,   3,  12,    2,   -9, 1 },  // 0x2D '-'
+  {   325,   4,   4,   9,    3,   -3, 0 },  // 0x2E '.'
+  {   327,  11,  26,  10,    0,  -24, 2 },  // 0x2F '/'
+  {   348,  15,  24,  18,    1,  -23, 1 },  // 0x30 '0'
+  {   387,   7,  24,  17,    5,  -23, 2 },  // 0x31 '1'
+  {   399,  14,  24,  18,    2,  -23, 1 },  // 0x32 '2'
+  {   430,  14,  24,  18,    2,  -23, 1 },  // 0x33 '3'
+  {   460,  16,  24,  18,    1,  -23, 2 },  // 0x34 '4'
+  {   483,  14,  24,  18,    2,  -23, 1 },  // 0x35 '5'
+  {   510,  15,  24,  18,    1,  -23, 1 },  // 0x36 '6'
+  {   544,  15,  24,  18,    1,  -23, 1 },  // 0x37 '7'
+  {   572,  14,  24,  18,    2,  -23, 1 },  // 0x38 '8'
+  {   611,  15,  24,  18,    1,  -23, 1 },  // 0x39 '9'
+  {   645,   4,  17,   9,    3,  -16, 1 },  // 0x3A ':'
+  {   653,   4,  22,   9,    3,  -16, 0 },  // 0x3B ';'
+  {   664,  19,  17,  23,    2,  -19, 1 },  // 0x3C '<'
+  {   687,  19,  10,  23,    2,  -16, 1 },  // 0x3D '='
+  {   695,  19,  17,  23,    2,  -19, 1 },  // 0x3E '>'
+  {   718,  11,  24,  13,    1,  -23, 1 },  // 0x3F '?'
+  {   746,  29,  31,  32,    2,  -23, 2 },  // 0x40 '@'
+  {   844,  25,  24,  27,    1,  -23, 2 },  // 0x41 'A'
+  {   888,  19,  24,  23,    2,  -23, 2 },  // 0x42 'B'
+  {   929,  21,  24,  25,    2,  -23, 1 },  // 0x43 'C'
+  {   974,  25,  24,  29,    2,  -23, 2 },  // 0x44 'D'
+  {  1020,  20,  24,  23,    2,  -23, 2 },  // 0x45 'E'
+  {  1052,  20,  24,  23,    2,  -23, 2 },  // 0x46 'F'
+  {  1079,  27,  24,  29,    2,  -23, 1 },  // 0x47 'G'
+  {  1132,  25,  24,  29,    2,  -23, 2 },  // 0x48 'H'
+  {  1165,   9,  24,  13,    2,  -23, 2 },  // 0x49 'I'
+  {  1179,  14,  24,  15,    0,  -23, 2 },  // 0x4A 'J'
+  {  1201,  28,  24,  29,    1,  -23, 1 },  // 0x4B 'K'
+  {  1255,  21,  24,  23,    1,  -23, 2 },  // 0x4C 'L'
+  {  1282,  31,  24,  35,    2,  -23, 2 },  // 0x4D 'M'
+  {  1340,  28,  24,  29,    0,  -23, 2 },  // 0x4E 'N'
+  {  1397,  23,  24,  27,    2,  -23, 1 },  // 0x4F 'O'
+  {  1444,  18,  24,  21,    2,  -23, 2 },  // 0x50 'P'
+  {  1477,  23,  31,  27,    2,  -23, 1 },  // 0x51 'Q'
+  {  1534,  24,  24,  27,    2,  -23, 1 },  // 0x52 'R'
+  {  1581,  15,  24,  19,    2,  -23, 1 },  // 0x53 'S'
+  {  1617,  21,  24,  23,    1,  -23, 2 },  // 0x54 'T'
+  {  1644,  27,  24,  29,    1,  -23, 2 },  // 0x55 'U'
+  {  1680,  25,  24,  25,    0,  -23, 2 },  // 0x56 'V'
+  {  1727,  34,  24,  35,    2,  -23, 2 },  // 0x57 'W'
+  {  1793,  27,  24,  27,    0,  -23, 1 },  // 0x58 'X'
+  {  1845,  25,  24,  27,    1,  -23, 2 },  // 0x59 'Y'
+  {  1888,  21,  24,  23,    1,  -23, 1 },  // 0x5A 'Z'
+  {  1930,   7,  32,   9,    2,  -24, 2 },  // 0x5B '['
+  {  1940,  10,  26,  10,    0,  -24, 2 },  // 0x5C
+  {  1962,   7,  32,   9,    0,  -24, 2 },  // 0x5D ']'
+  {  1972,  16,  12,  20,    3,  -23, 1 },  // 0x5E '^'
+  {  1994,  18,   2,  18,    0,    3, 1 },  // 0x5F '_'
+  {  1996,   6,   6,  12,    3,  -24, 0 },  // 0x60 '`'
+  {  2001,  15,  17,  18,    2,  -16, 2 },  // 0x61 'a'
+  {  2031,  18,  25,  19,   -1,  -24, 2 },  // 0x62 'b'
+  {  2066,  12,  17,  15,    2,  -16, 2 },  // 0x63 'c'
+  {  2089,  17,  25,  19,    2,  -24, 2 },  // 0x64 'd'
+  {  2126,  12,  17,  15,    2,  -16, 1 },  // 0x65 'e'
+  {  2150,  14,  25,  12,    0,  -24, 2 },  // 0x66 'f'
+  {  2175,  15,  24,  18,    1,  -16, 1 },  // 0x67 'g'
+  {  2212,  17,  25,  19,    1,  -24, 2 },  // 0x68 'h'
+  {  2241,   7,  24,  10,    1,  -23, 2 },  // 0x69 'i'
+  {  2255,   9,  31,  10,   -3,  -23, 2 },  // 0x6A 'j'
+  {  2275,  19,  25,  19,   -1,  -24, 2 },  // 0x6B 'k'
+  {  2317,   7,  25,  10,    1,  -24, 2 },  // 0x6C 'l'
+  {  2330,  27,  17,  29,    1,  -16, 2 },  // 0x6D 'm'
+  {  2367,  19,  17,  19,    0,  -16, 2 },  // 0x6E 'n'
+  {  2394,  15,  17,  19,    2,  -16, 1 },  // 0x6F 'o'
+  {  2421,  17,  24,  19,    0,  -16, 2 },  // 0x70 'p'
+  {  2459,  17,  24,  19,    2,  -16, 2 },  // 0x71 'q'
+  {  2493,  13,  17,  13,    0,  -16, 2 },  // 0x72 'r'
+  {  2514,  11,  17,  13,    1,  -16, 1 },  // 0x73 's'
+  {  2537,  10,  22,  12,    1,  -21, 2 },  // 0x74 't'
+  {  2556,  18,  17,  19,    1,  -16, 2 },  // 0x75 'u'
+  {  2579,  18,  17,  18,   -1,  -16, 2 },  // 0x76 'v'
+  {  2608,  24,  17,  25,    1,  -16, 2 },  // 0x77 'w'
+  {  2650,  16,  17,  18,    1,  -16, 1 },  // 0x78 'x'
+  {  2680,  16,  24,  18,    1,  -16, 2 },  // 0x79 'y'
+  {  2715,  13,  17,  15,    1,  -16, 1 },  // 0x7A 'z'
+  {  2739,  10,  32,  17,    5,  -24, 1 },  // 0x7B '{'
+  {  2771,   2,  33,   7,    2,  -24, 1 },  // 0x7C '|'
+  {  2774,  10,  32,  17,    3,  -24, 1 },  // 0x7D '}'
+  {  2807,  19,   5,  23,    2,  -13, 1 },  // 0x7E '~'
+  {  2818,  17,  22,  26,    4,  -21, 2 },  // 0x7F
+  {  2421,  17,  24,  19,    0,  -16, 2 },  // 0x80
+  {  2066,  12,  17,  15,    2,  -16, 2 },  // 0x81
+  {  2834,  15,  16,  17,    1,  -15, 2 },  // 0x82
+  {  2680,  16,  24,  18,    1,  -16, 2 },  // 0x83
+  {  2849,  21,  32,  23,    1,  -24, 2 },  // 0x84
+  {  2650,  16,  17,  18,    1,  -16, 1 },  // 0x85
+  {  2902,  18,  20,  20,    1,  -15, 2 },  // 0x86
+  {  2928,  17,  16,  19,    1,  -15, 2 },  // 0x87
+  {  2947,  26,  16,  28,    1,  -15, 2 },  // 0x88
+  {  2970,  26,  20,  28,    1,  -15, 2 },  // 0x89
+  {  2997,  17,  16,  19,    1,  -15, 2 },  // 0x8A
+  {  3019,  23,  16,  25,    1,  -15, 2 },  // 0x8B
+  {  3050,  15,  16,  17,    1,  -15, 2 },  // 0x8C
+  {  3072,  13,  17,  16,    1,  -16, 1 },  // 0x8D
+  {  3097,  25,  17,  27,    1,  -16, 1 },  // 0x8E
+  {  3144,  16,  16,  17,    0,  -15, 2 },  // 0x8F
+  {   844,  25,  24,  27,    1,  -23, 2 },  // 0x90
+  {  3170,  20,  24,  23,    1,  -23, 2 },  // 0x91
+  {   888,  19,  24,  23,    2,  -23, 2 },  // 0x92
+  {  3205,  20,  24,  22,    1,  -23, 2 },  // 0x93
+  {  3228,  25,  31,  26,    0,  -23, 2 },  // 0x94
+  {  1020,  20,  24,  23,    2,  -23, 2 },  // 0x95
+  {  3273,  33,  24,  35,    1,  -23, 1 },  // 0x96
+  {  3349,  16,  26,  19,    1,  -24, 1 },  // 0x97
+  {  3385,  27,  24,  29,    1,  -23, 2 },  // 0x98
+  {  3435,  27,  31,  29,    1,  -30, 2 },  // 0x99
+  {  3500,  25,  24,  26,    1,  -23, 1 },  // 0x9A
+  {  3551,  24,  24,  26,    1,  -23, 2 },  // 0x9B
+  {  1282,  31,  24,  35,    2,  -23, 2 },  // 0x9C
+  {  1132,  25,  24,  29,    2,  -23, 2 },  // 0x9D
+  {  1397,  23,  24,  27,    2,  -23, 1 },  // 0x9E
+  {  3583,  26,  24,  29,    1,  -23, 2 },  // 0x9F
+  {  1444,  18,  24,  21,    2,  -23, 2 },  // 0xA0
+  {   929,  21,  24,  25,    2,  -23, 1 },  // 0xA1
+  {  1617,  21,  24,  23,    1,  -23, 2 },  // 0xA2
+  {  3611,  25,  25,  26,    0,  -23, 1 },  // 0xA3
+  {  3659,  28,  24,  30,    1,  -23, 1 },  // 0xA4
+  {  1793,  27,  24,  27,    0,  -23, 1 },  // 0xA5
+  {  3713,  26,  31,  29,    1,  -23, 2 },  // 0xA6
+  {  3753,  24,  24,  26,    1,  -23, 2 },  // 0xA7
+  {  3787,  37,  24,  39,    1,  -23, 2 },  // 0xA8
+  {  3829,  37,  31,  39,    1,  -23, 2 },  // 0xA9
+  {  3882,  24,  24,  26,    1,  -23, 2 },  // 0xAA
+  {  3921,  32,  24,  34,    1,  -23, 2 },  // 0xAB
+  {  3966,  20,  24,  23,    1,  -23, 2 },  // 0xAC
+  {  3999,  21,  24,  24,    1,  -23, 2 },  // 0xAD
+  {  4042,  36,  26,  39,    1,  -24, 2 },  // 0xAE
+  {  4118,  24,  24,  26,    0,  -23, 1 },  // 0xAF
+  {  2001,  15,  17,  18,    2,  -16, 2 },  // 0xB0
+  {  4165,  16,  25,  19,    2,  -24, 1 },  // 0xB1
+  {  4204,  15,  16,  18,    1,  -15, 2 },  // 0xB2
+  {  4229,  14,  16,  16,    1,  -15, 2 },  // 0xB3
+  {  4243,  18,  20,  19,    0,  -15, 2 },  // 0xB4
+  {  2126,  12,  17,  15,    2,  -16, 1 },  // 0xB5
+  {  4268,  23,  16,  25,    1,  -15, 0 },  // 0xB6
+  {  4314,  13,  17,  15,    1,  -16, 1 },  // 0xB7
+  {  4339,  18,  16,  20,    1,  -15, 2 },  // 0xB8
+  {  4368,  18,  24,  20,    1,  -23, 2 },  // 0xB9
+  {  4413,  17,  16,  18,    1,  -15, 1 },  // 0xBA
+  {  4445,  18,  16,  19,    0,  -15, 2 },  // 0xBB
+  {  4463,  21,  16,  23,    1,  -15, 2 },  // 0xBC
+  {  4494,  18,  16,  20,    1,  -15, 2 },  // 0xBD
+  {  2394,  15,  17,  19,    2,  -16, 1 },  // 0xBE
+  {  4515,  18,  16,  20,    1,  -15, 2 },  // 0xBF
+  {  4533,  22,  30,  23,    1,  -29, 2 },  // 0xC0
+  {  4574,  13,  24,  15,    1,  -23, 1 }   // 0xC1
+};
+
+const RleFont TimesNRCyr18pt8bRle PROGMEM = {
+  TimesNRCyr18pt8bRleData,
+  TimesNRCyr18pt8bRleGlyphs,
+  0x20, 0xC1, 39 };
+
+#endif // TIMESNRCYR18PT8BRLE_H_
@@ -0,0 +1,277 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr7.h, do not edit.
+// 162 glyphs (18 sharing another's bitmap), 1185 bytes of bitmap data (GFXfont: 1429)
+#ifndef TIMESNRCYR7PT8BRLE_H_
+#define TIMESNRCYR7PT8BRLE_H_
+
+const uint8_t TimesNRCyr7pt8bRleData[] PROGMEM = {
+  0xFE, 0xC0, 0xB6, 0xD0, 0x11, 0x08, 0x88, 0x9F, 0xF2, 0x21, 0x13, 0xFE,
+  0x44, 0x44, 0x22, 0x00, 0x23, 0xEB, 0x5A, 0x30, 0xC5, 0xAD, 0x7C, 0x40,
+  0x60, 0x49, 0x08, 0x90, 0x89, 0x10, 0x62, 0x00, 0x46, 0x04, 0x90, 0x89,
+  0x10, 0x92, 0x06, 0x1C, 0x04, 0x40, 0x88, 0x1A, 0x01, 0x9E, 0xD1, 0x21,
+  0x44, 0x30, 0xC7, 0x2F, 0x38, 0xF0, 0x29, 0x49, 0x24, 0x91, 0x22, 0x89,
+  0x12, 0x49, 0x25, 0x28, 0x25, 0x5C, 0xEA, 0x90, 0x31, 0xF2, 0x31, 0x61,
+  0x3E, 0xF6, 0xE0, 0xF0, 0x31, 0xD2, 0xC2, 0xC2, 0x30, 0x31, 0x28, 0x61,
+  0x86, 0x18, 0x61, 0x48, 0xC0, 0x59, 0x24, 0x92, 0x5C, 0x64, 0xA4, 0x21,
+  0x10, 0x88, 0x8F, 0xC0, 0x64, 0x84, 0x47, 0x04, 0x21, 0x93, 0x00, 0x08,
+  0x61, 0x8A, 0x49, 0x28, 0xBF, 0x08, 0x20, 0x7A, 0x21, 0xC1, 0x04, 0x21,
+  0x97, 0x00, 0x1C, 0x84, 0x10, 0xBB, 0x18, 0x61, 0x44, 0xE0, 0x18, 0x11,
+  0x22, 0xF2, 0x2C, 0x22, 0x74, 0x63, 0x15, 0x3A, 0x31, 0x8B, 0x80, 0x72,
+  0x28, 0x61, 0x85, 0xF0, 0x42, 0x33, 0x80, 0xF0, 0x3C, 0xF0, 0x3D, 0x80,
+  0x02, 0x39, 0x84, 0x06, 0x03, 0x80, 0x80, 0x07, 0xE7, 0x80, 0xE0, 0x30,
+  0x10, 0xCE, 0x20, 0x00, 0x74, 0x62, 0x11, 0x10, 0x80, 0x21, 0x00, 0x0F,
+  0x83, 0x04, 0x40, 0x24, 0x72, 0x89, 0x29, 0xA2, 0x92, 0x29, 0x64, 0x9B,
+  0x94, 0x01, 0x40, 0x23, 0x0C, 0x0F, 0x00, 0x41, 0xF3, 0x3F, 0x12, 0x12,
+  0xF1, 0x35, 0x7C, 0x11, 0x13, 0x11, 0x20, 0xFC, 0x85, 0x0A, 0x27, 0x88,
+  0x90, 0xA1, 0x43, 0xF8, 0x1E, 0xB0, 0xD0, 0x30, 0x08, 0x04, 0x02, 0x00,
+  0x81, 0x61, 0x0F, 0x00, 0x07, 0x31, 0x17, 0x81, 0xA2, 0xFF, 0x82, 0x71,
+  0x21, 0x17, 0x10, 0xFE, 0x42, 0x40, 0x44, 0x7C, 0x44, 0x40, 0x40, 0x43,
+  0xFE, 0xFE, 0x85, 0x02, 0x47, 0x89, 0x10, 0x20, 0x41, 0xC0, 0x1E, 0x98,
+  0x64, 0x0A, 0x00, 0x80, 0x20, 0x78, 0x09, 0x02, 0x60, 0x87, 0xC0, 0xE3,
+  0xA0, 0x90, 0x48, 0x27, 0xF2, 0x09, 0x04, 0x82, 0x41, 0x71, 0xC0, 0xE9,
+  0x24, 0x92, 0x5C, 0x14, 0x12, 0x11, 0xFF, 0x54, 0x10, 0xF7, 0x84, 0x40,
+  0x90, 0x14, 0x03, 0x00, 0x50, 0x09, 0x01, 0x10, 0x21, 0x1F, 0x7C, 0x04,
+  0x52, 0x11, 0xFF, 0xFD, 0x19, 0x21, 0x60, 0x03, 0x54, 0x91, 0xD2, 0x32,
+  0xFC, 0x21, 0x2F, 0x33, 0x41, 0x11, 0x51, 0x11, 0x03, 0x46, 0x11, 0x31,
+  0x12, 0xE2, 0xA2, 0xF6, 0x2A, 0x2A, 0x13, 0x21, 0x17, 0x1E, 0x18, 0x64,
+  0x0A, 0x01, 0x80, 0x60, 0x18, 0x05, 0x02, 0x61, 0x87, 0x80, 0xF1, 0x24,
+  0x51, 0x49, 0xC4, 0x10, 0x43, 0xC0, 0x1E, 0x18, 0x64, 0x0A, 0x01, 0x80,
+  0x60, 0x18, 0x05, 0x02, 0x61, 0x0F, 0x80, 0xC0, 0x1C, 0x01, 0xC0, 0xFC,
+  0x10, 0x84, 0x11, 0x04, 0x42, 0x1F, 0x04, 0x81, 0x10, 0x42, 0x38, 0x70,
+  0x76, 0x38, 0x50, 0x30, 0x20, 0x61, 0xC6, 0xE0, 0xFF, 0x24, 0x40, 0x81,
+  0x02, 0x04, 0x08, 0x10, 0x70, 0x04, 0x27, 0x11, 0x22, 0x12, 0xFF, 0xFF,
+  0x82, 0x32, 0x55, 0x30, 0x04, 0x36, 0x11, 0x31, 0x12, 0xF3, 0x24, 0x2F,
+  0x62, 0x12, 0xFE, 0x34, 0xF7, 0x79, 0x11, 0x88, 0x88, 0x44, 0x41, 0x54,
+  0x0A, 0xA0, 0x55, 0x02, 0xA8, 0x08, 0x80, 0x44, 0x00, 0xF9, 0xC4, 0x10,
+  0x44, 0x09, 0x00, 0xC0, 0x08, 0x02, 0x80, 0x88, 0x20, 0x9C, 0x7C, 0xF3,
+  0x90, 0x84, 0x42, 0x41, 0x40, 0x40, 0x20, 0x10, 0x08, 0x1F, 0x00, 0x7F,
+  0x21, 0x11, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0xFF, 0xC0, 0x03,
+  0x12, 0xFF, 0x12, 0x01, 0xB2, 0xB2, 0xB2, 0x05, 0xFF, 0x12, 0x10, 0x21,
+  0x45, 0x22, 0x88, 0xFE, 0xD0, 0x71, 0x10, 0x63, 0x48, 0x91, 0x1F, 0x00,
+  0x41, 0x81, 0x02, 0xC6, 0x48, 0x50, 0xA1, 0x44, 0x70, 0x32, 0x61, 0x08,
+  0x25, 0xC0, 0x0C, 0x08, 0x11, 0xE4, 0x50, 0xA1, 0x42, 0x4E, 0x68, 0x74,
+  0x7F, 0x08, 0x45, 0xC0, 0x3A, 0x51, 0xC4, 0x21, 0x08, 0x47, 0x00, 0x13,
+  0x26, 0x51, 0x65, 0x14, 0x2B, 0x76, 0x41, 0x81, 0x02, 0xC6, 0x48, 0x91,
+  0x22, 0x45, 0xDC, 0x40, 0x2C, 0x92, 0x5C, 0x10, 0x01, 0x31, 0x11, 0x11,
+  0x11, 0xE0, 0x40, 0xC0, 0x40, 0x4F, 0x58, 0x60, 0x50, 0x48, 0x44, 0xEF,
+  0x59, 0x9C, 0xC9, 0x11, 0x22, 0x24, 0x44, 0x88, 0xBB, 0xB8, 0x59, 0xC9,
+  0x12, 0x24, 0x48, 0xBB, 0x80, 0x38, 0x8A, 0x0C, 0x18, 0x28, 0x8E, 0x00,
+  0x5D, 0xCD, 0x0A, 0x14, 0x28, 0x9E, 0x20, 0x41, 0xC0, 0x34, 0x9A, 0x14,
+  0x28, 0x48, 0x8F, 0x02, 0x04, 0x1C, 0x5F, 0x10, 0x84, 0x23, 0x80, 0x79,
+  0x86, 0x19, 0xE0, 0x5D, 0x24, 0x93, 0xCC, 0x89, 0x12, 0x24, 0x48, 0xDF,
+  0x00, 0xCF, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0xDD, 0xD2, 0x24, 0x91,
+  0x54, 0x55, 0x08, 0x82, 0x20, 0xEE, 0x50, 0xA0, 0x82, 0x85, 0x33, 0x80,
+  0xE6, 0x88, 0x91, 0x41, 0x82, 0x04, 0x08, 0x21, 0x80, 0xFE, 0x21, 0x08,
+  0x25, 0x1F, 0xC0, 0x29, 0x24, 0xA2, 0x49, 0x22, 0x0D, 0x89, 0x24, 0x8A,
+  0x49, 0x28, 0xE3, 0x3C, 0x08, 0x16, 0xFF, 0xF5, 0x61, 0x06, 0x12, 0x13,
+  0xFE, 0x10, 0x10, 0x10, 0x54, 0xBA, 0x91, 0x91, 0x91, 0x93, 0x9A, 0x74,
+  0x10, 0x18, 0x03, 0x15, 0x31, 0x21, 0xFF, 0xB7, 0x32, 0x30, 0xEE, 0x89,
+  0x12, 0x23, 0xC0, 0x81, 0x00, 0xEE, 0xE8, 0x89, 0x11, 0x22, 0x24, 0x44,
+  0x88, 0x9F, 0xF0, 0xEE, 0xE8, 0x89, 0x11, 0x22, 0x24, 0x44, 0x88, 0x99,
+  0x90, 0xCD, 0x00, 0x00, 0x79, 0x60, 0xC1, 0xE3, 0x26, 0x4F, 0x80, 0xF3,
+  0xD8, 0x66, 0x09, 0xE2, 0x64, 0x99, 0x27, 0xD8, 0xF1, 0x86, 0x1E, 0x65,
+  0x97, 0xC0, 0x74, 0x5E, 0x10, 0xC5, 0xC0, 0xF3, 0x0C, 0x99, 0xA1, 0x3C,
+  0x36, 0x84, 0xC8, 0x99, 0xE0, 0x1D, 0xB4, 0xCB, 0x3C, 0xB4, 0xC0, 0xFE,
+  0x42, 0x40, 0x40, 0x40, 0x7E, 0x42, 0x43, 0x46, 0x7C, 0x07, 0x11, 0x14,
+  0x81, 0xFF, 0xF6, 0x15, 0x28, 0x21, 0x13, 0x21, 0xFF, 0xC2, 0xFC, 0x11,
+  0x43, 0x11, 0x81, 0x18, 0x18, 0x10, 0x67, 0x99, 0x4C, 0xA1, 0x32, 0x04,
+  0xD0, 0x0B, 0x40, 0x3F, 0x01, 0xB6, 0x04, 0xC8, 0x33, 0x31, 0x8C, 0x60,
+  0x38, 0x88, 0x18, 0x20, 0xC3, 0x81, 0x83, 0x06, 0xF8, 0xF9, 0xE4, 0x18,
+  0x83, 0x11, 0xE2, 0x2C, 0x49, 0x8A, 0x31, 0x86, 0x20, 0xCE, 0x18, 0x32,
+  0x21, 0x65, 0x3D, 0x12, 0x21, 0x21, 0xF2, 0x2A, 0x18, 0x28, 0x28, 0x29,
+  0x18, 0x11, 0x17, 0xF8, 0xC8, 0xF2, 0x20, 0x90, 0x24, 0x0F, 0x02, 0x60,
+  0x8C, 0x21, 0x1C, 0x20, 0x28, 0x21, 0x13, 0x21, 0xFF, 0xFF, 0x22, 0x62,
+  0x80, 0x0B, 0x15, 0x21, 0xFF, 0xFF, 0xC1, 0x70, 0xF1, 0xD8, 0x23, 0x10,
+  0x44, 0x19, 0x02, 0x80, 0xE0, 0x10, 0x04, 0x0E, 0x00, 0x1E, 0x01, 0x81,
+  0xFE, 0x46, 0x28, 0xC7, 0x18, 0xE3, 0x12, 0x66, 0x3F, 0x01, 0x80, 0x04,
+  0x25, 0x12, 0x21, 0x21, 0xFF, 0xFF, 0xC5, 0x47, 0x11, 0x81, 0xA1, 0x05,
+  0x16, 0x12, 0x11, 0x21, 0xFF, 0x31, 0x21, 0x55, 0x72, 0xF9, 0x03, 0x24,
+  0x15, 0x11, 0x21, 0x21, 0x11, 0x21, 0xFF, 0xFF, 0xFF, 0x81, 0x14, 0x23,
+  0x30, 0x03, 0x24, 0x15, 0x11, 0x21, 0x21, 0x11, 0x21, 0xFF, 0xFF, 0xFF,
+  0x81, 0x14, 0x23, 0x3E, 0xFC, 0x10, 0x06, 0x52, 0x21, 0xE1, 0xF9, 0x46,
+  0x31, 0x1F, 0xA3, 0x11, 0x04, 0x45, 0x12, 0x41, 0x21, 0xFF, 0x85, 0x74,
+  0xF8, 0x18, 0x31, 0x15, 0xF0, 0x81, 0x02, 0x04, 0x0F, 0xD0, 0xA1, 0x46,
+  0xF8, 0xB8, 0xC6, 0x82, 0x01, 0x3F, 0x01, 0x01, 0x02, 0x86, 0x78, 0xF1,
+  0xE1, 0x08, 0x44, 0x60, 0x91, 0x03, 0x4C, 0x0D, 0xF0, 0x34, 0x40, 0xD1,
+  0x82, 0x42, 0x19, 0x87, 0xC0, 0x0F, 0xC6, 0x31, 0x08, 0x42, 0x18, 0x81,
+  0xE0, 0x28, 0x32, 0x10, 0xF8, 0x70, 0x3D, 0x88, 0x2C, 0xCA, 0x18, 0x61,
+  0x85, 0xE0, 0xE1, 0xF6, 0x5E, 0x65, 0x97, 0xC0, 0x07, 0x22, 0x61, 0xF9,
+  0x7E, 0x48, 0x91, 0x24, 0x48, 0x91, 0x5D, 0x00, 0x5E, 0x9B, 0x62, 0xE0,
+  0x78, 0x2D, 0x0B, 0x44, 0xC8, 0x36, 0x42, 0x61, 0x85, 0xE0, 0xEF, 0x66,
+  0x66, 0x7E, 0x76, 0x66, 0x66, 0x00, 0x24, 0x18, 0xEF, 0x66, 0x66, 0x7E,
+  0x76, 0x66, 0x66, 0xF4, 0xCD, 0xA3, 0x86, 0x8D, 0x99, 0x00, 0x7E, 0x48,
+  0x91, 0x22, 0x48, 0xB1, 0x00, 0xE1, 0xB1, 0x99, 0x4A, 0xA5, 0x52, 0x49,
+  0x24, 0xEF, 0x66, 0x66, 0x7E, 0x66, 0x66, 0x66, 0x09, 0x22, 0x21, 0xFF,
+  0xA0, 0x64, 0x44, 0xFE, 0x42, 0x40, 0x40, 0x44, 0x7C, 0x40, 0x40, 0x41,
+  0x7E, 0x29, 0xA0, 0x0C, 0x4A, 0x3F, 0x30, 0x45, 0xE0 };
+
+const RleGlyph TimesNRCyr7pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   4,    0,    1, 0 },  // 0x20 ' '
+  {     0,   1,  10,   4,    1,   -9, 0 },  // 0x21 '!'
+  {     2,   3,   4,   6,    1,   -9, 0 },  // 0x22 '"'
+  {     4,   9,  10,   9,    0,   -9, 0 },  // 0x23 '#'
+  {    16,   5,  12,   7,    1,  -10, 0 },  // 0x24 '$'
+  {    24,  12,  10,  12,    0,   -9, 0 },  // 0x25 '%'
+  {    39,  11,  10,  11,    0,   -9, 0 },  // 0x26 '&'
+  {    53,   1,   4,   2,    0,   -9, 0 },  // 0x27 '''
+  {    54,   3,  13,   5,    1,   -9, 0 },  // 0x28 '('
+  {    59,   3,  13,   5,    1,   -9, 0 },  // 0x29 ')'
+  {    64,   5,   6,   7,    1,   -9, 0 },  // 0x2A '*'
+  {    68,   7,   7,   9,    1,   -8, 2 },  // 0x2B '+'
+  {    73,   2,   4,   4,    1,   -1, 0 },  // 0x2C ','
+  {    74,   3,   1,   5,    1,   -3, 0 },  // 0x2D '-'
+  {    75,   2,   2,   4,    1,   -1, 0 },  // 0x2E '.'
+  {    76,   5,  10,   4,    0,   -9, 2 },  // 0x2F '/'
+  {    81,   6,  10,   7,    0,   -9, 0 },  // 0x30 '0'
+  {    89,   3,  10,   6,    1,   -9, 0 },  // 0x31 '1'
+  {    93,   5,  10,   7,    1,   -9, 0 },  // 0x32 '2'
+  {   100,   5,  10,   7,    1,   -9, 0 },  // 0x33 '3'
+  {   107,   6,  10,   7,    0,   -9, 0 },  // 0x34 '4'
+  {   115,   5,  10,   7,    1,   -9, 0 },  // 0x35 '5'
+  {   122,   6,  10,   7,    0,   -9, 0 },  // 0x36 '6'
+  {   130,   5,  10,   7,    1,   -9, 2 },  // 0x37 '7'
+  {   136,   5,  10,   7,    1,   -9, 0 },  // 0x38 '8'
+  {   143,   6,  10,   7,    0,   -9, 0 },  // 0x39 '9'
+  {   151,   2,   7,   4,    1,   -6, 0 },  // 0x3A ':'
+  {   153,   2,   9,   4,    1,   -6, 0 },  // 0x3B ';'
+  {   156,   7,   7,   9,    1,   -7, 0 },  // 0x3C '<'
+  {   163,   7,   4,   9,    1,   -6, 1 },  // 0x3D '='
+  {   165,   7,   7,   9,    1,   -7, 0 },  // 0x3E '>'
+  {   172,   5,  10,   5,    0,   -9, 0 },  // 0x3F '?'
+  {   179,  12,  13,  13,    1,   -9, 0 },  // 0x40 '@'
+  {   199,  10,  10,  11,    0,   -9, 2 },  // 0x41 'A'
+  {   211,   7,  10,  10,    1,   -9, 0 },  // 0x42 'B'
+  {   220,   9,  10,  10,    0,   -9, 0 },  // 0x43 'C'
+  {   232,  10,  10,  12,    1,   -9, 2 },  // 0x44 'D'
+  {   243,   8,  10,   9,    1,   -9, 0 },  // 0x45 'E'
+  {   253,   7,  10,   9,    1,   -9, 0 },  // 0x46 'F'
+  {   262,  10,  10,  11,    0,   -9, 0 },  // 0x47 'G'
+  {   275,   9,  10,  12,    1,   -9, 0 },  // 0x48 'H'
+  {   287,   3,  10,   6,    1,   -9, 0 },  // 0x49 'I'
+  {   291,   5,  10,   6,    0,   -9, 2 },  // 0x4A 'J'
+  {   297,  11,  10,  12,    0,   -9, 0 },  // 0x4B 'K'
+  {   311,   9,  10,   9,    0,   -9, 2 },  // 0x4C 'L'
+  {   319,  11,  10,  14,    1,   -9, 2 },  // 0x4D 'M'
+  {   332,  11,  10,  12,    0,   -9, 2 },  // 0x4E 'N'
+  {   345,  10,  10,  11,    0,   -9, 0 },  // 0x4F 'O'
+  {   358,   6,  10,   8,    1,   -9, 0 },  // 0x50 'P'
+  {   366,  10,  13,  11,    0,   -9, 0 },  // 0x51 'Q'
+  {   383,  10,  10,  11,    1,   -9, 0 },  // 0x52 'R'
+  {   396,   6,  10,   8,    1,   -9, 0 },  // 0x53 'S'
+  {   404,   7,  10,   8,    0,   -9, 0 },  // 0x54 'T'
+  {   413,  11,  10,  12,    0,   -9, 2 },  // 0x55 'U'
+  {   424,  11,  10,  10,   -1,   -9, 2 },  // 0x56 'V'
+  {   436,  13,  10,  14,    0,   -9, 0 },  // 0x57 'W'
+  {   453,  11,  10,  11,    0,   -9, 0 },  // 0x58 'X'
+  {   467,   9,  10,  11,    0,   -9, 0 },  // 0x59 'Y'
+  {   479,   9,  10,   9,    0,   -9, 0 },  // 0x5A 'Z'
+  {   491,   3,  13,   4,    1,   -9, 2 },  // 0x5B '['
+  {   495,   4,  10,   4,    0,   -9, 2 },  // 0x5C
+  {   499,   3,  13,   4,    0,   -9, 2 },  // 0x5D ']'
+  {   503,   6,   5,   8,    1,   -9, 0 },  // 0x5E '^'
+  {   507,   7,   1,   7,    0,    2, 0 },  // 0x5F '_'
+  {   508,   2,   2,   5,    1,   -9, 0 },  // 0x60 '`'
+  {   509,   7,   7,   7,    0,   -6, 0 },  // 0x61 'a'
+  {   516,   7,  10,   8,    0,   -9, 0 },  // 0x62 'b'
+  {   525,   5,   7,   6,    0,   -6, 0 },  // 0x63 'c'
+  {   530,   7,  10,   8,    0,   -9, 0 },  // 0x64 'd'
+  {   539,   5,   7,   6,    0,   -6, 0 },  // 0x65 'e'
+  {   544,   5,  10,   4,    0,   -9, 0 },  // 0x66 'f'
+  {   551,   6,  10,   7,    0,   -6, 2 },  // 0x67 'g'
+  {   558,   7,  10,   8,    0,   -9, 0 },  // 0x68 'h'
+  {   567,   3,  10,   4,    0,   -9, 0 },  // 0x69 'i'
+  {   571,   4,  13,   4,   -2,   -9, 0 },  // 0x6A 'j'
+  {   578,   8,  10,   8,    0,   -9, 0 },  // 0x6B 'k'
+  {    89,   3,  10,   4,    0,   -9, 0 },  // 0x6C 'l'
+  {   588,  11,   7,  12,    0,   -6, 0 },  // 0x6D 'm'
+  {   598,   7,   7,   8,    0,   -6, 0 },  // 0x6E 'n'
+  {   605,   7,   7,   8,    0,   -6, 0 },  // 0x6F 'o'
+  {   612,   7,  10,   8,    0,   -6, 0 },  // 0x70 'p'
+  {   621,   7,  10,   8,    0,   -6, 0 },  // 0x71 'q'
+  {   630,   5,   7,   5,    0,   -6, 0 },  // 0x72 'r'
+  {   635,   4,   7,   5,    0,   -6, 0 },  // 0x73 's'
+  {   639,   3,   8,   5,    0,   -7, 0 },  // 0x74 't'
+  {   642,   7,   7,   8,    0,   -6, 0 },  // 0x75 'u'
+  {   649,   8,   7,   6,   -1,   -6, 0 },  // 0x76 'v'
+  {   656,  10,   7,  10,    0,   -6, 0 },  // 0x77 'w'
+  {   665,   7,   7,   8,    0,   -6, 0 },  // 0x78 'x'
+  {   672,   7,  10,   8,    0,   -6, 0 },  // 0x79 'y'
+  {   681,   6,   7,   7,    0,   -6, 0 },  // 0x7A 'z'
+  {   687,   3,  13,   7,    2,   -9, 0 },  // 0x7B '{'
+  {   692,   1,  13,   3,    1,   -9, 1 },  // 0x7C '|'
+  {   693,   3,  13,   7,    1,   -9, 0 },  // 0x7D '}'
+  {   698,   7,   2,   9,    1,   -5, 0 },  // 0x7E '~'
+  {   700,   8,   9,  11,    1,   -8, 2 },  // 0x7F
+  {   612,   7,  10,   8,    0,   -6, 0 },  // 0x80
+  {   525,   5,   7,   6,    0,   -6, 0 },  // 0x81
+  {   705,   6,   7,   7,    0,   -6, 2 },  // 0x82
+  {   672,   7,  10,   8,    0,   -6, 0 },  // 0x83
+  {   709,   8,  13,   9,    1,   -9, 0 },  // 0x84
+  {   665,   7,   7,   8,    0,   -6, 0 },  // 0x85
+  {   722,   8,   9,   8,    0,   -6, 2 },  // 0x86
+  {   730,   7,   7,   7,    0,   -6, 0 },  // 0x87
+  {   737,  11,   7,  11,    0,   -6, 0 },  // 0x88
+  {   747,  11,   9,  11,    0,   -6, 0 },  // 0x89
+  {   760,   7,   7,   8,    0,   -6, 0 },  // 0x8A
+  {   767,  10,   7,  10,    0,   -6, 0 },  // 0x8B
+  {   776,   6,   7,   7,    0,   -6, 0 },  // 0x8C
+  {   782,   5,   7,   6,    1,   -6, 0 },  // 0x8D
+  {   787,  11,   7,  11,    0,   -6, 0 },  // 0x8E
+  {   797,   6,   7,   7,    0,   -6, 0 },  // 0x8F
+  {   199,  10,  10,  11,    0,   -9, 2 },  // 0x90
+  {   803,   8,  10,   9,    1,   -9, 0 },  // 0x91
+  {   211,   7,  10,  10,    1,   -9, 0 },  // 0x92
+  {   813,   8,  10,   9,    1,   -9, 2 },  // 0x93
+  {   820,  10,  13,  10,    0,   -9, 2 },  // 0x94
+  {   243,   8,  10,   9,    1,   -9, 0 },  // 0x95
+  {   834,  14,  10,  14,    0,   -9, 0 },  // 0x96
+  {   852,   7,  10,   7,    0,   -9, 0 },  // 0x97
+  {   861,  11,  10,  12,    0,   -9, 0 },  // 0x98
+  {   875,  11,  12,  12,    0,  -11, 2 },  // 0x99
+  {   891,  10,  10,  11,    0,   -9, 0 },  // 0x9A
+  {   904,  10,  10,  11,    0,   -9, 2 },  // 0x9B
+  {   319,  11,  10,  14,    1,   -9, 2 },  // 0x9C
+  {   275,   9,  10,  12,    1,   -9, 0 },  // 0x9D
+  {   345,  10,  10,  11,    0,   -9, 0 },  // 0x9E
+  {   913,  10,  10,  11,    1,   -9, 2 },  // 0x9F
+  {   358,   6,  10,   8,    1,   -9, 0 },  // 0xA0
+  {   220,   9,  10,  10,    0,   -9, 0 },  // 0xA1
+  {   404,   7,  10,   8,    0,   -9, 0 },  // 0xA2
+  {   920,  10,  10,  10,    0,   -9, 0 },  // 0xA3
+  {   933,  11,  10,  12,    1,   -9, 0 },  // 0xA4
+  {   453,  11,  10,  11,    0,   -9, 0 },  // 0xA5
+  {   947,  10,  13,  12,    1,   -9, 2 },  // 0xA6
+  {   959,  10,  10,  10,    0,   -9, 2 },  // 0xA7
+  {   970,  14,  10,  16,    1,   -9, 2 },  // 0xA8
+  {   985,  14,  13,  16,    1,   -9, 2 },  // 0xA9
+  {  1002,  10,  10,  11,    0,   -9, 2 },  // 0xAA
+  {  1012,  12,  10,  14,    1,   -9, 2 },  // 0xAB
+  {  1024,   7,  10,   9,    1,   -9, 0 },  // 0xAC
+  {  1033,   8,  10,  10,    1,   -9, 0 },  // 0xAD
+  {  1043,  14,  10,  15,    1,   -9, 0 },  // 0xAE
+  {  1061,  10,  10,  10,   -1,   -9, 0 },  // 0xAF
+  {   509,   7,   7,   7,    0,   -6, 0 },  // 0xB0
+  {  1074,   6,  10,   8,    1,   -9, 0 },  // 0xB1
+  {  1082,   6,   7,   7,    0,   -6, 0 },  // 0xB2
+  {  1088,   6,   7,   6,    0,   -6, 2 },  // 0xB3
+  {  1092,   7,   9,   7,    0,   -6, 0 },  // 0xB4
+  {   539,   5,   7,   6,    0,   -6, 0 },  // 0xB5
+  {  1100,  10,   7,  10,    0,   -6, 0 },  // 0xB6
+  {  1109,   5,   7,   6,    0,   -6, 0 },  // 0xB7
+  {  1114,   8,   7,   8,    0,   -6, 0 },  // 0xB8
+  {  1121,   8,  10,   8,    0,   -9, 0 },  // 0xB9
+  {  1131,   7,   7,   7,    0,   -6, 0 },  // 0xBA
+  {  1138,   7,   7,   7,    0,   -6, 0 },  // 0xBB
+  {  1145,   9,   7,   9,    0,   -6, 0 },  // 0xBC
+  {  1153,   8,   7,   8,    0,   -6, 0 },  // 0xBD
+  {   605,   7,   7,   8,    0,   -6, 0 },  // 0xBE
+  {  1160,   8,   7,   8,    0,   -6, 2 },  // 0xBF
+  {  1165,   8,  12,   9,    1,  -11, 0 },  // 0xC0
+  {  1177,   6,  10,   6,    0,   -9, 0 }   // 0xC1
+};
+
+const RleFont TimesNRCyr7pt8bRle PROGMEM = {
+  TimesNRCyr7pt8bRleData,
+  TimesNRCyr7pt8bRleGlyphs,
+  0x20, 0xC1, 16 };
+
+#endif // TIMESNRCYR7PT8BRLE_H_
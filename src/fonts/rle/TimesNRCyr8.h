@@ -0,0 +1,295 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr8.h, do not edit.
+// 162 glyphs (18 sharing another's bitmap), 1396 bytes of bitmap data (GFXfont: 1830)
+#ifndef TIMESNRCYR8PT8BRLE_H_
+#define TIMESNRCYR8PT8BRLE_H_
+
+const uint8_t TimesNRCyr8pt8bRleData[] PROGMEM = {
+  0xFF, 0xB0, 0xB6, 0xDA, 0x08, 0x82, 0x21, 0x11, 0xFF, 0x11, 0x04, 0x42,
+  0x20, 0x88, 0xFF, 0xC8, 0x84, 0x41, 0x10, 0x11, 0xF9, 0x65, 0x91, 0x43,
+  0x06, 0x14, 0x59, 0x65, 0xF8, 0x40, 0x12, 0x71, 0x24, 0x52, 0xF8, 0x2A,
+  0x24, 0x4A, 0x23, 0x22, 0x26, 0x22, 0x44, 0x2F, 0x82, 0xA2, 0x54, 0x0C,
+  0x02, 0x40, 0x48, 0x09, 0x01, 0x5C, 0x31, 0x1B, 0x24, 0x68, 0x87, 0x10,
+  0xC3, 0x1C, 0x3C, 0xF0, 0xF8, 0x12, 0x44, 0x88, 0x88, 0x88, 0x84, 0x42,
+  0x10, 0x84, 0x22, 0x11, 0x11, 0x11, 0x12, 0x24, 0x80, 0x11, 0xAF, 0x59,
+  0xCF, 0xFA, 0xC4, 0x00, 0x41, 0xFF, 0x14, 0x18, 0x14, 0xFC, 0xF6, 0xE0,
+  0xF0, 0x41, 0xF1, 0x29, 0x2F, 0x02, 0xF0, 0x24, 0x31, 0x28, 0x61, 0x86,
+  0x18, 0x61, 0x86, 0x14, 0x8C, 0x59, 0x24, 0x92, 0x49, 0x70, 0x38, 0x9A,
+  0x10, 0x20, 0x41, 0x02, 0x08, 0x10, 0x41, 0x0F, 0xE0, 0x64, 0x84, 0x22,
+  0x38, 0x21, 0x08, 0x64, 0xC0, 0x08, 0x61, 0x8A, 0x29, 0x24, 0xA2, 0xFC,
+  0x20, 0x82, 0x3D, 0x04, 0x30, 0x30, 0x20, 0x41, 0x04, 0x18, 0xBC, 0x0C,
+  0xC4, 0x10, 0x82, 0xEC, 0x61, 0x86, 0x14, 0x4E, 0x1A, 0x11, 0x32, 0xF6,
+  0x2F, 0x62, 0x80, 0x7A, 0x18, 0x61, 0x48, 0xC5, 0x12, 0x86, 0x18, 0x5E,
+  0x31, 0x28, 0x61, 0x86, 0x14, 0x4F, 0x08, 0x21, 0x38, 0xF0, 0x0F, 0xF0,
+  0x0F, 0x60, 0x01, 0x06, 0x18, 0x60, 0x80, 0x60, 0x18, 0x06, 0x01, 0x09,
+  0xFC, 0x90, 0x80, 0x60, 0x18, 0x06, 0x01, 0x06, 0x18, 0x60, 0x80, 0x7A,
+  0x38, 0x61, 0x08, 0x21, 0x08, 0x20, 0x02, 0x08, 0x07, 0xC0, 0x60, 0x82,
+  0x01, 0x10, 0x02, 0x43, 0x4A, 0x12, 0x28, 0x88, 0xA6, 0x22, 0x91, 0x92,
+  0x4C, 0xC9, 0xDC, 0x50, 0x02, 0x20, 0x08, 0x40, 0xC0, 0xFC, 0x00, 0x51,
+  0xF5, 0x3F, 0x32, 0xC2, 0xF1, 0x23, 0x25, 0x56, 0x54, 0x25, 0x21, 0x11,
+  0x14, 0x21, 0x10, 0x07, 0x22, 0x15, 0x82, 0xF1, 0x23, 0x54, 0x67, 0x1F,
+  0xB4, 0x15, 0x10, 0x44, 0x21, 0x28, 0x23, 0x41, 0x22, 0x71, 0xB1, 0xFF,
+  0x32, 0xF4, 0x11, 0x35, 0x22, 0x81, 0x08, 0x42, 0x17, 0xA3, 0xB2, 0xFF,
+  0xFD, 0x2F, 0x53, 0x12, 0x17, 0x20, 0xFF, 0x20, 0x90, 0x08, 0x04, 0x23,
+  0xF1, 0x08, 0x80, 0x40, 0x20, 0x50, 0x7F, 0xE0, 0x0A, 0x16, 0x91, 0xF0,
+  0x14, 0x45, 0x49, 0x1F, 0xE1, 0x11, 0x60, 0x44, 0x21, 0x48, 0x43, 0x41,
+  0xD1, 0x32, 0x81, 0xF8, 0x58, 0x21, 0x21, 0x1B, 0x1D, 0x3B, 0x92, 0x05,
+  0x27, 0x12, 0x22, 0x12, 0xFF, 0x96, 0x66, 0xFF, 0xF6, 0x21, 0x22, 0x21,
+  0x20, 0xE9, 0x24, 0x92, 0x49, 0x70, 0x25, 0x22, 0x12, 0xFF, 0xFF, 0x35,
+  0x20, 0x05, 0x24, 0x22, 0x12, 0x21, 0x12, 0x92, 0xA2, 0xA2, 0x93, 0xA1,
+  0xD2, 0xC3, 0xB3, 0xC3, 0x22, 0x12, 0x22, 0x22, 0x05, 0x62, 0x12, 0xFF,
+  0xFF, 0xFF, 0x31, 0x94, 0x16, 0x20, 0x04, 0x76, 0xB2, 0xF3, 0x25, 0x2F,
+  0x81, 0xD1, 0x42, 0xF9, 0x21, 0x2F, 0xC2, 0x62, 0x12, 0x11, 0x32, 0x12,
+  0x03, 0x46, 0x62, 0x12, 0x11, 0x11, 0xB2, 0xF8, 0x2B, 0x2F, 0x82, 0xB2,
+  0xB1, 0x32, 0x12, 0x70, 0x35, 0x57, 0x32, 0x52, 0x12, 0x72, 0xFF, 0xFA,
+  0x27, 0x21, 0x25, 0x23, 0x72, 0x07, 0x22, 0x15, 0x82, 0xFA, 0x23, 0x54,
+  0x4F, 0xE2, 0x12, 0x40, 0x35, 0x57, 0x32, 0x52, 0x12, 0x72, 0xFF, 0xF8,
+  0x4A, 0x25, 0x23, 0x75, 0x12, 0x27, 0x49, 0x50, 0x07, 0x42, 0x15, 0xA2,
+  0xFF, 0x03, 0x53, 0x11, 0x62, 0x11, 0x92, 0xA2, 0xA2, 0x22, 0x12, 0x42,
+  0x7B, 0x0E, 0x0C, 0x14, 0x06, 0x02, 0x02, 0x83, 0x07, 0x0D, 0xE0, 0x09,
+  0x13, 0x13, 0x11, 0x71, 0xFF, 0xFF, 0xE2, 0x12, 0x20, 0x05, 0x37, 0x12,
+  0x32, 0x12, 0xFF, 0xFF, 0xFF, 0xF1, 0x25, 0x25, 0x73, 0x04, 0x36, 0x11,
+  0x31, 0x12, 0xFE, 0x24, 0x2F, 0x92, 0x62, 0xF7, 0x28, 0x16, 0x04, 0x24,
+  0x36, 0x11, 0x22, 0x11, 0x31, 0x12, 0xFF, 0xF8, 0x23, 0x33, 0x2F, 0xF9,
+  0x21, 0x21, 0x21, 0x2F, 0xFB, 0x33, 0x34, 0xF8, 0xF6, 0x06, 0x20, 0x41,
+  0x08, 0x09, 0x00, 0x60, 0x06, 0x00, 0x60, 0x09, 0x01, 0x08, 0x20, 0x4F,
+  0x1F, 0x05, 0x35, 0x21, 0x31, 0x11, 0x21, 0x52, 0x42, 0x22, 0xF4, 0x27,
+  0x3F, 0xFF, 0x62, 0x12, 0x30, 0x18, 0x31, 0x61, 0x31, 0x51, 0x91, 0x91,
+  0xA1, 0x91, 0x91, 0x91, 0xA1, 0x71, 0x11, 0x8C, 0x03, 0x12, 0xFF, 0x72,
+  0x01, 0xB2, 0xF0, 0x2B, 0x24, 0x05, 0xFF, 0x72, 0x10, 0x10, 0x10, 0x28,
+  0x44, 0x44, 0x82, 0xFF, 0xCC, 0x80, 0x71, 0x12, 0x20, 0xC6, 0x91, 0x22,
+  0xFE, 0x41, 0x81, 0x02, 0x05, 0x8C, 0x90, 0xA1, 0x42, 0x85, 0x11, 0xC0,
+  0x32, 0x61, 0x08, 0x45, 0x26, 0x0C, 0x08, 0x10, 0x23, 0x49, 0xA1, 0x42,
+  0x85, 0x09, 0x3B, 0xA0, 0x74, 0x63, 0xF8, 0x41, 0x26, 0x3D, 0x34, 0x10,
+  0xF1, 0x04, 0x10, 0x41, 0x04, 0x38, 0x72, 0x78, 0xA2, 0x72, 0x08, 0x1F,
+  0x86, 0x17, 0x80, 0x40, 0xC0, 0x40, 0x40, 0x5C, 0x62, 0x42, 0x42, 0x42,
+  0x42, 0x42, 0xE7, 0x40, 0x05, 0x92, 0x49, 0x70, 0x31, 0x31, 0xB1, 0x21,
+  0x31, 0xFE, 0x40, 0x40, 0x60, 0x10, 0x08, 0x04, 0xFA, 0x21, 0x20, 0xE0,
+  0x48, 0x24, 0x11, 0x9C, 0xF0, 0x59, 0x9C, 0xC9, 0x11, 0x22, 0x24, 0x44,
+  0x88, 0x91, 0x17, 0x77, 0x5C, 0xE2, 0x42, 0x42, 0x42, 0x42, 0x42, 0xE7,
+  0x31, 0x28, 0x61, 0x86, 0x14, 0x9C, 0x5D, 0xC9, 0x0A, 0x14, 0x28, 0x59,
+  0x2C, 0x40, 0x83, 0x80, 0x34, 0x9A, 0x14, 0x28, 0x50, 0x91, 0x1E, 0x04,
+  0x08, 0x38, 0x5F, 0x94, 0x10, 0x41, 0x04, 0x38, 0x79, 0x8E, 0x39, 0x9E,
+  0x04, 0xF4, 0x44, 0x44, 0x47, 0xC6, 0x42, 0x42, 0x42, 0x42, 0x42, 0x47,
+  0x3A, 0x03, 0x26, 0x31, 0x12, 0xE2, 0x42, 0xF2, 0x3C, 0xEE, 0xF4, 0x44,
+  0x44, 0x42, 0xA8, 0x2A, 0x82, 0xA8, 0x11, 0x01, 0x10, 0xF6, 0x24, 0x28,
+  0x10, 0x10, 0x28, 0x44, 0xEF, 0xF3, 0x42, 0x22, 0x24, 0x14, 0x18, 0x08,
+  0x08, 0x10, 0x10, 0x60, 0xFE, 0x20, 0x84, 0x21, 0x14, 0x7F, 0x29, 0x24,
+  0xB4, 0x49, 0x24, 0x88, 0xFF, 0xFE, 0x89, 0x24, 0x99, 0x49, 0x24, 0xA0,
+  0x12, 0x56, 0x76, 0x08, 0x16, 0xFF, 0xFD, 0x61, 0x07, 0x12, 0x14, 0xFF,
+  0x11, 0x20, 0x18, 0x04, 0x02, 0x05, 0x4D, 0xD4, 0x46, 0x23, 0x11, 0x88,
+  0xC4, 0xD7, 0x45, 0x40, 0x80, 0xC0, 0x12, 0x32, 0x21, 0x51, 0xFF, 0x81,
+  0x13, 0x11, 0x28, 0x90, 0x66, 0x62, 0x62, 0x3E, 0x02, 0x02, 0x06, 0x12,
+  0x31, 0x32, 0x21, 0x91, 0xFF, 0xF9, 0x11, 0x31, 0x31, 0x11, 0x12, 0x31,
+  0x32, 0x21, 0x91, 0xFF, 0xF9, 0x11, 0x31, 0x31, 0x12, 0xCD, 0xF8, 0x90,
+  0x10, 0x1F, 0x11, 0x11, 0x3E, 0x60, 0xC4, 0x08, 0x81, 0x1F, 0x22, 0x24,
+  0x44, 0x9F, 0x30, 0x60, 0x40, 0x81, 0xF2, 0x24, 0x5F, 0x00, 0x74, 0x42,
+  0x70, 0x86, 0x4C, 0x00, 0x86, 0x36, 0x24, 0x32, 0x43, 0x3C, 0x32, 0x43,
+  0x26, 0x26, 0x3C, 0x7E, 0xC9, 0x90, 0xE3, 0x44, 0x91, 0x80, 0x7F, 0x30,
+  0x98, 0x0C, 0x06, 0x03, 0xF1, 0x8C, 0xC3, 0x61, 0xB1, 0x9F, 0x80, 0x18,
+  0x35, 0xF3, 0x1F, 0xFF, 0xC1, 0x50, 0x37, 0x41, 0x13, 0x62, 0xFF, 0xFF,
+  0x32, 0xF4, 0x11, 0x53, 0x11, 0x91, 0x1F, 0x41, 0x71, 0x8E, 0x51, 0x8A,
+  0x11, 0x90, 0x09, 0x90, 0x09, 0xA0, 0x07, 0xE0, 0x0D, 0xB0, 0x19, 0x98,
+  0x19, 0x98, 0x31, 0x8C, 0x61, 0x8E, 0xF9, 0x08, 0x10, 0x20, 0xC7, 0x03,
+  0x03, 0x06, 0x1B, 0xF0, 0x12, 0x53, 0xB1, 0xF5, 0x1A, 0x29, 0x29, 0x29,
+  0x2F, 0x71, 0xF3, 0x11, 0x31, 0x32, 0x71, 0x31, 0x65, 0x52, 0x22, 0x13,
+  0xB1, 0xF5, 0x1A, 0x29, 0x29, 0x29, 0x2F, 0x71, 0xF3, 0x11, 0x71, 0xCC,
+  0x49, 0x88, 0x32, 0x06, 0x40, 0xF8, 0x19, 0x83, 0x30, 0x63, 0x0C, 0x31,
+  0xC3, 0x00, 0x37, 0x41, 0x13, 0xFF, 0x92, 0xFF, 0xA1, 0x91, 0x12, 0x70,
+  0x1A, 0x45, 0x21, 0xFF, 0xFF, 0xFF, 0xF2, 0x11, 0x70, 0x63, 0x04, 0x30,
+  0x41, 0x88, 0x18, 0x80, 0xD0, 0x0D, 0x00, 0x60, 0x02, 0x00, 0x40, 0x3C,
+  0x00, 0x06, 0x00, 0x60, 0x7F, 0xEC, 0x63, 0x86, 0x38, 0x61, 0x86, 0x3C,
+  0x63, 0x66, 0x61, 0xF8, 0x06, 0x00, 0x12, 0x53, 0xB1, 0xFF, 0xFF, 0xFF,
+  0xA5, 0x5B, 0xA1, 0xD0, 0x13, 0x33, 0x21, 0x51, 0xFF, 0xF4, 0x11, 0x46,
+  0x5F, 0xF2, 0x13, 0x12, 0x42, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x42,
+  0x43, 0x12, 0x42, 0x42, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x42, 0x44, 0xF0,
+  0xFF, 0x11, 0x06, 0x63, 0xF3, 0x1F, 0xC4, 0x73, 0x11, 0xFF, 0x61, 0x23,
+  0x11, 0x12, 0x73, 0xB1, 0xFF, 0xF3, 0x4A, 0x31, 0x1C, 0x11, 0x1F, 0xA1,
+  0x11, 0x83, 0x11, 0x21, 0x30, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0xF1,
+  0x8C, 0xC3, 0x61, 0xB1, 0x9F, 0x80, 0x01, 0x24, 0x47, 0x41, 0x42, 0x21,
+  0x63, 0xC6, 0x46, 0xF6, 0x17, 0x45, 0x22, 0x72, 0x12, 0x55, 0xA8, 0x71,
+  0x61, 0x91, 0x71, 0x51, 0xD2, 0xE2, 0xF1, 0x1F, 0x21, 0x71, 0x61, 0x61,
+  0x98, 0x10, 0x47, 0x35, 0x12, 0x22, 0xFF, 0x13, 0x91, 0x13, 0x71, 0x12,
+  0x72, 0x82, 0x82, 0x72, 0x42, 0x12, 0x3E, 0x82, 0x04, 0x8E, 0xD0, 0xE0,
+  0xC1, 0x83, 0x89, 0xE0, 0x7E, 0x44, 0x99, 0xF2, 0x24, 0x5F, 0x00, 0x16,
+  0x11, 0x14, 0xFE, 0x15, 0x25, 0x43, 0xFC, 0x27, 0x42, 0x96, 0x10, 0x00,
+  0x0C, 0xCC, 0x92, 0x0A, 0x81, 0xF8, 0x69, 0x09, 0x33, 0x33, 0x33, 0x30,
+  0xC2, 0x18, 0x10, 0x5E, 0x63, 0x11, 0x0B, 0x85, 0x43, 0x21, 0x11, 0x8C,
+  0x22, 0x19, 0x03, 0x00, 0x06, 0x31, 0x10, 0xB8, 0x54, 0x32, 0x11, 0x18,
+  0xC0, 0x00, 0x67, 0x28, 0x28, 0x38, 0x2C, 0x26, 0x62, 0x25, 0x43, 0xFF,
+  0x43, 0x21, 0x20, 0x61, 0x8C, 0xA5, 0x29, 0x6A, 0x4C, 0x93, 0x24, 0x98,
+  0x63, 0x11, 0x08, 0x87, 0xC2, 0x21, 0x11, 0x8C, 0x7F, 0x11, 0x08, 0x84,
+  0x42, 0x21, 0x11, 0x8C, 0x12, 0x31, 0x71, 0x42, 0x22, 0x37, 0x44, 0x91,
+  0xF1, 0x15, 0x36, 0x4F, 0xD1, 0x35, 0x10, 0x59, 0x20, 0x0C, 0xCA, 0x3F,
+  0x20, 0x87, 0x27, 0x00 };
+
+const RleGlyph TimesNRCyr8pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   4,    0,    1, 0 },  // 0x20 ' '
+  {     0,   1,  12,   4,    1,  -11, 0 },  // 0x21 '!'
+  {     2,   3,   5,   7,    1,  -11, 0 },  // 0x22 '"'
+  {     4,  10,  12,  11,    1,  -11, 0 },  // 0x23 '#'
+  {    19,   6,  14,   8,    1,  -12, 0 },  // 0x24 '$'
+  {    30,  13,  12,  13,    0,  -11, 2 },  // 0x25 '%'
+  {    47,  11,  12,  12,    1,  -11, 0 },  // 0x26 '&'
+  {    64,   1,   5,   3,    1,  -11, 0 },  // 0x27 '''
+  {    65,   4,  15,   5,    1,  -11, 0 },  // 0x28 '('
+  {    73,   4,  15,   5,    0,  -11, 0 },  // 0x29 ')'
+  {    81,   7,   7,   8,    1,  -11, 0 },  // 0x2A '*'
+  {    88,   9,   9,  11,    1,   -9, 2 },  // 0x2B '+'
+  {    94,   2,   4,   4,    1,   -1, 0 },  // 0x2C ','
+  {    95,   3,   1,   5,    1,   -3, 0 },  // 0x2D '-'
+  {    96,   2,   2,   4,    1,   -1, 0 },  // 0x2E '.'
+  {    97,   6,  12,   5,    0,  -11, 2 },  // 0x2F '/'
+  {   104,   6,  12,   8,    1,  -11, 0 },  // 0x30 '0'
+  {   113,   3,  12,   7,    2,  -11, 0 },  // 0x31 '1'
+  {   118,   7,  12,   8,    1,  -11, 0 },  // 0x32 '2'
+  {   129,   5,  12,   8,    1,  -11, 0 },  // 0x33 '3'
+  {   137,   6,  12,   8,    1,  -11, 0 },  // 0x34 '4'
+  {   146,   6,  12,   8,    1,  -11, 0 },  // 0x35 '5'
+  {   155,   6,  12,   8,    1,  -11, 0 },  // 0x36 '6'
+  {   164,   6,  12,   8,    1,  -11, 2 },  // 0x37 '7'
+  {   171,   6,  12,   8,    1,  -11, 0 },  // 0x38 '8'
+  {   180,   6,  12,   8,    1,  -11, 0 },  // 0x39 '9'
+  {   189,   2,   8,   4,    1,   -7, 0 },  // 0x3A ':'
+  {   191,   2,  10,   4,    1,   -7, 0 },  // 0x3B ';'
+  {   194,   8,   9,  11,    1,   -9, 0 },  // 0x3C '<'
+  {   203,   9,   5,  11,    1,   -7, 1 },  // 0x3D '='
+  {   206,   8,   9,  11,    2,   -9, 0 },  // 0x3E '>'
+  {   215,   6,  12,   6,    0,  -11, 0 },  // 0x3F '?'
+  {   224,  14,  15,  15,    1,  -11, 0 },  // 0x40 '@'
+  {   251,  11,  12,  12,    0,  -11, 2 },  // 0x41 'A'
+  {   267,   9,  12,  11,    0,  -11, 2 },  // 0x42 'B'
+  {   279,  11,  12,  12,    0,  -11, 2 },  // 0x43 'C'
+  {   294,  12,  12,  13,    0,  -11, 2 },  // 0x44 'D'
+  {   306,   9,  12,  11,    1,  -11, 0 },  // 0x45 'E'
+  {   320,   9,  12,  11,    1,  -11, 2 },  // 0x46 'F'
+  {   331,  13,  12,  13,    0,  -11, 2 },  // 0x47 'G'
+  {   347,  12,  12,  13,    0,  -11, 2 },  // 0x48 'H'
+  {   361,   3,  12,   6,    1,  -11, 0 },  // 0x49 'I'
+  {   366,   7,  12,   7,    0,  -11, 2 },  // 0x4A 'J'
+  {   373,  13,  12,  13,    0,  -11, 2 },  // 0x4B 'K'
+  {   392,  11,  12,  11,    0,  -11, 2 },  // 0x4C 'L'
+  {   402,  15,  12,  16,    0,  -11, 2 },  // 0x4D 'M'
+  {   420,  12,  12,  13,    0,  -11, 2 },  // 0x4E 'N'
+  {   436,  11,  12,  12,    0,  -11, 2 },  // 0x4F 'O'
+  {   449,   9,  12,  10,    0,  -11, 2 },  // 0x50 'P'
+  {   460,  11,  15,  12,    0,  -11, 2 },  // 0x51 'Q'
+  {   476,  11,  12,  12,    0,  -11, 2 },  // 0x52 'R'
+  {   492,   7,  12,   9,    1,  -11, 0 },  // 0x53 'S'
+  {   503,   9,  12,  10,    0,  -11, 2 },  // 0x54 'T'
+  {   513,  13,  12,  13,    0,  -11, 2 },  // 0x55 'U'
+  {   525,  11,  12,  12,    0,  -11, 2 },  // 0x56 'V'
+  {   538,  17,  12,  16,   -1,  -11, 2 },  // 0x57 'W'
+  {   559,  12,  12,  12,    0,  -11, 0 },  // 0x58 'X'
+  {   577,  11,  12,  12,    0,  -11, 2 },  // 0x59 'Y'
+  {   593,  11,  12,  11,    0,  -11, 1 },  // 0x5A 'Z'
+  {   608,   3,  15,   4,    1,  -11, 2 },  // 0x5B '['
+  {   612,   4,  12,   5,    1,  -11, 2 },  // 0x5C
+  {   617,   3,  15,   4,    0,  -11, 2 },  // 0x5D ']'
+  {   621,   8,   6,   9,    2,  -11, 0 },  // 0x5E '^'
+  {   627,   8,   1,   8,    0,    2, 0 },  // 0x5F '_'
+  {   628,   3,   3,   5,    1,  -11, 0 },  // 0x60 '`'
+  {   630,   7,   8,   9,    1,   -7, 0 },  // 0x61 'a'
+  {   637,   7,  12,   9,    0,  -11, 0 },  // 0x62 'b'
+  {   648,   5,   8,   7,    1,   -7, 0 },  // 0x63 'c'
+  {   653,   7,  12,  10,    1,  -11, 0 },  // 0x64 'd'
+  {   664,   5,   8,   8,    1,   -7, 0 },  // 0x65 'e'
+  {   669,   6,  12,   5,    0,  -11, 0 },  // 0x66 'f'
+  {   678,   6,  11,   8,    1,   -7, 0 },  // 0x67 'g'
+  {   687,   8,  12,   9,    0,  -11, 0 },  // 0x68 'h'
+  {   699,   3,  12,   4,    0,  -11, 0 },  // 0x69 'i'
+  {   704,   4,  15,   4,   -2,  -11, 2 },  // 0x6A 'j'
+  {   711,   9,  12,   9,    0,  -11, 0 },  // 0x6B 'k'
+  {   113,   3,  12,   4,    0,  -11, 0 },  // 0x6C 'l'
+  {   725,  11,   8,  12,    0,   -7, 0 },  // 0x6D 'm'
+  {   736,   8,   8,   9,    0,   -7, 0 },  // 0x6E 'n'
+  {   744,   6,   8,   9,    1,   -7, 0 },  // 0x6F 'o'
+  {   750,   7,  11,   9,    0,   -7, 0 },  // 0x70 'p'
+  {   760,   7,  11,   9,    1,   -7, 0 },  // 0x71 'q'
+  {   770,   6,   8,   6,    0,   -7, 0 },  // 0x72 'r'
+  {   776,   4,   8,   6,    1,   -7, 0 },  // 0x73 's'
+  {   780,   4,  10,   5,    0,   -9, 0 },  // 0x74 't'
+  {   785,   8,   8,   9,    0,   -7, 0 },  // 0x75 'u'
+  {   793,   9,   8,   8,   -1,   -7, 2 },  // 0x76 'v'
+  {   801,  12,   8,  12,    0,   -7, 0 },  // 0x77 'w'
+  {   813,   8,   8,   8,    0,   -7, 0 },  // 0x78 'x'
+  {   821,   8,  11,   8,    0,   -7, 0 },  // 0x79 'y'
+  {   832,   6,   8,   7,    0,   -7, 0 },  // 0x7A 'z'
+  {   838,   3,  15,   8,    2,  -11, 0 },  // 0x7B '{'
+  {   844,   1,  15,   3,    1,  -11, 0 },  // 0x7C '|'
+  {   846,   3,  15,   8,    1,  -11, 0 },  // 0x7D '}'
+  {   852,   9,   3,  11,    1,   -6, 2 },  // 0x7E '~'
+  {   855,   8,  10,  12,    2,   -9, 2 },  // 0x7F
+  {   750,   7,  11,   9,    0,   -7, 0 },  // 0x80
+  {   648,   5,   8,   7,    1,   -7, 0 },  // 0x81
+  {   860,   7,   7,   8,    0,   -6, 2 },  // 0x82
+  {   821,   8,  11,   8,    0,   -7, 0 },  // 0x83
+  {   866,   9,  14,  11,    1,  -10, 0 },  // 0x84
+  {   813,   8,   8,   8,    0,   -7, 0 },  // 0x85
+  {   882,   9,   9,   9,    0,   -6, 2 },  // 0x86
+  {   892,   8,   7,   9,    0,   -6, 0 },  // 0x87
+  {   899,  13,   7,  13,    0,   -6, 2 },  // 0x88
+  {   910,  13,   9,  13,    0,   -6, 2 },  // 0x89
+  {   922,   8,   7,   9,    0,   -6, 0 },  // 0x8A
+  {   929,  11,   7,  12,    0,   -6, 0 },  // 0x8B
+  {   939,   7,   7,   8,    0,   -6, 0 },  // 0x8C
+  {   946,   5,   8,   7,    1,   -7, 0 },  // 0x8D
+  {   951,  12,   8,  13,    0,   -7, 0 },  // 0x8E
+  {   963,   7,   7,   8,    0,   -6, 0 },  // 0x8F
+  {   251,  11,  12,  12,    0,  -11, 2 },  // 0x90
+  {   970,   9,  11,  10,    1,  -10, 0 },  // 0x91
+  {   267,   9,  12,  11,    0,  -11, 2 },  // 0x92
+  {   983,   9,  11,  10,    1,  -10, 2 },  // 0x93
+  {   990,  11,  14,  12,    0,  -10, 2 },  // 0x94
+  {   306,   9,  12,  11,    1,  -11, 0 },  // 0x95
+  {  1004,  16,  11,  16,    0,  -10, 0 },  // 0x96
+  {  1026,   7,  11,   9,    1,  -10, 0 },  // 0x97
+  {  1036,  12,  11,  13,    1,  -10, 2 },  // 0x98
+  {  1048,  12,  14,  13,    1,  -13, 2 },  // 0x99
+  {  1066,  11,  11,  12,    1,  -10, 0 },  // 0x9A
+  {  1082,  11,  11,  12,    0,  -10, 2 },  // 0x9B
+  {   402,  15,  12,  16,    0,  -11, 2 },  // 0x9C
+  {   347,  12,  12,  13,    0,  -11, 2 },  // 0x9D
+  {   436,  11,  12,  12,    0,  -11, 2 },  // 0x9E
+  {  1092,  12,  11,  13,    1,  -10, 2 },  // 0x9F
+  {   449,   9,  12,  10,    0,  -11, 2 },  // 0xA0
+  {   279,  11,  12,  12,    0,  -11, 2 },  // 0xA1
+  {   503,   9,  12,  10,    0,  -11, 2 },  // 0xA2
+  {  1100,  12,  11,  12,    0,  -10, 0 },  // 0xA3
+  {  1117,  12,  11,  14,    1,  -10, 0 },  // 0xA4
+  {   559,  12,  12,  12,    0,  -11, 0 },  // 0xA5
+  {  1134,  12,  14,  13,    1,  -10, 2 },  // 0xA6
+  {  1144,  11,  11,  12,    0,  -10, 2 },  // 0xA7
+  {  1155,  16,  11,  18,    1,  -10, 2 },  // 0xA8
+  {  1165,  16,  14,  18,    1,  -10, 2 },  // 0xA9
+  {  1178,  11,  11,  12,    0,  -10, 2 },  // 0xAA
+  {  1189,  14,  11,  16,    1,  -10, 2 },  // 0xAB
+  {  1205,   9,  11,  10,    1,  -10, 0 },  // 0xAC
+  {  1218,  10,  12,  11,    1,  -11, 2 },  // 0xAD
+  {  1232,  16,  11,  18,    1,  -10, 2 },  // 0xAE
+  {  1250,  11,  12,  12,    1,  -11, 2 },  // 0xAF
+  {   630,   7,   8,   9,    1,   -7, 0 },  // 0xB0
+  {  1266,   7,  11,   9,    1,  -10, 0 },  // 0xB1
+  {  1276,   7,   7,   8,    0,   -6, 0 },  // 0xB2
+  {  1283,   7,   7,   7,    0,   -6, 2 },  // 0xB3
+  {  1288,   8,   9,   9,    0,   -6, 2 },  // 0xB4
+  {   664,   5,   8,   8,    1,   -7, 0 },  // 0xB5
+  {  1295,  11,   8,  11,    0,   -7, 0 },  // 0xB6
+  {  1306,   6,   8,   7,    0,   -7, 0 },  // 0xB7
+  {  1312,   9,   7,   9,    0,   -6, 0 },  // 0xB8
+  {  1320,   9,  11,   9,    0,  -10, 0 },  // 0xB9
+  {  1333,   8,   8,   8,    0,   -7, 0 },  // 0xBA
+  {  1341,   8,   7,   8,    0,   -6, 2 },  // 0xBB
+  {  1347,  10,   7,  11,    0,   -6, 0 },  // 0xBC
+  {  1356,   9,   7,   9,    0,   -6, 0 },  // 0xBD
+  {   744,   6,   8,   9,    1,   -7, 0 },  // 0xBE
+  {  1364,   9,   7,   9,    0,   -6, 0 },  // 0xBF
+  {  1372,   9,  14,  11,    1,  -13, 2 },  // 0xC0
+  {  1387,   6,  11,   7,    1,  -10, 0 }   // 0xC1
+};
+
+const RleFont TimesNRCyr8pt8bRle PROGMEM = {
+  TimesNRCyr8pt8bRleData,
+  TimesNRCyr8pt8bRleGlyphs,
+  0x20, 0xC1, 18 };
+
+#endif // TIMESNRCYR8PT8BRLE_H_
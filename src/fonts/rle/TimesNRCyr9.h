@@ -0,0 +1,327 @@
+// Generated by tools/font_rle.cpp from src/fonts/TimesNRCyr9.h, do not edit.
+// 162 glyphs (18 sharing another's bitmap), 1781 bytes of bitmap data (GFXfont: 2319)
+#ifndef TIMESNRCYR9PT8BRLE_H_
+#define TIMESNRCYR9PT8BRLE_H_
+
+const uint8_t TimesNRCyr9pt8bRleData[] PROGMEM = {
+  0xFF, 0xFF, 0x43, 0xC0, 0xCF, 0x3C, 0xF3, 0x88, 0x08, 0x41, 0x08, 0x42,
+  0x08, 0x4F, 0xFE, 0x21, 0x08, 0x41, 0x08, 0xFF, 0xE4, 0x20, 0x84, 0x21,
+  0x04, 0x20, 0x10, 0xFF, 0x5E, 0x9D, 0x1E, 0x1C, 0x1C, 0x1C, 0x2E, 0x5C,
+  0xBD, 0x6F, 0x84, 0x00, 0x13, 0x71, 0x35, 0xF5, 0x2C, 0x2C, 0x25, 0x5B,
+  0x33, 0x2C, 0x23, 0x3B, 0x55, 0x2C, 0x2F, 0xC2, 0x55, 0x0E, 0x00, 0xC8,
+  0x06, 0x40, 0x32, 0x01, 0xA0, 0x06, 0x78, 0x71, 0x8C, 0xC8, 0xC6, 0x86,
+  0x1C, 0x30, 0xC1, 0xC7, 0x17, 0xCF, 0x00, 0xFF, 0x80, 0x08, 0x88, 0xC4,
+  0x63, 0x18, 0xC6, 0x31, 0x84, 0x30, 0x82, 0x08, 0x82, 0x08, 0x61, 0x0C,
+  0x63, 0x18, 0xC6, 0x31, 0x18, 0x88, 0x80, 0x10, 0x23, 0x59, 0xCF, 0xE2,
+  0x04, 0x00, 0x41, 0xFF, 0x14, 0x18, 0x14, 0xFC, 0xF5, 0x80, 0xF0, 0xF0,
+  0x41, 0xF1, 0x2F, 0x02, 0xF0, 0x2F, 0x02, 0x40, 0x38, 0xD9, 0x16, 0x3C,
+  0x78, 0xF1, 0xE3, 0xC7, 0x8D, 0x13, 0x63, 0x80, 0x12, 0x11, 0x31, 0xFF,
+  0x91, 0x21, 0x38, 0x4C, 0x86, 0x06, 0x06, 0x06, 0x0C, 0x08, 0x18, 0x10,
+  0x20, 0x41, 0xFE, 0x72, 0x60, 0x82, 0x08, 0x43, 0x87, 0x0C, 0x30, 0xE2,
+  0x70, 0x52, 0x61, 0xF1, 0x2F, 0x02, 0x62, 0xF0, 0x28, 0x42, 0x72, 0x2F,
+  0x30, 0x3E, 0x79, 0x07, 0x07, 0x83, 0x83, 0x83, 0x06, 0x0C, 0x14, 0x6F,
+  0x00, 0x0C, 0xC2, 0x18, 0x43, 0x6E, 0xF3, 0xCF, 0x3C, 0xDA, 0x30, 0x16,
+  0x63, 0x12, 0xF5, 0x2F, 0x62, 0xE0, 0x7D, 0x8F, 0x1E, 0x34, 0x45, 0x0C,
+  0x24, 0xC5, 0x8F, 0x1B, 0x33, 0xC0, 0x31, 0x2C, 0xF3, 0xCF, 0x3C, 0xDF,
+  0x08, 0x63, 0x1C, 0xC0, 0x04, 0xA4, 0xF0, 0x03, 0xD6, 0x91, 0x63, 0x52,
+  0x53, 0x61, 0xA3, 0xA2, 0xA3, 0xA1, 0x0A, 0xFF, 0x0A, 0x01, 0xA3, 0xA2,
+  0xA3, 0xA1, 0x63, 0x52, 0x53, 0x61, 0x90, 0x79, 0x1E, 0x1E, 0x30, 0x61,
+  0x82, 0x0C, 0x10, 0x20, 0x01, 0x83, 0x00, 0x03, 0xE0, 0x0C, 0x18, 0x10,
+  0x04, 0x20, 0x06, 0x41, 0xF2, 0x43, 0x32, 0x86, 0x22, 0x84, 0x22, 0x88,
+  0x66, 0x88, 0x64, 0x89, 0xC8, 0x86, 0x71, 0x40, 0x02, 0x40, 0x02, 0x20,
+  0x04, 0x18, 0x18, 0x07, 0xE0, 0x62, 0xFA, 0x12, 0x1B, 0x1F, 0xA2, 0x11,
+  0x11, 0xFB, 0x11, 0x16, 0x11, 0x49, 0x57, 0x25, 0x11, 0x1F, 0x12, 0x12,
+  0x32, 0x22, 0xFE, 0x0C, 0xC3, 0x18, 0xC6, 0x31, 0x8C, 0x43, 0xE0, 0xC6,
+  0x30, 0xCC, 0x33, 0x0C, 0xC6, 0xFF, 0x00, 0x45, 0x21, 0x22, 0x53, 0x12,
+  0x72, 0x12, 0x83, 0xA2, 0xA2, 0xA2, 0xA2, 0xB2, 0xA2, 0x81, 0x23, 0x51,
+  0x56, 0x20, 0x0A, 0x42, 0x25, 0x12, 0xB1, 0x21, 0xB1, 0xE1, 0x11, 0xFF,
+  0xFF, 0x71, 0x11, 0xA1, 0xC1, 0x12, 0x12, 0x25, 0x11, 0x30, 0x0A, 0x12,
+  0x24, 0xB1, 0xB1, 0x91, 0xF2, 0x47, 0x4F, 0x71, 0xC1, 0x91, 0x12, 0x25,
+  0x11, 0x0D, 0x25, 0xB1, 0xB1, 0xF4, 0x16, 0x47, 0x4B, 0x1F, 0xF5, 0x22,
+  0x25, 0x0F, 0x90, 0xE1, 0xC2, 0x03, 0x18, 0x04, 0xC0, 0x03, 0x00, 0x0C,
+  0x0F, 0xF0, 0x0C, 0xC0, 0x31, 0x80, 0xC6, 0x03, 0x0E, 0x1C, 0x0F, 0xC0,
+  0x06, 0x28, 0x22, 0x22, 0x22, 0xFF, 0xFF, 0x06, 0x86, 0xFF, 0xFF, 0x02,
+  0x22, 0x22, 0x22, 0x08, 0x22, 0xFF, 0xFF, 0x02, 0x22, 0x26, 0x22, 0x22,
+  0xFF, 0xFF, 0xC2, 0x31, 0x43, 0x30, 0xFC, 0xF0, 0xC1, 0x03, 0x08, 0x0C,
+  0x40, 0x32, 0x00, 0xD0, 0x03, 0xC0, 0x0D, 0x80, 0x33, 0x00, 0xC6, 0x03,
+  0x0C, 0x0C, 0x1C, 0xFC, 0xFC, 0x06, 0x62, 0x22, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x1A, 0x42, 0x62, 0x04, 0x96, 0x21, 0x71, 0x22, 0xF5, 0x11, 0x15, 0x2F,
+  0xFC, 0x11, 0x13, 0x2F, 0xC1, 0x11, 0x12, 0xFF, 0xF1, 0x11, 0x27, 0x21,
+  0x26, 0x22, 0x20, 0xE0, 0x7D, 0xC0, 0x43, 0x81, 0x0B, 0x04, 0x24, 0x10,
+  0x98, 0x42, 0x31, 0x08, 0x64, 0x20, 0x90, 0x81, 0x42, 0x03, 0x08, 0x0C,
+  0xF8, 0x10, 0x45, 0x62, 0x52, 0x32, 0x72, 0x22, 0x72, 0x12, 0x94, 0x94,
+  0x94, 0x94, 0x92, 0x12, 0x72, 0x22, 0x72, 0x32, 0x52, 0x65, 0x40, 0x09,
+  0x22, 0x24, 0x11, 0x91, 0x11, 0xFF, 0x01, 0x11, 0x44, 0x11, 0x55, 0xFF,
+  0xF1, 0x22, 0x25, 0x45, 0x62, 0x52, 0x32, 0x72, 0x22, 0x72, 0x12, 0x94,
+  0x94, 0x94, 0x94, 0x92, 0x12, 0x72, 0x22, 0x71, 0x42, 0x51, 0x66, 0x92,
+  0xC2, 0xD2, 0xD3, 0xFF, 0x01, 0x8C, 0x0C, 0x30, 0x61, 0x83, 0x0C, 0x18,
+  0xE0, 0xFE, 0x06, 0x60, 0x33, 0x01, 0x8C, 0x0C, 0x30, 0x61, 0xCF, 0xC7,
+  0x80, 0x39, 0x67, 0xC3, 0xC1, 0xE0, 0x70, 0x3C, 0x0E, 0x07, 0x83, 0xC3,
+  0xC6, 0xBC, 0x0A, 0x13, 0x23, 0xB1, 0x81, 0xFF, 0xFF, 0xF7, 0x22, 0x22,
+  0x06, 0x37, 0x22, 0x32, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x11, 0x43,
+  0x51, 0x14, 0x11, 0x30, 0x05, 0x35, 0x31, 0x31, 0x21, 0x11, 0x81, 0xF6,
+  0x24, 0x11, 0x1F, 0x71, 0x11, 0x12, 0xFF, 0x11, 0x12, 0xFD, 0x05, 0x15,
+  0x35, 0x31, 0x11, 0x31, 0x31, 0x21, 0x11, 0x51, 0x81, 0xFF, 0x32, 0x41,
+  0x11, 0x51, 0xFD, 0x13, 0x24, 0x28, 0x13, 0x11, 0x1F, 0xD1, 0x12, 0x21,
+  0x12, 0xFF, 0xA0, 0xFC, 0x78, 0xE0, 0xC1, 0x82, 0x07, 0x10, 0x0C, 0x80,
+  0x1C, 0x00, 0x30, 0x00, 0xC0, 0x05, 0x80, 0x23, 0x01, 0x06, 0x08, 0x1C,
+  0xF0, 0xFC, 0x05, 0x35, 0x12, 0x71, 0x42, 0x51, 0x62, 0x31, 0x72, 0x31,
+  0x82, 0x11, 0x92, 0x11, 0xA2, 0xB2, 0xB2, 0xB2, 0xB2, 0x96, 0x40, 0x1A,
+  0x21, 0x62, 0x31, 0x53, 0x92, 0x92, 0x92, 0xA2, 0x92, 0x92, 0x92, 0xA2,
+  0x71, 0x12, 0x8C, 0x10, 0x03, 0x12, 0xFF, 0xD2, 0x01, 0xF0, 0x2B, 0x2F,
+  0x02, 0x40, 0x05, 0xFF, 0xD2, 0x10, 0x10, 0x10, 0x28, 0x44, 0x44, 0x82,
+  0x09, 0xCC, 0x80, 0x78, 0xCC, 0xCC, 0x1C, 0x6C, 0xCC, 0xCC, 0xDD, 0x6E,
+  0x60, 0xE0, 0x60, 0x60, 0x6C, 0x76, 0x63, 0x63, 0x63, 0x63, 0x63, 0x66,
+  0x3C, 0x3C, 0x8F, 0x1E, 0x0C, 0x18, 0x38, 0xBE, 0x38, 0x0E, 0x06, 0x06,
+  0x06, 0x3E, 0x6E, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x4F, 0x36, 0x38, 0xCB,
+  0x1F, 0xFC, 0x18, 0x30, 0xB2, 0x38, 0x1C, 0xCD, 0x83, 0x0F, 0x8C, 0x18,
+  0x30, 0x60, 0xC1, 0x83, 0x0F, 0x80, 0x3C, 0x33, 0xD8, 0xCC, 0x63, 0x30,
+  0xF1, 0x80, 0xFE, 0x1F, 0xB0, 0x70, 0x3C, 0x27, 0xE0, 0x12, 0x61, 0x81,
+  0xF6, 0x35, 0x31, 0x14, 0x1F, 0xFF, 0x51, 0x21, 0x11, 0x21, 0x66, 0x00,
+  0x6E, 0x66, 0x66, 0x66, 0xF0, 0x32, 0x82, 0x82, 0x12, 0x32, 0xFF, 0xC2,
+  0x21, 0x21, 0x20, 0x30, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x3C, 0x62, 0x0C,
+  0x81, 0xE0, 0x3C, 0x06, 0xC0, 0xCC, 0x18, 0xCF, 0xDE, 0x6E, 0x73, 0xCE,
+  0x66, 0x31, 0x98, 0xC6, 0x63, 0x19, 0x8C, 0x66, 0x31, 0x98, 0xC6, 0xF7,
+  0xBC, 0x6E, 0x79, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0xF7, 0x80,
+  0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xB6, 0x38, 0x37, 0x7D, 0x8C, 0x66,
+  0x33, 0x19, 0x8C, 0xC6, 0x66, 0x3E, 0x18, 0x0C, 0x06, 0x0F, 0xC0, 0x3A,
+  0x66, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x66, 0x3E, 0x06, 0x06, 0x06, 0x1F,
+  0x6F, 0xED, 0x83, 0x06, 0x0C, 0x18, 0x30, 0xF8, 0x76, 0x38, 0x78, 0x78,
+  0x78, 0x73, 0xB8, 0x21, 0x8F, 0x98, 0x61, 0x86, 0x18, 0x61, 0x93, 0x80,
+  0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xCF, 0x3B, 0x00, 0xF7,
+  0xB1, 0x98, 0x8C, 0x43, 0x41, 0xA0, 0xD0, 0x30, 0x18, 0x00, 0xF7, 0x3B,
+  0x18, 0x98, 0xC4, 0xC6, 0x23, 0x5A, 0x1A, 0xD0, 0xD2, 0x83, 0x18, 0x18,
+  0xC0, 0xF7, 0x31, 0x0D, 0x03, 0x00, 0x80, 0xE0, 0x98, 0xC6, 0xE7, 0x80,
+  0xF3, 0xB0, 0x98, 0x46, 0x43, 0x20, 0xA0, 0x70, 0x18, 0x08, 0x04, 0x04,
+  0x1E, 0x0E, 0x00, 0x7E, 0x99, 0x30, 0xC3, 0x86, 0x18, 0xB1, 0xFE, 0x19,
+  0x88, 0x42, 0x11, 0x98, 0x82, 0x08, 0x42, 0x10, 0x82, 0x08, 0x0F, 0x20,
+  0xC3, 0x08, 0x42, 0x10, 0xC3, 0x11, 0x08, 0x42, 0x10, 0x88, 0x80, 0x70,
+  0x73, 0x18, 0x38, 0x0A, 0x18, 0xFF, 0xFF, 0xF7, 0x81, 0x08, 0x13, 0x14,
+  0xFF, 0xC1, 0x11, 0x20, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x2D, 0x17, 0xA8,
+  0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC7, 0x33, 0x5E, 0x8B, 0x40, 0xC0, 0x30,
+  0x1E, 0x00, 0x13, 0x32, 0x21, 0x11, 0x41, 0xFF, 0xF7, 0x11, 0x41, 0x12,
+  0x9A, 0x12, 0x32, 0x21, 0xFD, 0x35, 0x4F, 0x60, 0x13, 0x22, 0x32, 0x21,
+  0x11, 0x21, 0xFF, 0xFF, 0xF3, 0x11, 0x41, 0x33, 0x13, 0x22, 0x32, 0x21,
+  0x11, 0x21, 0xFF, 0xFF, 0xF3, 0x11, 0x41, 0x34, 0xDD, 0x10, 0xF8, 0x4C,
+  0x06, 0x03, 0xE1, 0x98, 0xC4, 0x62, 0x3E, 0x70, 0x72, 0x02, 0x20, 0x23,
+  0xE2, 0x23, 0x22, 0x32, 0x23, 0x27, 0xE7, 0x60, 0x81, 0x03, 0xE4, 0x68,
+  0xD1, 0xFE, 0x39, 0x98, 0x18, 0x31, 0xE0, 0xC1, 0xC6, 0x78, 0x00, 0x41,
+  0xC6, 0xC2, 0x21, 0x88, 0x82, 0x3E, 0x0C, 0x98, 0x22, 0x20, 0x88, 0xC6,
+  0x71, 0xF0, 0x3F, 0x62, 0x62, 0x32, 0x1E, 0x32, 0x22, 0x67, 0x18, 0x45,
+  0xA1, 0xF9, 0x46, 0x68, 0x11, 0x1F, 0xC1, 0x11, 0x34, 0x11, 0x10, 0x19,
+  0x11, 0x16, 0xA1, 0xFF, 0xFF, 0xB1, 0xB1, 0x60, 0x39, 0x41, 0x14, 0x21,
+  0xFF, 0xFF, 0x92, 0xFF, 0x62, 0xA1, 0x16, 0x21, 0x11, 0x19, 0x11, 0x11,
+  0x91, 0xE0, 0x71, 0xE3, 0x82, 0x31, 0x20, 0x8C, 0x40, 0x23, 0x20, 0x04,
+  0xC8, 0x00, 0xFC, 0x00, 0x6D, 0x80, 0x33, 0x30, 0x08, 0xCC, 0x06, 0x31,
+  0x83, 0x0C, 0x31, 0xC7, 0x8E, 0x18, 0xE6, 0x86, 0x06, 0x06, 0x06, 0x38,
+  0x06, 0x07, 0x03, 0x07, 0x86, 0x7C, 0x13, 0x53, 0x41, 0x71, 0xF7, 0x1B,
+  0x2A, 0x2A, 0x2A, 0x2F, 0x82, 0xB1, 0xC1, 0x71, 0x10, 0x32, 0x41, 0xB1,
+  0x77, 0x83, 0x63, 0x53, 0x41, 0x71, 0xF7, 0x1B, 0x2A, 0x2A, 0x2A, 0x2F,
+  0x82, 0xB1, 0xC1, 0x71, 0x10, 0x70, 0xF6, 0x10, 0x61, 0x06, 0x20, 0x62,
+  0x07, 0xC0, 0x66, 0x06, 0x30, 0x61, 0x86, 0x18, 0x60, 0xC7, 0x06, 0x48,
+  0x64, 0x21, 0xFF, 0xFF, 0xFF, 0xF1, 0x11, 0x28, 0x11, 0x15, 0x12, 0x11,
+  0x1B, 0x46, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x71, 0x10, 0x70, 0x31,
+  0x81, 0x06, 0x08, 0x30, 0x80, 0xC4, 0x06, 0x40, 0x1A, 0x00, 0xF0, 0x03,
+  0x00, 0x18, 0x04, 0x80, 0x38, 0x00, 0x07, 0x80, 0x3F, 0x07, 0x33, 0x30,
+  0xC6, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0x63, 0x18, 0xCD, 0xC0,
+  0xF8, 0x01, 0xE0, 0x13, 0x53, 0x41, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0x16,
+  0x21, 0x2A, 0x11, 0xB1, 0xE0, 0x14, 0x34, 0x21, 0x21, 0x31, 0x21, 0xFF,
+  0xFA, 0x11, 0x57, 0x6F, 0xFF, 0x61, 0x21, 0x10, 0x13, 0x43, 0x34, 0x41,
+  0x61, 0x31, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x52, 0x52, 0x11,
+  0x13, 0x43, 0x34, 0x41, 0x61, 0x31, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFA, 0x52, 0x52, 0x12, 0xF0, 0x21, 0xF1, 0x1F, 0x41, 0x10, 0x16, 0x64,
+  0x21, 0xF4, 0x1F, 0xF1, 0x49, 0x6B, 0x11, 0x1F, 0xF6, 0x11, 0x16, 0x41,
+  0x11, 0x13, 0x74, 0x41, 0x71, 0x21, 0xFF, 0xF7, 0x4C, 0x6E, 0x11, 0x1F,
+  0xFF, 0x01, 0x11, 0x94, 0x11, 0x21, 0x21, 0x10, 0x13, 0x91, 0xFF, 0x94,
+  0x66, 0x81, 0x11, 0xFC, 0x11, 0x13, 0x41, 0x11, 0xBE, 0x0E, 0x18, 0x80,
+  0xC8, 0x06, 0x00, 0x60, 0x03, 0x1F, 0xF0, 0x03, 0x00, 0x60, 0x06, 0x80,
+  0xC4, 0x18, 0x3E, 0x00, 0xB2, 0x63, 0x57, 0x51, 0x43, 0x22, 0x11, 0x81,
+  0xF1, 0x11, 0x16, 0x11, 0x1F, 0x63, 0xF0, 0x3F, 0xF6, 0x11, 0x1F, 0x91,
+  0x11, 0x71, 0x11, 0x61, 0x41, 0x41, 0x16, 0x20, 0x07, 0xF8, 0x63, 0x83,
+  0x18, 0x30, 0xC0, 0xC6, 0x07, 0x30, 0x1F, 0x80, 0x6C, 0x06, 0x60, 0x63,
+  0x03, 0x18, 0x70, 0xEF, 0x1F, 0x80, 0x01, 0x3E, 0x40, 0x80, 0x88, 0xB6,
+  0xC3, 0xC3, 0xC3, 0xC1, 0xC3, 0x42, 0x3C, 0xFC, 0x8D, 0x1B, 0xE4, 0x68,
+  0x51, 0xFE, 0x7F, 0x21, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x26, 0x31,
+  0x12, 0x52, 0xFF, 0xC1, 0x13, 0x39, 0x81, 0x67, 0x30, 0x92, 0x04, 0xA0,
+  0x1F, 0x01, 0xAC, 0x19, 0x20, 0x89, 0x8C, 0xE6, 0x10, 0xDA, 0x18, 0x21,
+  0x81, 0xC1, 0x83, 0x7C, 0x73, 0x88, 0x42, 0x30, 0x94, 0x29, 0x0C, 0x42,
+  0x11, 0xC6, 0x31, 0x04, 0x80, 0xC0, 0x00, 0x73, 0x88, 0x42, 0x30, 0x94,
+  0x29, 0x0C, 0x42, 0x11, 0xC6, 0x67, 0x48, 0x48, 0x70, 0x48, 0x4C, 0x44,
+  0xE6, 0x26, 0x43, 0xFF, 0xF3, 0x27, 0x70, 0xE5, 0x0C, 0x51, 0x45, 0x94,
+  0x4A, 0x44, 0xE4, 0x44, 0x46, 0x4E, 0x71, 0x88, 0x42, 0x10, 0xFC, 0x21,
+  0x08, 0x42, 0x11, 0xC6, 0x18, 0x21, 0x14, 0x11, 0xFF, 0xF7, 0x11, 0x14,
+  0x11, 0x21, 0x41, 0x61, 0x21, 0x71, 0x21, 0x61, 0x41, 0x49, 0x46, 0xB1,
+  0x91, 0xF1, 0x56, 0x5F, 0x71, 0xF7, 0x14, 0x62, 0x6C, 0x00, 0x04, 0x6E,
+  0x3F, 0xE0, 0x82, 0x1C, 0x5E };
+
+const RleGlyph TimesNRCyr9pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   5,    0,    1, 0 },  // 0x20 ' '
+  {     0,   2,  13,   5,    1,  -12, 0 },  // 0x21 '!'
+  {     4,   6,   5,   7,    1,  -12, 0 },  // 0x22 '"'
+  {     8,  11,  13,  12,    1,  -12, 0 },  // 0x23 '#'
+  {    26,   7,  15,   9,    1,  -13, 0 },  // 0x24 '$'
+  {    40,  15,  13,  15,    0,  -12, 2 },  // 0x25 '%'
+  {    57,  13,  13,  14,    1,  -12, 0 },  // 0x26 '&'
+  {    79,   2,   5,   3,    0,  -12, 0 },  // 0x27 '''
+  {    81,   5,  17,   6,    1,  -12, 0 },  // 0x28 '('
+  {    92,   5,  17,   6,    0,  -12, 0 },  // 0x29 ')'
+  {   103,   7,   7,   9,    1,  -12, 0 },  // 0x2A '*'
+  {   110,   9,   9,  12,    1,  -10, 2 },  // 0x2B '+'
+  {   116,   2,   5,   5,    1,   -1, 0 },  // 0x2C ','
+  {   118,   4,   1,   6,    1,   -3, 0 },  // 0x2D '-'
+  {   119,   2,   2,   5,    1,   -1, 0 },  // 0x2E '.'
+  {   120,   6,  13,   5,    0,  -12, 2 },  // 0x2F '/'
+  {   128,   7,  13,   9,    1,  -12, 0 },  // 0x30 '0'
+  {   140,   4,  13,  10,    3,  -12, 2 },  // 0x31 '1'
+  {   146,   8,  13,   9,    1,  -12, 0 },  // 0x32 '2'
+  {   159,   6,  13,   9,    1,  -12, 0 },  // 0x33 '3'
+  {   169,   9,  13,   9,    0,  -12, 2 },  // 0x34 '4'
+  {   181,   7,  13,   9,    1,  -12, 0 },  // 0x35 '5'
+  {   193,   6,  13,   9,    1,  -12, 0 },  // 0x36 '6'
+  {   203,   6,  13,   9,    1,  -12, 2 },  // 0x37 '7'
+  {   210,   7,  13,   9,    1,  -12, 0 },  // 0x38 '8'
+  {   222,   6,  13,   9,    1,  -12, 0 },  // 0x39 '9'
+  {   232,   2,   9,   5,    1,   -8, 1 },  // 0x3A ':'
+  {   234,   2,  12,   5,    1,   -8, 0 },  // 0x3B ';'
+  {   237,  10,   9,  12,    1,  -10, 1 },  // 0x3C '<'
+  {   246,  10,   5,  12,    1,   -8, 1 },  // 0x3D '='
+  {   249,  10,   9,  12,    1,  -10, 1 },  // 0x3E '>'
+  {   259,   7,  13,   7,    0,  -12, 0 },  // 0x3F '?'
+  {   271,  16,  17,  17,    1,  -12, 0 },  // 0x40 '@'
+  {   305,  14,  13,  15,    0,  -12, 2 },  // 0x41 'A'
+  {   326,  10,  13,  12,    0,  -12, 0 },  // 0x42 'B'
+  {   343,  12,  13,  13,    0,  -12, 1 },  // 0x43 'C'
+  {   362,  14,  13,  15,    0,  -12, 2 },  // 0x44 'D'
+  {   382,  11,  13,  12,    0,  -12, 2 },  // 0x45 'E'
+  {   397,  11,  13,  12,    0,  -12, 2 },  // 0x46 'F'
+  {   409,  14,  13,  15,    0,  -12, 0 },  // 0x47 'G'
+  {   432,  14,  13,  15,    0,  -12, 2 },  // 0x48 'H'
+  {   447,   6,  13,   7,    0,  -12, 2 },  // 0x49 'I'
+  {   453,   8,  13,   8,    0,  -12, 2 },  // 0x4A 'J'
+  {   462,  14,  13,  15,    0,  -12, 0 },  // 0x4B 'K'
+  {   485,  12,  13,  12,    0,  -12, 2 },  // 0x4C 'L'
+  {   495,  17,  13,  18,    1,  -12, 2 },  // 0x4D 'M'
+  {   519,  14,  13,  15,    0,  -12, 0 },  // 0x4E 'N'
+  {   542,  13,  13,  14,    0,  -12, 1 },  // 0x4F 'O'
+  {   563,  11,  13,  11,    0,  -12, 2 },  // 0x50 'P'
+  {   579,  13,  17,  14,    0,  -12, 1 },  // 0x51 'Q'
+  {   603,  13,  13,  14,    0,  -12, 0 },  // 0x52 'R'
+  {   625,   8,  13,  10,    1,  -12, 0 },  // 0x53 'S'
+  {   638,  10,  13,  12,    1,  -12, 2 },  // 0x54 'T'
+  {   648,  14,  13,  15,    0,  -12, 2 },  // 0x55 'U'
+  {   664,  12,  13,  13,    0,  -12, 2 },  // 0x56 'V'
+  {   682,  18,  13,  18,    0,  -12, 2 },  // 0x57 'W'
+  {   711,  14,  13,  14,    0,  -12, 0 },  // 0x58 'X'
+  {   734,  13,  13,  14,    1,  -12, 1 },  // 0x59 'Y'
+  {   755,  12,  13,  12,    0,  -12, 1 },  // 0x5A 'Z'
+  {   772,   3,  17,   5,    1,  -12, 2 },  // 0x5B '['
+  {   776,   4,  13,   5,    1,  -12, 2 },  // 0x5C
+  {   782,   3,  17,   5,    0,  -12, 2 },  // 0x5D ']'
+  {   786,   8,   6,  11,    2,  -12, 0 },  // 0x5E '^'
+  {   792,   9,   1,   9,    0,    2, 1 },  // 0x5F '_'
+  {   793,   3,   3,   6,    1,  -12, 0 },  // 0x60 '`'
+  {   795,   8,   9,  10,    1,   -8, 0 },  // 0x61 'a'
+  {   804,   8,  13,  10,    0,  -12, 0 },  // 0x62 'b'
+  {   817,   7,   9,   9,    1,   -8, 0 },  // 0x63 'c'
+  {   825,   8,  13,  11,    1,  -12, 0 },  // 0x64 'd'
+  {   838,   7,   9,   9,    1,   -8, 0 },  // 0x65 'e'
+  {   846,   7,  13,   6,    0,  -12, 0 },  // 0x66 'f'
+  {   858,   9,  13,   9,   -1,   -8, 0 },  // 0x67 'g'
+  {   873,   9,  13,  10,    0,  -12, 2 },  // 0x68 'h'
+  {   886,   4,  13,   5,    0,  -12, 0 },  // 0x69 'i'
+  {   893,   5,  17,   5,   -2,  -12, 2 },  // 0x6A 'j'
+  {   903,  11,  13,  10,   -1,  -12, 0 },  // 0x6B 'k'
+  {   140,   4,  13,   5,    0,  -12, 2 },  // 0x6C 'l'
+  {   921,  14,   9,  15,    0,   -8, 0 },  // 0x6D 'm'
+  {   937,   9,   9,  10,    0,   -8, 0 },  // 0x6E 'n'
+  {   948,   7,   9,  10,    1,   -8, 0 },  // 0x6F 'o'
+  {   956,   9,  13,  10,   -1,   -8, 0 },  // 0x70 'p'
+  {   971,   8,  13,  10,    1,   -8, 0 },  // 0x71 'q'
+  {   984,   7,   9,   7,    0,   -8, 0 },  // 0x72 'r'
+  {   992,   6,   9,   7,    0,   -8, 0 },  // 0x73 's'
+  {   999,   6,  11,   6,    0,  -10, 0 },  // 0x74 't'
+  {  1008,   9,   9,  10,    0,   -8, 0 },  // 0x75 'u'
+  {  1019,   9,   9,   9,    0,   -8, 0 },  // 0x76 'v'
+  {  1030,  13,   9,  14,    0,   -8, 0 },  // 0x77 'w'
+  {  1045,   9,   9,   9,    0,   -8, 0 },  // 0x78 'x'
+  {  1056,   9,  13,   9,    0,   -8, 0 },  // 0x79 'y'
+  {  1071,   7,   9,   8,    0,   -8, 0 },  // 0x7A 'z'
+  {  1079,   5,  17,   9,    2,  -12, 0 },  // 0x7B '{'
+  {  1090,   1,  17,   4,    1,  -12, 1 },  // 0x7C '|'
+  {  1092,   5,  17,   9,    1,  -12, 0 },  // 0x7D '}'
+  {  1103,  10,   3,  12,    1,   -7, 0 },  // 0x7E '~'
+  {  1107,  10,  11,  14,    2,  -10, 2 },  // 0x7F
+  {   956,   9,  13,  10,   -1,   -8, 0 },  // 0x80
+  {   817,   7,   9,   9,    1,   -8, 0 },  // 0x81
+  {  1113,   8,   8,   9,    0,   -7, 2 },  // 0x82
+  {  1056,   9,  13,   9,    0,   -8, 0 },  // 0x83
+  {  1120,  10,  17,  12,    1,  -12, 0 },  // 0x84
+  {  1045,   9,   9,   9,    0,   -8, 0 },  // 0x85
+  {  1142,  10,  10,  10,    0,   -7, 2 },  // 0x86
+  {  1153,   9,   8,  10,    0,   -7, 2 },  // 0x87
+  {  1160,  14,   8,  15,    0,   -7, 2 },  // 0x88
+  {  1172,  14,  10,  15,    0,   -7, 2 },  // 0x89
+  {  1186,   9,   8,  10,    0,   -7, 0 },  // 0x8A
+  {  1195,  12,   8,  13,    0,   -7, 0 },  // 0x8B
+  {  1207,   7,   8,   9,    1,   -7, 0 },  // 0x8C
+  {  1214,   7,   9,   8,    0,   -8, 0 },  // 0x8D
+  {  1222,  14,   9,  14,    0,   -8, 0 },  // 0x8E
+  {  1238,   8,   8,   9,    0,   -7, 0 },  // 0x8F
+  {   305,  14,  13,  15,    0,  -12, 2 },  // 0x90
+  {  1246,  10,  12,  12,    1,  -11, 2 },  // 0x91
+  {   326,  10,  13,  12,    0,  -12, 0 },  // 0x92
+  {  1259,  10,  12,  11,    1,  -11, 2 },  // 0x93
+  {  1268,  13,  15,  13,    0,  -11, 2 },  // 0x94
+  {   382,  11,  13,  12,    0,  -12, 2 },  // 0x95
+  {  1286,  18,  12,  18,    0,  -11, 0 },  // 0x96
+  {  1313,   8,  13,  10,    1,  -12, 0 },  // 0x97
+  {  1326,  13,  12,  15,    1,  -11, 2 },  // 0x98
+  {  1341,  13,  16,  15,    1,  -15, 2 },  // 0x99
+  {  1361,  12,  12,  14,    1,  -11, 0 },  // 0x9A
+  {  1379,  13,  12,  14,    0,  -11, 2 },  // 0x9B
+  {   495,  17,  13,  18,    1,  -12, 2 },  // 0x9C
+  {   432,  14,  13,  15,    0,  -12, 2 },  // 0x9D
+  {   542,  13,  13,  14,    0,  -12, 1 },  // 0x9E
+  {  1392,  13,  12,  15,    1,  -11, 2 },  // 0x9F
+  {   563,  11,  13,  11,    0,  -12, 2 },  // 0xA0
+  {   343,  12,  13,  13,    0,  -12, 1 },  // 0xA1
+  {   638,  10,  13,  12,    1,  -12, 2 },  // 0xA2
+  {  1402,  13,  12,  13,    0,  -11, 0 },  // 0xA3
+  {  1422,  14,  12,  16,    1,  -11, 0 },  // 0xA4
+  {   711,  14,  13,  14,    0,  -12, 0 },  // 0xA5
+  {  1443,  13,  15,  15,    1,  -11, 2 },  // 0xA6
+  {  1457,  13,  12,  13,    0,  -11, 2 },  // 0xA7
+  {  1472,  19,  12,  20,    1,  -11, 2 },  // 0xA8
+  {  1488,  19,  15,  20,    1,  -11, 2 },  // 0xA9
+  {  1510,  13,  12,  14,    0,  -11, 2 },  // 0xAA
+  {  1525,  16,  12,  18,    1,  -11, 2 },  // 0xAB
+  {  1544,  10,  12,  12,    1,  -11, 2 },  // 0xAC
+  {  1556,  12,  13,  13,    1,  -12, 0 },  // 0xAD
+  {  1576,  18,  13,  20,    1,  -12, 2 },  // 0xAE
+  {  1604,  13,  13,  13,    0,  -12, 0 },  // 0xAF
+  {   795,   8,   9,  10,    1,   -8, 0 },  // 0xB0
+  {  1626,   8,  13,  10,    1,  -12, 0 },  // 0xB1
+  {  1639,   7,   8,   9,    1,   -7, 0 },  // 0xB2
+  {  1646,   8,   8,   8,    0,   -7, 0 },  // 0xB3
+  {  1654,   9,  10,  10,    0,   -7, 2 },  // 0xB4
+  {   838,   7,   9,   9,    1,   -8, 0 },  // 0xB5
+  {  1663,  13,   8,  13,    0,   -7, 0 },  // 0xB6
+  {  1676,   7,   9,   8,    0,   -8, 0 },  // 0xB7
+  {  1684,  10,   8,  10,    0,   -7, 0 },  // 0xB8
+  {  1694,  10,  12,  10,    0,  -11, 0 },  // 0xB9
+  {  1709,   8,   8,   9,    1,   -7, 0 },  // 0xBA
+  {  1717,   9,   8,  10,    0,   -7, 2 },  // 0xBB
+  {  1722,  12,   8,  12,    0,   -7, 0 },  // 0xBC
+  {  1734,  10,   8,  10,    0,   -7, 0 },  // 0xBD
+  {   948,   7,   9,  10,    1,   -8, 0 },  // 0xBE
+  {  1744,  10,   8,  10,    0,   -7, 2 },  // 0xBF
+  {  1753,  11,  16,  12,    1,  -15, 2 },  // 0xC0
+  {  1772,   6,  12,   8,    1,  -11, 0 }   // 0xC1
+};
+
+const RleFont TimesNRCyr9pt8bRle PROGMEM = {
+  TimesNRCyr9pt8bRleData,
+  TimesNRCyr9pt8bRleGlyphs,
+  0x20, 0xC1, 20 };
+
+#endif // TIMESNRCYR9PT8BRLE_H_
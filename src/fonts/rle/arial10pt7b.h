@@ -0,0 +1,214 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial10pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 1228 bytes of bitmap data (GFXfont: 1438)
+#ifndef ARIAL10PT7BRLE_H_
+#define ARIAL10PT7BRLE_H_
+
+const uint8_t arial10pt7bRleData[] PROGMEM = {
+  0x00, 0x0F, 0x74, 0x40, 0x02, 0x12, 0xF5, 0x0C, 0xC1, 0x98, 0x37, 0x0C,
+  0xCF, 0xFF, 0xFF, 0xC6, 0x61, 0x98, 0x33, 0x1F, 0xFF, 0xFF, 0x99, 0x87,
+  0x60, 0xCC, 0x19, 0x80, 0x08, 0x1F, 0x1F, 0xDD, 0x7C, 0x9E, 0x43, 0xA0,
+  0xF8, 0x1F, 0x05, 0xC2, 0x61, 0x3C, 0x9F, 0x5D, 0xFC, 0x7C, 0x08, 0x04,
+  0x00, 0x38, 0x18, 0x6C, 0x30, 0xC6, 0x30, 0xC6, 0x60, 0xC6, 0x60, 0xC6,
+  0xC0, 0x6C, 0xC0, 0x39, 0x9C, 0x01, 0xB6, 0x03, 0x63, 0x03, 0x63, 0x06,
+  0x63, 0x06, 0x63, 0x0C, 0x36, 0x0C, 0x1C, 0x0E, 0x01, 0xF0, 0x31, 0x83,
+  0x18, 0x31, 0x81, 0x30, 0x1E, 0x03, 0xC0, 0x66, 0x0C, 0x66, 0xC3, 0x6C,
+  0x1C, 0xE1, 0xC7, 0xF7, 0x3E, 0x20, 0x0A, 0x08, 0x8C, 0x46, 0x33, 0x18,
+  0xC6, 0x31, 0x8C, 0x31, 0x84, 0x30, 0x82, 0x82, 0x18, 0x43, 0x18, 0x63,
+  0x18, 0xC6, 0x31, 0x98, 0xC4, 0x62, 0x20, 0x10, 0x23, 0xF8, 0x82, 0x8D,
+  0x80, 0x42, 0xFF, 0x44, 0x24, 0xA4, 0x24, 0xFF, 0x00, 0xF5, 0x80, 0x0C,
+  0xF0, 0x42, 0x91, 0x11, 0xF5, 0x11, 0x1E, 0x11, 0x1F, 0x51, 0x11, 0x90,
+  0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x36, 0x33, 0xF8, 0xF8, 0x32, 0x71, 0x22, 0x51, 0x22, 0xFF, 0xF3,
+  0x25, 0x37, 0x22, 0x44, 0x52, 0x72, 0x72, 0x62, 0x72, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x6F, 0x30, 0x3C, 0x3F, 0x39, 0xD8, 0x60, 0x30, 0x38, 0x30,
+  0x1E, 0x03, 0x80, 0xC0, 0x78, 0x3E, 0x3B, 0xF8, 0xF8, 0x71, 0x81, 0x81,
+  0xF3, 0x18, 0x11, 0x16, 0x11, 0x1F, 0x11, 0x11, 0x61, 0x11, 0x94, 0x22,
+  0xA6, 0x22, 0xF5, 0x7F, 0x3F, 0x98, 0x0C, 0x0C, 0x06, 0xF3, 0xFD, 0x87,
+  0x01, 0x80, 0xC0, 0x78, 0x3E, 0x33, 0xF8, 0xF0, 0x1E, 0x1F, 0x98, 0xEC,
+  0x3C, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x33, 0xF8,
+  0x78, 0x09, 0x97, 0x11, 0x61, 0x71, 0x11, 0xE1, 0x11, 0xE1, 0x11, 0xF8,
+  0x11, 0x1F, 0xF1, 0x3E, 0x3F, 0xB8, 0xF8, 0x3C, 0x1F, 0x1D, 0xFC, 0xFE,
+  0xE3, 0xE0, 0xF0, 0x78, 0x3E, 0x3B, 0xF8, 0xF8, 0x3C, 0x3F, 0x98, 0xD8,
+  0x3C, 0x1E, 0x0F, 0x07, 0xC7, 0x7F, 0x9E, 0xC0, 0x78, 0x3E, 0x33, 0xF8,
+  0xF0, 0x04, 0xE4, 0xF0, 0x00, 0x3D, 0x60, 0x91, 0x64, 0x44, 0x34, 0x52,
+  0x94, 0x94, 0x84, 0x91, 0x0F, 0x5F, 0x5F, 0x50, 0x01, 0x94, 0x84, 0x94,
+  0x92, 0x54, 0x34, 0x44, 0x61, 0x90, 0x25, 0x37, 0x13, 0x35, 0x52, 0x72,
+  0x62, 0x63, 0x53, 0x53, 0x62, 0x72, 0xFA, 0x27, 0x24, 0x03, 0xF8, 0x03,
+  0xFF, 0x81, 0xE0, 0xF0, 0xE0, 0x0E, 0x71, 0xCD, 0x98, 0xFB, 0x36, 0x73,
+  0x8F, 0x18, 0x63, 0xCC, 0x18, 0xF3, 0x06, 0x3C, 0xC1, 0x1F, 0x30, 0xC6,
+  0xCE, 0x73, 0x19, 0xFF, 0x86, 0x3B, 0xCC, 0xC0, 0x06, 0x3C, 0x07, 0x03,
+  0xFF, 0x80, 0x3F, 0x80, 0x53, 0xF7, 0x11, 0x11, 0x1F, 0xF3, 0x11, 0x11,
+  0x11, 0x1F, 0xF1, 0x11, 0x13, 0x11, 0x16, 0x55, 0x19, 0x14, 0x7F, 0x11,
+  0x11, 0x71, 0x11, 0xD0, 0x07, 0xA1, 0x44, 0x21, 0x71, 0xF4, 0x15, 0x42,
+  0x1D, 0x51, 0x18, 0x11, 0x1F, 0xC1, 0x45, 0x21, 0x81, 0x10, 0x44, 0x68,
+  0x33, 0x43, 0x22, 0x66, 0x74, 0xA2, 0xA2, 0xA2, 0xA2, 0xA3, 0x72, 0x12,
+  0x63, 0x13, 0x43, 0x38, 0x64, 0x40, 0x08, 0xB1, 0x45, 0x21, 0x81, 0xB1,
+  0x11, 0xFF, 0xFF, 0xE1, 0x11, 0x71, 0x55, 0x21, 0x91, 0x20, 0x0A, 0xC8,
+  0xFF, 0x27, 0xD7, 0xFF, 0xD8, 0xA0, 0x09, 0xB7, 0xFE, 0x6C, 0x6F, 0xFF,
+  0xA0, 0x46, 0x79, 0x43, 0x53, 0x22, 0x82, 0x22, 0x91, 0x12, 0xC2, 0xC2,
+  0x59, 0x59, 0xA2, 0x12, 0x92, 0x12, 0x92, 0x23, 0x54, 0x3A, 0x66, 0x30,
+  0x02, 0x72, 0xFF, 0xFC, 0x7F, 0x07, 0xFF, 0xFF, 0x80, 0x0F, 0xF0, 0x52,
+  0xFF, 0xFF, 0x32, 0xE1, 0x41, 0x22, 0x11, 0x11, 0x31, 0x10, 0xC1, 0xD8,
+  0x73, 0x1C, 0x67, 0x0C, 0xC1, 0xB8, 0x3E, 0x07, 0xE0, 0xEC, 0x19, 0xC3,
+  0x1C, 0x61, 0xCC, 0x19, 0x83, 0xB0, 0x38, 0x02, 0xFF, 0xFF, 0xFF, 0xE6,
+  0x80, 0x03, 0x73, 0x31, 0x51, 0xFF, 0x11, 0x11, 0x31, 0x11, 0xFF, 0xE1,
+  0x11, 0x11, 0x11, 0xFF, 0xF1, 0x11, 0x11, 0x1F, 0xF0, 0x02, 0x72, 0x21,
+  0xB1, 0xF5, 0x11, 0x1F, 0x51, 0x11, 0xB1, 0x81, 0xB1, 0x11, 0xF5, 0x11,
+  0x1F, 0x51, 0xB1, 0x20, 0x46, 0x78, 0x53, 0x43, 0x32, 0x82, 0x13, 0x85,
+  0xA4, 0xA4, 0xA4, 0xA4, 0xA5, 0x83, 0x12, 0x82, 0x33, 0x43, 0x58, 0x76,
+  0x40, 0x08, 0xA1, 0x35, 0x21, 0x71, 0xFE, 0x14, 0x52, 0x18, 0x13, 0x6F,
+  0xFF, 0x70, 0x46, 0x79, 0x43, 0x43, 0x32, 0x82, 0x13, 0x85, 0xA4, 0xA4,
+  0xA4, 0xA4, 0xA5, 0x82, 0x22, 0x43, 0x12, 0x33, 0x43, 0x5A, 0x56, 0x13,
+  0xD1, 0x08, 0xB1, 0x45, 0x21, 0x81, 0xF6, 0x15, 0x52, 0x19, 0x14, 0x32,
+  0x18, 0x11, 0x1B, 0x18, 0x1D, 0x18, 0x1D, 0x10, 0x36, 0x48, 0x23, 0x43,
+  0x12, 0x62, 0x12, 0x93, 0x95, 0x85, 0x93, 0xA4, 0x74, 0x72, 0x13, 0x43,
+  0x19, 0x45, 0x30, 0x0C, 0xC5, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x02,
+  0x72, 0xFF, 0xFF, 0xFF, 0xFF, 0x11, 0x11, 0x51, 0x11, 0x35, 0x42, 0x52,
+  0x10, 0x12, 0x92, 0xF4, 0x17, 0x14, 0x1B, 0x1F, 0x31, 0x11, 0x51, 0x11,
+  0xFF, 0x51, 0x11, 0x31, 0x11, 0xF7, 0x11, 0x11, 0x11, 0x1F, 0xF9, 0x11,
+  0x11, 0x1F, 0x50, 0x02, 0x63, 0x62, 0xFB, 0x11, 0x11, 0x17, 0x11, 0x1D,
+  0x11, 0x1F, 0xC1, 0x11, 0xE1, 0x51, 0xFB, 0x11, 0x1B, 0x11, 0x16, 0x11,
+  0x13, 0x11, 0x1F, 0xFF, 0xF4, 0x11, 0x11, 0x15, 0x11, 0x11, 0x1F, 0x60,
+  0x70, 0x71, 0xC3, 0x06, 0x30, 0x3B, 0x80, 0xD8, 0x03, 0x80, 0x1C, 0x00,
+  0xE0, 0x0D, 0x80, 0x6C, 0x06, 0x70, 0x71, 0xC3, 0x06, 0x30, 0x3B, 0x80,
+  0xE0, 0x03, 0x83, 0x12, 0x82, 0x32, 0x62, 0x43, 0x43, 0x53, 0x23, 0x72,
+  0x22, 0x94, 0xA4, 0xB2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x60, 0x1A,
+  0x1A, 0x82, 0x82, 0x92, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x92, 0x82,
+  0x8F, 0x70, 0x04, 0x62, 0xFF, 0xFD, 0x24, 0x02, 0xA1, 0x11, 0xF7, 0x11,
+  0x1F, 0x11, 0x11, 0xF7, 0x11, 0x16, 0x04, 0x42, 0xFF, 0xFD, 0x26, 0x18,
+  0x3C, 0x3C, 0x3C, 0x66, 0x66, 0x66, 0xC3, 0x0F, 0x70, 0xCC, 0x80, 0x3E,
+  0x7F, 0xB0, 0xC0, 0x60, 0xF3, 0xFB, 0xCD, 0x86, 0xC7, 0x7F, 0x9E, 0x60,
+  0xC0, 0x60, 0x30, 0x18, 0x0D, 0xE7, 0xFB, 0x8D, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3E, 0x37, 0xFB, 0x78, 0x3C, 0x7E, 0x67, 0xC3, 0xC0, 0xC0, 0xC0,
+  0xC3, 0x67, 0x7E, 0x3C, 0x72, 0xFE, 0x44, 0x14, 0x15, 0x33, 0x11, 0x13,
+  0x1F, 0xF8, 0x11, 0x13, 0x15, 0x34, 0x14, 0x12, 0x25, 0x37, 0x22, 0x32,
+  0x12, 0x5F, 0x77, 0x28, 0x24, 0x21, 0x73, 0x52, 0x34, 0x21, 0x83, 0x72,
+  0x22, 0x82, 0x22, 0xFF, 0xFC, 0x3D, 0xBF, 0xD8, 0xF8, 0x3C, 0x1E, 0x0F,
+  0x07, 0x83, 0x63, 0xBF, 0xCF, 0x60, 0x3C, 0x3F, 0xF8, 0xF8, 0x02, 0xFF,
+  0x34, 0x31, 0x41, 0x33, 0x41, 0xFF, 0xFF, 0x10, 0x04, 0x4F, 0x70, 0x22,
+  0x62, 0x62, 0xFF, 0xF3, 0x25, 0x10, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3E,
+  0x3B, 0x39, 0xB8, 0xF8, 0x7E, 0x33, 0x19, 0xCC, 0x76, 0x1B, 0x0E, 0x02,
+  0x14, 0x24, 0x31, 0x51, 0x41, 0x33, 0x11, 0x13, 0x41, 0x51, 0xFF, 0xFF,
+  0xFF, 0xD0, 0x02, 0x14, 0x31, 0x41, 0x33, 0x41, 0xFF, 0xFF, 0x10, 0x3E,
+  0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0x63, 0x3F, 0x8F, 0x80,
+  0xDE, 0x7F, 0xB8, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xE3, 0x7F, 0xB7,
+  0x98, 0x0C, 0x06, 0x03, 0x00, 0x3D, 0xBF, 0xD8, 0xF8, 0x3C, 0x1E, 0x0F,
+  0x07, 0x83, 0x63, 0xBF, 0xCF, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x13,
+  0x21, 0x63, 0x21, 0xFF, 0xF0, 0x3C, 0xFE, 0xC3, 0xC0, 0xF0, 0x7E, 0x0F,
+  0x03, 0xC3, 0x7E, 0x3C, 0x62, 0xC1, 0x22, 0x51, 0x22, 0xFF, 0x32, 0x11,
+  0x30, 0x02, 0x42, 0xFF, 0xFF, 0x11, 0x43, 0x31, 0x41, 0x20, 0xC1, 0xE0,
+  0xD8, 0xCC, 0x66, 0x31, 0xB0, 0xD8, 0x6C, 0x1C, 0x0E, 0x02, 0x00, 0x60,
+  0x83, 0x30, 0xE1, 0x98, 0x70, 0xC6, 0x28, 0xC3, 0x36, 0x60, 0xDB, 0x60,
+  0x6D, 0xB0, 0x34, 0x58, 0x0E, 0x38, 0x07, 0x1C, 0x03, 0x8E, 0x00, 0xC1,
+  0xB1, 0x8D, 0x86, 0xC1, 0xC0, 0xE0, 0x70, 0x6C, 0x36, 0x31, 0xB0, 0x60,
+  0xC0, 0xF0, 0x36, 0x19, 0x86, 0x71, 0x8C, 0xC3, 0x30, 0x6C, 0x1E, 0x03,
+  0x80, 0xE0, 0x30, 0x1C, 0x1E, 0x07, 0x00, 0x18, 0x18, 0x63, 0x53, 0x53,
+  0x53, 0x53, 0x53, 0x53, 0x6F, 0x30, 0x33, 0x21, 0x72, 0xFA, 0x14, 0x12,
+  0x18, 0x16, 0x11, 0x1F, 0xF6, 0x22, 0x13, 0x0F, 0xF8, 0x03, 0x61, 0x22,
+  0xFF, 0x21, 0x31, 0x21, 0x81, 0x21, 0x41, 0xFF, 0x12, 0x71, 0x20, 0x70,
+  0x3F, 0x18, 0xFC, 0x0E };
+
+const RleGlyph arial10pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0, 0 },  // 0x20 ' '
+  {     1,   2,  15,   6,    2,  -14, 1 },  // 0x21 '!'
+  {     4,   5,   5,   7,    1,  -14, 2 },  // 0x22 '"'
+  {     7,  11,  15,  11,    0,  -14, 0 },  // 0x23 '#'
+  {    28,   9,  18,  11,    1,  -15, 0 },  // 0x24 '$'
+  {    49,  16,  15,  18,    1,  -14, 0 },  // 0x25 '%'
+  {    79,  12,  15,  13,    1,  -14, 0 },  // 0x26 '&'
+  {   102,   2,   5,   4,    1,  -14, 1 },  // 0x27 '''
+  {   103,   5,  19,   7,    1,  -14, 0 },  // 0x28 '('
+  {   115,   5,  19,   7,    1,  -14, 0 },  // 0x29 ')'
+  {   127,   7,   6,   8,    0,  -14, 0 },  // 0x2A '*'
+  {   133,  10,  10,  12,    1,  -11, 2 },  // 0x2B '+'
+  {   141,   2,   5,   6,    2,   -1, 0 },  // 0x2C ','
+  {   143,   6,   2,   7,    0,   -5, 1 },  // 0x2D '-'
+  {   144,   2,   2,   6,    2,   -1, 0 },  // 0x2E '.'
+  {   145,   6,  15,   6,    0,  -14, 2 },  // 0x2F '/'
+  {   156,   9,  15,  11,    1,  -14, 0 },  // 0x30 '0'
+  {   173,   5,  15,  11,    2,  -14, 2 },  // 0x31 '1'
+  {   180,   9,  15,  11,    1,  -14, 1 },  // 0x32 '2'
+  {   196,   9,  15,  11,    1,  -14, 0 },  // 0x33 '3'
+  {   213,  10,  15,  11,    0,  -14, 2 },  // 0x34 '4'
+  {   231,   9,  15,  11,    1,  -14, 0 },  // 0x35 '5'
+  {   248,   9,  15,  11,    1,  -14, 0 },  // 0x36 '6'
+  {   265,   9,  15,  11,    1,  -14, 2 },  // 0x37 '7'
+  {   279,   9,  15,  11,    1,  -14, 0 },  // 0x38 '8'
+  {   296,   9,  15,  11,    1,  -14, 0 },  // 0x39 '9'
+  {   313,   2,  11,   6,    2,  -10, 1 },  // 0x3A ':'
+  {   315,   2,  14,   6,    2,  -10, 0 },  // 0x3B ';'
+  {   319,  10,   9,  12,    1,  -11, 1 },  // 0x3C '<'
+  {   328,  10,   6,  12,    1,   -9, 1 },  // 0x3D '='
+  {   332,  10,   9,  12,    1,  -11, 1 },  // 0x3E '>'
+  {   342,   9,  15,  11,    1,  -14, 1 },  // 0x3F '?'
+  {   357,  18,  19,  20,    1,  -14, 0 },  // 0x40 '@'
+  {   400,  13,  15,  13,    0,  -14, 2 },  // 0x41 'A'
+  {   424,  10,  15,  13,    2,  -14, 2 },  // 0x42 'B'
+  {   442,  12,  15,  14,    1,  -14, 1 },  // 0x43 'C'
+  {   462,  11,  15,  14,    2,  -14, 2 },  // 0x44 'D'
+  {   478,  10,  15,  13,    2,  -14, 2 },  // 0x45 'E'
+  {   486,   9,  15,  12,    2,  -14, 2 },  // 0x46 'F'
+  {   493,  14,  15,  16,    1,  -14, 1 },  // 0x47 'G'
+  {   516,  11,  15,  13,    1,  -14, 2 },  // 0x48 'H'
+  {   525,   2,  15,   6,    2,  -14, 1 },  // 0x49 'I'
+  {   527,   7,  15,  10,    1,  -14, 2 },  // 0x4A 'J'
+  {   538,  11,  15,  13,    2,  -14, 0 },  // 0x4B 'K'
+  {   559,   8,  15,  11,    2,  -14, 2 },  // 0x4C 'L'
+  {   565,  13,  15,  17,    2,  -14, 2 },  // 0x4D 'M'
+  {   585,  11,  15,  13,    1,  -14, 2 },  // 0x4E 'N'
+  {   604,  14,  15,  16,    1,  -14, 1 },  // 0x4F 'O'
+  {   625,  10,  15,  13,    2,  -14, 2 },  // 0x50 'P'
+  {   638,  14,  16,  16,    1,  -14, 1 },  // 0x51 'Q'
+  {   661,  11,  15,  14,    2,  -14, 2 },  // 0x52 'R'
+  {   680,  11,  15,  13,    1,  -14, 1 },  // 0x53 'S'
+  {   699,  12,  15,  12,    0,  -14, 2 },  // 0x54 'T'
+  {   707,  11,  15,  13,    1,  -14, 2 },  // 0x55 'U'
+  {   721,  15,  15,  13,   -1,  -14, 2 },  // 0x56 'V'
+  {   747,  19,  15,  19,    0,  -14, 2 },  // 0x57 'W'
+  {   780,  13,  15,  13,    0,  -14, 0 },  // 0x58 'X'
+  {   805,  14,  15,  14,    0,  -14, 1 },  // 0x59 'Y'
+  {   827,  11,  15,  12,    0,  -14, 1 },  // 0x5A 'Z'
+  {   842,   4,  19,   6,    1,  -14, 2 },  // 0x5B '['
+  {   847,   6,  15,   6,    0,  -14, 2 },  // 0x5C
+  {   858,   4,  19,   6,    1,  -14, 2 },  // 0x5D ']'
+  {   863,   8,   8,   8,    0,  -14, 0 },  // 0x5E '^'
+  {   871,  11,   2,  11,    0,    3, 1 },  // 0x5F '_'
+  {   873,   3,   3,   7,    1,  -14, 0 },  // 0x60 '`'
+  {   875,   9,  11,  11,    1,  -10, 0 },  // 0x61 'a'
+  {   888,   9,  15,  11,    1,  -14, 0 },  // 0x62 'b'
+  {   905,   8,  11,  10,    1,  -10, 0 },  // 0x63 'c'
+  {   916,   9,  15,  11,    1,  -14, 2 },  // 0x64 'd'
+  {   932,   9,  11,  11,    1,  -10, 1 },  // 0x65 'e'
+  {   944,   7,  15,   6,    0,  -14, 2 },  // 0x66 'f'
+  {   953,   9,  15,  11,    1,  -10, 0 },  // 0x67 'g'
+  {   970,   8,  15,  10,    1,  -14, 2 },  // 0x68 'h'
+  {   980,   2,  15,   4,    1,  -14, 1 },  // 0x69 'i'
+  {   983,   4,  19,   4,   -1,  -14, 2 },  // 0x6A 'j'
+  {   990,   9,  15,  10,    1,  -14, 0 },  // 0x6B 'k'
+  {   525,   2,  15,   4,    1,  -14, 1 },  // 0x6C 'l'
+  {  1007,  14,  11,  16,    1,  -10, 2 },  // 0x6D 'm'
+  {  1022,   8,  11,  10,    1,  -10, 2 },  // 0x6E 'n'
+  {  1031,   9,  11,  11,    1,  -10, 0 },  // 0x6F 'o'
+  {  1044,   9,  15,  11,    1,  -10, 0 },  // 0x70 'p'
+  {  1061,   9,  15,  11,    1,  -10, 0 },  // 0x71 'q'
+  {  1078,   6,  11,   7,    1,  -10, 2 },  // 0x72 'r'
+  {  1085,   8,  11,  10,    1,  -10, 0 },  // 0x73 's'
+  {  1096,   5,  15,   6,    0,  -14, 2 },  // 0x74 't'
+  {  1105,   8,  11,  10,    1,  -10, 2 },  // 0x75 'u'
+  {  1114,   9,  11,   9,    0,  -10, 0 },  // 0x76 'v'
+  {  1127,  17,  11,  15,   -1,  -10, 0 },  // 0x77 'w'
+  {  1151,   9,  11,   9,    0,  -10, 0 },  // 0x78 'x'
+  {  1164,  10,  15,  10,    0,  -10, 0 },  // 0x79 'y'
+  {  1183,   9,  11,   9,    0,  -10, 1 },  // 0x7A 'z'
+  {  1194,   6,  19,   7,    0,  -14, 2 },  // 0x7B '{'
+  {  1207,   2,  19,   6,    2,  -14, 1 },  // 0x7C '|'
+  {  1209,   6,  19,   7,    1,  -14, 2 },  // 0x7D '}'
+  {  1223,  10,   4,  12,    1,   -8, 0 }   // 0x7E '~'
+};
+
+const RleFont arial10pt7bRle PROGMEM = {
+  arial10pt7bRleData,
+  arial10pt7bRleGlyphs,
+  0x20, 0x7E, 23 };
+
+#endif // ARIAL10PT7BRLE_H_
@@ -0,0 +1,228 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial11pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 1401 bytes of bitmap data (GFXfont: 1671)
+#ifndef ARIAL11PT7BRLE_H_
+#define ARIAL11PT7BRLE_H_
+
+const uint8_t arial11pt7bRleData[] PROGMEM = {
+  0x00, 0x0F, 0x94, 0x40, 0x02, 0x22, 0xFF, 0x00, 0x0C, 0x60, 0xC6, 0x0C,
+  0x61, 0x8C, 0xFF, 0xFF, 0xFF, 0x18, 0xC1, 0x8C, 0x31, 0x83, 0x18, 0xFF,
+  0xFF, 0xFF, 0x31, 0x86, 0x30, 0x63, 0x06, 0x30, 0x08, 0x0F, 0x87, 0xFB,
+  0xA7, 0xC8, 0xF2, 0x0E, 0x81, 0xE0, 0x3F, 0x03, 0xE0, 0x9C, 0x23, 0xC8,
+  0xF2, 0x36, 0x99, 0xFE, 0x3E, 0x02, 0x00, 0x80, 0x38, 0x06, 0x1B, 0x03,
+  0x0C, 0x60, 0xC3, 0x18, 0x60, 0xC6, 0x30, 0x31, 0x8C, 0x0C, 0x66, 0x01,
+  0xB1, 0x9C, 0x38, 0xCD, 0x80, 0x66, 0x30, 0x19, 0x8C, 0x0C, 0x63, 0x03,
+  0x18, 0xC1, 0x86, 0x30, 0xC0, 0xD8, 0x30, 0x1C, 0x0E, 0x00, 0xF8, 0x0C,
+  0x60, 0x63, 0x03, 0x18, 0x0D, 0x80, 0x7C, 0x03, 0x80, 0x76, 0x03, 0x19,
+  0xB0, 0x6D, 0x83, 0xCC, 0x0E, 0x30, 0xD1, 0xFE, 0x63, 0xC2, 0x0C, 0x08,
+  0x8C, 0x46, 0x33, 0x18, 0xC6, 0x31, 0x8C, 0x61, 0x8C, 0x21, 0x84, 0x10,
+  0x82, 0x18, 0x43, 0x18, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0xC6, 0x23, 0x11,
+  0x00, 0x18, 0x18, 0xFF, 0x3C, 0x3C, 0x66, 0x24, 0x42, 0xFF, 0x44, 0x24,
+  0xA4, 0x24, 0xFF, 0x00, 0xF5, 0x80, 0x0C, 0xF0, 0x06, 0x0C, 0x30, 0x60,
+  0xC3, 0x06, 0x0C, 0x30, 0x60, 0xC3, 0x06, 0x0C, 0x38, 0x60, 0x1E, 0x0F,
+  0xE6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0x61, 0x98, 0x63, 0xF0, 0x78, 0x42, 0x91, 0x32, 0x31, 0x21, 0x32,
+  0x31, 0xFF, 0xFE, 0x26, 0x38, 0x13, 0x45, 0x62, 0x82, 0x82, 0x82, 0x72,
+  0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x7F, 0x50, 0x25, 0x47, 0x23, 0x33,
+  0x12, 0x52, 0x82, 0x72, 0x63, 0x74, 0x92, 0x92, 0x82, 0x84, 0x65, 0x42,
+  0x28, 0x35, 0x30, 0x62, 0x71, 0x81, 0xF3, 0x11, 0x1F, 0x11, 0x11, 0x61,
+  0xB1, 0x61, 0x11, 0x94, 0x22, 0xA6, 0x22, 0xFF, 0x00, 0x27, 0x37, 0x22,
+  0x82, 0x82, 0x86, 0x39, 0x12, 0x52, 0x92, 0x82, 0x82, 0x84, 0x65, 0x42,
+  0x28, 0x35, 0x30, 0x0F, 0x83, 0xF8, 0xC3, 0x98, 0x36, 0x00, 0xC0, 0x19,
+  0xE3, 0xFE, 0x70, 0xEC, 0x0D, 0x81, 0xB0, 0x36, 0x06, 0x61, 0x8F, 0xF0,
+  0x78, 0x0F, 0x58, 0x18, 0x27, 0x27, 0x28, 0x27, 0x28, 0x27, 0x28, 0x28,
+  0x28, 0x18, 0x28, 0x28, 0x26, 0x1E, 0x0F, 0xC6, 0x19, 0x86, 0x61, 0x98,
+  0x63, 0xF0, 0xFC, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x67, 0xF8,
+  0x78, 0x1E, 0x1F, 0xC6, 0x1B, 0x02, 0xC0, 0xF0, 0x3C, 0x0F, 0x87, 0x7F,
+  0xCF, 0x30, 0x0C, 0x03, 0xC1, 0xB8, 0xE7, 0xF0, 0xF8, 0xF0, 0x00, 0x0F,
+  0xF0, 0x00, 0x0F, 0x58, 0xA1, 0x83, 0x55, 0x44, 0x54, 0x62, 0xA4, 0x94,
+  0x95, 0x93, 0xA1, 0x0F, 0x7F, 0xF3, 0xF7, 0x01, 0xA3, 0x95, 0x94, 0x94,
+  0xA2, 0x64, 0x54, 0x45, 0x53, 0x81, 0xA0, 0x26, 0x38, 0x13, 0x45, 0x62,
+  0x82, 0x73, 0x63, 0x63, 0x72, 0x72, 0x82, 0x82, 0xFD, 0x28, 0x24, 0x01,
+  0xF8, 0x00, 0x7F, 0xE0, 0x1E, 0x07, 0x81, 0x80, 0x18, 0x31, 0xCC, 0xC7,
+  0x7E, 0xCE, 0x6E, 0x38, 0x66, 0xC1, 0x86, 0xDC, 0x18, 0x6D, 0x81, 0x86,
+  0xD8, 0x18, 0x6D, 0x83, 0x0C, 0xD8, 0x31, 0xCD, 0xC7, 0x38, 0xEF, 0xFF,
+  0x06, 0x71, 0xC0, 0x70, 0x00, 0x33, 0x80, 0x0E, 0x1E, 0x03, 0xC0, 0xFF,
+  0xF8, 0x01, 0xFC, 0x00, 0x63, 0xC3, 0xB2, 0x12, 0xA2, 0x12, 0x93, 0x13,
+  0x82, 0x32, 0x82, 0x32, 0x72, 0x52, 0x62, 0x52, 0x5B, 0x4B, 0x42, 0x72,
+  0x32, 0x92, 0x22, 0x92, 0x12, 0xB4, 0xB2, 0x09, 0xC1, 0x46, 0x21, 0x91,
+  0xFF, 0x51, 0x11, 0x36, 0xF3, 0x71, 0x1A, 0x11, 0x1F, 0xF3, 0x14, 0x72,
+  0x19, 0x21, 0x55, 0x79, 0x43, 0x53, 0x22, 0x82, 0x22, 0x94, 0xC2, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xD2, 0x92, 0x12, 0x82, 0x33, 0x53, 0x49, 0x66, 0x40,
+  0x09, 0xD2, 0x47, 0x21, 0xA1, 0xF0, 0x1A, 0x1F, 0xFF, 0xFF, 0x21, 0x11,
+  0xF6, 0x21, 0x13, 0x6E, 0x22, 0x0C, 0xEA, 0xFF, 0xF5, 0x9F, 0x09, 0xFF,
+  0xF6, 0xAC, 0x0A, 0xC8, 0xFF, 0xC7, 0xD7, 0xFF, 0xFF, 0x10, 0x56, 0x7A,
+  0x43, 0x63, 0x23, 0x82, 0x22, 0xA4, 0xD2, 0xD2, 0xD2, 0x69, 0x69, 0xB2,
+  0x12, 0xA2, 0x13, 0x92, 0x23, 0x64, 0x3B, 0x66, 0x40, 0x02, 0x82, 0xFF,
+  0xFF, 0xE8, 0xF1, 0x8F, 0xFF, 0xFE, 0x0F, 0xF2, 0x62, 0xFF, 0xFF, 0xF5,
+  0x2F, 0x11, 0x21, 0x21, 0x22, 0x21, 0x11, 0x41, 0x10, 0xC0, 0x76, 0x07,
+  0x30, 0x71, 0x87, 0x0C, 0x70, 0x67, 0x03, 0x70, 0x1F, 0x80, 0xFE, 0x07,
+  0x38, 0x30, 0xE1, 0x83, 0x8C, 0x0C, 0x60, 0x73, 0x01, 0xD8, 0x07, 0x02,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x67, 0x90, 0x03, 0x93, 0x31, 0x71, 0xFF, 0x51,
+  0x11, 0x51, 0x11, 0xFF, 0x51, 0x11, 0x31, 0x11, 0xFF, 0x71, 0x11, 0x11,
+  0x11, 0xFF, 0x91, 0x11, 0x11, 0xFF, 0x50, 0x02, 0x82, 0x21, 0xC1, 0xF7,
+  0x11, 0x1F, 0x71, 0x11, 0xA1, 0x11, 0xF7, 0x11, 0x1A, 0x11, 0x1F, 0x71,
+  0x11, 0xF7, 0x1C, 0x12, 0x55, 0x89, 0x53, 0x53, 0x33, 0x73, 0x22, 0x92,
+  0x12, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB2, 0x12, 0x92, 0x23, 0x73, 0x33,
+  0x53, 0x59, 0x85, 0x50, 0x09, 0xC2, 0x37, 0xC1, 0x11, 0xFF, 0xF0, 0x11,
+  0x12, 0x7C, 0x23, 0x7F, 0xFF, 0xF3, 0x55, 0x89, 0x53, 0x53, 0x33, 0x73,
+  0x22, 0x92, 0x12, 0xB4, 0xB4, 0xB4, 0xB4, 0xB4, 0xB2, 0x12, 0x92, 0x23,
+  0x43, 0x12, 0x33, 0x53, 0x5A, 0x76, 0x13, 0xE1, 0x0A, 0xD1, 0x47, 0x21,
+  0xA1, 0xFF, 0x81, 0x57, 0x21, 0xB1, 0x44, 0x22, 0x91, 0x11, 0xD1, 0xA1,
+  0x21, 0xA1, 0xF0, 0x1A, 0x13, 0x46, 0x59, 0x33, 0x53, 0x22, 0x82, 0x12,
+  0x82, 0x13, 0xB4, 0xA7, 0x96, 0xB5, 0x94, 0x92, 0x12, 0x82, 0x13, 0x53,
+  0x3A, 0x56, 0x30, 0x0C, 0xC5, 0x25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60,
+  0x02, 0x82, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x61, 0x21, 0x21, 0x41, 0x21,
+  0x11, 0x24, 0x21, 0x31, 0x61, 0x20, 0x02, 0xB2, 0x21, 0x91, 0x21, 0xD1,
+  0xF1, 0x11, 0x17, 0x11, 0x1F, 0x51, 0x51, 0x61, 0x91, 0xF5, 0x11, 0x13,
+  0x11, 0x1F, 0xF7, 0x11, 0x11, 0x11, 0x1F, 0xB1, 0xC1, 0x31, 0x50, 0x02,
+  0x73, 0x72, 0xF6, 0x11, 0x15, 0x11, 0x11, 0x15, 0x11, 0x1F, 0xFF, 0xF4,
+  0x11, 0x13, 0x11, 0x11, 0x11, 0x13, 0x11, 0x1F, 0xFF, 0xF6, 0x11, 0x11,
+  0x11, 0x13, 0x11, 0x11, 0x11, 0x1F, 0xFF, 0xF8, 0x11, 0x11, 0x15, 0x11,
+  0x11, 0x1F, 0x90, 0x13, 0x73, 0x33, 0x53, 0x52, 0x52, 0x72, 0x32, 0x83,
+  0x13, 0x92, 0x12, 0xB3, 0xC3, 0xC3, 0xB2, 0x12, 0x92, 0x32, 0x73, 0x33,
+  0x62, 0x52, 0x52, 0x72, 0x33, 0x73, 0x13, 0x93, 0x03, 0x83, 0x12, 0x82,
+  0x32, 0x62, 0x43, 0x43, 0x52, 0x42, 0x72, 0x22, 0x86, 0x94, 0xB2, 0xC2,
+  0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0xC2, 0x60, 0x1B, 0x1B, 0x92, 0x92, 0xA2,
+  0x92, 0x92, 0x92, 0xA2, 0x92, 0x92, 0x92, 0xA2, 0x92, 0x9F, 0x90, 0x04,
+  0x62, 0xFF, 0xFF, 0x22, 0x40, 0xC1, 0x81, 0x83, 0x06, 0x06, 0x0C, 0x18,
+  0x18, 0x30, 0x60, 0x60, 0xC1, 0x83, 0x83, 0x04, 0x42, 0xFF, 0xFF, 0x22,
+  0x60, 0x0C, 0x07, 0x81, 0xE0, 0xCC, 0x33, 0x0C, 0xC6, 0x19, 0x86, 0xC0,
+  0xC0, 0x0F, 0x90, 0xCC, 0x80, 0x3E, 0x1F, 0xCC, 0x1B, 0x06, 0x07, 0x9F,
+  0xE7, 0x9B, 0x06, 0xC1, 0xB0, 0xE7, 0xF9, 0xF3, 0x02, 0xFF, 0xB4, 0x51,
+  0x42, 0x44, 0x51, 0x41, 0x11, 0xFF, 0xF7, 0x14, 0x11, 0x13, 0x45, 0x14,
+  0x21, 0x1E, 0x3F, 0x98, 0xF8, 0x3C, 0x06, 0x03, 0x01, 0x80, 0xC1, 0xB1,
+  0xDF, 0xC3, 0xC0, 0x82, 0xFF, 0x34, 0x42, 0x41, 0x54, 0x31, 0x11, 0x41,
+  0xFF, 0xF9, 0x14, 0x12, 0x12, 0x44, 0x24, 0x12, 0x34, 0x48, 0x22, 0x42,
+  0x12, 0x6F, 0x98, 0x28, 0x35, 0x21, 0x33, 0x23, 0x74, 0x43, 0x34, 0x21,
+  0x83, 0x72, 0x22, 0x82, 0x22, 0xFF, 0xFF, 0x40, 0x1E, 0xDF, 0xF6, 0x1F,
+  0x83, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC1, 0xD8, 0x77, 0xFC, 0x7B, 0x00,
+  0xF0, 0x6F, 0xF8, 0xF8, 0x02, 0xFF, 0x74, 0x41, 0x41, 0x43, 0x21, 0x21,
+  0x31, 0xFF, 0xFF, 0xE0, 0x04, 0x4F, 0x90, 0x22, 0x62, 0x62, 0xFF, 0xF7,
+  0x25, 0x10, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3E, 0x3B, 0x39, 0xB8, 0xF8,
+  0x7E, 0x3B, 0x19, 0xCC, 0x66, 0x3B, 0x0D, 0x87, 0x02, 0x14, 0x34, 0x41,
+  0x41, 0x11, 0x41, 0x43, 0x21, 0x13, 0x21, 0x21, 0x31, 0x21, 0x31, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xA0, 0x02, 0x14, 0x41, 0x41, 0x43, 0x21, 0x21, 0x31,
+  0xFF, 0xFF, 0xE0, 0x35, 0x57, 0x33, 0x33, 0x13, 0x55, 0x74, 0x74, 0x74,
+  0x75, 0x53, 0x13, 0x33, 0x37, 0x55, 0x30, 0x02, 0x14, 0x51, 0x42, 0x44,
+  0x51, 0x41, 0x11, 0xFF, 0xF7, 0x14, 0x11, 0x13, 0x41, 0x13, 0x14, 0x15,
+  0x4F, 0xF3, 0x44, 0x12, 0x22, 0x41, 0x64, 0x41, 0x11, 0x41, 0xFF, 0xFD,
+  0x11, 0x14, 0x16, 0x45, 0x24, 0x16, 0x4F, 0xF6, 0x02, 0x13, 0x21, 0x63,
+  0x21, 0xFF, 0xF6, 0x25, 0x37, 0x12, 0x54, 0x74, 0x66, 0x56, 0x63, 0x74,
+  0x43, 0x17, 0x35, 0x20, 0x23, 0x18, 0xCF, 0xFD, 0x8C, 0x63, 0x18, 0xC6,
+  0x31, 0xE7, 0x02, 0x52, 0xFF, 0xFF, 0xE1, 0x31, 0x21, 0x23, 0x41, 0x41,
+  0x20, 0xC0, 0x78, 0x0D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x0C, 0x60, 0xD8,
+  0x1B, 0x01, 0xC0, 0x38, 0x02, 0x00, 0x60, 0x83, 0x30, 0xE1, 0x98, 0x70,
+  0xC6, 0x28, 0xC3, 0x36, 0x60, 0x9B, 0x20, 0x6D, 0xB0, 0x36, 0xD8, 0x0A,
+  0x28, 0x07, 0x1C, 0x03, 0x8E, 0x00, 0xC6, 0x00, 0xE1, 0xD8, 0x63, 0x30,
+  0xCC, 0x1E, 0x03, 0x00, 0xC0, 0x78, 0x33, 0x0C, 0xC6, 0x1B, 0x87, 0xC0,
+  0x78, 0x0D, 0x83, 0x30, 0x63, 0x0C, 0x63, 0x06, 0x60, 0xCC, 0x0F, 0x01,
+  0xE0, 0x1C, 0x03, 0x00, 0xE0, 0x18, 0x1F, 0x03, 0xC0, 0x19, 0x19, 0x73,
+  0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x7F, 0x50, 0x33, 0x21, 0x72,
+  0xFF, 0x11, 0x11, 0x21, 0xB1, 0x61, 0x11, 0xFF, 0x62, 0x21, 0x30, 0x0F,
+  0xFC, 0x03, 0x61, 0x22, 0xFF, 0x81, 0x31, 0x21, 0x81, 0x21, 0x41, 0xFF,
+  0x12, 0x71, 0x20, 0x78, 0x1F, 0xC6, 0x3F, 0x81, 0xE0 };
+
+const RleGlyph arial11pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   6,    0,    0, 0 },  // 0x20 ' '
+  {     1,   2,  16,   6,    2,  -15, 1 },  // 0x21 '!'
+  {     4,   6,   6,   8,    1,  -15, 2 },  // 0x22 '"'
+  {     8,  12,  16,  12,    0,  -15, 0 },  // 0x23 '#'
+  {    32,  10,  19,  12,    1,  -16, 0 },  // 0x24 '$'
+  {    56,  18,  16,  20,    1,  -15, 0 },  // 0x25 '%'
+  {    92,  13,  16,  15,    1,  -15, 0 },  // 0x26 '&'
+  {   118,   2,   6,   4,    1,  -15, 1 },  // 0x27 '''
+  {   119,   5,  20,   7,    1,  -15, 0 },  // 0x28 '('
+  {   132,   5,  20,   7,    1,  -15, 0 },  // 0x29 ')'
+  {   145,   8,   7,   9,    1,  -15, 0 },  // 0x2A '*'
+  {   152,  10,  10,  13,    1,  -12, 2 },  // 0x2B '+'
+  {   160,   2,   5,   6,    2,   -1, 0 },  // 0x2C ','
+  {   162,   6,   2,   7,    0,   -6, 1 },  // 0x2D '-'
+  {   163,   2,   2,   6,    2,   -1, 0 },  // 0x2E '.'
+  {   164,   7,  16,   6,    0,  -15, 0 },  // 0x2F '/'
+  {   178,  10,  16,  12,    1,  -15, 0 },  // 0x30 '0'
+  {   198,   6,  16,  12,    2,  -15, 2 },  // 0x31 '1'
+  {   207,  10,  16,  12,    1,  -15, 1 },  // 0x32 '2'
+  {   224,  10,  16,  12,    1,  -15, 1 },  // 0x33 '3'
+  {   243,  10,  16,  12,    1,  -15, 2 },  // 0x34 '4'
+  {   261,  10,  16,  12,    1,  -15, 1 },  // 0x35 '5'
+  {   279,  11,  16,  12,    0,  -15, 0 },  // 0x36 '6'
+  {   301,  10,  16,  12,    1,  -15, 1 },  // 0x37 '7'
+  {   317,  10,  16,  12,    1,  -15, 0 },  // 0x38 '8'
+  {   337,  10,  16,  12,    1,  -15, 0 },  // 0x39 '9'
+  {   357,   2,  12,   6,    2,  -11, 0 },  // 0x3A ':'
+  {   360,   2,  15,   6,    2,  -11, 0 },  // 0x3B ';'
+  {   364,  11,  11,  13,    1,  -12, 1 },  // 0x3C '<'
+  {   375,  11,   7,  13,    1,  -10, 1 },  // 0x3D '='
+  {   379,  11,  11,  13,    1,  -12, 1 },  // 0x3E '>'
+  {   391,  10,  16,  12,    1,  -15, 1 },  // 0x3F '?'
+  {   407,  20,  21,  22,    1,  -15, 0 },  // 0x40 '@'
+  {   460,  15,  16,  15,    0,  -15, 1 },  // 0x41 'A'
+  {   487,  12,  16,  15,    2,  -15, 2 },  // 0x42 'B'
+  {   506,  14,  16,  16,    1,  -15, 1 },  // 0x43 'C'
+  {   528,  13,  16,  16,    2,  -15, 2 },  // 0x44 'D'
+  {   545,  12,  16,  15,    2,  -15, 2 },  // 0x45 'E'
+  {   554,  10,  16,  13,    2,  -15, 2 },  // 0x46 'F'
+  {   562,  15,  16,  17,    1,  -15, 1 },  // 0x47 'G'
+  {   585,  12,  16,  16,    2,  -15, 2 },  // 0x48 'H'
+  {   594,   2,  16,   6,    2,  -15, 1 },  // 0x49 'I'
+  {   596,   8,  16,  11,    1,  -15, 2 },  // 0x4A 'J'
+  {   609,  13,  16,  15,    2,  -15, 0 },  // 0x4B 'K'
+  {   635,   9,  16,  12,    2,  -15, 2 },  // 0x4C 'L'
+  {   642,  15,  16,  19,    2,  -15, 2 },  // 0x4D 'M'
+  {   667,  12,  16,  16,    2,  -15, 2 },  // 0x4E 'N'
+  {   688,  15,  16,  17,    1,  -15, 1 },  // 0x4F 'O'
+  {   712,  12,  16,  15,    2,  -15, 2 },  // 0x50 'P'
+  {   726,  15,  17,  17,    1,  -15, 1 },  // 0x51 'Q'
+  {   752,  13,  16,  16,    2,  -15, 2 },  // 0x52 'R'
+  {   773,  13,  16,  15,    1,  -15, 1 },  // 0x53 'S'
+  {   795,  12,  16,  14,    1,  -15, 2 },  // 0x54 'T'
+  {   804,  12,  16,  16,    2,  -15, 2 },  // 0x55 'U'
+  {   822,  15,  16,  15,    0,  -15, 2 },  // 0x56 'V'
+  {   851,  21,  16,  21,    0,  -15, 2 },  // 0x57 'W'
+  {   891,  15,  16,  15,    0,  -15, 1 },  // 0x58 'X'
+  {   920,  14,  16,  14,    0,  -15, 1 },  // 0x59 'Y'
+  {   943,  12,  16,  13,    0,  -15, 1 },  // 0x5A 'Z'
+  {   959,   4,  20,   6,    1,  -15, 2 },  // 0x5B '['
+  {   965,   7,  16,   6,    0,  -15, 0 },  // 0x5C
+  {   979,   4,  20,   6,    1,  -15, 2 },  // 0x5D ']'
+  {   985,  10,   9,  11,    0,  -15, 0 },  // 0x5E '^'
+  {   997,  12,   2,  12,    0,    3, 1 },  // 0x5F '_'
+  {   999,   3,   3,   7,    1,  -15, 0 },  // 0x60 '`'
+  {  1001,  10,  12,  12,    1,  -11, 0 },  // 0x61 'a'
+  {  1016,  10,  16,  12,    1,  -15, 2 },  // 0x62 'b'
+  {  1033,   9,  12,  11,    1,  -11, 0 },  // 0x63 'c'
+  {  1047,  10,  16,  12,    1,  -15, 2 },  // 0x64 'd'
+  {  1064,  10,  12,  12,    1,  -11, 1 },  // 0x65 'e'
+  {  1078,   7,  16,   7,    0,  -15, 2 },  // 0x66 'f'
+  {  1088,  10,  16,  12,    1,  -11, 0 },  // 0x67 'g'
+  {  1108,   9,  16,  11,    1,  -15, 2 },  // 0x68 'h'
+  {  1120,   2,  16,   5,    1,  -15, 1 },  // 0x69 'i'
+  {  1123,   4,  20,   4,   -1,  -15, 2 },  // 0x6A 'j'
+  {  1130,   9,  16,  10,    1,  -15, 0 },  // 0x6B 'k'
+  {   594,   2,  16,   4,    1,  -15, 1 },  // 0x6C 'l'
+  {  1148,  16,  12,  18,    1,  -11, 2 },  // 0x6D 'm'
+  {  1168,   9,  12,  11,    1,  -11, 2 },  // 0x6E 'n'
+  {  1179,  11,  12,  13,    1,  -11, 1 },  // 0x6F 'o'
+  {  1195,  10,  16,  12,    1,  -11, 2 },  // 0x70 'p'
+  {  1214,  11,  16,  12,    0,  -11, 2 },  // 0x71 'q'
+  {  1232,   6,  12,   7,    1,  -11, 2 },  // 0x72 'r'
+  {  1239,   9,  12,  11,    1,  -11, 1 },  // 0x73 's'
+  {  1252,   5,  16,   6,    0,  -15, 0 },  // 0x74 't'
+  {  1262,   9,  12,  11,    1,  -11, 2 },  // 0x75 'u'
+  {  1273,  11,  12,  11,    0,  -11, 0 },  // 0x76 'v'
+  {  1290,  17,  12,  15,   -1,  -11, 0 },  // 0x77 'w'
+  {  1316,  10,  12,  10,    0,  -11, 0 },  // 0x78 'x'
+  {  1331,  11,  16,  11,    0,  -11, 0 },  // 0x79 'y'
+  {  1353,  10,  12,  11,    0,  -11, 1 },  // 0x7A 'z'
+  {  1365,   6,  20,   7,    0,  -15, 2 },  // 0x7B '{'
+  {  1379,   2,  21,   6,    2,  -15, 1 },  // 0x7C '|'
+  {  1381,   6,  20,   7,    1,  -15, 2 },  // 0x7D '}'
+  {  1395,  11,   4,  13,    1,   -9, 0 }   // 0x7E '~'
+};
+
+const RleFont arial11pt7bRle PROGMEM = {
+  arial11pt7bRleData,
+  arial11pt7bRleGlyphs,
+  0x20, 0x7E, 25 };
+
+#endif // ARIAL11PT7BRLE_H_
@@ -0,0 +1,242 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial12pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 1564 bytes of bitmap data (GFXfont: 1945)
+#ifndef ARIAL12PT7BRLE_H_
+#define ARIAL12PT7BRLE_H_
+
+const uint8_t arial12pt7bRleData[] PROGMEM = {
+  0x00, 0x0F, 0xB4, 0x40, 0x02, 0x22, 0xFF, 0x00, 0x52, 0x32, 0xF3, 0x11,
+  0x12, 0x11, 0x1F, 0xC4, 0x23, 0x22, 0xD3, 0x23, 0x23, 0xFF, 0x93, 0x23,
+  0x23, 0xD2, 0x23, 0x24, 0xE1, 0x11, 0x21, 0x11, 0xF2, 0x04, 0x03, 0xE1,
+  0xFF, 0x72, 0x7C, 0x47, 0x88, 0x31, 0x03, 0xA0, 0x3E, 0x01, 0xF0, 0x17,
+  0x02, 0x30, 0x47, 0x88, 0xF9, 0x1B, 0xA6, 0x7F, 0xC3, 0xE0, 0x10, 0x02,
+  0x00, 0x3C, 0x06, 0x0C, 0xC1, 0xC3, 0x0C, 0x30, 0x61, 0x8C, 0x0C, 0x31,
+  0x81, 0x86, 0x60, 0x30, 0xCC, 0x03, 0x33, 0x00, 0x3C, 0x67, 0x80, 0x19,
+  0x98, 0x07, 0x61, 0x80, 0xCC, 0x30, 0x39, 0x86, 0x06, 0x30, 0xC1, 0xC6,
+  0x18, 0x30, 0x66, 0x0C, 0x07, 0x80, 0x0F, 0x00, 0x7E, 0x03, 0x9C, 0x0C,
+  0x30, 0x30, 0xC0, 0x66, 0x01, 0xF8, 0x07, 0x80, 0x3F, 0x01, 0xCC, 0x4E,
+  0x19, 0xB0, 0x3C, 0xC0, 0xF3, 0x81, 0xC6, 0x1F, 0x9F, 0xF7, 0x1F, 0x18,
+  0x0C, 0x0C, 0x63, 0x0C, 0x61, 0x86, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+  0x18, 0x61, 0x83, 0x0C, 0x18, 0x30, 0xC1, 0x83, 0x0C, 0x18, 0x61, 0x83,
+  0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC6, 0x18, 0x63, 0x0C, 0x63, 0x00, 0x18,
+  0x18, 0xFF, 0x3C, 0x3C, 0x66, 0x24, 0x52, 0xFF, 0xF8, 0x52, 0x5C, 0x52,
+  0x5F, 0xFF, 0x30, 0xF5, 0xE0, 0x0E, 0xF0, 0x52, 0xB1, 0x11, 0xF2, 0x11,
+  0x1F, 0x21, 0x81, 0xF2, 0x11, 0x1F, 0x21, 0x11, 0xB0, 0x35, 0x57, 0x33,
+  0x33, 0x22, 0x52, 0x12, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74,
+  0x72, 0x12, 0x52, 0x23, 0x33, 0x28, 0x55, 0x30, 0x42, 0x91, 0x32, 0x31,
+  0x21, 0x41, 0x32, 0xFF, 0xFF, 0x40, 0x35, 0x49, 0x22, 0x52, 0x12, 0x74,
+  0x72, 0x92, 0x92, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x8F,
+  0x70, 0x34, 0x58, 0x23, 0x43, 0x12, 0x62, 0x92, 0x92, 0x82, 0x64, 0x75,
+  0xA2, 0xA2, 0x94, 0x75, 0x62, 0x12, 0x52, 0x37, 0x55, 0x30, 0x72, 0x81,
+  0x91, 0xF5, 0x11, 0x17, 0x1C, 0x17, 0x11, 0x1F, 0x31, 0x11, 0x71, 0xD4,
+  0x22, 0xB7, 0x22, 0xFF, 0x30, 0x28, 0x38, 0x22, 0x92, 0x92, 0x92, 0x14,
+  0x48, 0x23, 0x52, 0x12, 0x72, 0x92, 0x92, 0x94, 0x74, 0x62, 0x22, 0x52,
+  0x28, 0x55, 0x30, 0x0F, 0x87, 0xF9, 0xC3, 0xB0, 0x36, 0x01, 0x80, 0x33,
+  0xC6, 0xFE, 0xF0, 0xDC, 0x0F, 0x01, 0xE0, 0x3C, 0x06, 0xC0, 0xDC, 0x31,
+  0xFC, 0x1F, 0x00, 0x0F, 0x79, 0x19, 0x28, 0x29, 0x19, 0x28, 0x29, 0x29,
+  0x28, 0x29, 0x29, 0x28, 0x29, 0x29, 0x29, 0x26, 0x1F, 0x07, 0xF1, 0xC7,
+  0x30, 0x66, 0x0C, 0xC1, 0x8C, 0x60, 0xF8, 0x3F, 0x8C, 0x1B, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xD8, 0x33, 0xFE, 0x1F, 0x00, 0x1F, 0x07, 0xF1, 0x83,
+  0x70, 0x6C, 0x07, 0x80, 0xF0, 0x1E, 0x07, 0x61, 0xEF, 0xEC, 0x79, 0x80,
+  0x30, 0x0D, 0x81, 0xB8, 0x73, 0xFC, 0x3E, 0x00, 0x04, 0xF3, 0x40, 0xF0,
+  0x00, 0x03, 0xD7, 0x80, 0xA1, 0x83, 0x55, 0x44, 0x54, 0x62, 0xA4, 0x94,
+  0xA4, 0x93, 0xA1, 0x0F, 0x7F, 0xF3, 0xF7, 0x01, 0xA3, 0x94, 0xA4, 0x94,
+  0xA2, 0x64, 0x54, 0x45, 0x53, 0x81, 0xA0, 0x35, 0x58, 0x23, 0x33, 0x13,
+  0x64, 0x72, 0x92, 0x82, 0x83, 0x73, 0x72, 0x83, 0x82, 0x92, 0xFF, 0x12,
+  0x92, 0x50, 0x00, 0xFE, 0x00, 0x1F, 0xFE, 0x00, 0xF0, 0x3C, 0x07, 0x00,
+  0x38, 0x38, 0xF3, 0x70, 0xC7, 0xEC, 0xC6, 0x38, 0xF1, 0x99, 0x81, 0x86,
+  0xC6, 0x06, 0x1B, 0x30, 0x18, 0x6C, 0xC0, 0x61, 0xB3, 0x01, 0x8E, 0xCC,
+  0x0C, 0x33, 0x30, 0x71, 0xCC, 0x63, 0xCE, 0x19, 0xFF, 0xF0, 0x61, 0xC7,
+  0x00, 0xC0, 0x00, 0x33, 0xC0, 0x03, 0x87, 0xC0, 0x3C, 0x07, 0xFF, 0xC0,
+  0x03, 0xFC, 0x00, 0x63, 0xC3, 0xB2, 0x12, 0xA2, 0x12, 0x93, 0x13, 0x82,
+  0x32, 0x82, 0x32, 0x72, 0x52, 0x62, 0x52, 0x62, 0x52, 0x5B, 0x4B, 0x33,
+  0x73, 0x22, 0x92, 0x22, 0x92, 0x12, 0xB4, 0xB2, 0x09, 0xD2, 0x47, 0x21,
+  0xA1, 0xFF, 0x81, 0x11, 0x37, 0xF4, 0x72, 0x1A, 0x12, 0x1A, 0x1F, 0xF8,
+  0x11, 0x12, 0x8D, 0x21, 0x56, 0x7A, 0x43, 0x63, 0x23, 0x82, 0x22, 0xA5,
+  0xC2, 0xD2, 0xD2, 0xD2, 0xD2, 0xD2, 0xB2, 0x12, 0xA2, 0x13, 0x82, 0x33,
+  0x63, 0x4A, 0x76, 0x40, 0x0A, 0xE1, 0x57, 0x21, 0xB1, 0x21, 0xB1, 0xE1,
+  0x11, 0xFF, 0xFF, 0xFF, 0x51, 0x11, 0xA1, 0xC1, 0x21, 0x37, 0x21, 0xB2,
+  0x30, 0x0D, 0xF0, 0xBF, 0xFF, 0x9A, 0xF1, 0xAF, 0xFF, 0xF8, 0xBD, 0x0C,
+  0xEA, 0xFF, 0xF5, 0x9F, 0x09, 0xFF, 0xFF, 0xFA, 0x57, 0x7B, 0x44, 0x54,
+  0x23, 0x92, 0x22, 0xB5, 0xD2, 0xE2, 0xE2, 0x79, 0x79, 0xC5, 0xB2, 0x12,
+  0xB2, 0x13, 0xA2, 0x24, 0x55, 0x3B, 0x86, 0x40, 0x02, 0x92, 0xFF, 0xFF,
+  0xF5, 0x9F, 0x29, 0xFF, 0xFF, 0xFF, 0x30, 0x0F, 0xF4, 0x72, 0xFF, 0xFF,
+  0xFF, 0x92, 0xF3, 0x13, 0x12, 0x12, 0x32, 0x11, 0x15, 0x11, 0xC0, 0x3B,
+  0x01, 0xCC, 0x0E, 0x30, 0x70, 0xC3, 0x83, 0x1C, 0x0C, 0xE0, 0x37, 0x80,
+  0xFF, 0x03, 0xDC, 0x0E, 0x38, 0x30, 0x70, 0xC0, 0xE3, 0x03, 0x8C, 0x07,
+  0x30, 0x0E, 0xC0, 0x1C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xA0,
+  0x03, 0x93, 0x31, 0x71, 0xFF, 0x51, 0x11, 0x51, 0x11, 0xFF, 0x51, 0x71,
+  0x81, 0x31, 0xFF, 0x91, 0x11, 0x11, 0x11, 0xFF, 0x91, 0x31, 0xC1, 0xF7,
+  0x02, 0x92, 0x21, 0xD1, 0xF9, 0x11, 0x1B, 0x11, 0x1F, 0x91, 0x11, 0xD1,
+  0xA1, 0xD1, 0x11, 0xF9, 0x11, 0x1B, 0x11, 0x1F, 0x91, 0xD1, 0x20, 0x57,
+  0x8B, 0x54, 0x54, 0x33, 0x93, 0x22, 0xB2, 0x13, 0xB5, 0xD4, 0xD4, 0xD4,
+  0xD4, 0xD5, 0xB3, 0x12, 0xB2, 0x23, 0x93, 0x34, 0x54, 0x5B, 0x87, 0x50,
+  0x0A, 0xD2, 0x38, 0xD1, 0x11, 0xFF, 0xF4, 0x11, 0x12, 0x8D, 0x23, 0x8F,
+  0xFF, 0xFF, 0x60, 0x57, 0x8B, 0x54, 0x54, 0x33, 0x93, 0x22, 0xB2, 0x13,
+  0xB5, 0xD4, 0xD4, 0xD4, 0xD4, 0xD5, 0xB3, 0x12, 0x62, 0x32, 0x23, 0x57,
+  0x34, 0x54, 0x5D, 0x76, 0x14, 0xF0, 0x20, 0x0B, 0xE1, 0x48, 0x21, 0xB1,
+  0xFF, 0xB1, 0x58, 0x21, 0xB2, 0x44, 0x31, 0xA1, 0x21, 0xB1, 0x21, 0xFA,
+  0x12, 0x1B, 0x1F, 0x11, 0xB1, 0x21, 0x46, 0x6A, 0x42, 0x63, 0x22, 0x83,
+  0x12, 0x92, 0x12, 0xD3, 0xB8, 0x88, 0xB4, 0xC5, 0xA4, 0xA2, 0x12, 0x83,
+  0x14, 0x53, 0x3A, 0x66, 0x40, 0x0E, 0xE6, 0x26, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF1, 0x02, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0x71,
+  0x21, 0x21, 0x51, 0x21, 0x11, 0x25, 0x21, 0x31, 0x71, 0x20, 0x02, 0xB3,
+  0x11, 0x91, 0x11, 0xFF, 0x11, 0x11, 0x71, 0x11, 0xF5, 0x15, 0x16, 0x19,
+  0x1F, 0x51, 0x11, 0x31, 0x11, 0xFF, 0x71, 0x11, 0x11, 0x11, 0xFB, 0x1C,
+  0x13, 0x1F, 0x50, 0x02, 0x83, 0x82, 0xF8, 0x11, 0x16, 0x11, 0x11, 0x16,
+  0x11, 0x1F, 0xFF, 0x91, 0x11, 0x11, 0x11, 0x91, 0x11, 0xF0, 0x11, 0x1F,
+  0xF1, 0x15, 0x11, 0x1F, 0x11, 0xF2, 0x1D, 0x16, 0x13, 0x19, 0x13, 0x1A,
+  0x15, 0x1F, 0xFF, 0xC1, 0x11, 0x11, 0x71, 0x11, 0x11, 0xFB, 0x13, 0x73,
+  0x33, 0x53, 0x52, 0x43, 0x63, 0x33, 0x73, 0x13, 0x92, 0x12, 0xA5, 0xB3,
+  0xC3, 0xB2, 0x12, 0x93, 0x12, 0x93, 0x13, 0x73, 0x33, 0x53, 0x53, 0x43,
+  0x62, 0x33, 0x73, 0x13, 0x93, 0x03, 0xA3, 0x12, 0x93, 0x32, 0x73, 0x43,
+  0x63, 0x53, 0x43, 0x73, 0x23, 0x92, 0x22, 0xA6, 0xB4, 0xD2, 0xE2, 0xE2,
+  0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x70, 0x1D, 0x1D, 0xB2, 0xB2, 0xB2, 0xB3,
+  0xA3, 0xB2, 0xB2, 0xB2, 0xB3, 0xA3, 0xB2, 0xB2, 0xB2, 0xBF, 0xD0, 0x04,
+  0x62, 0xFF, 0xFF, 0xA2, 0x40, 0x02, 0xC1, 0x11, 0xF4, 0x11, 0x1F, 0xB1,
+  0x11, 0xF4, 0x11, 0x1F, 0x41, 0x11, 0x70, 0x04, 0x42, 0xFF, 0xFF, 0xA2,
+  0x60, 0x0C, 0x07, 0x81, 0xE0, 0xCC, 0x33, 0x0C, 0xC6, 0x19, 0x86, 0xC0,
+  0xC0, 0x0F, 0xD0, 0xE6, 0x30, 0x1F, 0x0F, 0xF3, 0x87, 0x60, 0x60, 0x0C,
+  0x0F, 0x8F, 0xF3, 0xC6, 0xC0, 0xD8, 0x3B, 0x8F, 0x3F, 0xE3, 0xC6, 0xC0,
+  0x18, 0x03, 0x00, 0x60, 0x0C, 0xF1, 0xBF, 0x3C, 0x77, 0x07, 0xC0, 0x78,
+  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0xC1, 0xBC, 0x76, 0xFC, 0xCF, 0x00, 0x35,
+  0x47, 0x23, 0x36, 0x54, 0x82, 0x82, 0x82, 0x82, 0x83, 0x52, 0x13, 0x33,
+  0x27, 0x44, 0x30, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x31, 0xE6, 0x7E, 0xDC,
+  0x7F, 0x07, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x06, 0xC1, 0xDC, 0x79,
+  0xFB, 0x1E, 0x60, 0x35, 0x57, 0x33, 0x33, 0x12, 0x65, 0x7F, 0xB9, 0x29,
+  0x36, 0x21, 0x33, 0x33, 0x75, 0x53, 0x34, 0x21, 0x83, 0x72, 0x23, 0x72,
+  0x23, 0xFF, 0xFF, 0xA0, 0x1E, 0x67, 0xED, 0xC7, 0xB0, 0x7C, 0x07, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x6C, 0x1D, 0xC7, 0x9F, 0xB1, 0xE6, 0x00, 0xF0,
+  0x3F, 0x0E, 0x7F, 0xC7, 0xE0, 0x02, 0xFF, 0xC4, 0x51, 0x41, 0x31, 0x13,
+  0x21, 0x31, 0x31, 0x41, 0xFF, 0xFF, 0xFC, 0x04, 0x4F, 0xB0, 0x32, 0x82,
+  0x82, 0xFF, 0xFF, 0xF0, 0x36, 0x10, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC1,
+  0xB0, 0xCC, 0x63, 0x30, 0xD8, 0x3E, 0x0F, 0xC3, 0x38, 0xC6, 0x31, 0xCC,
+  0x33, 0x06, 0xC1, 0xC0, 0x02, 0x23, 0x34, 0x42, 0x31, 0x11, 0x41, 0x43,
+  0x21, 0x13, 0x21, 0x21, 0x31, 0x21, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB,
+  0x02, 0x24, 0x51, 0x41, 0x31, 0x13, 0x21, 0x31, 0x31, 0x41, 0xFF, 0xFF,
+  0xFC, 0x35, 0x57, 0x33, 0x33, 0x13, 0x55, 0x74, 0x74, 0x74, 0x74, 0x75,
+  0x53, 0x13, 0x33, 0x37, 0x55, 0x30, 0xCF, 0x1B, 0xF3, 0xC7, 0x70, 0x7C,
+  0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7C, 0x1B, 0xC7, 0x6F, 0xCC, 0xF1,
+  0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x1E, 0x67, 0xED, 0xC7, 0xF0,
+  0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x6C, 0x1D, 0xC7, 0x9F, 0xB1,
+  0xE6, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x02, 0x13, 0x21, 0x63,
+  0x21, 0xFF, 0xFC, 0x26, 0x38, 0x13, 0x45, 0x65, 0x86, 0x57, 0x65, 0x84,
+  0x65, 0x43, 0x18, 0x36, 0x20, 0x31, 0x51, 0xF3, 0x22, 0x37, 0x22, 0x3F,
+  0xFF, 0xF0, 0x32, 0x14, 0x02, 0x62, 0xFF, 0xFF, 0xFC, 0x14, 0x13, 0x13,
+  0x12, 0x31, 0x13, 0x14, 0x13, 0xC0, 0x78, 0x0D, 0x83, 0x30, 0x66, 0x0C,
+  0x63, 0x0C, 0x60, 0xD8, 0x1B, 0x03, 0x60, 0x38, 0x07, 0x00, 0x40, 0x60,
+  0x40, 0xCC, 0x1C, 0x19, 0x83, 0x83, 0x18, 0x50, 0xC3, 0x1B, 0x18, 0x63,
+  0x63, 0x06, 0xC6, 0xC0, 0xD8, 0xD8, 0x1B, 0x1B, 0x01, 0x41, 0x40, 0x38,
+  0x38, 0x07, 0x07, 0x00, 0x40, 0x40, 0xE0, 0x6C, 0x18, 0xC7, 0x1C, 0xC1,
+  0xB0, 0x1C, 0x03, 0x80, 0x70, 0x1B, 0x07, 0x70, 0xC6, 0x30, 0x6E, 0x0E,
+  0x02, 0x62, 0xF2, 0x11, 0x21, 0x1F, 0x81, 0x41, 0x11, 0x41, 0xD1, 0x11,
+  0xA1, 0x11, 0xF0, 0x1C, 0x1F, 0xB1, 0x11, 0x52, 0xB1, 0x50, 0x19, 0x19,
+  0x72, 0x73, 0x63, 0x63, 0x72, 0x72, 0x73, 0x63, 0x72, 0x7F, 0x50, 0x33,
+  0x21, 0x72, 0xFF, 0x71, 0x11, 0x21, 0x11, 0x51, 0x31, 0x61, 0x11, 0xFF,
+  0xC2, 0x21, 0x30, 0x0F, 0xFF, 0x10, 0x03, 0x61, 0x22, 0xFF, 0xC1, 0x11,
+  0x41, 0x11, 0x31, 0x71, 0x21, 0x11, 0xFF, 0x72, 0x71, 0x20, 0x78, 0x0F,
+  0xE3, 0xC7, 0xF0, 0x1E };
+
+const RleGlyph arial12pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0, 0 },  // 0x20 ' '
+  {     1,   2,  17,   8,    3,  -16, 1 },  // 0x21 '!'
+  {     4,   6,   6,   9,    1,  -16, 2 },  // 0x22 '"'
+  {     8,  13,  17,  13,    0,  -16, 2 },  // 0x23 '#'
+  {    33,  11,  20,  13,    1,  -17, 0 },  // 0x24 '$'
+  {    61,  19,  17,  21,    1,  -16, 0 },  // 0x25 '%'
+  {   102,  14,  17,  16,    1,  -16, 0 },  // 0x26 '&'
+  {   132,   2,   6,   5,    1,  -16, 1 },  // 0x27 '''
+  {   133,   6,  22,   8,    1,  -16, 0 },  // 0x28 '('
+  {   150,   6,  22,   8,    1,  -16, 0 },  // 0x29 ')'
+  {   167,   8,   7,   9,    1,  -16, 0 },  // 0x2A '*'
+  {   174,  12,  12,  14,    1,  -13, 2 },  // 0x2B '+'
+  {   183,   2,   6,   7,    2,   -1, 0 },  // 0x2C ','
+  {   185,   7,   2,   8,    0,   -6, 1 },  // 0x2D '-'
+  {   186,   2,   2,   7,    2,   -1, 0 },  // 0x2E '.'
+  {   187,   7,  17,   7,    0,  -16, 2 },  // 0x2F '/'
+  {   201,  11,  17,  13,    1,  -16, 1 },  // 0x30 '0'
+  {   224,   6,  17,  13,    3,  -16, 2 },  // 0x31 '1'
+  {   234,  11,  17,  13,    1,  -16, 1 },  // 0x32 '2'
+  {   253,  11,  17,  13,    1,  -16, 1 },  // 0x33 '3'
+  {   274,  11,  17,  13,    1,  -16, 2 },  // 0x34 '4'
+  {   293,  11,  17,  13,    1,  -16, 1 },  // 0x35 '5'
+  {   315,  11,  17,  13,    1,  -16, 0 },  // 0x36 '6'
+  {   339,  11,  17,  13,    1,  -16, 1 },  // 0x37 '7'
+  {   356,  11,  17,  13,    1,  -16, 0 },  // 0x38 '8'
+  {   380,  11,  17,  13,    1,  -16, 0 },  // 0x39 '9'
+  {   404,   2,  13,   7,    2,  -12, 1 },  // 0x3A ':'
+  {   407,   2,  17,   7,    2,  -12, 0 },  // 0x3B ';'
+  {   412,  11,  11,  14,    1,  -13, 1 },  // 0x3C '<'
+  {   423,  11,   7,  14,    1,  -11, 1 },  // 0x3D '='
+  {   427,  11,  11,  14,    1,  -13, 1 },  // 0x3E '>'
+  {   439,  11,  17,  13,    1,  -16, 1 },  // 0x3F '?'
+  {   458,  22,  22,  24,    1,  -16, 0 },  // 0x40 '@'
+  {   519,  15,  17,  15,    0,  -16, 1 },  // 0x41 'A'
+  {   548,  13,  17,  16,    2,  -16, 2 },  // 0x42 'B'
+  {   568,  15,  17,  17,    1,  -16, 1 },  // 0x43 'C'
+  {   592,  14,  17,  17,    2,  -16, 2 },  // 0x44 'D'
+  {   613,  13,  17,  16,    2,  -16, 2 },  // 0x45 'E'
+  {   623,  12,  17,  15,    2,  -16, 2 },  // 0x46 'F'
+  {   632,  16,  17,  19,    1,  -16, 1 },  // 0x47 'G'
+  {   656,  13,  17,  17,    2,  -16, 2 },  // 0x48 'H'
+  {   667,   2,  17,   6,    2,  -16, 1 },  // 0x49 'I'
+  {   669,   9,  17,  12,    1,  -16, 2 },  // 0x4A 'J'
+  {   682,  14,  17,  16,    2,  -16, 0 },  // 0x4B 'K'
+  {   712,  10,  17,  13,    2,  -16, 2 },  // 0x4C 'L'
+  {   720,  15,  17,  19,    2,  -16, 2 },  // 0x4D 'M'
+  {   744,  13,  17,  17,    2,  -16, 2 },  // 0x4E 'N'
+  {   767,  17,  17,  19,    1,  -16, 1 },  // 0x4F 'O'
+  {   792,  13,  17,  16,    2,  -16, 2 },  // 0x50 'P'
+  {   807,  17,  18,  19,    1,  -16, 1 },  // 0x51 'Q'
+  {   835,  14,  17,  17,    2,  -16, 2 },  // 0x52 'R'
+  {   858,  14,  17,  16,    1,  -16, 1 },  // 0x53 'S'
+  {   881,  14,  17,  14,    0,  -16, 2 },  // 0x54 'T'
+  {   891,  13,  17,  17,    2,  -16, 2 },  // 0x55 'U'
+  {   910,  15,  17,  15,    0,  -16, 2 },  // 0x56 'V'
+  {   939,  23,  17,  23,    0,  -16, 2 },  // 0x57 'W'
+  {   982,  15,  17,  15,    0,  -16, 1 },  // 0x58 'X'
+  {  1013,  16,  17,  16,    0,  -16, 1 },  // 0x59 'Y'
+  {  1038,  14,  17,  15,    0,  -16, 1 },  // 0x5A 'Z'
+  {  1055,   4,  22,   7,    1,  -16, 2 },  // 0x5B '['
+  {  1061,   7,  17,   7,    0,  -16, 2 },  // 0x5C
+  {  1075,   4,  22,   7,    2,  -16, 2 },  // 0x5D ']'
+  {  1081,  10,   9,  12,    1,  -16, 0 },  // 0x5E '^'
+  {  1093,  14,   2,  13,   -1,    4, 1 },  // 0x5F '_'
+  {  1095,   4,   3,   8,    1,  -16, 0 },  // 0x60 '`'
+  {  1097,  11,  13,  13,    1,  -12, 0 },  // 0x61 'a'
+  {  1115,  11,  17,  14,    2,  -16, 0 },  // 0x62 'b'
+  {  1139,  10,  13,  12,    1,  -12, 1 },  // 0x63 'c'
+  {  1155,  11,  17,  14,    1,  -16, 0 },  // 0x64 'd'
+  {  1179,  11,  13,  13,    1,  -12, 1 },  // 0x65 'e'
+  {  1194,   7,  17,   7,    0,  -16, 2 },  // 0x66 'f'
+  {  1204,  11,  18,  14,    1,  -12, 0 },  // 0x67 'g'
+  {  1229,  10,  17,  14,    2,  -16, 2 },  // 0x68 'h'
+  {  1243,   2,  17,   5,    2,  -16, 1 },  // 0x69 'i'
+  {  1246,   5,  22,   6,   -1,  -16, 2 },  // 0x6A 'j'
+  {  1254,  10,  17,  12,    2,  -16, 0 },  // 0x6B 'k'
+  {   667,   2,  17,   6,    2,  -16, 1 },  // 0x6C 'l'
+  {  1276,  16,  13,  20,    2,  -12, 2 },  // 0x6D 'm'
+  {  1296,  10,  13,  14,    2,  -12, 2 },  // 0x6E 'n'
+  {  1309,  11,  13,  13,    1,  -12, 1 },  // 0x6F 'o'
+  {  1326,  11,  18,  14,    2,  -12, 0 },  // 0x70 'p'
+  {  1351,  11,  18,  14,    1,  -12, 0 },  // 0x71 'q'
+  {  1376,   6,  13,   8,    2,  -12, 2 },  // 0x72 'r'
+  {  1383,  10,  13,  12,    1,  -12, 1 },  // 0x73 's'
+  {  1397,   7,  17,   7,    0,  -16, 2 },  // 0x74 't'
+  {  1408,  10,  13,  14,    2,  -12, 2 },  // 0x75 'u'
+  {  1421,  11,  13,  11,    0,  -12, 0 },  // 0x76 'v'
+  {  1439,  19,  13,  17,   -1,  -12, 0 },  // 0x77 'w'
+  {  1470,  11,  13,  11,    0,  -12, 0 },  // 0x78 'x'
+  {  1488,  10,  18,  12,    1,  -12, 2 },  // 0x79 'y'
+  {  1510,  10,  13,  12,    1,  -12, 1 },  // 0x7A 'z'
+  {  1523,   6,  22,   8,    1,  -16, 2 },  // 0x7B '{'
+  {  1539,   2,  23,   6,    2,  -16, 1 },  // 0x7C '|'
+  {  1542,   6,  22,   8,    1,  -16, 2 },  // 0x7D '}'
+  {  1558,  12,   4,  14,    1,   -9, 0 }   // 0x7E '~'
+};
+
+const RleFont arial12pt7bRle PROGMEM = {
+  arial12pt7bRleData,
+  arial12pt7bRleGlyphs,
+  0x20, 0x7E, 27 };
+
+#endif // ARIAL12PT7BRLE_H_
@@ -0,0 +1,251 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial13pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 1673 bytes of bitmap data (GFXfont: 2144)
+#ifndef ARIAL13PT7BRLE_H_
+#define ARIAL13PT7BRLE_H_
+
+const uint8_t arial13pt7bRleData[] PROGMEM = {
+  0x00, 0x0F, 0xD4, 0x40, 0x02, 0x32, 0xFF, 0x50, 0x52, 0x42, 0xF4, 0x15,
+  0x11, 0x17, 0x1F, 0x64, 0x24, 0x22, 0xE3, 0x24, 0x23, 0xFF, 0xC3, 0x24,
+  0x23, 0xE2, 0x24, 0x24, 0xF6, 0x17, 0x11, 0x15, 0x1F, 0x30, 0x04, 0x03,
+  0xE1, 0xFF, 0x72, 0x7C, 0x47, 0x88, 0x31, 0x07, 0x20, 0x7C, 0x07, 0xE0,
+  0x1F, 0x02, 0x60, 0x46, 0x08, 0xF1, 0x1F, 0x27, 0x75, 0xCF, 0xF8, 0x7C,
+  0x02, 0x00, 0x40, 0x3C, 0x06, 0x0F, 0xC1, 0xC3, 0x9C, 0x30, 0x61, 0x8E,
+  0x0C, 0x31, 0x81, 0x86, 0x70, 0x30, 0xCC, 0x07, 0x3B, 0x80, 0x7E, 0x67,
+  0x87, 0x99, 0xF8, 0x03, 0x73, 0x80, 0xCC, 0x30, 0x19, 0x86, 0x06, 0x30,
+  0xC0, 0xC6, 0x18, 0x30, 0xE7, 0x06, 0x0F, 0xC1, 0x80, 0xF0, 0x0F, 0x80,
+  0x3F, 0x80, 0xE3, 0x81, 0x83, 0x03, 0x06, 0x07, 0x1C, 0x07, 0x70, 0x07,
+  0xC0, 0x1E, 0x00, 0x76, 0x01, 0x86, 0x36, 0x0E, 0xEC, 0x0F, 0x98, 0x0E,
+  0x38, 0x1E, 0x38, 0x7E, 0x3F, 0xDE, 0x3E, 0x18, 0x0C, 0x0C, 0x63, 0x0C,
+  0x61, 0x86, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0x61, 0x86, 0x0C,
+  0x30, 0x60, 0xC0, 0xC1, 0x83, 0x0C, 0x18, 0x61, 0x83, 0x0C, 0x30, 0xC3,
+  0x0C, 0x30, 0xC7, 0x18, 0x63, 0x8C, 0x31, 0x8C, 0x00, 0x18, 0x18, 0xDB,
+  0xFF, 0x3C, 0x3C, 0x66, 0x24, 0x52, 0xFF, 0xF8, 0x52, 0x5C, 0x52, 0x5F,
+  0xFF, 0x30, 0xF5, 0xE0, 0x0C, 0xF0, 0x52, 0xB1, 0x11, 0xF2, 0x18, 0x1F,
+  0x21, 0x11, 0xF9, 0x11, 0x1F, 0x21, 0x11, 0xB0, 0x36, 0x58, 0x33, 0x43,
+  0x22, 0x62, 0x12, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+  0x82, 0x12, 0x62, 0x23, 0x43, 0x38, 0x56, 0x30, 0x52, 0xA2, 0x41, 0x42,
+  0x21, 0x51, 0x33, 0xFF, 0xFF, 0xF6, 0x36, 0x58, 0x33, 0x43, 0x12, 0x75,
+  0x82, 0xA2, 0xA2, 0x92, 0xA2, 0x92, 0x92, 0x92, 0x83, 0x83, 0x82, 0x92,
+  0x9F, 0x90, 0x35, 0x68, 0x33, 0x43, 0x13, 0x62, 0x12, 0x72, 0xA2, 0x83,
+  0x65, 0x76, 0xB2, 0xA3, 0xA2, 0xA4, 0x85, 0x63, 0x12, 0x53, 0x38, 0x55,
+  0x40, 0x82, 0x91, 0xA1, 0xF7, 0x11, 0x18, 0x1D, 0x18, 0x11, 0x18, 0x1D,
+  0x18, 0x11, 0x18, 0x1E, 0x52, 0x2C, 0x82, 0x2F, 0xF6, 0x29, 0x39, 0x23,
+  0x92, 0xA2, 0xA2, 0xA2, 0x15, 0x3A, 0x23, 0x53, 0xA3, 0xA2, 0xA2, 0xA4,
+  0x84, 0x72, 0x22, 0x53, 0x38, 0x55, 0x40, 0x0F, 0x83, 0xFC, 0x30, 0xE6,
+  0x07, 0x60, 0x3C, 0x00, 0xCF, 0x8D, 0xFC, 0xF0, 0xEE, 0x07, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0x60, 0x67, 0x0E, 0x3F, 0xC0, 0xF8, 0x0F, 0x99,
+  0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x29, 0x2A, 0x2A, 0x29,
+  0x2A, 0x2A, 0x2A, 0x27, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0x60, 0x66,
+  0x06, 0x30, 0xC1, 0xF8, 0x3F, 0xC7, 0x0E, 0xC0, 0x7C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x77, 0x06, 0x3F, 0xC1, 0xF8, 0x1F, 0x03, 0xFC, 0x70, 0xEE,
+  0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0F, 0x3F, 0xB1,
+  0xF3, 0x00, 0x3C, 0x06, 0xC0, 0x66, 0x0C, 0x7F, 0x81, 0xF0, 0x04, 0xF3,
+  0x40, 0xF0, 0x00, 0x03, 0xD7, 0x80, 0xB1, 0x84, 0x65, 0x54, 0x54, 0x72,
+  0xB4, 0xB4, 0xA5, 0x94, 0xB1, 0x0F, 0x9F, 0xFF, 0x3F, 0x90, 0x01, 0xB4,
+  0x95, 0xA4, 0xB4, 0xB2, 0x74, 0x54, 0x55, 0x64, 0x81, 0xB0, 0x36, 0x58,
+  0x33, 0x43, 0x13, 0x65, 0x82, 0xA2, 0x93, 0x83, 0x83, 0x83, 0x92, 0x92,
+  0xA2, 0xA2, 0xFF, 0x42, 0xA2, 0x50, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x80,
+  0x3E, 0x07, 0x80, 0xE0, 0x03, 0x83, 0x80, 0x03, 0x86, 0x0F, 0x33, 0x18,
+  0x7F, 0x67, 0x31, 0xC3, 0xC6, 0xE7, 0x03, 0x0D, 0x8C, 0x06, 0x1B, 0x30,
+  0x0C, 0x36, 0x60, 0x18, 0x6C, 0xC0, 0x31, 0x99, 0x80, 0xC3, 0x33, 0x03,
+  0x8C, 0x73, 0x0F, 0x38, 0x67, 0xF7, 0xE0, 0xE3, 0xC7, 0x0C, 0xE0, 0x00,
+  0x30, 0xE0, 0x01, 0xC0, 0xF8, 0x0F, 0x00, 0xFF, 0xFC, 0x00, 0x3F, 0xC0,
+  0x00, 0x63, 0xFB, 0x11, 0x11, 0x1F, 0xF9, 0x11, 0x11, 0x11, 0x1F, 0x71,
+  0x71, 0x81, 0x31, 0xF7, 0x12, 0x52, 0x1F, 0x67, 0x51, 0x91, 0x11, 0x41,
+  0xFB, 0x11, 0x19, 0x11, 0x1F, 0x00, 0x0A, 0xE2, 0x48, 0xE1, 0x11, 0xFF,
+  0xF8, 0x11, 0x13, 0x81, 0x1D, 0x14, 0x82, 0x1B, 0x12, 0x1B, 0x1F, 0xFA,
+  0x21, 0x12, 0x8F, 0x02, 0x10, 0x66, 0x7B, 0x44, 0x63, 0x23, 0x92, 0x22,
+  0xB5, 0xD2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0xF0, 0x2B, 0x21, 0x2A, 0x31,
+  0x38, 0x33, 0x45, 0x35, 0xA8, 0x65, 0x0A, 0xF0, 0x25, 0x82, 0x1C, 0x12,
+  0x1C, 0x1F, 0x21, 0xC1, 0xFF, 0xFF, 0xFE, 0x1F, 0x11, 0xB1, 0xD1, 0x21,
+  0x38, 0x21, 0xC2, 0x30, 0x0E, 0xF1, 0xCF, 0xFF, 0xFC, 0xBF, 0x2B, 0xFF,
+  0xFF, 0xDC, 0xE0, 0x0C, 0xEA, 0xFF, 0xFF, 0x29, 0xF0, 0x9F, 0xFF, 0xFF,
+  0xA0, 0x66, 0x7B, 0x44, 0x54, 0x32, 0x92, 0x22, 0xA3, 0x12, 0xB1, 0x12,
+  0xE2, 0xE2, 0xE2, 0x79, 0x79, 0xC2, 0x12, 0xB2, 0x12, 0xB2, 0x22, 0xA2,
+  0x24, 0x55, 0x4A, 0x86, 0x40, 0x02, 0xA2, 0xFF, 0xFF, 0xFF, 0xAA, 0xF3,
+  0xAF, 0xFF, 0xFF, 0xFA, 0x0F, 0xF6, 0x82, 0xFF, 0xFF, 0xFF, 0xF5, 0x2F,
+  0xD1, 0x11, 0x41, 0x11, 0x34, 0x41, 0x52, 0x10, 0xC0, 0x1D, 0x80, 0x73,
+  0x01, 0xC6, 0x07, 0x0C, 0x1C, 0x18, 0x70, 0x31, 0xC0, 0x67, 0x00, 0xDF,
+  0x01, 0xFE, 0x03, 0xCE, 0x07, 0x0E, 0x0C, 0x0E, 0x18, 0x0E, 0x30, 0x1C,
+  0x60, 0x1C, 0xC0, 0x1D, 0x80, 0x1C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFB, 0x9B, 0x03, 0xB3, 0x31, 0x91, 0xF7, 0x11, 0x17, 0x11, 0x1F, 0xF9,
+  0x11, 0x15, 0x11, 0x1F, 0xFB, 0x11, 0x13, 0x11, 0x1F, 0xFD, 0x11, 0x11,
+  0x11, 0x1F, 0xFF, 0x01, 0x11, 0x11, 0xFF, 0xA0, 0x03, 0x92, 0xF2, 0x1F,
+  0xB1, 0x11, 0xC1, 0x11, 0xFB, 0x11, 0x1C, 0x11, 0x1F, 0xB1, 0x11, 0xC1,
+  0x11, 0xFB, 0x11, 0x1C, 0x11, 0x1F, 0xB1, 0xF2, 0x66, 0x8A, 0x64, 0x54,
+  0x42, 0x92, 0x32, 0xB2, 0x22, 0xB2, 0x12, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4,
+  0xD2, 0x12, 0xB2, 0x22, 0xB2, 0x32, 0x92, 0x44, 0x54, 0x5B, 0x86, 0x60,
+  0x0B, 0xE1, 0x48, 0x21, 0xB1, 0x21, 0xB1, 0xFF, 0xB1, 0xC1, 0x21, 0x28,
+  0x21, 0xC1, 0x49, 0xFF, 0xFF, 0xFC, 0x66, 0x8B, 0x54, 0x54, 0x42, 0x92,
+  0x32, 0xB2, 0x22, 0xB2, 0x12, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD2, 0x12,
+  0xB3, 0x12, 0x62, 0x32, 0x32, 0x57, 0x34, 0x54, 0x6C, 0x76, 0x14, 0xF0,
+  0x20, 0x0B, 0xF0, 0x24, 0x8F, 0x02, 0x11, 0xFF, 0xC1, 0xD1, 0x21, 0x38,
+  0xF1, 0x24, 0x53, 0x1B, 0x1F, 0x21, 0xC1, 0x21, 0xC1, 0x21, 0xFC, 0x12,
+  0x1C, 0x12, 0x10, 0x56, 0x7A, 0x43, 0x63, 0x22, 0x93, 0x12, 0xA2, 0x12,
+  0xD3, 0xD6, 0xA9, 0x98, 0xC3, 0xE4, 0xB4, 0xB2, 0x12, 0x93, 0x14, 0x63,
+  0x3B, 0x67, 0x40, 0x0E, 0xE6, 0x26, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x00, 0x02, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x21, 0x11,
+  0x81, 0x11, 0x31, 0x61, 0x41, 0x26, 0x21, 0x32, 0x62, 0x20, 0x02, 0xB2,
+  0x21, 0x91, 0x21, 0xD1, 0xF3, 0x17, 0x14, 0x1B, 0x1F, 0x31, 0x11, 0x51,
+  0x11, 0xFF, 0x51, 0x11, 0x31, 0x11, 0xF9, 0x11, 0x1A, 0x15, 0x1F, 0xB1,
+  0xC1, 0x31, 0xF5, 0x02, 0x93, 0x92, 0xF7, 0x12, 0x11, 0x17, 0x11, 0x11,
+  0x19, 0x1F, 0xFF, 0x61, 0x11, 0x51, 0x31, 0x11, 0x51, 0x11, 0xC1, 0xFF,
+  0xFD, 0x16, 0x11, 0x13, 0x11, 0x13, 0x11, 0x15, 0x1F, 0xFF, 0xA1, 0x11,
+  0x11, 0x11, 0x51, 0x11, 0x11, 0x11, 0xFF, 0xFE, 0x1B, 0x1A, 0x13, 0x17,
+  0x13, 0x1F, 0xE0, 0x13, 0x93, 0x33, 0x73, 0x53, 0x53, 0x72, 0x52, 0x83,
+  0x33, 0x93, 0x13, 0xB2, 0x12, 0xD3, 0xE3, 0xD5, 0xC2, 0x12, 0xB3, 0x13,
+  0x93, 0x33, 0x73, 0x53, 0x62, 0x72, 0x53, 0x73, 0x33, 0x93, 0x13, 0xB3,
+  0x02, 0xB3, 0x12, 0x93, 0x32, 0x82, 0x43, 0x63, 0x53, 0x43, 0x72, 0x42,
+  0x83, 0x23, 0x92, 0x22, 0xB4, 0xC4, 0xD2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+  0xE2, 0xE2, 0x70, 0x1D, 0x1D, 0xB2, 0xB3, 0xA3, 0xA3, 0xB2, 0xB3, 0xA3,
+  0xA3, 0xB2, 0xB3, 0xA3, 0xA3, 0xB2, 0xB2, 0xBF, 0xD0, 0x05, 0x73, 0xFF,
+  0xFF, 0xFF, 0x23, 0x50, 0x02, 0xC1, 0x11, 0xF6, 0x14, 0x1F, 0x61, 0x11,
+  0xFB, 0x11, 0x1F, 0x41, 0x11, 0x70, 0x05, 0x53, 0xFF, 0xFF, 0xFF, 0x23,
+  0x70, 0x0C, 0x07, 0x81, 0xE0, 0xCC, 0x33, 0x0C, 0xC6, 0x19, 0x86, 0x61,
+  0xB0, 0x30, 0x0F, 0xF0, 0xE6, 0x30, 0x1F, 0x87, 0xFC, 0xE0, 0xEC, 0x06,
+  0x00, 0x60, 0x3E, 0x3F, 0xE7, 0xC6, 0xC0, 0x6C, 0x0E, 0xE1, 0xE7, 0xF6,
+  0x3E, 0x30, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x9E, 0x37, 0xE7,
+  0x8E, 0xE0, 0xF8, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF8, 0x37, 0x8E,
+  0xDF, 0x99, 0xE0, 0x36, 0x48, 0x23, 0x46, 0x64, 0x92, 0x92, 0x92, 0x92,
+  0x75, 0x53, 0x13, 0x42, 0x37, 0x55, 0x30, 0x00, 0x60, 0x0C, 0x01, 0x80,
+  0x30, 0x06, 0x3C, 0xCF, 0xDB, 0x8F, 0xE0, 0xF8, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0x80, 0xD8, 0x3B, 0x8F, 0x3F, 0x63, 0xCC, 0x36, 0x58, 0x33, 0x43,
+  0x22, 0x62, 0x12, 0x8F, 0xDA, 0x2A, 0x37, 0x21, 0x35, 0x23, 0x85, 0x63,
+  0x34, 0x21, 0x83, 0xE2, 0x23, 0x72, 0x23, 0xFF, 0xFF, 0xA0, 0x1E, 0x67,
+  0xFD, 0xC7, 0xB0, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x6C, 0x1D,
+  0xC7, 0x9F, 0xB1, 0xE6, 0x00, 0xF0, 0x3F, 0x0E, 0x7F, 0xC7, 0xE0, 0x02,
+  0xFF, 0xF7, 0x45, 0x14, 0x13, 0x11, 0x32, 0x13, 0x13, 0x14, 0x1F, 0xFF,
+  0xFF, 0xC0, 0x04, 0x6F, 0xB0, 0x32, 0x82, 0xD2, 0xFF, 0xFF, 0xF0, 0x36,
+  0x10, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x83, 0xB0, 0xE6, 0x38,
+  0xCE, 0x1B, 0x83, 0xE0, 0x7E, 0x0C, 0xE1, 0x8E, 0x30, 0xC6, 0x0C, 0xC1,
+  0xD8, 0x1C, 0x02, 0x24, 0x44, 0x51, 0x41, 0x12, 0x41, 0x31, 0x13, 0x21,
+  0x14, 0x21, 0x31, 0x31, 0x21, 0x41, 0x41, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x90, 0x02, 0x24, 0x51, 0x41, 0x31, 0x13, 0x21, 0x31, 0x31, 0x41, 0xFF,
+  0xFF, 0xFC, 0x36, 0x58, 0x33, 0x43, 0x13, 0x65, 0x84, 0x84, 0x84, 0x84,
+  0x85, 0x63, 0x13, 0x43, 0x38, 0x56, 0x30, 0xCF, 0x1B, 0xF3, 0xC7, 0x70,
+  0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x7C, 0x1B, 0xC7, 0x6F, 0xCC,
+  0xF1, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x00, 0x1E, 0x67, 0xED, 0xC7,
+  0xF0, 0x7C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x6C, 0x1D, 0xC7, 0x9F,
+  0xB1, 0xE6, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x02, 0x13, 0x21,
+  0x63, 0x21, 0xFF, 0xFC, 0x26, 0x49, 0x13, 0x52, 0x12, 0x93, 0x96, 0x68,
+  0x66, 0x85, 0x75, 0x53, 0x19, 0x45, 0x30, 0x92, 0xF9, 0x22, 0x37, 0x22,
+  0x3F, 0xFF, 0xF0, 0x32, 0x14, 0x02, 0x62, 0xFF, 0xFF, 0xFC, 0x14, 0x13,
+  0x13, 0x12, 0x31, 0x13, 0x14, 0x13, 0xC0, 0x78, 0x0D, 0x83, 0x30, 0x66,
+  0x0C, 0x63, 0x0C, 0x60, 0xD8, 0x1B, 0x03, 0x60, 0x38, 0x07, 0x00, 0x40,
+  0x60, 0x20, 0x33, 0x03, 0x81, 0x8C, 0x1C, 0x1C, 0x61, 0xB0, 0xC3, 0x0D,
+  0x86, 0x0C, 0x6C, 0x60, 0x66, 0x33, 0x01, 0xB1, 0xB8, 0x0D, 0x8D, 0x80,
+  0x68, 0x2C, 0x01, 0xC1, 0xC0, 0x0E, 0x0E, 0x00, 0x30, 0x30, 0x00, 0xE0,
+  0x6C, 0x18, 0xC7, 0x1C, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0x70, 0x1B, 0x07,
+  0x70, 0xC6, 0x30, 0x6E, 0x0E, 0xC0, 0x78, 0x0D, 0x83, 0x30, 0x66, 0x18,
+  0x63, 0x0C, 0x61, 0x98, 0x1B, 0x03, 0xC0, 0x78, 0x07, 0x00, 0xC0, 0x18,
+  0x03, 0x00, 0xC0, 0x78, 0x0E, 0x00, 0x1A, 0x1A, 0x82, 0x82, 0x82, 0x83,
+  0x73, 0x73, 0x73, 0x73, 0x82, 0x8F, 0x70, 0x53, 0x32, 0x83, 0xFF, 0xF5,
+  0x11, 0x13, 0x21, 0x1C, 0x21, 0x16, 0x11, 0x1F, 0xFF, 0xF2, 0x11, 0x34,
+  0x13, 0x0F, 0xFF, 0x10, 0x03, 0x81, 0x43, 0x11, 0xFF, 0xF9, 0x11, 0x16,
+  0x11, 0x2C, 0x11, 0x23, 0x11, 0x1F, 0xFF, 0xD3, 0x11, 0x61, 0x40, 0x24,
+  0x78, 0x34, 0x38, 0x74, 0x20 };
+
+const RleGlyph arial13pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   7,    0,    0, 0 },  // 0x20 ' '
+  {     1,   2,  18,   8,    3,  -17, 1 },  // 0x21 '!'
+  {     4,   7,   6,   9,    1,  -17, 2 },  // 0x22 '"'
+  {     8,  14,  18,  14,    0,  -17, 2 },  // 0x23 '#'
+  {    34,  11,  21,  14,    1,  -18, 0 },  // 0x24 '$'
+  {    63,  19,  18,  22,    1,  -17, 0 },  // 0x25 '%'
+  {   106,  15,  18,  17,    1,  -17, 0 },  // 0x26 '&'
+  {   140,   2,   6,   5,    1,  -17, 1 },  // 0x27 '''
+  {   141,   6,  23,   8,    2,  -17, 0 },  // 0x28 '('
+  {   159,   6,  23,   8,    0,  -17, 0 },  // 0x29 ')'
+  {   177,   8,   8,  10,    1,  -17, 0 },  // 0x2A '*'
+  {   185,  12,  12,  15,    1,  -14, 2 },  // 0x2B '+'
+  {   194,   2,   6,   7,    2,   -1, 0 },  // 0x2C ','
+  {   196,   6,   2,   8,    1,   -6, 1 },  // 0x2D '-'
+  {   197,   2,   2,   7,    2,   -1, 0 },  // 0x2E '.'
+  {   198,   7,  18,   7,    0,  -17, 2 },  // 0x2F '/'
+  {   212,  12,  18,  14,    1,  -17, 1 },  // 0x30 '0'
+  {   236,   7,  18,  14,    2,  -17, 2 },  // 0x31 '1'
+  {   246,  12,  18,  14,    1,  -17, 1 },  // 0x32 '2'
+  {   266,  12,  18,  14,    1,  -17, 1 },  // 0x33 '3'
+  {   289,  12,  18,  14,    1,  -17, 2 },  // 0x34 '4'
+  {   309,  12,  18,  14,    1,  -17, 1 },  // 0x35 '5'
+  {   331,  12,  18,  14,    1,  -17, 0 },  // 0x36 '6'
+  {   358,  12,  18,  14,    1,  -17, 1 },  // 0x37 '7'
+  {   376,  12,  18,  14,    1,  -17, 0 },  // 0x38 '8'
+  {   403,  12,  18,  14,    1,  -17, 0 },  // 0x39 '9'
+  {   430,   2,  13,   7,    2,  -12, 1 },  // 0x3A ':'
+  {   433,   2,  17,   7,    2,  -12, 0 },  // 0x3B ';'
+  {   438,  12,  11,  15,    1,  -13, 1 },  // 0x3C '<'
+  {   449,  12,   8,  15,    1,  -12, 1 },  // 0x3D '='
+  {   454,  12,  11,  15,    1,  -13, 1 },  // 0x3E '>'
+  {   466,  12,  18,  14,    1,  -17, 1 },  // 0x3F '?'
+  {   486,  23,  23,  25,    1,  -17, 0 },  // 0x40 '@'
+  {   553,  15,  18,  17,    1,  -17, 2 },  // 0x41 'A'
+  {   582,  14,  18,  17,    2,  -17, 2 },  // 0x42 'B'
+  {   605,  16,  18,  18,    1,  -17, 1 },  // 0x43 'C'
+  {   630,  15,  18,  18,    2,  -17, 2 },  // 0x44 'D'
+  {   652,  14,  18,  17,    2,  -17, 2 },  // 0x45 'E'
+  {   663,  12,  18,  15,    2,  -17, 2 },  // 0x46 'F'
+  {   673,  16,  18,  19,    1,  -17, 1 },  // 0x47 'G'
+  {   701,  14,  18,  18,    2,  -17, 2 },  // 0x48 'H'
+  {   712,   2,  18,   6,    2,  -17, 1 },  // 0x49 'I'
+  {   714,  10,  18,  13,    1,  -17, 2 },  // 0x4A 'J'
+  {   728,  15,  18,  17,    2,  -17, 0 },  // 0x4B 'K'
+  {   762,  11,  18,  14,    2,  -17, 2 },  // 0x4C 'L'
+  {   770,  17,  18,  21,    2,  -17, 2 },  // 0x4D 'M'
+  {   800,  14,  18,  18,    2,  -17, 2 },  // 0x4E 'N'
+  {   824,  17,  18,  19,    1,  -17, 1 },  // 0x4F 'O'
+  {   852,  14,  18,  17,    2,  -17, 2 },  // 0x50 'P'
+  {   870,  17,  19,  19,    1,  -17, 1 },  // 0x51 'Q'
+  {   901,  15,  18,  18,    2,  -17, 2 },  // 0x52 'R'
+  {   927,  15,  18,  17,    1,  -17, 1 },  // 0x53 'S'
+  {   951,  14,  18,  14,    0,  -17, 2 },  // 0x54 'T'
+  {   962,  14,  18,  18,    2,  -17, 2 },  // 0x55 'U'
+  {   982,  15,  18,  17,    1,  -17, 2 },  // 0x56 'V'
+  {  1011,  25,  18,  26,    0,  -17, 2 },  // 0x57 'W'
+  {  1059,  17,  18,  17,    0,  -17, 1 },  // 0x58 'X'
+  {  1092,  16,  18,  16,    0,  -17, 1 },  // 0x59 'Y'
+  {  1119,  14,  18,  15,    0,  -17, 1 },  // 0x5A 'Z'
+  {  1137,   5,  23,   7,    2,  -17, 2 },  // 0x5B '['
+  {  1144,   7,  18,   7,    0,  -17, 2 },  // 0x5C
+  {  1158,   5,  23,   7,    0,  -17, 2 },  // 0x5D ']'
+  {  1165,  10,  10,  12,    1,  -17, 0 },  // 0x5E '^'
+  {  1178,  15,   2,  14,   -1,    4, 1 },  // 0x5F '_'
+  {  1180,   4,   3,   8,    1,  -17, 0 },  // 0x60 '`'
+  {  1182,  12,  13,  14,    1,  -12, 0 },  // 0x61 'a'
+  {  1202,  11,  18,  14,    2,  -17, 0 },  // 0x62 'b'
+  {  1227,  11,  13,  13,    1,  -12, 1 },  // 0x63 'c'
+  {  1243,  11,  18,  14,    1,  -17, 0 },  // 0x64 'd'
+  {  1268,  12,  13,  14,    1,  -12, 1 },  // 0x65 'e'
+  {  1284,   7,  18,   7,    0,  -17, 2 },  // 0x66 'f'
+  {  1294,  11,  18,  14,    1,  -12, 0 },  // 0x67 'g'
+  {  1319,  10,  18,  14,    2,  -17, 2 },  // 0x68 'h'
+  {  1334,   2,  18,   6,    2,  -17, 1 },  // 0x69 'i'
+  {  1337,   5,  23,   6,   -1,  -17, 2 },  // 0x6A 'j'
+  {  1345,  11,  18,  13,    2,  -17, 0 },  // 0x6B 'k'
+  {   712,   2,  18,   6,    2,  -17, 1 },  // 0x6C 'l'
+  {  1370,  18,  13,  22,    2,  -12, 2 },  // 0x6D 'm'
+  {  1393,  10,  13,  14,    2,  -12, 2 },  // 0x6E 'n'
+  {  1406,  12,  13,  14,    1,  -12, 1 },  // 0x6F 'o'
+  {  1423,  11,  18,  14,    2,  -12, 0 },  // 0x70 'p'
+  {  1448,  11,  18,  14,    1,  -12, 0 },  // 0x71 'q'
+  {  1473,   6,  13,   8,    2,  -12, 2 },  // 0x72 'r'
+  {  1480,  11,  13,  13,    1,  -12, 1 },  // 0x73 's'
+  {  1495,   7,  18,   7,    0,  -17, 2 },  // 0x74 't'
+  {  1505,  10,  13,  14,    2,  -12, 2 },  // 0x75 'u'
+  {  1518,  11,  13,  11,    0,  -12, 0 },  // 0x76 'v'
+  {  1536,  21,  13,  19,   -1,  -12, 0 },  // 0x77 'w'
+  {  1571,  11,  13,  11,    0,  -12, 0 },  // 0x78 'x'
+  {  1589,  11,  18,  12,    1,  -12, 0 },  // 0x79 'y'
+  {  1614,  11,  13,  12,    0,  -12, 1 },  // 0x7A 'z'
+  {  1627,   8,  23,   8,    1,  -17, 2 },  // 0x7B '{'
+  {  1645,   2,  23,   6,    2,  -17, 1 },  // 0x7C '|'
+  {  1648,   8,  23,   8,   -1,  -17, 2 },  // 0x7D '}'
+  {  1667,  13,   4,  15,    1,  -10, 1 }   // 0x7E '~'
+};
+
+const RleFont arial13pt7bRle PROGMEM = {
+  arial13pt7bRleData,
+  arial13pt7bRleGlyphs,
+  0x20, 0x7E, 29 };
+
+#endif // ARIAL13PT7BRLE_H_
@@ -0,0 +1,142 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial5pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 367 bytes of bitmap data (GFXfont: 382)
+#ifndef ARIAL5PT7BRLE_H_
+#define ARIAL5PT7BRLE_H_
+
+const uint8_t arial5pt7bRleData[] PROGMEM = {
+  0x00, 0xFA, 0xB6, 0x80, 0x29, 0x7E, 0xAF, 0xD2, 0x80, 0x75, 0x78, 0x72,
+  0xD5, 0xC4, 0x45, 0x52, 0xA2, 0xA1, 0xA5, 0x49, 0x00, 0x38, 0x90, 0xC3,
+  0x09, 0x71, 0x9D, 0x80, 0xE0, 0x2A, 0x49, 0x22, 0x20, 0x88, 0x92, 0x4A,
+  0x80, 0xEA, 0x80, 0x21, 0x3E, 0x42, 0x00, 0xC0, 0xC0, 0x80, 0x25, 0x25,
+  0x20, 0x13, 0x15, 0xF5, 0x50, 0x2E, 0x92, 0x48, 0x74, 0x42, 0x22, 0x23,
+  0xE0, 0x74, 0x42, 0x60, 0xC5, 0xC0, 0x18, 0xA4, 0xA2, 0xFC, 0x20, 0x80,
+  0x7A, 0x3D, 0x10, 0xC5, 0xC0, 0x74, 0x7D, 0x18, 0xC5, 0xC0, 0xF8, 0x84,
+  0x42, 0x21, 0x00, 0x13, 0x15, 0x5A, 0x55, 0x74, 0x63, 0x17, 0xC5, 0xC0,
+  0x88, 0x8C, 0x16, 0x86, 0x10, 0xF8, 0x3E, 0x86, 0x16, 0x80, 0x7A, 0x10,
+  0x46, 0x10, 0x01, 0x00, 0x3E, 0x20, 0x96, 0xB4, 0xDA, 0x4D, 0x2A, 0x78,
+  0x83, 0x3E, 0x00, 0x10, 0x50, 0xA2, 0x27, 0xC8, 0xA0, 0x80, 0xF4, 0x63,
+  0xF8, 0xC7, 0xC0, 0x13, 0x15, 0x41, 0xE6, 0xE4, 0xA3, 0x18, 0xCB, 0x80,
+  0xFC, 0x21, 0xF8, 0x43, 0xE0, 0xF8, 0x8E, 0x88, 0x80, 0x31, 0x28, 0x27,
+  0x85, 0x23, 0x00, 0x8C, 0x63, 0xF8, 0xC6, 0x20, 0xFE, 0x11, 0x11, 0x19,
+  0xE0, 0x86, 0x29, 0x28, 0xD2, 0x28, 0x40, 0x01, 0xFF, 0x04, 0x83, 0x8F,
+  0x1D, 0x5A, 0xB5, 0x64, 0x80, 0x8E, 0x73, 0x59, 0xCE, 0x20, 0x14, 0x16,
+  0xF9, 0x60, 0xF4, 0x63, 0xE8, 0x42, 0x00, 0x14, 0x16, 0xF6, 0x62, 0x10,
+  0xF4, 0x63, 0xE9, 0x46, 0x20, 0x74, 0x60, 0xE0, 0xC5, 0xC0, 0x07, 0x12,
+  0xFA, 0x01, 0x31, 0xFA, 0x50, 0x82, 0x89, 0x12, 0x22, 0x85, 0x06, 0x00,
+  0x88, 0xCA, 0x55, 0x4A, 0xA5, 0x52, 0xA8, 0x88, 0x44, 0x50, 0x40, 0x82,
+  0x88, 0xA0, 0x80, 0x82, 0x88, 0xA0, 0x81, 0x02, 0x04, 0x00, 0xFC, 0x21,
+  0x08, 0x42, 0x0F, 0xC0, 0xEA, 0xAA, 0xC0, 0x91, 0x24, 0x48, 0xD5, 0x55,
+  0xC0, 0x22, 0x95, 0x10, 0xFC, 0x90, 0x71, 0x79, 0xF0, 0x88, 0xE9, 0x99,
+  0xE0, 0x69, 0x89, 0x60, 0x11, 0x79, 0x99, 0x70, 0x69, 0xF8, 0x70, 0x2B,
+  0xA4, 0x90, 0x79, 0x99, 0x79, 0x60, 0x88, 0xE9, 0x99, 0x90, 0xBE, 0x45,
+  0x55, 0x80, 0x88, 0x9A, 0xEA, 0x90, 0x06, 0x22, 0x13, 0xF6, 0xE9, 0x99,
+  0x90, 0x69, 0x99, 0x60, 0xE9, 0x99, 0xE8, 0x80, 0x79, 0x99, 0x71, 0x10,
+  0xEA, 0x80, 0x1A, 0x27, 0x4B, 0xA4, 0x98, 0x99, 0x99, 0x70, 0x8A, 0x94,
+  0xA2, 0x00, 0x93, 0x56, 0xAD, 0x54, 0x40, 0x8A, 0x88, 0xA8, 0x80, 0x8A,
+  0x94, 0xA2, 0x11, 0x00, 0xF8, 0x88, 0x8F, 0x80, 0x69, 0x28, 0x92, 0x60,
+  0x09, 0xC9, 0x22, 0x92, 0xC0, 0xED, 0xC0 };
+
+const RleGlyph arial5pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0, 0 },  // 0x20 ' '
+  {     1,   1,   7,   3,    1,   -6, 0 },  // 0x21 '!'
+  {     2,   3,   3,   4,    0,   -6, 0 },  // 0x22 '"'
+  {     4,   5,   7,   6,    0,   -6, 0 },  // 0x23 '#'
+  {     9,   5,   8,   6,    0,   -6, 0 },  // 0x24 '$'
+  {    14,   7,   7,   9,    1,   -6, 0 },  // 0x25 '%'
+  {    21,   7,   7,   7,    0,   -6, 0 },  // 0x26 '&'
+  {    28,   1,   3,   2,    0,   -6, 0 },  // 0x27 '''
+  {    29,   3,   9,   3,    0,   -6, 0 },  // 0x28 '('
+  {    33,   3,   9,   3,    0,   -6, 0 },  // 0x29 ')'
+  {    37,   3,   3,   4,    0,   -6, 0 },  // 0x2A '*'
+  {    39,   5,   5,   6,    0,   -5, 0 },  // 0x2B '+'
+  {    43,   1,   2,   3,    1,    0, 0 },  // 0x2C ','
+  {    44,   2,   1,   3,    0,   -2, 0 },  // 0x2D '-'
+  {    45,   1,   1,   3,    1,    0, 0 },  // 0x2E '.'
+  {    46,   3,   7,   3,    0,   -6, 0 },  // 0x2F '/'
+  {    49,   5,   7,   6,    0,   -6, 2 },  // 0x30 '0'
+  {    53,   3,   7,   6,    1,   -6, 0 },  // 0x31 '1'
+  {    56,   5,   7,   6,    0,   -6, 0 },  // 0x32 '2'
+  {    61,   5,   7,   6,    0,   -6, 0 },  // 0x33 '3'
+  {    66,   6,   7,   6,    0,   -6, 0 },  // 0x34 '4'
+  {    72,   5,   7,   6,    0,   -6, 0 },  // 0x35 '5'
+  {    77,   5,   7,   6,    0,   -6, 0 },  // 0x36 '6'
+  {    82,   5,   7,   6,    0,   -6, 0 },  // 0x37 '7'
+  {    87,   5,   7,   6,    0,   -6, 2 },  // 0x38 '8'
+  {    91,   5,   7,   6,    0,   -6, 0 },  // 0x39 '9'
+  {    96,   1,   5,   3,    1,   -4, 0 },  // 0x3A ':'
+  {    97,   1,   6,   3,    1,   -4, 0 },  // 0x3B ';'
+  {    98,   4,   5,   6,    1,   -5, 0 },  // 0x3C '<'
+  {   101,   5,   3,   6,    0,   -4, 0 },  // 0x3D '='
+  {   103,   4,   5,   6,    1,   -5, 0 },  // 0x3E '>'
+  {   106,   6,   7,   6,    0,   -6, 0 },  // 0x3F '?'
+  {   112,   9,   9,  10,    1,   -6, 0 },  // 0x40 '@'
+  {   123,   7,   7,   7,    0,   -6, 0 },  // 0x41 'A'
+  {   130,   5,   7,   7,    1,   -6, 0 },  // 0x42 'B'
+  {   135,   5,   7,   7,    1,   -6, 2 },  // 0x43 'C'
+  {   139,   5,   7,   7,    1,   -6, 0 },  // 0x44 'D'
+  {   144,   5,   7,   7,    1,   -6, 0 },  // 0x45 'E'
+  {   149,   4,   7,   6,    1,   -6, 0 },  // 0x46 'F'
+  {   153,   6,   7,   8,    1,   -6, 0 },  // 0x47 'G'
+  {   159,   5,   7,   7,    1,   -6, 0 },  // 0x48 'H'
+  {   164,   1,   7,   3,    1,   -6, 0 },  // 0x49 'I'
+  {   165,   4,   7,   5,    0,   -6, 0 },  // 0x4A 'J'
+  {   169,   6,   7,   7,    1,   -6, 0 },  // 0x4B 'K'
+  {   175,   5,   7,   6,    1,   -6, 2 },  // 0x4C 'L'
+  {   178,   7,   7,   9,    1,   -6, 0 },  // 0x4D 'M'
+  {   185,   5,   7,   7,    1,   -6, 0 },  // 0x4E 'N'
+  {   190,   6,   7,   8,    1,   -6, 2 },  // 0x4F 'O'
+  {   194,   5,   7,   7,    1,   -6, 0 },  // 0x50 'P'
+  {   199,   6,   7,   8,    1,   -6, 2 },  // 0x51 'Q'
+  {   204,   5,   7,   7,    1,   -6, 0 },  // 0x52 'R'
+  {   209,   5,   7,   7,    1,   -6, 0 },  // 0x53 'S'
+  {   214,   5,   7,   7,    1,   -6, 2 },  // 0x54 'T'
+  {   217,   5,   7,   7,    1,   -6, 2 },  // 0x55 'U'
+  {   221,   7,   7,   7,    0,   -6, 0 },  // 0x56 'V'
+  {   228,   9,   7,   9,    0,   -6, 0 },  // 0x57 'W'
+  {   236,   7,   7,   7,    0,   -6, 0 },  // 0x58 'X'
+  {   243,   7,   7,   7,    0,   -6, 0 },  // 0x59 'Y'
+  {   250,   6,   7,   6,    0,   -6, 0 },  // 0x5A 'Z'
+  {   256,   2,   9,   3,    1,   -6, 0 },  // 0x5B '['
+  {   259,   3,   7,   3,    0,   -6, 0 },  // 0x5C
+  {   262,   2,   9,   3,    0,   -6, 0 },  // 0x5D ']'
+  {   265,   5,   4,   5,    0,   -6, 0 },  // 0x5E '^'
+  {   268,   6,   1,   6,    0,    2, 0 },  // 0x5F '_'
+  {   269,   2,   2,   3,    0,   -6, 0 },  // 0x60 '`'
+  {   270,   4,   5,   6,    1,   -4, 0 },  // 0x61 'a'
+  {   273,   4,   7,   6,    1,   -6, 0 },  // 0x62 'b'
+  {   277,   4,   5,   6,    1,   -4, 0 },  // 0x63 'c'
+  {   280,   4,   7,   6,    1,   -6, 0 },  // 0x64 'd'
+  {   284,   4,   5,   6,    1,   -4, 0 },  // 0x65 'e'
+  {   287,   3,   7,   3,    0,   -6, 0 },  // 0x66 'f'
+  {   290,   4,   7,   6,    1,   -4, 0 },  // 0x67 'g'
+  {   294,   4,   7,   6,    1,   -6, 0 },  // 0x68 'h'
+  {   298,   1,   7,   3,    1,   -6, 0 },  // 0x69 'i'
+  {   299,   2,   9,   3,    0,   -6, 0 },  // 0x6A 'j'
+  {   302,   4,   7,   4,    0,   -6, 0 },  // 0x6B 'k'
+  {   164,   1,   7,   3,    1,   -6, 0 },  // 0x6C 'l'
+  {   306,   7,   5,   9,    1,   -4, 2 },  // 0x6D 'm'
+  {   310,   4,   5,   6,    1,   -4, 0 },  // 0x6E 'n'
+  {   313,   4,   5,   6,    1,   -4, 0 },  // 0x6F 'o'
+  {   316,   4,   7,   6,    1,   -4, 0 },  // 0x70 'p'
+  {   320,   4,   7,   6,    1,   -4, 0 },  // 0x71 'q'
+  {   324,   2,   5,   3,    1,   -4, 0 },  // 0x72 'r'
+  {   326,   4,   5,   4,    0,   -4, 2 },  // 0x73 's'
+  {   328,   3,   7,   3,    0,   -6, 0 },  // 0x74 't'
+  {   331,   4,   5,   6,    1,   -4, 0 },  // 0x75 'u'
+  {   334,   5,   5,   5,    0,   -4, 0 },  // 0x76 'v'
+  {   338,   7,   5,   7,    0,   -4, 0 },  // 0x77 'w'
+  {   343,   5,   5,   5,    0,   -4, 0 },  // 0x78 'x'
+  {   347,   5,   7,   5,    0,   -4, 0 },  // 0x79 'y'
+  {   352,   5,   5,   5,    0,   -4, 0 },  // 0x7A 'z'
+  {   356,   3,   9,   3,    0,   -6, 0 },  // 0x7B '{'
+  {   360,   1,   9,   3,    1,   -6, 1 },  // 0x7C '|'
+  {   361,   3,   9,   3,    0,   -6, 0 },  // 0x7D '}'
+  {   365,   5,   2,   6,    0,   -3, 0 }   // 0x7E '~'
+};
+
+const RleFont arial5pt7bRle PROGMEM = {
+  arial5pt7bRleData,
+  arial5pt7bRleGlyphs,
+  0x20, 0x7E, 11 };
+
+#endif // ARIAL5PT7BRLE_H_
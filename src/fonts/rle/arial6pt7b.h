@@ -0,0 +1,152 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial6pt7b.h, do not edit.
+// 95 glyphs (2 sharing another's bitmap), 484 bytes of bitmap data (GFXfont: 523)
+#ifndef ARIAL6PT7BRLE_H_
+#define ARIAL6PT7BRLE_H_
+
+const uint8_t arial6pt7bRleData[] PROGMEM = {
+  0x00, 0xFE, 0x80, 0xB6, 0x80, 0x14, 0x2B, 0xF9, 0x42, 0x9F, 0xCA, 0x28,
+  0x50, 0x75, 0x69, 0x47, 0x16, 0xB5, 0x71, 0x00, 0x62, 0x4A, 0x25, 0x13,
+  0x06, 0xB0, 0x64, 0x52, 0x29, 0x23, 0x00, 0x30, 0x91, 0x22, 0x86, 0x12,
+  0xA2, 0x46, 0x72, 0xE0, 0x29, 0x49, 0x24, 0x48, 0x80, 0x89, 0x12, 0x49,
+  0x4A, 0x00, 0x27, 0xC8, 0xA0, 0x21, 0x3E, 0x42, 0x00, 0xE0, 0x80, 0x25,
+  0x24, 0x94, 0x80, 0x13, 0x15, 0xFF, 0x05, 0x2E, 0x92, 0x49, 0x20, 0x74,
+  0x42, 0x11, 0x08, 0x88, 0xF8, 0x74, 0x42, 0x13, 0x04, 0x31, 0x70, 0x11,
+  0x8C, 0xA5, 0x4B, 0xE2, 0x10, 0x7A, 0x21, 0xE8, 0x84, 0x31, 0x70, 0x74,
+  0x61, 0x6C, 0xC6, 0x31, 0x70, 0x08, 0x11, 0x72, 0xC2, 0xC0, 0x13, 0x15,
+  0xAA, 0xA5, 0x74, 0x63, 0x19, 0xB4, 0x31, 0x70, 0x82, 0x83, 0x80, 0x0B,
+  0xA0, 0xE0, 0x80, 0x06, 0xC6, 0x83, 0x82, 0xE8, 0x00, 0x74, 0x62, 0x11,
+  0x10, 0x80, 0x20, 0x0F, 0x06, 0x19, 0x01, 0x26, 0x99, 0x33, 0x44, 0x68,
+  0x8D, 0x12, 0x9F, 0x88, 0x04, 0x83, 0x0F, 0x80, 0x10, 0x50, 0xA1, 0x44,
+  0x4F, 0x91, 0x41, 0x82, 0x05, 0x25, 0xD4, 0x24, 0xE5, 0x38, 0x8A, 0x0C,
+  0x08, 0x10, 0x20, 0xA2, 0x38, 0x05, 0x35, 0x62, 0xFF, 0x32, 0x15, 0x10,
+  0x06, 0x15, 0xD5, 0x15, 0xD5, 0x05, 0x14, 0xB3, 0x23, 0xF1, 0x38, 0x8A,
+  0x0C, 0x08, 0xF0, 0x60, 0xA2, 0x38, 0x01, 0x51, 0xF7, 0x52, 0x5F, 0x70,
+  0x09, 0x41, 0xFA, 0x19, 0x50, 0x83, 0x0A, 0x24, 0x8A, 0x1A, 0x22, 0x42,
+  0x82, 0x01, 0xFF, 0xF3, 0x50, 0x83, 0x8F, 0x1D, 0x5A, 0xB5, 0x6A, 0xC9,
+  0x92, 0x83, 0x86, 0x8D, 0x19, 0x31, 0x62, 0xC3, 0x82, 0x38, 0x8A, 0x0C,
+  0x18, 0x30, 0x60, 0xA2, 0x38, 0x05, 0x25, 0xD5, 0x14, 0xF4, 0x38, 0x8A,
+  0x0C, 0x18, 0x30, 0x66, 0xA2, 0x3A, 0x00, 0xFD, 0x06, 0x0C, 0x1F, 0xD1,
+  0x21, 0x42, 0x82, 0x14, 0x16, 0xB6, 0x26, 0xB6, 0x0A, 0x13, 0xFF, 0xF4,
+  0x01, 0x51, 0xFF, 0xC2, 0x32, 0x15, 0x10, 0x83, 0x05, 0x12, 0x24, 0x45,
+  0x0A, 0x08, 0x10, 0x01, 0x41, 0x41, 0x43, 0xD4, 0xC2, 0x12, 0xFB, 0x33,
+  0x3C, 0x82, 0x89, 0x11, 0x41, 0x05, 0x11, 0x22, 0x82, 0x82, 0x89, 0x11,
+  0x41, 0x02, 0x04, 0x08, 0x10, 0x7E, 0x08, 0x20, 0x41, 0x04, 0x08, 0x20,
+  0xFE, 0xEA, 0xAA, 0xAC, 0x91, 0x24, 0x91, 0x20, 0xD5, 0x55, 0x5C, 0x22,
+  0x94, 0xA8, 0x80, 0xFE, 0x90, 0x74, 0x42, 0xF8, 0xCD, 0xA0, 0x84, 0x2D,
+  0x98, 0xC6, 0x39, 0xB0, 0x69, 0x88, 0x89, 0x60, 0x08, 0x5B, 0x38, 0xC6,
+  0x33, 0x68, 0x74, 0x63, 0xF8, 0x45, 0xC0, 0x34, 0xE4, 0x44, 0x44, 0x40,
+  0x6C, 0xE3, 0x18, 0xCD, 0xA1, 0xF0, 0x01, 0xB2, 0x24, 0x11, 0xF8, 0xBF,
+  0x80, 0x20, 0x92, 0x49, 0x25, 0x00, 0x84, 0x23, 0x2A, 0x72, 0x52, 0x88,
+  0xB3, 0x66, 0x62, 0x31, 0x18, 0x8C, 0x46, 0x22, 0xB6, 0x63, 0x18, 0xC6,
+  0x20, 0x13, 0x15, 0xF5, 0x50, 0xB6, 0x63, 0x18, 0xE6, 0xD0, 0x80, 0x6C,
+  0xE3, 0x18, 0xCD, 0xA1, 0x08, 0xBA, 0x49, 0x20, 0x74, 0x60, 0xE0, 0xC5,
+  0xC0, 0x4B, 0xA4, 0x92, 0x60, 0x01, 0x31, 0xFA, 0x41, 0x8C, 0x54, 0xA5,
+  0x10, 0x80, 0x88, 0xC4, 0x55, 0x4A, 0xA5, 0x51, 0x10, 0x88, 0x8A, 0x94,
+  0x45, 0x2A, 0x20, 0x8C, 0x54, 0xA5, 0x10, 0x84, 0x40, 0xF8, 0x84, 0x44,
+  0x23, 0xE0, 0x29, 0x25, 0x12, 0x48, 0x80, 0x0B, 0x89, 0x24, 0x52, 0x4A,
+  0x00, 0x01, 0x99, 0x80 };
+
+const RleGlyph arial6pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0, 0 },  // 0x20 ' '
+  {     1,   1,   9,   3,    1,   -8, 0 },  // 0x21 '!'
+  {     3,   3,   3,   4,    0,   -8, 0 },  // 0x22 '"'
+  {     5,   7,   9,   7,    0,   -8, 0 },  // 0x23 '#'
+  {    13,   5,  10,   7,    1,   -8, 0 },  // 0x24 '$'
+  {    20,   9,   9,  11,    1,   -8, 0 },  // 0x25 '%'
+  {    31,   7,   9,   8,    1,   -8, 0 },  // 0x26 '&'
+  {    39,   1,   3,   2,    1,   -8, 0 },  // 0x27 '''
+  {    40,   3,  11,   4,    1,   -8, 0 },  // 0x28 '('
+  {    45,   3,  11,   4,    0,   -8, 0 },  // 0x29 ')'
+  {    50,   5,   4,   5,    0,   -8, 0 },  // 0x2A '*'
+  {    53,   5,   5,   7,    1,   -6, 0 },  // 0x2B '+'
+  {    39,   1,   3,   3,    1,    0, 0 },  // 0x2C ','
+  {    57,   3,   1,   4,    0,   -3, 0 },  // 0x2D '-'
+  {    58,   1,   1,   3,    1,    0, 0 },  // 0x2E '.'
+  {    59,   3,   9,   3,    0,   -8, 0 },  // 0x2F '/'
+  {    63,   5,   9,   7,    1,   -8, 2 },  // 0x30 '0'
+  {    67,   3,   9,   7,    1,   -8, 0 },  // 0x31 '1'
+  {    71,   5,   9,   7,    1,   -8, 0 },  // 0x32 '2'
+  {    77,   5,   9,   7,    1,   -8, 0 },  // 0x33 '3'
+  {    83,   5,   9,   7,    1,   -8, 0 },  // 0x34 '4'
+  {    89,   5,   9,   7,    1,   -8, 0 },  // 0x35 '5'
+  {    95,   5,   9,   7,    1,   -8, 0 },  // 0x36 '6'
+  {   101,   5,   9,   7,    1,   -8, 2 },  // 0x37 '7'
+  {   106,   5,   9,   7,    1,   -8, 2 },  // 0x38 '8'
+  {   110,   5,   9,   7,    1,   -8, 0 },  // 0x39 '9'
+  {   116,   1,   7,   3,    1,   -6, 0 },  // 0x3A ':'
+  {   117,   1,   9,   3,    1,   -6, 0 },  // 0x3B ';'
+  {   119,   5,   5,   7,    1,   -6, 0 },  // 0x3C '<'
+  {   123,   6,   4,   7,    0,   -5, 1 },  // 0x3D '='
+  {   125,   5,   5,   7,    1,   -6, 0 },  // 0x3E '>'
+  {   129,   5,   9,   7,    1,   -8, 0 },  // 0x3F '?'
+  {   135,  11,  12,  12,    1,   -8, 0 },  // 0x40 '@'
+  {   152,   7,   9,   7,    0,   -8, 0 },  // 0x41 'A'
+  {   160,   6,   9,   8,    1,   -8, 2 },  // 0x42 'B'
+  {   165,   7,   9,   9,    1,   -8, 0 },  // 0x43 'C'
+  {   173,   7,   9,   9,    1,   -8, 2 },  // 0x44 'D'
+  {   180,   6,   9,   8,    1,   -8, 2 },  // 0x45 'E'
+  {   185,   5,   9,   7,    1,   -8, 2 },  // 0x46 'F'
+  {   190,   7,   9,   9,    1,   -8, 0 },  // 0x47 'G'
+  {   198,   7,   9,   9,    1,   -8, 2 },  // 0x48 'H'
+  {   204,   1,   9,   3,    1,   -8, 1 },  // 0x49 'I'
+  {   205,   5,   9,   6,    0,   -8, 2 },  // 0x4A 'J'
+  {   209,   7,   9,   8,    1,   -8, 0 },  // 0x4B 'K'
+  {   217,   6,   9,   7,    1,   -8, 2 },  // 0x4C 'L'
+  {   221,   7,   9,   9,    1,   -8, 0 },  // 0x4D 'M'
+  {   229,   7,   9,   9,    1,   -8, 0 },  // 0x4E 'N'
+  {   237,   7,   9,   9,    1,   -8, 0 },  // 0x4F 'O'
+  {   245,   6,   9,   8,    1,   -8, 2 },  // 0x50 'P'
+  {   250,   7,  10,   9,    1,   -8, 0 },  // 0x51 'Q'
+  {   259,   7,   9,   9,    1,   -8, 0 },  // 0x52 'R'
+  {   267,   6,   9,   8,    1,   -8, 2 },  // 0x53 'S'
+  {   272,   7,   9,   7,    0,   -8, 2 },  // 0x54 'T'
+  {   276,   7,   9,   9,    1,   -8, 2 },  // 0x55 'U'
+  {   283,   7,   9,   7,    0,   -8, 0 },  // 0x56 'V'
+  {   291,  11,   9,  11,    0,   -8, 2 },  // 0x57 'W'
+  {   301,   7,   9,   7,    0,   -8, 0 },  // 0x58 'X'
+  {   309,   7,   9,   7,    0,   -8, 0 },  // 0x59 'Y'
+  {   317,   7,   9,   7,    0,   -8, 0 },  // 0x5A 'Z'
+  {   325,   2,  11,   3,    1,   -8, 0 },  // 0x5B '['
+  {   328,   3,   9,   3,    0,   -8, 0 },  // 0x5C
+  {   332,   2,  11,   3,    0,   -8, 0 },  // 0x5D ']'
+  {   335,   5,   5,   5,    0,   -8, 0 },  // 0x5E '^'
+  {   339,   7,   1,   7,    0,    2, 0 },  // 0x5F '_'
+  {   340,   2,   2,   4,    1,   -8, 0 },  // 0x60 '`'
+  {   341,   5,   7,   7,    1,   -6, 0 },  // 0x61 'a'
+  {   346,   5,   9,   7,    1,   -8, 0 },  // 0x62 'b'
+  {   352,   4,   7,   6,    1,   -6, 0 },  // 0x63 'c'
+  {   356,   5,   9,   7,    1,   -8, 0 },  // 0x64 'd'
+  {   362,   5,   7,   7,    1,   -6, 0 },  // 0x65 'e'
+  {   367,   4,   9,   3,    0,   -8, 0 },  // 0x66 'f'
+  {   372,   5,   9,   7,    1,   -6, 0 },  // 0x67 'g'
+  {   378,   5,   9,   7,    1,   -8, 2 },  // 0x68 'h'
+  {   383,   1,   9,   3,    1,   -8, 0 },  // 0x69 'i'
+  {   385,   3,  11,   3,   -1,   -8, 0 },  // 0x6A 'j'
+  {   390,   5,   9,   6,    1,   -8, 0 },  // 0x6B 'k'
+  {   204,   1,   9,   3,    1,   -8, 1 },  // 0x6C 'l'
+  {   396,   9,   7,  11,    1,   -6, 0 },  // 0x6D 'm'
+  {   404,   5,   7,   7,    1,   -6, 0 },  // 0x6E 'n'
+  {   409,   5,   7,   7,    1,   -6, 2 },  // 0x6F 'o'
+  {   413,   5,   9,   7,    1,   -6, 0 },  // 0x70 'p'
+  {   419,   5,   9,   7,    1,   -6, 0 },  // 0x71 'q'
+  {   425,   3,   7,   4,    1,   -6, 0 },  // 0x72 'r'
+  {   428,   5,   7,   7,    1,   -6, 0 },  // 0x73 's'
+  {   433,   3,   9,   3,    0,   -8, 0 },  // 0x74 't'
+  {   437,   5,   7,   7,    1,   -6, 2 },  // 0x75 'u'
+  {   441,   5,   7,   5,    0,   -6, 0 },  // 0x76 'v'
+  {   446,   9,   7,   9,    0,   -6, 0 },  // 0x77 'w'
+  {   454,   5,   7,   5,    0,   -6, 0 },  // 0x78 'x'
+  {   459,   5,   9,   5,    0,   -6, 0 },  // 0x79 'y'
+  {   465,   5,   7,   5,    0,   -6, 0 },  // 0x7A 'z'
+  {   470,   3,  11,   4,    0,   -8, 0 },  // 0x7B '{'
+  {   475,   1,  11,   3,    1,   -8, 1 },  // 0x7C '|'
+  {   476,   3,  11,   4,    1,   -8, 0 },  // 0x7D '}'
+  {   481,   6,   4,   7,    1,   -5, 0 }   // 0x7E '~'
+};
+
+const RleFont arial6pt7bRle PROGMEM = {
+  arial6pt7bRleData,
+  arial6pt7bRleGlyphs,
+  0x20, 0x7E, 14 };
+
+#endif // ARIAL6PT7BRLE_H_
@@ -0,0 +1,160 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial7pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 587 bytes of bitmap data (GFXfont: 668)
+#ifndef ARIAL7PT7BRLE_H_
+#define ARIAL7PT7BRLE_H_
+
+const uint8_t arial7pt7bRleData[] PROGMEM = {
+  0x00, 0xFF, 0x40, 0xB6, 0xD0, 0x12, 0x12, 0x24, 0xFF, 0x24, 0x24, 0xFF,
+  0x48, 0x48, 0x48, 0x10, 0x79, 0x4C, 0x89, 0x0E, 0x07, 0x09, 0x13, 0x29,
+  0xE0, 0x80, 0x61, 0x24, 0x89, 0x22, 0x50, 0x64, 0x02, 0x60, 0xA4, 0x49,
+  0x12, 0x48, 0x60, 0x38, 0x44, 0x44, 0x48, 0x30, 0x50, 0x8A, 0x84, 0x86,
+  0x79, 0xF0, 0x29, 0x49, 0x24, 0x91, 0x22, 0x89, 0x12, 0x49, 0x25, 0x28,
+  0x27, 0xC8, 0xA0, 0x31, 0xF2, 0x31, 0x61, 0x3E, 0xE0, 0xF0, 0x80, 0x11,
+  0x22, 0x24, 0x44, 0x88, 0x14, 0x16, 0xFF, 0xC6, 0x2E, 0x92, 0x49, 0x24,
+  0x7A, 0x18, 0x41, 0x04, 0x21, 0x08, 0x43, 0xF0, 0x14, 0x16, 0x61, 0x74,
+  0x24, 0x61, 0xB6, 0x04, 0x18, 0x51, 0x22, 0x48, 0xA1, 0x7F, 0x04, 0x08,
+  0x15, 0x26, 0x54, 0x26, 0xB1, 0x96, 0x20, 0x39, 0x18, 0x20, 0xBB, 0x18,
+  0x61, 0x85, 0xE0, 0x0B, 0x52, 0x92, 0xF0, 0x2E, 0x14, 0x16, 0xCC, 0xF3,
+  0x60, 0x7A, 0x18, 0x61, 0x8D, 0xD0, 0x41, 0x89, 0xC0, 0x81, 0x81, 0xC0,
+  0x04, 0x66, 0x20, 0x60, 0x60, 0x40, 0x06, 0xC6, 0x81, 0x81, 0x81, 0x19,
+  0x88, 0x00, 0x7A, 0x18, 0x41, 0x08, 0x42, 0x08, 0x00, 0x80, 0x0F, 0xC1,
+  0x81, 0x10, 0x04, 0x8E, 0x98, 0x8C, 0xC8, 0x26, 0x42, 0x32, 0x12, 0x91,
+  0x92, 0x77, 0x10, 0x02, 0x60, 0x60, 0xFC, 0x00, 0x41, 0x73, 0xF8, 0x21,
+  0x2C, 0x11, 0x31, 0x13, 0x52, 0x25, 0x29, 0x06, 0x26, 0xF0, 0x61, 0x6F,
+  0x76, 0x3C, 0x42, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x42, 0x3C, 0x06,
+  0x36, 0x72, 0xFF, 0xF1, 0x21, 0x61, 0x07, 0x16, 0xF0, 0x61, 0x6F, 0x76,
+  0x07, 0x16, 0xF0, 0x52, 0x5F, 0xE0, 0x25, 0x37, 0x12, 0x52, 0x81, 0xE4,
+  0x53, 0xA2, 0x52, 0x17, 0x10, 0x01, 0x51, 0xF7, 0x52, 0x5F, 0xE0, 0x0A,
+  0x41, 0xFF, 0x01, 0x95, 0x81, 0x82, 0x84, 0x88, 0x90, 0xA8, 0xC4, 0x84,
+  0x82, 0x81, 0x01, 0xFF, 0xFF, 0x36, 0x01, 0x71, 0x11, 0x51, 0xB2, 0x32,
+  0xC2, 0x12, 0xF8, 0x3C, 0x83, 0x86, 0x8D, 0x19, 0x32, 0x62, 0xC5, 0x87,
+  0x04, 0x25, 0x37, 0x12, 0x52, 0xFF, 0xF0, 0x25, 0x21, 0x71, 0x06, 0x26,
+  0xF7, 0x61, 0x5F, 0x70, 0x25, 0x37, 0x12, 0x52, 0xFF, 0xB1, 0x14, 0x32,
+  0x36, 0x11, 0x24, 0x12, 0x07, 0x27, 0xFA, 0x71, 0x31, 0x25, 0x27, 0x27,
+  0x20, 0x15, 0x17, 0xD5, 0x46, 0x42, 0x11, 0xD7, 0x0A, 0x13, 0xFF, 0xFB,
+  0x01, 0x51, 0xFF, 0xF4, 0x23, 0x21, 0x51, 0x01, 0x71, 0x92, 0x52, 0xA2,
+  0x32, 0xC2, 0x12, 0xE3, 0xC0, 0x01, 0x51, 0x51, 0x53, 0x52, 0x92, 0xFC,
+  0x21, 0x21, 0x21, 0x2F, 0xE3, 0x33, 0xF0, 0x81, 0x42, 0x42, 0x24, 0x18,
+  0x18, 0x24, 0x42, 0x42, 0x81, 0x01, 0x73, 0x52, 0x12, 0x32, 0xC2, 0x12,
+  0x53, 0xFF, 0x90, 0x7F, 0x02, 0x04, 0x04, 0x08, 0x10, 0x20, 0x20, 0x40,
+  0xFF, 0xEA, 0xAA, 0xAA, 0xC0, 0x88, 0x44, 0x42, 0x22, 0x11, 0x03, 0xF6,
+  0x11, 0x22, 0x94, 0xA8, 0x80, 0xFF, 0x90, 0x7A, 0x10, 0x4F, 0x46, 0x18,
+  0xDD, 0x01, 0xD3, 0x25, 0x11, 0xF8, 0x15, 0x50, 0x74, 0x61, 0x08, 0x42,
+  0x2E, 0x51, 0x73, 0x25, 0x51, 0xF8, 0x11, 0x51, 0x14, 0x16, 0x74, 0x25,
+  0xB7, 0x34, 0xF4, 0x44, 0x44, 0x44, 0x76, 0x38, 0x61, 0x86, 0x18, 0xDD,
+  0x06, 0x17, 0x80, 0x01, 0xD3, 0x25, 0x11, 0xFF, 0x40, 0xBF, 0xC0, 0x20,
+  0x92, 0x49, 0x24, 0x9C, 0x82, 0x08, 0x62, 0x92, 0x8D, 0x22, 0x8A, 0x10,
+  0xB7, 0x66, 0x62, 0x31, 0x18, 0x8C, 0x46, 0x23, 0x11, 0xBB, 0x18, 0x61,
+  0x86, 0x18, 0x61, 0x14, 0x16, 0xFF, 0x06, 0x01, 0x13, 0x25, 0x11, 0xF8,
+  0x15, 0x52, 0x3D, 0x13, 0x16, 0x51, 0xF8, 0x11, 0x52, 0x3E, 0xBC, 0x88,
+  0x88, 0x88, 0x74, 0x60, 0xE0, 0x86, 0x2E, 0x04, 0x4F, 0x44, 0x44, 0x44,
+  0x70, 0x86, 0x18, 0x61, 0x86, 0x18, 0xDD, 0x83, 0x05, 0x12, 0x22, 0x85,
+  0x04, 0x08, 0x88, 0xC4, 0x55, 0x4A, 0xA5, 0x52, 0xA8, 0x88, 0x44, 0x85,
+  0x24, 0x8C, 0x31, 0x24, 0xA1, 0x83, 0x05, 0x12, 0x22, 0x85, 0x0A, 0x08,
+  0x10, 0x21, 0x80, 0xFC, 0x21, 0x04, 0x20, 0x84, 0x3F, 0x29, 0x24, 0xA2,
+  0x49, 0x22, 0x0D, 0x89, 0x24, 0x8A, 0x49, 0x28, 0x73, 0x3C, 0x00 };
+
+const RleGlyph arial7pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0, 0 },  // 0x20 ' '
+  {     1,   1,  10,   5,    2,   -9, 0 },  // 0x21 '!'
+  {     3,   3,   4,   5,    1,   -9, 0 },  // 0x22 '"'
+  {     5,   8,  10,   8,    0,   -9, 0 },  // 0x23 '#'
+  {    15,   7,  12,   8,    0,  -10, 0 },  // 0x24 '$'
+  {    26,  10,  10,  12,    1,   -9, 0 },  // 0x25 '%'
+  {    39,   8,  10,   9,    1,   -9, 0 },  // 0x26 '&'
+  {    49,   1,   4,   3,    1,   -9, 0 },  // 0x27 '''
+  {    50,   3,  13,   5,    1,   -9, 0 },  // 0x28 '('
+  {    55,   3,  13,   5,    1,   -9, 0 },  // 0x29 ')'
+  {    60,   5,   4,   5,    0,   -9, 0 },  // 0x2A '*'
+  {    63,   7,   7,   8,    1,   -7, 2 },  // 0x2B '+'
+  {    68,   1,   3,   4,    2,    0, 0 },  // 0x2C ','
+  {    69,   4,   1,   5,    0,   -3, 0 },  // 0x2D '-'
+  {    70,   1,   1,   4,    2,    0, 0 },  // 0x2E '.'
+  {    71,   4,  10,   4,    0,   -9, 0 },  // 0x2F '/'
+  {    76,   6,  10,   8,    1,   -9, 2 },  // 0x30 '0'
+  {    80,   3,  10,   8,    2,   -9, 0 },  // 0x31 '1'
+  {    84,   6,  10,   8,    1,   -9, 0 },  // 0x32 '2'
+  {    92,   6,  10,   8,    1,   -9, 2 },  // 0x33 '3'
+  {    99,   7,  10,   8,    0,   -9, 0 },  // 0x34 '4'
+  {   108,   6,  10,   8,    1,   -9, 2 },  // 0x35 '5'
+  {   115,   6,  10,   8,    1,   -9, 0 },  // 0x36 '6'
+  {   123,   6,  10,   8,    1,   -9, 2 },  // 0x37 '7'
+  {   128,   6,  10,   8,    1,   -9, 2 },  // 0x38 '8'
+  {   133,   6,  10,   8,    1,   -9, 0 },  // 0x39 '9'
+  {   141,   1,   8,   4,    1,   -7, 0 },  // 0x3A ':'
+  {   142,   1,  10,   4,    1,   -7, 0 },  // 0x3B ';'
+  {   144,   6,   7,   8,    1,   -7, 0 },  // 0x3C '<'
+  {   150,   6,   4,   8,    1,   -6, 1 },  // 0x3D '='
+  {   152,   6,   7,   8,    1,   -7, 0 },  // 0x3E '>'
+  {   158,   6,  10,   8,    1,   -9, 0 },  // 0x3F '?'
+  {   166,  13,  13,  14,    0,   -9, 0 },  // 0x40 '@'
+  {   188,   9,  10,   9,    0,   -9, 2 },  // 0x41 'A'
+  {   199,   7,  10,   9,    1,   -9, 2 },  // 0x42 'B'
+  {   205,   8,  10,  10,    1,   -9, 0 },  // 0x43 'C'
+  {   215,   8,  10,  10,    1,   -9, 2 },  // 0x44 'D'
+  {   222,   7,  10,   9,    1,   -9, 2 },  // 0x45 'E'
+  {   228,   7,  10,   9,    1,   -9, 2 },  // 0x46 'F'
+  {   234,   9,  10,  11,    1,   -9, 2 },  // 0x47 'G'
+  {   245,   7,  10,   9,    1,   -9, 2 },  // 0x48 'H'
+  {   251,   1,  10,   3,    1,   -9, 1 },  // 0x49 'I'
+  {   252,   5,  10,   6,    0,   -9, 2 },  // 0x4A 'J'
+  {   256,   8,  10,   9,    1,   -9, 0 },  // 0x4B 'K'
+  {   266,   7,  10,   8,    1,   -9, 2 },  // 0x4C 'L'
+  {   270,   9,  10,  11,    1,   -9, 2 },  // 0x4D 'M'
+  {   280,   7,  10,   9,    1,   -9, 0 },  // 0x4E 'N'
+  {   289,   9,  10,  11,    1,   -9, 2 },  // 0x4F 'O'
+  {   298,   7,  10,   9,    1,   -9, 2 },  // 0x50 'P'
+  {   304,   9,  11,  11,    1,   -9, 2 },  // 0x51 'Q'
+  {   316,   8,  10,  10,    1,   -9, 2 },  // 0x52 'R'
+  {   325,   7,  10,   9,    1,   -9, 2 },  // 0x53 'S'
+  {   332,   7,  10,   9,    1,   -9, 2 },  // 0x54 'T'
+  {   336,   7,  10,   9,    1,   -9, 2 },  // 0x55 'U'
+  {   343,   9,  10,   9,    0,   -9, 2 },  // 0x56 'V'
+  {   353,  13,  10,  13,    0,   -9, 2 },  // 0x57 'W'
+  {   367,   8,  10,   8,    0,   -9, 0 },  // 0x58 'X'
+  {   377,   9,  10,   9,    0,   -9, 2 },  // 0x59 'Y'
+  {   387,   8,  10,   8,    0,   -9, 0 },  // 0x5A 'Z'
+  {   397,   2,  13,   4,    1,   -9, 0 },  // 0x5B '['
+  {   401,   4,  10,   4,    0,   -9, 0 },  // 0x5C
+  {   406,   2,  13,   4,    1,   -9, 2 },  // 0x5D ']'
+  {   409,   5,   5,   5,    0,   -9, 0 },  // 0x5E '^'
+  {   413,   8,   1,   8,    0,    3, 0 },  // 0x5F '_'
+  {   414,   2,   2,   5,    1,   -9, 0 },  // 0x60 '`'
+  {   415,   6,   8,   8,    1,   -7, 0 },  // 0x61 'a'
+  {   421,   6,  10,   8,    1,   -9, 2 },  // 0x62 'b'
+  {   428,   5,   8,   7,    1,   -7, 0 },  // 0x63 'c'
+  {   433,   6,  10,   8,    1,   -9, 2 },  // 0x64 'd'
+  {   440,   6,   8,   8,    1,   -7, 2 },  // 0x65 'e'
+  {   445,   4,  10,   4,    0,   -9, 0 },  // 0x66 'f'
+  {   450,   6,  11,   8,    1,   -7, 0 },  // 0x67 'g'
+  {   459,   6,  10,   8,    1,   -9, 2 },  // 0x68 'h'
+  {   465,   1,  10,   3,    1,   -9, 0 },  // 0x69 'i'
+  {   467,   3,  13,   3,   -1,   -9, 0 },  // 0x6A 'j'
+  {   472,   6,  10,   7,    1,   -9, 0 },  // 0x6B 'k'
+  {   251,   1,  10,   3,    1,   -9, 1 },  // 0x6C 'l'
+  {   480,   9,   8,  11,    1,   -7, 0 },  // 0x6D 'm'
+  {   489,   6,   8,   8,    1,   -7, 0 },  // 0x6E 'n'
+  {   495,   6,   8,   8,    1,   -7, 2 },  // 0x6F 'o'
+  {   499,   6,  11,   8,    1,   -7, 2 },  // 0x70 'p'
+  {   507,   6,  11,   8,    1,   -7, 2 },  // 0x71 'q'
+  {   514,   4,   8,   5,    1,   -7, 0 },  // 0x72 'r'
+  {   518,   5,   8,   7,    1,   -7, 0 },  // 0x73 's'
+  {   523,   4,  11,   4,    0,  -10, 0 },  // 0x74 't'
+  {   529,   6,   8,   8,    1,   -7, 0 },  // 0x75 'u'
+  {   535,   7,   8,   7,    0,   -7, 0 },  // 0x76 'v'
+  {   542,   9,   8,   9,    0,   -7, 0 },  // 0x77 'w'
+  {   551,   6,   8,   6,    0,   -7, 0 },  // 0x78 'x'
+  {   557,   7,  11,   7,    0,   -7, 0 },  // 0x79 'y'
+  {   567,   6,   8,   6,    0,   -7, 0 },  // 0x7A 'z'
+  {   573,   3,  13,   5,    1,   -9, 0 },  // 0x7B '{'
+  {   578,   1,  13,   3,    1,   -9, 1 },  // 0x7C '|'
+  {   579,   3,  13,   5,    1,   -9, 0 },  // 0x7D '}'
+  {   584,   7,   3,   8,    0,   -5, 0 }   // 0x7E '~'
+};
+
+const RleFont arial7pt7bRle PROGMEM = {
+  arial7pt7bRleData,
+  arial7pt7bRleGlyphs,
+  0x20, 0x7E, 16 };
+
+#endif // ARIAL7PT7BRLE_H_
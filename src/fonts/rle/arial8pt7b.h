@@ -0,0 +1,174 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial8pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 755 bytes of bitmap data (GFXfont: 892)
+#ifndef ARIAL8PT7BRLE_H_
+#define ARIAL8PT7BRLE_H_
+
+const uint8_t arial8pt7bRleData[] PROGMEM = {
+  0x00, 0xFF, 0xD0, 0x99, 0x99, 0x11, 0x08, 0x84, 0x44, 0x4F, 0xF9, 0x10,
+  0x88, 0x44, 0xFF, 0xA2, 0x11, 0x08, 0x80, 0x10, 0x79, 0x4C, 0x99, 0x12,
+  0x1C, 0x0E, 0x12, 0x26, 0x4A, 0xA3, 0x82, 0x00, 0x13, 0x41, 0x35, 0x22,
+  0xF6, 0x2F, 0x15, 0x83, 0x12, 0x13, 0x85, 0x42, 0xF6, 0x2E, 0x50, 0x38,
+  0x22, 0x11, 0x08, 0x82, 0x81, 0x81, 0x41, 0x11, 0x85, 0x41, 0x11, 0x47,
+  0x10, 0xF0, 0x29, 0x29, 0x24, 0x92, 0x24, 0x88, 0x89, 0x22, 0x49, 0x24,
+  0xA4, 0xA0, 0x27, 0xC8, 0xA5, 0x00, 0x31, 0xF2, 0x31, 0x61, 0x3E, 0xE0,
+  0xF0, 0x80, 0x31, 0x62, 0xD2, 0xD2, 0x60, 0x23, 0x35, 0x12, 0x32, 0xFF,
+  0xF4, 0x23, 0x21, 0x51, 0x13, 0x59, 0x11, 0x11, 0x11, 0x11, 0x3C, 0x8A,
+  0x08, 0x10, 0x20, 0x81, 0x04, 0x10, 0x41, 0x07, 0xF0, 0x38, 0x8A, 0x10,
+  0x20, 0xC7, 0x01, 0x01, 0x03, 0x07, 0x11, 0xC0, 0x61, 0x61, 0x62, 0x52,
+  0xD2, 0x52, 0x52, 0x75, 0x17, 0x11, 0xF1, 0x7E, 0x81, 0x04, 0x0F, 0x90,
+  0x80, 0x81, 0x03, 0x05, 0x11, 0xC0, 0x38, 0x8A, 0x0C, 0x0B, 0x98, 0xA0,
+  0xC1, 0x83, 0x05, 0x11, 0xC0, 0x0B, 0x52, 0x92, 0xF6, 0x2F, 0x50, 0x38,
+  0x8A, 0x0C, 0x14, 0x47, 0x11, 0x41, 0x83, 0x05, 0x11, 0xC0, 0x38, 0x8A,
+  0x0C, 0x18, 0x30, 0x51, 0x9D, 0x03, 0x05, 0x11, 0xC0, 0x80, 0x80, 0x80,
+  0xE0, 0x02, 0x39, 0x84, 0x06, 0x03, 0x80, 0x80, 0x0E, 0xE7, 0x80, 0xE0,
+  0x30, 0x10, 0xCE, 0x20, 0x00, 0x38, 0x8A, 0x0C, 0x10, 0x20, 0x82, 0x08,
+  0x10, 0x20, 0x00, 0x80, 0x07, 0xE0, 0x30, 0x30, 0x80, 0x12, 0x1D, 0x24,
+  0x46, 0x31, 0x04, 0x64, 0x08, 0xC8, 0x21, 0x90, 0x43, 0x20, 0x8A, 0x23,
+  0x22, 0x3B, 0x82, 0x00, 0x23, 0x01, 0x81, 0xFC, 0x00, 0x41, 0x73, 0xF8,
+  0x21, 0x2F, 0x61, 0x13, 0x11, 0x35, 0xB2, 0x52, 0x90, 0x07, 0x37, 0x82,
+  0xF1, 0x21, 0x72, 0x78, 0x2F, 0xA2, 0x17, 0x10, 0x35, 0x47, 0x22, 0x54,
+  0x71, 0xFF, 0xF5, 0x27, 0x11, 0x25, 0x22, 0x71, 0x07, 0x47, 0x92, 0x92,
+  0xFF, 0xFD, 0x27, 0x22, 0x72, 0x09, 0x18, 0xFD, 0x72, 0x7F, 0xF8, 0x80,
+  0x08, 0x17, 0xFF, 0x36, 0x26, 0xFF, 0x30, 0x34, 0x56, 0x32, 0x42, 0x12,
+  0x61, 0xFB, 0x55, 0x4B, 0x26, 0x21, 0x24, 0x23, 0x62, 0x01, 0x71, 0xFF,
+  0x77, 0x27, 0xFF, 0xF1, 0x0C, 0x51, 0xFF, 0xC1, 0xF2, 0x60, 0x80, 0xC0,
+  0xA0, 0x90, 0x88, 0x84, 0xC2, 0xA1, 0x88, 0x82, 0x41, 0x20, 0x50, 0x10,
+  0x01, 0xFF, 0xFF, 0xF2, 0x60, 0x01, 0x91, 0x11, 0x71, 0xD2, 0x52, 0xE2,
+  0x32, 0xF1, 0x21, 0x2F, 0xE3, 0xF0, 0x01, 0x71, 0x11, 0x82, 0xF2, 0x28,
+  0x2F, 0x22, 0x82, 0xF2, 0x28, 0x11, 0x34, 0x56, 0x32, 0x42, 0x12, 0x62,
+  0xFF, 0xF5, 0x26, 0x21, 0x24, 0x23, 0x62, 0x07, 0x37, 0x82, 0xFA, 0x21,
+  0x72, 0x6F, 0xF8, 0x1E, 0x08, 0x44, 0x0A, 0x01, 0x80, 0x60, 0x18, 0x06,
+  0x01, 0x80, 0x51, 0xB2, 0x18, 0x7B, 0x07, 0x37, 0x82, 0xFA, 0x21, 0x72,
+  0x41, 0x17, 0x2F, 0x22, 0x82, 0x25, 0x37, 0x12, 0x52, 0x83, 0x84, 0x66,
+  0x64, 0x91, 0x82, 0x52, 0x17, 0x10, 0x0D, 0x14, 0xFF, 0xFF, 0xFF, 0x00,
+  0x01, 0x71, 0xFF, 0xFF, 0xF6, 0x25, 0x21, 0x71, 0x01, 0x71, 0x92, 0x52,
+  0xF4, 0x23, 0x2F, 0x62, 0x12, 0xE3, 0xC0, 0x01, 0x61, 0x61, 0x63, 0x62,
+  0xB2, 0xF5, 0x21, 0x2F, 0x62, 0x92, 0x52, 0x32, 0xFF, 0x63, 0x53, 0xF2,
+  0x40, 0x44, 0x10, 0x44, 0x08, 0x80, 0xA0, 0x08, 0x02, 0x80, 0x88, 0x11,
+  0x04, 0x11, 0x01, 0x40, 0x10, 0x01, 0x73, 0x52, 0xA2, 0x32, 0x32, 0x12,
+  0xE3, 0xFF, 0xF3, 0x18, 0x71, 0x71, 0x81, 0x71, 0x71, 0x81, 0x71, 0x71,
+  0x81, 0x71, 0x79, 0x03, 0x12, 0xFF, 0x72, 0x88, 0x44, 0x44, 0x22, 0x22,
+  0x11, 0x05, 0xFF, 0x72, 0x10, 0x10, 0x50, 0xA2, 0x24, 0x50, 0x40, 0x09,
+  0x90, 0x3C, 0x86, 0x08, 0x77, 0x30, 0x60, 0xC3, 0x7A, 0x01, 0xF7, 0x33,
+  0x52, 0x13, 0x2F, 0xE1, 0x32, 0x15, 0x10, 0x39, 0x18, 0x20, 0x82, 0x08,
+  0x11, 0x38, 0x61, 0xF1, 0x33, 0x51, 0x23, 0x1F, 0xE2, 0x31, 0x25, 0x10,
+  0x38, 0x8A, 0x0C, 0x1F, 0xF0, 0x20, 0xA2, 0x38, 0x34, 0x4F, 0x44, 0x44,
+  0x44, 0x44, 0x3A, 0x8E, 0x0C, 0x18, 0x30, 0x60, 0xA3, 0x3A, 0x06, 0x13,
+  0xC0, 0x01, 0xF4, 0x32, 0x51, 0x1F, 0xFA, 0x9F, 0xF0, 0x21, 0x21, 0x51,
+  0xFF, 0x03, 0x81, 0x02, 0x04, 0x18, 0x51, 0x24, 0x58, 0xC9, 0x12, 0x14,
+  0x10, 0x01, 0x13, 0x23, 0x2A, 0x11, 0x41, 0xFF, 0xFF, 0xA0, 0x01, 0x13,
+  0x25, 0x11, 0xFF, 0xA0, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xA2, 0x38,
+  0xB9, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xE2, 0xB9, 0x02, 0x04, 0x00, 0x3A,
+  0x8E, 0x0C, 0x18, 0x30, 0x60, 0xA3, 0x3A, 0x04, 0x08, 0x10, 0xBC, 0x88,
+  0x88, 0x88, 0x80, 0x7A, 0x18, 0x20, 0x78, 0x10, 0x61, 0x78, 0x04, 0x4F,
+  0x44, 0x44, 0x44, 0x47, 0x01, 0x41, 0xFF, 0xA1, 0x15, 0x10, 0x83, 0x05,
+  0x12, 0x22, 0x85, 0x0A, 0x08, 0x10, 0x01, 0x41, 0x41, 0xB2, 0x23, 0x22,
+  0xE2, 0x12, 0xFB, 0x33, 0x3C, 0x82, 0x88, 0xA1, 0x41, 0x05, 0x0A, 0x22,
+  0x82, 0x01, 0x51, 0xC4, 0xD2, 0x12, 0xF2, 0x27, 0x1A, 0x33, 0xFE, 0x08,
+  0x20, 0x41, 0x04, 0x08, 0x20, 0xFE, 0x32, 0x23, 0xFA, 0x32, 0x3F, 0xE3,
+  0xFF, 0xFE, 0x02, 0x33, 0xFE, 0x32, 0x3F, 0xA3, 0x20, 0x71, 0x8E };
+
+const RleGlyph arial8pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   4,    0,    0, 0 },  // 0x20 ' '
+  {     1,   1,  12,   5,    2,  -11, 0 },  // 0x21 '!'
+  {     3,   4,   4,   6,    1,  -11, 0 },  // 0x22 '"'
+  {     5,   9,  12,   9,    0,  -11, 0 },  // 0x23 '#'
+  {    19,   7,  14,   9,    1,  -12, 0 },  // 0x24 '$'
+  {    32,  12,  12,  14,    1,  -11, 2 },  // 0x25 '%'
+  {    47,   9,  12,  11,    1,  -11, 0 },  // 0x26 '&'
+  {    61,   1,   4,   3,    1,  -11, 0 },  // 0x27 '''
+  {    62,   3,  15,   5,    1,  -11, 0 },  // 0x28 '('
+  {    68,   3,  15,   5,    1,  -11, 0 },  // 0x29 ')'
+  {    74,   5,   5,   6,    0,  -11, 0 },  // 0x2A '*'
+  {    78,   7,   7,   9,    1,   -8, 2 },  // 0x2B '+'
+  {    83,   1,   4,   4,    2,    0, 0 },  // 0x2C ','
+  {    84,   4,   1,   5,    0,   -3, 0 },  // 0x2D '-'
+  {    85,   1,   1,   4,    2,    0, 0 },  // 0x2E '.'
+  {    86,   4,  12,   4,    0,  -11, 2 },  // 0x2F '/'
+  {    91,   7,  12,   9,    1,  -11, 2 },  // 0x30 '0'
+  {   100,   4,  12,   9,    2,  -11, 0 },  // 0x31 '1'
+  {   106,   7,  12,   9,    1,  -11, 0 },  // 0x32 '2'
+  {   117,   7,  12,   9,    1,  -11, 0 },  // 0x33 '3'
+  {   128,   8,  12,   9,    0,  -11, 2 },  // 0x34 '4'
+  {   139,   7,  12,   9,    1,  -11, 0 },  // 0x35 '5'
+  {   150,   7,  12,   9,    1,  -11, 0 },  // 0x36 '6'
+  {   161,   6,  12,   9,    2,  -11, 2 },  // 0x37 '7'
+  {   167,   7,  12,   9,    1,  -11, 0 },  // 0x38 '8'
+  {   178,   7,  12,   9,    1,  -11, 0 },  // 0x39 '9'
+  {   189,   1,   9,   4,    1,   -8, 0 },  // 0x3A ':'
+  {   191,   1,  12,   4,    1,   -8, 0 },  // 0x3B ';'
+  {   193,   7,   7,   9,    1,   -8, 0 },  // 0x3C '<'
+  {   200,   7,   5,   9,    1,   -7, 2 },  // 0x3D '='
+  {   202,   7,   7,   9,    1,   -8, 0 },  // 0x3E '>'
+  {   209,   7,  12,   9,    1,  -11, 0 },  // 0x3F '?'
+  {   220,  15,  15,  16,    1,  -11, 0 },  // 0x40 '@'
+  {   249,   9,  12,  11,    1,  -11, 2 },  // 0x41 'A'
+  {   261,   9,  12,  11,    1,  -11, 2 },  // 0x42 'B'
+  {   272,  10,  12,  12,    1,  -11, 2 },  // 0x43 'C'
+  {   284,  10,  12,  12,    1,  -11, 2 },  // 0x44 'D'
+  {   293,   9,  12,  11,    1,  -11, 2 },  // 0x45 'E'
+  {   300,   8,  12,  10,    1,  -11, 2 },  // 0x46 'F'
+  {   307,  10,  12,  12,    1,  -11, 2 },  // 0x47 'G'
+  {   321,   9,  12,  11,    1,  -11, 2 },  // 0x48 'H'
+  {   328,   1,  12,   3,    1,  -11, 1 },  // 0x49 'I'
+  {   329,   6,  12,   8,    1,  -11, 2 },  // 0x4A 'J'
+  {   334,   9,  12,  11,    1,  -11, 0 },  // 0x4B 'K'
+  {   348,   7,  12,   9,    1,  -11, 2 },  // 0x4C 'L'
+  {   353,  11,  12,  13,    1,  -11, 2 },  // 0x4D 'M'
+  {   366,   9,  12,  11,    1,  -11, 2 },  // 0x4E 'N'
+  {   378,  10,  12,  12,    1,  -11, 2 },  // 0x4F 'O'
+  {   391,   9,  12,  11,    1,  -11, 2 },  // 0x50 'P'
+  {   399,  10,  12,  12,    1,  -11, 0 },  // 0x51 'Q'
+  {   414,   9,  12,  11,    1,  -11, 2 },  // 0x52 'R'
+  {   425,   9,  12,  11,    1,  -11, 2 },  // 0x53 'S'
+  {   438,   9,  12,   9,    0,  -11, 2 },  // 0x54 'T'
+  {   444,   9,  12,  11,    1,  -11, 2 },  // 0x55 'U'
+  {   452,   9,  12,  11,    1,  -11, 2 },  // 0x56 'V'
+  {   463,  15,  12,  15,    0,  -11, 2 },  // 0x57 'W'
+  {   480,  11,  12,  11,    0,  -11, 0 },  // 0x58 'X'
+  {   497,   9,  12,   9,    0,  -11, 2 },  // 0x59 'Y'
+  {   507,   9,  12,   9,    0,  -11, 1 },  // 0x5A 'Z'
+  {   519,   3,  15,   4,    1,  -11, 2 },  // 0x5B '['
+  {   523,   4,  12,   4,    0,  -11, 0 },  // 0x5C
+  {   529,   3,  15,   4,    0,  -11, 2 },  // 0x5D ']'
+  {   533,   7,   6,   7,    0,  -11, 0 },  // 0x5E '^'
+  {   539,   9,   1,   9,    0,    3, 1 },  // 0x5F '_'
+  {   540,   2,   2,   5,    1,  -11, 0 },  // 0x60 '`'
+  {   541,   7,   9,   9,    1,   -8, 0 },  // 0x61 'a'
+  {   549,   7,  12,   9,    1,  -11, 2 },  // 0x62 'b'
+  {   559,   6,   9,   8,    1,   -8, 0 },  // 0x63 'c'
+  {   566,   7,  12,   9,    1,  -11, 2 },  // 0x64 'd'
+  {   576,   7,   9,   9,    1,   -8, 0 },  // 0x65 'e'
+  {   584,   4,  12,   4,    0,  -11, 0 },  // 0x66 'f'
+  {   590,   7,  12,   9,    1,   -8, 0 },  // 0x67 'g'
+  {   601,   6,  12,   8,    1,  -11, 2 },  // 0x68 'h'
+  {   607,   1,  12,   4,    1,  -11, 0 },  // 0x69 'i'
+  {   609,   3,  15,   3,   -1,  -11, 2 },  // 0x6A 'j'
+  {   614,   7,  12,   8,    1,  -11, 0 },  // 0x6B 'k'
+  {   328,   1,  12,   3,    1,  -11, 1 },  // 0x6C 'l'
+  {   625,  11,   9,  13,    1,   -8, 2 },  // 0x6D 'm'
+  {   634,   6,   9,   8,    1,   -8, 2 },  // 0x6E 'n'
+  {   640,   7,   9,   9,    1,   -8, 0 },  // 0x6F 'o'
+  {   648,   7,  12,   9,    1,   -8, 0 },  // 0x70 'p'
+  {   659,   7,  12,   9,    1,   -8, 0 },  // 0x71 'q'
+  {   670,   4,   9,   5,    1,   -8, 0 },  // 0x72 'r'
+  {   675,   6,   9,   8,    1,   -8, 0 },  // 0x73 's'
+  {   682,   4,  12,   4,    0,  -11, 0 },  // 0x74 't'
+  {   688,   6,   9,   8,    1,   -8, 2 },  // 0x75 'u'
+  {   694,   7,   9,   7,    0,   -8, 0 },  // 0x76 'v'
+  {   702,  11,   9,  11,    0,   -8, 2 },  // 0x77 'w'
+  {   713,   7,   9,   7,    0,   -8, 0 },  // 0x78 'x'
+  {   721,   7,  12,   7,    0,   -8, 2 },  // 0x79 'y'
+  {   730,   7,   9,   7,    0,   -8, 0 },  // 0x7A 'z'
+  {   738,   5,  15,   5,    0,  -11, 2 },  // 0x7B '{'
+  {   744,   1,  15,   3,    1,  -11, 0 },  // 0x7C '|'
+  {   746,   5,  15,   5,    0,  -11, 2 },  // 0x7D '}'
+  {   753,   8,   2,   9,    0,   -6, 0 }   // 0x7E '~'
+};
+
+const RleFont arial8pt7bRle PROGMEM = {
+  arial8pt7bRleData,
+  arial8pt7bRleGlyphs,
+  0x20, 0x7E, 18 };
+
+#endif // ARIAL8PT7BRLE_H_
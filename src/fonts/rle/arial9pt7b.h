@@ -0,0 +1,198 @@
+// Generated by tools/font_rle.cpp from src/fonts/arial9pt7b.h, do not edit.
+// 95 glyphs (1 sharing another's bitmap), 1035 bytes of bitmap data (GFXfont: 1172)
+#ifndef ARIAL9PT7BRLE_H_
+#define ARIAL9PT7BRLE_H_
+
+const uint8_t arial9pt7bRleData[] PROGMEM = {
+  0x00, 0x0F, 0x52, 0x40, 0x02, 0x12, 0xF5, 0x0C, 0xC1, 0x98, 0x66, 0x7F,
+  0xFF, 0xFE, 0x33, 0x0E, 0xE1, 0x98, 0xFF, 0xFF, 0xFC, 0xCC, 0x33, 0x06,
+  0x60, 0x08, 0x1F, 0x1F, 0xD9, 0x3C, 0x87, 0x41, 0xF0, 0x3E, 0x0F, 0x84,
+  0xF2, 0x7D, 0x77, 0xF1, 0xF0, 0x20, 0x10, 0x78, 0x63, 0x33, 0x0C, 0xCC,
+  0x33, 0x60, 0xCD, 0x83, 0x3E, 0x07, 0xB7, 0x80, 0xF3, 0x06, 0xCC, 0x1B,
+  0x30, 0xCC, 0xC3, 0x33, 0x18, 0x78, 0x1E, 0x07, 0xE0, 0xCC, 0x19, 0x83,
+  0x60, 0x38, 0x1F, 0x03, 0x66, 0xC6, 0xD8, 0x73, 0x8E, 0x3F, 0xE3, 0xC6,
+  0x0A, 0x08, 0x88, 0xC6, 0x63, 0x18, 0xC6, 0x31, 0x86, 0x30, 0x82, 0x08,
+  0x82, 0x08, 0x63, 0x0C, 0x63, 0x18, 0xC6, 0x33, 0x18, 0x88, 0x80, 0x27,
+  0xC8, 0xA5, 0x00, 0x42, 0xFF, 0x44, 0x24, 0xA4, 0x24, 0xFF, 0x00, 0xF6,
+  0x0A, 0xF0, 0x0C, 0x31, 0x86, 0x18, 0xC3, 0x0C, 0x61, 0x86, 0x30, 0xC0,
+  0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E,
+  0x3C, 0x19, 0xDF, 0xB9, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x80, 0x3C, 0x7E,
+  0xE7, 0xC3, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x70, 0x60, 0xFF, 0xFF, 0x38,
+  0x7C, 0xC6, 0x06, 0x06, 0x1C, 0x1E, 0x03, 0x03, 0xC3, 0xC3, 0x7E, 0x3C,
+  0x06, 0x07, 0x03, 0x83, 0xC3, 0x61, 0xB1, 0x99, 0x8C, 0xFF, 0xFF, 0xC1,
+  0x80, 0xC0, 0x60, 0x7E, 0x7E, 0x60, 0xC0, 0xDC, 0xFE, 0xC3, 0x03, 0x03,
+  0xC3, 0xC3, 0x7E, 0x3C, 0x3C, 0x7E, 0x63, 0xC0, 0xC0, 0xDC, 0xFE, 0xE3,
+  0xC3, 0xC3, 0x63, 0x7E, 0x3C, 0x08, 0x86, 0x11, 0x51, 0x61, 0x11, 0xC1,
+  0x11, 0xF5, 0x19, 0x1F, 0x40, 0x3C, 0x7E, 0xC3, 0xC3, 0xC3, 0x7E, 0x7E,
+  0xC3, 0xC3, 0xC3, 0xC3, 0x7E, 0x3C, 0x3C, 0x7E, 0xC3, 0xC3, 0xC3, 0xC7,
+  0x7F, 0x3B, 0x03, 0x03, 0xC6, 0x7E, 0x3C, 0x04, 0xC4, 0xF0, 0x00, 0xF6,
+  0x81, 0x63, 0x35, 0x24, 0x42, 0x84, 0x75, 0x73, 0x81, 0x0F, 0x3F, 0x3F,
+  0x30, 0x01, 0x83, 0x75, 0x74, 0x82, 0x44, 0x25, 0x33, 0x61, 0x80, 0x3C,
+  0x7E, 0xE7, 0xC3, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x30, 0x00, 0x30, 0x30,
+  0x03, 0xF0, 0x07, 0xFE, 0x07, 0x03, 0x86, 0x3B, 0xE6, 0x3F, 0xBB, 0x33,
+  0x8F, 0x38, 0xC7, 0x98, 0x63, 0xCC, 0x21, 0xE6, 0x31, 0xB3, 0x99, 0xD8,
+  0xFF, 0xC6, 0x77, 0x83, 0x80, 0x1C, 0xF0, 0x1C, 0x3F, 0xFC, 0x07, 0xF8,
+  0x00, 0x0E, 0x01, 0xC0, 0x6C, 0x0D, 0x81, 0xB0, 0x63, 0x0C, 0x61, 0xFC,
+  0x7F, 0xCC, 0x19, 0x83, 0x60, 0x3C, 0x06, 0x08, 0x29, 0x12, 0x64, 0x64,
+  0x6B, 0x19, 0x12, 0x64, 0x64, 0x64, 0x5C, 0x18, 0x20, 0x35, 0x58, 0x23,
+  0x43, 0x12, 0x64, 0x92, 0x92, 0x92, 0x92, 0xA2, 0x62, 0x13, 0x42, 0x38,
+  0x54, 0x30, 0x08, 0xB1, 0x45, 0x21, 0x81, 0x21, 0x81, 0xFF, 0xF9, 0x11,
+  0x17, 0x15, 0x52, 0x19, 0x12, 0x0A, 0xC8, 0xF7, 0x7D, 0x7F, 0xF3, 0x8A,
+  0x09, 0xB7, 0xF5, 0x6C, 0x6F, 0xFF, 0x10, 0x45, 0x59, 0x23, 0x52, 0x22,
+  0x74, 0xA2, 0xA2, 0x48, 0x48, 0x82, 0x12, 0x72, 0x13, 0x53, 0x29, 0x55,
+  0x30, 0x02, 0x72, 0xFF, 0xF1, 0x7F, 0x07, 0xFF, 0xFC, 0x0F, 0xB0, 0x52,
+  0xFF, 0xFB, 0x2E, 0x31, 0x24, 0x11, 0xC1, 0xD8, 0x73, 0x1C, 0x67, 0x0D,
+  0xC1, 0xF0, 0x3F, 0x07, 0x70, 0xC7, 0x18, 0x63, 0x0E, 0x60, 0xEC, 0x0E,
+  0x02, 0xFF, 0xFF, 0xFD, 0x68, 0x03, 0x73, 0x31, 0x51, 0xFF, 0x11, 0x11,
+  0x31, 0x11, 0xFF, 0x11, 0x51, 0x81, 0x11, 0xFF, 0x51, 0x11, 0x11, 0xF2,
+  0xC0, 0x7C, 0x0F, 0xC1, 0xF8, 0x3D, 0x87, 0x98, 0xF3, 0x9E, 0x33, 0xC3,
+  0x78, 0x3F, 0x07, 0xE0, 0x7C, 0x06, 0x45, 0x58, 0x33, 0x43, 0x22, 0x62,
+  0x12, 0x84, 0x84, 0x84, 0x84, 0x82, 0x12, 0x62, 0x23, 0x43, 0x38, 0x64,
+  0x40, 0x08, 0xA1, 0x35, 0x21, 0x71, 0xF4, 0x14, 0x52, 0x18, 0x13, 0x6F,
+  0xFC, 0x36, 0x58, 0x33, 0x43, 0x22, 0x65, 0x84, 0x84, 0x84, 0x84, 0x82,
+  0x12, 0x32, 0x12, 0x23, 0x33, 0x48, 0x55, 0x13, 0x09, 0xC1, 0x46, 0x21,
+  0x91, 0xB1, 0x56, 0x21, 0xA1, 0x44, 0x21, 0xB1, 0x91, 0x21, 0x91, 0xE1,
+  0x91, 0x21, 0x35, 0x38, 0x13, 0x45, 0x64, 0x94, 0x76, 0x74, 0x94, 0x65,
+  0x43, 0x18, 0x36, 0x20, 0x0A, 0xA4, 0x24, 0xFF, 0xFF, 0xFF, 0xA0, 0x02,
+  0x72, 0xFF, 0xFF, 0xFF, 0xB1, 0x51, 0x12, 0x25, 0x42, 0x52, 0x10, 0xC0,
+  0x78, 0x0D, 0x83, 0x30, 0x66, 0x0C, 0x63, 0x0C, 0x61, 0x8C, 0x1B, 0x03,
+  0x60, 0x6C, 0x07, 0x00, 0xE0, 0xC1, 0xC1, 0xE0, 0xE0, 0xD8, 0xD8, 0xCC,
+  0x6C, 0x66, 0x36, 0x33, 0x1B, 0x19, 0x88, 0x8C, 0x6C, 0x6C, 0x36, 0x36,
+  0x1B, 0x1B, 0x0D, 0x8D, 0x83, 0x83, 0x81, 0xC1, 0xC0, 0x71, 0xC6, 0x30,
+  0x6C, 0x0D, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0xD8, 0x1B, 0x07, 0x70, 0xC6,
+  0x30, 0x6E, 0x0E, 0x03, 0x63, 0x12, 0x62, 0x32, 0x42, 0x43, 0x23, 0x52,
+  0x22, 0x74, 0x84, 0x92, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x50, 0x19, 0x19,
+  0x72, 0x72, 0x73, 0x72, 0x72, 0x72, 0x73, 0x72, 0x72, 0x7F, 0x50, 0x04,
+  0x62, 0xFF, 0xF5, 0x24, 0xC3, 0x06, 0x18, 0x60, 0xC3, 0x0C, 0x18, 0x61,
+  0x83, 0x0C, 0x04, 0x42, 0xFF, 0xF5, 0x26, 0x10, 0x70, 0xA3, 0x66, 0xC8,
+  0xB1, 0x80, 0x0F, 0x50, 0xCC, 0x3E, 0x7F, 0xC3, 0x0F, 0x7F, 0xF3, 0xC3,
+  0xC7, 0xFF, 0x7B, 0xC0, 0xC0, 0xC0, 0xDC, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xE7, 0xFE, 0xDC, 0x3C, 0xFF, 0x9E, 0x0C, 0x18, 0x30, 0x73, 0x7E,
+  0x78, 0x03, 0x03, 0x03, 0x3B, 0x7F, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7,
+  0x7F, 0x3B, 0x3C, 0x7E, 0xE6, 0xC3, 0xFF, 0xFF, 0xC0, 0xE3, 0x7E, 0x3C,
+  0x24, 0x11, 0x74, 0x22, 0x71, 0x22, 0xFF, 0xD0, 0x3B, 0x7F, 0xE7, 0xC3,
+  0xC3, 0xC3, 0xC3, 0xE7, 0x7F, 0x3B, 0x03, 0xC7, 0xFE, 0x7C, 0x02, 0xFA,
+  0x43, 0x14, 0x13, 0x34, 0x1F, 0xFF, 0x80, 0x04, 0x2F, 0x50, 0x22, 0x62,
+  0x22, 0xFF, 0xE2, 0x51, 0xC0, 0xC0, 0xC0, 0xC7, 0xCE, 0xDC, 0xF0, 0xF8,
+  0xD8, 0xCC, 0xCC, 0xC6, 0xC7, 0x02, 0x13, 0x23, 0x31, 0x41, 0x31, 0x32,
+  0x11, 0x12, 0x41, 0x41, 0xFF, 0xFF, 0xF1, 0x02, 0x14, 0x31, 0x41, 0x33,
+  0x41, 0xFF, 0xF8, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E,
+  0x3C, 0xDC, 0xFE, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0xFE, 0xDC, 0xC0,
+  0xC0, 0xC0, 0xC0, 0x3B, 0x7F, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7F,
+  0x3B, 0x03, 0x03, 0x03, 0x03, 0xDF, 0xF9, 0x8C, 0x63, 0x18, 0xC6, 0x00,
+  0x7D, 0xFF, 0x1F, 0x07, 0x83, 0x83, 0xE3, 0xFE, 0xF8, 0x66, 0x6F, 0xF6,
+  0x66, 0x66, 0x67, 0x70, 0x02, 0x42, 0xFF, 0xF8, 0x14, 0x33, 0x14, 0x12,
+  0xC1, 0xE0, 0xD8, 0xCC, 0x66, 0x31, 0xB0, 0xD8, 0x38, 0x1C, 0x04, 0x00,
+  0x61, 0x0C, 0xC7, 0x19, 0x8E, 0x31, 0x94, 0xC3, 0x6D, 0x86, 0xDB, 0x05,
+  0x14, 0x0E, 0x38, 0x1C, 0x70, 0x18, 0xC0, 0xC3, 0x66, 0x66, 0x3C, 0x18,
+  0x18, 0x3C, 0x66, 0x66, 0xC3, 0xC1, 0xE0, 0xD8, 0xCC, 0x63, 0x31, 0xB0,
+  0x78, 0x3C, 0x0C, 0x06, 0x03, 0x03, 0x07, 0x83, 0x80, 0x0F, 0x15, 0x34,
+  0x34, 0x34, 0x34, 0x34, 0x35, 0xF1, 0x1C, 0xF3, 0x0C, 0x30, 0xC7, 0x38,
+  0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0x0F, 0x1C, 0x0F, 0xF4, 0xE3, 0xC3, 0x0C,
+  0x30, 0xC3, 0x87, 0x1C, 0xE3, 0x0C, 0x30, 0xC3, 0x3C, 0xE0, 0x70, 0x3F,
+  0x18, 0xFC, 0x0E };
+
+const RleGlyph arial9pt7bRleGlyphs[] PROGMEM = {
+  {     0,   1,   1,   5,    0,    0, 0 },  // 0x20 ' '
+  {     1,   2,  13,   6,    2,  -12, 1 },  // 0x21 '!'
+  {     4,   5,   5,   6,    1,  -12, 2 },  // 0x22 '"'
+  {     7,  11,  13,  10,    0,  -12, 0 },  // 0x23 '#'
+  {    25,   9,  16,  10,    1,  -13, 0 },  // 0x24 '$'
+  {    43,  14,  13,  16,    1,  -12, 0 },  // 0x25 '%'
+  {    66,  11,  13,  12,    1,  -12, 0 },  // 0x26 '&'
+  {    84,   2,   5,   3,    0,  -12, 1 },  // 0x27 '''
+  {    85,   5,  17,   6,    1,  -12, 0 },  // 0x28 '('
+  {    96,   5,  17,   6,    0,  -12, 0 },  // 0x29 ')'
+  {   107,   5,   5,   7,    1,  -12, 0 },  // 0x2A '*'
+  {   111,  10,  10,  11,    1,  -10, 2 },  // 0x2B '+'
+  {   119,   2,   4,   5,    2,   -1, 0 },  // 0x2C ','
+  {   120,   5,   2,   6,    0,   -5, 1 },  // 0x2D '-'
+  {   121,   2,   2,   5,    2,   -1, 0 },  // 0x2E '.'
+  {   122,   6,  13,   5,    0,  -12, 0 },  // 0x2F '/'
+  {   132,   8,  13,  10,    1,  -12, 0 },  // 0x30 '0'
+  {   145,   5,  13,  10,    2,  -12, 0 },  // 0x31 '1'
+  {   154,   8,  13,  10,    1,  -12, 0 },  // 0x32 '2'
+  {   167,   8,  13,  10,    1,  -12, 0 },  // 0x33 '3'
+  {   180,   9,  13,  10,    0,  -12, 0 },  // 0x34 '4'
+  {   195,   8,  13,  10,    1,  -12, 0 },  // 0x35 '5'
+  {   208,   8,  13,  10,    1,  -12, 0 },  // 0x36 '6'
+  {   221,   8,  13,  10,    1,  -12, 2 },  // 0x37 '7'
+  {   233,   8,  13,  10,    1,  -12, 0 },  // 0x38 '8'
+  {   246,   8,  13,  10,    1,  -12, 0 },  // 0x39 '9'
+  {   259,   2,  10,   5,    2,   -9, 1 },  // 0x3A ':'
+  {   261,   2,  12,   5,    2,   -9, 0 },  // 0x3B ';'
+  {   264,   9,   9,  11,    1,  -10, 1 },  // 0x3C '<'
+  {   273,   9,   6,  11,    1,   -9, 1 },  // 0x3D '='
+  {   277,   9,   9,  11,    1,  -10, 1 },  // 0x3E '>'
+  {   287,   8,  13,  10,    1,  -12, 0 },  // 0x3F '?'
+  {   300,  17,  17,  18,    1,  -12, 0 },  // 0x40 '@'
+  {   337,  11,  13,  11,    0,  -12, 0 },  // 0x41 'A'
+  {   355,  10,  13,  12,    1,  -12, 1 },  // 0x42 'B'
+  {   369,  11,  13,  13,    1,  -12, 1 },  // 0x43 'C'
+  {   386,  11,  13,  13,    1,  -12, 2 },  // 0x44 'D'
+  {   401,  10,  13,  12,    1,  -12, 2 },  // 0x45 'E'
+  {   408,   9,  13,  11,    1,  -12, 2 },  // 0x46 'F'
+  {   415,  12,  13,  14,    1,  -12, 1 },  // 0x47 'G'
+  {   433,  11,  13,  13,    1,  -12, 2 },  // 0x48 'H'
+  {   441,   2,  13,   4,    1,  -12, 1 },  // 0x49 'I'
+  {   443,   7,  13,   9,    1,  -12, 2 },  // 0x4A 'J'
+  {   450,  11,  13,  12,    1,  -12, 0 },  // 0x4B 'K'
+  {   468,   8,  13,  10,    1,  -12, 2 },  // 0x4C 'L'
+  {   473,  13,  13,  15,    1,  -12, 2 },  // 0x4D 'M'
+  {   492,  11,  13,  13,    1,  -12, 0 },  // 0x4E 'N'
+  {   510,  12,  13,  14,    1,  -12, 1 },  // 0x4F 'O'
+  {   529,  10,  13,  12,    1,  -12, 2 },  // 0x50 'P'
+  {   541,  12,  13,  14,    1,  -12, 1 },  // 0x51 'Q'
+  {   560,  12,  13,  13,    1,  -12, 2 },  // 0x52 'R'
+  {   578,  10,  13,  12,    1,  -12, 1 },  // 0x53 'S'
+  {   592,  10,  13,  12,    1,  -12, 2 },  // 0x54 'T'
+  {   599,  11,  13,  13,    1,  -12, 2 },  // 0x55 'U'
+  {   611,  11,  13,  11,    0,  -12, 0 },  // 0x56 'V'
+  {   629,  17,  13,  17,    0,  -12, 0 },  // 0x57 'W'
+  {   657,  11,  13,  11,    0,  -12, 0 },  // 0x58 'X'
+  {   675,  12,  13,  12,    0,  -12, 1 },  // 0x59 'Y'
+  {   694,  10,  13,  11,    0,  -12, 1 },  // 0x5A 'Z'
+  {   707,   4,  17,   5,    1,  -12, 2 },  // 0x5B '['
+  {   712,   6,  13,   5,    0,  -12, 0 },  // 0x5C
+  {   722,   4,  17,   5,    0,  -12, 2 },  // 0x5D ']'
+  {   727,   7,   7,   7,    0,  -12, 0 },  // 0x5E '^'
+  {   734,  10,   2,  10,    0,    3, 1 },  // 0x5F '_'
+  {   736,   3,   2,   6,    1,  -12, 0 },  // 0x60 '`'
+  {   737,   8,  10,  10,    1,   -9, 0 },  // 0x61 'a'
+  {   747,   8,  13,  10,    1,  -12, 0 },  // 0x62 'b'
+  {   760,   7,  10,   9,    1,   -9, 0 },  // 0x63 'c'
+  {   769,   8,  13,  10,    1,  -12, 0 },  // 0x64 'd'
+  {   782,   8,  10,  10,    1,   -9, 0 },  // 0x65 'e'
+  {   792,   6,  13,   5,    0,  -12, 2 },  // 0x66 'f'
+  {   800,   8,  14,  10,    1,   -9, 0 },  // 0x67 'g'
+  {   814,   8,  13,  10,    1,  -12, 2 },  // 0x68 'h'
+  {   823,   2,  13,   4,    1,  -12, 1 },  // 0x69 'i'
+  {   826,   4,  17,   4,   -1,  -12, 2 },  // 0x6A 'j'
+  {   832,   8,  13,   9,    1,  -12, 0 },  // 0x6B 'k'
+  {   441,   2,  13,   4,    1,  -12, 1 },  // 0x6C 'l'
+  {   845,  12,  10,  14,    1,   -9, 2 },  // 0x6D 'm'
+  {   859,   8,  10,  10,    1,   -9, 2 },  // 0x6E 'n'
+  {   867,   8,  10,  10,    1,   -9, 0 },  // 0x6F 'o'
+  {   877,   8,  14,  10,    1,   -9, 0 },  // 0x70 'p'
+  {   891,   8,  14,  10,    1,   -9, 0 },  // 0x71 'q'
+  {   905,   5,  10,   6,    1,   -9, 0 },  // 0x72 'r'
+  {   912,   7,  10,   9,    1,   -9, 0 },  // 0x73 's'
+  {   921,   4,  13,   5,    0,  -12, 0 },  // 0x74 't'
+  {   928,   8,  10,  10,    1,   -9, 2 },  // 0x75 'u'
+  {   936,   9,  10,   9,    0,   -9, 0 },  // 0x76 'v'
+  {   948,  15,  10,  13,   -1,   -9, 0 },  // 0x77 'w'
+  {   967,   8,  10,   8,    0,   -9, 0 },  // 0x78 'x'
+  {   977,   9,  14,   9,    0,   -9, 0 },  // 0x79 'y'
+  {   993,   8,  10,   8,    0,   -9, 1 },  // 0x7A 'z'
+  {  1002,   6,  17,   6,    0,  -12, 0 },  // 0x7B '{'
+  {  1015,   2,  17,   6,    2,  -12, 1 },  // 0x7C '|'
+  {  1017,   6,  17,   6,    0,  -12, 0 },  // 0x7D '}'
+  {  1030,  10,   4,  11,    0,   -7, 0 }   // 0x7E '~'
+};
+
+const RleFont arial9pt7bRle PROGMEM = {
+  arial9pt7bRleData,
+  arial9pt7bRleGlyphs,
+  0x20, 0x7E, 20 };
+
+#endif // ARIAL9PT7BRLE_H_
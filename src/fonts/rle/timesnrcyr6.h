@@ -0,0 +1,254 @@
+// Generated by tools/font_rle.cpp from src/fonts/timesnrcyr6.h, do not edit.
+// 162 glyphs (19 sharing another's bitmap), 905 bytes of bitmap data (GFXfont: 1065)
+#ifndef TIMESNRCYR6PT8BRLE_H_
+#define TIMESNRCYR6PT8BRLE_H_
+
+const uint8_t timesnrcyr6pt8bRleData[] PROGMEM = {
+  0xFE, 0x80, 0xB6, 0x80, 0x12, 0x12, 0xFF, 0x24, 0x24, 0x24, 0xFF, 0x48,
+  0x48, 0x23, 0xEB, 0x46, 0x18, 0xB5, 0xAF, 0x88, 0x40, 0xA8, 0x4A, 0x23,
+  0x88, 0x04, 0x02, 0x61, 0x14, 0x45, 0x21, 0xC0, 0x18, 0x12, 0x09, 0x07,
+  0x75, 0x14, 0x52, 0x31, 0x88, 0x7B, 0x80, 0xE0, 0x29, 0x49, 0x24, 0x89,
+  0x10, 0x89, 0x12, 0x49, 0x29, 0x40, 0x25, 0x5D, 0xF2, 0x00, 0x31, 0xF2,
+  0x31, 0x61, 0x3E, 0xC0, 0x80, 0x21, 0xA2, 0xD2, 0x60, 0x31, 0x28, 0x61,
+  0x86, 0x18, 0x52, 0x30, 0x59, 0x24, 0x92, 0xE0, 0x64, 0x84, 0x22, 0x11,
+  0x10, 0xF8, 0x32, 0x42, 0x23, 0x04, 0x31, 0x70, 0x31, 0x8C, 0xA5, 0x4B,
+  0xE2, 0x10, 0x78, 0x84, 0x21, 0x1A, 0xE0, 0x34, 0x4A, 0xD9, 0x99, 0x60,
+  0x07, 0x32, 0xD2, 0x90, 0x69, 0x99, 0x6A, 0x99, 0x60, 0x69, 0x99, 0x97,
+  0x22, 0xC0, 0x84, 0x87, 0x04, 0x66, 0x20, 0x60, 0x60, 0x40, 0x06, 0xC6,
+  0x81, 0x81, 0x81, 0x19, 0x88, 0x00, 0x74, 0x62, 0x11, 0x10, 0x80, 0x20,
+  0x1E, 0x08, 0x44, 0x09, 0x3A, 0x92, 0xAD, 0x2A, 0x4A, 0xB4, 0xB6, 0x50,
+  0x22, 0x18, 0x78, 0x08, 0x0A, 0x05, 0x02, 0x82, 0x21, 0x10, 0xF8, 0x82,
+  0xE3, 0x80, 0xF9, 0x14, 0x51, 0x79, 0x14, 0x51, 0xF8, 0x3A, 0x8E, 0x0C,
+  0x08, 0x10, 0x20, 0x21, 0x3C, 0x06, 0x21, 0x15, 0x72, 0xFF, 0x83, 0x15,
+  0x10, 0xFC, 0x89, 0x02, 0x47, 0x89, 0x10, 0x21, 0xFE, 0xFD, 0x14, 0x12,
+  0x79, 0x24, 0x10, 0xE0, 0x3D, 0x21, 0xA0, 0x50, 0x08, 0x3C, 0x0A, 0x04,
+  0x82, 0x3E, 0x00, 0xEE, 0x89, 0x12, 0x27, 0xC8, 0x91, 0x22, 0xEE, 0xE9,
+  0x24, 0x92, 0xE0, 0x38, 0x84, 0x21, 0x08, 0x42, 0xE0, 0xE7, 0x22, 0x12,
+  0x0A, 0x06, 0x02, 0x81, 0x20, 0x88, 0xE7, 0x80, 0x03, 0x41, 0x11, 0xFF,
+  0xF0, 0x21, 0x50, 0xE0, 0xEC, 0x19, 0x83, 0x28, 0xA5, 0x14, 0x94, 0x92,
+  0x92, 0x52, 0xE4, 0xE0, 0xE3, 0x98, 0x8C, 0x45, 0x22, 0x51, 0x28, 0x8C,
+  0x42, 0x71, 0x00, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xA2, 0x38, 0xF2,
+  0x52, 0x97, 0x21, 0x08, 0xE0, 0x38, 0x8A, 0x0C, 0x18, 0x30, 0x60, 0xA2,
+  0x38, 0x20, 0x38, 0xF8, 0x44, 0x44, 0x44, 0x78, 0x50, 0x48, 0x44, 0xE7,
+  0x6C, 0xE2, 0x82, 0x0A, 0x39, 0xB0, 0xFF, 0x24, 0x40, 0x81, 0x02, 0x04,
+  0x08, 0x38, 0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x22, 0x38, 0xEE, 0x89,
+  0x12, 0x22, 0x85, 0x0A, 0x08, 0x10, 0xEE, 0xE8, 0x89, 0x11, 0x22, 0x22,
+  0xA8, 0x55, 0x0A, 0xA0, 0x88, 0x11, 0x00, 0xF3, 0xB0, 0x88, 0x82, 0x80,
+  0x80, 0x40, 0x50, 0x44, 0xE7, 0x80, 0xE7, 0x42, 0x24, 0x28, 0x18, 0x10,
+  0x10, 0x10, 0x38, 0x7E, 0x44, 0x44, 0x08, 0x10, 0x20, 0x20, 0x41, 0xFF,
+  0xEA, 0xAA, 0xAC, 0x92, 0x44, 0x91, 0x20, 0xD5, 0x55, 0x5C, 0x21, 0x45,
+  0x22, 0xFC, 0xD0, 0xF2, 0x43, 0x14, 0x93, 0xE0, 0x43, 0x04, 0x16, 0x65,
+  0x14, 0x51, 0x78, 0x69, 0x88, 0x96, 0x18, 0x20, 0x9E, 0x8A, 0x28, 0xA7,
+  0x68, 0x69, 0xF8, 0x96, 0x3A, 0x11, 0xC4, 0x21, 0x08, 0xE0, 0x64, 0xE4,
+  0xC8, 0x3A, 0x31, 0x70, 0x43, 0x04, 0x16, 0x69, 0x24, 0x92, 0xEC, 0x40,
+  0x2C, 0x92, 0xE0, 0x20, 0x16, 0x49, 0x24, 0xE0, 0x41, 0x81, 0x02, 0xF5,
+  0x0C, 0x14, 0x24, 0xEE, 0x5B, 0x76, 0x92, 0x49, 0x24, 0x96, 0xEC, 0x5B,
+  0xA4, 0x92, 0x4B, 0xB0, 0x7A, 0x38, 0x61, 0xC5, 0xE0, 0x5B, 0x94, 0x51,
+  0x45, 0xE4, 0x10, 0xE0, 0x72, 0x28, 0xA2, 0x89, 0xE0, 0x82, 0x1C, 0x5F,
+  0x10, 0x84, 0x70, 0x79, 0xC3, 0x9F, 0x5D, 0x24, 0x98, 0xD9, 0x24, 0x92,
+  0x4D, 0xE0, 0xCE, 0x89, 0x11, 0x42, 0x82, 0x00, 0xEB, 0xA4, 0x92, 0x8B,
+  0x45, 0xA1, 0x20, 0xED, 0x23, 0x0C, 0x4B, 0x70, 0xED, 0x22, 0x8C, 0x30,
+  0x42, 0x08, 0xC0, 0xFC, 0x88, 0x44, 0xFC, 0x29, 0x25, 0x12, 0x48, 0x80,
+  0x0B, 0x89, 0x24, 0x52, 0x4A, 0x00, 0xE6, 0x70, 0x06, 0x14, 0xFF, 0x24,
+  0x10, 0xFA, 0x82, 0x08, 0x20, 0xC0, 0x00, 0x10, 0x10, 0x34, 0x5A, 0x93,
+  0x91, 0x52, 0x5A, 0x34, 0x10, 0x18, 0xED, 0x14, 0x51, 0x45, 0x13, 0xC0,
+  0xFD, 0x24, 0x9E, 0x08, 0x20, 0xED, 0xA4, 0x52, 0x29, 0x14, 0x8B, 0xFC,
+  0xED, 0xA4, 0x52, 0x29, 0x14, 0x8A, 0x44, 0xDE, 0xF2, 0x82, 0x0F, 0x24,
+  0xF0, 0xE3, 0x42, 0x42, 0x7A, 0x4A, 0x7B, 0xE2, 0x10, 0xF4, 0xBC, 0xF6,
+  0x4E, 0x18, 0xB8, 0xE6, 0x24, 0xD2, 0x2F, 0x14, 0x8A, 0x78, 0x3D, 0x24,
+  0x8E, 0x29, 0x20, 0x7E, 0x44, 0x81, 0xC2, 0x64, 0x48, 0xBE, 0x15, 0x24,
+  0xFF, 0x01, 0x50, 0x26, 0x43, 0x11, 0xFF, 0x82, 0x84, 0x11, 0x17, 0x11,
+  0x71, 0x10, 0xE6, 0x72, 0x68, 0x16, 0x80, 0xF0, 0x16, 0x81, 0x68, 0x26,
+  0x46, 0x66, 0x78, 0x30, 0x8E, 0x08, 0x38, 0xDE, 0x61, 0x10, 0x89, 0xC4,
+  0xA2, 0x91, 0x88, 0x84, 0xC2, 0x12, 0x09, 0x03, 0x0C, 0x22, 0x11, 0x38,
+  0x94, 0x52, 0x31, 0x10, 0x98, 0x40, 0x63, 0x92, 0x09, 0x07, 0x02, 0xC1,
+  0x20, 0x88, 0xC6, 0x26, 0x43, 0x11, 0xFF, 0xF1, 0x25, 0x11, 0x17, 0x21,
+  0x14, 0xFF, 0xF3, 0x17, 0x61, 0x11, 0x0C, 0x82, 0x81, 0xC0, 0x40, 0x20,
+  0x60, 0x0C, 0x0F, 0xE4, 0x4F, 0x11, 0x44, 0x51, 0x23, 0xF0, 0x30, 0x12,
+  0x41, 0x21, 0xFF, 0xF8, 0x11, 0x43, 0x88, 0x10, 0x63, 0x31, 0x18, 0x8C,
+  0x43, 0xE0, 0x10, 0x08, 0x06, 0x12, 0x32, 0x22, 0x81, 0x21, 0xFF, 0xFF,
+  0xA3, 0x14, 0x20, 0x12, 0x32, 0x22, 0x81, 0x21, 0xFF, 0xFF, 0xA3, 0x14,
+  0x3C, 0xC1, 0xF0, 0x08, 0x04, 0x03, 0x81, 0x30, 0x8C, 0x44, 0x3E, 0x12,
+  0x61, 0x21, 0xF8, 0x29, 0x49, 0x1F, 0x21, 0x14, 0x40, 0x60, 0x40, 0x81,
+  0xC2, 0x64, 0x48, 0xBE, 0xFB, 0x18, 0x41, 0x3C, 0x10, 0x61, 0x78, 0x63,
+  0xE1, 0x30, 0x89, 0x06, 0x48, 0x33, 0xC1, 0x92, 0x0C, 0x88, 0x4C, 0x3C,
+  0x1F, 0x22, 0x22, 0x22, 0x1E, 0x0A, 0x12, 0x22, 0xE7, 0x03, 0xA1, 0xC9,
+  0xC6, 0x31, 0x70, 0xF1, 0x24, 0x9E, 0x4D, 0xE0, 0x06, 0x13, 0xF5, 0x7D,
+  0x24, 0x92, 0x4A, 0x2F, 0x40, 0x5D, 0x4A, 0x2C, 0x3C, 0x2A, 0x49, 0xF4,
+  0x84, 0x21, 0xF8, 0xED, 0x15, 0xD9, 0x45, 0x10, 0x28, 0x4E, 0xD1, 0x5D,
+  0x94, 0x51, 0xE5, 0x65, 0x1C, 0x49, 0x20, 0x7D, 0x24, 0x92, 0x4B, 0x20,
+  0xC3, 0x66, 0x6A, 0x6A, 0x52, 0x52, 0xED, 0x14, 0x5F, 0x45, 0x10, 0x07,
+  0x13, 0xFA, 0x24, 0x00, 0x7E, 0x20, 0x20, 0x3C, 0x20, 0x20, 0x21, 0x7E,
+  0x50, 0x0D, 0x9F, 0xC1, 0x2E };
+
+const RleGlyph timesnrcyr6pt8bRleGlyphs[] PROGMEM = {
+  {     0,   0,   0,   3,    0,    1, 0 },  // 0x20 ' '
+  {     0,   1,   9,   3,    1,   -8, 0 },  // 0x21 '!'
+  {     2,   3,   3,   5,    1,   -8, 0 },  // 0x22 '"'
+  {     4,   8,   9,   8,    0,   -8, 0 },  // 0x23 '#'
+  {    13,   5,  11,   6,    1,   -9, 0 },  // 0x24 '$'
+  {    20,  10,   9,  10,    0,   -8, 0 },  // 0x25 '%'
+  {    32,   9,   9,   9,    0,   -8, 0 },  // 0x26 '&'
+  {    43,   1,   3,   2,    1,   -8, 0 },  // 0x27 '''
+  {    44,   3,  12,   4,    1,   -8, 0 },  // 0x28 '('
+  {    49,   3,  12,   4,    0,   -8, 0 },  // 0x29 ')'
+  {    54,   5,   5,   6,    1,   -8, 0 },  // 0x2A '*'
+  {    58,   7,   7,   8,    1,   -6, 2 },  // 0x2B '+'
+  {    43,   1,   3,   3,    1,    0, 0 },  // 0x2C ','
+  {    63,   2,   1,   4,    1,   -2, 0 },  // 0x2D '-'
+  {    64,   1,   1,   3,    1,    0, 0 },  // 0x2E '.'
+  {    65,   4,   9,   3,    0,   -8, 2 },  // 0x2F '/'
+  {    69,   6,   9,   6,    0,   -8, 0 },  // 0x30 '0'
+  {    76,   3,   9,   5,    1,   -8, 0 },  // 0x31 '1'
+  {    80,   5,   9,   6,    1,   -8, 0 },  // 0x32 '2'
+  {    86,   5,   9,   6,    0,   -8, 0 },  // 0x33 '3'
+  {    92,   5,   9,   6,    1,   -8, 0 },  // 0x34 '4'
+  {    98,   4,   9,   6,    1,   -8, 0 },  // 0x35 '5'
+  {   103,   4,   9,   6,    1,   -8, 0 },  // 0x36 '6'
+  {   108,   4,   9,   6,    1,   -8, 2 },  // 0x37 '7'
+  {   112,   4,   9,   6,    1,   -8, 0 },  // 0x38 '8'
+  {   117,   4,   9,   6,    1,   -8, 0 },  // 0x39 '9'
+  {   122,   1,   6,   3,    1,   -5, 0 },  // 0x3A ':'
+  {   123,   1,   8,   3,    1,   -5, 0 },  // 0x3B ';'
+  {   124,   6,   7,   8,    1,   -7, 0 },  // 0x3C '<'
+  {   130,   6,   4,   8,    1,   -5, 1 },  // 0x3D '='
+  {   132,   6,   7,   8,    1,   -7, 0 },  // 0x3E '>'
+  {   138,   5,   9,   5,    0,   -8, 0 },  // 0x3F '?'
+  {   144,  10,  12,  11,    1,   -8, 0 },  // 0x40 '@'
+  {   159,   9,   9,   9,    0,   -8, 0 },  // 0x41 'A'
+  {   170,   6,   9,   8,    1,   -8, 0 },  // 0x42 'B'
+  {   177,   7,   9,   9,    1,   -8, 0 },  // 0x43 'C'
+  {   185,   8,   9,  10,    1,   -8, 2 },  // 0x44 'D'
+  {   193,   7,   9,   8,    1,   -8, 0 },  // 0x45 'E'
+  {   201,   6,   9,   8,    1,   -8, 0 },  // 0x46 'F'
+  {   208,   9,   9,  10,    1,   -8, 0 },  // 0x47 'G'
+  {   219,   7,   9,   9,    1,   -8, 0 },  // 0x48 'H'
+  {   227,   3,   9,   5,    1,   -8, 0 },  // 0x49 'I'
+  {   231,   5,   9,   5,    0,   -8, 0 },  // 0x4A 'J'
+  {   237,   9,   9,  10,    1,   -8, 0 },  // 0x4B 'K'
+  {   248,   7,   9,   8,    1,   -8, 2 },  // 0x4C 'L'
+  {   255,  11,   9,  11,    0,   -8, 0 },  // 0x4D 'M'
+  {   268,   9,   9,  10,    0,   -8, 0 },  // 0x4E 'N'
+  {   279,   7,   9,   9,    1,   -8, 0 },  // 0x4F 'O'
+  {   287,   5,   9,   7,    1,   -8, 0 },  // 0x50 'P'
+  {   293,   7,  11,   9,    1,   -8, 0 },  // 0x51 'Q'
+  {   303,   8,   9,   9,    1,   -8, 0 },  // 0x52 'R'
+  {   312,   5,   9,   7,    1,   -8, 0 },  // 0x53 'S'
+  {   318,   7,   9,   7,    0,   -8, 0 },  // 0x54 'T'
+  {   326,   7,   9,   9,    1,   -8, 0 },  // 0x55 'U'
+  {   334,   7,   9,   7,    0,   -8, 0 },  // 0x56 'V'
+  {   342,  11,   9,  11,    0,   -8, 0 },  // 0x57 'W'
+  {   355,   9,   9,   9,    0,   -8, 0 },  // 0x58 'X'
+  {   366,   8,   9,   8,    0,   -8, 0 },  // 0x59 'Y'
+  {   375,   8,   9,   8,    0,   -8, 0 },  // 0x5A 'Z'
+  {   384,   2,  11,   3,    1,   -8, 0 },  // 0x5B '['
+  {   387,   3,   9,   3,    0,   -8, 0 },  // 0x5C
+  {   391,   2,  11,   3,    0,   -8, 0 },  // 0x5D ']'
+  {   394,   6,   4,   7,    1,   -8, 0 },  // 0x5E '^'
+  {   397,   6,   1,   6,    0,    2, 0 },  // 0x5F '_'
+  {   398,   2,   2,   4,    1,   -8, 0 },  // 0x60 '`'
+  {   399,   6,   6,   6,    0,   -5, 0 },  // 0x61 'a'
+  {   404,   6,   9,   7,    0,   -8, 0 },  // 0x62 'b'
+  {   411,   4,   6,   5,    0,   -5, 0 },  // 0x63 'c'
+  {   414,   6,   9,   7,    0,   -8, 0 },  // 0x64 'd'
+  {   421,   4,   6,   5,    0,   -5, 0 },  // 0x65 'e'
+  {   424,   5,   9,   4,    0,   -8, 0 },  // 0x66 'f'
+  {   430,   5,   9,   6,    0,   -5, 0 },  // 0x67 'g'
+  {   436,   6,   9,   7,    0,   -8, 0 },  // 0x68 'h'
+  {   443,   3,   9,   4,    0,   -8, 0 },  // 0x69 'i'
+  {   447,   3,  12,   4,   -1,   -8, 0 },  // 0x6A 'j'
+  {   452,   7,   9,   7,    0,   -8, 0 },  // 0x6B 'k'
+  {    76,   3,   9,   4,    0,   -8, 0 },  // 0x6C 'l'
+  {   460,   9,   6,  10,    0,   -5, 0 },  // 0x6D 'm'
+  {   467,   6,   6,   7,    0,   -5, 0 },  // 0x6E 'n'
+  {   472,   6,   6,   7,    0,   -5, 0 },  // 0x6F 'o'
+  {   477,   6,   9,   7,    0,   -5, 0 },  // 0x70 'p'
+  {   484,   6,   9,   7,    0,   -5, 0 },  // 0x71 'q'
+  {   491,   5,   6,   5,    0,   -5, 0 },  // 0x72 'r'
+  {   495,   4,   6,   5,    0,   -5, 0 },  // 0x73 's'
+  {   498,   3,   7,   4,    0,   -6, 0 },  // 0x74 't'
+  {   501,   6,   6,   7,    0,   -5, 0 },  // 0x75 'u'
+  {   506,   7,   6,   6,   -1,   -5, 0 },  // 0x76 'v'
+  {   512,   9,   6,   9,    0,   -5, 0 },  // 0x77 'w'
+  {   519,   6,   6,   7,    0,   -5, 0 },  // 0x78 'x'
+  {   524,   6,   9,   7,    0,   -5, 0 },  // 0x79 'y'
+  {   531,   5,   6,   6,    0,   -5, 0 },  // 0x7A 'z'
+  {   535,   3,  11,   6,    1,   -8, 0 },  // 0x7B '{'
+  {   540,   1,  11,   2,    0,   -8, 1 },  // 0x7C '|'
+  {   541,   3,  11,   6,    1,   -8, 0 },  // 0x7D '}'
+  {   546,   6,   2,   8,    1,   -4, 0 },  // 0x7E '~'
+  {   548,   6,   8,   9,    2,   -7, 2 },  // 0x7F
+  {   477,   6,   9,   7,    0,   -5, 0 },  // 0x80
+  {   411,   4,   6,   5,    0,   -5, 0 },  // 0x81
+  {   553,   6,   6,   6,    0,   -5, 0 },  // 0x82
+  {   524,   6,   9,   7,    0,   -5, 0 },  // 0x83
+  {   558,   8,  12,   8,    0,   -8, 0 },  // 0x84
+  {   519,   6,   6,   7,    0,   -5, 0 },  // 0x85
+  {   570,   6,   7,   7,    0,   -5, 0 },  // 0x86
+  {   576,   6,   6,   6,    0,   -5, 0 },  // 0x87
+  {   581,   9,   6,  10,    0,   -5, 0 },  // 0x88
+  {   588,   9,   7,  10,    0,   -5, 0 },  // 0x89
+  {   596,   6,   6,   7,    0,   -5, 0 },  // 0x8A
+  {   601,   8,   6,   9,    0,   -5, 0 },  // 0x8B
+  {   607,   5,   6,   6,    0,   -5, 0 },  // 0x8C
+  {   611,   5,   6,   5,    0,   -5, 0 },  // 0x8D
+  {   615,   9,   6,   9,    0,   -5, 0 },  // 0x8E
+  {   622,   6,   6,   6,    0,   -5, 0 },  // 0x8F
+  {   159,   9,   9,   9,    0,   -8, 0 },  // 0x90
+  {   627,   7,   8,   8,    0,   -7, 0 },  // 0x91
+  {   170,   6,   9,   8,    1,   -8, 0 },  // 0x92
+  {   634,   6,   8,   8,    1,   -7, 2 },  // 0x93
+  {   639,   9,  10,   9,    0,   -7, 2 },  // 0x94
+  {   193,   7,   9,   8,    1,   -8, 0 },  // 0x95
+  {   650,  12,   8,  12,    0,   -7, 0 },  // 0x96
+  {   662,   6,   8,   6,    0,   -7, 0 },  // 0x97
+  {   668,   9,   8,  10,    0,   -7, 0 },  // 0x98
+  {   677,   9,  11,  10,    0,  -10, 0 },  // 0x99
+  {   690,   9,   8,   9,    0,   -7, 0 },  // 0x9A
+  {   699,   9,   8,   9,    0,   -7, 2 },  // 0x9B
+  {   255,  11,   9,  11,    0,   -8, 0 },  // 0x9C
+  {   219,   7,   9,   9,    1,   -8, 0 },  // 0x9D
+  {   279,   7,   9,   9,    1,   -8, 0 },  // 0x9E
+  {   706,   9,   8,  10,    0,   -7, 2 },  // 0x9F
+  {   287,   5,   9,   7,    1,   -8, 0 },  // 0xA0
+  {   177,   7,   9,   9,    1,   -8, 0 },  // 0xA1
+  {   318,   7,   9,   7,    0,   -8, 0 },  // 0xA2
+  {   712,   9,   8,   9,    0,   -7, 0 },  // 0xA3
+  {   721,  10,   8,  10,    0,   -7, 0 },  // 0xA4
+  {   355,   9,   9,   9,    0,   -8, 0 },  // 0xA5
+  {   731,   9,  10,  10,    0,   -7, 2 },  // 0xA6
+  {   740,   9,   8,   9,    0,   -7, 0 },  // 0xA7
+  {   749,  13,   8,  13,    0,   -7, 2 },  // 0xA8
+  {   759,  13,  10,  13,    0,   -7, 2 },  // 0xA9
+  {   770,   9,   8,   9,    0,   -7, 0 },  // 0xAA
+  {   779,  11,   8,  12,    0,   -7, 2 },  // 0xAB
+  {   789,   7,   8,   8,    0,   -7, 0 },  // 0xAC
+  {   796,   6,   9,   8,    1,   -8, 0 },  // 0xAD
+  {   803,  13,   8,  13,    0,   -7, 0 },  // 0xAE
+  {   816,   8,   9,   9,    0,   -8, 0 },  // 0xAF
+  {   399,   6,   6,   6,    0,   -5, 0 },  // 0xB0
+  {   825,   5,   9,   7,    1,   -8, 0 },  // 0xB1
+  {   831,   6,   6,   6,    0,   -5, 0 },  // 0xB2
+  {   836,   5,   6,   5,    0,   -5, 2 },  // 0xB3
+  {   839,   6,   7,   6,    0,   -5, 0 },  // 0xB4
+  {   421,   4,   6,   5,    0,   -5, 0 },  // 0xB5
+  {   845,   8,   6,   9,    0,   -5, 0 },  // 0xB6
+  {   851,   5,   6,   5,    0,   -5, 0 },  // 0xB7
+  {   855,   6,   6,   7,    0,   -5, 0 },  // 0xB8
+  {   860,   6,   8,   7,    0,   -7, 0 },  // 0xB9
+  {   866,   6,   6,   6,    0,   -5, 0 },  // 0xBA
+  {   871,   6,   6,   6,    0,   -5, 0 },  // 0xBB
+  {   876,   8,   6,   8,    0,   -5, 0 },  // 0xBC
+  {   882,   6,   6,   7,    0,   -5, 0 },  // 0xBD
+  {   472,   6,   6,   7,    0,   -5, 0 },  // 0xBE
+  {   887,   6,   6,   7,    0,   -5, 2 },  // 0xBF
+  {   890,   8,  10,   8,    0,   -9, 0 },  // 0xC0
+  {   900,   5,   8,   5,    0,   -7, 0 }   // 0xC1
+};
+
+const RleFont timesnrcyr6pt8bRle PROGMEM = {
+  timesnrcyr6pt8bRleData,
+  timesnrcyr6pt8bRleGlyphs,
+  0x20, 0xC1, 13 };
+
+#endif // TIMESNRCYR6PT8BRLE_H_
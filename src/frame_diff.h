@@ -0,0 +1,166 @@
+#ifndef FRAME_DIFF_H_
+#define FRAME_DIFF_H_
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+
+#include "bwr_canvas.h"
+#include "damage.h"
+
+// Frame diff: where a new BWR frame differs from the previous one.
+//
+// Rows are compared 32 bits at a time, black and red planes side by side,
+// and an equal word costs four loads and two compares. For each row the diff
+// keeps the first and last byte that changed, found from the differing
+// word's lowest and highest set bit, plus the bytes that held red in the
+// previous frame, which the refresh has to treat with the 3-color
+// waveform. changedPixels counts pixels whose black or red bit differs,
+// for the share of the frame that changed.
+//
+// frameDiffFile() reads the previous frame from a BWR file on SPIFFS
+// (black plane, then red plane) in chunks of FRAME_DIFF_CHUNK_BYTES per
+// plane, through two handles so both planes of a row are at hand. Given a
+// DamageSet it compares only inside it and seeks over chunks without any
+// of it. Rows must be a whole number of words (800 px: 25).
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "frame_diff.h finds the changed byte of a word assuming little-endian loads"
+#endif
+
+#define FRAME_DIFF_MAX_ROWS 480
+#define FRAME_DIFF_CHUNK_BYTES 1200 // Per plane: 12 rows of 800 px
+#define FRAME_DIFF_NONE 0xFF // No byte in the row
+
+typedef struct {
+    uint16_t rows;
+    uint32_t pixels; // In the frame
+    uint32_t changedPixels; // Black or red bit differs
+    uint8_t first[FRAME_DIFF_MAX_ROWS]; // First changed byte, FRAME_DIFF_NONE when the row is equal
+    uint8_t last[FRAME_DIFF_MAX_ROWS];
+    uint8_t redFirst[FRAME_DIFF_MAX_ROWS]; // Bytes with red in the previous frame
+    uint8_t redLast[FRAME_DIFF_MAX_ROWS];
+} FrameDiff;
+
+// Function declarations
+bool frameDiffBegin(FrameDiff& diff, uint16_t rows, uint16_t stride);
+void frameDiffRow(FrameDiff& diff, uint16_t row, const uint8_t* oldBlack, const uint8_t* oldRed, const uint8_t* newBlack,
+    const uint8_t* newRed, uint16_t firstByte, uint16_t lastByte);
+bool frameDiffFile(FrameDiff& diff, const char* filename, const BwrCanvas& frame, const DamageSet* area);
+uint16_t frameDiffPerMille(const FrameDiff& diff);
+
+// Implementation
+
+namespace {
+
+void frameDiffExtend(uint8_t* first, uint8_t* last, uint16_t row, uint16_t firstByte, uint16_t lastByte)
+{
+    if (first[row] == FRAME_DIFF_NONE)
+        first[row] = firstByte;
+    last[row] = lastByte;
+}
+
+uint32_t frameDiffLoad(const uint8_t* p)
+{
+    uint32_t word;
+    memcpy(&word, p, sizeof(word)); // One load when aligned, and safe when not
+    return word;
+}
+
+// Byte offsets of the lowest and highest set bit within a word
+uint8_t frameDiffLowByte(uint32_t bits)
+{
+    return __builtin_ctz(bits) / 8;
+}
+
+uint8_t frameDiffHighByte(uint32_t bits)
+{
+    return (31 - __builtin_clz(bits)) / 8;
+}
+
+// Whether any row in top..top+count-1 has damage
+bool frameDiffAreaHits(const DamageSet& area, uint16_t top, uint16_t count)
+{
+    for (uint8_t i = 0; i < area.count; i++)
+        if (area.rects[i].y < top + count && area.rects[i].y + area.rects[i].h > top)
+            return true;
+    return false;
+}
+
+} // namespace
+
+// Clears the diff for a frame of rows x stride bytes; false when the
+// frame does not fit it
+bool frameDiffBegin(FrameDiff& diff, uint16_t rows, uint16_t stride)
+{
+    if (rows > FRAME_DIFF_MAX_ROWS || stride % 4 || stride >= FRAME_DIFF_NONE || stride > FRAME_DIFF_CHUNK_BYTES)
+        return false;
+    diff.rows = rows;
+    diff.pixels = (uint32_t)rows * stride * 8;
+    diff.changedPixels = 0;
+    memset(diff.first, FRAME_DIFF_NONE, rows);
+    memset(diff.redFirst, FRAME_DIFF_NONE, rows);
+    return true;
+}
+
+// Compares bytes firstByte..lastByte of one row, widened to whole words
+void frameDiffRow(FrameDiff& diff, uint16_t row, const uint8_t* oldBlack, const uint8_t* oldRed, const uint8_t* newBlack,
+    const uint8_t* newRed, uint16_t firstByte, uint16_t lastByte)
+{
+    for (uint16_t i = firstByte & ~3; i <= lastByte; i += 4) {
+        uint32_t red = frameDiffLoad(oldRed + i);
+        uint32_t wasRed = ~red; // 0 = ink
+        uint32_t changed = (frameDiffLoad(oldBlack + i) ^ frameDiffLoad(newBlack + i)) | (red ^ frameDiffLoad(newRed + i));
+        if (wasRed)
+            frameDiffExtend(diff.redFirst, diff.redLast, row, i + frameDiffLowByte(wasRed), i + frameDiffHighByte(wasRed));
+        if (!changed)
+            continue;
+        frameDiffExtend(diff.first, diff.last, row, i + frameDiffLowByte(changed), i + frameDiffHighByte(changed));
+        diff.changedPixels += __builtin_popcount(changed);
+    }
+}
+
+// Compares the full-frame canvas with the BWR file, inside area unless it
+// is nullptr; false when the file is missing or does not match the frame
+bool frameDiffFile(FrameDiff& diff, const char* filename, const BwrCanvas& frame, const DamageSet* area)
+{
+    static uint32_t blackChunk[FRAME_DIFF_CHUNK_BYTES / 4], redChunk[FRAME_DIFF_CHUNK_BYTES / 4];
+    uint16_t stride = frame.stride(), rows = frame.rows();
+    if (frame.bands() != 1 || !frameDiffBegin(diff, rows, stride))
+        return false;
+    size_t planeSize = (size_t)stride * rows;
+    File black = SPIFFS.open(filename, FILE_READ);
+    File red = SPIFFS.open(filename, FILE_READ);
+    bool ok = black && red && black.size() == 2 * planeSize && red.seek(planeSize);
+    uint16_t chunkRows = FRAME_DIFF_CHUNK_BYTES / stride;
+    for (uint16_t top = 0; ok && top < rows; top += chunkRows) {
+        uint16_t n = min(chunkRows, (uint16_t)(rows - top));
+        size_t bytes = (size_t)n * stride;
+        if (area && !frameDiffAreaHits(*area, top, n)) {
+            ok = black.seek(top * stride + bytes) && red.seek(planeSize + top * stride + bytes);
+            continue;
+        }
+        ok = black.read((uint8_t*)blackChunk, bytes) == bytes && red.read((uint8_t*)redChunk, bytes) == bytes;
+        for (uint16_t r = 0; ok && r < n; r++) {
+            uint16_t row = top + r;
+            int16_t left = 0, right = stride * 8 - 1;
+            if (area && !damageRowSpan(*area, row, &left, &right))
+                continue;
+            size_t offset = (size_t)row * stride;
+            frameDiffRow(diff, row, (const uint8_t*)blackChunk + (size_t)r * stride, (const uint8_t*)redChunk + (size_t)r * stride,
+                frame.blackPlane() + offset, frame.redPlane() + offset, left / 8, right / 8);
+        }
+    }
+    if (black)
+        black.close();
+    if (red)
+        red.close();
+    return ok;
+}
+
+// Changed pixels per thousand
+uint16_t frameDiffPerMille(const FrameDiff& diff)
+{
+    return diff.pixels ? (uint64_t)diff.changedPixels * 1000 / diff.pixels : 0;
+}
+
+#endif // FRAME_DIFF_H_
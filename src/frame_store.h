@@ -0,0 +1,239 @@
+#ifndef FRAME_STORE_H_
+#define FRAME_STORE_H_
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+
+// Frame store: a playlist of pre-rendered frames kept on SPIFFS.
+//
+// The server's /playlist endpoint returns an "EPL1" bundle (little-endian):
+//   char     magic[4]            "EPL1"
+//   uint16_t frameCount
+//   uint16_t reserved
+//   uint32_t refreshIntervalSec  0 = use the firmware default
+//   frameCount x { uint32_t length; uint32_t durationSec; }
+//   frame images (BMP, PNG or BWR) back to back
+//
+// frameStoreImportBundle() splits a downloaded bundle into /frame<N>.bin and
+// writes the /frames.idx manifest, so later wakes can show the next frame
+// without bringing up WiFi. Frames are extracted under /frame<N>.tmp and
+// only replace the current ones once all of them are written; when SPIFFS
+// has no room for both, the current ones are removed first.
+
+#define FRAME_STORE_MAGIC 0x314C5045 // "EPL1"
+#define FRAME_STORE_MAX_FRAMES 8
+#define FRAME_STORE_MANIFEST "/frames.idx"
+#define FRAME_STORE_MANIFEST_TMP "/frames.tmp"
+#define FRAME_STORE_SLACK_DIV 16 // Keep 1/16 of the frames' size free for SPIFFS metadata
+
+typedef struct {
+    uint32_t magic;
+    uint16_t count;
+    uint16_t reserved;
+    uint32_t refreshIntervalSec;
+    uint32_t durationSec[FRAME_STORE_MAX_FRAMES];
+    uint32_t size[FRAME_STORE_MAX_FRAMES];
+} FrameStoreManifest;
+
+// Function declarations
+void frameStorePath(uint8_t index, char* path, size_t len);
+bool frameStoreLoad(FrameStoreManifest& manifest);
+bool frameStoreImportBundle(const char* bundleFile, FrameStoreManifest& manifest);
+void frameStoreClear();
+
+// Implementation
+
+void frameStorePath(uint8_t index, char* path, size_t len)
+{
+    snprintf(path, len, "/frame%u.bin", index);
+}
+
+namespace {
+
+void frameStoreTempPath(uint8_t index, char* path, size_t len)
+{
+    snprintf(path, len, "/frame%u.tmp", index);
+}
+
+void frameStoreRemoveTemp()
+{
+    char path[24];
+    for (uint8_t i = 0; i < FRAME_STORE_MAX_FRAMES; i++) {
+        frameStoreTempPath(i, path, sizeof(path));
+        if (SPIFFS.exists(path))
+            SPIFFS.remove(path);
+    }
+}
+
+// Copies length bytes from the bundle's read position into a new file
+bool frameStoreExtract(File& bundle, const char* path, uint32_t length)
+{
+    uint8_t buffer[4096];
+    File frame = SPIFFS.open(path, FILE_WRITE);
+    if (!frame) {
+        Serial.printf("Frame store: cannot create %s\n", path);
+        return false;
+    }
+    uint32_t remaining = length;
+    while (remaining > 0) {
+        size_t chunk = remaining > sizeof(buffer) ? sizeof(buffer) : remaining;
+        size_t bytesRead = bundle.read(buffer, chunk);
+        if (bytesRead == 0 || frame.write(buffer, bytesRead) != bytesRead)
+            break;
+        remaining -= bytesRead;
+    }
+    frame.close();
+    if (remaining > 0) {
+        Serial.printf("Frame store: short write on %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+// Loads the manifest and checks that every frame it lists is still on flash
+bool frameStoreLoad(FrameStoreManifest& manifest)
+{
+    File file = SPIFFS.open(FRAME_STORE_MANIFEST, FILE_READ);
+    if (!file)
+        return false;
+    size_t bytesRead = file.read((uint8_t*)&manifest, sizeof(manifest));
+    file.close();
+
+    if (bytesRead != sizeof(manifest) || manifest.magic != FRAME_STORE_MAGIC || manifest.count == 0
+        || manifest.count > FRAME_STORE_MAX_FRAMES) {
+        Serial.println("Frame store: manifest missing or invalid");
+        return false;
+    }
+
+    char path[24];
+    for (uint8_t i = 0; i < manifest.count; i++) {
+        frameStorePath(i, path, sizeof(path));
+        File frame = SPIFFS.open(path, FILE_READ);
+        size_t size = frame ? frame.size() : 0;
+        if (frame)
+            frame.close();
+        if (size != manifest.size[i]) {
+            Serial.printf("Frame store: %s has %u bytes, expected %lu\n", path, (unsigned)size, (unsigned long)manifest.size[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Splits a downloaded bundle into frame files. The old frames are only
+// replaced once every new one has been extracted, so a truncated download
+// or a failed write leaves the previous playlist usable, unless SPIFFS had
+// no room for both playlists at once.
+bool frameStoreImportBundle(const char* bundleFile, FrameStoreManifest& manifest)
+{
+    uint32_t startTime = millis();
+    File bundle = SPIFFS.open(bundleFile, FILE_READ);
+    if (!bundle) {
+        Serial.printf("Frame store: cannot open %s\n", bundleFile);
+        return false;
+    }
+
+    uint8_t header[12];
+    if (bundle.read(header, sizeof(header)) != sizeof(header)) {
+        Serial.println("Frame store: bundle too small");
+        bundle.close();
+        return false;
+    }
+
+    memset(&manifest, 0, sizeof(manifest));
+    memcpy(&manifest.magic, header, 4);
+    memcpy(&manifest.count, header + 4, 2);
+    memcpy(&manifest.refreshIntervalSec, header + 8, 4);
+
+    if (manifest.magic != FRAME_STORE_MAGIC || manifest.count == 0 || manifest.count > FRAME_STORE_MAX_FRAMES) {
+        Serial.printf("Frame store: bad bundle header (magic 0x%08lX, %u frames)\n", (unsigned long)manifest.magic, manifest.count);
+        bundle.close();
+        return false;
+    }
+
+    size_t expectedSize = sizeof(header) + manifest.count * 8;
+    for (uint8_t i = 0; i < manifest.count; i++) {
+        uint8_t entry[8];
+        if (bundle.read(entry, sizeof(entry)) != sizeof(entry)) {
+            bundle.close();
+            return false;
+        }
+        memcpy(&manifest.size[i], entry, 4);
+        memcpy(&manifest.durationSec[i], entry + 4, 4);
+        expectedSize += manifest.size[i];
+    }
+
+    if (bundle.size() != expectedSize) {
+        Serial.printf("Frame store: bundle is %u bytes, header says %u\n", (unsigned)bundle.size(), (unsigned)expectedSize);
+        bundle.close();
+        return false;
+    }
+
+    // The new frames go next to the old ones when there is room
+    size_t frameBytes = expectedSize - sizeof(header) - manifest.count * 8;
+    size_t freeBytes = SPIFFS.totalBytes() - SPIFFS.usedBytes();
+    frameStoreRemoveTemp();
+    if (freeBytes < frameBytes + frameBytes / FRAME_STORE_SLACK_DIV) {
+        Serial.printf("Frame store: %u bytes free for %u bytes of frames, removing the current playlist first\n",
+            (unsigned)freeBytes, (unsigned)frameBytes);
+        frameStoreClear();
+    }
+
+    char path[24];
+    for (uint8_t i = 0; i < manifest.count; i++) {
+        frameStoreTempPath(i, path, sizeof(path));
+        if (!frameStoreExtract(bundle, path, manifest.size[i])) {
+            bundle.close();
+            frameStoreRemoveTemp();
+            return false;
+        }
+        Serial.printf("Frame store: frame %u, %lu bytes, shown for %lu s\n", i, (unsigned long)manifest.size[i],
+            (unsigned long)manifest.durationSec[i]);
+    }
+    bundle.close();
+    SPIFFS.remove(bundleFile);
+
+    // Swap the new frames in; without a manifest a reset in between leaves
+    // no playlist rather than a mixed one
+    frameStoreClear();
+    char tempPath[24];
+    for (uint8_t i = 0; i < manifest.count; i++) {
+        frameStoreTempPath(i, tempPath, sizeof(tempPath));
+        frameStorePath(i, path, sizeof(path));
+        if (!SPIFFS.rename(tempPath, path)) {
+            Serial.printf("Frame store: cannot rename %s\n", tempPath);
+            frameStoreRemoveTemp();
+            return false;
+        }
+    }
+
+    // Write the manifest last, via a temp file, so a reset mid-import never
+    // leaves a manifest pointing at missing frames
+    File file = SPIFFS.open(FRAME_STORE_MANIFEST_TMP, FILE_WRITE);
+    if (!file)
+        return false;
+    bool written = file.write((const uint8_t*)&manifest, sizeof(manifest)) == sizeof(manifest);
+    file.close();
+    if (!written || !SPIFFS.rename(FRAME_STORE_MANIFEST_TMP, FRAME_STORE_MANIFEST)) {
+        Serial.println("Frame store: failed to write manifest");
+        return false;
+    }
+
+    Serial.printf("Frame store: imported %u frames in %lu ms\n", manifest.count, millis() - startTime);
+    return true;
+}
+
+void frameStoreClear()
+{
+    SPIFFS.remove(FRAME_STORE_MANIFEST);
+    char path[24];
+    for (uint8_t i = 0; i < FRAME_STORE_MAX_FRAMES; i++) {
+        frameStorePath(i, path, sizeof(path));
+        if (SPIFFS.exists(path))
+            SPIFFS.remove(path);
+    }
+}
+
+#endif // FRAME_STORE_H_
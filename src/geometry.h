@@ -0,0 +1,194 @@
+#ifndef GEOMETRY_H_
+#define GEOMETRY_H_
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+
+// Fixed-point trigonometry and a scanline polygon filler for wind roses
+// and arrows. sim/bench/draw_bench.cpp compares it with the float code of
+// draw_functions.h's draw_wind() and arrow(), which is not built and keeps
+// its own drawing.
+//
+// Angles are whole degrees. geomSin()/geomCos() read a quarter-wave table
+// of Q14 values (GEOM_ONE = 1.0) that the compiler fills from a Taylor
+// polynomial, so there is no float math and no libm call at draw time.
+// geomPolar() works in compass terms: 0 degrees points up, angles grow
+// clockwise, as wind directions do.
+//
+// Points are in 1/GEOM_UNIT pixels; pixel (x, y) covers [x, x + 1) and
+// geomPixel() gives its center. geomFillPolygon() fills every pixel whose
+// center is inside the polygon (even-odd rule, left and top edges
+// inclusive), one writeFastHLine() per span, which a BwrCanvas turns into
+// whole-byte writes. Spokes are filled quads, so their width does not
+// depend on the angle as a bundle of drawLine()s does.
+// Coordinates must stay within +-2048 px for the 32-bit edge math.
+
+#define GEOM_ONE_SHIFT 14
+#define GEOM_ONE (1 << GEOM_ONE_SHIFT) // geomSin(90)
+#define GEOM_UNIT_SHIFT 4
+#define GEOM_UNIT (1 << GEOM_UNIT_SHIFT) // GeomPoint units per pixel
+#define GEOM_MAX_POINTS 8 // Corners geomFillPolygon() takes
+
+typedef struct {
+    int32_t x; // 1/GEOM_UNIT px
+    int32_t y;
+} GeomPoint;
+
+// sin(x) for x in [0, pi/2] to better than 1e-7; single-return constexpr,
+// the device compiler is C++11
+constexpr double geomTaylorSin(double x)
+{
+    return x * (1 - x * x / 6 * (1 - x * x / 20 * (1 - x * x / 42 * (1 - x * x / 72 * (1 - x * x / 110)))));
+}
+
+constexpr int16_t geomSinEntry(int degrees)
+{
+    return (int16_t)(geomTaylorSin(degrees * 3.14159265358979323846 / 180) * GEOM_ONE + 0.5);
+}
+
+#define GEOM_SIN5(d) geomSinEntry(d), geomSinEntry(d + 1), geomSinEntry(d + 2), geomSinEntry(d + 3), geomSinEntry(d + 4)
+#define GEOM_SIN10(d) GEOM_SIN5(d), GEOM_SIN5(d + 5)
+
+// sin(0..90 degrees) in Q14
+constexpr int16_t GEOM_SIN_TABLE[91] = { GEOM_SIN10(0), GEOM_SIN10(10), GEOM_SIN10(20), GEOM_SIN10(30), GEOM_SIN10(40),
+    GEOM_SIN10(50), GEOM_SIN10(60), GEOM_SIN10(70), GEOM_SIN10(80), geomSinEntry(90) };
+
+#undef GEOM_SIN10
+#undef GEOM_SIN5
+
+static_assert(GEOM_SIN_TABLE[30] == GEOM_ONE / 2 && GEOM_SIN_TABLE[90] == GEOM_ONE, "sine table is off");
+
+// Function declarations
+int32_t geomSin(int32_t degrees);
+int32_t geomCos(int32_t degrees);
+GeomPoint geomPixel(int16_t x, int16_t y);
+GeomPoint geomPolar(GeomPoint center, int32_t radius, int32_t degrees);
+void geomFillPolygon(Adafruit_GFX& gfx, const GeomPoint* points, uint8_t count, uint16_t color);
+void geomSpokes(Adafruit_GFX& gfx, GeomPoint center, int32_t inner, int32_t outer, int32_t firstDegrees, int32_t stepDegrees,
+    uint8_t count, int32_t width, uint16_t color);
+void geomArrow(Adafruit_GFX& gfx, GeomPoint base, int32_t degrees, int32_t length, int32_t width, uint16_t color);
+
+// Implementation
+
+namespace {
+
+// Smallest pixel whose center is at or right of/below v
+int32_t geomFirstPixel(int32_t v)
+{
+    return (v - GEOM_UNIT / 2 + GEOM_UNIT - 1) >> GEOM_UNIT_SHIFT;
+}
+
+int32_t geomScale(int32_t value, int32_t q14)
+{
+    return (value * q14 + GEOM_ONE / 2) >> GEOM_ONE_SHIFT;
+}
+
+// Quad of width around the segment from-to, offset by (nx, ny) each side
+void geomFillBand(Adafruit_GFX& gfx, GeomPoint from, GeomPoint to, int32_t nx, int32_t ny, uint16_t color)
+{
+    GeomPoint quad[4] = { { from.x + nx, from.y + ny }, { to.x + nx, to.y + ny }, { to.x - nx, to.y - ny },
+        { from.x - nx, from.y - ny } };
+    geomFillPolygon(gfx, quad, 4, color);
+}
+
+} // namespace
+
+// Q14 sine of any whole angle
+int32_t geomSin(int32_t degrees)
+{
+    degrees %= 360;
+    if (degrees < 0)
+        degrees += 360;
+    if (degrees <= 90)
+        return GEOM_SIN_TABLE[degrees];
+    if (degrees <= 180)
+        return GEOM_SIN_TABLE[180 - degrees];
+    if (degrees <= 270)
+        return -GEOM_SIN_TABLE[degrees - 180];
+    return -GEOM_SIN_TABLE[360 - degrees];
+}
+
+int32_t geomCos(int32_t degrees)
+{
+    return geomSin(degrees + 90);
+}
+
+// Center of pixel (x, y)
+GeomPoint geomPixel(int16_t x, int16_t y)
+{
+    GeomPoint point = { x * GEOM_UNIT + GEOM_UNIT / 2, y * GEOM_UNIT + GEOM_UNIT / 2 };
+    return point;
+}
+
+// Point radius (1/GEOM_UNIT px) from center at a compass angle: 0 = up,
+// 90 = right
+GeomPoint geomPolar(GeomPoint center, int32_t radius, int32_t degrees)
+{
+    GeomPoint point = { center.x + geomScale(radius, geomSin(degrees)), center.y - geomScale(radius, geomCos(degrees)) };
+    return point;
+}
+
+// Fills the polygon through up to GEOM_MAX_POINTS corners, in either
+// winding order, one horizontal span per run of covered pixel centers
+void geomFillPolygon(Adafruit_GFX& gfx, const GeomPoint* points, uint8_t count, uint16_t color)
+{
+    if (count < 3 || count > GEOM_MAX_POINTS)
+        return;
+    int32_t top = points[0].y, bottom = points[0].y;
+    for (uint8_t i = 1; i < count; i++) {
+        top = min(top, points[i].y);
+        bottom = max(bottom, points[i].y);
+    }
+    int32_t firstRow = max(geomFirstPixel(top), (int32_t)0);
+    int32_t lastRow = min(geomFirstPixel(bottom) - 1, (int32_t)gfx.height() - 1);
+
+    gfx.startWrite();
+    for (int32_t row = firstRow; row <= lastRow; row++) {
+        int32_t sampleY = row * GEOM_UNIT + GEOM_UNIT / 2;
+        int32_t crossings[GEOM_MAX_POINTS];
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < count; i++) {
+            const GeomPoint& a = points[i];
+            const GeomPoint& b = points[i + 1 < count ? i + 1 : 0];
+            // Half-open in y, so a shared vertex is counted once
+            if ((a.y <= sampleY) == (b.y <= sampleY))
+                continue;
+            int32_t x = a.x + (sampleY - a.y) * (b.x - a.x) / (b.y - a.y);
+            uint8_t j = n++;
+            for (; j > 0 && crossings[j - 1] > x; j--)
+                crossings[j] = crossings[j - 1];
+            crossings[j] = x;
+        }
+        for (uint8_t i = 0; i + 1 < n; i += 2) {
+            int32_t left = max(geomFirstPixel(crossings[i]), (int32_t)0);
+            int32_t right = min(geomFirstPixel(crossings[i + 1]) - 1, (int32_t)gfx.width() - 1);
+            if (left <= right)
+                gfx.writeFastHLine(left, row, right - left + 1, color);
+        }
+    }
+    gfx.endWrite();
+}
+
+// count lines radiating from center, from radius inner to outer, the first
+// at firstDegrees and each next one stepDegrees on; the normals come from
+// the sine table, not a square root
+void geomSpokes(Adafruit_GFX& gfx, GeomPoint center, int32_t inner, int32_t outer, int32_t firstDegrees, int32_t stepDegrees,
+    uint8_t count, int32_t width, uint16_t color)
+{
+    for (uint8_t i = 0; i < count; i++) {
+        int32_t degrees = firstDegrees + i * stepDegrees;
+        GeomPoint normal = geomPolar({ 0, 0 }, width / 2, degrees + 90);
+        geomFillBand(gfx, geomPolar(center, inner, degrees), geomPolar(center, outer, degrees), normal.x, normal.y, color);
+    }
+}
+
+// Triangular arrow head: the back edge, width wide, centered on base and
+// the tip length further on at the compass angle
+void geomArrow(Adafruit_GFX& gfx, GeomPoint base, int32_t degrees, int32_t length, int32_t width, uint16_t color)
+{
+    GeomPoint points[3] = { geomPolar(base, length, degrees), geomPolar(base, width / 2, degrees + 90),
+        geomPolar(base, width / 2, degrees - 90) };
+    geomFillPolygon(gfx, points, 3, color);
+}
+
+#endif // GEOMETRY_H_
@@ -0,0 +1,372 @@
+#ifndef GLYPH_CACHE_H_
+#define GLYPH_CACHE_H_
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+
+#include "rle_font.h"
+
+// Glyph and text-bounds cache for GFXfont and RleFont text.
+//
+// Adafruit GFX draws a glyph by walking its bit stream and calling
+// writePixel() for every set bit, on every page of a paged display. Here a
+// glyph is unpacked once into byte-aligned rows (padded to whole bytes, so
+// row r starts at r * bytesPerRow) and blitted into the BWR planes a byte
+// at a time; glyphs outside the current band are skipped without touching
+// their bitmap. BwrCanvas::write() uses it, so print() on a canvas takes
+// this path. For RleFont (rle_font.h) this is also where glyphs get
+// decompressed, so a glyph is decoded once and not on every band.
+//
+// Unpacked glyphs live in fixed-size blocks that are recycled least
+// recently used first. A glyph too large for a block (above about 30 px at
+// 18pt) is unpacked into a scratch block instead, valid until the next
+// lookup.
+//
+// Text bounds are memoized by (font, string): dashboards measure the same
+// labels on every page and every wake. Text is measured unwrapped at size 1
+// (its callers turn wrapping off, nothing scales text); GFXfont strings with
+// newlines go to Adafruit GFX.
+
+#define GLYPH_CACHE_BLOCK_SIZE 128 // Bytes of rows per cached glyph
+#define GLYPH_CACHE_BLOCKS 128 // Cached glyphs
+#define GLYPH_CACHE_BUCKETS 256 // Hash chains, power of two
+#define GLYPH_CACHE_SCRATCH_SIZE 1024 // Largest glyph that can be drawn at all
+#define GLYPH_CACHE_BOUNDS_SLOTS 64 // Memoized text bounds, power of two
+
+typedef struct {
+    const void* font; // GFXfont or RleFont
+    const uint8_t* rows;
+    uint32_t lastUse;
+    uint16_t next; // Next block in the hash chain + 1, 0 = end
+    uint8_t code;
+    uint8_t width;
+    uint8_t height;
+    uint8_t bytesPerRow;
+    int8_t xOffset;
+    int8_t yOffset;
+    uint8_t xAdvance;
+} GlyphCacheEntry;
+
+typedef struct {
+    const void* font;
+    uint32_t hash;
+    uint16_t length;
+    int16_t x1; // Relative to the cursor
+    int16_t y1;
+    uint16_t w;
+    uint16_t h;
+} GlyphCacheBounds;
+
+typedef struct {
+    uint32_t glyphHits;
+    uint32_t glyphMisses;
+    uint32_t evictions;
+    uint32_t boundsHits;
+    uint32_t boundsMisses;
+} GlyphCacheStats;
+
+// Function declarations
+const GlyphCacheEntry* glyphCacheGet(const GFXfont* font, uint8_t code);
+const GlyphCacheEntry* glyphCacheGet(const RleFont* font, uint8_t code);
+void glyphCacheBlit(const GlyphCacheEntry* glyph, int16_t x, int16_t y, uint8_t ink, uint8_t* black, uint8_t* red, uint16_t stride,
+    int16_t width, int16_t bandY, uint16_t rows);
+void glyphCacheTextBounds(Adafruit_GFX& gfx, const GFXfont* font, const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+    uint16_t* w, uint16_t* h);
+void glyphCacheTextBounds(Adafruit_GFX& gfx, const GFXfont* font, const String& text, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+    uint16_t* w, uint16_t* h);
+void glyphCacheTextBounds(const RleFont* font, const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+    uint16_t* h);
+void glyphCacheClear();
+const GlyphCacheStats& glyphCacheStats();
+
+// Implementation
+
+namespace {
+
+uint8_t glyphCacheRows[GLYPH_CACHE_BLOCKS][GLYPH_CACHE_BLOCK_SIZE];
+uint8_t glyphCacheScratchRows[GLYPH_CACHE_SCRATCH_SIZE];
+GlyphCacheEntry glyphCacheBlocks[GLYPH_CACHE_BLOCKS];
+GlyphCacheEntry glyphCacheScratch;
+uint16_t glyphCacheBuckets[GLYPH_CACHE_BUCKETS]; // First block + 1, 0 = empty
+uint16_t glyphCacheBlocksUsed = 0;
+uint32_t glyphCacheTick = 0;
+GlyphCacheBounds glyphCacheBoundsSlots[GLYPH_CACHE_BOUNDS_SLOTS];
+GlyphCacheStats glyphCacheCounters;
+
+uint32_t glyphCacheHash(const void* font, const char* text, size_t length)
+{
+    uint32_t hash = 2166136261u ^ (uint32_t)(uintptr_t)font; // FNV-1a
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ (uint8_t)text[i]) * 16777619u;
+    return hash;
+}
+
+uint16_t* glyphCacheBucket(const void* font, uint8_t code)
+{
+    uint32_t hash = glyphCacheHash(font, nullptr, 0) + code * 2654435761u;
+    return &glyphCacheBuckets[(hash >> 16) & (GLYPH_CACHE_BUCKETS - 1)];
+}
+
+GlyphCacheEntry* glyphCacheFind(const void* font, uint8_t code)
+{
+    for (uint16_t i = *glyphCacheBucket(font, code); i; i = glyphCacheBlocks[i - 1].next) {
+        GlyphCacheEntry& entry = glyphCacheBlocks[i - 1];
+        if (entry.font == font && entry.code == code) {
+            entry.lastUse = ++glyphCacheTick;
+            glyphCacheCounters.glyphHits++;
+            return &entry;
+        }
+    }
+    glyphCacheCounters.glyphMisses++;
+    return nullptr;
+}
+
+void glyphCacheUnlink(uint16_t index)
+{
+    GlyphCacheEntry& entry = glyphCacheBlocks[index];
+    for (uint16_t* link = glyphCacheBucket(entry.font, entry.code); *link; link = &glyphCacheBlocks[*link - 1].next) {
+        if (*link == index + 1) {
+            *link = entry.next;
+            return;
+        }
+    }
+}
+
+// Entry with room for the rows of a width x height glyph: a free block, the
+// least recently used one, or the scratch block
+GlyphCacheEntry* glyphCacheInsert(const void* font, uint8_t code, uint8_t width, uint8_t height)
+{
+    uint8_t bytesPerRow = (width + 7) / 8;
+    size_t size = (size_t)bytesPerRow * height;
+    GlyphCacheEntry* entry;
+    if (size > GLYPH_CACHE_SCRATCH_SIZE) {
+        return nullptr;
+    } else if (size > GLYPH_CACHE_BLOCK_SIZE) {
+        entry = &glyphCacheScratch;
+        entry->rows = glyphCacheScratchRows;
+    } else {
+        uint16_t index = 0;
+        if (glyphCacheBlocksUsed < GLYPH_CACHE_BLOCKS) {
+            index = glyphCacheBlocksUsed++;
+        } else {
+            for (uint16_t i = 1; i < GLYPH_CACHE_BLOCKS; i++) {
+                if (glyphCacheBlocks[i].lastUse < glyphCacheBlocks[index].lastUse)
+                    index = i;
+            }
+            glyphCacheUnlink(index);
+            glyphCacheCounters.evictions++;
+        }
+        uint16_t* bucket = glyphCacheBucket(font, code);
+        entry = &glyphCacheBlocks[index];
+        entry->rows = glyphCacheRows[index];
+        entry->next = *bucket;
+        *bucket = index + 1;
+    }
+    entry->font = font;
+    entry->code = code;
+    entry->width = width;
+    entry->height = height;
+    entry->bytesPerRow = bytesPerRow;
+    entry->lastUse = ++glyphCacheTick;
+    return entry;
+}
+
+// Applies one byte of glyph pixels to both planes
+inline void glyphCacheInk(uint8_t* black, uint8_t* red, size_t i, uint8_t bits, uint8_t ink)
+{
+    if (ink == 1) {
+        black[i] &= ~bits;
+        red[i] |= bits;
+    } else if (ink == 2) {
+        red[i] &= ~bits;
+        black[i] |= bits;
+    } else {
+        black[i] |= bits;
+        red[i] |= bits;
+    }
+}
+
+// Bounds of text relative to the cursor, memoized
+template <typename Font>
+const GlyphCacheBounds& glyphCacheMeasure(const Font* font, const char* text, size_t length)
+{
+    uint32_t hash = glyphCacheHash(font, text, length);
+    GlyphCacheBounds& slot = glyphCacheBoundsSlots[hash & (GLYPH_CACHE_BOUNDS_SLOTS - 1)];
+    if (slot.font == font && slot.hash == hash && slot.length == length) {
+        glyphCacheCounters.boundsHits++;
+        return slot;
+    }
+    glyphCacheCounters.boundsMisses++;
+    // Same accumulation as Adafruit_GFX::charBounds() without wrapping
+    int16_t cx = 0, minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+    for (size_t i = 0; i < length; i++) {
+        const GlyphCacheEntry* glyph = glyphCacheGet(font, (uint8_t)text[i]);
+        if (!glyph)
+            continue;
+        int16_t gx1 = cx + glyph->xOffset, gy1 = glyph->yOffset;
+        int16_t gx2 = gx1 + glyph->width - 1, gy2 = gy1 + glyph->height - 1;
+        if (gx1 < minx)
+            minx = gx1;
+        if (gy1 < miny)
+            miny = gy1;
+        if (gx2 > maxx)
+            maxx = gx2;
+        if (gy2 > maxy)
+            maxy = gy2;
+        cx += glyph->xAdvance;
+    }
+    slot.font = font;
+    slot.hash = hash;
+    slot.length = length;
+    slot.x1 = maxx >= minx ? minx : 0;
+    slot.w = maxx >= minx ? maxx - minx + 1 : 0;
+    slot.y1 = maxy >= miny ? miny : 0;
+    slot.h = maxy >= miny ? maxy - miny + 1 : 0;
+    return slot;
+}
+
+} // namespace
+
+// Unpacked glyph for code, or nullptr if the font does not have it
+const GlyphCacheEntry* glyphCacheGet(const GFXfont* font, uint8_t code)
+{
+    uint16_t first = pgm_read_word(&font->first);
+    uint16_t last = pgm_read_word(&font->last);
+    if (code < first || code > last)
+        return nullptr;
+    GlyphCacheEntry* entry = glyphCacheFind(font, code);
+    if (entry)
+        return entry;
+
+    const GFXglyph* glyph = font->glyph + (code - first);
+    uint8_t width = pgm_read_byte(&glyph->width);
+    uint8_t height = pgm_read_byte(&glyph->height);
+    entry = glyphCacheInsert(font, code, width, height);
+    if (!entry)
+        return nullptr;
+    entry->xOffset = pgm_read_byte(&glyph->xOffset);
+    entry->yOffset = pgm_read_byte(&glyph->yOffset);
+    entry->xAdvance = pgm_read_byte(&glyph->xAdvance);
+
+    // GFXfont bitmaps are one continuous bit stream; split it into rows
+    const uint8_t* bitmap = font->bitmap + pgm_read_word(&glyph->bitmapOffset);
+    uint8_t* rows = (uint8_t*)entry->rows;
+    memset(rows, 0, (size_t)entry->bytesPerRow * height);
+    uint32_t bit = 0;
+    for (uint8_t yy = 0; yy < height; yy++) {
+        for (uint8_t xx = 0; xx < width; xx++, bit++) {
+            if (pgm_read_byte(&bitmap[bit / 8]) & (0x80 >> (bit & 7)))
+                rows[yy * entry->bytesPerRow + xx / 8] |= 0x80 >> (xx & 7);
+        }
+    }
+    return entry;
+}
+
+// Decoded glyph for code, or nullptr if the font does not have it
+const GlyphCacheEntry* glyphCacheGet(const RleFont* font, uint8_t code)
+{
+    const RleGlyph* glyph = rleFontGlyph(font, code);
+    if (!glyph)
+        return nullptr;
+    GlyphCacheEntry* entry = glyphCacheFind(font, code);
+    if (entry)
+        return entry;
+
+    entry = glyphCacheInsert(font, code, pgm_read_byte(&glyph->width), pgm_read_byte(&glyph->height));
+    if (!entry)
+        return nullptr;
+    entry->xOffset = pgm_read_byte(&glyph->xOffset);
+    entry->yOffset = pgm_read_byte(&glyph->yOffset);
+    entry->xAdvance = pgm_read_byte(&glyph->xAdvance);
+    rleFontDecode(font, glyph, (uint8_t*)entry->rows, entry->bytesPerRow);
+    return entry;
+}
+
+// Draws glyph with its top-left corner at (x, y) into a band of BWR planes
+// covering rows bandY..bandY+rows-1; ink as BwrCanvas::ink()
+void glyphCacheBlit(const GlyphCacheEntry* glyph, int16_t x, int16_t y, uint8_t ink, uint8_t* black, uint8_t* red, uint16_t stride,
+    int16_t width, int16_t bandY, uint16_t rows)
+{
+    int16_t top = y > bandY ? y : bandY;
+    int16_t bottom = y + glyph->height < bandY + rows ? y + glyph->height : bandY + rows;
+    if (top >= bottom || x >= width || x + glyph->width <= 0)
+        return;
+    const uint8_t* src = glyph->rows + (top - y) * glyph->bytesPerRow;
+
+    if (x < 0 || x + glyph->width > width) {
+        // Clipped at the left or right edge: pixel by pixel
+        for (int16_t row = top; row < bottom; row++, src += glyph->bytesPerRow) {
+            for (uint8_t xx = 0; xx < glyph->width; xx++) {
+                int16_t px = x + xx;
+                if (px >= 0 && px < width && (src[xx / 8] & (0x80 >> (xx & 7))))
+                    glyphCacheInk(black, red, (size_t)(row - bandY) * stride + px / 8, 0x80 >> (px & 7), ink);
+            }
+        }
+        return;
+    }
+
+    uint8_t shift = x & 7;
+    for (int16_t row = top; row < bottom; row++, src += glyph->bytesPerRow) {
+        size_t i = (size_t)(row - bandY) * stride + x / 8;
+        for (uint8_t b = 0; b < glyph->bytesPerRow; b++, i++) {
+            uint8_t bits = src[b];
+            if (!bits)
+                continue;
+            glyphCacheInk(black, red, i, bits >> shift, ink);
+            // Spill into the next byte; never past the row since the glyph fits
+            if (shift && (uint8_t)(bits << (8 - shift)))
+                glyphCacheInk(black, red, i + 1, bits << (8 - shift), ink);
+        }
+    }
+}
+
+// getTextBounds() with memoization (see top of file). font is the one set
+// on gfx: Adafruit_GFX keeps it to itself.
+void glyphCacheTextBounds(Adafruit_GFX& gfx, const GFXfont* font, const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+    uint16_t* w, uint16_t* h)
+{
+    size_t length = strlen(text);
+    if (!font || length == 0 || length > 0xFFFF || strchr(text, '\n')) {
+        gfx.getTextBounds(text, x, y, x1, y1, w, h);
+        return;
+    }
+    const GlyphCacheBounds& bounds = glyphCacheMeasure(font, text, length);
+    *x1 = x + bounds.x1;
+    *y1 = y + bounds.y1;
+    *w = bounds.w;
+    *h = bounds.h;
+}
+
+void glyphCacheTextBounds(Adafruit_GFX& gfx, const GFXfont* font, const String& text, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+    uint16_t* w, uint16_t* h)
+{
+    glyphCacheTextBounds(gfx, font, text.c_str(), x, y, x1, y1, w, h);
+}
+
+// Bounds of a single line of RleFont text
+void glyphCacheTextBounds(const RleFont* font, const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+    uint16_t* h)
+{
+    size_t length = strlen(text);
+    if (length > 0xFFFF)
+        length = 0xFFFF;
+    const GlyphCacheBounds& bounds = glyphCacheMeasure(font, text, length);
+    *x1 = x + bounds.x1;
+    *y1 = y + bounds.y1;
+    *w = bounds.w;
+    *h = bounds.h;
+}
+
+void glyphCacheClear()
+{
+    memset(glyphCacheBuckets, 0, sizeof(glyphCacheBuckets));
+    memset(glyphCacheBoundsSlots, 0, sizeof(glyphCacheBoundsSlots));
+    glyphCacheBlocksUsed = 0;
+}
+
+const GlyphCacheStats& glyphCacheStats()
+{
+    return glyphCacheCounters;
+}
+
+#endif // GLYPH_CACHE_H_
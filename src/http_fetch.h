@@ -0,0 +1,590 @@
+#ifndef HTTP_FETCH_H_
+#define HTTP_FETCH_H_
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <sys/select.h>
+#include <sys/time.h>
+
+// Minimal HTTP/1.1 client used for the render API.
+//
+// Unlike HTTPClient it
+// - handles Transfer-Encoding: chunked as well as Content-Length and
+//   read-until-close bodies,
+// - blocks in select() with a stall timeout instead of polling available(),
+// - keeps the connection open between requests to the same host, so the
+//   frame download and the telemetry upload share one TCP handshake.
+//
+// Usage:
+//   int status = httpFetch.request("POST", url, "text/html", body, len);
+//   if (status == 200)
+//       httpFetch.readBody(fileSink, &file);
+//   httpFetch.finish();
+// Parsers that pull from a Stream (ArduinoJson) read the body through
+// HttpBodyStream instead of readBody(), like HTTPClient::getStream() but
+// with the chunked framing removed.
+
+#define HTTP_FETCH_BUFFER_SIZE 1460 // One TCP segment
+#define HTTP_FETCH_MAX_HEADERS 6
+
+// Body consumer; return false to abort the transfer
+typedef bool (*HttpBodySink)(const uint8_t* data, size_t len, void* context);
+
+class HttpFetch {
+public:
+    HttpFetch()
+        : _port(0)
+        , _connectTimeoutMs(3000)
+        , _stallTimeoutMs(5000)
+        , _bodyMode(BODY_NONE)
+        , _remaining(0)
+        , _contentLength(-1)
+        , _chunked(false)
+        , _chunkCrlfPending(false)
+        , _keepAlive(false)
+        , _bufPos(0)
+        , _bufLen(0)
+        , _headerCount(0)
+        , _bytesReceived(0)
+        , _elapsedMs(0)
+        , _bodyError(0)
+        , _span(nullptr)
+        , _spanLen(0)
+        , _spanPos(0)
+    {
+    }
+
+    // Collects the values of these response headers, like HTTPClient::collectHeaders()
+    void collectHeaders(const char* names[], size_t count);
+    String header(const char* name) const;
+
+    void setConnectTimeout(uint32_t ms) { _connectTimeoutMs = ms; }
+    void setStallTimeout(uint32_t ms) { _stallTimeoutMs = ms; }
+
+    // Sends the request and parses the status line and headers.
+    // Returns the HTTP status code, or a negative HTTP_FETCH_ERROR_* value.
+    int request(const char* method, const String& url, const char* contentType, const uint8_t* body, size_t bodyLen,
+        const char* extraHeaders = nullptr);
+
+    // Streams the response body into sink. Returns true if the whole body arrived,
+    // otherwise bodyError() tells why.
+    bool readBody(HttpBodySink sink, void* context);
+    int bodyError() const { return _bodyError; }
+
+    // Next body byte, or -1 at the end of the body or on an error
+    // (bodyError()); consume = false peeks
+    int bodyRead(bool consume);
+    size_t bodyRead(uint8_t* data, size_t len);
+    int bodyAvailable() const { return (int)(_spanLen - _spanPos) + (int)(_bufLen - _bufPos); }
+
+    // Drains a short unread body so the connection can be reused, or closes it
+    void finish();
+    void stop();
+
+    int32_t contentLength() const { return _contentLength; } // -1 if chunked or unknown
+    bool isChunked() const { return _chunked; }
+    uint32_t bytesReceived() const { return _bytesReceived; }
+    uint32_t elapsedMs() const { return _elapsedMs; }
+    float kbps() const { return _elapsedMs ? (_bytesReceived / 1024.0f) * 1000.0f / _elapsedMs : 0.0f; }
+
+    enum {
+        HTTP_FETCH_ERROR_URL = -1,
+        HTTP_FETCH_ERROR_CONNECT = -2,
+        HTTP_FETCH_ERROR_SEND = -3,
+        HTTP_FETCH_ERROR_TIMEOUT = -4,
+        HTTP_FETCH_ERROR_PROTOCOL = -5,
+        HTTP_FETCH_ERROR_CLOSED = -6,
+        HTTP_FETCH_ERROR_DNS = -7,
+        HTTP_FETCH_ERROR_SINK = -8
+    };
+    static const char* errorToString(int code);
+
+private:
+    enum BodyMode { BODY_NONE, BODY_LENGTH, BODY_CHUNKED, BODY_UNTIL_CLOSE };
+
+    bool parseUrl(const String& url, String& host, uint16_t& port, String& path);
+    int ensureConnected(const String& host, uint16_t port, bool& reused);
+    int sendAndReadHeaders(const char* method, const String& host, const String& path, const char* contentType,
+        const uint8_t* body, size_t bodyLen, const char* extraHeaders);
+    int fill();
+    int readLine(char* line, size_t len);
+    int readBodySpan(const uint8_t*& data);
+
+    WiFiClient _client;
+    String _host;
+    uint16_t _port;
+    uint32_t _connectTimeoutMs;
+    uint32_t _stallTimeoutMs;
+
+    BodyMode _bodyMode;
+    uint32_t _remaining; // Bytes left in the body (BODY_LENGTH) or current chunk
+    int32_t _contentLength;
+    bool _chunked;
+    bool _chunkCrlfPending;
+    bool _keepAlive;
+
+    uint8_t _buf[HTTP_FETCH_BUFFER_SIZE];
+    size_t _bufPos;
+    size_t _bufLen;
+
+    const char* _headerNames[HTTP_FETCH_MAX_HEADERS];
+    String _headerValues[HTTP_FETCH_MAX_HEADERS];
+    size_t _headerCount;
+
+    uint32_t _bytesReceived;
+    uint32_t _elapsedMs;
+    int _bodyError;
+
+    // Body bytes handed out by bodyRead(), a run of _buf from readBodySpan()
+    const uint8_t* _span;
+    size_t _spanLen;
+    size_t _spanPos;
+};
+
+class HttpBodyStream : public Stream {
+public:
+    explicit HttpBodyStream(HttpFetch& fetch)
+        : _fetch(fetch)
+    {
+    }
+
+    int available() override { return _fetch.bodyAvailable(); }
+    int read() override { return _fetch.bodyRead(true); }
+    int peek() override { return _fetch.bodyRead(false); }
+    // Returns at the end of the body instead of waiting out the Stream timeout
+    size_t readBytes(char* buffer, size_t length) override { return _fetch.bodyRead((uint8_t*)buffer, length); }
+    size_t write(uint8_t) override { return 0; }
+
+private:
+    HttpFetch& _fetch;
+};
+
+// Implementation
+
+void HttpFetch::collectHeaders(const char* names[], size_t count)
+{
+    _headerCount = count > HTTP_FETCH_MAX_HEADERS ? HTTP_FETCH_MAX_HEADERS : count;
+    for (size_t i = 0; i < _headerCount; i++) {
+        _headerNames[i] = names[i];
+        _headerValues[i] = "";
+    }
+}
+
+String HttpFetch::header(const char* name) const
+{
+    for (size_t i = 0; i < _headerCount; i++) {
+        if (strcasecmp(_headerNames[i], name) == 0)
+            return _headerValues[i];
+    }
+    return String();
+}
+
+const char* HttpFetch::errorToString(int code)
+{
+    switch (code) {
+    case HTTP_FETCH_ERROR_URL:
+        return "invalid url";
+    case HTTP_FETCH_ERROR_CONNECT:
+        return "connection refused";
+    case HTTP_FETCH_ERROR_SEND:
+        return "send failed";
+    case HTTP_FETCH_ERROR_TIMEOUT:
+        return "read timeout";
+    case HTTP_FETCH_ERROR_PROTOCOL:
+        return "malformed response";
+    case HTTP_FETCH_ERROR_CLOSED:
+        return "connection closed";
+    case HTTP_FETCH_ERROR_DNS:
+        return "dns lookup failed";
+    case HTTP_FETCH_ERROR_SINK:
+        return "rejected by sink";
+    default:
+        return "unknown error";
+    }
+}
+
+bool HttpFetch::parseUrl(const String& url, String& host, uint16_t& port, String& path)
+{
+    if (!url.startsWith("http://"))
+        return false;
+    int hostStart = 7;
+    int pathStart = url.indexOf('/', hostStart);
+    String hostPort = pathStart < 0 ? url.substring(hostStart) : url.substring(hostStart, pathStart);
+    path = pathStart < 0 ? String("/") : url.substring(pathStart);
+    int colon = hostPort.indexOf(':');
+    if (colon >= 0) {
+        host = hostPort.substring(0, colon);
+        port = hostPort.substring(colon + 1).toInt();
+    } else {
+        host = hostPort;
+        port = 80;
+    }
+    return host.length() > 0 && port > 0;
+}
+
+// Returns 0 when connected, or a negative error. The name is resolved
+// separately so a DNS failure can be told apart from a refused connection.
+int HttpFetch::ensureConnected(const String& host, uint16_t port, bool& reused)
+{
+    reused = false;
+    if (_keepAlive && _client.connected() && host == _host && port == _port) {
+        reused = true;
+        return 0;
+    }
+    _client.stop();
+    _bufPos = _bufLen = 0;
+    uint32_t tConnect = millis();
+    IPAddress ip;
+    if (!ip.fromString(host.c_str()) && !WiFi.hostByName(host.c_str(), ip)) {
+        Serial.printf("HTTP DNS lookup of %s failed\n", host.c_str());
+        return HTTP_FETCH_ERROR_DNS;
+    }
+    if (!_client.connect(ip, port, _connectTimeoutMs)) {
+        Serial.printf("HTTP connect to %s:%u failed\n", host.c_str(), port);
+        return HTTP_FETCH_ERROR_CONNECT;
+    }
+    _client.setNoDelay(true);
+    _host = host;
+    _port = port;
+    Serial.printf("HTTP connected to %s:%u in %lu ms\n", host.c_str(), port, millis() - tConnect);
+    return 0;
+}
+
+int HttpFetch::request(const char* method, const String& url, const char* contentType, const uint8_t* body, size_t bodyLen,
+    const char* extraHeaders)
+{
+    String host, path;
+    uint16_t port;
+    if (!parseUrl(url, host, port, path))
+        return HTTP_FETCH_ERROR_URL;
+
+    // A kept-alive connection may have been closed by the server in the
+    // meantime; that only shows up once we try to use it, so retry once
+    // on a fresh connection.
+    for (int attempt = 0; attempt < 2; attempt++) {
+        bool reused;
+        int rc = ensureConnected(host, port, reused);
+        if (rc < 0)
+            return rc;
+        int status = sendAndReadHeaders(method, host, path, contentType, body, bodyLen, extraHeaders);
+        if (status > 0 || !reused)
+            return status;
+        Serial.println("HTTP kept-alive connection went stale, reconnecting");
+        stop();
+    }
+    return HTTP_FETCH_ERROR_CLOSED;
+}
+
+int HttpFetch::sendAndReadHeaders(const char* method, const String& host, const String& path, const char* contentType,
+    const uint8_t* body, size_t bodyLen, const char* extraHeaders)
+{
+    _bodyMode = BODY_NONE;
+    _remaining = 0;
+    _contentLength = -1;
+    _chunked = false;
+    _chunkCrlfPending = false;
+    _keepAlive = false;
+    _bytesReceived = 0;
+    _elapsedMs = 0;
+    _bodyError = 0;
+    _spanLen = _spanPos = 0;
+    for (size_t i = 0; i < _headerCount; i++)
+        _headerValues[i] = "";
+
+    char head[384];
+    int headLen = snprintf(head, sizeof(head),
+        "%s %s HTTP/1.1\r\n"
+        "Host: %s:%u\r\n"
+        "User-Agent: ESP32-epaper\r\n"
+        "Accept: */*\r\n"
+        "Connection: keep-alive\r\n"
+        "Content-Type: %s\r\n"
+        "Content-Length: %u\r\n"
+        "%s"
+        "\r\n",
+        method, path.c_str(), host.c_str(), _port, contentType ? contentType : "application/octet-stream",
+        (unsigned)bodyLen, extraHeaders ? extraHeaders : "");
+    if (headLen <= 0 || headLen >= (int)sizeof(head))
+        return HTTP_FETCH_ERROR_URL;
+    if (_client.write((const uint8_t*)head, headLen) != (size_t)headLen)
+        return HTTP_FETCH_ERROR_SEND;
+    if (bodyLen > 0 && _client.write(body, bodyLen) != bodyLen)
+        return HTTP_FETCH_ERROR_SEND;
+
+    // Status line, skipping any 1xx interim responses
+    char line[256];
+    int status = 0;
+    bool http10 = false;
+    do {
+        int rc = readLine(line, sizeof(line));
+        if (rc < 0)
+            return rc;
+        if (strncmp(line, "HTTP/1.", 7) != 0 || strlen(line) < 12)
+            return HTTP_FETCH_ERROR_PROTOCOL;
+        http10 = line[7] == '0';
+        status = atoi(line + 9);
+        if (status >= 100 && status < 200) {
+            while ((rc = readLine(line, sizeof(line))) > 0) { }
+            if (rc < 0)
+                return rc;
+        }
+    } while (status >= 100 && status < 200);
+
+    _keepAlive = !http10;
+    for (;;) {
+        int rc = readLine(line, sizeof(line));
+        if (rc < 0)
+            return rc;
+        if (rc == 0)
+            break;
+        char* colon = strchr(line, ':');
+        if (!colon)
+            continue;
+        *colon = '\0';
+        const char* value = colon + 1;
+        while (*value == ' ' || *value == '\t')
+            value++;
+
+        if (strcasecmp(line, "Content-Length") == 0) {
+            _contentLength = atol(value);
+        } else if (strcasecmp(line, "Transfer-Encoding") == 0) {
+            _chunked = strcasestr(value, "chunked") != nullptr;
+        } else if (strcasecmp(line, "Connection") == 0) {
+            if (strcasestr(value, "close"))
+                _keepAlive = false;
+            else if (strcasestr(value, "keep-alive"))
+                _keepAlive = true;
+        }
+        for (size_t i = 0; i < _headerCount; i++) {
+            if (strcasecmp(line, _headerNames[i]) == 0)
+                _headerValues[i] = value;
+        }
+    }
+
+    if (_chunked) {
+        _bodyMode = BODY_CHUNKED;
+        _contentLength = -1;
+        _remaining = 0;
+    } else if (_contentLength >= 0) {
+        _bodyMode = _contentLength > 0 ? BODY_LENGTH : BODY_NONE;
+        _remaining = _contentLength;
+    } else if (status == 204 || status == 304 || strcmp(method, "HEAD") == 0) {
+        _bodyMode = BODY_NONE;
+    } else {
+        _bodyMode = BODY_UNTIL_CLOSE;
+        _keepAlive = false;
+    }
+    return status;
+}
+
+// Refills the read buffer, blocking in select() for up to the stall timeout.
+// Returns bytes now buffered, 0 on orderly close, or a negative error.
+int HttpFetch::fill()
+{
+    if (_bufPos < _bufLen)
+        return _bufLen - _bufPos;
+    _bufPos = _bufLen = 0;
+
+    // The core may already hold data in its own rx buffer, so try a read first
+    int n = _client.read(_buf, sizeof(_buf));
+    if (n > 0) {
+        _bufLen = n;
+        return n;
+    }
+
+    int fd = _client.fd();
+    if (fd < 0)
+        return HTTP_FETCH_ERROR_CLOSED;
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    FD_SET(fd, &readSet);
+    struct timeval tv;
+    tv.tv_sec = _stallTimeoutMs / 1000;
+    tv.tv_usec = (_stallTimeoutMs % 1000) * 1000;
+    int rc = select(fd + 1, &readSet, nullptr, nullptr, &tv);
+    if (rc == 0) {
+        Serial.printf("HTTP read timeout - no data for %lu ms\n", (unsigned long)_stallTimeoutMs);
+        return HTTP_FETCH_ERROR_TIMEOUT;
+    }
+    if (rc < 0)
+        return HTTP_FETCH_ERROR_CLOSED;
+
+    n = _client.read(_buf, sizeof(_buf));
+    if (n <= 0)
+        return 0; // Readable but empty: the peer closed the connection
+    _bufLen = n;
+    return n;
+}
+
+// Reads one CRLF terminated line without the terminator.
+// Returns its length, or a negative error.
+int HttpFetch::readLine(char* line, size_t len)
+{
+    size_t used = 0;
+    for (;;) {
+        int rc = fill();
+        if (rc < 0)
+            return rc;
+        if (rc == 0)
+            return HTTP_FETCH_ERROR_CLOSED;
+        while (_bufPos < _bufLen) {
+            char c = _buf[_bufPos++];
+            if (c == '\n') {
+                if (used > 0 && line[used - 1] == '\r')
+                    used--;
+                line[used] = '\0';
+                return used;
+            }
+            if (used < len - 1)
+                line[used++] = c;
+        }
+    }
+}
+
+// Returns the next run of body bytes straight from the read buffer, decoding
+// chunked framing. Returns its length, 0 at the end of the body, or a
+// negative error.
+int HttpFetch::readBodySpan(const uint8_t*& data)
+{
+    if (_bodyMode == BODY_NONE)
+        return 0;
+
+    if (_bodyMode == BODY_CHUNKED && _remaining == 0) {
+        char line[64];
+        int rc;
+        // CRLF that ends the previous chunk's data
+        if (_chunkCrlfPending && (rc = readLine(line, sizeof(line))) != 0)
+            return rc < 0 ? rc : HTTP_FETCH_ERROR_PROTOCOL;
+        _chunkCrlfPending = false;
+        if ((rc = readLine(line, sizeof(line))) < 0)
+            return rc;
+        _remaining = strtoul(line, nullptr, 16);
+        if (_remaining == 0) {
+            // Last chunk: skip trailers up to the empty line
+            while ((rc = readLine(line, sizeof(line))) > 0) { }
+            _bodyMode = BODY_NONE;
+            return rc < 0 ? rc : 0;
+        }
+    }
+
+    int rc = fill();
+    if (rc < 0)
+        return rc;
+    if (rc == 0) {
+        if (_bodyMode == BODY_UNTIL_CLOSE) {
+            _bodyMode = BODY_NONE;
+            return 0;
+        }
+        return HTTP_FETCH_ERROR_CLOSED;
+    }
+
+    size_t n = _bufLen - _bufPos;
+    if (_bodyMode != BODY_UNTIL_CLOSE && n > _remaining)
+        n = _remaining;
+    data = _buf + _bufPos;
+    _bufPos += n;
+
+    if (_bodyMode != BODY_UNTIL_CLOSE) {
+        _remaining -= n;
+        if (_remaining == 0) {
+            if (_bodyMode == BODY_LENGTH)
+                _bodyMode = BODY_NONE;
+            else
+                _chunkCrlfPending = true;
+        }
+    }
+    return n;
+}
+
+bool HttpFetch::readBody(HttpBodySink sink, void* context)
+{
+    uint32_t tStart = millis();
+    _bodyError = 0;
+    for (;;) {
+        const uint8_t* data;
+        int n = readBodySpan(data);
+        if (n < 0) {
+            Serial.printf("HTTP body failed after %lu bytes: %s\n", (unsigned long)_bytesReceived, errorToString(n));
+            _bodyError = n;
+            break;
+        }
+        if (n == 0)
+            break;
+        _bytesReceived += n;
+        if (sink && !sink(data, n, context)) {
+            Serial.println("HTTP body rejected by sink");
+            _bodyError = HTTP_FETCH_ERROR_SINK;
+            break;
+        }
+    }
+    bool ok = _bodyError == 0;
+    _elapsedMs = millis() - tStart;
+    if (!ok)
+        stop();
+
+    Serial.printf("HTTP body: %lu bytes in %lu ms (%.1f KB/s)%s\n", (unsigned long)_bytesReceived,
+        (unsigned long)_elapsedMs, kbps(), _chunked ? ", chunked" : "");
+    return ok;
+}
+
+int HttpFetch::bodyRead(bool consume)
+{
+    if (_spanPos == _spanLen) {
+        _spanLen = _spanPos = 0;
+        int n = readBodySpan(_span);
+        if (n <= 0) {
+            if (n < 0 && !_bodyError) {
+                Serial.printf("HTTP body failed after %lu bytes: %s\n", (unsigned long)_bytesReceived, errorToString(n));
+                _bodyError = n;
+            }
+            return -1;
+        }
+        _spanLen = n;
+        _bytesReceived += n;
+    }
+    return consume ? _span[_spanPos++] : _span[_spanPos];
+}
+
+size_t HttpFetch::bodyRead(uint8_t* data, size_t len)
+{
+    size_t done = 0;
+    while (done < len && bodyRead(false) >= 0) {
+        size_t n = _spanLen - _spanPos;
+        if (n > len - done)
+            n = len - done;
+        memcpy(data + done, _span + _spanPos, n);
+        _spanPos += n;
+        done += n;
+    }
+    return done;
+}
+
+void HttpFetch::finish()
+{
+    // Draining a short leftover body (an error page, say) is cheaper than a
+    // new TCP handshake; anything longer is cut off by closing
+    if (_bodyMode == BODY_UNTIL_CLOSE || (_bodyMode == BODY_LENGTH && _remaining > 4096)) {
+        _keepAlive = false;
+    } else if (_bodyMode != BODY_NONE) {
+        const uint8_t* data;
+        uint32_t drained = 0;
+        int n;
+        while (drained <= 4096 && (n = readBodySpan(data)) > 0)
+            drained += n;
+        if (_bodyMode != BODY_NONE)
+            _keepAlive = false;
+    }
+    if (!_keepAlive)
+        stop();
+}
+
+void HttpFetch::stop()
+{
+    _client.stop();
+    _keepAlive = false;
+    _bodyMode = BODY_NONE;
+    _bufPos = _bufLen = 0;
+    _spanLen = _spanPos = 0;
+}
+
+#endif // HTTP_FETCH_H_
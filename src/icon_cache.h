@@ -0,0 +1,226 @@
+#ifndef ICON_CACHE_H_
+#define ICON_CACHE_H_
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+
+#include "bwr_canvas.h"
+#include "glyph_cache.h"
+#include "weather_draw_functions.h"
+#include "wx_icon.h"
+
+// Weather icon sprites.
+//
+// The vector icons of weather_draw_functions.h take dozens of fillCircle()
+// and drawLine() calls each, with float scaling, and a banded canvas draws
+// every icon once per band. Here each (kind, night, size) is rasterized
+// once, on first use, into a 1-bit byte-aligned bitmap trimmed to its ink
+// (set = ink, MSB first, as glyph rows), and later draws blit that. On a
+// BwrCanvas the blit is glyphCacheBlit(); other targets get drawBitmap().
+//
+// Sprites are kept for the rest of the wake, in PSRAM when there is some.
+// Pixels the vector code paints in BG_COLOR (the inside of a cloud over a
+// sun) only clear bits of the sprite: a sprite is transparent, it does not
+// erase what is under it. WX_ICON_UNKNOWN is drawn as text in the current
+// font and is not cached.
+
+#define ICON_CACHE_REACH 6 // Sprite frame half-size in icon scales; the largest icon reaches 5.4
+#define ICON_CACHE_MAX_BYTES 32768 // All sprites together; past it icons are drawn as vectors
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t bytes; // Held by sprites
+    uint32_t uncached; // Draws that went to the vector code
+} IconCacheStats;
+
+// Function declarations
+const GlyphCacheEntry* iconCacheGet(uint8_t icon, bool iconSize);
+void iconCacheDraw(BwrCanvas& canvas, int16_t x, int16_t y, uint8_t icon, bool iconSize);
+void iconCacheDraw(Adafruit_GFX& gfx, int16_t x, int16_t y, uint8_t icon, bool iconSize);
+void iconCacheClear();
+const IconCacheStats& iconCacheStats();
+
+// Implementation
+
+namespace {
+
+#define ICON_CACHE_FRAME (2 * ICON_CACHE_REACH * Large)
+#define ICON_CACHE_FRAME_BYTES ((ICON_CACHE_FRAME + 7) / 8)
+
+// Rasterization target: a frame centered on the icon, set bit = ink
+class IconCacheRaster : public Adafruit_GFX {
+public:
+    IconCacheRaster(uint8_t* rows, int16_t size)
+        : Adafruit_GFX(size, size)
+        , _rows(rows)
+    {
+        memset(_rows, 0, (size_t)ICON_CACHE_FRAME_BYTES * size);
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT)
+            return;
+        uint8_t* byte = _rows + (size_t)y * ICON_CACHE_FRAME_BYTES + x / 8;
+        if (color == BG_COLOR)
+            *byte &= ~(0x80 >> (x & 7));
+        else
+            *byte |= 0x80 >> (x & 7);
+    }
+
+private:
+    uint8_t* _rows;
+};
+
+uint8_t iconCacheFrame[ICON_CACHE_FRAME * ICON_CACHE_FRAME_BYTES];
+GlyphCacheEntry iconCacheSprites[WX_ICON_KINDS][2][2]; // [kind][night][large]
+IconCacheStats iconCacheCounters;
+
+bool iconCacheColumnInk(int16_t x, int16_t top, int16_t bottom)
+{
+    for (int16_t y = top; y < bottom; y++)
+        if (iconCacheFrame[y * ICON_CACHE_FRAME_BYTES + x / 8] & (0x80 >> (x & 7)))
+            return true;
+    return false;
+}
+
+bool iconCacheRowInk(int16_t y)
+{
+    for (uint8_t b = 0; b < ICON_CACHE_FRAME_BYTES; b++)
+        if (iconCacheFrame[y * ICON_CACHE_FRAME_BYTES + b])
+            return true;
+    return false;
+}
+
+// Draws the icon into the frame and copies its ink box out to the heap
+bool iconCacheRasterize(GlyphCacheEntry& sprite, uint8_t icon, bool iconSize)
+{
+    int16_t size = 2 * ICON_CACHE_REACH * (iconSize ? Large : Small);
+    IconCacheRaster raster(iconCacheFrame, size);
+    draw_wx_icon(raster, size / 2, size / 2, icon, iconSize);
+
+    int16_t top = 0, bottom = size, left = 0, right = size;
+    while (top < bottom && !iconCacheRowInk(top))
+        top++;
+    while (bottom > top && !iconCacheRowInk(bottom - 1))
+        bottom--;
+    while (left < right && !iconCacheColumnInk(left, top, bottom))
+        left++;
+    while (right > left && !iconCacheColumnInk(right - 1, top, bottom))
+        right--;
+
+    uint8_t width = right - left;
+    uint8_t bytesPerRow = (width + 7) / 8;
+    size_t bytes = (size_t)bytesPerRow * (bottom - top);
+    if (iconCacheCounters.bytes + bytes > ICON_CACHE_MAX_BYTES)
+        return false;
+    uint8_t* rows = nullptr;
+    if (bytes > 0) {
+        rows = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+        if (!rows)
+            rows = (uint8_t*)heap_caps_malloc(bytes, MALLOC_CAP_8BIT);
+        if (!rows)
+            return false;
+    }
+
+    // Shift each row left so that the box starts at bit 7 of byte 0
+    uint8_t shift = left & 7;
+    for (int16_t y = top; y < bottom; y++) {
+        const uint8_t* src = iconCacheFrame + y * ICON_CACHE_FRAME_BYTES + left / 8;
+        uint8_t* dst = rows + (y - top) * bytesPerRow;
+        for (uint8_t b = 0; b < bytesPerRow; b++) {
+            uint8_t next = left / 8 + b + 1 < ICON_CACHE_FRAME_BYTES ? src[b + 1] : 0;
+            dst[b] = shift ? (uint8_t)(src[b] << shift | next >> (8 - shift)) : src[b];
+        }
+        if (width & 7)
+            dst[bytesPerRow - 1] &= 0xFF << (8 - (width & 7));
+    }
+
+    sprite.rows = rows;
+    sprite.code = icon;
+    sprite.width = width;
+    sprite.height = bottom - top;
+    sprite.bytesPerRow = bytesPerRow;
+    sprite.xOffset = left - size / 2;
+    sprite.yOffset = top - size / 2;
+    iconCacheCounters.bytes += bytes;
+    return true;
+}
+
+} // namespace
+
+// Sprite of a parsed icon (wx_icon.h), rasterized on the first call;
+// nullptr for WX_ICON_UNKNOWN or when the cache is full. The sprite is
+// drawn at (x + xOffset, y + yOffset) for an icon centered at (x, y).
+const GlyphCacheEntry* iconCacheGet(uint8_t icon, bool iconSize)
+{
+    WxIcon kind = wxIconKind(icon);
+    if (kind == WX_ICON_UNKNOWN)
+        return nullptr;
+    GlyphCacheEntry& sprite = iconCacheSprites[kind][wxIconNight(icon)][iconSize];
+    // Empty icons have no rows either, lastUse tells them from unmade ones
+    if (sprite.lastUse) {
+        iconCacheCounters.hits++;
+        return &sprite;
+    }
+    iconCacheCounters.misses++;
+    if (!iconCacheRasterize(sprite, icon, iconSize))
+        return nullptr;
+    sprite.lastUse = 1;
+    return &sprite;
+}
+
+// draw_wx_icon() through the cache, blitting bytes into the canvas' planes
+void iconCacheDraw(BwrCanvas& canvas, int16_t x, int16_t y, uint8_t icon, bool iconSize)
+{
+    if (canvas.getRotation() != 0) {
+        iconCacheDraw((Adafruit_GFX&)canvas, x, y, icon, iconSize);
+        return;
+    }
+    const GlyphCacheEntry* sprite = iconCacheGet(icon, iconSize);
+    if (!sprite) {
+        iconCacheCounters.uncached++;
+        draw_wx_icon(canvas, x, y, icon, iconSize);
+        return;
+    }
+    glyphCacheBlit(sprite, x + sprite->xOffset, y + sprite->yOffset, BwrCanvas::ink(FG_COLOR), canvas.blackPlane(),
+        canvas.redPlane(), canvas.stride(), canvas.width(), canvas.bandY(), canvas.rows());
+    canvas.markDrawn(x + sprite->xOffset, y + sprite->yOffset, sprite->width, sprite->height);
+}
+
+// draw_wx_icon() through the cache for any GFX target
+void iconCacheDraw(Adafruit_GFX& gfx, int16_t x, int16_t y, uint8_t icon, bool iconSize)
+{
+    const GlyphCacheEntry* sprite = iconCacheGet(icon, iconSize);
+    if (!sprite) {
+        iconCacheCounters.uncached++;
+        draw_wx_icon(gfx, x, y, icon, iconSize);
+        return;
+    }
+    if (sprite->rows)
+        gfx.drawBitmap(x + sprite->xOffset, y + sprite->yOffset, sprite->rows, sprite->width, sprite->height, FG_COLOR);
+}
+
+// Frees every sprite
+void iconCacheClear()
+{
+    for (uint8_t kind = 0; kind < WX_ICON_KINDS; kind++) {
+        for (uint8_t night = 0; night < 2; night++) {
+            for (uint8_t large = 0; large < 2; large++) {
+                GlyphCacheEntry& sprite = iconCacheSprites[kind][night][large];
+                if (sprite.rows)
+                    heap_caps_free((void*)sprite.rows);
+                memset(&sprite, 0, sizeof(sprite));
+            }
+        }
+    }
+    iconCacheCounters.bytes = 0;
+}
+
+const IconCacheStats& iconCacheStats()
+{
+    return iconCacheCounters;
+}
+
+#endif // ICON_CACHE_H_
@@ -0,0 +1,299 @@
+#ifndef INFLATE_STREAM_H_
+#define INFLATE_STREAM_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h> // The copy bundled with PNGdec on the device
+
+// Streaming decoder for HTTP Content-Encoding gzip / deflate.
+//
+// Compressed bytes are pushed in whatever pieces the network delivers them
+// (write()), and the inflated output is handed to the sink in small blocks,
+// so the body is never held in memory as a whole. The gzip header and
+// trailer are parsed here and the payload goes through raw inflate, which
+// keeps this independent of whether the zlib build has gzip support.
+//
+// Kept free of Arduino dependencies so tools/inflate_bench.cpp can build it
+// on the host against the system zlib.
+
+#define INFLATE_STREAM_OUT_SIZE 4096
+
+// Output consumer; same shape as HttpBodySink. Return false to abort.
+typedef bool (*InflateSink)(const uint8_t* data, size_t len, void* context);
+
+class InflateStream {
+public:
+    enum Encoding { ENCODING_GZIP, ENCODING_DEFLATE };
+    enum Result { OK = 0, ERROR_MEMORY, ERROR_HEADER, ERROR_DATA, ERROR_SINK, ERROR_TRAILER, ERROR_TRUNCATED };
+
+    InflateStream()
+        : _out(nullptr)
+        , _active(false)
+        , _state(DONE)
+        , _result(OK)
+    {
+    }
+    ~InflateStream() { end(); }
+
+    Result begin(Encoding encoding, InflateSink sink, void* context);
+    Result write(const uint8_t* data, size_t len);
+    // Releases the decoder; returns OK only if the stream ended cleanly
+    Result end();
+
+    uint32_t bytesIn() const { return _bytesIn; }
+    uint32_t bytesOut() const { return _bytesOut; }
+    uint32_t inflateMicros() const { return _inflateMicros; }
+    static const char* resultToString(Result result);
+
+    // HttpBodySink adapter: context is the InflateStream
+    static bool sinkAdapter(const uint8_t* data, size_t len, void* context)
+    {
+        return ((InflateStream*)context)->write(data, len) == OK;
+    }
+
+private:
+    enum State { GZ_HEADER, GZ_EXTRA_LEN, GZ_EXTRA, GZ_NAME, GZ_COMMENT, GZ_HCRC, BODY, GZ_TRAILER, DONE, FAILED };
+
+    Result feedBody(const uint8_t* data, size_t len, size_t& used);
+    Result fail(Result result)
+    {
+        _state = FAILED;
+        _result = result;
+        return result;
+    }
+
+    static voidpf zalloc(voidpf, uInt items, uInt size) { return calloc(items, size); }
+    static void zfree(voidpf, voidpf address) { free(address); }
+    static uint32_t nowMicros();
+
+    z_stream _zs;
+    uint8_t* _out;
+    bool _active;
+    Encoding _encoding;
+    State _state;
+    Result _result;
+    InflateSink _sink;
+    void* _context;
+
+    uint8_t _hdr[10];
+    uint8_t _hdrFlags;
+    size_t _hdrUsed;
+    uint32_t _extraLeft;
+
+    uint32_t _crc;
+    uint32_t _bytesIn;
+    uint32_t _bytesOut;
+    uint32_t _inflateMicros;
+};
+
+// Implementation
+
+#ifdef ARDUINO
+uint32_t InflateStream::nowMicros() { return micros(); }
+#else
+#include <chrono>
+uint32_t InflateStream::nowMicros()
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+#endif
+
+const char* InflateStream::resultToString(Result result)
+{
+    switch (result) {
+    case OK:
+        return "ok";
+    case ERROR_MEMORY:
+        return "out of memory";
+    case ERROR_HEADER:
+        return "bad gzip header";
+    case ERROR_DATA:
+        return "corrupt deflate data";
+    case ERROR_SINK:
+        return "sink rejected data";
+    case ERROR_TRAILER:
+        return "gzip crc/size mismatch";
+    case ERROR_TRUNCATED:
+        return "stream truncated";
+    }
+    return "unknown";
+}
+
+InflateStream::Result InflateStream::begin(Encoding encoding, InflateSink sink, void* context)
+{
+    end();
+    _encoding = encoding;
+    _sink = sink;
+    _context = context;
+    _state = encoding == ENCODING_GZIP ? GZ_HEADER : BODY;
+    _result = OK;
+    _hdrUsed = 0;
+    _crc = crc32(0L, Z_NULL, 0);
+    _bytesIn = _bytesOut = _inflateMicros = 0;
+
+    _out = (uint8_t*)malloc(INFLATE_STREAM_OUT_SIZE);
+    if (!_out)
+        return fail(ERROR_MEMORY);
+
+    memset(&_zs, 0, sizeof(_zs));
+    _zs.zalloc = zalloc;
+    _zs.zfree = zfree;
+    // gzip carries raw deflate; Content-Encoding: deflate is zlib-wrapped
+    int windowBits = encoding == ENCODING_GZIP ? -MAX_WBITS : MAX_WBITS;
+    if (inflateInit2(&_zs, windowBits) != Z_OK) {
+        free(_out);
+        _out = nullptr;
+        return fail(ERROR_MEMORY);
+    }
+    _active = true;
+    return OK;
+}
+
+InflateStream::Result InflateStream::write(const uint8_t* data, size_t len)
+{
+    if (_state == FAILED)
+        return _result;
+    _bytesIn += len;
+
+    while (len > 0) {
+        uint8_t c = *data;
+        switch (_state) {
+        case GZ_HEADER:
+            _hdr[_hdrUsed++] = c;
+            data++, len--;
+            if (_hdrUsed == sizeof(_hdr)) {
+                if (_hdr[0] != 0x1F || _hdr[1] != 0x8B || _hdr[2] != 8)
+                    return fail(ERROR_HEADER);
+                _hdrFlags = _hdr[3];
+                _hdrUsed = 0;
+                _state = GZ_EXTRA_LEN;
+            }
+            continue;
+        case GZ_EXTRA_LEN:
+            if (!(_hdrFlags & 0x04)) {
+                _state = GZ_NAME;
+                continue;
+            }
+            _hdr[_hdrUsed++] = c;
+            data++, len--;
+            if (_hdrUsed == 2) {
+                _extraLeft = _hdr[0] | (_hdr[1] << 8);
+                _hdrUsed = 0;
+                _state = GZ_EXTRA;
+            }
+            continue;
+        case GZ_EXTRA:
+            if (_extraLeft == 0) {
+                _state = GZ_NAME;
+                continue;
+            }
+            _extraLeft--;
+            data++, len--;
+            continue;
+        case GZ_NAME:
+        case GZ_COMMENT: {
+            uint8_t flag = _state == GZ_NAME ? 0x08 : 0x10;
+            State next = _state == GZ_NAME ? GZ_COMMENT : GZ_HCRC;
+            if (!(_hdrFlags & flag)) {
+                _state = next;
+                continue;
+            }
+            data++, len--;
+            if (c == 0)
+                _state = next;
+            continue;
+        }
+        case GZ_HCRC:
+            if (!(_hdrFlags & 0x02)) {
+                _state = BODY;
+                continue;
+            }
+            data++, len--;
+            if (++_hdrUsed == 2) {
+                _hdrUsed = 0;
+                _state = BODY;
+            }
+            continue;
+        case BODY: {
+            size_t used;
+            Result result = feedBody(data, len, used);
+            if (result != OK)
+                return fail(result);
+            data += used;
+            len -= used;
+            continue;
+        }
+        case GZ_TRAILER:
+            _hdr[_hdrUsed++] = c;
+            data++, len--;
+            if (_hdrUsed == 8) {
+                uint32_t crc = _hdr[0] | (_hdr[1] << 8) | (_hdr[2] << 16) | ((uint32_t)_hdr[3] << 24);
+                uint32_t size = _hdr[4] | (_hdr[5] << 8) | (_hdr[6] << 16) | ((uint32_t)_hdr[7] << 24);
+                if (crc != _crc || size != _bytesOut)
+                    return fail(ERROR_TRAILER);
+                _state = DONE;
+            }
+            continue;
+        case DONE:
+            // Anything after the end of the stream is ignored
+            return OK;
+        case FAILED:
+            return _result;
+        }
+    }
+    return OK;
+}
+
+InflateStream::Result InflateStream::feedBody(const uint8_t* data, size_t len, size_t& used)
+{
+    uint32_t tStart = nowMicros();
+    _zs.next_in = (Bytef*)data;
+    _zs.avail_in = len;
+    int rc = Z_OK;
+    // Drain all output this input can produce, one output block at a time
+    do {
+        _zs.next_out = _out;
+        _zs.avail_out = INFLATE_STREAM_OUT_SIZE;
+        rc = inflate(&_zs, Z_NO_FLUSH);
+        if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) {
+            _inflateMicros += nowMicros() - tStart;
+            return ERROR_DATA;
+        }
+        size_t produced = INFLATE_STREAM_OUT_SIZE - _zs.avail_out;
+        if (produced > 0) {
+            if (_encoding == ENCODING_GZIP)
+                _crc = crc32(_crc, _out, produced);
+            _bytesOut += produced;
+            _inflateMicros += nowMicros() - tStart;
+            if (!_sink(_out, produced, _context))
+                return ERROR_SINK;
+            tStart = nowMicros();
+        }
+    } while (rc != Z_STREAM_END && (_zs.avail_in > 0 || _zs.avail_out == 0));
+    _inflateMicros += nowMicros() - tStart;
+
+    used = len - _zs.avail_in;
+    if (rc == Z_STREAM_END) {
+        _hdrUsed = 0;
+        _state = _encoding == ENCODING_GZIP ? GZ_TRAILER : DONE;
+    }
+    return OK;
+}
+
+InflateStream::Result InflateStream::end()
+{
+    if (!_active)
+        return _result;
+    inflateEnd(&_zs);
+    free(_out);
+    _out = nullptr;
+    _active = false;
+    if (_state != DONE && _state != FAILED)
+        fail(ERROR_TRUNCATED);
+    return _result;
+}
+
+#endif // INFLATE_STREAM_H_
@@ -0,0 +1,147 @@
+#ifndef OVERLAY_H_
+#define OVERLAY_H_
+
+#include <Arduino.h>
+#include <math.h>
+#include <time.h>
+
+#include "bwr_canvas.h"
+#include "glyph_cache.h"
+#include "rle_font.h"
+#include "fonts/rle/TimesNRCyr12.h"
+
+// Local widgets composited over the server frame.
+//
+// In overlay mode the device decodes the stored frame into a full-frame
+// BwrCanvas instead of streaming it to the panel, then draws these on top
+// before the canvas goes out in one transfer. The frame can then stay the
+// same for many wakes while the clock, battery and sensor values are
+// fresh on each of them.
+//
+// The widgets sit in a white box in the top-right corner: clock, board
+// temperature and battery, each left out when its value is missing. A red
+// badge under the box says when the frame is old or this wake was offline.
+
+#define OVERLAY_MARGIN 8 // Box distance from the screen edges
+#define OVERLAY_PADDING 8 // Inside the box and between widgets
+#define OVERLAY_HEIGHT 30
+#define OVERLAY_BASELINE 21 // Text baseline from the box top
+#define OVERLAY_BATTERY_WIDTH 22 // Battery outline with its tip
+#define OVERLAY_STALE_SEC (12 * 3600UL) // Frame age that gets a badge
+
+typedef struct {
+    const struct tm* now; // nullptr: no clock
+    float temperature; // °C, NAN when there is no reading
+    int8_t batteryPercent; // -1 when not measured
+    uint32_t frameAgeSec; // Since the frame was fetched
+    bool frameAgeValid; // False after power-on, before the first fetch
+    bool offline; // This wake's fetch failed
+} OverlayData;
+
+// Function declarations
+void overlayDraw(BwrCanvas& gfx, const OverlayData& data);
+
+// Implementation
+
+namespace {
+
+// Ink width of text in the font; *left is where the ink starts from the cursor
+int16_t overlayTextWidth(const RleFont* font, const char* text, int16_t* left = nullptr)
+{
+    int16_t x1, y1;
+    uint16_t w, h;
+    glyphCacheTextBounds(font, text, 0, 0, &x1, &y1, &w, &h);
+    if (left)
+        *left = x1;
+    return w;
+}
+
+// Text with its ink starting at x; returns the x after it
+int16_t overlayText(BwrCanvas& gfx, const char* text, int16_t x, int16_t baseline)
+{
+    int16_t left;
+    int16_t width = overlayTextWidth(gfx.rleFont(), text, &left);
+    gfx.setCursor(x - left, baseline);
+    gfx.print(text);
+    return x + width;
+}
+
+// draw_battery()'s outline and level bar, plus a tip
+void overlayBattery(BwrCanvas& gfx, int16_t x, int16_t y, int8_t percent)
+{
+    gfx.drawRect(x, y, OVERLAY_BATTERY_WIDTH - 3, 10, GxEPD_BLACK);
+    gfx.fillRect(x + OVERLAY_BATTERY_WIDTH - 3, y + 3, 2, 4, GxEPD_BLACK);
+    int16_t level = (OVERLAY_BATTERY_WIDTH - 7) * percent / 100;
+    if (level > 0)
+        gfx.fillRect(x + 2, y + 2, level, 6, percent <= 15 ? GxEPD_RED : GxEPD_BLACK);
+}
+
+void overlayBadge(BwrCanvas& gfx, const OverlayData& data, int16_t top)
+{
+    char text[32];
+    uint32_t hours = data.frameAgeSec / 3600;
+    bool stale = data.frameAgeValid && data.frameAgeSec >= OVERLAY_STALE_SEC;
+    if (data.offline && stale)
+        snprintf(text, sizeof(text), "Offline, %lu h old", (unsigned long)hours);
+    else if (data.offline)
+        snprintf(text, sizeof(text), "Offline");
+    else if (stale)
+        snprintf(text, sizeof(text), "%lu h old", (unsigned long)hours);
+    else
+        return;
+    int16_t width = overlayTextWidth(gfx.rleFont(), text) + 2 * OVERLAY_PADDING;
+    int16_t left = gfx.width() - OVERLAY_MARGIN - width;
+    gfx.fillRect(left, top, width, OVERLAY_HEIGHT, GxEPD_RED);
+    gfx.setTextColor(GxEPD_WHITE);
+    overlayText(gfx, text, left + OVERLAY_PADDING, top + OVERLAY_BASELINE);
+}
+
+} // namespace
+
+// Draws the widgets into the canvas' current band, over whatever is there
+void overlayDraw(BwrCanvas& gfx, const OverlayData& data)
+{
+    const RleFont* font = &TimesNRCyr12pt8bRle;
+    char clock[8] = "", temperature[8] = "", battery[8] = "";
+    if (data.now)
+        strftime(clock, sizeof(clock), "%H:%M", data.now);
+    if (!isnan(data.temperature))
+        snprintf(temperature, sizeof(temperature), "%ld", lroundf(data.temperature));
+    if (data.batteryPercent >= 0)
+        snprintf(battery, sizeof(battery), "%d%%", data.batteryPercent);
+
+    gfx.setFont(font);
+    gfx.setTextWrap(false);
+    int16_t width = 0;
+    if (clock[0])
+        width += overlayTextWidth(font, clock) + OVERLAY_PADDING;
+    if (temperature[0])
+        width += overlayTextWidth(font, temperature) + 7 + OVERLAY_PADDING; // Degree circle
+    if (battery[0])
+        width += OVERLAY_BATTERY_WIDTH + 3 + overlayTextWidth(font, battery) + OVERLAY_PADDING;
+
+    int16_t top = OVERLAY_MARGIN;
+    if (width > 0) {
+        int16_t left = gfx.width() - OVERLAY_MARGIN - OVERLAY_PADDING - width;
+        int16_t baseline = top + OVERLAY_BASELINE;
+        gfx.fillRect(left, top, width + OVERLAY_PADDING, OVERLAY_HEIGHT, GxEPD_WHITE);
+        gfx.drawRect(left, top, width + OVERLAY_PADDING, OVERLAY_HEIGHT, GxEPD_BLACK);
+        gfx.setTextColor(GxEPD_BLACK);
+        int16_t x = left + OVERLAY_PADDING;
+        if (clock[0])
+            x = overlayText(gfx, clock, x, baseline) + OVERLAY_PADDING;
+        if (temperature[0]) {
+            x = overlayText(gfx, temperature, x, baseline);
+            gfx.drawCircle(x + 4, baseline - 13, 2, GxEPD_BLACK);
+            x += 7 + OVERLAY_PADDING;
+        }
+        if (battery[0]) {
+            overlayBattery(gfx, x, baseline - 11, data.batteryPercent);
+            overlayText(gfx, battery, x + OVERLAY_BATTERY_WIDTH + 3, baseline);
+        }
+        top += OVERLAY_HEIGHT + 4;
+    }
+    overlayBadge(gfx, data, top);
+}
+
+#endif // OVERLAY_H_
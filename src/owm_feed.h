@@ -0,0 +1,134 @@
+#ifndef OWM_FEED_H_
+#define OWM_FEED_H_
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <time.h>
+
+#include "dashboard_data.h"
+
+// OpenWeatherMap feed for the dashboard without the server: the device asks
+// /data/2.5/weather and /data/2.5/forecast itself.
+//
+// The 5-day forecast is forty 3-hour readings of some twenty fields each.
+// Instead of a String holding all of it and a JsonDocument holding all of
+// it again, owmParseForecast() skips to the "list" array and deserializes
+// one reading at a time straight from the stream, through a filter that
+// keeps dt, main.temp and weather[0].icon. It stops when the last forecast
+// day is complete or after maxReadings readings and leaves the rest of the
+// response unread.
+//
+// Forecast days are the calendar days after today in the device's time
+// zone; for each, the reading closest to noon is kept, as the server does.
+
+#define OWM_MAX_READINGS 40 // 5 days x 8 readings, all the API returns
+
+// Function declarations
+bool owmParseWeather(Stream& in, DashboardData& data);
+bool owmParseForecast(Stream& in, DashboardData& data, time_t now, uint8_t maxReadings = OWM_MAX_READINGS);
+
+// Implementation
+
+namespace {
+
+// Reads up to and including marker; false if the stream ends first
+bool owmSkipTo(Stream& in, const char* marker)
+{
+    size_t matched = 0;
+    int c;
+    while (marker[matched] && (c = in.read()) >= 0) {
+        if (c == marker[matched])
+            matched++;
+        else
+            matched = c == marker[0] ? 1 : 0;
+    }
+    return !marker[matched];
+}
+
+// First character after whitespace, -1 at the end of the stream
+int owmNextToken(Stream& in)
+{
+    int c;
+    do {
+        c = in.read();
+    } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+    return c;
+}
+
+} // namespace
+
+// Current conditions: city, temperature, description and icon
+bool owmParseWeather(Stream& in, DashboardData& data)
+{
+    JsonDocument filter;
+    filter["name"] = true;
+    filter["main"]["temp"] = true;
+    filter["weather"][0]["description"] = true;
+    filter["weather"][0]["icon"] = true;
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, in, DeserializationOption::Filter(filter));
+    if (error) {
+        Serial.printf("OpenWeatherMap weather: %s\n", error.c_str());
+        return false;
+    }
+    data.temp = lroundf(doc["main"]["temp"] | 0.0f);
+    dashboardCopy(data.city, sizeof(data.city), doc["name"] | "");
+    dashboardCopy(data.description, sizeof(data.description), doc["weather"][0]["description"] | "");
+    data.icon = wxIconParse(doc["weather"][0]["icon"] | "");
+    return true;
+}
+
+// Fills data.forecast from the 3-hour readings of a /forecast response;
+// now is the device time that decides which day is today
+bool owmParseForecast(Stream& in, DashboardData& data, time_t now, uint8_t maxReadings)
+{
+    data.forecastCount = 0;
+    if (!owmSkipTo(in, "\"list\":[")) {
+        Serial.println("OpenWeatherMap forecast: no list");
+        return false;
+    }
+
+    JsonDocument filter;
+    filter["dt"] = true;
+    filter["main"]["temp"] = true;
+    filter["weather"][0]["icon"] = true;
+
+    struct tm local;
+    localtime_r(&now, &local);
+    int today = local.tm_yday;
+    int day = today;
+    int bestDistance = 0;
+    JsonDocument reading;
+    for (uint8_t readings = 0; readings < maxReadings; readings++) {
+        DeserializationError error = deserializeJson(reading, in, DeserializationOption::Filter(filter));
+        if (error) {
+            Serial.printf("OpenWeatherMap forecast: %s after %u readings\n", error.c_str(), readings);
+            return false;
+        }
+        time_t timestamp = reading["dt"] | 0L;
+        localtime_r(&timestamp, &local);
+        if (local.tm_yday != today) {
+            if (local.tm_yday != day) {
+                if (data.forecastCount == DASHBOARD_FORECAST_DAYS)
+                    break; // Every day complete, the rest is not needed
+                day = local.tm_yday;
+                bestDistance = 24;
+                data.forecastCount++;
+            }
+            int distance = abs(local.tm_hour - 12);
+            if (distance < bestDistance) {
+                DashboardForecast& forecast = data.forecast[data.forecastCount - 1];
+                bestDistance = distance;
+                forecast.day = local.tm_mday;
+                forecast.temp = lroundf(reading["main"]["temp"] | 0.0f);
+                forecast.icon = wxIconParse(reading["weather"][0]["icon"] | "");
+            }
+        }
+        if (owmNextToken(in) != ',')
+            break; // End of the list
+    }
+    return data.forecastCount > 0;
+}
+
+#endif // OWM_FEED_H_
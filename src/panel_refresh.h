@@ -0,0 +1,265 @@
+#ifndef PANEL_REFRESH_H_
+#define PANEL_REFRESH_H_
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+
+#include "bwr_canvas.h"
+#include "damage.h"
+#include "frame_diff.h"
+
+// Region updates: refresh only what changed since the last frame.
+//
+// The frame on the glass is kept on SPIFFS in the BWR layout (black plane,
+// then red plane) and outlives deep sleep; RTC memory only says whether it
+// still matches the glass. A new full-frame canvas is compared against it
+// by frame_diff.h, the changed rows are grouped into at most
+// PANEL_REFRESH_MAX_RECTS byte-aligned rectangles, and the plan is what
+// the frame allows:
+//
+//   none      nothing changed, the panel is left alone
+//   partial   black and white only, inside the rectangles
+//   full      no known previous frame, or red in or around a change
+//
+// refresh_policy.h may then turn it into a full refresh or a clean cycle
+// (black, white, then the frame) for the panel's sake.
+//
+// Given the new frame's DamageSet (damage.h) and with the stored frame's
+// kept in RTC memory, only rows and bytes inside their union are compared:
+// everywhere else both frames are white. Two blank damage sets need no
+// comparison at all.
+//
+// Red needs the 3-color waveform, so any rectangle with red before or
+// after goes to a full refresh. A controller with a fast partial mode gets
+// one refresh per rectangle; the GDEW075Z08 has none, its windowed refresh
+// runs the whole waveform, so it gets one refresh over their bounding box
+// and only that window flashes.
+//
+// The panel must be init()ed with initial = false for a partial refresh to
+// happen; GxEPD2 turns the first one after an initial init() into a full
+// refresh.
+
+#define PANEL_REFRESH_FILENAME "/shown.bwr"
+#define PANEL_REFRESH_MAX_RECTS 4
+#define PANEL_REFRESH_MERGE_ROWS 16 // Unchanged rows that may sit inside one rectangle
+
+typedef enum {
+    PANEL_REFRESH_NONE,
+    PANEL_REFRESH_PARTIAL,
+    PANEL_REFRESH_FULL,
+    PANEL_REFRESH_CLEAN // Full refreshes to black and white before the frame's
+} PanelRefreshMode;
+
+typedef struct {
+    int16_t x; // Multiple of 8
+    int16_t y;
+    int16_t w; // Multiple of 8
+    int16_t h;
+} PanelRect;
+
+typedef struct {
+    PanelRefreshMode mode;
+    uint8_t count;
+    PanelRect rects[PANEL_REFRESH_MAX_RECTS];
+    const char* reason; // Why the refresh is full or a clean
+    bool compared; // False when there was no previous frame to compare with
+    uint32_t changedPixels;
+    uint16_t changedPerMille;
+} PanelRefreshPlan;
+
+// Kept in RTC memory; all zero after power-on
+typedef struct {
+    bool shownValid; // PANEL_REFRESH_FILENAME is what the glass shows
+    bool shownDamageValid; // shownDamage covers all ink of the stored frame
+    DamageSet shownDamage;
+} PanelRefreshState;
+
+// Function declarations
+void panelRefreshPlan(const BwrCanvas& frame, const DamageSet* damage, const PanelRefreshState& state, PanelRefreshPlan& plan);
+template <typename EPD>
+void panelRefreshApply(EPD& epd, const BwrCanvas& frame, const PanelRefreshPlan& plan);
+bool panelRefreshSave(const BwrCanvas& frame, const DamageSet* damage, const PanelRefreshPlan& plan, PanelRefreshState& state);
+void panelRefreshForget(PanelRefreshState& state);
+
+// Implementation
+
+namespace {
+
+FrameDiff panelRefreshDiff;
+
+// Groups the changed rows into rectangles, rows at most gap apart in one;
+// returns how many there are, counting on past PANEL_REFRESH_MAX_RECTS
+uint8_t panelRefreshGroup(uint16_t rows, uint16_t gap, PanelRefreshPlan& plan)
+{
+    uint8_t count = 0;
+    int16_t lastRow = 0;
+    uint8_t first = 0, last = 0;
+    for (uint16_t row = 0; row < rows; row++) {
+        if (panelRefreshDiff.first[row] == FRAME_DIFF_NONE)
+            continue;
+        if (count && row - lastRow <= gap) {
+            first = min(first, panelRefreshDiff.first[row]);
+            last = max(last, panelRefreshDiff.last[row]);
+        } else {
+            count++;
+            first = panelRefreshDiff.first[row];
+            last = panelRefreshDiff.last[row];
+            if (count <= PANEL_REFRESH_MAX_RECTS)
+                plan.rects[count - 1].y = row;
+        }
+        lastRow = row;
+        if (count <= PANEL_REFRESH_MAX_RECTS) {
+            PanelRect& rect = plan.rects[count - 1];
+            rect.x = first * 8;
+            rect.w = (last - first + 1) * 8;
+            rect.h = row - rect.y + 1;
+        }
+    }
+    return count;
+}
+
+// Whether the rectangle had red before or has red now
+bool panelRefreshHasRed(const BwrCanvas& frame, const PanelRect& rect)
+{
+    uint8_t first = rect.x / 8, last = (rect.x + rect.w) / 8 - 1;
+    for (int16_t row = rect.y; row < rect.y + rect.h; row++) {
+        if (panelRefreshDiff.redFirst[row] != FRAME_DIFF_NONE && panelRefreshDiff.redFirst[row] <= last
+            && panelRefreshDiff.redLast[row] >= first)
+            return true;
+        const uint8_t* red = frame.redPlane() + (size_t)row * frame.stride();
+        for (uint8_t b = first; b <= last; b++)
+            if (red[b] != 0xFF)
+                return true;
+    }
+    return false;
+}
+
+} // namespace
+
+// Compares the full-frame canvas with the stored frame and plans the
+// refresh it allows; damage is the canvas' own, nullptr when it was not
+// tracked
+void panelRefreshPlan(const BwrCanvas& frame, const DamageSet* damage, const PanelRefreshState& state, PanelRefreshPlan& plan)
+{
+    plan.mode = PANEL_REFRESH_FULL;
+    plan.count = 0;
+    plan.reason = "no previous frame";
+    plan.compared = false;
+    plan.changedPixels = 0;
+    plan.changedPerMille = 0;
+    if (frame.bands() != 1 || !frameDiffBegin(panelRefreshDiff, frame.rows(), frame.stride())) {
+        plan.reason = "not a full frame";
+        return;
+    }
+    if (!state.shownValid)
+        return;
+
+    // Where either frame has ink
+    DamageSet area;
+    const DamageSet* compare = nullptr;
+    if (damage && state.shownDamageValid) {
+        area = *damage;
+        damageAddSet(area, state.shownDamage);
+        compare = &area;
+    }
+    if ((!compare || compare->count > 0) && !frameDiffFile(panelRefreshDiff, PANEL_REFRESH_FILENAME, frame, compare))
+        return;
+    plan.compared = true;
+    plan.changedPixels = panelRefreshDiff.changedPixels;
+    plan.changedPerMille = frameDiffPerMille(panelRefreshDiff);
+
+    // Wider gaps until the rectangles fit; one covers everything at gap = rows
+    uint16_t rows = frame.rows(), gap = PANEL_REFRESH_MERGE_ROWS;
+    while (panelRefreshGroup(rows, gap, plan) > PANEL_REFRESH_MAX_RECTS)
+        gap *= 2;
+    plan.count = panelRefreshGroup(rows, gap, plan);
+
+    plan.reason = nullptr;
+    if (plan.count == 0) {
+        plan.mode = PANEL_REFRESH_NONE;
+        return;
+    }
+    for (uint8_t i = 0; i < plan.count; i++) {
+        if (panelRefreshHasRed(frame, plan.rects[i])) {
+            plan.reason = "red in a changed area";
+            return;
+        }
+    }
+    plan.mode = PANEL_REFRESH_PARTIAL;
+}
+
+// Runs the planned refresh on controller RAM that already holds the
+// frame; a clean writes it there again after the black and white passes
+template <typename EPD>
+void panelRefreshApply(EPD& epd, const BwrCanvas& frame, const PanelRefreshPlan& plan)
+{
+    if (plan.mode == PANEL_REFRESH_CLEAN) {
+        epd.clearScreen(0x00, 0xFF);
+        epd.clearScreen(0xFF, 0xFF);
+        epd.writeImage(frame.blackPlane(), frame.redPlane(), 0, 0, frame.stride() * 8, frame.rows());
+    }
+    if (plan.mode == PANEL_REFRESH_FULL || plan.mode == PANEL_REFRESH_CLEAN) {
+        epd.refresh(false);
+        return;
+    }
+    if (plan.mode != PANEL_REFRESH_PARTIAL)
+        return;
+    if (epd.hasFastPartialUpdate) {
+        for (uint8_t i = 0; i < plan.count; i++)
+            epd.refresh(plan.rects[i].x, plan.rects[i].y, plan.rects[i].w, plan.rects[i].h);
+        return;
+    }
+    // Each windowed refresh takes as long as a full one: one window for all
+    int16_t left = plan.rects[0].x, top = plan.rects[0].y, right = left + plan.rects[0].w, bottom = top + plan.rects[0].h;
+    for (uint8_t i = 1; i < plan.count; i++) {
+        left = min(left, plan.rects[i].x);
+        top = min(top, plan.rects[i].y);
+        right = max(right, (int16_t)(plan.rects[i].x + plan.rects[i].w));
+        bottom = max(bottom, (int16_t)(plan.rects[i].y + plan.rects[i].h));
+    }
+    epd.refresh(left, top, right - left, bottom - top);
+}
+
+// After the refresh: stores the frame and its damage (nullptr: not
+// tracked) as the ones on the glass. False, with the frame forgotten, when
+// it cannot be written.
+bool panelRefreshSave(const BwrCanvas& frame, const DamageSet* damage, const PanelRefreshPlan& plan, PanelRefreshState& state)
+{
+    if (plan.mode == PANEL_REFRESH_NONE) {
+        // Same pixels; the new set covers them as well as the old one
+        if (damage) {
+            state.shownDamage = *damage;
+            state.shownDamageValid = true;
+        }
+        return true;
+    }
+    state.shownDamageValid = damage != nullptr;
+    if (damage)
+        state.shownDamage = *damage;
+    state.shownValid = false;
+    size_t planeSize = (size_t)frame.stride() * frame.rows();
+    File file = SPIFFS.open(PANEL_REFRESH_FILENAME, FILE_WRITE);
+    bool written = file && file.write(frame.blackPlane(), planeSize) == planeSize
+        && file.write(frame.redPlane(), planeSize) == planeSize;
+    if (file)
+        file.close();
+    if (!written) {
+        Serial.println("Panel refresh: could not store the frame, next refresh is full");
+        SPIFFS.remove(PANEL_REFRESH_FILENAME);
+        return false;
+    }
+    state.shownValid = true;
+    return true;
+}
+
+// After a full refresh of a frame that was not stored (streamed or drawn
+// in bands)
+void panelRefreshForget(PanelRefreshState& state)
+{
+    state.shownValid = false;
+    state.shownDamageValid = false;
+    if (SPIFFS.exists(PANEL_REFRESH_FILENAME))
+        SPIFFS.remove(PANEL_REFRESH_FILENAME);
+}
+
+#endif // PANEL_REFRESH_H_
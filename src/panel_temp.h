@@ -0,0 +1,215 @@
+#ifndef PANEL_TEMP_H_
+#define PANEL_TEMP_H_
+
+#include <Arduino.h>
+#include <math.h>
+
+// Panel temperature and the BUSY wait that depends on it.
+//
+// The reading comes from, in order:
+//
+//   server   X-Panel-Temperature (°C) on a download, kept in RTC memory for
+//            serverMaxAgeSec
+//   chip     the ESP32-S3 die sensor plus chipOffsetC, when chipSensor
+//   none     NAN
+//
+// The UC8179 picks its OTP waveform by temperature, normally from its own
+// sensor. A server reading is written to its temperature register before
+// the refresh (epdSpiSetTemperature()), e.g. for a panel by a cold window
+// with the controller warmed by the board. The die sensor reads the chip,
+// not the room, so it is not used there.
+//
+// Cold waveforms run longer: below 20 °C the refresh takes up to three
+// times the 25 °C figure, past GxEPD2's fixed BUSY timeout. panelBusyWait()
+// is installed as GxEPD2's busy callback and holds each wait until BUSY
+// releases or timeoutMs passes, so the timeout follows the temperature.
+// With lightSleep the CPU sleeps while it waits, woken by BUSY going
+// inactive or by a timer at the predicted end, instead of polling BUSY
+// every millisecond for the longest phase of the wake.
+
+#define PANEL_TEMP_MIN_C -40 // Outside the panel's range: not a reading
+#define PANEL_TEMP_MAX_C 85
+#define PANEL_BUSY_SLICE_MS 1000 // Timer for waits past the prediction
+
+typedef enum {
+    PANEL_TEMP_NONE,
+    PANEL_TEMP_SERVER,
+    PANEL_TEMP_CHIP
+} PanelTempSource;
+
+typedef struct {
+    float celsius; // NAN with PANEL_TEMP_NONE
+    PanelTempSource source;
+} PanelTemp;
+
+typedef struct {
+    bool chipSensor; // Fall back to the die sensor
+    float chipOffsetC; // Added to the die temperature
+    uint32_t serverMaxAgeSec; // How long a server reading stands
+} PanelTempConfig;
+
+// Kept in RTC memory; all zero after power-on
+typedef struct {
+    bool serverValid;
+    float serverCelsius;
+    uint32_t serverAgeSec;
+} PanelTempState;
+
+// BUSY wait of one wake, handed to GxEPD2's setBusyCallback()
+typedef struct {
+    int8_t pin;
+    uint8_t level; // While busy
+    bool lightSleep;
+    uint32_t predictedMs; // Refresh time at the panel temperature
+    uint32_t timeoutMs; // Per busy phase
+    uint32_t waitedMs; // Totals of the wake
+    uint32_t sleptMs;
+    uint16_t timeouts;
+} PanelBusy;
+
+// Function declarations
+bool panelTempFromServer(PanelTempState& state, const String& header);
+PanelTemp panelTempRead(const PanelTempConfig& config, const PanelTempState& state);
+void panelTempAdvance(PanelTempState& state, uint32_t seconds);
+const char* panelTempSourceName(PanelTempSource source);
+uint32_t panelTempRefreshMs(uint32_t nominalMs, float celsius);
+void panelBusyBegin(PanelBusy& busy, int8_t pin, uint8_t level, bool lightSleep, uint32_t nominalMs, float celsius);
+void panelBusyWait(const void* parameter);
+
+// Implementation
+
+namespace {
+
+// Refresh time against the 25 °C one, from the colder end of each band
+// of the panel's waveform table (rounded up)
+typedef struct {
+    int8_t fromC;
+    uint16_t percent;
+} PanelTempScale;
+
+const PanelTempScale PANEL_TEMP_SCALE[] = { { 20, 100 }, { 10, 140 }, { 5, 180 }, { 0, 240 }, { PANEL_TEMP_MIN_C, 300 } };
+
+bool panelTempValid(float celsius)
+{
+    return !isnan(celsius) && celsius >= PANEL_TEMP_MIN_C && celsius <= PANEL_TEMP_MAX_C;
+}
+
+bool panelBusyAsserted(const PanelBusy& busy)
+{
+    return digitalRead(busy.pin) == busy.level;
+}
+
+// Light sleep until BUSY releases or ms pass
+void panelBusySleep(const PanelBusy& busy, uint32_t ms)
+{
+    Serial.flush();
+    gpio_wakeup_enable((gpio_num_t)busy.pin, busy.level == LOW ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+    esp_light_sleep_start();
+    esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+    gpio_wakeup_disable((gpio_num_t)busy.pin);
+}
+
+} // namespace
+
+// Takes the X-Panel-Temperature header of a download; false when it is
+// missing or out of range
+bool panelTempFromServer(PanelTempState& state, const String& header)
+{
+    if (header.length() == 0)
+        return false;
+    float celsius = header.toFloat();
+    if (!panelTempValid(celsius))
+        return false;
+    state.serverValid = true;
+    state.serverCelsius = celsius;
+    state.serverAgeSec = 0;
+    return true;
+}
+
+PanelTemp panelTempRead(const PanelTempConfig& config, const PanelTempState& state)
+{
+    PanelTemp temp = { NAN, PANEL_TEMP_NONE };
+    if (state.serverValid && state.serverAgeSec < config.serverMaxAgeSec) {
+        temp.celsius = state.serverCelsius;
+        temp.source = PANEL_TEMP_SERVER;
+    } else if (config.chipSensor) {
+        float celsius = temperatureRead() + config.chipOffsetC;
+        if (panelTempValid(celsius)) {
+            temp.celsius = celsius;
+            temp.source = PANEL_TEMP_CHIP;
+        }
+    }
+    return temp;
+}
+
+// Before deep sleep: the server reading ages by the sleep time
+void panelTempAdvance(PanelTempState& state, uint32_t seconds)
+{
+    state.serverAgeSec = state.serverAgeSec > UINT32_MAX - seconds ? UINT32_MAX : state.serverAgeSec + seconds;
+}
+
+const char* panelTempSourceName(PanelTempSource source)
+{
+    switch (source) {
+    case PANEL_TEMP_SERVER:
+        return "server";
+    case PANEL_TEMP_CHIP:
+        return "chip sensor";
+    default:
+        return "none";
+    }
+}
+
+// Refresh time at the temperature, from the one at 25 °C; unknown
+// temperatures count as cold
+uint32_t panelTempRefreshMs(uint32_t nominalMs, float celsius)
+{
+    uint8_t last = sizeof(PANEL_TEMP_SCALE) / sizeof(PANEL_TEMP_SCALE[0]) - 1;
+    uint8_t i = 0;
+    while (i < last && !(celsius >= PANEL_TEMP_SCALE[i].fromC))
+        i++;
+    return nominalMs * PANEL_TEMP_SCALE[i].percent / 100;
+}
+
+// Sets up the wait for a panel whose refresh takes nominalMs at 25 °C;
+// each phase may take twice the prediction
+void panelBusyBegin(PanelBusy& busy, int8_t pin, uint8_t level, bool lightSleep, uint32_t nominalMs, float celsius)
+{
+    busy.pin = pin;
+    busy.level = level;
+    busy.lightSleep = lightSleep;
+    busy.predictedMs = panelTempRefreshMs(nominalMs, celsius);
+    busy.timeoutMs = 2 * busy.predictedMs;
+    busy.waitedMs = 0;
+    busy.sleptMs = 0;
+    busy.timeouts = 0;
+}
+
+// GxEPD2 busy callback; parameter is the PanelBusy. Returns once BUSY has
+// released, or after timeoutMs and leaves the rest to GxEPD2.
+void panelBusyWait(const void* parameter)
+{
+    PanelBusy& busy = *(PanelBusy*)parameter;
+    uint32_t start = millis();
+    while (panelBusyAsserted(busy)) {
+        uint32_t elapsed = millis() - start;
+        if (elapsed >= busy.timeoutMs) {
+            busy.timeouts++;
+            break;
+        }
+        if (!busy.lightSleep) {
+            delay(1);
+            continue;
+        }
+        // First until the predicted end, then in slices; BUSY wakes it earlier
+        uint32_t ms = elapsed < busy.predictedMs ? busy.predictedMs - elapsed : PANEL_BUSY_SLICE_MS;
+        uint32_t sleepStart = millis();
+        panelBusySleep(busy, min(ms, busy.timeoutMs - elapsed));
+        busy.sleptMs += millis() - sleepStart;
+    }
+    busy.waitedMs += millis() - start;
+}
+
+#endif // PANEL_TEMP_H_
@@ -0,0 +1,129 @@
+#ifndef REFRESH_POLICY_H_
+#define REFRESH_POLICY_H_
+
+#include <Arduino.h>
+#include <math.h>
+
+#include "panel_refresh.h"
+
+// Refresh policy: how much ghosting a partial refresh may leave behind.
+//
+// panel_refresh.h plans the cheapest refresh the new frame allows. The
+// policy then weighs what the panel has been through since its last full
+// refresh and may raise the plan:
+//
+//   partial -> full   colder than partialMinTempC, a change bigger than
+//                     partialMaxPerMille, maxPartials partial refreshes in a
+//                     row, the ghosting budget used up, or no full refresh
+//                     for staticFullSec
+//   none -> full      the same frame has stood for staticFullSec (3-color
+//                     panels want a full refresh at least once a day)
+//   full -> clean     no clean cycle for cleanIntervalSec
+//
+// The ghosting budget is the changed share of the frame summed over the
+// partial refreshes since the last full one: many small changes are
+// cheap, a few big ones use it up. A clean cycle drives the whole panel
+// black, then white, then shows the frame, three full waveforms that clear
+// the retained charge a plain full refresh leaves.
+//
+// The state lives in RTC memory. Its ages advance by the sleep time at the
+// end of each wake; after power-on they start over from zero.
+
+typedef struct {
+    uint8_t maxPartials; // Partial refreshes in a row before a full one
+    uint16_t ghostBudgetPerMille; // Changed per mille summed over those partial refreshes
+    uint16_t partialMaxPerMille; // A bigger change gets a full refresh
+    uint32_t staticFullSec; // Longest time without a full refresh
+    uint32_t cleanIntervalSec; // Time between clean cycles, 0 for none
+    int8_t partialMinTempC; // Colder: full refreshes only
+} RefreshPolicy;
+
+// Kept in RTC memory; all zero after power-on
+typedef struct {
+    uint8_t partialCount; // Partial refreshes since the last full one
+    uint16_t ghostPerMille; // Changed per mille summed over them
+    uint32_t secSinceFull;
+    uint32_t secSinceClean;
+} RefreshPolicyState;
+
+// Function declarations
+void refreshPolicyApply(const RefreshPolicy& policy, const RefreshPolicyState& state, float temperature, PanelRefreshPlan& plan);
+void refreshPolicyRecord(RefreshPolicyState& state, PanelRefreshMode mode, uint16_t changedPerMille);
+void refreshPolicyAdvance(RefreshPolicyState& state, uint32_t seconds);
+
+// Implementation
+
+namespace {
+
+// Why a partial refresh has to be a full one, nullptr when it can stay
+const char* refreshPolicyPartialVeto(
+    const RefreshPolicy& policy, const RefreshPolicyState& state, float temperature, const PanelRefreshPlan& plan)
+{
+    if (!isnan(temperature) && temperature < policy.partialMinTempC)
+        return "too cold for partial";
+    if (plan.changedPerMille > policy.partialMaxPerMille)
+        return "large change";
+    if (state.partialCount >= policy.maxPartials)
+        return "partial limit";
+    if (state.ghostPerMille + plan.changedPerMille > policy.ghostBudgetPerMille)
+        return "ghosting budget";
+    if (state.secSinceFull >= policy.staticFullSec)
+        return "full refresh due";
+    return nullptr;
+}
+
+uint32_t refreshPolicyAddSec(uint32_t age, uint32_t seconds)
+{
+    return age > UINT32_MAX - seconds ? UINT32_MAX : age + seconds;
+}
+
+} // namespace
+
+// Raises the plan where the panel's state asks for more than the frame
+// does; temperature in °C, NAN when there is no reading
+void refreshPolicyApply(const RefreshPolicy& policy, const RefreshPolicyState& state, float temperature, PanelRefreshPlan& plan)
+{
+    if (plan.mode == PANEL_REFRESH_NONE && state.secSinceFull >= policy.staticFullSec) {
+        plan.mode = PANEL_REFRESH_FULL;
+        plan.reason = "unchanged too long";
+    }
+    if (plan.mode == PANEL_REFRESH_PARTIAL) {
+        const char* veto = refreshPolicyPartialVeto(policy, state, temperature, plan);
+        if (veto) {
+            plan.mode = PANEL_REFRESH_FULL;
+            plan.reason = veto;
+        }
+    }
+    if (plan.mode == PANEL_REFRESH_FULL && policy.cleanIntervalSec && state.secSinceClean >= policy.cleanIntervalSec) {
+        plan.mode = PANEL_REFRESH_CLEAN;
+        plan.reason = "clean cycle due";
+    }
+}
+
+// After a refresh, including full ones outside a plan
+void refreshPolicyRecord(RefreshPolicyState& state, PanelRefreshMode mode, uint16_t changedPerMille)
+{
+    if (mode == PANEL_REFRESH_PARTIAL) {
+        if (state.partialCount < UINT8_MAX)
+            state.partialCount++;
+        // A partial refresh always changes something, if less than 0.1%
+        state.ghostPerMille = min((uint32_t)state.ghostPerMille + max(changedPerMille, (uint16_t)1), (uint32_t)UINT16_MAX);
+        return;
+    }
+    if (mode == PANEL_REFRESH_NONE)
+        return;
+    state.partialCount = 0;
+    state.ghostPerMille = 0;
+    state.secSinceFull = 0;
+    if (mode == PANEL_REFRESH_CLEAN)
+        state.secSinceClean = 0;
+}
+
+// Before deep sleep: the ages grow by the sleep time
+void refreshPolicyAdvance(RefreshPolicyState& state, uint32_t seconds)
+{
+    state.secSinceFull = refreshPolicyAddSec(state.secSinceFull, seconds);
+    state.secSinceClean = refreshPolicyAddSec(state.secSinceClean, seconds);
+}
+
+#endif // REFRESH_POLICY_H_
@@ -0,0 +1,175 @@
+#ifndef RETRY_POLICY_H_
+#define RETRY_POLICY_H_
+
+#include <Arduino.h>
+
+// Retry policy for render API downloads.
+//
+// Every failed attempt is classified, and the class decides what happens
+// next within the per-wake wall-clock budget:
+//
+//   FETCH_ERR_DNS      name did not resolve       one quick retry, then give up
+//   FETCH_ERR_CONNECT  refused / unreachable      one quick retry, then give up
+//   FETCH_ERR_TIMEOUT  no response in time        give up (server hung; each try costs the full timeout)
+//   FETCH_ERR_STALL    body stopped mid-transfer  back off and retry (flaky link)
+//   FETCH_ERR_SERVER   5xx                        back off and retry, honouring Retry-After
+//   FETCH_ERR_CLIENT   4xx                        give up (retrying cannot help)
+//   FETCH_ERR_LOCAL    SPIFFS / decode problem    give up
+//
+// Backoff is exponential with "equal jitter" (half fixed, half random) so a
+// fleet of displays does not hammer a recovering server in lockstep.
+// When the server looks down, retryWakeDelaySec() picks an earlier wake
+// than the usual hour, doubling with each consecutive failed wake.
+
+enum FetchError {
+    FETCH_OK = 0,
+    FETCH_ERR_DNS,
+    FETCH_ERR_CONNECT,
+    FETCH_ERR_TIMEOUT,
+    FETCH_ERR_STALL,
+    FETCH_ERR_SERVER,
+    FETCH_ERR_CLIENT,
+    FETCH_ERR_LOCAL
+};
+
+typedef struct {
+    uint32_t budgetMs; // Wall-clock budget for all attempts of one wake
+    uint32_t baseDelayMs; // First backoff delay
+    uint32_t maxDelayMs; // Backoff cap
+    uint8_t maxAttempts;
+    uint8_t maxQuickRetries; // Extra attempts for DNS / connect failures
+    uint32_t minAttemptMs; // Don't start an attempt with less budget left
+} RetryPolicy;
+
+class RetryState {
+public:
+    void begin(const RetryPolicy& policy)
+    {
+        _policy = policy;
+        _start = millis();
+        _attempts = 0;
+        _quickRetries = 0;
+    }
+
+    uint32_t elapsedMs() const { return millis() - _start; }
+    uint32_t remainingMs() const
+    {
+        uint32_t elapsed = elapsedMs();
+        return elapsed >= _policy.budgetMs ? 0 : _policy.budgetMs - elapsed;
+    }
+    uint8_t attempts() const { return _attempts; }
+
+    // Call before each attempt; false once the budget or attempts are used up
+    bool startAttempt()
+    {
+        if (_attempts >= _policy.maxAttempts || remainingMs() < _policy.minAttemptMs)
+            return false;
+        _attempts++;
+        return true;
+    }
+
+    // Decides whether to try again after a failure and how long to wait.
+    // retryAfterSec is the server's Retry-After header, 0 if none.
+    bool shouldRetry(FetchError error, uint32_t retryAfterSec, uint32_t& delayMs);
+
+private:
+    uint32_t backoffMs() const;
+
+    RetryPolicy _policy;
+    uint32_t _start;
+    uint8_t _attempts;
+    uint8_t _quickRetries;
+};
+
+const char* fetchErrorToString(FetchError error);
+bool fetchErrorMeansServerDown(FetchError error);
+uint32_t retryWakeDelaySec(uint8_t failedWakes, uint32_t baseSec, uint32_t maxSec);
+
+// Implementation
+
+uint32_t RetryState::backoffMs() const
+{
+    uint32_t delay = _policy.baseDelayMs;
+    for (uint8_t i = 1; i < _attempts && delay < _policy.maxDelayMs; i++)
+        delay *= 2;
+    if (delay > _policy.maxDelayMs)
+        delay = _policy.maxDelayMs;
+    return delay / 2 + esp_random() % (delay / 2 + 1);
+}
+
+bool RetryState::shouldRetry(FetchError error, uint32_t retryAfterSec, uint32_t& delayMs)
+{
+    delayMs = 0;
+    switch (error) {
+    case FETCH_OK:
+    case FETCH_ERR_TIMEOUT:
+    case FETCH_ERR_CLIENT:
+    case FETCH_ERR_LOCAL:
+        return false;
+    case FETCH_ERR_DNS:
+    case FETCH_ERR_CONNECT:
+        // Nothing is listening: one short retry covers a restarting server,
+        // anything longer is radio time wasted
+        if (_quickRetries >= _policy.maxQuickRetries)
+            return false;
+        _quickRetries++;
+        delayMs = 500 + esp_random() % 500;
+        break;
+    case FETCH_ERR_STALL:
+    case FETCH_ERR_SERVER:
+        delayMs = backoffMs();
+        if (retryAfterSec > 0 && retryAfterSec * 1000 > delayMs)
+            delayMs = retryAfterSec * 1000;
+        break;
+    }
+
+    if (_attempts >= _policy.maxAttempts)
+        return false;
+    // Only worth waiting if an attempt still fits in the budget afterwards
+    return delayMs + _policy.minAttemptMs <= remainingMs();
+}
+
+const char* fetchErrorToString(FetchError error)
+{
+    switch (error) {
+    case FETCH_OK:
+        return "ok";
+    case FETCH_ERR_DNS:
+        return "dns";
+    case FETCH_ERR_CONNECT:
+        return "connect";
+    case FETCH_ERR_TIMEOUT:
+        return "timeout";
+    case FETCH_ERR_STALL:
+        return "stalled body";
+    case FETCH_ERR_SERVER:
+        return "server error";
+    case FETCH_ERR_CLIENT:
+        return "client error";
+    case FETCH_ERR_LOCAL:
+        return "local";
+    }
+    return "unknown";
+}
+
+// Errors where trying again a bit later is likely to succeed
+bool fetchErrorMeansServerDown(FetchError error)
+{
+    return error == FETCH_ERR_DNS || error == FETCH_ERR_CONNECT || error == FETCH_ERR_TIMEOUT
+        || error == FETCH_ERR_STALL || error == FETCH_ERR_SERVER;
+}
+
+// Sleep before the next fetch attempt after failedWakes consecutive failed
+// wakes: baseSec, 2 x baseSec, ... up to maxSec, with +-10% jitter
+uint32_t retryWakeDelaySec(uint8_t failedWakes, uint32_t baseSec, uint32_t maxSec)
+{
+    uint32_t delay = baseSec;
+    for (uint8_t i = 1; i < failedWakes && delay < maxSec; i++)
+        delay *= 2;
+    if (delay > maxSec)
+        delay = maxSec;
+    uint32_t jitter = delay / 10;
+    return delay - jitter + esp_random() % (2 * jitter + 1);
+}
+
+#endif // RETRY_POLICY_H_
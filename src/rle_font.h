@@ -0,0 +1,131 @@
+#ifndef RLE_FONT_H_
+#define RLE_FONT_H_
+
+#include <Arduino.h>
+
+// Run-length compressed GFXfont.
+//
+// Generated from the Adafruit GFXfont headers in src/fonts by
+// tools/font_rle.cpp into src/fonts/rle/. Per glyph the bit stream (width x
+// height pixels, row after row, as in GFXfont) is stored as
+//   RLE_GLYPH_RAW    the bits unchanged
+//   RLE_GLYPH_RUNS   alternating clear/set runs, starting with clear, one
+//                    nibble each (high nibble first). A nibble of 15 adds 15
+//                    and continues the same run, so a run of 15 is "F 0".
+//   RLE_GLYPH_DELTA  runs as above of every row XORed with the row above,
+//                    which turns vertical stems into long clear runs
+// whichever is shortest. Glyphs with identical bitmaps share one stream, so
+// Cyrillic letters drawn like their Latin counterparts (А/A, О/O, р/p...)
+// cost only their RleGlyph entry.
+//
+// Glyphs are decoded on demand into byte-aligned rows; glyph_cache.h keeps
+// the recently used ones in RAM.
+//
+// The saving is small for a single font: TimesNRCyr12 goes from 5242 to
+// 3993 bytes, and the decoder and the RleFont paths of the glyph cache are
+// about the same size in code. It pays off with every further font linked,
+// and most for the large ones (TimesNRCyr18 keeps 62% of its size).
+
+#define RLE_GLYPH_RAW 0
+#define RLE_GLYPH_RUNS 1
+#define RLE_GLYPH_DELTA 2
+
+typedef struct {
+    uint16_t offset; // Into RleFont::data
+    uint8_t width;
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;
+    int8_t yOffset;
+    uint8_t encoding; // RLE_GLYPH_*
+} RleGlyph;
+
+typedef struct {
+    const uint8_t* data;
+    const RleGlyph* glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+} RleFont;
+
+// Function declarations
+const RleGlyph* rleFontGlyph(const RleFont* font, uint8_t code);
+void rleFontDecode(const RleFont* font, const RleGlyph* glyph, uint8_t* rows, uint8_t bytesPerRow);
+
+// Implementation
+
+// Glyph entry for code, or nullptr if the font does not have it
+const RleGlyph* rleFontGlyph(const RleFont* font, uint8_t code)
+{
+    uint16_t first = pgm_read_word(&font->first);
+    uint16_t last = pgm_read_word(&font->last);
+    if (code < first || code > last)
+        return nullptr;
+    return font->glyph + (code - first);
+}
+
+// Unpacks a glyph into rows of bytesPerRow bytes each (cleared first)
+void rleFontDecode(const RleFont* font, const RleGlyph* glyph, uint8_t* rows, uint8_t bytesPerRow)
+{
+    uint8_t width = pgm_read_byte(&glyph->width);
+    uint8_t height = pgm_read_byte(&glyph->height);
+    const uint8_t* data = font->data + pgm_read_word(&glyph->offset);
+    uint32_t total = (uint32_t)width * height;
+    memset(rows, 0, (size_t)bytesPerRow * height);
+    if (total == 0)
+        return;
+
+    uint8_t encoding = pgm_read_byte(&glyph->encoding);
+    if (encoding == RLE_GLYPH_RAW) {
+        for (uint32_t bit = 0; bit < total; bit++) {
+            if (pgm_read_byte(&data[bit / 8]) & (0x80 >> (bit & 7))) {
+                uint32_t y = bit / width, x = bit % width;
+                rows[y * bytesPerRow + x / 8] |= 0x80 >> (x & 7);
+            }
+        }
+        return;
+    }
+
+    uint32_t bit = 0;
+    uint32_t nibble = 0;
+    bool set = false;
+    uint8_t x = 0, y = 0;
+    while (bit < total) {
+        uint32_t run = 0;
+        uint8_t n;
+        do {
+            uint8_t byte = pgm_read_byte(&data[nibble / 2]);
+            n = (nibble & 1) ? (byte & 0x0F) : (byte >> 4);
+            nibble++;
+            run += n;
+        } while (n == 15);
+        if (run > total - bit)
+            run = total - bit;
+        bit += run;
+        // A run may continue over the end of a row
+        while (run > 0) {
+            uint8_t span = (uint32_t)(width - x) < run ? width - x : run;
+            if (set) {
+                for (uint8_t i = 0; i < span; i++, x++)
+                    rows[y * bytesPerRow + x / 8] |= 0x80 >> (x & 7);
+            } else {
+                x += span;
+            }
+            run -= span;
+            if (x == width) {
+                x = 0;
+                y++;
+            }
+        }
+        set = !set;
+    }
+
+    if (encoding == RLE_GLYPH_DELTA) {
+        for (uint8_t row = 1; row < height; row++) {
+            for (uint8_t b = 0; b < bytesPerRow; b++)
+                rows[row * bytesPerRow + b] ^= rows[(row - 1) * bytesPerRow + b];
+        }
+    }
+}
+
+#endif // RLE_FONT_H_
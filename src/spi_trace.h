@@ -0,0 +1,232 @@
+#ifndef SPI_TRACE_H_
+#define SPI_TRACE_H_
+
+#include <Arduino.h>
+#include <SPI.h>
+
+// SPI transaction tracer for the e-paper transport.
+//
+// Built only with -DSPI_TRACE (env:freenove_esp32_s3_wroom_spitrace), which
+// also links with
+//   -Wl,--wrap=_ZN8SPIClass8transferEh                    SPIClass::transfer(uint8_t)
+//   -Wl,--wrap=_ZN8SPIClass16beginTransactionE11SPISettings
+//   -Wl,--wrap=digitalWrite -Wl,--wrap=digitalRead
+// so every byte GxEPD2 clocks out, every DC toggle and every poll of the
+// BUSY pin passes through the hooks below, without touching the library.
+//
+// Per phase (init, write, refresh, poweroff... named by the firmware) it
+// counts bytes, commands, RAM window setups (0x90 on the UC8179 of the
+// GDEW075Z08) and transactions, and splits the wall time into
+//   spi   back-to-back transfers (gaps over SPI_TRACE_GAP_US are firmware work)
+//   busy  BUSY held active while GxEPD2 polls it
+//   other whatever is left: decoding, SPIFFS, GFX
+// spiTraceDump() prints "SPITRACE" lines; tools/panel_model.cpp turns a
+// captured log into refresh-time predictions for other SPI clocks and
+// batching strategies.
+//
+// Without SPI_TRACE the API compiles to nothing.
+
+#define SPI_TRACE_MAX_PHASES 8
+#define SPI_TRACE_MAX_COMMANDS 16 // Distinct commands per phase
+#define SPI_TRACE_GAP_US 20 // Longer pauses between bytes are not SPI time
+#define SPI_TRACE_CMD_WINDOW 0x90 // UC8179 "partial window"
+
+#ifdef SPI_TRACE
+
+typedef struct {
+    uint8_t command;
+    uint32_t count;
+    uint32_t dataBytes;
+    uint64_t spiCycles;
+} SpiTraceCommand;
+
+typedef struct {
+    const char* name;
+    uint32_t startUs;
+    uint32_t wallUs;
+    uint32_t bytes; // Command and data bytes
+    uint32_t commands;
+    uint32_t windows;
+    uint32_t transactions;
+    uint64_t spiCycles;
+    uint32_t busyUs;
+    uint32_t busyWaits;
+    uint8_t commandCount;
+    SpiTraceCommand command[SPI_TRACE_MAX_COMMANDS];
+} SpiTracePhase;
+
+// Function declarations
+void spiTraceBegin(int8_t dcPin, int8_t busyPin, uint8_t busyLevel);
+void spiTracePhase(const char* name);
+void spiTraceEnd();
+void spiTraceDump(Print& out);
+
+// Implementation
+
+namespace {
+
+struct {
+    int8_t dcPin = -1;
+    int8_t busyPin = -1;
+    uint8_t busyLevel = LOW;
+    bool enabled = false;
+    bool dcCommand = false;
+    bool busy = false;
+    uint32_t busyStartUs = 0;
+    uint32_t lastCycles = 0;
+    uint32_t gapCycles = 0;
+    uint32_t clockHz = 0;
+    uint8_t phaseCount = 0;
+    SpiTracePhase* phase = nullptr;
+    SpiTraceCommand* command = nullptr;
+    SpiTracePhase phases[SPI_TRACE_MAX_PHASES];
+} spiTrace;
+
+SpiTraceCommand* spiTraceCommandSlot(SpiTracePhase* phase, uint8_t command)
+{
+    for (uint8_t i = 0; i < phase->commandCount; i++) {
+        if (phase->command[i].command == command)
+            return &phase->command[i];
+    }
+    if (phase->commandCount == SPI_TRACE_MAX_COMMANDS)
+        return nullptr;
+    SpiTraceCommand* slot = &phase->command[phase->commandCount++];
+    memset(slot, 0, sizeof(*slot));
+    slot->command = command;
+    return slot;
+}
+
+} // namespace
+
+void spiTraceBegin(int8_t dcPin, int8_t busyPin, uint8_t busyLevel)
+{
+    spiTrace.dcPin = dcPin;
+    spiTrace.busyPin = busyPin;
+    spiTrace.busyLevel = busyLevel;
+    spiTrace.phaseCount = 0;
+    spiTrace.phase = nullptr;
+    spiTrace.command = nullptr;
+    spiTrace.gapCycles = SPI_TRACE_GAP_US * getCpuFrequencyMhz();
+    spiTrace.enabled = true;
+}
+
+// Closes the running phase and starts a new one
+void spiTracePhase(const char* name)
+{
+    if (!spiTrace.enabled)
+        return;
+    uint32_t now = micros();
+    if (spiTrace.phase)
+        spiTrace.phase->wallUs = now - spiTrace.phase->startUs;
+    spiTrace.phase = nullptr;
+    spiTrace.command = nullptr;
+    if (!name || spiTrace.phaseCount == SPI_TRACE_MAX_PHASES)
+        return;
+    SpiTracePhase* phase = &spiTrace.phases[spiTrace.phaseCount++];
+    memset(phase, 0, sizeof(*phase));
+    phase->name = name;
+    phase->startUs = now;
+    spiTrace.phase = phase;
+}
+
+void spiTraceEnd()
+{
+    spiTracePhase(nullptr);
+}
+
+void spiTraceDump(Print& out)
+{
+    uint32_t cyclesPerUs = getCpuFrequencyMhz();
+    out.printf("SPITRACE clock %lu cpu_mhz %lu\n", (unsigned long)spiTrace.clockHz, (unsigned long)cyclesPerUs);
+    for (uint8_t i = 0; i < spiTrace.phaseCount; i++) {
+        const SpiTracePhase& p = spiTrace.phases[i];
+        out.printf("SPITRACE phase %s wall_us %lu spi_us %lu busy_us %lu busy_waits %lu bytes %lu commands %lu windows %lu transactions %lu\n",
+            p.name, (unsigned long)p.wallUs, (unsigned long)(p.spiCycles / cyclesPerUs), (unsigned long)p.busyUs,
+            (unsigned long)p.busyWaits, (unsigned long)p.bytes, (unsigned long)p.commands, (unsigned long)p.windows,
+            (unsigned long)p.transactions);
+        for (uint8_t c = 0; c < p.commandCount; c++) {
+            const SpiTraceCommand& cmd = p.command[c];
+            out.printf("SPITRACE cmd %s 0x%02X count %lu data %lu spi_us %lu\n", p.name, cmd.command, (unsigned long)cmd.count,
+                (unsigned long)cmd.dataBytes, (unsigned long)(cmd.spiCycles / cyclesPerUs));
+        }
+    }
+}
+
+// Linker wraps (see top of file)
+
+extern "C" {
+uint8_t __real__ZN8SPIClass8transferEh(SPIClass* spi, uint8_t data);
+void __real__ZN8SPIClass16beginTransactionE11SPISettings(SPIClass* spi, SPISettings settings);
+void __real_digitalWrite(uint8_t pin, uint8_t val);
+int __real_digitalRead(uint8_t pin);
+
+uint8_t __wrap__ZN8SPIClass8transferEh(SPIClass* spi, uint8_t data)
+{
+    SpiTracePhase* phase = spiTrace.phase;
+    if (phase) {
+        uint32_t now = ESP.getCycleCount();
+        uint32_t gap = now - spiTrace.lastCycles;
+        spiTrace.lastCycles = now;
+        phase->bytes++;
+        if (gap < spiTrace.gapCycles) {
+            phase->spiCycles += gap;
+            if (spiTrace.command)
+                spiTrace.command->spiCycles += gap;
+        }
+        if (spiTrace.dcCommand) {
+            phase->commands++;
+            if (data == SPI_TRACE_CMD_WINDOW)
+                phase->windows++;
+            spiTrace.command = spiTraceCommandSlot(phase, data);
+            if (spiTrace.command)
+                spiTrace.command->count++;
+        } else if (spiTrace.command) {
+            spiTrace.command->dataBytes++;
+        }
+    }
+    return __real__ZN8SPIClass8transferEh(spi, data);
+}
+
+void __wrap__ZN8SPIClass16beginTransactionE11SPISettings(SPIClass* spi, SPISettings settings)
+{
+    spiTrace.clockHz = settings._clock;
+    if (spiTrace.phase)
+        spiTrace.phase->transactions++;
+    __real__ZN8SPIClass16beginTransactionE11SPISettings(spi, settings);
+}
+
+void __wrap_digitalWrite(uint8_t pin, uint8_t val)
+{
+    if (pin == spiTrace.dcPin)
+        spiTrace.dcCommand = val == LOW;
+    __real_digitalWrite(pin, val);
+}
+
+int __wrap_digitalRead(uint8_t pin)
+{
+    int val = __real_digitalRead(pin);
+    if (pin == spiTrace.busyPin && spiTrace.phase) {
+        bool busy = val == spiTrace.busyLevel;
+        uint32_t now = micros();
+        if (busy && !spiTrace.busy) {
+            spiTrace.busyStartUs = now;
+        } else if (!busy && spiTrace.busy) {
+            spiTrace.phase->busyUs += now - spiTrace.busyStartUs;
+            spiTrace.phase->busyWaits++;
+        }
+        spiTrace.busy = busy;
+    }
+    return val;
+}
+}
+
+#else
+
+inline void spiTraceBegin(int8_t, int8_t, uint8_t) { }
+inline void spiTracePhase(const char*) { }
+inline void spiTraceEnd() { }
+inline void spiTraceDump(Print&) { }
+
+#endif // SPI_TRACE
+
+#endif // SPI_TRACE_H_
@@ -0,0 +1,301 @@
+#ifndef TEXT_LAYOUT_H_
+#define TEXT_LAYOUT_H_
+
+#include <Adafruit_GFX.h>
+#include <Arduino.h>
+
+#include "rle_font.h"
+
+// Text layout for the 8-bit Cyrillic fonts.
+//
+// The TimesNRCyr and CourierCyr fonts hold ASCII plus Russian in their own
+// code page: А..п at 0x90..0xBF, р..я at 0x80..0x8F, Ё at 0xC0 and ё at
+// 0xC1. Strings from the server and the sources are UTF-8, so printing
+// them byte by byte draws two wrong glyphs per letter.
+//
+// textLayout() decodes UTF-8 into that code page once, word-wraps it to a
+// pixel width using per-font advance tables (no glyph bitmaps are
+// touched), and caches the lines by (font, width, text). A dashboard
+// redrawn on every band and every wake then costs one hash per string.
+//
+// Lines break at spaces, after '-' and at '\n'. A word wider than the line
+// is split between characters. When the text needs more than maxLines,
+// the last line ends in "...". Code points the font has no glyph for
+// become '?'; text beyond TEXT_LAYOUT_MAX_CHARS is dropped.
+
+#define TEXT_LAYOUT_MAX_CHARS 256 // Per text, after decoding
+#define TEXT_LAYOUT_MAX_LINES 8
+#define TEXT_LAYOUT_CACHE_SLOTS 16 // Laid-out texts, power of two
+#define TEXT_LAYOUT_FONTS 4 // Advance tables
+
+typedef enum {
+    TEXT_LAYOUT_LEFT,
+    TEXT_LAYOUT_CENTER,
+    TEXT_LAYOUT_RIGHT
+} TextLayoutAlign;
+
+typedef struct {
+    uint16_t start; // Into TextLayout::text
+    uint16_t length;
+    uint16_t width; // Sum of advances
+} TextLayoutLine;
+
+typedef struct {
+    const void* font; // GFXfont or RleFont, nullptr = classic 6x8 font
+    uint32_t hash;
+    uint16_t sourceLength;
+    uint16_t length;
+    uint16_t width; // Widest line
+    uint8_t lineHeight;
+    uint8_t lineCount;
+    bool truncated;
+    TextLayoutLine lines[TEXT_LAYOUT_MAX_LINES];
+    char text[TEXT_LAYOUT_MAX_CHARS + 4]; // Font code page, room for "..."
+} TextLayout;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+} TextLayoutStats;
+
+// Function declarations
+size_t textLayoutDecodeUtf8(const char* utf8, char* out, size_t outSize);
+template <typename Font>
+const TextLayout* textLayout(const Font* font, const char* utf8, uint16_t maxWidth, uint8_t maxLines = TEXT_LAYOUT_MAX_LINES);
+template <typename GFX>
+void textLayoutDraw(GFX& gfx, const TextLayout* layout, int16_t x, int16_t y, TextLayoutAlign align = TEXT_LAYOUT_LEFT);
+void textLayoutClear();
+const TextLayoutStats& textLayoutStats();
+
+// Implementation
+
+namespace {
+
+typedef struct {
+    const void* font;
+    uint8_t yAdvance;
+    uint8_t advance[256];
+} TextLayoutMetrics;
+
+TextLayout textLayoutSlots[TEXT_LAYOUT_CACHE_SLOTS];
+TextLayoutMetrics textLayoutFonts[TEXT_LAYOUT_FONTS];
+uint8_t textLayoutFontsNext = 0;
+TextLayoutStats textLayoutCounters;
+
+char textLayoutCodePage(uint32_t codePoint)
+{
+    if (codePoint < 0x80)
+        return (char)codePoint;
+    if (codePoint >= 0x410 && codePoint <= 0x43F) // А..п
+        return (char)(0x90 + codePoint - 0x410);
+    if (codePoint >= 0x440 && codePoint <= 0x44F) // р..я
+        return (char)(0x80 + codePoint - 0x440);
+    if (codePoint == 0x401) // Ё
+        return (char)0xC0;
+    if (codePoint == 0x451) // ё
+        return (char)0xC1;
+    if (codePoint == 0xA0) // No-break space
+        return ' ';
+    return '?';
+}
+
+// Advance table for font, built on first use
+template <typename Font>
+const TextLayoutMetrics& textLayoutMetrics(const Font* font)
+{
+    for (const TextLayoutMetrics& metrics : textLayoutFonts) {
+        if (metrics.font == font && metrics.yAdvance)
+            return metrics;
+    }
+    TextLayoutMetrics& metrics = textLayoutFonts[textLayoutFontsNext];
+    textLayoutFontsNext = (textLayoutFontsNext + 1) % TEXT_LAYOUT_FONTS;
+    metrics.font = font;
+    if (!font) {
+        memset(metrics.advance, 6, sizeof(metrics.advance));
+        metrics.yAdvance = 8;
+        return metrics;
+    }
+    uint16_t first = pgm_read_word(&font->first);
+    uint16_t last = pgm_read_word(&font->last);
+    for (uint16_t c = 0; c < 256; c++)
+        metrics.advance[c] = c >= first && c <= last ? pgm_read_byte(&font->glyph[c - first].xAdvance) : 0;
+    metrics.yAdvance = pgm_read_byte(&font->yAdvance);
+    return metrics;
+}
+
+// Greedy word wrap of layout.text into lines of at most maxWidth pixels
+void textLayoutWrap(const TextLayoutMetrics& metrics, TextLayout& layout, uint16_t maxWidth, uint8_t maxLines)
+{
+    const char* text = layout.text;
+    uint16_t pos = 0;
+    bool wrapped = false;
+    layout.lineCount = 0;
+    layout.truncated = false;
+    layout.width = 0;
+    layout.lineHeight = metrics.yAdvance;
+    while (pos < layout.length) {
+        if (wrapped) {
+            while (pos < layout.length && text[pos] == ' ')
+                pos++;
+            if (pos == layout.length)
+                break;
+        }
+        if (layout.lineCount == maxLines) {
+            layout.truncated = true;
+            break;
+        }
+        uint16_t start = pos, end = pos, width = 0;
+        uint16_t breakEnd = start, breakWidth = 0, breakNext = start;
+        while (end < layout.length && text[end] != '\n') {
+            uint8_t advance = metrics.advance[(uint8_t)text[end]];
+            if (width + advance > maxWidth && end > start)
+                break;
+            if (text[end] == ' ') {
+                breakEnd = end;
+                breakWidth = width;
+                breakNext = end + 1;
+            }
+            width += advance;
+            end++;
+            if (text[end - 1] == '-') {
+                breakEnd = end;
+                breakWidth = width;
+                breakNext = end;
+            }
+        }
+        uint16_t next = end;
+        wrapped = false;
+        if (end < layout.length && text[end] == '\n') {
+            next = end + 1;
+        } else if (end < layout.length) {
+            wrapped = true;
+            if (text[end] == ' ') {
+                next = end + 1;
+            } else if (breakEnd > start) {
+                end = breakEnd;
+                width = breakWidth;
+                next = breakNext;
+            }
+        }
+        while (end > start && text[end - 1] == ' ') {
+            end--;
+            width -= metrics.advance[' '];
+        }
+        layout.lines[layout.lineCount++] = { start, (uint16_t)(end - start), width };
+        if (width > layout.width)
+            layout.width = width;
+        pos = next;
+    }
+
+    if (layout.truncated) {
+        // Shorten the last line until "..." fits behind it
+        TextLayoutLine& line = layout.lines[layout.lineCount - 1];
+        uint16_t dots = 3 * metrics.advance['.'];
+        while (line.length > 0 && (line.width + dots > maxWidth || text[line.start + line.length - 1] == ' ')) {
+            line.length--;
+            line.width -= metrics.advance[(uint8_t)text[line.start + line.length]];
+        }
+        memcpy(layout.text + line.start + line.length, "...", 3);
+        line.length += 3;
+        line.width += dots;
+        if (line.width > layout.width)
+            layout.width = line.width;
+    }
+}
+
+} // namespace
+
+// Converts UTF-8 to the fonts' code page; returns the length written
+// (without the terminating zero, at most outSize - 1)
+size_t textLayoutDecodeUtf8(const char* utf8, char* out, size_t outSize)
+{
+    const uint8_t* s = (const uint8_t*)utf8;
+    size_t length = 0;
+    while (*s && length + 1 < outSize) {
+        uint32_t codePoint;
+        uint8_t extra;
+        if (*s < 0x80) {
+            codePoint = *s;
+            extra = 0;
+        } else if ((*s & 0xE0) == 0xC0) {
+            codePoint = *s & 0x1F;
+            extra = 1;
+        } else if ((*s & 0xF0) == 0xE0) {
+            codePoint = *s & 0x0F;
+            extra = 2;
+        } else if ((*s & 0xF8) == 0xF0) {
+            codePoint = *s & 0x07;
+            extra = 3;
+        } else {
+            codePoint = '?'; // Stray continuation byte
+            extra = 0;
+        }
+        s++;
+        while (extra && (*s & 0xC0) == 0x80) {
+            codePoint = codePoint << 6 | (*s++ & 0x3F);
+            extra--;
+        }
+        out[length++] = extra ? '?' : textLayoutCodePage(codePoint);
+    }
+    if (outSize)
+        out[length] = 0;
+    return length;
+}
+
+// Lines of utf8 in font, wrapped at maxWidth pixels; valid until the
+// cache slot is reused, so draw it before laying out more text
+template <typename Font>
+const TextLayout* textLayout(const Font* font, const char* utf8, uint16_t maxWidth, uint8_t maxLines)
+{
+    if (maxLines == 0 || maxLines > TEXT_LAYOUT_MAX_LINES)
+        maxLines = TEXT_LAYOUT_MAX_LINES;
+    size_t sourceLength = strlen(utf8);
+    uint32_t hash = (2166136261u ^ (uint32_t)(uintptr_t)font ^ ((uint32_t)maxWidth << 8) ^ maxLines); // FNV-1a
+    for (size_t i = 0; i < sourceLength; i++)
+        hash = (hash ^ (uint8_t)utf8[i]) * 16777619u;
+
+    TextLayout& layout = textLayoutSlots[hash & (TEXT_LAYOUT_CACHE_SLOTS - 1)];
+    if (layout.font == font && layout.hash == hash && layout.sourceLength == (uint16_t)sourceLength && layout.lineHeight) {
+        textLayoutCounters.hits++;
+        return &layout;
+    }
+    textLayoutCounters.misses++;
+    layout.font = font;
+    layout.hash = hash;
+    layout.sourceLength = sourceLength;
+    layout.length = textLayoutDecodeUtf8(utf8, layout.text, TEXT_LAYOUT_MAX_CHARS + 1);
+    textLayoutWrap(textLayoutMetrics(font), layout, maxWidth, maxLines);
+    return &layout;
+}
+
+// Prints the lines with the first baseline at y; the font must already be
+// selected on gfx. x is the left edge, center or right edge per align.
+template <typename GFX>
+void textLayoutDraw(GFX& gfx, const TextLayout* layout, int16_t x, int16_t y, TextLayoutAlign align)
+{
+    gfx.setTextWrap(false);
+    for (uint8_t i = 0; i < layout->lineCount; i++) {
+        const TextLayoutLine& line = layout->lines[i];
+        int16_t lineX = x;
+        if (align == TEXT_LAYOUT_RIGHT)
+            lineX -= line.width;
+        else if (align == TEXT_LAYOUT_CENTER)
+            lineX -= line.width / 2;
+        gfx.setCursor(lineX, y + i * layout->lineHeight);
+        for (uint16_t c = 0; c < line.length; c++)
+            gfx.write((uint8_t)layout->text[line.start + c]);
+    }
+}
+
+void textLayoutClear()
+{
+    memset(textLayoutSlots, 0, sizeof(textLayoutSlots));
+    memset(textLayoutFonts, 0, sizeof(textLayoutFonts));
+}
+
+const TextLayoutStats& textLayoutStats()
+{
+    return textLayoutCounters;
+}
+
+#endif // TEXT_LAYOUT_H_
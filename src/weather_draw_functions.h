@@ -5,6 +5,8 @@
 #include <Arduino.h>
 #include <GxEPD2_3C.h>
 
+#include "wx_icon.h"
+
 // Forward declaration of display object
 extern GxEPD2_3C<GxEPD2_750c_Z08, GxEPD2_750c_Z08::HEIGHT / 4> display;
 
@@ -19,6 +21,7 @@ extern GxEPD2_3C<GxEPD2_750c_Z08, GxEPD2_750c_Z08::HEIGHT / 4> display;
 #define Small 3
 
 typedef struct {
+    Adafruit_GFX* gfx; // Drawing target, the display or e.g. a BwrCanvas
     int x;
     int y;
     int scale;
@@ -29,6 +32,9 @@ typedef struct {
 
 // Function declarations
 void draw_wx_icon(int x, int y, const String& iconCode, bool iconSize);
+void draw_wx_icon(Adafruit_GFX& gfx, int x, int y, const String& iconCode, bool iconSize);
+void draw_wx_icon(Adafruit_GFX& gfx, int x, int y, uint8_t icon, bool iconSize);
+void draw_wx_icon_scaled(Adafruit_GFX& gfx, int x, int y, uint8_t icon, int scale, bool iconSize);
 void sunny(DrawContext ctx);
 void few_clouds(DrawContext ctx);
 void clouds(DrawContext ctx);
@@ -66,37 +72,68 @@ Bounds draw_string(int x, int y, String text, int alignment);
 // Implementation
 
 void draw_wx_icon(int x, int y, const String& iconCode, bool iconSize)
+{
+    draw_wx_icon(display, x, y, iconCode, iconSize);
+}
+
+// OpenWeatherMap icon code ("04d") as a vector icon centered at (x, y)
+void draw_wx_icon(Adafruit_GFX& gfx, int x, int y, const String& iconCode, bool iconSize)
+{
+    draw_wx_icon(gfx, x, y, wxIconParse(iconCode.c_str()), iconSize);
+}
+
+// Parsed icon (wx_icon.h) as a vector icon centered at (x, y); icon_cache.h
+// draws the same through sprites
+void draw_wx_icon(Adafruit_GFX& gfx, int x, int y, uint8_t icon, bool iconSize)
+{
+    draw_wx_icon_scaled(gfx, x, y, icon, iconSize ? Large : Small, iconSize);
+}
+
+// Same at any scale; iconSize picks the line weight. tools/wx_icon_bitmaps.cpp
+// renders the bitmap sets of weather_icons.h with it.
+void draw_wx_icon_scaled(Adafruit_GFX& gfx, int x, int y, uint8_t icon, int scale, bool iconSize)
 {
     DrawContext ctx;
+    ctx.gfx = &gfx;
     ctx.x = x;
     ctx.y = y;
     ctx.iconSize = iconSize;
-    ctx.night = iconCode.endsWith("n");
+    ctx.night = wxIconNight(icon);
     ctx.lineSize = iconSize ? 2 : 1;
-    ctx.scale = iconSize ? Large : Small;
+    ctx.scale = scale;
 
-    String icon = iconCode.substring(0, 2);
-
-    if (icon == "01")
+    switch (wxIconKind(icon)) {
+    case WX_ICON_CLEAR:
         sunny(ctx);
-    else if (icon == "02")
+        break;
+    case WX_ICON_FEW_CLOUDS:
         few_clouds(ctx);
-    else if (icon == "03")
+        break;
+    case WX_ICON_CLOUDS:
         clouds(ctx);
-    else if (icon == "04")
+        break;
+    case WX_ICON_HEAVY_CLOUDS:
         heavy_clouds(ctx);
-    else if (icon == "09")
+        break;
+    case WX_ICON_SHOWER_RAIN:
         shower_rain(ctx);
-    else if (icon == "10")
+        break;
+    case WX_ICON_RAIN:
         rain(ctx);
-    else if (icon == "11")
+        break;
+    case WX_ICON_THUNDERSTORM:
         thunder_storm(ctx);
-    else if (icon == "13")
+        break;
+    case WX_ICON_SNOW:
         snow(ctx);
-    else if (icon == "50")
+        break;
+    case WX_ICON_MIST:
         haze(ctx);
-    else
+        break;
+    default:
         no_data(ctx);
+        break;
+    }
 }
 
 void addcloud(DrawContext ctx, bool white)
@@ -107,19 +144,19 @@ void addcloud(DrawContext ctx, bool white)
     const int linesize = ctx.lineSize;
 
     // Draw cloud outer
-    display.fillCircle(x - scale * 3, y, scale, FG_COLOR);
-    display.fillCircle(x + scale * 3, y, scale, FG_COLOR);
-    display.fillCircle(x - scale, y - scale, scale * 1.4, FG_COLOR);
-    display.fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75, FG_COLOR);
-    display.fillRect(x - scale * 3 - 1, y - scale, scale * 6, scale * 2 + 1, FG_COLOR);
+    ctx.gfx->fillCircle(x - scale * 3, y, scale, FG_COLOR);
+    ctx.gfx->fillCircle(x + scale * 3, y, scale, FG_COLOR);
+    ctx.gfx->fillCircle(x - scale, y - scale, scale * 1.4, FG_COLOR);
+    ctx.gfx->fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75, FG_COLOR);
+    ctx.gfx->fillRect(x - scale * 3 - 1, y - scale, scale * 6, scale * 2 + 1, FG_COLOR);
 
     if (white) {
         // Clear cloud inner
-        display.fillCircle(x - scale * 3, y, scale - linesize, BG_COLOR);
-        display.fillCircle(x + scale * 3, y, scale - linesize, BG_COLOR);
-        display.fillCircle(x - scale, y - scale, scale * 1.4 - linesize, BG_COLOR);
-        display.fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75 - linesize, BG_COLOR);
-        display.fillRect(x - scale * 3 + 2, y - scale + linesize - 1, scale * 5.9, scale * 2 - linesize * 2 + 2, BG_COLOR);
+        ctx.gfx->fillCircle(x - scale * 3, y, scale - linesize, BG_COLOR);
+        ctx.gfx->fillCircle(x + scale * 3, y, scale - linesize, BG_COLOR);
+        ctx.gfx->fillCircle(x - scale, y - scale, scale * 1.4 - linesize, BG_COLOR);
+        ctx.gfx->fillCircle(x + scale * 1.5, y - scale * 1.3, scale * 1.75 - linesize, BG_COLOR);
+        ctx.gfx->fillRect(x - scale * 3 + 2, y - scale + linesize - 1, scale * 5.9, scale * 2 - linesize * 2 + 2, BG_COLOR);
     }
 }
 
@@ -130,33 +167,33 @@ void addsun(DrawContext ctx)
     int scale = ctx.scale;
     int linesize = ctx.lineSize;
 
-    display.drawLine(x - scale * 1.8, y, x + scale * 1.8, y, FG_COLOR);
-    display.drawLine(x, y + scale * 1.8, x, y - scale * 1.8, FG_COLOR);
-    display.drawLine(x - scale * 1.35, y - scale * 1.35, x + scale * 1.35, y + scale * 1.35, FG_COLOR);
-    display.drawLine(x - scale * 1.35, y + scale * 1.35, x + scale * 1.35, y - scale * 1.35, FG_COLOR);
+    ctx.gfx->drawLine(x - scale * 1.8, y, x + scale * 1.8, y, FG_COLOR);
+    ctx.gfx->drawLine(x, y + scale * 1.8, x, y - scale * 1.8, FG_COLOR);
+    ctx.gfx->drawLine(x - scale * 1.35, y - scale * 1.35, x + scale * 1.35, y + scale * 1.35, FG_COLOR);
+    ctx.gfx->drawLine(x - scale * 1.35, y + scale * 1.35, x + scale * 1.35, y - scale * 1.35, FG_COLOR);
 
     if (ctx.iconSize == LargeIcon) {
-        display.drawLine(x - scale * 1.8 + 1, y - 1, x + scale * 1.8 - 1, y - 1, FG_COLOR);
-        display.drawLine(x - scale * 1.8 + 1, y + 1, x + scale * 1.8 - 1, y + 1, FG_COLOR);
-        display.drawLine(x - 1, y + scale * 1.8 - 1, x - 1, y - scale * 1.8 + 1, FG_COLOR);
-        display.drawLine(x + 1, y + scale * 1.8 - 1, x + 1, y - scale * 1.8 + 1, FG_COLOR);
-        display.drawLine(x - scale * 1.35, y - scale * 1.35 + 1, x + scale * 1.35 - 1, y + scale * 1.35, FG_COLOR);
-        display.drawLine(x - scale * 1.35 + 1, y - scale * 1.35, x + scale * 1.35, y + scale * 1.35 - 1, FG_COLOR);
-        display.drawLine(x - scale * 1.35 + 1, y + scale * 1.35, x + scale * 1.35, y - scale * 1.35 + 1, FG_COLOR);
-        display.drawLine(x - scale * 1.35, y + scale * 1.35 - 1, x + scale * 1.35 - 1, y - scale * 1.35, FG_COLOR);
+        ctx.gfx->drawLine(x - scale * 1.8 + 1, y - 1, x + scale * 1.8 - 1, y - 1, FG_COLOR);
+        ctx.gfx->drawLine(x - scale * 1.8 + 1, y + 1, x + scale * 1.8 - 1, y + 1, FG_COLOR);
+        ctx.gfx->drawLine(x - 1, y + scale * 1.8 - 1, x - 1, y - scale * 1.8 + 1, FG_COLOR);
+        ctx.gfx->drawLine(x + 1, y + scale * 1.8 - 1, x + 1, y - scale * 1.8 + 1, FG_COLOR);
+        ctx.gfx->drawLine(x - scale * 1.35, y - scale * 1.35 + 1, x + scale * 1.35 - 1, y + scale * 1.35, FG_COLOR);
+        ctx.gfx->drawLine(x - scale * 1.35 + 1, y - scale * 1.35, x + scale * 1.35, y + scale * 1.35 - 1, FG_COLOR);
+        ctx.gfx->drawLine(x - scale * 1.35 + 1, y + scale * 1.35, x + scale * 1.35, y - scale * 1.35 + 1, FG_COLOR);
+        ctx.gfx->drawLine(x - scale * 1.35, y + scale * 1.35 - 1, x + scale * 1.35 - 1, y - scale * 1.35, FG_COLOR);
     }
 
     if (scale > Large) {
-        display.fillCircle(x, y, scale + linesize, BG_COLOR);
+        ctx.gfx->fillCircle(x, y, scale + linesize, BG_COLOR);
     }
-    display.fillCircle(x, y, scale, FG_COLOR);
-    display.fillCircle(x, y, scale - linesize, BG_COLOR);
+    ctx.gfx->fillCircle(x, y, scale, FG_COLOR);
+    ctx.gfx->fillCircle(x, y, scale - linesize, BG_COLOR);
 }
 
 void addmoon(DrawContext ctx)
 {
-    display.fillCircle(ctx.x, ctx.y, ctx.scale, FG_COLOR);
-    display.fillCircle(ctx.x + ctx.scale * 0.9, ctx.y, ctx.scale, BG_COLOR);
+    ctx.gfx->fillCircle(ctx.x, ctx.y, ctx.scale, FG_COLOR);
+    ctx.gfx->fillCircle(ctx.x + ctx.scale * 0.9, ctx.y, ctx.scale, BG_COLOR);
 }
 
 void addrain(DrawContext ctx)
@@ -168,7 +205,7 @@ void addrain(DrawContext ctx)
     // Simple rain lines
     for (int i = 0; i < 3; i++) {
         int rx = x - scale + i * scale;
-        display.drawLine(rx, y + scale * 2, rx - scale / 2, y + scale * 4, FG_COLOR);
+        ctx.gfx->drawLine(rx, y + scale * 2, rx - scale / 2, y + scale * 4, FG_COLOR);
     }
 }
 
@@ -178,11 +215,16 @@ void addsnow(DrawContext ctx)
     int y = ctx.y;
     int scale = ctx.scale;
 
-    // Simple snow flakes as *
-    // Font references removed to avoid conflicts
-    display.setTextColor(FG_COLOR);
-    display.setCursor(x - scale, y + scale * 3);
-    display.print("* * *");
+    // Three flakes drawn as lines, so they do not depend on the current font
+    int r = scale / 2 > 1 ? scale / 2 : 1;
+    for (int i = -1; i <= 1; i++) {
+        int fx = x + i * scale * 3 / 2;
+        int fy = y + scale * 3 + (i == 0 ? scale : 0);
+        ctx.gfx->drawLine(fx - r, fy, fx + r, fy, FG_COLOR);
+        ctx.gfx->drawLine(fx, fy - r, fx, fy + r, FG_COLOR);
+        ctx.gfx->drawLine(fx - r, fy - r, fx + r, fy + r, FG_COLOR);
+        ctx.gfx->drawLine(fx - r, fy + r, fx + r, fy - r, FG_COLOR);
+    }
 }
 
 void addtstorm(DrawContext ctx)
@@ -192,15 +234,15 @@ void addtstorm(DrawContext ctx)
     int scale = ctx.scale;
 
     // Simple lightning bolt
-    display.drawLine(x, y, x - scale, y + scale * 2, FG_COLOR);
-    display.drawLine(x - scale, y + scale * 2, x + scale / 2, y + scale, FG_COLOR);
-    display.drawLine(x + scale / 2, y + scale, x - scale / 2, y + scale * 3, FG_COLOR);
+    ctx.gfx->drawLine(x, y, x - scale, y + scale * 2, FG_COLOR);
+    ctx.gfx->drawLine(x - scale, y + scale * 2, x + scale / 2, y + scale, FG_COLOR);
+    ctx.gfx->drawLine(x + scale / 2, y + scale, x - scale / 2, y + scale * 3, FG_COLOR);
 }
 
 void addfog(DrawContext ctx)
 {
     for (int i = 0; i < 3; i++) {
-        display.fillRect(ctx.x - ctx.scale * 2, ctx.y - ctx.scale + i * ctx.scale, ctx.scale * 4, ctx.lineSize, FG_COLOR);
+        ctx.gfx->fillRect(ctx.x - ctx.scale * 2, ctx.y - ctx.scale + i * ctx.scale, ctx.scale * 4, ctx.lineSize, FG_COLOR);
     }
 }
 
@@ -314,9 +356,9 @@ void haze(DrawContext ctx)
 void no_data(DrawContext ctx)
 {
     // Font references removed to avoid conflicts
-    display.setTextColor(FG_COLOR);
-    display.setCursor(ctx.x - 10, ctx.y + 5);
-    display.print("?");
+    ctx.gfx->setTextColor(FG_COLOR);
+    ctx.gfx->setCursor(ctx.x - 10, ctx.y + 5);
+    ctx.gfx->print("?");
 }
 
 Bounds draw_string(int x, int y, String text, int alignment)
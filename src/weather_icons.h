@@ -1,180 +1,41 @@
 #pragma once
 
-// Weather Icons - 64x64 (larger version of the main weather icon)
-// Icon: 01d (sun) - 64x64
-const unsigned char sun_64x64_bits[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xE0,
-    0x03, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8,
-    0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xF0,
-    0x03, 0xFF, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xC0,
-    0x00, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00, 0x1F, 0xFC, 0x00,
-    0x00, 0x0F, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// Weather Icons - 32x32
-// Icon: 01d (sun)
-const unsigned char sun_32x32_bits[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x00, 0x00, 0x7E, 0xFF, 0x00,
-    0x00, 0xFF, 0xFF, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x18, 0xFF, 0xFF, 0x18,
-    0x3C, 0xFF, 0xFF, 0x3C, 0x7E, 0xDF, 0xFB, 0x7E, 0x7E, 0xDF, 0xFB, 0x7E,
-    0x3C, 0xFF, 0xFF, 0x3C, 0x18, 0xFF, 0xFF, 0x18, 0x06, 0xFF, 0xFF, 0x60,
-    0x00, 0xFF, 0xFF, 0x00, 0x00, 0x7E, 0xFF, 0x00, 0x00, 0x18, 0x3C, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// Icon: 02d, 03d, 04d (cloud)
-const unsigned char cloud_32x32_bits[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7E, 0x00,
-    0x03, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8,
-    0x3F, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// Icon: 09d, 10d (rain)
-const unsigned char rain_32x32_bits[] = {
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x7E, 0x00, 0x03, 0xFF, 0xFF, 0x80,
-    0x0F, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF, 0xFC,
-    0x7F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// Weather Icons - 16x16
-// Icon: 01d (sun)
-const unsigned char sun_16x16_bits[] = {
-    0x00, 0x00, 0x18, 0x18, 0x3C, 0x3C, 0x7E, 0x7E, 0x7E, 0x7E, 0x3C, 0x3C,
-    0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// Icon: 02d, 03d, 04d (cloud)
-const unsigned char cloud_16x16_bits[] = {
-    0x00, 0x00, 0x0E, 0x7C, 0x3F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// Icon: 09d, 10d (rain)
-const unsigned char rain_16x16_bits[] = {
-    0x0E, 0x7C, 0x3F, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0x0C, 0x60, 0x0C, 0x60,
-    0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-// Weather Icons - 64x64
-struct WeatherIconLarge {
-    const char* code;
-    const unsigned char* data;
-};
-
-const WeatherIconLarge large_weather_icons_64x64[] = {
-    {"01d", sun_64x64_bits},
-    {"01n", sun_64x64_bits}, // Assuming sun for night clear sky for simplicity
-    {"02d", sun_64x64_bits}, // Use sun for now since we don't have a 64x64 cloud
-    {"02n", sun_64x64_bits},
-    {"03d", sun_64x64_bits},
-    {"03n", sun_64x64_bits},
-    {"04d", sun_64x64_bits},
-    {"04n", sun_64x64_bits},
-    {"09d", sun_64x64_bits}, // Use sun for now since we don't have a 64x64 rain
-    {"09n", sun_64x64_bits},
-    {"10d", sun_64x64_bits},
-    {"10n", sun_64x64_bits}
-    // Add other icons as needed
-};
-
-struct WeatherIcon {
-    const char* code;
-    const unsigned char* data;
-};
-
-const WeatherIcon large_weather_icons[] = {
-    {"01d", sun_32x32_bits},
-    {"01n", sun_32x32_bits}, // Assuming sun for night clear sky for simplicity
-    {"02d", cloud_32x32_bits},
-    {"02n", cloud_32x32_bits},
-    {"03d", cloud_32x32_bits},
-    {"03n", cloud_32x32_bits},
-    {"04d", cloud_32x32_bits},
-    {"04n", cloud_32x32_bits},
-    {"09d", rain_32x32_bits},
-    {"09n", rain_32x32_bits},
-    {"10d", rain_32x32_bits},
-    {"10n", rain_32x32_bits}
-    // Add other icons as needed
-};
-
-const WeatherIcon small_weather_icons[] = {
-    {"01d", sun_16x16_bits},
-    {"01n", sun_16x16_bits},
-    {"02d", cloud_16x16_bits},
-    {"02n", cloud_16x16_bits},
-    {"03d", cloud_16x16_bits},
-    {"03n", cloud_16x16_bits},
-    {"04d", cloud_16x16_bits},
-    {"04n", cloud_16x16_bits},
-    {"09d", rain_16x16_bits},
-    {"09n", rain_16x16_bits},
-    {"10d", rain_16x16_bits},
-    {"10n", rain_16x16_bits}
-    // Add other icons as needed
-};
-
-// Function to get weather icon by code and size
+#include "wx_icon.h"
+#include "wx_icon_bitmaps.h"
+
+// Weather icon bitmaps by OpenWeatherMap code: 16x16, 32x32 and 64x64,
+// rows MSB first with set bits as ink, ready for drawBitmap(). The bitmaps
+// are rendered from the vector icons by tools/wx_icon_bitmaps.cpp.
+//
+// Codes are looked up through the perfect hash in wx_icon.h instead of a
+// strcmp() scan. A code that is not an OpenWeatherMap icon gets nullptr,
+// not the sun, so bad data shows as a missing icon.
+
+constexpr bool weatherIconsComplete(const WxIconBitmaps& bitmaps)
+{
+    return bitmaps.bits16 != nullptr && bitmaps.bits32 != nullptr && bitmaps.bits64 != nullptr;
+}
+
+// Every kind has day and night bitmaps in all three sizes
+constexpr bool weatherIconsComplete(uint8_t kind = WX_ICON_UNKNOWN + 1)
+{
+    return kind >= WX_ICON_KINDS
+        || (weatherIconsComplete(WX_ICON_BITMAPS[kind][0]) && weatherIconsComplete(WX_ICON_BITMAPS[kind][1])
+            && weatherIconsComplete(kind + 1));
+}
+
+static_assert(weatherIconsComplete(), "an icon kind is missing a bitmap, rerun tools/wx_icon_bitmaps.cpp");
+
+// Function to get weather icon by parsed code (wxIconParse()) and size:
+// 64x64 if extraLarge, else 32x32 if large, else 16x16
+const unsigned char* getWeatherIcon(uint8_t icon, bool large, bool extraLarge = false) {
+    const WxIconBitmaps& bitmaps = WX_ICON_BITMAPS[wxIconKind(icon)][wxIconNight(icon)];
+    if (extraLarge)
+        return bitmaps.bits64;
+    return large ? bitmaps.bits32 : bitmaps.bits16;
+}
+
+// Function to get weather icon by code ("04d") and size
 const unsigned char* getWeatherIcon(const String& iconCode, bool large, bool extraLarge = false) {
-    // Skip 64x64 icons as they're not properly defined; use 32x32 for "extra large" too
-    if (extraLarge || large) {
-        int count = sizeof(large_weather_icons) / sizeof(large_weather_icons[0]);
-        for (int i = 0; i < count; i++) {
-            if (strcmp(large_weather_icons[i].code, iconCode.c_str()) == 0) {
-                return large_weather_icons[i].data;
-            }
-        }
-        return sun_32x32_bits; // default to sun
-    } else {
-        int count = sizeof(small_weather_icons) / sizeof(small_weather_icons[0]);
-        for (int i = 0; i < count; i++) {
-            if (strcmp(small_weather_icons[i].code, iconCode.c_str()) == 0) {
-                return small_weather_icons[i].data;
-            }
-        }
-        return sun_16x16_bits; // default to sun
-    }
-}
\ No newline at end of file
+    return getWeatherIcon(wxIconParse(iconCode.c_str()), large, extraLarge);
+}
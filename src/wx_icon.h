@@ -0,0 +1,169 @@
+#ifndef WX_ICON_H_
+#define WX_ICON_H_
+
+#include <Arduino.h>
+
+// Weather icon kinds for OpenWeatherMap icon codes ("04d", "10n").
+//
+// A code is parsed once, where the weather data arrives, into one byte:
+// the kind, or-ed with WX_ICON_NIGHT for the "n" codes. Drawing switches on
+// that byte instead of comparing strings, and the icon cache keys its
+// sprites by it. Zero is WX_ICON_UNKNOWN, so a cleared record draws "?".
+//
+// Parsing is one lookup in a perfect hash of the 18 codes: the three
+// characters as a 24-bit key, times a multiplier, top WX_ICON_HASH_BITS
+// bits. The multiplier is searched for and the slot table filled by the
+// compiler; static_asserts below fail the build if a kind is missing a day
+// or night code or if no collision-free multiplier is found.
+
+#define WX_ICON_NIGHT 0x80 // Or-ed into the kind for night codes
+#define WX_ICON_KIND_MASK 0x7F
+#define WX_ICON_HASH_BITS 6 // 64 slots for 18 codes
+
+typedef enum {
+    WX_ICON_UNKNOWN, // Missing or unrecognized code
+    WX_ICON_CLEAR, // 01
+    WX_ICON_FEW_CLOUDS, // 02
+    WX_ICON_CLOUDS, // 03
+    WX_ICON_HEAVY_CLOUDS, // 04
+    WX_ICON_SHOWER_RAIN, // 09
+    WX_ICON_RAIN, // 10
+    WX_ICON_THUNDERSTORM, // 11
+    WX_ICON_SNOW, // 13
+    WX_ICON_MIST, // 50
+    WX_ICON_KINDS
+} WxIcon;
+
+typedef struct {
+    char code[4];
+    uint8_t icon;
+} WxIconCode;
+
+// Every OpenWeatherMap icon code
+constexpr WxIconCode WX_ICON_CODES[] = {
+    { "01d", WX_ICON_CLEAR },
+    { "01n", WX_ICON_CLEAR | WX_ICON_NIGHT },
+    { "02d", WX_ICON_FEW_CLOUDS },
+    { "02n", WX_ICON_FEW_CLOUDS | WX_ICON_NIGHT },
+    { "03d", WX_ICON_CLOUDS },
+    { "03n", WX_ICON_CLOUDS | WX_ICON_NIGHT },
+    { "04d", WX_ICON_HEAVY_CLOUDS },
+    { "04n", WX_ICON_HEAVY_CLOUDS | WX_ICON_NIGHT },
+    { "09d", WX_ICON_SHOWER_RAIN },
+    { "09n", WX_ICON_SHOWER_RAIN | WX_ICON_NIGHT },
+    { "10d", WX_ICON_RAIN },
+    { "10n", WX_ICON_RAIN | WX_ICON_NIGHT },
+    { "11d", WX_ICON_THUNDERSTORM },
+    { "11n", WX_ICON_THUNDERSTORM | WX_ICON_NIGHT },
+    { "13d", WX_ICON_SNOW },
+    { "13n", WX_ICON_SNOW | WX_ICON_NIGHT },
+    { "50d", WX_ICON_MIST },
+    { "50n", WX_ICON_MIST | WX_ICON_NIGHT },
+};
+
+#define WX_ICON_CODE_COUNT (sizeof(WX_ICON_CODES) / sizeof(WX_ICON_CODES[0]))
+
+// Compile-time helpers; single-return constexpr, the device compiler is C++11
+
+constexpr uint32_t wxIconKey(char c0, char c1, char c2)
+{
+    return (uint32_t)(uint8_t)c0 | (uint32_t)(uint8_t)c1 << 8 | (uint32_t)(uint8_t)c2 << 16;
+}
+
+constexpr uint32_t wxIconKey(const WxIconCode& code)
+{
+    return wxIconKey(code.code[0], code.code[1], code.code[2]);
+}
+
+constexpr uint8_t wxIconHash(uint32_t key, uint32_t multiplier)
+{
+    return (uint32_t)(key * multiplier) >> (32 - WX_ICON_HASH_BITS);
+}
+
+// Whether code i shares a slot with code j or one after it
+constexpr bool wxIconCollides(uint32_t multiplier, size_t i, size_t j)
+{
+    return j < WX_ICON_CODE_COUNT
+        && (wxIconHash(wxIconKey(WX_ICON_CODES[i]), multiplier) == wxIconHash(wxIconKey(WX_ICON_CODES[j]), multiplier)
+            || wxIconCollides(multiplier, i, j + 1));
+}
+
+constexpr bool wxIconPerfect(uint32_t multiplier, size_t i = 0)
+{
+    return i >= WX_ICON_CODE_COUNT || (!wxIconCollides(multiplier, i, i + 1) && wxIconPerfect(multiplier, i + 1));
+}
+
+// First odd multiplier from the golden ratio on that gives no collisions;
+// 0 when none is found within tries
+constexpr uint32_t wxIconFindMultiplier(uint32_t multiplier = 2654435761u, uint16_t tries = 256)
+{
+    return tries == 0 ? 0 : wxIconPerfect(multiplier) ? multiplier : wxIconFindMultiplier(multiplier + 2, tries - 1);
+}
+
+constexpr uint32_t WX_ICON_HASH_MULTIPLIER = wxIconFindMultiplier();
+static_assert(WX_ICON_HASH_MULTIPLIER != 0, "no perfect hash multiplier for the icon codes, raise WX_ICON_HASH_BITS");
+
+// Index + 1 of the code hashing to slot, 0 for an empty slot
+constexpr uint8_t wxIconSlot(uint8_t slot, size_t i = 0)
+{
+    return i >= WX_ICON_CODE_COUNT ? 0
+        : wxIconHash(wxIconKey(WX_ICON_CODES[i]), WX_ICON_HASH_MULTIPLIER) == slot ? i + 1
+                                                                                     : wxIconSlot(slot, i + 1);
+}
+
+// Whether icon, night bit included, has a code from index i on
+constexpr bool wxIconListed(uint8_t icon, size_t i = 0)
+{
+    return i < WX_ICON_CODE_COUNT && (WX_ICON_CODES[i].icon == icon || wxIconListed(icon, i + 1));
+}
+
+constexpr bool wxIconAllListed(uint8_t kind = WX_ICON_UNKNOWN + 1)
+{
+    return kind >= WX_ICON_KINDS
+        || (wxIconListed(kind) && wxIconListed(kind | WX_ICON_NIGHT) && wxIconAllListed(kind + 1));
+}
+
+static_assert(wxIconAllListed(), "every icon kind needs a day and a night code in WX_ICON_CODES");
+static_assert(WX_ICON_CODE_COUNT == 2 * (WX_ICON_KINDS - 1), "WX_ICON_CODES lists a code twice or one that has no kind");
+
+#define WX_ICON_SLOTS4(s) wxIconSlot(s), wxIconSlot(s + 1), wxIconSlot(s + 2), wxIconSlot(s + 3)
+#define WX_ICON_SLOTS16(s) WX_ICON_SLOTS4(s), WX_ICON_SLOTS4(s + 4), WX_ICON_SLOTS4(s + 8), WX_ICON_SLOTS4(s + 12)
+
+// Slot -> index + 1 into WX_ICON_CODES
+constexpr uint8_t WX_ICON_HASH_TABLE[1 << WX_ICON_HASH_BITS] = { WX_ICON_SLOTS16(0), WX_ICON_SLOTS16(16), WX_ICON_SLOTS16(32),
+    WX_ICON_SLOTS16(48) };
+
+#undef WX_ICON_SLOTS16
+#undef WX_ICON_SLOTS4
+
+// Function declarations
+uint8_t wxIconParse(const char* code);
+WxIcon wxIconKind(uint8_t icon);
+bool wxIconNight(uint8_t icon);
+
+// Implementation
+
+// "04n" -> WX_ICON_HEAVY_CLOUDS | WX_ICON_NIGHT; WX_ICON_UNKNOWN for
+// anything that does not start with a known code
+uint8_t wxIconParse(const char* code)
+{
+    if (!code || !code[0] || !code[1] || !code[2])
+        return WX_ICON_UNKNOWN;
+    uint8_t entry = WX_ICON_HASH_TABLE[wxIconHash(wxIconKey(code[0], code[1], code[2]), WX_ICON_HASH_MULTIPLIER)];
+    if (!entry || memcmp(WX_ICON_CODES[entry - 1].code, code, 3) != 0)
+        return WX_ICON_UNKNOWN;
+    return WX_ICON_CODES[entry - 1].icon;
+}
+
+WxIcon wxIconKind(uint8_t icon)
+{
+    uint8_t kind = icon & WX_ICON_KIND_MASK;
+    return kind < WX_ICON_KINDS ? (WxIcon)kind : WX_ICON_UNKNOWN;
+}
+
+bool wxIconNight(uint8_t icon)
+{
+    return icon & WX_ICON_NIGHT;
+}
+
+#endif // WX_ICON_H_
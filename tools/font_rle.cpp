@@ -0,0 +1,291 @@
+// Host tool: converts an Adafruit GFXfont header into the run-length
+// compressed format of src/rle_font.h.
+//
+// Each glyph is stored as raw bits, nibble runs, or nibble runs of each
+// row XORed with the one above, whichever is shortest, and glyphs with
+// identical bitmaps share their data (the Times Cyrillic fonts draw А, В,
+// Е, К, М, Н, О, Р, С, Т, Х and several lower-case letters exactly like the
+// Latin ones). The output keeps the GFXfont's name with an "Rle" suffix,
+// e.g. TimesNRCyr12pt8b -> TimesNRCyr12pt8bRle.
+//
+// Build and run from the repository root:
+//   g++ -O2 -std=gnu++17 tools/font_rle.cpp -o font_rle
+//   ./font_rle src/fonts/TimesNRCyr12.h -o src/fonts/rle/TimesNRCyr12.h
+//   for f in src/fonts/*.h; do ./font_rle "$f" -o "src/fonts/rle/${f##*/}"; done
+//
+// Without -o the header goes to stdout. The size summary goes to stderr.
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Glyph {
+    int offset, width, height, xAdvance, xOffset, yOffset;
+};
+
+struct Font {
+    std::string name;
+    std::vector<uint8_t> bitmap;
+    std::vector<Glyph> glyphs;
+    int first = 0, last = 0, yAdvance = 0;
+};
+
+bool readFile(const char* path, std::string& text)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        text.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+// Comments in GFXfont headers name the glyph ("// 0x7D '}'") and would
+// confuse the brace matching below
+std::string stripComments(const std::string& text)
+{
+    std::string out;
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text.compare(i, 2, "//") == 0) {
+            while (i < text.size() && text[i] != '\n')
+                i++;
+        } else if (text.compare(i, 2, "/*") == 0) {
+            size_t end = text.find("*/", i + 2);
+            i = end == std::string::npos ? text.size() : end + 1;
+            continue;
+        }
+        if (i < text.size())
+            out += text[i];
+    }
+    return out;
+}
+
+// Integers between the '{' after `marker` and its matching '}'
+bool readNumbers(const std::string& text, const char* marker, std::vector<long>& numbers)
+{
+    size_t pos = text.find(marker);
+    if (pos == std::string::npos)
+        return false;
+    pos = text.find('{', pos);
+    if (pos == std::string::npos)
+        return false;
+    int depth = 0;
+    for (size_t i = pos; i < text.size(); i++) {
+        char c = text[i];
+        if (c == '{') {
+            depth++;
+        } else if (c == '}') {
+            if (--depth == 0)
+                return true;
+        } else if (isdigit((unsigned char)c) || (c == '-' && i + 1 < text.size() && isdigit((unsigned char)text[i + 1]))) {
+            char* end;
+            numbers.push_back(strtol(&text[i], &end, 0));
+            i = end - &text[0] - 1;
+        } else if (isalpha((unsigned char)c) || c == '_') {
+            while (i + 1 < text.size() && (isalnum((unsigned char)text[i + 1]) || text[i + 1] == '_'))
+                i++; // Skip identifiers such as casts
+        }
+    }
+    return false;
+}
+
+bool parseFont(const std::string& source, Font& font)
+{
+    std::string text = stripComments(source);
+    size_t pos = text.find("GFXfont ");
+    if (pos == std::string::npos)
+        return false;
+    pos += strlen("GFXfont ");
+    size_t end = pos;
+    while (end < text.size() && (isalnum((unsigned char)text[end]) || text[end] == '_'))
+        end++;
+    font.name = text.substr(pos, end - pos);
+
+    std::vector<long> bitmap, glyphs, header;
+    if (!readNumbers(text, "Bitmaps[]", bitmap) || !readNumbers(text, "Glyphs[]", glyphs)
+        || !readNumbers(text.substr(end), "=", header) || glyphs.size() % 6 != 0 || header.size() < 3)
+        return false;
+    for (long b : bitmap)
+        font.bitmap.push_back((uint8_t)b);
+    for (size_t i = 0; i < glyphs.size(); i += 6)
+        font.glyphs.push_back({ (int)glyphs[i], (int)glyphs[i + 1], (int)glyphs[i + 2], (int)glyphs[i + 3], (int)glyphs[i + 4],
+            (int)glyphs[i + 5] });
+    font.first = header[header.size() - 3];
+    font.last = header[header.size() - 2];
+    font.yAdvance = header[header.size() - 1];
+    return (int)font.glyphs.size() == font.last - font.first + 1;
+}
+
+bool bitAt(const Font& font, const Glyph& g, int bit)
+{
+    size_t byte = g.offset + bit / 8;
+    return byte < font.bitmap.size() && (font.bitmap[byte] & (0x80 >> (bit & 7)));
+}
+
+std::vector<uint8_t> rawBits(const Font& font, const Glyph& g)
+{
+    int total = g.width * g.height;
+    std::vector<uint8_t> out((total + 7) / 8, 0);
+    for (int bit = 0; bit < total; bit++) {
+        if (bitAt(font, g, bit))
+            out[bit / 8] |= 0x80 >> (bit & 7);
+    }
+    return out;
+}
+
+// Pixels row after row; with rowDelta each row XORed with the one above
+std::vector<bool> pixels(const Font& font, const Glyph& g, bool rowDelta)
+{
+    std::vector<bool> out(g.width * g.height);
+    for (int bit = 0; bit < g.width * g.height; bit++) {
+        out[bit] = bitAt(font, g, bit);
+        if (rowDelta && bit >= g.width)
+            out[bit] = out[bit] != bitAt(font, g, bit - g.width);
+    }
+    return out;
+}
+
+std::vector<uint8_t> runNibbles(const std::vector<bool>& pixels)
+{
+    std::vector<uint8_t> nibbles;
+    int total = pixels.size();
+    bool set = false;
+    for (int bit = 0; bit < total;) {
+        int run = 0;
+        while (bit < total && pixels[bit] == set) {
+            run++;
+            bit++;
+        }
+        while (run >= 15) {
+            nibbles.push_back(15);
+            run -= 15;
+        }
+        nibbles.push_back(run);
+        set = !set;
+    }
+    std::vector<uint8_t> out((nibbles.size() + 1) / 2, 0);
+    for (size_t i = 0; i < nibbles.size(); i++)
+        out[i / 2] |= (i & 1) ? nibbles[i] : nibbles[i] << 4;
+    return out;
+}
+
+std::string glyphLabel(int code)
+{
+    char label[16];
+    if (code >= 0x20 && code < 0x7F && code != '\\')
+        snprintf(label, sizeof(label), "0x%02X '%c'", code, code);
+    else
+        snprintf(label, sizeof(label), "0x%02X", code);
+    return label;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* input = nullptr;
+    const char* output = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            output = argv[++i];
+        else if (argv[i][0] != '-' && !input)
+            input = argv[i];
+        else {
+            fprintf(stderr, "usage: %s font.h [-o out.h]\n", argv[0]);
+            return 2;
+        }
+    }
+    std::string source;
+    if (!input || !readFile(input, source)) {
+        fprintf(stderr, "cannot read %s\n", input ? input : "(no input)");
+        return 2;
+    }
+    Font font;
+    if (!parseFont(source, font)) {
+        fprintf(stderr, "%s: not a GFXfont header\n", input);
+        return 1;
+    }
+
+    // Encode, sharing identical bitmaps
+    std::vector<uint8_t> data;
+    std::vector<std::pair<int, int>> placed; // offset, encoding per glyph
+    std::map<std::vector<uint8_t>, std::pair<int, int>> seen; // key: size + raw bits
+    int shared = 0;
+    for (const Glyph& g : font.glyphs) {
+        std::vector<uint8_t> raw = rawBits(font, g);
+        std::vector<uint8_t> key = raw;
+        key.insert(key.begin(), { (uint8_t)g.width, (uint8_t)g.height });
+        auto it = seen.find(key);
+        if (it != seen.end() && !raw.empty()) {
+            placed.push_back(it->second);
+            shared++;
+            continue;
+        }
+        // Smallest of raw bits, runs and runs of the row deltas
+        std::vector<uint8_t> chosen = raw;
+        int encoding = 0;
+        for (int candidate = 1; candidate <= 2; candidate++) {
+            std::vector<uint8_t> runs = runNibbles(pixels(font, g, candidate == 2));
+            if (runs.size() < chosen.size()) {
+                chosen = runs;
+                encoding = candidate;
+            }
+        }
+        std::pair<int, int> where((int)data.size(), encoding);
+        data.insert(data.end(), chosen.begin(), chosen.end());
+        placed.push_back(where);
+        seen[key] = where;
+    }
+    if (data.size() > 0xFFFF) {
+        fprintf(stderr, "%s: %zu bytes of glyph data do not fit 16-bit offsets\n", input, data.size());
+        return 1;
+    }
+
+    FILE* out = output ? fopen(output, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", output);
+        return 2;
+    }
+    std::string name = font.name + "Rle";
+    std::string guard;
+    for (char c : name)
+        guard += toupper((unsigned char)c);
+    guard += "_H_";
+    const char* base = strrchr(input, '/') ? strrchr(input, '/') + 1 : input;
+    fprintf(out, "// Generated by tools/font_rle.cpp from src/fonts/%s, do not edit.\n", base);
+    fprintf(out, "// %zu glyphs (%d sharing another's bitmap), %zu bytes of bitmap data (GFXfont: %zu)\n", font.glyphs.size(), shared,
+        data.size(), font.bitmap.size());
+    fprintf(out, "#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+    fprintf(out, "const uint8_t %sData[] PROGMEM = {", name.c_str());
+    for (size_t i = 0; i < data.size(); i++)
+        fprintf(out, "%s0x%02X%s", i % 12 == 0 ? "\n  " : " ", data[i], i + 1 < data.size() ? "," : "");
+    fprintf(out, " };\n\n");
+    fprintf(out, "const RleGlyph %sGlyphs[] PROGMEM = {\n", name.c_str());
+    for (size_t i = 0; i < font.glyphs.size(); i++) {
+        const Glyph& g = font.glyphs[i];
+        fprintf(out, "  { %5d, %3d, %3d, %3d, %4d, %4d, %d }%s // %s\n", placed[i].first, g.width, g.height, g.xAdvance, g.xOffset,
+            g.yOffset, placed[i].second, i + 1 < font.glyphs.size() ? ", " : "  ", glyphLabel(font.first + (int)i).c_str());
+    }
+    fprintf(out, "};\n\n");
+    fprintf(out, "const RleFont %s PROGMEM = {\n  %sData,\n  %sGlyphs,\n  0x%02X, 0x%02X, %d };\n\n", name.c_str(), name.c_str(),
+        name.c_str(), font.first, font.last, font.yAdvance);
+    fprintf(out, "#endif // %s\n", guard.c_str());
+    if (output)
+        fclose(out);
+
+    // Both glyph structs take 8 bytes with padding
+    size_t before = font.bitmap.size() + font.glyphs.size() * 8;
+    size_t after = data.size() + font.glyphs.size() * 8;
+    fprintf(stderr, "%-22s %6zu -> %6zu bytes (%.0f%%), %d shared glyphs\n", font.name.c_str(), before, after,
+        before ? 100.0 * after / before : 0.0, shared);
+    return 0;
+}
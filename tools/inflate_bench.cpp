@@ -0,0 +1,196 @@
+// Host benchmark: is gzip on the render API a net win for the device?
+//
+// Compresses sample frames the way the server does (gzip, level 9), then
+// decodes them through the firmware's InflateStream in 1460-byte pieces
+// (one TCP segment each, as HttpFetch delivers them). The measured inflate
+// rate is scaled down to an ESP32-S3 and set against a range of WiFi
+// throughputs to compare the transfer time of identity vs. gzip.
+//
+// Build and run from the repository root:
+//   g++ -O2 -std=gnu++17 -Isrc tools/inflate_bench.cpp -lz -o inflate_bench
+//   ./inflate_bench [--cpu-scale N] [frame files...]
+//
+// Without arguments a synthetic 800x480 dashboard is used, both as BWR and
+// as a 24-bit BMP. Pass real /render outputs for representative numbers.
+// --cpu-scale is how many times slower the device inflates than this host
+// (default 15; measure once on hardware with the "ms spent in inflate" log).
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "inflate_stream.h"
+
+namespace {
+
+struct Sample {
+    std::string name;
+    std::vector<uint8_t> data;
+};
+
+// Dashboard-like BWR frame: text lines, a red heading, boxes and rules
+std::vector<uint8_t> syntheticBwr()
+{
+    const int width = 800, height = 480, stride = width / 8, plane = stride * height;
+    std::vector<uint8_t> bwr(plane * 2, 0xFF);
+    uint8_t* black = bwr.data();
+    uint8_t* red = bwr.data() + plane;
+    auto set = [&](uint8_t* p, int x, int y) { p[y * stride + x / 8] &= ~(0x80 >> (x % 8)); };
+
+    srand(1);
+    for (int x = 20; x < 780; x++)
+        for (int y = 20; y < 24; y++)
+            set(black, x, y);
+    for (int line = 0; line < 16; line++) {
+        int top = 40 + line * 26;
+        uint8_t* p = line == 0 ? red : black;
+        for (int cell = 0; cell < 60; cell++) {
+            if (rand() % 7 == 0)
+                continue; // word gap
+            for (int y = top; y < top + 16; y++)
+                for (int x = 20 + cell * 12; x < 30 + cell * 12; x++)
+                    if (rand() % 100 < 35)
+                        set(p, x, y);
+        }
+    }
+    for (int y = 300; y < 460; y++)
+        for (int x = 560; x < 780; x++)
+            if (y < 304 || y > 455 || x < 564 || x > 775)
+                set(black, x, y);
+    return bwr;
+}
+
+// Same picture as a bottom-up 24-bit BMP, as /render?format=bmp sends it
+std::vector<uint8_t> syntheticBmp(const std::vector<uint8_t>& bwr)
+{
+    const int width = 800, height = 480, stride = width / 8, plane = stride * height;
+    const int rowSize = (width * 3 + 3) & ~3;
+    std::vector<uint8_t> bmp(54 + rowSize * height, 0);
+    auto put32 = [&](int off, uint32_t v) { memcpy(&bmp[off], &v, 4); };
+    bmp[0] = 'B';
+    bmp[1] = 'M';
+    put32(2, bmp.size());
+    put32(10, 54);
+    put32(14, 40);
+    put32(18, width);
+    put32(22, height);
+    bmp[26] = 1;
+    bmp[28] = 24;
+    for (int y = 0; y < height; y++) {
+        uint8_t* row = &bmp[54 + (height - 1 - y) * rowSize];
+        for (int x = 0; x < width; x++) {
+            uint8_t bit = 0x80 >> (x % 8);
+            bool isRed = !(bwr[plane + y * stride + x / 8] & bit);
+            bool isBlack = !(bwr[y * stride + x / 8] & bit);
+            row[x * 3 + 0] = isRed || isBlack ? 0 : 255;
+            row[x * 3 + 1] = isRed || isBlack ? 0 : 255;
+            row[x * 3 + 2] = isBlack ? 0 : 255;
+        }
+    }
+    return bmp;
+}
+
+std::vector<uint8_t> gzip(const std::vector<uint8_t>& in)
+{
+    z_stream zs;
+    memset(&zs, 0, sizeof(zs));
+    deflateInit2(&zs, 9, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    std::vector<uint8_t> out(deflateBound(&zs, in.size()) + 32);
+    zs.next_in = (Bytef*)in.data();
+    zs.avail_in = in.size();
+    zs.next_out = out.data();
+    zs.avail_out = out.size();
+    deflate(&zs, Z_FINISH);
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+    return out;
+}
+
+bool countingSink(const uint8_t* data, size_t len, void* context)
+{
+    (void)data;
+    *(size_t*)context += len;
+    return true;
+}
+
+bool readFile(const char* path, std::vector<uint8_t>& data)
+{
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return false;
+    fseek(f, 0, SEEK_END);
+    data.resize(ftell(f));
+    fseek(f, 0, SEEK_SET);
+    bool ok = fread(data.data(), 1, data.size(), f) == data.size();
+    fclose(f);
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    double cpuScale = 15.0;
+    std::vector<Sample> samples;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--cpu-scale") && i + 1 < argc) {
+            cpuScale = atof(argv[++i]);
+            continue;
+        }
+        Sample s { argv[i], {} };
+        if (!readFile(argv[i], s.data)) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+        samples.push_back(s);
+    }
+    if (samples.empty()) {
+        std::vector<uint8_t> bwr = syntheticBwr();
+        samples.push_back({ "synthetic.bwr", bwr });
+        samples.push_back({ "synthetic.bmp", syntheticBmp(bwr) });
+    }
+
+    const double wifiKBps[] = { 50, 100, 250, 500, 1000 };
+    const size_t segment = 1460;
+
+    for (const Sample& s : samples) {
+        std::vector<uint8_t> gz = gzip(s.data);
+
+        // Decode repeatedly for a stable per-byte cost
+        size_t produced = 0;
+        uint32_t micros = 0;
+        int runs = 0;
+        while (micros < 500000 || runs < 5) {
+            InflateStream inflater;
+            inflater.begin(InflateStream::ENCODING_GZIP, countingSink, &produced);
+            for (size_t off = 0; off < gz.size(); off += segment)
+                inflater.write(gz.data() + off, std::min(segment, gz.size() - off));
+            if (inflater.end() != InflateStream::OK) {
+                fprintf(stderr, "%s: inflate failed\n", s.name.c_str());
+                return 1;
+            }
+            micros += inflater.inflateMicros();
+            runs++;
+        }
+        if (produced != s.data.size() * runs) {
+            fprintf(stderr, "%s: size mismatch\n", s.name.c_str());
+            return 1;
+        }
+
+        double hostMs = micros / 1000.0 / runs;
+        double deviceMs = hostMs * cpuScale;
+        double hostMBps = s.data.size() / 1048576.0 / (hostMs / 1000.0);
+        printf("%s: %zu -> %zu bytes gzip (%.1f%%), host inflate %.2f ms (%.0f MB/s), est. device %.1f ms\n",
+            s.name.c_str(), s.data.size(), gz.size(), 100.0 * gz.size() / s.data.size(), hostMs, hostMBps, deviceMs);
+        printf("  %10s %14s %14s %8s\n", "WiFi KB/s", "identity ms", "gzip ms", "gain");
+        for (double kbps : wifiKBps) {
+            double identityMs = s.data.size() / 1024.0 / kbps * 1000.0;
+            // Inflate runs between packet reads, so it adds to the transfer time
+            double gzipMs = gz.size() / 1024.0 / kbps * 1000.0 + deviceMs;
+            printf("  %10.0f %14.0f %14.0f %7.1fx\n", kbps, identityMs, gzipMs, identityMs / gzipMs);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,199 @@
+// Host tool: where does a panel update spend its time, and what would a
+// faster SPI clock or batched transfers buy?
+//
+// Reads the "SPITRACE" lines printed by the spitrace firmware build
+// (src/spi_trace.h) from a captured serial log and splits every phase into
+//   wire   bytes * 8 / clock, the time the bits are actually on the bus
+//   call   the per-byte overhead of SPIClass::transfer(uint8_t) on top
+//   busy   the panel holding BUSY (waveform, booster), fixed by the glass
+//   other  firmware work between transfers (decoding, SPIFFS, GFX)
+// and predicts the phase times for other clocks, once with GxEPD2's
+// byte-at-a-time transfers and once with one bulk transfer per command
+// (bytes * 8 / clock + commands * --call-overhead).
+//
+// Build and run from the repository root:
+//   pio run -e freenove_esp32_s3_wroom_spitrace -t upload -t monitor | tee trace.log
+//   g++ -O2 -std=gnu++17 tools/panel_model.cpp -o panel_model
+//   ./panel_model [--clocks 2,4,8,10,16,20] [--call-overhead US] [trace.log]
+//
+// Without a file the log is read from stdin. --call-overhead is the cost of
+// starting one bulk transfer in µs (default 10: transaction, DC toggle and
+// the driver's FIFO setup on an S3 at 240 MHz).
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Command {
+    unsigned code = 0;
+    unsigned long count = 0;
+    unsigned long data = 0;
+    unsigned long spiUs = 0;
+};
+
+struct Phase {
+    std::string name;
+    unsigned long wallUs = 0;
+    unsigned long spiUs = 0;
+    unsigned long busyUs = 0;
+    unsigned long busyWaits = 0;
+    unsigned long bytes = 0;
+    unsigned long commands = 0;
+    unsigned long windows = 0;
+    unsigned long transactions = 0;
+    std::vector<Command> cmds;
+};
+
+struct Trace {
+    unsigned long clockHz = 0;
+    unsigned long cpuMhz = 0;
+    std::vector<Phase> phases;
+};
+
+Phase* findPhase(Trace& trace, const char* name)
+{
+    for (Phase& p : trace.phases) {
+        if (p.name == name)
+            return &p;
+    }
+    return nullptr;
+}
+
+// The last complete trace in the log wins (a log may span several wakes)
+bool parseTrace(FILE* in, Trace& trace)
+{
+    char line[512];
+    bool found = false;
+    while (fgets(line, sizeof(line), in)) {
+        const char* s = strstr(line, "SPITRACE ");
+        if (!s)
+            continue;
+        s += strlen("SPITRACE ");
+        char name[64];
+        unsigned long clock, cpu;
+        Phase p;
+        Command c;
+        if (sscanf(s, "clock %lu cpu_mhz %lu", &clock, &cpu) == 2) {
+            trace = Trace();
+            trace.clockHz = clock;
+            trace.cpuMhz = cpu;
+            found = true;
+        } else if (sscanf(s, "phase %63s wall_us %lu spi_us %lu busy_us %lu busy_waits %lu bytes %lu commands %lu windows %lu transactions %lu",
+                       name, &p.wallUs, &p.spiUs, &p.busyUs, &p.busyWaits, &p.bytes, &p.commands, &p.windows, &p.transactions)
+            == 9) {
+            p.name = name;
+            trace.phases.push_back(p);
+        } else if (sscanf(s, "cmd %63s 0x%x count %lu data %lu spi_us %lu", name, &c.code, &c.count, &c.data, &c.spiUs) == 5) {
+            Phase* phase = findPhase(trace, name);
+            if (phase)
+                phase->cmds.push_back(c);
+        }
+    }
+    return found && trace.clockHz > 0;
+}
+
+std::vector<double> parseClocks(const char* list)
+{
+    std::vector<double> clocks;
+    for (const char* s = list; *s;) {
+        char* end;
+        double mhz = strtod(s, &end);
+        if (end == s)
+            break;
+        if (mhz > 0)
+            clocks.push_back(mhz * 1e6);
+        s = *end == ',' ? end + 1 : end;
+    }
+    return clocks;
+}
+
+double wireUs(unsigned long bytes, double clockHz)
+{
+    return bytes * 8.0 * 1e6 / clockHz;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::vector<double> clocks = parseClocks("2,4,8,10,16,20");
+    double callOverheadUs = 10.0;
+    const char* path = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--clocks") && i + 1 < argc)
+            clocks = parseClocks(argv[++i]);
+        else if (!strcmp(argv[i], "--call-overhead") && i + 1 < argc)
+            callOverheadUs = atof(argv[++i]);
+        else if (argv[i][0] == '-') {
+            fprintf(stderr, "usage: %s [--clocks MHZ,...] [--call-overhead US] [trace.log]\n", argv[0]);
+            return 2;
+        } else
+            path = argv[i];
+    }
+
+    FILE* in = path ? fopen(path, "r") : stdin;
+    if (!in) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 2;
+    }
+    Trace trace;
+    bool ok = parseTrace(in, trace);
+    if (path)
+        fclose(in);
+    if (!ok) {
+        fprintf(stderr, "no SPITRACE lines found (flash env:freenove_esp32_s3_wroom_spitrace)\n");
+        return 1;
+    }
+
+    printf("Measured at %.1f MHz SPI, %lu MHz CPU\n\n", trace.clockHz / 1e6, trace.cpuMhz);
+    printf("%-14s %9s %9s %9s %9s %9s %8s %8s %7s\n", "phase", "wall ms", "wire ms", "call ms", "busy ms", "other ms", "bytes",
+        "commands", "windows");
+    double totalWall = 0;
+    for (const Phase& p : trace.phases) {
+        double wire = wireUs(p.bytes, trace.clockHz);
+        double call = p.spiUs > wire ? p.spiUs - wire : 0;
+        double other = (double)p.wallUs - p.spiUs - p.busyUs;
+        if (other < 0)
+            other = 0;
+        totalWall += p.wallUs;
+        printf("%-14s %9.1f %9.1f %9.1f %9.1f %9.1f %8lu %8lu %7lu\n", p.name.c_str(), p.wallUs / 1e3, wire / 1e3, call / 1e3,
+            p.busyUs / 1e3, other / 1e3, p.bytes, p.commands, p.windows);
+        for (const Command& c : p.cmds)
+            printf("    cmd 0x%02X x%-5lu %8lu data bytes %9.1f ms\n", c.code, c.count, c.data, c.spiUs / 1e3);
+    }
+    printf("%-14s %9.1f\n\n", "total", totalWall / 1e3);
+
+    // busy and other do not depend on the bus; only the SPI share scales
+    printf("Predicted update time (ms), per-byte transfer / bulk per command\n");
+    printf("%-14s", "phase");
+    for (double clock : clocks)
+        printf(" %7g MHz      ", clock / 1e6);
+    printf("\n");
+    std::vector<double> totalByte(clocks.size(), 0), totalBulk(clocks.size(), 0);
+    for (const Phase& p : trace.phases) {
+        double wire = wireUs(p.bytes, trace.clockHz);
+        double perByteCall = p.bytes && p.spiUs > wire ? (p.spiUs - wire) / p.bytes : 0;
+        double fixed = (double)p.wallUs - p.spiUs;
+        if (fixed < 0)
+            fixed = 0;
+        printf("%-14s", p.name.c_str());
+        for (size_t i = 0; i < clocks.size(); i++) {
+            double w = wireUs(p.bytes, clocks[i]);
+            double byteUs = fixed + w + p.bytes * perByteCall;
+            double bulkUs = fixed + w + p.commands * callOverheadUs;
+            totalByte[i] += byteUs;
+            totalBulk[i] += bulkUs;
+            printf(" %7.0f / %-7.0f", byteUs / 1e3, bulkUs / 1e3);
+        }
+        printf("\n");
+    }
+    printf("%-14s", "total");
+    for (size_t i = 0; i < clocks.size(); i++)
+        printf(" %7.0f / %-7.0f", totalByte[i] / 1e3, totalBulk[i] / 1e3);
+    printf("\n");
+    return 0;
+}
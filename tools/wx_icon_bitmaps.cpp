@@ -0,0 +1,210 @@
+// Host tool: renders the vector weather icons of src/weather_draw_functions.h
+// into the 16, 32 and 64 px bitmap sets of src/weather_icons.h.
+//
+// Every kind is drawn day and night through draw_wx_icon_scaled() against
+// the simulator's Adafruit GFX: 64 px at scale 6 with the large icons' line
+// weight, 32 px at scale 3 with the small one, and 16 px as the 32 px icon
+// halved, a pixel set if any of its four was. All icons of a size share one
+// center, placed so that their union is centered in the square, so icons
+// line up as the vector ones do. Identical bitmaps (the kinds without a sun
+// or moon) are written once.
+//
+// Build and run from the repository root:
+//   g++ -O2 -std=gnu++17 -Isim/include -Isrc -DSIM_NATIVE tools/wx_icon_bitmaps.cpp sim/src/arduino_sim.cpp
+//       sim/src/gfx_sim.cpp sim/src/panel_sim.cpp -o wx_icon_bitmaps
+//   ./wx_icon_bitmaps -o src/wx_icon_bitmaps.h
+//
+// Without -o the header goes to stdout. Fails when an icon does not fit its
+// square.
+
+#include <Arduino.h>
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "weather_draw_functions.h"
+#include "wx_icon.h"
+
+// weather_draw_functions.h refers to the sketch's display
+GxEPD2_3C<GxEPD2_750c_Z08, GxEPD2_750c_Z08::HEIGHT / 4> display(GxEPD2_750c_Z08(-1, -1, -1, -1));
+
+namespace {
+
+const char* const KIND_NAMES[WX_ICON_KINDS] = { "unknown", "clear", "few_clouds", "clouds", "heavy_clouds", "shower_rain",
+    "rain", "thunderstorm", "snow", "mist" };
+
+// Pixels of one icon drawn around (0, 0), clipped to +-REACH
+class Raster : public Adafruit_GFX {
+public:
+    static const int REACH = 64;
+
+    Raster()
+        : Adafruit_GFX(2 * REACH, 2 * REACH)
+        , pixels(4 * REACH * REACH, false)
+    {
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override
+    {
+        if (x >= 0 && y >= 0 && x < WIDTH && y < HEIGHT)
+            pixels[y * WIDTH + x] = color != BG_COLOR;
+    }
+
+    bool at(int x, int y) const
+    {
+        x += REACH;
+        y += REACH;
+        return x >= 0 && y >= 0 && x < WIDTH && y < HEIGHT && pixels[y * WIDTH + x];
+    }
+
+    std::vector<bool> pixels;
+};
+
+struct Box {
+    int left = 1 << 30, top = 1 << 30, right = -(1 << 30), bottom = -(1 << 30);
+
+    void add(int x, int y)
+    {
+        left = std::min(left, x);
+        top = std::min(top, y);
+        right = std::max(right, x + 1);
+        bottom = std::max(bottom, y + 1);
+    }
+};
+
+struct Size {
+    int pixels;
+    int scale; // 0 = halve the next larger size
+    bool iconSize;
+};
+
+const Size SIZES[] = { { 64, 6, LargeIcon }, { 32, 3, SmallIcon }, { 16, 0, SmallIcon } };
+
+Raster render(uint8_t icon, const Size& size)
+{
+    Raster raster;
+    draw_wx_icon_scaled(raster, Raster::REACH, Raster::REACH, icon, size.scale, size.iconSize);
+    return raster;
+}
+
+// Square bitmap, MSB first, set = ink, the union's center at the middle
+std::vector<uint8_t> pack(const Raster& raster, int pixels, int cx, int cy, bool halve)
+{
+    int stride = (pixels + 7) / 8;
+    std::vector<uint8_t> bits(stride * pixels, 0);
+    for (int y = 0; y < pixels; y++) {
+        for (int x = 0; x < pixels; x++) {
+            bool ink;
+            if (halve) {
+                int sx = 2 * (x - pixels / 2) + cx, sy = 2 * (y - pixels / 2) + cy;
+                ink = raster.at(sx, sy) || raster.at(sx + 1, sy) || raster.at(sx, sy + 1) || raster.at(sx + 1, sy + 1);
+            } else {
+                ink = raster.at(x - pixels / 2 + cx, y - pixels / 2 + cy);
+            }
+            if (ink)
+                bits[y * stride + x / 8] |= 0x80 >> (x & 7);
+        }
+    }
+    return bits;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* output = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            output = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [-o out.h]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // names[size][kind][night] -> array holding the bitmap
+    std::string names[3][WX_ICON_KINDS][2];
+    std::map<std::vector<uint8_t>, std::string> seen;
+    std::string arrays;
+    size_t bytes = 0, shared = 0;
+    for (int s = 0; s < 3; s++) {
+        const Size& size = SIZES[s];
+        const Size& drawn = size.scale ? size : SIZES[s - 1];
+        int reach = size.scale ? size.pixels : 2 * size.pixels;
+
+        // Union of all icons of the size, to center them as a set
+        Box all;
+        for (uint8_t kind = WX_ICON_UNKNOWN + 1; kind < WX_ICON_KINDS; kind++) {
+            for (uint8_t night = 0; night < 2; night++) {
+                Raster raster = render(kind | (night ? WX_ICON_NIGHT : 0), drawn);
+                for (int y = -Raster::REACH; y < Raster::REACH; y++)
+                    for (int x = -Raster::REACH; x < Raster::REACH; x++)
+                        if (raster.at(x, y))
+                            all.add(x, y);
+            }
+        }
+        if (all.right - all.left > reach || all.bottom - all.top > reach) {
+            fprintf(stderr, "%d px icons are %dx%d, they do not fit\n", size.pixels, all.right - all.left, all.bottom - all.top);
+            return 1;
+        }
+        int cx = (all.left + all.right) / 2, cy = (all.top + all.bottom) / 2;
+        if (!size.scale) {
+            cx &= ~1;
+            cy &= ~1;
+        }
+
+        for (uint8_t kind = WX_ICON_UNKNOWN + 1; kind < WX_ICON_KINDS; kind++) {
+            for (uint8_t night = 0; night < 2; night++) {
+                std::vector<uint8_t> bits = pack(render(kind | (night ? WX_ICON_NIGHT : 0), drawn), size.pixels, cx, cy, !size.scale);
+                std::vector<uint8_t> key = bits;
+                key.push_back((uint8_t)size.pixels);
+                auto it = seen.find(key);
+                if (it != seen.end()) {
+                    names[s][kind][night] = it->second;
+                    shared++;
+                    continue;
+                }
+                std::string name = std::string("wx_") + KIND_NAMES[kind] + (night ? "_night_" : "_day_") + std::to_string(size.pixels);
+                names[s][kind][night] = seen[key] = name;
+                char line[128];
+                snprintf(line, sizeof(line), "const uint8_t %s[] PROGMEM = {", name.c_str());
+                arrays += line;
+                for (size_t i = 0; i < bits.size(); i++) {
+                    snprintf(line, sizeof(line), "%s0x%02X%s", i % 12 ? " " : "\n  ", bits[i], i + 1 < bits.size() ? "," : "");
+                    arrays += line;
+                }
+                arrays += "\n};\n\n";
+                bytes += bits.size();
+            }
+        }
+    }
+
+    FILE* out = output ? fopen(output, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", output);
+        return 1;
+    }
+    fprintf(out, "// Generated by tools/wx_icon_bitmaps.cpp from src/weather_draw_functions.h, do not edit.\n");
+    fprintf(out, "// %d kinds x day/night x 16, 32, 64 px, %zu bitmaps shared, %zu bytes\n", WX_ICON_KINDS - 1, shared, bytes);
+    fprintf(out, "#ifndef WX_ICON_BITMAPS_H_\n#define WX_ICON_BITMAPS_H_\n\n#include \"wx_icon.h\"\n\n");
+    fputs(arrays.c_str(), out);
+    fprintf(out, "typedef struct {\n    const uint8_t* bits16;\n    const uint8_t* bits32;\n    const uint8_t* bits64;\n} WxIconBitmaps;\n\n");
+    fprintf(out, "// [kind][night], rows MSB first, set = ink, as drawBitmap() takes them\n");
+    fprintf(out, "constexpr WxIconBitmaps WX_ICON_BITMAPS[WX_ICON_KINDS][2] = {\n");
+    fprintf(out, "    { { nullptr, nullptr, nullptr }, { nullptr, nullptr, nullptr } }, // %s\n", KIND_NAMES[WX_ICON_UNKNOWN]);
+    for (uint8_t kind = WX_ICON_UNKNOWN + 1; kind < WX_ICON_KINDS; kind++) {
+        fprintf(out, "    {\n");
+        for (uint8_t night = 0; night < 2; night++)
+            fprintf(out, "        { %s, %s, %s },\n", names[2][kind][night].c_str(), names[1][kind][night].c_str(),
+                names[0][kind][night].c_str());
+        fprintf(out, "    },\n");
+    }
+    fprintf(out, "};\n\n#endif // WX_ICON_BITMAPS_H_\n");
+    if (output)
+        fclose(out);
+    fprintf(stderr, "%zu bytes of bitmaps, %zu shared\n", bytes, shared);
+    return 0;
+}